@@ -0,0 +1,362 @@
+// Host-side runqueue benchmark: times the kernel's runqueue under
+// Linux so runqueue changes can be measured without QEMU.
+//
+//   make bench-runqueue && ./bench-runqueue [n ...]
+//   make bench-runqueue-buckets && ./bench-runqueue-buckets [n ...]
+//
+// The first is built from skiplist.c, the second from buckets.c.
+// For each size n (default 64, 1024, 4096 and 65536) it reports
+// the mean cost of inserting n processes into an empty runqueue,
+// deleting them in random order, dispatching (popping the minimum,
+// then requeueing it with a new deadline a quantum later, as the
+// scheduler does with a CPU-bound process), and popping the
+// minimum until empty.  Without arguments the first row is the
+// workload of test.c: three processes at nice -5, 0 and 5.
+//
+// Deadlines follow compute_virtual_deadline(): ticks plus
+// BFS_DEFAULT_QUANTUM times the nice level's priority ratio, with
+// most processes at nice 0 and the rest spread over all levels, and
+// the clock advancing as processes are queued.
+//
+//   ./bench-runqueue ctx
+//
+// times the dispatch loop of the test.c workload twice: as the
+// runqueue is, and paying what it cost before its links were
+// embedded in struct proc, when insert kalloc()ed a page per level
+// and delete kfree()d them, and kfree() fills a page with junk.
+//
+//   ./bench-runqueue fork
+//
+// runs 1, 2, 4 and 8 threads, standing in for CPUs, each forking
+// children into a runqueue and dispatching from it, first all
+// sharing one runqueue under one lock, as every CPU did under
+// ptable.lock, then each with its own, as with per-CPU runqueues.
+// Threads only run in parallel on a host with that many CPUs.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "types.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "skiplist.h"
+
+// Kernel interfaces used by skiplist.c.
+void cprintf(char *fmt, ...) { }
+void initlock(struct spinlock *lk, char *name) { }
+
+#ifdef BUCKET_RUNQUEUE
+#define BACKEND "buckets"
+#else
+#define BACKEND "skiplist, " xstr(SKIPLIST_LEVELS) " levels"
+#endif
+#define xstr(s) str(s)
+#define str(s) #s
+
+#define NDISPATCH 100000
+
+static uint ticks;
+
+static int
+random_nice(void)
+{
+  if(rand() % 10 < 7)
+    return 0;
+  return BFS_NICE_FIRST_LEVEL + rand() % (BFS_NICE_LAST_LEVEL - BFS_NICE_FIRST_LEVEL + 1);
+}
+
+static uint64
+deadline(int nice)
+{
+  if(rand() % 4 == 0)
+    ticks++;
+  return ticks + BFS_DEFAULT_QUANTUM * (nice - BFS_NICE_FIRST_LEVEL + 1);
+}
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void
+fill(struct skiplist *sl, struct proc *procs, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    procs[i].virtual_deadline = deadline(procs[i].nice_value);
+    insert_node(sl, &procs[i]);
+  }
+}
+
+// Benchmark n processes, at the given nice values or random
+// ones if nice is 0.
+static void
+bench(int n, int *nice)
+{
+  struct skiplist sl;
+  struct proc *procs, *p;
+  int *order, i, j, t;
+  double start, insert, delete, dispatch, popmin;
+
+  procs = calloc(n, sizeof(*procs));
+  order = malloc(n * sizeof(*order));
+  if(procs == 0 || order == 0){
+    fprintf(stderr, "bench-runqueue: out of memory\n");
+    exit(1);
+  }
+  for(i = 0; i < n; i++){
+    procs[i].pid = i + 1;
+    procs[i].nice_value = nice ? nice[i] : random_nice();
+    order[i] = i;
+  }
+  for(i = n - 1; i > 0; i--){
+    j = rand() % (i + 1);
+    t = order[i];
+    order[i] = order[j];
+    order[j] = t;
+  }
+
+  init_skiplist(&sl);
+  start = now();
+  fill(&sl, procs, n);
+  insert = now() - start;
+
+  start = now();
+  for(i = 0; i < n; i++)
+    delete_node(&sl, &procs[order[i]]);
+  delete = now() - start;
+  if(sl.size != 0){
+    fprintf(stderr, "bench-runqueue: %d entries left after delete\n", sl.size);
+    exit(1);
+  }
+
+  fill(&sl, procs, n);
+  start = now();
+  for(i = 0; i < NDISPATCH; i++){
+    p = pop_min(&sl);
+    ticks += BFS_DEFAULT_QUANTUM;
+    p->virtual_deadline = deadline(p->nice_value);
+    insert_node(&sl, p);
+  }
+  dispatch = now() - start;
+
+  start = now();
+  while((p = pop_min(&sl)) != 0)
+    ;
+  popmin = now() - start;
+
+  printf("%8d %12.1f %12.1f %12.1f %12.1f\n", n, insert / n, delete / n,
+         dispatch / NDISPATCH, popmin / n);
+  free(procs);
+  free(order);
+}
+
+// xv6's page allocator: a free list, with kfree() filling
+// the page with junk to catch dangling references.
+static char *freepages;
+
+static char*
+kalloc(void)
+{
+  char *r = freepages;
+
+  if(r)
+    freepages = *(char**)r;
+  else if((r = malloc(PGSIZE)) == 0){
+    fprintf(stderr, "bench-runqueue: out of memory\n");
+    exit(1);
+  }
+  return r;
+}
+
+static void
+kfree(char *v)
+{
+  memset(v, 1, PGSIZE);
+  *(char**)v = freepages;
+  freepages = v;
+}
+
+// Nodes a queued process occupies, one per level.
+static int
+nodes(struct proc *p)
+{
+#ifdef BUCKET_RUNQUEUE
+  return 1;
+#else
+  return p->max_level + 1;
+#endif
+}
+
+// The dispatch loop of test.c's three processes, with or without
+// a page allocated per node on insert and freed on delete.
+static double
+ctxloop(struct proc *procs, int kallocs)
+{
+  static char *pages[3][SKIPLIST_LEVELS];
+  struct skiplist sl;
+  struct proc *p;
+  double start;
+  int i, l;
+
+  init_skiplist(&sl);
+  fill(&sl, procs, 3);
+  for(i = 0; i < 3 && kallocs; i++)
+    for(l = 0; l < nodes(&procs[i]); l++)
+      pages[i][l] = kalloc();
+
+  start = now();
+  for(i = 0; i < NDISPATCH; i++){
+    p = pop_min(&sl);
+    for(l = 0; l < nodes(p) && kallocs; l++)
+      kfree(pages[p->pid-1][l]);
+    ticks += BFS_DEFAULT_QUANTUM;
+    p->virtual_deadline = deadline(p->nice_value);
+    insert_node(&sl, p);
+    for(l = 0; l < nodes(p) && kallocs; l++)
+      pages[p->pid-1][l] = kalloc();
+  }
+  return (now() - start) / NDISPATCH;
+}
+
+static void
+ctxbench(void)
+{
+  static int testc[] = { -5, 0, 5 };
+  struct proc procs[3];
+  int i;
+
+  memset(procs, 0, sizeof(procs));
+  for(i = 0; i < 3; i++){
+    procs[i].pid = i + 1;
+    procs[i].nice_value = testc[i];
+  }
+  printf("runqueue: %s\n", BACKEND);
+  printf("dispatch, test.c workload (ns/op)\n");
+  printf("  embedded links   %8.1f\n", ctxloop(procs, 0));
+  printf("  kalloc'd nodes   %8.1f\n", ctxloop(procs, 1));
+}
+
+#define NFORK   200000
+#define NQUEUED 16
+#define NTHREAD 8
+
+struct runqueue {
+  pthread_mutex_t lock;
+  struct skiplist sl;
+};
+
+struct forker {
+  pthread_t thread;
+  struct runqueue *rq;
+  struct proc procs[NQUEUED+1];
+};
+
+// Fork a child into the runqueue and dispatch the earliest
+// deadline, which then exits and is reused as the next child.
+static void*
+forkloop(void *arg)
+{
+  struct forker *f = arg;
+  struct proc *child = &f->procs[NQUEUED];
+  uint64 clock = 0;
+  int i;
+
+  for(i = 0; i < NFORK; i++){
+    child->virtual_deadline = ++clock + BFS_DEFAULT_QUANTUM;
+    pthread_mutex_lock(&f->rq->lock);
+    insert_node(&f->rq->sl, child);
+    child = pop_min(&f->rq->sl);
+    pthread_mutex_unlock(&f->rq->lock);
+  }
+  return 0;
+}
+
+// ns per fork with n threads, all on one runqueue if shared.
+static double
+forkrun(int n, int shared)
+{
+  static struct runqueue rqs[NTHREAD];
+  static struct forker forkers[NTHREAD];
+  struct forker *f;
+  double start;
+  int i, j;
+
+  memset(forkers, 0, sizeof(forkers));
+  for(i = 0; i < n; i++){
+    pthread_mutex_init(&rqs[i].lock, 0);
+    init_skiplist(&rqs[i].sl);
+  }
+  for(i = 0; i < n; i++){
+    f = &forkers[i];
+    f->rq = &rqs[shared ? 0 : i];
+    for(j = 0; j < NQUEUED; j++){
+      f->procs[j].pid = i*(NQUEUED+1) + j + 1;
+      f->procs[j].virtual_deadline = BFS_DEFAULT_QUANTUM;
+      insert_node(&f->rq->sl, &f->procs[j]);
+    }
+    f->procs[NQUEUED].pid = i*(NQUEUED+1) + NQUEUED + 1;
+  }
+
+  start = now();
+  for(i = 0; i < n; i++)
+    if(pthread_create(&forkers[i].thread, 0, forkloop, &forkers[i]) != 0){
+      fprintf(stderr, "bench-runqueue: cannot create thread\n");
+      exit(1);
+    }
+  for(i = 0; i < n; i++)
+    pthread_join(forkers[i].thread, 0);
+  return (now() - start) / ((double)n * NFORK);
+}
+
+static void
+forkbench(void)
+{
+  int n;
+
+  printf("runqueue: %s\n", BACKEND);
+  printf("fork and dispatch (ns/op, all threads)\n");
+  printf("threads       shared      per-cpu\n");
+  for(n = 1; n <= NTHREAD; n *= 2)
+    printf("%7d %12.1f %12.1f\n", n, forkrun(n, 1), forkrun(n, 0));
+}
+
+int
+main(int argc, char *argv[])
+{
+  static int testc[] = { -5, 0, 5 };
+  int i;
+
+  srand(1);
+  if(argc == 2 && strcmp(argv[1], "ctx") == 0){
+    ctxbench();
+    return 0;
+  }
+  if(argc == 2 && strcmp(argv[1], "fork") == 0){
+    forkbench();
+    return 0;
+  }
+  printf("runqueue: %s\n", BACKEND);
+  printf("%8s %12s %12s %12s %12s   (ns/op)\n", "entries", "insert", "delete",
+         "dispatch", "pop-min");
+  if(argc < 2){
+    bench(3, testc);
+    bench(64, 0);
+    bench(1024, 0);
+    bench(4096, 0);
+    bench(65536, 0);
+  }
+  for(i = 1; i < argc; i++)
+    bench(atoi(argv[i]), 0);
+  return 0;
+}
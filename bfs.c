@@ -0,0 +1,87 @@
+// BFS policy helpers.
+//
+// Like skiplist.c, this file is also linked into host programs
+// (schedsim), which provide their own readticks64(), so the rules
+// here are the ones the simulator replays.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "skiplist.h"
+#include "bfs.h"
+
+#define NULL 0
+
+// Virtual deadline of a process with the given nice value that
+// starts a new quantum now: nicer processes get later deadlines.
+// Deadlines are 64-bit ticks, so they never wrap around.
+uint64
+compute_virtual_deadline(int nice_value)
+{
+  int priority_ratio = nice_value - BFS_NICE_FIRST_LEVEL + 1;
+  return readticks64() + (BFS_DEFAULT_QUANTUM * priority_ratio);
+}
+
+// A process that used up its quantum gets a new deadline; one that
+// gave up the CPU early keeps the one it had.
+void
+bfs_renew_deadline(struct proc *p)
+{
+  if(p->slice == 0)
+    p->virtual_deadline = compute_virtual_deadline(p->nice_value);
+}
+
+// Only a process whose quantum ran out gets a new one, of
+// BFS_DEFAULT_QUANTUM ticks of tick_cycles each.
+void
+bfs_refill(struct proc *p, uint tick_cycles)
+{
+  if(p->slice == 0){
+    p->slice = (uint64)BFS_DEFAULT_QUANTUM * tick_cycles;
+    p->ticks_left = BFS_DEFAULT_QUANTUM;
+  }
+}
+
+// Should a process with deadline d, queued on another CPU, run
+// before one with deadline local on this CPU?  Only if it is more
+// than slack earlier, so that processes mostly stay where their
+// caches are warm.
+int
+bfs_steals(uint64 d, uint64 local, int slack)
+{
+  return d + slack < local;
+}
+
+// The runqueue, out of rqs[0..n-1], that the CPU owning rqs[self]
+// should run next from, or 0 if all are empty.  Normally that is
+// its own, but a remote head whose key is more than slack earlier
+// is taken instead, so the global order is kept within slack.  An
+// idle CPU steals the earliest remote head, breaking ties towards
+// the busiest queue.  Only the unlocked size and min_deadline hints
+// are read.
+struct skiplist*
+bfs_select_rq(struct skiplist *rqs, int n, int self, int slack)
+{
+  struct skiplist *rq, *best;
+  int i;
+
+  best = rqs[self].size > 0 ? &rqs[self] : NULL;
+  for(i = 0; i < n; i++){
+    rq = &rqs[i];
+    if(i == self || rq->size == 0)
+      continue;
+    if(best == NULL)
+      best = rq;
+    else if(best == &rqs[self]){
+      if(bfs_steals(rq->min_deadline, best->min_deadline, slack))
+        best = rq;
+    } else if(rq->min_deadline < best->min_deadline ||
+              (rq->min_deadline == best->min_deadline &&
+               rq->size > best->size))
+      best = rq;
+  }
+  return best;
+}
@@ -2,3 +2,43 @@
 #define BFS_NICE_FIRST_LEVEL -20
 #define BFS_NICE_LAST_LEVEL 19
 
+// Skip list height.  Each level holds about a quarter of the nodes
+// of the one below, so log4(NPROC) + 1 levels keep searches
+// logarithmic even with every process runnable.
+#if NPROC <= 4
+#define SKIPLIST_LEVELS 2
+#elif NPROC <= 16
+#define SKIPLIST_LEVELS 3
+#elif NPROC <= 64
+#define SKIPLIST_LEVELS 4
+#elif NPROC <= 256
+#define SKIPLIST_LEVELS 5
+#elif NPROC <= 1024
+#define SKIPLIST_LEVELS 6
+#elif NPROC <= 4096
+#define SKIPLIST_LEVELS 7
+#elif NPROC <= 16384
+#define SKIPLIST_LEVELS 8
+#elif NPROC <= 65536
+#define SKIPLIST_LEVELS 9
+#else
+#define SKIPLIST_LEVELS 10
+#endif
+
+// Deadline-bucket runqueue (make RUNQUEUE=buckets): the number of
+// buckets, a power of two, and the ticks each one covers.  The
+// window they form spans the 40 quanta a deadline can lie past ticks.
+#define RUNQUEUE_BUCKETS 64
+#define RUNQUEUE_BUCKET_WIDTH 32
+
+// Default affinity window: a CPU runs a task from another CPU's
+// runqueue instead of its own only when the remote deadline is
+// earlier by more than this many ticks.  0 means strict global
+// earliest-deadline order.  Settable at run time with affinity().
+#define BFS_AFFINITY_WINDOW BFS_DEFAULT_QUANTUM
+
+// Isochronous class: the default share of all CPUs its processes
+// may use (settable at run time with isocpu()), and the length of
+// the rolling window it is measured over, as a power of two ticks.
+#define BFS_ISO_CPU 70
+#define BFS_ISO_SHIFT 9
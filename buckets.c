@@ -0,0 +1,269 @@
+// BFS runqueue: deadline buckets indexed by a bitmap.
+//
+// An alternative to the skip list in skiplist.c behind the same
+// interface, selected with make RUNQUEUE=buckets.  Processes are
+// filed by virtual deadline into RUNQUEUE_BUCKETS buckets of
+// RUNQUEUE_BUCKET_WIDTH ticks each, forming a window that starts
+// at the bucket of the earliest queued deadline.  One bit per
+// bucket records which are non-empty, so the earliest deadline is
+// found with a bit scan instead of a search.  Each bucket is kept
+// sorted, inserting from its tail, so the order is exact rather
+// than to bucket granularity.
+//
+// The price is that insert is not O(1): it walks back past every
+// later deadline in the bucket.  That is free when deadlines arrive
+// in order, as most do, but with many processes per bucket and
+// mixed nice values it is linear in the bucket's size; at 65536
+// processes (about 1000 per bucket) bench-runqueue-buckets inserts
+// ten times slower than the skip list.
+//
+// A deadline before the window goes into its first bucket, and
+// one past the window into a sorted overflow list that is moved
+// into buckets as the window advances.  Deadlines are at most
+// 40 quanta past ticks, so with the defaults in bfs.h the window
+// covers them and the overflow list normally stays empty.
+//
+// A queued process uses only nodes[0]: prev and next link it into
+// its list and forward points at the list's head, whose prev is
+// the list's tail.  Like skiplist.c, this file is linked into host
+// programs, so it must only use cprintf, initlock and TRACE.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "skiplist.h"
+#include "trace.h"
+
+#define NULL 0
+#define NWORD (RUNQUEUE_BUCKETS / 32)
+
+#if RUNQUEUE_BUCKETS % 32 != 0 || (RUNQUEUE_BUCKETS & (RUNQUEUE_BUCKETS - 1)) != 0
+#error RUNQUEUE_BUCKETS must be a power of two and a multiple of 32
+#endif
+// Deadlines are 64-bit; a power of two width keeps dividing
+// them a shift, as the kernel has no 64-bit division.
+#if (RUNQUEUE_BUCKET_WIDTH & (RUNQUEUE_BUCKET_WIDTH - 1)) != 0
+#error RUNQUEUE_BUCKET_WIDTH must be a power of two
+#endif
+
+static void
+init_head(struct node *h)
+{
+  h->proc = NULL;
+  h->virtual_deadline = 0;
+  h->prev = h;
+  h->next = NULL;
+  h->forward = NULL;
+}
+
+void
+init_skiplist(struct skiplist *rq)
+{
+  int i;
+
+  initlock(&rq->lock, "runqueue");
+  rq->size = 0;
+  rq->min_deadline = 0;
+  rq->base = 0;
+  for(i = 0; i < NWORD; i++)
+    rq->bitmap[i] = 0;
+  for(i = 0; i < RUNQUEUE_BUCKETS; i++)
+    init_head(&rq->buckets[i]);
+  init_head(&rq->overflow);
+}
+
+// Link n into the sorted list headed by h, after any equal
+// deadlines.  New deadlines usually sort last, so search
+// backwards from the tail; others cost a step per later one.
+static void
+insert_sorted(struct node *h, struct node *n)
+{
+  struct node *prev = h->prev;
+
+  while(prev != h && prev->virtual_deadline > n->virtual_deadline)
+    prev = prev->prev;
+  n->prev = prev;
+  n->next = prev->next;
+  n->forward = h;
+  if(n->next != NULL)
+    n->next->prev = n;
+  else
+    h->prev = n;
+  prev->next = n;
+}
+
+static void
+unlink(struct node *n)
+{
+  struct node *h = n->forward;
+
+  n->prev->next = n->next;
+  if(n->next != NULL)
+    n->next->prev = n->prev;
+  else
+    h->prev = n->prev;
+}
+
+// File n under bucket number b, which must lie in the window.
+static void
+insert_bucket(struct skiplist *rq, uint64 b, struct node *n)
+{
+  int i = b & (RUNQUEUE_BUCKETS - 1);
+
+  insert_sorted(&rq->buckets[i], n);
+  rq->bitmap[i / 32] |= 1U << (i % 32);
+}
+
+// Index of the first non-empty bucket in window order, or -1.
+static int
+first_bucket(struct skiplist *rq)
+{
+  int start = rq->base & (RUNQUEUE_BUCKETS - 1);
+  int w = start / 32, k;
+  uint bits = rq->bitmap[w] & (~0U << (start % 32));
+
+  // The start word is visited twice: first for the buckets from
+  // start on, last for the ones before start that wrapped around.
+  for(k = 0; k <= NWORD; k++){
+    if(bits)
+      return w * 32 + __builtin_ctz(bits);
+    w = (w + 1) % NWORD;
+    bits = rq->bitmap[w];
+  }
+  return -1;
+}
+
+// The node with the earliest deadline, or NULL if rq is empty.
+static struct node*
+first_node(struct skiplist *rq)
+{
+  int i = first_bucket(rq);
+
+  if(i >= 0)
+    return rq->buckets[i].next;
+  return rq->overflow.next;
+}
+
+// Move the window up to the earliest queued deadline and refill
+// its tail end from the overflow list.
+static void
+advance(struct skiplist *rq)
+{
+  struct node *n;
+  int i;
+
+  i = first_bucket(rq);
+  if(i >= 0)
+    rq->base += (i - rq->base) & (RUNQUEUE_BUCKETS - 1);
+  else if(rq->overflow.next != NULL)
+    rq->base = rq->overflow.next->virtual_deadline / RUNQUEUE_BUCKET_WIDTH;
+  else
+    return;
+
+  while((n = rq->overflow.next) != NULL &&
+        n->virtual_deadline / RUNQUEUE_BUCKET_WIDTH < rq->base + RUNQUEUE_BUCKETS){
+    unlink(n);
+    insert_bucket(rq, n->virtual_deadline / RUNQUEUE_BUCKET_WIDTH, n);
+  }
+  rq->min_deadline = first_node(rq)->virtual_deadline;
+}
+
+void
+insert_node(struct skiplist *rq, struct proc *p)
+{
+  struct node *n = &p->nodes[0];
+  uint64 b = p->virtual_deadline / RUNQUEUE_BUCKET_WIDTH;
+
+  n->proc = p;
+  n->virtual_deadline = p->virtual_deadline;
+  if(rq->size == 0){
+    rq->base = b;
+    rq->min_deadline = p->virtual_deadline;
+  } else if(p->virtual_deadline < rq->min_deadline)
+    rq->min_deadline = p->virtual_deadline;
+
+  if(b < rq->base)
+    b = rq->base;
+  if(b < rq->base + RUNQUEUE_BUCKETS)
+    insert_bucket(rq, b, n);
+  else
+    insert_sorted(&rq->overflow, n);
+
+  p->max_level = 0;
+  p->runqueue = rq;
+  rq->size++;
+  TRACE(TRACE_RUNQUEUE, "inserted|[%d]%d\n", p->pid, p->max_level);
+}
+
+static void
+unlink_node(struct skiplist *rq, struct proc *p)
+{
+  struct node *n = &p->nodes[0], *h = n->forward;
+  int i;
+
+  unlink(n);
+  if(h != &rq->overflow && h->next == NULL){
+    i = h - rq->buckets;
+    rq->bitmap[i / 32] &= ~(1U << (i % 32));
+  }
+  rq->size--;
+  advance(rq);
+  TRACE(TRACE_RUNQUEUE, "removed|[%d]%d\n", p->pid, p->max_level);
+  p->max_level = -1;
+  p->runqueue = NULL;
+}
+
+void
+delete_node(struct skiplist *rq, struct proc *p)
+{
+  if(p->runqueue == rq)
+    unlink_node(rq, p);
+}
+
+// Return the process with the earliest virtual deadline,
+// or NULL if the runqueue is empty.
+struct proc*
+get_minimum(struct skiplist *rq)
+{
+  struct node *n = first_node(rq);
+
+  return n != NULL ? n->proc : NULL;
+}
+
+// Remove and return the process with the earliest virtual
+// deadline, or NULL if the runqueue is empty.
+struct proc*
+pop_min(struct skiplist *rq)
+{
+  struct proc *p = get_minimum(rq);
+
+  if(p != NULL)
+    unlink_node(rq, p);
+  return p;
+}
+
+static void
+print_list(char *name, int i, struct node *h)
+{
+  struct node *n;
+
+  cprintf("%s %d: ", name, i);
+  for(n = h->next; n != NULL; n = n->next)
+    cprintf("%d(pid:%d) -> ", (uint)n->virtual_deadline, n->proc->pid);
+  cprintf("\n");
+}
+
+void
+print_skiplist(struct skiplist *rq)
+{
+  int i;
+
+  for(i = 0; i < RUNQUEUE_BUCKETS; i++)
+    if(rq->buckets[i].next != NULL)
+      print_list("bucket", i, &rq->buckets[i]);
+  if(rq->overflow.next != NULL)
+    print_list("overflow", 0, &rq->overflow);
+}
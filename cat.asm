@@ -0,0 +1,631 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	68 00 02 00 00       	push   $0x200
+  10:	68 e0 04 00 00       	push   $0x4e0
+  15:	56                   	push   %esi
+  16:	e8 ff 00 00 00       	call   11a <read>
+  1b:	89 c3                	mov    %eax,%ebx
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	85 c0                	test   %eax,%eax
+  22:	7e 2b                	jle    4f <cat+0x4f>
+    if (write(1, buf, n) != n) {
+  24:	83 ec 04             	sub    $0x4,%esp
+  27:	53                   	push   %ebx
+  28:	68 e0 04 00 00       	push   $0x4e0
+  2d:	6a 01                	push   $0x1
+  2f:	e8 ee 00 00 00       	call   122 <write>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	39 d8                	cmp    %ebx,%eax
+  39:	74 cd                	je     8 <cat+0x8>
+      printf(1, "cat: write error\n");
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	68 20 04 00 00       	push   $0x420
+  43:	6a 01                	push   $0x1
+  45:	e8 6d 02 00 00       	call   2b7 <printf>
+      exit();
+  4a:	e8 b3 00 00 00       	call   102 <exit>
+    }
+  }
+  if(n < 0){
+  4f:	78 07                	js     58 <cat+0x58>
+    printf(1, "cat: read error\n");
+    exit();
+  }
+}
+  51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  54:	5b                   	pop    %ebx
+  55:	5e                   	pop    %esi
+  56:	5d                   	pop    %ebp
+  57:	c3                   	ret
+    printf(1, "cat: read error\n");
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	68 32 04 00 00       	push   $0x432
+  60:	6a 01                	push   $0x1
+  62:	e8 50 02 00 00       	call   2b7 <printf>
+    exit();
+  67:	e8 96 00 00 00       	call   102 <exit>
+
+0000006c <main>:
+
+int
+main(int argc, char *argv[])
+{
+  6c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  70:	83 e4 f0             	and    $0xfffffff0,%esp
+  73:	ff 71 fc             	push   -0x4(%ecx)
+  76:	55                   	push   %ebp
+  77:	89 e5                	mov    %esp,%ebp
+  79:	57                   	push   %edi
+  7a:	56                   	push   %esi
+  7b:	53                   	push   %ebx
+  7c:	51                   	push   %ecx
+  7d:	83 ec 18             	sub    $0x18,%esp
+  80:	8b 01                	mov    (%ecx),%eax
+  82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  85:	8b 51 04             	mov    0x4(%ecx),%edx
+  88:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+  8b:	83 f8 01             	cmp    $0x1,%eax
+  8e:	7e 07                	jle    97 <main+0x2b>
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  90:	be 01 00 00 00       	mov    $0x1,%esi
+  95:	eb 26                	jmp    bd <main+0x51>
+    cat(0);
+  97:	83 ec 0c             	sub    $0xc,%esp
+  9a:	6a 00                	push   $0x0
+  9c:	e8 5f ff ff ff       	call   0 <cat>
+    exit();
+  a1:	e8 5c 00 00 00       	call   102 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  a6:	83 ec 0c             	sub    $0xc,%esp
+  a9:	50                   	push   %eax
+  aa:	e8 51 ff ff ff       	call   0 <cat>
+    close(fd);
+  af:	89 1c 24             	mov    %ebx,(%esp)
+  b2:	e8 73 00 00 00       	call   12a <close>
+  for(i = 1; i < argc; i++){
+  b7:	83 c6 01             	add    $0x1,%esi
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  c0:	39 c6                	cmp    %eax,%esi
+  c2:	7d 31                	jge    f5 <main+0x89>
+    if((fd = open(argv[i], 0)) < 0){
+  c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  c7:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+  ca:	83 ec 08             	sub    $0x8,%esp
+  cd:	6a 00                	push   $0x0
+  cf:	ff 37                	push   (%edi)
+  d1:	e8 6c 00 00 00       	call   142 <open>
+  d6:	89 c3                	mov    %eax,%ebx
+  d8:	83 c4 10             	add    $0x10,%esp
+  db:	85 c0                	test   %eax,%eax
+  dd:	79 c7                	jns    a6 <main+0x3a>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  df:	83 ec 04             	sub    $0x4,%esp
+  e2:	ff 37                	push   (%edi)
+  e4:	68 43 04 00 00       	push   $0x443
+  e9:	6a 01                	push   $0x1
+  eb:	e8 c7 01 00 00       	call   2b7 <printf>
+      exit();
+  f0:	e8 0d 00 00 00       	call   102 <exit>
+  }
+  exit();
+  f5:	e8 08 00 00 00       	call   102 <exit>
+
+000000fa <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  ff:	cd 40                	int    $0x40
+ 101:	c3                   	ret
+
+00000102 <exit>:
+SYSCALL(exit)
+ 102:	b8 02 00 00 00       	mov    $0x2,%eax
+ 107:	cd 40                	int    $0x40
+ 109:	c3                   	ret
+
+0000010a <wait>:
+SYSCALL(wait)
+ 10a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 10f:	cd 40                	int    $0x40
+ 111:	c3                   	ret
+
+00000112 <pipe>:
+SYSCALL(pipe)
+ 112:	b8 04 00 00 00       	mov    $0x4,%eax
+ 117:	cd 40                	int    $0x40
+ 119:	c3                   	ret
+
+0000011a <read>:
+SYSCALL(read)
+ 11a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 11f:	cd 40                	int    $0x40
+ 121:	c3                   	ret
+
+00000122 <write>:
+SYSCALL(write)
+ 122:	b8 10 00 00 00       	mov    $0x10,%eax
+ 127:	cd 40                	int    $0x40
+ 129:	c3                   	ret
+
+0000012a <close>:
+SYSCALL(close)
+ 12a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 12f:	cd 40                	int    $0x40
+ 131:	c3                   	ret
+
+00000132 <kill>:
+SYSCALL(kill)
+ 132:	b8 06 00 00 00       	mov    $0x6,%eax
+ 137:	cd 40                	int    $0x40
+ 139:	c3                   	ret
+
+0000013a <exec>:
+SYSCALL(exec)
+ 13a:	b8 07 00 00 00       	mov    $0x7,%eax
+ 13f:	cd 40                	int    $0x40
+ 141:	c3                   	ret
+
+00000142 <open>:
+SYSCALL(open)
+ 142:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 147:	cd 40                	int    $0x40
+ 149:	c3                   	ret
+
+0000014a <mknod>:
+SYSCALL(mknod)
+ 14a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 14f:	cd 40                	int    $0x40
+ 151:	c3                   	ret
+
+00000152 <unlink>:
+SYSCALL(unlink)
+ 152:	b8 12 00 00 00       	mov    $0x12,%eax
+ 157:	cd 40                	int    $0x40
+ 159:	c3                   	ret
+
+0000015a <fstat>:
+SYSCALL(fstat)
+ 15a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 15f:	cd 40                	int    $0x40
+ 161:	c3                   	ret
+
+00000162 <link>:
+SYSCALL(link)
+ 162:	b8 13 00 00 00       	mov    $0x13,%eax
+ 167:	cd 40                	int    $0x40
+ 169:	c3                   	ret
+
+0000016a <mkdir>:
+SYSCALL(mkdir)
+ 16a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 16f:	cd 40                	int    $0x40
+ 171:	c3                   	ret
+
+00000172 <chdir>:
+SYSCALL(chdir)
+ 172:	b8 09 00 00 00       	mov    $0x9,%eax
+ 177:	cd 40                	int    $0x40
+ 179:	c3                   	ret
+
+0000017a <dup>:
+SYSCALL(dup)
+ 17a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 17f:	cd 40                	int    $0x40
+ 181:	c3                   	ret
+
+00000182 <getpid>:
+SYSCALL(getpid)
+ 182:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 187:	cd 40                	int    $0x40
+ 189:	c3                   	ret
+
+0000018a <sbrk>:
+SYSCALL(sbrk)
+ 18a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 18f:	cd 40                	int    $0x40
+ 191:	c3                   	ret
+
+00000192 <sleep>:
+SYSCALL(sleep)
+ 192:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 197:	cd 40                	int    $0x40
+ 199:	c3                   	ret
+
+0000019a <uptime>:
+SYSCALL(uptime)
+ 19a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 19f:	cd 40                	int    $0x40
+ 1a1:	c3                   	ret
+
+000001a2 <yield>:
+SYSCALL(yield)
+ 1a2:	b8 16 00 00 00       	mov    $0x16,%eax
+ 1a7:	cd 40                	int    $0x40
+ 1a9:	c3                   	ret
+
+000001aa <shutdown>:
+SYSCALL(shutdown)
+ 1aa:	b8 17 00 00 00       	mov    $0x17,%eax
+ 1af:	cd 40                	int    $0x40
+ 1b1:	c3                   	ret
+
+000001b2 <nicefork>:
+SYSCALL(nicefork)
+ 1b2:	b8 18 00 00 00       	mov    $0x18,%eax
+ 1b7:	cd 40                	int    $0x40
+ 1b9:	c3                   	ret
+
+000001ba <schedlog>:
+SYSCALL(schedlog)
+ 1ba:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1bf:	cd 40                	int    $0x40
+ 1c1:	c3                   	ret
+
+000001c2 <schedlogread>:
+SYSCALL(schedlogread)
+ 1c2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1c7:	cd 40                	int    $0x40
+ 1c9:	c3                   	ret
+
+000001ca <tracectl>:
+SYSCALL(tracectl)
+ 1ca:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1cf:	cd 40                	int    $0x40
+ 1d1:	c3                   	ret
+
+000001d2 <getcpustat>:
+SYSCALL(getcpustat)
+ 1d2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1d7:	cd 40                	int    $0x40
+ 1d9:	c3                   	ret
+
+000001da <setpolicy>:
+SYSCALL(setpolicy)
+ 1da:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 1df:	cd 40                	int    $0x40
+ 1e1:	c3                   	ret
+
+000001e2 <affinity>:
+SYSCALL(affinity)
+ 1e2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 1e7:	cd 40                	int    $0x40
+ 1e9:	c3                   	ret
+
+000001ea <setnice>:
+SYSCALL(setnice)
+ 1ea:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 1ef:	cd 40                	int    $0x40
+ 1f1:	c3                   	ret
+
+000001f2 <getnice>:
+SYSCALL(getnice)
+ 1f2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 1f7:	cd 40                	int    $0x40
+ 1f9:	c3                   	ret
+
+000001fa <setclass>:
+SYSCALL(setclass)
+ 1fa:	b8 21 00 00 00       	mov    $0x21,%eax
+ 1ff:	cd 40                	int    $0x40
+ 201:	c3                   	ret
+
+00000202 <isocpu>:
+SYSCALL(isocpu)
+ 202:	b8 22 00 00 00       	mov    $0x22,%eax
+ 207:	cd 40                	int    $0x40
+ 209:	c3                   	ret
+
+0000020a <getschedstats>:
+SYSCALL(getschedstats)
+ 20a:	b8 23 00 00 00       	mov    $0x23,%eax
+ 20f:	cd 40                	int    $0x40
+ 211:	c3                   	ret
+
+00000212 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 212:	55                   	push   %ebp
+ 213:	89 e5                	mov    %esp,%ebp
+ 215:	83 ec 1c             	sub    $0x1c,%esp
+ 218:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 21b:	6a 01                	push   $0x1
+ 21d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 220:	52                   	push   %edx
+ 221:	50                   	push   %eax
+ 222:	e8 fb fe ff ff       	call   122 <write>
+}
+ 227:	83 c4 10             	add    $0x10,%esp
+ 22a:	c9                   	leave
+ 22b:	c3                   	ret
+
+0000022c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 22c:	55                   	push   %ebp
+ 22d:	89 e5                	mov    %esp,%ebp
+ 22f:	57                   	push   %edi
+ 230:	56                   	push   %esi
+ 231:	53                   	push   %ebx
+ 232:	83 ec 2c             	sub    $0x2c,%esp
+ 235:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 238:	89 d0                	mov    %edx,%eax
+ 23a:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 23c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 240:	0f 95 c1             	setne  %cl
+ 243:	c1 ea 1f             	shr    $0x1f,%edx
+ 246:	84 d1                	test   %dl,%cl
+ 248:	74 44                	je     28e <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 24a:	f7 d8                	neg    %eax
+ 24c:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 24e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 25a:	89 c8                	mov    %ecx,%eax
+ 25c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 261:	f7 f6                	div    %esi
+ 263:	89 df                	mov    %ebx,%edi
+ 265:	83 c3 01             	add    $0x1,%ebx
+ 268:	0f b6 92 b8 04 00 00 	movzbl 0x4b8(%edx),%edx
+ 26f:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 273:	89 ca                	mov    %ecx,%edx
+ 275:	89 c1                	mov    %eax,%ecx
+ 277:	39 f2                	cmp    %esi,%edx
+ 279:	73 df                	jae    25a <printint+0x2e>
+  if(neg)
+ 27b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 27f:	74 31                	je     2b2 <printint+0x86>
+    buf[i++] = '-';
+ 281:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 286:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 289:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 28c:	eb 17                	jmp    2a5 <printint+0x79>
+    x = xx;
+ 28e:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 290:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 297:	eb bc                	jmp    255 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 299:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 29e:	89 f0                	mov    %esi,%eax
+ 2a0:	e8 6d ff ff ff       	call   212 <putc>
+  while(--i >= 0)
+ 2a5:	83 eb 01             	sub    $0x1,%ebx
+ 2a8:	79 ef                	jns    299 <printint+0x6d>
+}
+ 2aa:	83 c4 2c             	add    $0x2c,%esp
+ 2ad:	5b                   	pop    %ebx
+ 2ae:	5e                   	pop    %esi
+ 2af:	5f                   	pop    %edi
+ 2b0:	5d                   	pop    %ebp
+ 2b1:	c3                   	ret
+ 2b2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 2b5:	eb ee                	jmp    2a5 <printint+0x79>
+
+000002b7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 2b7:	55                   	push   %ebp
+ 2b8:	89 e5                	mov    %esp,%ebp
+ 2ba:	57                   	push   %edi
+ 2bb:	56                   	push   %esi
+ 2bc:	53                   	push   %ebx
+ 2bd:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 2c0:	8d 45 10             	lea    0x10(%ebp),%eax
+ 2c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 2c6:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 2cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2d0:	eb 14                	jmp    2e6 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 2d2:	89 fa                	mov    %edi,%edx
+ 2d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d7:	e8 36 ff ff ff       	call   212 <putc>
+ 2dc:	eb 05                	jmp    2e3 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 2de:	83 fe 25             	cmp    $0x25,%esi
+ 2e1:	74 25                	je     308 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 2e3:	83 c3 01             	add    $0x1,%ebx
+ 2e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e9:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 2ed:	84 c0                	test   %al,%al
+ 2ef:	0f 84 20 01 00 00    	je     415 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 2f5:	0f be f8             	movsbl %al,%edi
+ 2f8:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 2fb:	85 f6                	test   %esi,%esi
+ 2fd:	75 df                	jne    2de <printf+0x27>
+      if(c == '%'){
+ 2ff:	83 f8 25             	cmp    $0x25,%eax
+ 302:	75 ce                	jne    2d2 <printf+0x1b>
+        state = '%';
+ 304:	89 c6                	mov    %eax,%esi
+ 306:	eb db                	jmp    2e3 <printf+0x2c>
+      if(c == 'd'){
+ 308:	83 f8 25             	cmp    $0x25,%eax
+ 30b:	0f 84 cf 00 00 00    	je     3e0 <printf+0x129>
+ 311:	0f 8c dd 00 00 00    	jl     3f4 <printf+0x13d>
+ 317:	83 f8 78             	cmp    $0x78,%eax
+ 31a:	0f 8f d4 00 00 00    	jg     3f4 <printf+0x13d>
+ 320:	83 f8 63             	cmp    $0x63,%eax
+ 323:	0f 8c cb 00 00 00    	jl     3f4 <printf+0x13d>
+ 329:	83 e8 63             	sub    $0x63,%eax
+ 32c:	83 f8 15             	cmp    $0x15,%eax
+ 32f:	0f 87 bf 00 00 00    	ja     3f4 <printf+0x13d>
+ 335:	ff 24 85 60 04 00 00 	jmp    *0x460(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 33c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 33f:	8b 17                	mov    (%edi),%edx
+ 341:	83 ec 0c             	sub    $0xc,%esp
+ 344:	6a 01                	push   $0x1
+ 346:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	e8 d9 fe ff ff       	call   22c <printint>
+        ap++;
+ 353:	83 c7 04             	add    $0x4,%edi
+ 356:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 359:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 35c:	be 00 00 00 00       	mov    $0x0,%esi
+ 361:	eb 80                	jmp    2e3 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 363:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 366:	8b 17                	mov    (%edi),%edx
+ 368:	83 ec 0c             	sub    $0xc,%esp
+ 36b:	6a 00                	push   $0x0
+ 36d:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 372:	8b 45 08             	mov    0x8(%ebp),%eax
+ 375:	e8 b2 fe ff ff       	call   22c <printint>
+        ap++;
+ 37a:	83 c7 04             	add    $0x4,%edi
+ 37d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 380:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 383:	be 00 00 00 00       	mov    $0x0,%esi
+ 388:	e9 56 ff ff ff       	jmp    2e3 <printf+0x2c>
+        s = (char*)*ap;
+ 38d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 390:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 392:	83 c0 04             	add    $0x4,%eax
+ 395:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 398:	85 f6                	test   %esi,%esi
+ 39a:	75 15                	jne    3b1 <printf+0xfa>
+          s = "(null)";
+ 39c:	be 58 04 00 00       	mov    $0x458,%esi
+ 3a1:	eb 0e                	jmp    3b1 <printf+0xfa>
+          putc(fd, *s);
+ 3a3:	0f be d2             	movsbl %dl,%edx
+ 3a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a9:	e8 64 fe ff ff       	call   212 <putc>
+          s++;
+ 3ae:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 3b1:	0f b6 16             	movzbl (%esi),%edx
+ 3b4:	84 d2                	test   %dl,%dl
+ 3b6:	75 eb                	jne    3a3 <printf+0xec>
+      state = 0;
+ 3b8:	be 00 00 00 00       	mov    $0x0,%esi
+ 3bd:	e9 21 ff ff ff       	jmp    2e3 <printf+0x2c>
+        putc(fd, *ap);
+ 3c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 3c5:	0f be 17             	movsbl (%edi),%edx
+ 3c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cb:	e8 42 fe ff ff       	call   212 <putc>
+        ap++;
+ 3d0:	83 c7 04             	add    $0x4,%edi
+ 3d3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 3d6:	be 00 00 00 00       	mov    $0x0,%esi
+ 3db:	e9 03 ff ff ff       	jmp    2e3 <printf+0x2c>
+        putc(fd, c);
+ 3e0:	89 fa                	mov    %edi,%edx
+ 3e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e5:	e8 28 fe ff ff       	call   212 <putc>
+      state = 0;
+ 3ea:	be 00 00 00 00       	mov    $0x0,%esi
+ 3ef:	e9 ef fe ff ff       	jmp    2e3 <printf+0x2c>
+        putc(fd, '%');
+ 3f4:	ba 25 00 00 00       	mov    $0x25,%edx
+ 3f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fc:	e8 11 fe ff ff       	call   212 <putc>
+        putc(fd, c);
+ 401:	89 fa                	mov    %edi,%edx
+ 403:	8b 45 08             	mov    0x8(%ebp),%eax
+ 406:	e8 07 fe ff ff       	call   212 <putc>
+      state = 0;
+ 40b:	be 00 00 00 00       	mov    $0x0,%esi
+ 410:	e9 ce fe ff ff       	jmp    2e3 <printf+0x2c>
+    }
+  }
+}
+ 415:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 418:	5b                   	pop    %ebx
+ 419:	5e                   	pop    %esi
+ 41a:	5f                   	pop    %edi
+ 41b:	5d                   	pop    %ebp
+ 41c:	c3                   	ret
@@ -0,0 +1,945 @@
+
+_chclass:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+[SCHED_IDLEPRIO] "idleprio",
+};
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  13:	8b 71 04             	mov    0x4(%ecx),%esi
+  int i, old;
+
+  if(argc != 3){
+  16:	83 39 03             	cmpl   $0x3,(%ecx)
+  19:	74 23                	je     3e <main+0x3e>
+    printf(2, "usage: chclass normal|iso|idleprio pid\n");
+  1b:	83 ec 08             	sub    $0x8,%esp
+  1e:	68 f8 05 00 00       	push   $0x5f8
+  23:	6a 02                	push   $0x2
+  25:	e8 67 04 00 00       	call   491 <printf>
+    printf(2, "       chclass isocpu percent\n");
+  2a:	83 c4 08             	add    $0x8,%esp
+  2d:	68 20 06 00 00       	push   $0x620
+  32:	6a 02                	push   $0x2
+  34:	e8 58 04 00 00       	call   491 <printf>
+    exit();
+  39:	e8 9e 02 00 00       	call   2dc <exit>
+  }
+
+  if(strcmp(argv[1], "isocpu") == 0){
+  3e:	83 ec 08             	sub    $0x8,%esp
+  41:	68 3f 06 00 00       	push   $0x63f
+  46:	ff 76 04             	push   0x4(%esi)
+  49:	e8 15 01 00 00       	call   163 <strcmp>
+  4e:	83 c4 10             	add    $0x10,%esp
+  51:	85 c0                	test   %eax,%eax
+  53:	74 28                	je     7d <main+0x7d>
+    else
+      printf(1, "isocpu: %d%% -> %s%%\n", old, argv[2]);
+    exit();
+  }
+
+  for(i = 0; i < sizeof(classes)/sizeof(classes[0]); i++)
+  55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  5a:	83 fb 02             	cmp    $0x2,%ebx
+  5d:	77 67                	ja     c6 <main+0xc6>
+    if(strcmp(argv[1], classes[i]) == 0)
+  5f:	83 ec 08             	sub    $0x8,%esp
+  62:	ff 34 9d d0 06 00 00 	push   0x6d0(,%ebx,4)
+  69:	ff 76 04             	push   0x4(%esi)
+  6c:	e8 f2 00 00 00       	call   163 <strcmp>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	85 c0                	test   %eax,%eax
+  76:	74 4e                	je     c6 <main+0xc6>
+  for(i = 0; i < sizeof(classes)/sizeof(classes[0]); i++)
+  78:	83 c3 01             	add    $0x1,%ebx
+  7b:	eb dd                	jmp    5a <main+0x5a>
+    if((old = isocpu(atoi(argv[2]))) < 0)
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	ff 76 08             	push   0x8(%esi)
+  83:	e8 f0 01 00 00       	call   278 <atoi>
+  88:	89 04 24             	mov    %eax,(%esp)
+  8b:	e8 4c 03 00 00       	call   3dc <isocpu>
+  90:	83 c4 10             	add    $0x10,%esp
+  93:	85 c0                	test   %eax,%eax
+  95:	78 18                	js     af <main+0xaf>
+      printf(1, "isocpu: %d%% -> %s%%\n", old, argv[2]);
+  97:	ff 76 08             	push   0x8(%esi)
+  9a:	50                   	push   %eax
+  9b:	68 62 06 00 00       	push   $0x662
+  a0:	6a 01                	push   $0x1
+  a2:	e8 ea 03 00 00       	call   491 <printf>
+  a7:	83 c4 10             	add    $0x10,%esp
+    exit();
+  aa:	e8 2d 02 00 00       	call   2dc <exit>
+      printf(2, "chclass: bad percentage %s\n", argv[2]);
+  af:	83 ec 04             	sub    $0x4,%esp
+  b2:	ff 76 08             	push   0x8(%esi)
+  b5:	68 46 06 00 00       	push   $0x646
+  ba:	6a 02                	push   $0x2
+  bc:	e8 d0 03 00 00       	call   491 <printf>
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	eb e4                	jmp    aa <main+0xaa>
+      break;
+  if(i == sizeof(classes)/sizeof(classes[0])){
+  c6:	83 fb 03             	cmp    $0x3,%ebx
+  c9:	74 44                	je     10f <main+0x10f>
+    printf(2, "chclass: unknown class %s\n", argv[1]);
+    exit();
+  }
+  if((old = setclass(atoi(argv[2]), i)) < 0)
+  cb:	83 ec 0c             	sub    $0xc,%esp
+  ce:	ff 76 08             	push   0x8(%esi)
+  d1:	e8 a2 01 00 00       	call   278 <atoi>
+  d6:	83 c4 08             	add    $0x8,%esp
+  d9:	53                   	push   %ebx
+  da:	50                   	push   %eax
+  db:	e8 f4 02 00 00       	call   3d4 <setclass>
+  e0:	83 c4 10             	add    $0x10,%esp
+  e3:	85 c0                	test   %eax,%eax
+  e5:	78 3f                	js     126 <main+0x126>
+    printf(2, "chclass: no process %s\n", argv[2]);
+  else
+    printf(1, "%s: %s -> %s\n", argv[2], classes[old], classes[i]);
+  e7:	83 ec 0c             	sub    $0xc,%esp
+  ea:	ff 34 9d d0 06 00 00 	push   0x6d0(,%ebx,4)
+  f1:	ff 34 85 d0 06 00 00 	push   0x6d0(,%eax,4)
+  f8:	ff 76 08             	push   0x8(%esi)
+  fb:	68 ab 06 00 00       	push   $0x6ab
+ 100:	6a 01                	push   $0x1
+ 102:	e8 8a 03 00 00       	call   491 <printf>
+ 107:	83 c4 20             	add    $0x20,%esp
+  exit();
+ 10a:	e8 cd 01 00 00       	call   2dc <exit>
+    printf(2, "chclass: unknown class %s\n", argv[1]);
+ 10f:	83 ec 04             	sub    $0x4,%esp
+ 112:	ff 76 04             	push   0x4(%esi)
+ 115:	68 78 06 00 00       	push   $0x678
+ 11a:	6a 02                	push   $0x2
+ 11c:	e8 70 03 00 00       	call   491 <printf>
+    exit();
+ 121:	e8 b6 01 00 00       	call   2dc <exit>
+    printf(2, "chclass: no process %s\n", argv[2]);
+ 126:	83 ec 04             	sub    $0x4,%esp
+ 129:	ff 76 08             	push   0x8(%esi)
+ 12c:	68 93 06 00 00       	push   $0x693
+ 131:	6a 02                	push   $0x2
+ 133:	e8 59 03 00 00       	call   491 <printf>
+ 138:	83 c4 10             	add    $0x10,%esp
+ 13b:	eb cd                	jmp    10a <main+0x10a>
+
+0000013d <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 13d:	55                   	push   %ebp
+ 13e:	89 e5                	mov    %esp,%ebp
+ 140:	56                   	push   %esi
+ 141:	53                   	push   %ebx
+ 142:	8b 75 08             	mov    0x8(%ebp),%esi
+ 145:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 148:	89 f0                	mov    %esi,%eax
+ 14a:	89 d1                	mov    %edx,%ecx
+ 14c:	83 c2 01             	add    $0x1,%edx
+ 14f:	89 c3                	mov    %eax,%ebx
+ 151:	83 c0 01             	add    $0x1,%eax
+ 154:	0f b6 09             	movzbl (%ecx),%ecx
+ 157:	88 0b                	mov    %cl,(%ebx)
+ 159:	84 c9                	test   %cl,%cl
+ 15b:	75 ed                	jne    14a <strcpy+0xd>
+    ;
+  return os;
+}
+ 15d:	89 f0                	mov    %esi,%eax
+ 15f:	5b                   	pop    %ebx
+ 160:	5e                   	pop    %esi
+ 161:	5d                   	pop    %ebp
+ 162:	c3                   	ret
+
+00000163 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 163:	55                   	push   %ebp
+ 164:	89 e5                	mov    %esp,%ebp
+ 166:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 169:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 16c:	eb 06                	jmp    174 <strcmp+0x11>
+    p++, q++;
+ 16e:	83 c1 01             	add    $0x1,%ecx
+ 171:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 174:	0f b6 01             	movzbl (%ecx),%eax
+ 177:	84 c0                	test   %al,%al
+ 179:	74 04                	je     17f <strcmp+0x1c>
+ 17b:	3a 02                	cmp    (%edx),%al
+ 17d:	74 ef                	je     16e <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 17f:	0f b6 c0             	movzbl %al,%eax
+ 182:	0f b6 12             	movzbl (%edx),%edx
+ 185:	29 d0                	sub    %edx,%eax
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+
+00000189 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 189:	55                   	push   %ebp
+ 18a:	89 e5                	mov    %esp,%ebp
+ 18c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 18f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 194:	eb 03                	jmp    199 <strlen+0x10>
+ 196:	83 c0 01             	add    $0x1,%eax
+ 199:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 19d:	75 f7                	jne    196 <strlen+0xd>
+    ;
+  return n;
+}
+ 19f:	5d                   	pop    %ebp
+ 1a0:	c3                   	ret
+
+000001a1 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1a1:	55                   	push   %ebp
+ 1a2:	89 e5                	mov    %esp,%ebp
+ 1a4:	57                   	push   %edi
+ 1a5:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1a8:	89 d7                	mov    %edx,%edi
+ 1aa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b0:	fc                   	cld
+ 1b1:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1b3:	89 d0                	mov    %edx,%eax
+ 1b5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1b8:	c9                   	leave
+ 1b9:	c3                   	ret
+
+000001ba <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1ba:	55                   	push   %ebp
+ 1bb:	89 e5                	mov    %esp,%ebp
+ 1bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1c4:	eb 03                	jmp    1c9 <strchr+0xf>
+ 1c6:	83 c0 01             	add    $0x1,%eax
+ 1c9:	0f b6 10             	movzbl (%eax),%edx
+ 1cc:	84 d2                	test   %dl,%dl
+ 1ce:	74 06                	je     1d6 <strchr+0x1c>
+    if(*s == c)
+ 1d0:	38 ca                	cmp    %cl,%dl
+ 1d2:	75 f2                	jne    1c6 <strchr+0xc>
+ 1d4:	eb 05                	jmp    1db <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1db:	5d                   	pop    %ebp
+ 1dc:	c3                   	ret
+
+000001dd <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	57                   	push   %edi
+ 1e1:	56                   	push   %esi
+ 1e2:	53                   	push   %ebx
+ 1e3:	83 ec 1c             	sub    $0x1c,%esp
+ 1e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1ee:	89 de                	mov    %ebx,%esi
+ 1f0:	83 c3 01             	add    $0x1,%ebx
+ 1f3:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1f6:	7d 2e                	jge    226 <gets+0x49>
+    cc = read(0, &c, 1);
+ 1f8:	83 ec 04             	sub    $0x4,%esp
+ 1fb:	6a 01                	push   $0x1
+ 1fd:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 200:	50                   	push   %eax
+ 201:	6a 00                	push   $0x0
+ 203:	e8 ec 00 00 00       	call   2f4 <read>
+    if(cc < 1)
+ 208:	83 c4 10             	add    $0x10,%esp
+ 20b:	85 c0                	test   %eax,%eax
+ 20d:	7e 17                	jle    226 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 20f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 213:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 216:	3c 0a                	cmp    $0xa,%al
+ 218:	0f 94 c2             	sete   %dl
+ 21b:	3c 0d                	cmp    $0xd,%al
+ 21d:	0f 94 c0             	sete   %al
+ 220:	08 c2                	or     %al,%dl
+ 222:	74 ca                	je     1ee <gets+0x11>
+    buf[i++] = c;
+ 224:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 226:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 22a:	89 f8                	mov    %edi,%eax
+ 22c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22f:	5b                   	pop    %ebx
+ 230:	5e                   	pop    %esi
+ 231:	5f                   	pop    %edi
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+
+00000234 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 234:	55                   	push   %ebp
+ 235:	89 e5                	mov    %esp,%ebp
+ 237:	56                   	push   %esi
+ 238:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 239:	83 ec 08             	sub    $0x8,%esp
+ 23c:	6a 00                	push   $0x0
+ 23e:	ff 75 08             	push   0x8(%ebp)
+ 241:	e8 d6 00 00 00       	call   31c <open>
+  if(fd < 0)
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	78 24                	js     271 <stat+0x3d>
+ 24d:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 24f:	83 ec 08             	sub    $0x8,%esp
+ 252:	ff 75 0c             	push   0xc(%ebp)
+ 255:	50                   	push   %eax
+ 256:	e8 d9 00 00 00       	call   334 <fstat>
+ 25b:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 25d:	89 1c 24             	mov    %ebx,(%esp)
+ 260:	e8 9f 00 00 00       	call   304 <close>
+  return r;
+ 265:	83 c4 10             	add    $0x10,%esp
+}
+ 268:	89 f0                	mov    %esi,%eax
+ 26a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 26d:	5b                   	pop    %ebx
+ 26e:	5e                   	pop    %esi
+ 26f:	5d                   	pop    %ebp
+ 270:	c3                   	ret
+    return -1;
+ 271:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 276:	eb f0                	jmp    268 <stat+0x34>
+
+00000278 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 278:	55                   	push   %ebp
+ 279:	89 e5                	mov    %esp,%ebp
+ 27b:	53                   	push   %ebx
+ 27c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 27f:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 284:	eb 10                	jmp    296 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 286:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 289:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 28c:	83 c1 01             	add    $0x1,%ecx
+ 28f:	0f be c0             	movsbl %al,%eax
+ 292:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 296:	0f b6 01             	movzbl (%ecx),%eax
+ 299:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 29c:	80 fb 09             	cmp    $0x9,%bl
+ 29f:	76 e5                	jbe    286 <atoi+0xe>
+  return n;
+}
+ 2a1:	89 d0                	mov    %edx,%eax
+ 2a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a6:	c9                   	leave
+ 2a7:	c3                   	ret
+
+000002a8 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2a8:	55                   	push   %ebp
+ 2a9:	89 e5                	mov    %esp,%ebp
+ 2ab:	56                   	push   %esi
+ 2ac:	53                   	push   %ebx
+ 2ad:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2b3:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 2b6:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 2b8:	eb 0d                	jmp    2c7 <memmove+0x1f>
+    *dst++ = *src++;
+ 2ba:	0f b6 01             	movzbl (%ecx),%eax
+ 2bd:	88 02                	mov    %al,(%edx)
+ 2bf:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 2c2:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 2c5:	89 d8                	mov    %ebx,%eax
+ 2c7:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2ca:	85 c0                	test   %eax,%eax
+ 2cc:	7f ec                	jg     2ba <memmove+0x12>
+  return vdst;
+}
+ 2ce:	89 f0                	mov    %esi,%eax
+ 2d0:	5b                   	pop    %ebx
+ 2d1:	5e                   	pop    %esi
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+
+000002d4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2d4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <exit>:
+SYSCALL(exit)
+ 2dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <wait>:
+SYSCALL(wait)
+ 2e4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <pipe>:
+SYSCALL(pipe)
+ 2ec:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <read>:
+SYSCALL(read)
+ 2f4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <write>:
+SYSCALL(write)
+ 2fc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <close>:
+SYSCALL(close)
+ 304:	b8 15 00 00 00       	mov    $0x15,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <kill>:
+SYSCALL(kill)
+ 30c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <exec>:
+SYSCALL(exec)
+ 314:	b8 07 00 00 00       	mov    $0x7,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <open>:
+SYSCALL(open)
+ 31c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <mknod>:
+SYSCALL(mknod)
+ 324:	b8 11 00 00 00       	mov    $0x11,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <unlink>:
+SYSCALL(unlink)
+ 32c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <fstat>:
+SYSCALL(fstat)
+ 334:	b8 08 00 00 00       	mov    $0x8,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <link>:
+SYSCALL(link)
+ 33c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <mkdir>:
+SYSCALL(mkdir)
+ 344:	b8 14 00 00 00       	mov    $0x14,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <chdir>:
+SYSCALL(chdir)
+ 34c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <dup>:
+SYSCALL(dup)
+ 354:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <getpid>:
+SYSCALL(getpid)
+ 35c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <sbrk>:
+SYSCALL(sbrk)
+ 364:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <sleep>:
+SYSCALL(sleep)
+ 36c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <uptime>:
+SYSCALL(uptime)
+ 374:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <yield>:
+SYSCALL(yield)
+ 37c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <shutdown>:
+SYSCALL(shutdown)
+ 384:	b8 17 00 00 00       	mov    $0x17,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <nicefork>:
+SYSCALL(nicefork)
+ 38c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <schedlog>:
+SYSCALL(schedlog)
+ 394:	b8 19 00 00 00       	mov    $0x19,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <schedlogread>:
+SYSCALL(schedlogread)
+ 39c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <tracectl>:
+SYSCALL(tracectl)
+ 3a4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <getcpustat>:
+SYSCALL(getcpustat)
+ 3ac:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <setpolicy>:
+SYSCALL(setpolicy)
+ 3b4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <affinity>:
+SYSCALL(affinity)
+ 3bc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <setnice>:
+SYSCALL(setnice)
+ 3c4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <getnice>:
+SYSCALL(getnice)
+ 3cc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <setclass>:
+SYSCALL(setclass)
+ 3d4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <isocpu>:
+SYSCALL(isocpu)
+ 3dc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <getschedstats>:
+SYSCALL(getschedstats)
+ 3e4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3ec:	55                   	push   %ebp
+ 3ed:	89 e5                	mov    %esp,%ebp
+ 3ef:	83 ec 1c             	sub    $0x1c,%esp
+ 3f2:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3f5:	6a 01                	push   $0x1
+ 3f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3fa:	52                   	push   %edx
+ 3fb:	50                   	push   %eax
+ 3fc:	e8 fb fe ff ff       	call   2fc <write>
+}
+ 401:	83 c4 10             	add    $0x10,%esp
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+
+00000406 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 406:	55                   	push   %ebp
+ 407:	89 e5                	mov    %esp,%ebp
+ 409:	57                   	push   %edi
+ 40a:	56                   	push   %esi
+ 40b:	53                   	push   %ebx
+ 40c:	83 ec 2c             	sub    $0x2c,%esp
+ 40f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 412:	89 d0                	mov    %edx,%eax
+ 414:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 416:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 41a:	0f 95 c1             	setne  %cl
+ 41d:	c1 ea 1f             	shr    $0x1f,%edx
+ 420:	84 d1                	test   %dl,%cl
+ 422:	74 44                	je     468 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 424:	f7 d8                	neg    %eax
+ 426:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 428:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 42f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 434:	89 c8                	mov    %ecx,%eax
+ 436:	ba 00 00 00 00       	mov    $0x0,%edx
+ 43b:	f7 f6                	div    %esi
+ 43d:	89 df                	mov    %ebx,%edi
+ 43f:	83 c3 01             	add    $0x1,%ebx
+ 442:	0f b6 92 3c 07 00 00 	movzbl 0x73c(%edx),%edx
+ 449:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 44d:	89 ca                	mov    %ecx,%edx
+ 44f:	89 c1                	mov    %eax,%ecx
+ 451:	39 f2                	cmp    %esi,%edx
+ 453:	73 df                	jae    434 <printint+0x2e>
+  if(neg)
+ 455:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 459:	74 31                	je     48c <printint+0x86>
+    buf[i++] = '-';
+ 45b:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 460:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 463:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 466:	eb 17                	jmp    47f <printint+0x79>
+    x = xx;
+ 468:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 46a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 471:	eb bc                	jmp    42f <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 473:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 478:	89 f0                	mov    %esi,%eax
+ 47a:	e8 6d ff ff ff       	call   3ec <putc>
+  while(--i >= 0)
+ 47f:	83 eb 01             	sub    $0x1,%ebx
+ 482:	79 ef                	jns    473 <printint+0x6d>
+}
+ 484:	83 c4 2c             	add    $0x2c,%esp
+ 487:	5b                   	pop    %ebx
+ 488:	5e                   	pop    %esi
+ 489:	5f                   	pop    %edi
+ 48a:	5d                   	pop    %ebp
+ 48b:	c3                   	ret
+ 48c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 48f:	eb ee                	jmp    47f <printint+0x79>
+
+00000491 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 491:	55                   	push   %ebp
+ 492:	89 e5                	mov    %esp,%ebp
+ 494:	57                   	push   %edi
+ 495:	56                   	push   %esi
+ 496:	53                   	push   %ebx
+ 497:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 49a:	8d 45 10             	lea    0x10(%ebp),%eax
+ 49d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 4a0:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 4a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4aa:	eb 14                	jmp    4c0 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4ac:	89 fa                	mov    %edi,%edx
+ 4ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b1:	e8 36 ff ff ff       	call   3ec <putc>
+ 4b6:	eb 05                	jmp    4bd <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 4b8:	83 fe 25             	cmp    $0x25,%esi
+ 4bb:	74 25                	je     4e2 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 4bd:	83 c3 01             	add    $0x1,%ebx
+ 4c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c3:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 4c7:	84 c0                	test   %al,%al
+ 4c9:	0f 84 20 01 00 00    	je     5ef <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 4cf:	0f be f8             	movsbl %al,%edi
+ 4d2:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4d5:	85 f6                	test   %esi,%esi
+ 4d7:	75 df                	jne    4b8 <printf+0x27>
+      if(c == '%'){
+ 4d9:	83 f8 25             	cmp    $0x25,%eax
+ 4dc:	75 ce                	jne    4ac <printf+0x1b>
+        state = '%';
+ 4de:	89 c6                	mov    %eax,%esi
+ 4e0:	eb db                	jmp    4bd <printf+0x2c>
+      if(c == 'd'){
+ 4e2:	83 f8 25             	cmp    $0x25,%eax
+ 4e5:	0f 84 cf 00 00 00    	je     5ba <printf+0x129>
+ 4eb:	0f 8c dd 00 00 00    	jl     5ce <printf+0x13d>
+ 4f1:	83 f8 78             	cmp    $0x78,%eax
+ 4f4:	0f 8f d4 00 00 00    	jg     5ce <printf+0x13d>
+ 4fa:	83 f8 63             	cmp    $0x63,%eax
+ 4fd:	0f 8c cb 00 00 00    	jl     5ce <printf+0x13d>
+ 503:	83 e8 63             	sub    $0x63,%eax
+ 506:	83 f8 15             	cmp    $0x15,%eax
+ 509:	0f 87 bf 00 00 00    	ja     5ce <printf+0x13d>
+ 50f:	ff 24 85 e4 06 00 00 	jmp    *0x6e4(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 516:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 519:	8b 17                	mov    (%edi),%edx
+ 51b:	83 ec 0c             	sub    $0xc,%esp
+ 51e:	6a 01                	push   $0x1
+ 520:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 525:	8b 45 08             	mov    0x8(%ebp),%eax
+ 528:	e8 d9 fe ff ff       	call   406 <printint>
+        ap++;
+ 52d:	83 c7 04             	add    $0x4,%edi
+ 530:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 533:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 536:	be 00 00 00 00       	mov    $0x0,%esi
+ 53b:	eb 80                	jmp    4bd <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 53d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 540:	8b 17                	mov    (%edi),%edx
+ 542:	83 ec 0c             	sub    $0xc,%esp
+ 545:	6a 00                	push   $0x0
+ 547:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 54c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54f:	e8 b2 fe ff ff       	call   406 <printint>
+        ap++;
+ 554:	83 c7 04             	add    $0x4,%edi
+ 557:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 55a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55d:	be 00 00 00 00       	mov    $0x0,%esi
+ 562:	e9 56 ff ff ff       	jmp    4bd <printf+0x2c>
+        s = (char*)*ap;
+ 567:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 56a:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 56c:	83 c0 04             	add    $0x4,%eax
+ 56f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 572:	85 f6                	test   %esi,%esi
+ 574:	75 15                	jne    58b <printf+0xfa>
+          s = "(null)";
+ 576:	be dc 06 00 00       	mov    $0x6dc,%esi
+ 57b:	eb 0e                	jmp    58b <printf+0xfa>
+          putc(fd, *s);
+ 57d:	0f be d2             	movsbl %dl,%edx
+ 580:	8b 45 08             	mov    0x8(%ebp),%eax
+ 583:	e8 64 fe ff ff       	call   3ec <putc>
+          s++;
+ 588:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 58b:	0f b6 16             	movzbl (%esi),%edx
+ 58e:	84 d2                	test   %dl,%dl
+ 590:	75 eb                	jne    57d <printf+0xec>
+      state = 0;
+ 592:	be 00 00 00 00       	mov    $0x0,%esi
+ 597:	e9 21 ff ff ff       	jmp    4bd <printf+0x2c>
+        putc(fd, *ap);
+ 59c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 59f:	0f be 17             	movsbl (%edi),%edx
+ 5a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a5:	e8 42 fe ff ff       	call   3ec <putc>
+        ap++;
+ 5aa:	83 c7 04             	add    $0x4,%edi
+ 5ad:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 5b0:	be 00 00 00 00       	mov    $0x0,%esi
+ 5b5:	e9 03 ff ff ff       	jmp    4bd <printf+0x2c>
+        putc(fd, c);
+ 5ba:	89 fa                	mov    %edi,%edx
+ 5bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bf:	e8 28 fe ff ff       	call   3ec <putc>
+      state = 0;
+ 5c4:	be 00 00 00 00       	mov    $0x0,%esi
+ 5c9:	e9 ef fe ff ff       	jmp    4bd <printf+0x2c>
+        putc(fd, '%');
+ 5ce:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	e8 11 fe ff ff       	call   3ec <putc>
+        putc(fd, c);
+ 5db:	89 fa                	mov    %edi,%edx
+ 5dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e0:	e8 07 fe ff ff       	call   3ec <putc>
+      state = 0;
+ 5e5:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ea:	e9 ce fe ff ff       	jmp    4bd <printf+0x2c>
+    }
+  }
+}
+ 5ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5f2:	5b                   	pop    %ebx
+ 5f3:	5e                   	pop    %esi
+ 5f4:	5f                   	pop    %edi
+ 5f5:	5d                   	pop    %ebp
+ 5f6:	c3                   	ret
@@ -0,0 +1,50 @@
+// Change scheduling classes:
+//
+//   chclass normal pid      move process pid back to SCHED_NORMAL
+//   chclass iso pid         make it SCHED_ISO
+//   chclass idleprio pid    make it SCHED_IDLEPRIO
+//   chclass isocpu percent  cap SCHED_ISO at percent of all CPUs
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sched.h"
+
+static char *classes[] = {
+[SCHED_NORMAL]  "normal",
+[SCHED_ISO]     "iso",
+[SCHED_IDLEPRIO] "idleprio",
+};
+
+int
+main(int argc, char *argv[])
+{
+  int i, old;
+
+  if(argc != 3){
+    printf(2, "usage: chclass normal|iso|idleprio pid\n");
+    printf(2, "       chclass isocpu percent\n");
+    exit();
+  }
+
+  if(strcmp(argv[1], "isocpu") == 0){
+    if((old = isocpu(atoi(argv[2]))) < 0)
+      printf(2, "chclass: bad percentage %s\n", argv[2]);
+    else
+      printf(1, "isocpu: %d%% -> %s%%\n", old, argv[2]);
+    exit();
+  }
+
+  for(i = 0; i < sizeof(classes)/sizeof(classes[0]); i++)
+    if(strcmp(argv[1], classes[i]) == 0)
+      break;
+  if(i == sizeof(classes)/sizeof(classes[0])){
+    printf(2, "chclass: unknown class %s\n", argv[1]);
+    exit();
+  }
+  if((old = setclass(atoi(argv[2]), i)) < 0)
+    printf(2, "chclass: no process %s\n", argv[2]);
+  else
+    printf(1, "%s: %s -> %s\n", argv[2], classes[old], classes[i]);
+  exit();
+}
@@ -14,11 +14,16 @@
 #include "mmu.h"
 #include "proc.h"
 #include "x86.h"
+#include "trace.h"
 
 static void consputc(int);
 
 static int panicked = 0;
 
+#ifndef NOTRACE
+uint trace_mask = TRACE_DEFAULT;  // enabled tracepoint categories
+#endif
+
 static struct {
   struct spinlock lock;
   int locking;
@@ -0,0 +1,26 @@
+// Print per-CPU scheduler statistics: timer ticks taken, time
+// spent halted in idle (in ticks, and as a share of uptime), the
+// share of uptime spent running SCHED_ISO processes, dispatches,
+// and how many of those migrated a process from another CPU.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sched.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct cpustat st;
+  int i, up;
+
+  printf(1, "cpu   ticks    idle  idle%%  iso%%  dispatches  migrations\n");
+  up = uptime();
+  for(i = 0; getcpustat(i, &st) == 0; i++){
+    printf(1, "%d  %d  %d  %d%%  %d%%  %d  %d\n", i, st.ticks, st.idle_ticks,
+           up ? st.idle_ticks * 100 / up : 0,
+           up ? st.iso_ticks * 100 / up : 0, st.dispatches,
+           st.migrations);
+  }
+  exit();
+}
@@ -6,11 +6,22 @@ struct inode;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct cpustat;
+struct schedevent;
+struct schedstat;
+struct skiplist;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
 
+// bfs.c
+void            bfs_refill(struct proc*, uint);
+void            bfs_renew_deadline(struct proc*);
+struct skiplist* bfs_select_rq(struct skiplist*, int, int, int);
+int             bfs_steals(uint64, uint64, int);
+uint64          compute_virtual_deadline(int);
+
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
@@ -79,6 +90,8 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapiconeshot(uint);
+void            lapicsendipi(uchar, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -121,8 +134,24 @@ void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
-void            schedlog(int);
 int             nicefork(int nice_value);
+int             getcpustat(int, struct cpustat*);
+int             schedtick(struct proc*);
+void            checkresched(void);
+int             setpolicy(int);
+int             affinity(int);
+int             setnice(int, int);
+int             getnice(int);
+int             setclass(int, int);
+int             isocpu(int);
+void            isotick(void);
+int             getschedstats(int, struct schedstat*);
+
+// schedlog.c
+void            schedloginit(void);
+void            schedlog(int);
+void            schedlog_event(int, struct proc*);
+int             schedlogread(struct schedevent*, int);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -168,6 +197,8 @@ void            timerinit(void);
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
+uint64          readticks64(void);
+extern uint     tsc_per_tick;
 void            tvinit(void);
 extern struct spinlock tickslock;
 
@@ -0,0 +1,538 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	b8 01 00 00 00       	mov    $0x1,%eax
+  1e:	eb 1a                	jmp    3a <main+0x3a>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  20:	ba 76 03 00 00       	mov    $0x376,%edx
+  25:	52                   	push   %edx
+  26:	ff 34 87             	push   (%edi,%eax,4)
+  29:	68 78 03 00 00       	push   $0x378
+  2e:	6a 01                	push   $0x1
+  30:	e8 d9 01 00 00       	call   20e <printf>
+  35:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  38:	89 d8                	mov    %ebx,%eax
+  3a:	39 f0                	cmp    %esi,%eax
+  3c:	7d 0e                	jge    4c <main+0x4c>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  3e:	8d 58 01             	lea    0x1(%eax),%ebx
+  41:	39 f3                	cmp    %esi,%ebx
+  43:	7d db                	jge    20 <main+0x20>
+  45:	ba 74 03 00 00       	mov    $0x374,%edx
+  4a:	eb d9                	jmp    25 <main+0x25>
+  exit();
+  4c:	e8 08 00 00 00       	call   59 <exit>
+
+00000051 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  51:	b8 01 00 00 00       	mov    $0x1,%eax
+  56:	cd 40                	int    $0x40
+  58:	c3                   	ret
+
+00000059 <exit>:
+SYSCALL(exit)
+  59:	b8 02 00 00 00       	mov    $0x2,%eax
+  5e:	cd 40                	int    $0x40
+  60:	c3                   	ret
+
+00000061 <wait>:
+SYSCALL(wait)
+  61:	b8 03 00 00 00       	mov    $0x3,%eax
+  66:	cd 40                	int    $0x40
+  68:	c3                   	ret
+
+00000069 <pipe>:
+SYSCALL(pipe)
+  69:	b8 04 00 00 00       	mov    $0x4,%eax
+  6e:	cd 40                	int    $0x40
+  70:	c3                   	ret
+
+00000071 <read>:
+SYSCALL(read)
+  71:	b8 05 00 00 00       	mov    $0x5,%eax
+  76:	cd 40                	int    $0x40
+  78:	c3                   	ret
+
+00000079 <write>:
+SYSCALL(write)
+  79:	b8 10 00 00 00       	mov    $0x10,%eax
+  7e:	cd 40                	int    $0x40
+  80:	c3                   	ret
+
+00000081 <close>:
+SYSCALL(close)
+  81:	b8 15 00 00 00       	mov    $0x15,%eax
+  86:	cd 40                	int    $0x40
+  88:	c3                   	ret
+
+00000089 <kill>:
+SYSCALL(kill)
+  89:	b8 06 00 00 00       	mov    $0x6,%eax
+  8e:	cd 40                	int    $0x40
+  90:	c3                   	ret
+
+00000091 <exec>:
+SYSCALL(exec)
+  91:	b8 07 00 00 00       	mov    $0x7,%eax
+  96:	cd 40                	int    $0x40
+  98:	c3                   	ret
+
+00000099 <open>:
+SYSCALL(open)
+  99:	b8 0f 00 00 00       	mov    $0xf,%eax
+  9e:	cd 40                	int    $0x40
+  a0:	c3                   	ret
+
+000000a1 <mknod>:
+SYSCALL(mknod)
+  a1:	b8 11 00 00 00       	mov    $0x11,%eax
+  a6:	cd 40                	int    $0x40
+  a8:	c3                   	ret
+
+000000a9 <unlink>:
+SYSCALL(unlink)
+  a9:	b8 12 00 00 00       	mov    $0x12,%eax
+  ae:	cd 40                	int    $0x40
+  b0:	c3                   	ret
+
+000000b1 <fstat>:
+SYSCALL(fstat)
+  b1:	b8 08 00 00 00       	mov    $0x8,%eax
+  b6:	cd 40                	int    $0x40
+  b8:	c3                   	ret
+
+000000b9 <link>:
+SYSCALL(link)
+  b9:	b8 13 00 00 00       	mov    $0x13,%eax
+  be:	cd 40                	int    $0x40
+  c0:	c3                   	ret
+
+000000c1 <mkdir>:
+SYSCALL(mkdir)
+  c1:	b8 14 00 00 00       	mov    $0x14,%eax
+  c6:	cd 40                	int    $0x40
+  c8:	c3                   	ret
+
+000000c9 <chdir>:
+SYSCALL(chdir)
+  c9:	b8 09 00 00 00       	mov    $0x9,%eax
+  ce:	cd 40                	int    $0x40
+  d0:	c3                   	ret
+
+000000d1 <dup>:
+SYSCALL(dup)
+  d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  d6:	cd 40                	int    $0x40
+  d8:	c3                   	ret
+
+000000d9 <getpid>:
+SYSCALL(getpid)
+  d9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  de:	cd 40                	int    $0x40
+  e0:	c3                   	ret
+
+000000e1 <sbrk>:
+SYSCALL(sbrk)
+  e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  e6:	cd 40                	int    $0x40
+  e8:	c3                   	ret
+
+000000e9 <sleep>:
+SYSCALL(sleep)
+  e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  ee:	cd 40                	int    $0x40
+  f0:	c3                   	ret
+
+000000f1 <uptime>:
+SYSCALL(uptime)
+  f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  f6:	cd 40                	int    $0x40
+  f8:	c3                   	ret
+
+000000f9 <yield>:
+SYSCALL(yield)
+  f9:	b8 16 00 00 00       	mov    $0x16,%eax
+  fe:	cd 40                	int    $0x40
+ 100:	c3                   	ret
+
+00000101 <shutdown>:
+SYSCALL(shutdown)
+ 101:	b8 17 00 00 00       	mov    $0x17,%eax
+ 106:	cd 40                	int    $0x40
+ 108:	c3                   	ret
+
+00000109 <nicefork>:
+SYSCALL(nicefork)
+ 109:	b8 18 00 00 00       	mov    $0x18,%eax
+ 10e:	cd 40                	int    $0x40
+ 110:	c3                   	ret
+
+00000111 <schedlog>:
+SYSCALL(schedlog)
+ 111:	b8 19 00 00 00       	mov    $0x19,%eax
+ 116:	cd 40                	int    $0x40
+ 118:	c3                   	ret
+
+00000119 <schedlogread>:
+SYSCALL(schedlogread)
+ 119:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 11e:	cd 40                	int    $0x40
+ 120:	c3                   	ret
+
+00000121 <tracectl>:
+SYSCALL(tracectl)
+ 121:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 126:	cd 40                	int    $0x40
+ 128:	c3                   	ret
+
+00000129 <getcpustat>:
+SYSCALL(getcpustat)
+ 129:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 12e:	cd 40                	int    $0x40
+ 130:	c3                   	ret
+
+00000131 <setpolicy>:
+SYSCALL(setpolicy)
+ 131:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 136:	cd 40                	int    $0x40
+ 138:	c3                   	ret
+
+00000139 <affinity>:
+SYSCALL(affinity)
+ 139:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 13e:	cd 40                	int    $0x40
+ 140:	c3                   	ret
+
+00000141 <setnice>:
+SYSCALL(setnice)
+ 141:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 146:	cd 40                	int    $0x40
+ 148:	c3                   	ret
+
+00000149 <getnice>:
+SYSCALL(getnice)
+ 149:	b8 20 00 00 00       	mov    $0x20,%eax
+ 14e:	cd 40                	int    $0x40
+ 150:	c3                   	ret
+
+00000151 <setclass>:
+SYSCALL(setclass)
+ 151:	b8 21 00 00 00       	mov    $0x21,%eax
+ 156:	cd 40                	int    $0x40
+ 158:	c3                   	ret
+
+00000159 <isocpu>:
+SYSCALL(isocpu)
+ 159:	b8 22 00 00 00       	mov    $0x22,%eax
+ 15e:	cd 40                	int    $0x40
+ 160:	c3                   	ret
+
+00000161 <getschedstats>:
+SYSCALL(getschedstats)
+ 161:	b8 23 00 00 00       	mov    $0x23,%eax
+ 166:	cd 40                	int    $0x40
+ 168:	c3                   	ret
+
+00000169 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 169:	55                   	push   %ebp
+ 16a:	89 e5                	mov    %esp,%ebp
+ 16c:	83 ec 1c             	sub    $0x1c,%esp
+ 16f:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 172:	6a 01                	push   $0x1
+ 174:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 177:	52                   	push   %edx
+ 178:	50                   	push   %eax
+ 179:	e8 fb fe ff ff       	call   79 <write>
+}
+ 17e:	83 c4 10             	add    $0x10,%esp
+ 181:	c9                   	leave
+ 182:	c3                   	ret
+
+00000183 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 183:	55                   	push   %ebp
+ 184:	89 e5                	mov    %esp,%ebp
+ 186:	57                   	push   %edi
+ 187:	56                   	push   %esi
+ 188:	53                   	push   %ebx
+ 189:	83 ec 2c             	sub    $0x2c,%esp
+ 18c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 18f:	89 d0                	mov    %edx,%eax
+ 191:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 193:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 197:	0f 95 c1             	setne  %cl
+ 19a:	c1 ea 1f             	shr    $0x1f,%edx
+ 19d:	84 d1                	test   %dl,%cl
+ 19f:	74 44                	je     1e5 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 1a1:	f7 d8                	neg    %eax
+ 1a3:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 1a5:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 1ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 1b1:	89 c8                	mov    %ecx,%eax
+ 1b3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1b8:	f7 f6                	div    %esi
+ 1ba:	89 df                	mov    %ebx,%edi
+ 1bc:	83 c3 01             	add    $0x1,%ebx
+ 1bf:	0f b6 92 dc 03 00 00 	movzbl 0x3dc(%edx),%edx
+ 1c6:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 1ca:	89 ca                	mov    %ecx,%edx
+ 1cc:	89 c1                	mov    %eax,%ecx
+ 1ce:	39 f2                	cmp    %esi,%edx
+ 1d0:	73 df                	jae    1b1 <printint+0x2e>
+  if(neg)
+ 1d2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 1d6:	74 31                	je     209 <printint+0x86>
+    buf[i++] = '-';
+ 1d8:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 1dd:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 1e0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1e3:	eb 17                	jmp    1fc <printint+0x79>
+    x = xx;
+ 1e5:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 1e7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 1ee:	eb bc                	jmp    1ac <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 1f0:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 1f5:	89 f0                	mov    %esi,%eax
+ 1f7:	e8 6d ff ff ff       	call   169 <putc>
+  while(--i >= 0)
+ 1fc:	83 eb 01             	sub    $0x1,%ebx
+ 1ff:	79 ef                	jns    1f0 <printint+0x6d>
+}
+ 201:	83 c4 2c             	add    $0x2c,%esp
+ 204:	5b                   	pop    %ebx
+ 205:	5e                   	pop    %esi
+ 206:	5f                   	pop    %edi
+ 207:	5d                   	pop    %ebp
+ 208:	c3                   	ret
+ 209:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 20c:	eb ee                	jmp    1fc <printint+0x79>
+
+0000020e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+ 211:	57                   	push   %edi
+ 212:	56                   	push   %esi
+ 213:	53                   	push   %ebx
+ 214:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 217:	8d 45 10             	lea    0x10(%ebp),%eax
+ 21a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 21d:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 222:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 227:	eb 14                	jmp    23d <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 229:	89 fa                	mov    %edi,%edx
+ 22b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22e:	e8 36 ff ff ff       	call   169 <putc>
+ 233:	eb 05                	jmp    23a <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 235:	83 fe 25             	cmp    $0x25,%esi
+ 238:	74 25                	je     25f <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 23a:	83 c3 01             	add    $0x1,%ebx
+ 23d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 240:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 244:	84 c0                	test   %al,%al
+ 246:	0f 84 20 01 00 00    	je     36c <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 24c:	0f be f8             	movsbl %al,%edi
+ 24f:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 252:	85 f6                	test   %esi,%esi
+ 254:	75 df                	jne    235 <printf+0x27>
+      if(c == '%'){
+ 256:	83 f8 25             	cmp    $0x25,%eax
+ 259:	75 ce                	jne    229 <printf+0x1b>
+        state = '%';
+ 25b:	89 c6                	mov    %eax,%esi
+ 25d:	eb db                	jmp    23a <printf+0x2c>
+      if(c == 'd'){
+ 25f:	83 f8 25             	cmp    $0x25,%eax
+ 262:	0f 84 cf 00 00 00    	je     337 <printf+0x129>
+ 268:	0f 8c dd 00 00 00    	jl     34b <printf+0x13d>
+ 26e:	83 f8 78             	cmp    $0x78,%eax
+ 271:	0f 8f d4 00 00 00    	jg     34b <printf+0x13d>
+ 277:	83 f8 63             	cmp    $0x63,%eax
+ 27a:	0f 8c cb 00 00 00    	jl     34b <printf+0x13d>
+ 280:	83 e8 63             	sub    $0x63,%eax
+ 283:	83 f8 15             	cmp    $0x15,%eax
+ 286:	0f 87 bf 00 00 00    	ja     34b <printf+0x13d>
+ 28c:	ff 24 85 84 03 00 00 	jmp    *0x384(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 293:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 296:	8b 17                	mov    (%edi),%edx
+ 298:	83 ec 0c             	sub    $0xc,%esp
+ 29b:	6a 01                	push   $0x1
+ 29d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 2a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a5:	e8 d9 fe ff ff       	call   183 <printint>
+        ap++;
+ 2aa:	83 c7 04             	add    $0x4,%edi
+ 2ad:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2b0:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 2b3:	be 00 00 00 00       	mov    $0x0,%esi
+ 2b8:	eb 80                	jmp    23a <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 2ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2bd:	8b 17                	mov    (%edi),%edx
+ 2bf:	83 ec 0c             	sub    $0xc,%esp
+ 2c2:	6a 00                	push   $0x0
+ 2c4:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cc:	e8 b2 fe ff ff       	call   183 <printint>
+        ap++;
+ 2d1:	83 c7 04             	add    $0x4,%edi
+ 2d4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2d7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2da:	be 00 00 00 00       	mov    $0x0,%esi
+ 2df:	e9 56 ff ff ff       	jmp    23a <printf+0x2c>
+        s = (char*)*ap;
+ 2e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2e7:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 2e9:	83 c0 04             	add    $0x4,%eax
+ 2ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 2ef:	85 f6                	test   %esi,%esi
+ 2f1:	75 15                	jne    308 <printf+0xfa>
+          s = "(null)";
+ 2f3:	be 7d 03 00 00       	mov    $0x37d,%esi
+ 2f8:	eb 0e                	jmp    308 <printf+0xfa>
+          putc(fd, *s);
+ 2fa:	0f be d2             	movsbl %dl,%edx
+ 2fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 300:	e8 64 fe ff ff       	call   169 <putc>
+          s++;
+ 305:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 308:	0f b6 16             	movzbl (%esi),%edx
+ 30b:	84 d2                	test   %dl,%dl
+ 30d:	75 eb                	jne    2fa <printf+0xec>
+      state = 0;
+ 30f:	be 00 00 00 00       	mov    $0x0,%esi
+ 314:	e9 21 ff ff ff       	jmp    23a <printf+0x2c>
+        putc(fd, *ap);
+ 319:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 31c:	0f be 17             	movsbl (%edi),%edx
+ 31f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 322:	e8 42 fe ff ff       	call   169 <putc>
+        ap++;
+ 327:	83 c7 04             	add    $0x4,%edi
+ 32a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 32d:	be 00 00 00 00       	mov    $0x0,%esi
+ 332:	e9 03 ff ff ff       	jmp    23a <printf+0x2c>
+        putc(fd, c);
+ 337:	89 fa                	mov    %edi,%edx
+ 339:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33c:	e8 28 fe ff ff       	call   169 <putc>
+      state = 0;
+ 341:	be 00 00 00 00       	mov    $0x0,%esi
+ 346:	e9 ef fe ff ff       	jmp    23a <printf+0x2c>
+        putc(fd, '%');
+ 34b:	ba 25 00 00 00       	mov    $0x25,%edx
+ 350:	8b 45 08             	mov    0x8(%ebp),%eax
+ 353:	e8 11 fe ff ff       	call   169 <putc>
+        putc(fd, c);
+ 358:	89 fa                	mov    %edi,%edx
+ 35a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35d:	e8 07 fe ff ff       	call   169 <putc>
+      state = 0;
+ 362:	be 00 00 00 00       	mov    $0x0,%esi
+ 367:	e9 ce fe ff ff       	jmp    23a <printf+0x2c>
+    }
+  }
+}
+ 36c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 36f:	5b                   	pop    %ebx
+ 370:	5e                   	pop    %esi
+ 371:	5f                   	pop    %edi
+ 372:	5d                   	pop    %ebp
+ 373:	c3                   	ret
@@ -0,0 +1,598 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 00 04 00 00       	push   $0x400
+  19:	e8 07 01 00 00       	call   125 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	78 1b                	js     40 <main+0x40>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  25:	83 ec 0c             	sub    $0xc,%esp
+  28:	6a 00                	push   $0x0
+  2a:	e8 2e 01 00 00       	call   15d <dup>
+  dup(0);  // stderr
+  2f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  36:	e8 22 01 00 00       	call   15d <dup>
+  3b:	83 c4 10             	add    $0x10,%esp
+  3e:	eb 58                	jmp    98 <main+0x98>
+    mknod("console", 1, 1);
+  40:	83 ec 04             	sub    $0x4,%esp
+  43:	6a 01                	push   $0x1
+  45:	6a 01                	push   $0x1
+  47:	68 00 04 00 00       	push   $0x400
+  4c:	e8 dc 00 00 00       	call   12d <mknod>
+    open("console", O_RDWR);
+  51:	83 c4 08             	add    $0x8,%esp
+  54:	6a 02                	push   $0x2
+  56:	68 00 04 00 00       	push   $0x400
+  5b:	e8 c5 00 00 00       	call   125 <open>
+  60:	83 c4 10             	add    $0x10,%esp
+  63:	eb c0                	jmp    25 <main+0x25>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+    pid = fork();
+    if(pid < 0){
+      printf(1, "init: fork failed\n");
+  65:	83 ec 08             	sub    $0x8,%esp
+  68:	68 1b 04 00 00       	push   $0x41b
+  6d:	6a 01                	push   $0x1
+  6f:	e8 26 02 00 00       	call   29a <printf>
+      exit();
+  74:	e8 6c 00 00 00       	call   e5 <exit>
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  79:	83 ec 08             	sub    $0x8,%esp
+  7c:	68 47 04 00 00       	push   $0x447
+  81:	6a 01                	push   $0x1
+  83:	e8 12 02 00 00       	call   29a <printf>
+  88:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  8b:	e8 5d 00 00 00       	call   ed <wait>
+  90:	85 c0                	test   %eax,%eax
+  92:	78 04                	js     98 <main+0x98>
+  94:	39 c3                	cmp    %eax,%ebx
+  96:	75 e1                	jne    79 <main+0x79>
+    printf(1, "init: starting sh\n");
+  98:	83 ec 08             	sub    $0x8,%esp
+  9b:	68 08 04 00 00       	push   $0x408
+  a0:	6a 01                	push   $0x1
+  a2:	e8 f3 01 00 00       	call   29a <printf>
+    pid = fork();
+  a7:	e8 31 00 00 00       	call   dd <fork>
+  ac:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	85 c0                	test   %eax,%eax
+  b3:	78 b0                	js     65 <main+0x65>
+    if(pid == 0){
+  b5:	75 d4                	jne    8b <main+0x8b>
+      exec("sh", argv);
+  b7:	83 ec 08             	sub    $0x8,%esp
+  ba:	68 c4 04 00 00       	push   $0x4c4
+  bf:	68 2e 04 00 00       	push   $0x42e
+  c4:	e8 54 00 00 00       	call   11d <exec>
+      printf(1, "init: exec sh failed\n");
+  c9:	83 c4 08             	add    $0x8,%esp
+  cc:	68 31 04 00 00       	push   $0x431
+  d1:	6a 01                	push   $0x1
+  d3:	e8 c2 01 00 00       	call   29a <printf>
+      exit();
+  d8:	e8 08 00 00 00       	call   e5 <exit>
+
+000000dd <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  e2:	cd 40                	int    $0x40
+  e4:	c3                   	ret
+
+000000e5 <exit>:
+SYSCALL(exit)
+  e5:	b8 02 00 00 00       	mov    $0x2,%eax
+  ea:	cd 40                	int    $0x40
+  ec:	c3                   	ret
+
+000000ed <wait>:
+SYSCALL(wait)
+  ed:	b8 03 00 00 00       	mov    $0x3,%eax
+  f2:	cd 40                	int    $0x40
+  f4:	c3                   	ret
+
+000000f5 <pipe>:
+SYSCALL(pipe)
+  f5:	b8 04 00 00 00       	mov    $0x4,%eax
+  fa:	cd 40                	int    $0x40
+  fc:	c3                   	ret
+
+000000fd <read>:
+SYSCALL(read)
+  fd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 102:	cd 40                	int    $0x40
+ 104:	c3                   	ret
+
+00000105 <write>:
+SYSCALL(write)
+ 105:	b8 10 00 00 00       	mov    $0x10,%eax
+ 10a:	cd 40                	int    $0x40
+ 10c:	c3                   	ret
+
+0000010d <close>:
+SYSCALL(close)
+ 10d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 112:	cd 40                	int    $0x40
+ 114:	c3                   	ret
+
+00000115 <kill>:
+SYSCALL(kill)
+ 115:	b8 06 00 00 00       	mov    $0x6,%eax
+ 11a:	cd 40                	int    $0x40
+ 11c:	c3                   	ret
+
+0000011d <exec>:
+SYSCALL(exec)
+ 11d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 122:	cd 40                	int    $0x40
+ 124:	c3                   	ret
+
+00000125 <open>:
+SYSCALL(open)
+ 125:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 12a:	cd 40                	int    $0x40
+ 12c:	c3                   	ret
+
+0000012d <mknod>:
+SYSCALL(mknod)
+ 12d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 132:	cd 40                	int    $0x40
+ 134:	c3                   	ret
+
+00000135 <unlink>:
+SYSCALL(unlink)
+ 135:	b8 12 00 00 00       	mov    $0x12,%eax
+ 13a:	cd 40                	int    $0x40
+ 13c:	c3                   	ret
+
+0000013d <fstat>:
+SYSCALL(fstat)
+ 13d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 142:	cd 40                	int    $0x40
+ 144:	c3                   	ret
+
+00000145 <link>:
+SYSCALL(link)
+ 145:	b8 13 00 00 00       	mov    $0x13,%eax
+ 14a:	cd 40                	int    $0x40
+ 14c:	c3                   	ret
+
+0000014d <mkdir>:
+SYSCALL(mkdir)
+ 14d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 152:	cd 40                	int    $0x40
+ 154:	c3                   	ret
+
+00000155 <chdir>:
+SYSCALL(chdir)
+ 155:	b8 09 00 00 00       	mov    $0x9,%eax
+ 15a:	cd 40                	int    $0x40
+ 15c:	c3                   	ret
+
+0000015d <dup>:
+SYSCALL(dup)
+ 15d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 162:	cd 40                	int    $0x40
+ 164:	c3                   	ret
+
+00000165 <getpid>:
+SYSCALL(getpid)
+ 165:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 16a:	cd 40                	int    $0x40
+ 16c:	c3                   	ret
+
+0000016d <sbrk>:
+SYSCALL(sbrk)
+ 16d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 172:	cd 40                	int    $0x40
+ 174:	c3                   	ret
+
+00000175 <sleep>:
+SYSCALL(sleep)
+ 175:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 17a:	cd 40                	int    $0x40
+ 17c:	c3                   	ret
+
+0000017d <uptime>:
+SYSCALL(uptime)
+ 17d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 182:	cd 40                	int    $0x40
+ 184:	c3                   	ret
+
+00000185 <yield>:
+SYSCALL(yield)
+ 185:	b8 16 00 00 00       	mov    $0x16,%eax
+ 18a:	cd 40                	int    $0x40
+ 18c:	c3                   	ret
+
+0000018d <shutdown>:
+SYSCALL(shutdown)
+ 18d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 192:	cd 40                	int    $0x40
+ 194:	c3                   	ret
+
+00000195 <nicefork>:
+SYSCALL(nicefork)
+ 195:	b8 18 00 00 00       	mov    $0x18,%eax
+ 19a:	cd 40                	int    $0x40
+ 19c:	c3                   	ret
+
+0000019d <schedlog>:
+SYSCALL(schedlog)
+ 19d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1a2:	cd 40                	int    $0x40
+ 1a4:	c3                   	ret
+
+000001a5 <schedlogread>:
+SYSCALL(schedlogread)
+ 1a5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1aa:	cd 40                	int    $0x40
+ 1ac:	c3                   	ret
+
+000001ad <tracectl>:
+SYSCALL(tracectl)
+ 1ad:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1b2:	cd 40                	int    $0x40
+ 1b4:	c3                   	ret
+
+000001b5 <getcpustat>:
+SYSCALL(getcpustat)
+ 1b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1ba:	cd 40                	int    $0x40
+ 1bc:	c3                   	ret
+
+000001bd <setpolicy>:
+SYSCALL(setpolicy)
+ 1bd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 1c2:	cd 40                	int    $0x40
+ 1c4:	c3                   	ret
+
+000001c5 <affinity>:
+SYSCALL(affinity)
+ 1c5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 1ca:	cd 40                	int    $0x40
+ 1cc:	c3                   	ret
+
+000001cd <setnice>:
+SYSCALL(setnice)
+ 1cd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 1d2:	cd 40                	int    $0x40
+ 1d4:	c3                   	ret
+
+000001d5 <getnice>:
+SYSCALL(getnice)
+ 1d5:	b8 20 00 00 00       	mov    $0x20,%eax
+ 1da:	cd 40                	int    $0x40
+ 1dc:	c3                   	ret
+
+000001dd <setclass>:
+SYSCALL(setclass)
+ 1dd:	b8 21 00 00 00       	mov    $0x21,%eax
+ 1e2:	cd 40                	int    $0x40
+ 1e4:	c3                   	ret
+
+000001e5 <isocpu>:
+SYSCALL(isocpu)
+ 1e5:	b8 22 00 00 00       	mov    $0x22,%eax
+ 1ea:	cd 40                	int    $0x40
+ 1ec:	c3                   	ret
+
+000001ed <getschedstats>:
+SYSCALL(getschedstats)
+ 1ed:	b8 23 00 00 00       	mov    $0x23,%eax
+ 1f2:	cd 40                	int    $0x40
+ 1f4:	c3                   	ret
+
+000001f5 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 1f5:	55                   	push   %ebp
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 1fe:	6a 01                	push   $0x1
+ 200:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 203:	52                   	push   %edx
+ 204:	50                   	push   %eax
+ 205:	e8 fb fe ff ff       	call   105 <write>
+}
+ 20a:	83 c4 10             	add    $0x10,%esp
+ 20d:	c9                   	leave
+ 20e:	c3                   	ret
+
+0000020f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 20f:	55                   	push   %ebp
+ 210:	89 e5                	mov    %esp,%ebp
+ 212:	57                   	push   %edi
+ 213:	56                   	push   %esi
+ 214:	53                   	push   %ebx
+ 215:	83 ec 2c             	sub    $0x2c,%esp
+ 218:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 21b:	89 d0                	mov    %edx,%eax
+ 21d:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 21f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 223:	0f 95 c1             	setne  %cl
+ 226:	c1 ea 1f             	shr    $0x1f,%edx
+ 229:	84 d1                	test   %dl,%cl
+ 22b:	74 44                	je     271 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 22d:	f7 d8                	neg    %eax
+ 22f:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 231:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 23d:	89 c8                	mov    %ecx,%eax
+ 23f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 244:	f7 f6                	div    %esi
+ 246:	89 df                	mov    %ebx,%edi
+ 248:	83 c3 01             	add    $0x1,%ebx
+ 24b:	0f b6 92 b0 04 00 00 	movzbl 0x4b0(%edx),%edx
+ 252:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 256:	89 ca                	mov    %ecx,%edx
+ 258:	89 c1                	mov    %eax,%ecx
+ 25a:	39 f2                	cmp    %esi,%edx
+ 25c:	73 df                	jae    23d <printint+0x2e>
+  if(neg)
+ 25e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 262:	74 31                	je     295 <printint+0x86>
+    buf[i++] = '-';
+ 264:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 269:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 26c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 26f:	eb 17                	jmp    288 <printint+0x79>
+    x = xx;
+ 271:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 273:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 27a:	eb bc                	jmp    238 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 27c:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 281:	89 f0                	mov    %esi,%eax
+ 283:	e8 6d ff ff ff       	call   1f5 <putc>
+  while(--i >= 0)
+ 288:	83 eb 01             	sub    $0x1,%ebx
+ 28b:	79 ef                	jns    27c <printint+0x6d>
+}
+ 28d:	83 c4 2c             	add    $0x2c,%esp
+ 290:	5b                   	pop    %ebx
+ 291:	5e                   	pop    %esi
+ 292:	5f                   	pop    %edi
+ 293:	5d                   	pop    %ebp
+ 294:	c3                   	ret
+ 295:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 298:	eb ee                	jmp    288 <printint+0x79>
+
+0000029a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 29a:	55                   	push   %ebp
+ 29b:	89 e5                	mov    %esp,%ebp
+ 29d:	57                   	push   %edi
+ 29e:	56                   	push   %esi
+ 29f:	53                   	push   %ebx
+ 2a0:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 2a3:	8d 45 10             	lea    0x10(%ebp),%eax
+ 2a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 2a9:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 2ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2b3:	eb 14                	jmp    2c9 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 2b5:	89 fa                	mov    %edi,%edx
+ 2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ba:	e8 36 ff ff ff       	call   1f5 <putc>
+ 2bf:	eb 05                	jmp    2c6 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 2c1:	83 fe 25             	cmp    $0x25,%esi
+ 2c4:	74 25                	je     2eb <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 2c6:	83 c3 01             	add    $0x1,%ebx
+ 2c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2cc:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 2d0:	84 c0                	test   %al,%al
+ 2d2:	0f 84 20 01 00 00    	je     3f8 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 2d8:	0f be f8             	movsbl %al,%edi
+ 2db:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 2de:	85 f6                	test   %esi,%esi
+ 2e0:	75 df                	jne    2c1 <printf+0x27>
+      if(c == '%'){
+ 2e2:	83 f8 25             	cmp    $0x25,%eax
+ 2e5:	75 ce                	jne    2b5 <printf+0x1b>
+        state = '%';
+ 2e7:	89 c6                	mov    %eax,%esi
+ 2e9:	eb db                	jmp    2c6 <printf+0x2c>
+      if(c == 'd'){
+ 2eb:	83 f8 25             	cmp    $0x25,%eax
+ 2ee:	0f 84 cf 00 00 00    	je     3c3 <printf+0x129>
+ 2f4:	0f 8c dd 00 00 00    	jl     3d7 <printf+0x13d>
+ 2fa:	83 f8 78             	cmp    $0x78,%eax
+ 2fd:	0f 8f d4 00 00 00    	jg     3d7 <printf+0x13d>
+ 303:	83 f8 63             	cmp    $0x63,%eax
+ 306:	0f 8c cb 00 00 00    	jl     3d7 <printf+0x13d>
+ 30c:	83 e8 63             	sub    $0x63,%eax
+ 30f:	83 f8 15             	cmp    $0x15,%eax
+ 312:	0f 87 bf 00 00 00    	ja     3d7 <printf+0x13d>
+ 318:	ff 24 85 58 04 00 00 	jmp    *0x458(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 31f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 322:	8b 17                	mov    (%edi),%edx
+ 324:	83 ec 0c             	sub    $0xc,%esp
+ 327:	6a 01                	push   $0x1
+ 329:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 32e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 331:	e8 d9 fe ff ff       	call   20f <printint>
+        ap++;
+ 336:	83 c7 04             	add    $0x4,%edi
+ 339:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 33c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 33f:	be 00 00 00 00       	mov    $0x0,%esi
+ 344:	eb 80                	jmp    2c6 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 346:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 349:	8b 17                	mov    (%edi),%edx
+ 34b:	83 ec 0c             	sub    $0xc,%esp
+ 34e:	6a 00                	push   $0x0
+ 350:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+ 358:	e8 b2 fe ff ff       	call   20f <printint>
+        ap++;
+ 35d:	83 c7 04             	add    $0x4,%edi
+ 360:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 363:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 366:	be 00 00 00 00       	mov    $0x0,%esi
+ 36b:	e9 56 ff ff ff       	jmp    2c6 <printf+0x2c>
+        s = (char*)*ap;
+ 370:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 373:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 375:	83 c0 04             	add    $0x4,%eax
+ 378:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 37b:	85 f6                	test   %esi,%esi
+ 37d:	75 15                	jne    394 <printf+0xfa>
+          s = "(null)";
+ 37f:	be 50 04 00 00       	mov    $0x450,%esi
+ 384:	eb 0e                	jmp    394 <printf+0xfa>
+          putc(fd, *s);
+ 386:	0f be d2             	movsbl %dl,%edx
+ 389:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38c:	e8 64 fe ff ff       	call   1f5 <putc>
+          s++;
+ 391:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 394:	0f b6 16             	movzbl (%esi),%edx
+ 397:	84 d2                	test   %dl,%dl
+ 399:	75 eb                	jne    386 <printf+0xec>
+      state = 0;
+ 39b:	be 00 00 00 00       	mov    $0x0,%esi
+ 3a0:	e9 21 ff ff ff       	jmp    2c6 <printf+0x2c>
+        putc(fd, *ap);
+ 3a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 3a8:	0f be 17             	movsbl (%edi),%edx
+ 3ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ae:	e8 42 fe ff ff       	call   1f5 <putc>
+        ap++;
+ 3b3:	83 c7 04             	add    $0x4,%edi
+ 3b6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 3b9:	be 00 00 00 00       	mov    $0x0,%esi
+ 3be:	e9 03 ff ff ff       	jmp    2c6 <printf+0x2c>
+        putc(fd, c);
+ 3c3:	89 fa                	mov    %edi,%edx
+ 3c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c8:	e8 28 fe ff ff       	call   1f5 <putc>
+      state = 0;
+ 3cd:	be 00 00 00 00       	mov    $0x0,%esi
+ 3d2:	e9 ef fe ff ff       	jmp    2c6 <printf+0x2c>
+        putc(fd, '%');
+ 3d7:	ba 25 00 00 00       	mov    $0x25,%edx
+ 3dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3df:	e8 11 fe ff ff       	call   1f5 <putc>
+        putc(fd, c);
+ 3e4:	89 fa                	mov    %edi,%edx
+ 3e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e9:	e8 07 fe ff ff       	call   1f5 <putc>
+      state = 0;
+ 3ee:	be 00 00 00 00       	mov    $0x0,%esi
+ 3f3:	e9 ce fe ff ff       	jmp    2c6 <printf+0x2c>
+    }
+  }
+}
+ 3f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3fb:	5b                   	pop    %ebx
+ 3fc:	5e                   	pop    %esi
+ 3fd:	5f                   	pop    %edi
+ 3fe:	5d                   	pop    %ebp
+ 3ff:	c3                   	ret
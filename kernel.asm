@@ -0,0 +1,17809 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 b0 10 00       	mov    $0x10b000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc 00 31 15 80       	mov    $0x80153100,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 ce 2a 10 80       	mov    $0x80102ace,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+
+80100034 <compute_virtual_deadline>:
+// Virtual deadline of a process with the given nice value that
+// starts a new quantum now: nicer processes get later deadlines.
+// Deadlines are 64-bit ticks, so they never wrap around.
+uint64
+compute_virtual_deadline(int nice_value)
+{
+80100034:	55                   	push   %ebp
+80100035:	89 e5                	mov    %esp,%ebp
+80100037:	53                   	push   %ebx
+80100038:	83 ec 04             	sub    $0x4,%esp
+  int priority_ratio = nice_value - BFS_NICE_FIRST_LEVEL + 1;
+8010003b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010003e:	8d 58 15             	lea    0x15(%eax),%ebx
+  return readticks64() + (BFS_DEFAULT_QUANTUM * priority_ratio);
+80100041:	e8 b2 6a 00 00       	call   80106af8 <readticks64>
+80100046:	6b cb 32             	imul   $0x32,%ebx,%ecx
+80100049:	89 cb                	mov    %ecx,%ebx
+8010004b:	c1 fb 1f             	sar    $0x1f,%ebx
+8010004e:	01 c8                	add    %ecx,%eax
+80100050:	11 da                	adc    %ebx,%edx
+}
+80100052:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100055:	c9                   	leave
+80100056:	c3                   	ret
+
+80100057 <bget>:
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+80100057:	55                   	push   %ebp
+80100058:	89 e5                	mov    %esp,%ebp
+8010005a:	57                   	push   %edi
+8010005b:	56                   	push   %esi
+8010005c:	53                   	push   %ebx
+8010005d:	83 ec 18             	sub    $0x18,%esp
+80100060:	89 c6                	mov    %eax,%esi
+80100062:	89 d7                	mov    %edx,%edi
+  struct buf *b;
+
+  acquire(&bcache.lock);
+80100064:	68 80 c5 10 80       	push   $0x8010c580
+80100069:	e8 47 56 00 00       	call   801056b5 <acquire>
+
+  // Is the block already cached?
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+8010006e:	8b 1d d0 0c 11 80    	mov    0x80110cd0,%ebx
+80100074:	83 c4 10             	add    $0x10,%esp
+80100077:	eb 03                	jmp    8010007c <bget+0x25>
+80100079:	8b 5b 54             	mov    0x54(%ebx),%ebx
+8010007c:	81 fb 7c 0c 11 80    	cmp    $0x80110c7c,%ebx
+80100082:	74 30                	je     801000b4 <bget+0x5d>
+    if(b->dev == dev && b->blockno == blockno){
+80100084:	39 73 04             	cmp    %esi,0x4(%ebx)
+80100087:	75 f0                	jne    80100079 <bget+0x22>
+80100089:	39 7b 08             	cmp    %edi,0x8(%ebx)
+8010008c:	75 eb                	jne    80100079 <bget+0x22>
+      b->refcnt++;
+8010008e:	8b 43 4c             	mov    0x4c(%ebx),%eax
+80100091:	83 c0 01             	add    $0x1,%eax
+80100094:	89 43 4c             	mov    %eax,0x4c(%ebx)
+      release(&bcache.lock);
+80100097:	83 ec 0c             	sub    $0xc,%esp
+8010009a:	68 80 c5 10 80       	push   $0x8010c580
+8010009f:	e8 76 56 00 00       	call   8010571a <release>
+      acquiresleep(&b->lock);
+801000a4:	8d 43 0c             	lea    0xc(%ebx),%eax
+801000a7:	89 04 24             	mov    %eax,(%esp)
+801000aa:	e8 c2 53 00 00       	call   80105471 <acquiresleep>
+      return b;
+801000af:	83 c4 10             	add    $0x10,%esp
+801000b2:	eb 4c                	jmp    80100100 <bget+0xa9>
+  }
+
+  // Not cached; recycle an unused buffer.
+  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+  // because log.c has modified it but not yet committed it.
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+801000b4:	8b 1d cc 0c 11 80    	mov    0x80110ccc,%ebx
+801000ba:	eb 03                	jmp    801000bf <bget+0x68>
+801000bc:	8b 5b 50             	mov    0x50(%ebx),%ebx
+801000bf:	81 fb 7c 0c 11 80    	cmp    $0x80110c7c,%ebx
+801000c5:	74 43                	je     8010010a <bget+0xb3>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+801000c7:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+801000cb:	75 ef                	jne    801000bc <bget+0x65>
+801000cd:	f6 03 04             	testb  $0x4,(%ebx)
+801000d0:	75 ea                	jne    801000bc <bget+0x65>
+      b->dev = dev;
+801000d2:	89 73 04             	mov    %esi,0x4(%ebx)
+      b->blockno = blockno;
+801000d5:	89 7b 08             	mov    %edi,0x8(%ebx)
+      b->flags = 0;
+801000d8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      b->refcnt = 1;
+801000de:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+801000e5:	83 ec 0c             	sub    $0xc,%esp
+801000e8:	68 80 c5 10 80       	push   $0x8010c580
+801000ed:	e8 28 56 00 00       	call   8010571a <release>
+      acquiresleep(&b->lock);
+801000f2:	8d 43 0c             	lea    0xc(%ebx),%eax
+801000f5:	89 04 24             	mov    %eax,(%esp)
+801000f8:	e8 74 53 00 00       	call   80105471 <acquiresleep>
+      return b;
+801000fd:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  panic("bget: no buffers");
+}
+80100100:	89 d8                	mov    %ebx,%eax
+80100102:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100105:	5b                   	pop    %ebx
+80100106:	5e                   	pop    %esi
+80100107:	5f                   	pop    %edi
+80100108:	5d                   	pop    %ebp
+80100109:	c3                   	ret
+  panic("bget: no buffers");
+8010010a:	83 ec 0c             	sub    $0xc,%esp
+8010010d:	68 a0 85 10 80       	push   $0x801085a0
+80100112:	e8 57 02 00 00       	call   8010036e <panic>
+
+80100117 <binit>:
+{
+80100117:	55                   	push   %ebp
+80100118:	89 e5                	mov    %esp,%ebp
+8010011a:	53                   	push   %ebx
+8010011b:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.lock, "bcache");
+8010011e:	68 b1 85 10 80       	push   $0x801085b1
+80100123:	68 80 c5 10 80       	push   $0x8010c580
+80100128:	e8 44 54 00 00       	call   80105571 <initlock>
+  bcache.head.prev = &bcache.head;
+8010012d:	c7 05 cc 0c 11 80 7c 	movl   $0x80110c7c,0x80110ccc
+80100134:	0c 11 80 
+  bcache.head.next = &bcache.head;
+80100137:	c7 05 d0 0c 11 80 7c 	movl   $0x80110c7c,0x80110cd0
+8010013e:	0c 11 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100141:	83 c4 10             	add    $0x10,%esp
+80100144:	bb b4 c5 10 80       	mov    $0x8010c5b4,%ebx
+80100149:	eb 37                	jmp    80100182 <binit+0x6b>
+    b->next = bcache.head.next;
+8010014b:	a1 d0 0c 11 80       	mov    0x80110cd0,%eax
+80100150:	89 43 54             	mov    %eax,0x54(%ebx)
+    b->prev = &bcache.head;
+80100153:	c7 43 50 7c 0c 11 80 	movl   $0x80110c7c,0x50(%ebx)
+    initsleeplock(&b->lock, "buffer");
+8010015a:	83 ec 08             	sub    $0x8,%esp
+8010015d:	68 b8 85 10 80       	push   $0x801085b8
+80100162:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100165:	50                   	push   %eax
+80100166:	e8 d3 52 00 00       	call   8010543e <initsleeplock>
+    bcache.head.next->prev = b;
+8010016b:	a1 d0 0c 11 80       	mov    0x80110cd0,%eax
+80100170:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+80100173:	89 1d d0 0c 11 80    	mov    %ebx,0x80110cd0
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100179:	81 c3 5c 02 00 00    	add    $0x25c,%ebx
+8010017f:	83 c4 10             	add    $0x10,%esp
+80100182:	81 fb 7c 0c 11 80    	cmp    $0x80110c7c,%ebx
+80100188:	72 c1                	jb     8010014b <binit+0x34>
+}
+8010018a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010018d:	c9                   	leave
+8010018e:	c3                   	ret
+
+8010018f <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+8010018f:	55                   	push   %ebp
+80100190:	89 e5                	mov    %esp,%ebp
+80100192:	53                   	push   %ebx
+80100193:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+80100196:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100199:	8b 45 08             	mov    0x8(%ebp),%eax
+8010019c:	e8 b6 fe ff ff       	call   80100057 <bget>
+801001a1:	89 c3                	mov    %eax,%ebx
+  if((b->flags & B_VALID) == 0) {
+801001a3:	f6 00 02             	testb  $0x2,(%eax)
+801001a6:	74 07                	je     801001af <bread+0x20>
+    iderw(b);
+  }
+  return b;
+}
+801001a8:	89 d8                	mov    %ebx,%eax
+801001aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801001ad:	c9                   	leave
+801001ae:	c3                   	ret
+    iderw(b);
+801001af:	83 ec 0c             	sub    $0xc,%esp
+801001b2:	50                   	push   %eax
+801001b3:	e8 1e 1c 00 00       	call   80101dd6 <iderw>
+801001b8:	83 c4 10             	add    $0x10,%esp
+  return b;
+801001bb:	eb eb                	jmp    801001a8 <bread+0x19>
+
+801001bd <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+801001bd:	55                   	push   %ebp
+801001be:	89 e5                	mov    %esp,%ebp
+801001c0:	53                   	push   %ebx
+801001c1:	83 ec 10             	sub    $0x10,%esp
+801001c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801001c7:	8d 43 0c             	lea    0xc(%ebx),%eax
+801001ca:	50                   	push   %eax
+801001cb:	e8 53 53 00 00       	call   80105523 <holdingsleep>
+801001d0:	83 c4 10             	add    $0x10,%esp
+801001d3:	85 c0                	test   %eax,%eax
+801001d5:	74 18                	je     801001ef <bwrite+0x32>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+801001d7:	8b 03                	mov    (%ebx),%eax
+801001d9:	83 c8 04             	or     $0x4,%eax
+801001dc:	89 03                	mov    %eax,(%ebx)
+  iderw(b);
+801001de:	83 ec 0c             	sub    $0xc,%esp
+801001e1:	53                   	push   %ebx
+801001e2:	e8 ef 1b 00 00       	call   80101dd6 <iderw>
+}
+801001e7:	83 c4 10             	add    $0x10,%esp
+801001ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801001ed:	c9                   	leave
+801001ee:	c3                   	ret
+    panic("bwrite");
+801001ef:	83 ec 0c             	sub    $0xc,%esp
+801001f2:	68 bf 85 10 80       	push   $0x801085bf
+801001f7:	e8 72 01 00 00       	call   8010036e <panic>
+
+801001fc <brelse>:
+
+// Release a locked buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+801001fc:	55                   	push   %ebp
+801001fd:	89 e5                	mov    %esp,%ebp
+801001ff:	56                   	push   %esi
+80100200:	53                   	push   %ebx
+80100201:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100204:	8d 73 0c             	lea    0xc(%ebx),%esi
+80100207:	83 ec 0c             	sub    $0xc,%esp
+8010020a:	56                   	push   %esi
+8010020b:	e8 13 53 00 00       	call   80105523 <holdingsleep>
+80100210:	83 c4 10             	add    $0x10,%esp
+80100213:	85 c0                	test   %eax,%eax
+80100215:	74 68                	je     8010027f <brelse+0x83>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+80100217:	83 ec 0c             	sub    $0xc,%esp
+8010021a:	56                   	push   %esi
+8010021b:	e8 b4 52 00 00       	call   801054d4 <releasesleep>
+
+  acquire(&bcache.lock);
+80100220:	c7 04 24 80 c5 10 80 	movl   $0x8010c580,(%esp)
+80100227:	e8 89 54 00 00       	call   801056b5 <acquire>
+  b->refcnt--;
+8010022c:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010022f:	83 e8 01             	sub    $0x1,%eax
+80100232:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  if (b->refcnt == 0) {
+80100235:	83 c4 10             	add    $0x10,%esp
+80100238:	85 c0                	test   %eax,%eax
+8010023a:	75 2c                	jne    80100268 <brelse+0x6c>
+    // no one is waiting for it.
+    b->next->prev = b->prev;
+8010023c:	8b 53 54             	mov    0x54(%ebx),%edx
+8010023f:	8b 43 50             	mov    0x50(%ebx),%eax
+80100242:	89 42 50             	mov    %eax,0x50(%edx)
+    b->prev->next = b->next;
+80100245:	8b 53 54             	mov    0x54(%ebx),%edx
+80100248:	89 50 54             	mov    %edx,0x54(%eax)
+    b->next = bcache.head.next;
+8010024b:	a1 d0 0c 11 80       	mov    0x80110cd0,%eax
+80100250:	89 43 54             	mov    %eax,0x54(%ebx)
+    b->prev = &bcache.head;
+80100253:	c7 43 50 7c 0c 11 80 	movl   $0x80110c7c,0x50(%ebx)
+    bcache.head.next->prev = b;
+8010025a:	a1 d0 0c 11 80       	mov    0x80110cd0,%eax
+8010025f:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+80100262:	89 1d d0 0c 11 80    	mov    %ebx,0x80110cd0
+  }
+  
+  release(&bcache.lock);
+80100268:	83 ec 0c             	sub    $0xc,%esp
+8010026b:	68 80 c5 10 80       	push   $0x8010c580
+80100270:	e8 a5 54 00 00       	call   8010571a <release>
+}
+80100275:	83 c4 10             	add    $0x10,%esp
+80100278:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010027b:	5b                   	pop    %ebx
+8010027c:	5e                   	pop    %esi
+8010027d:	5d                   	pop    %ebp
+8010027e:	c3                   	ret
+    panic("brelse");
+8010027f:	83 ec 0c             	sub    $0xc,%esp
+80100282:	68 c6 85 10 80       	push   $0x801085c6
+80100287:	e8 e2 00 00 00       	call   8010036e <panic>
+
+8010028c <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+8010028c:	55                   	push   %ebp
+8010028d:	89 e5                	mov    %esp,%ebp
+8010028f:	57                   	push   %edi
+80100290:	56                   	push   %esi
+80100291:	53                   	push   %ebx
+80100292:	83 ec 28             	sub    $0x28,%esp
+80100295:	8b 7d 08             	mov    0x8(%ebp),%edi
+80100298:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010029b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  uint target;
+  int c;
+
+  iunlock(ip);
+8010029e:	57                   	push   %edi
+8010029f:	e8 69 13 00 00       	call   8010160d <iunlock>
+  target = n;
+801002a4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  acquire(&cons.lock);
+801002a7:	c7 04 24 80 0f 11 80 	movl   $0x80110f80,(%esp)
+801002ae:	e8 02 54 00 00       	call   801056b5 <acquire>
+  while(n > 0){
+801002b3:	83 c4 10             	add    $0x10,%esp
+801002b6:	85 db                	test   %ebx,%ebx
+801002b8:	0f 8e 91 00 00 00    	jle    8010034f <consoleread+0xc3>
+    while(input.r == input.w){
+801002be:	a1 60 0f 11 80       	mov    0x80110f60,%eax
+801002c3:	3b 05 64 0f 11 80    	cmp    0x80110f64,%eax
+801002c9:	75 47                	jne    80100312 <consoleread+0x86>
+      if(myproc()->killed){
+801002cb:	e8 fe 3c 00 00       	call   80103fce <myproc>
+801002d0:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+801002d4:	75 17                	jne    801002ed <consoleread+0x61>
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+801002d6:	83 ec 08             	sub    $0x8,%esp
+801002d9:	68 80 0f 11 80       	push   $0x80110f80
+801002de:	68 60 0f 11 80       	push   $0x80110f60
+801002e3:	e8 21 44 00 00       	call   80104709 <sleep>
+801002e8:	83 c4 10             	add    $0x10,%esp
+801002eb:	eb d1                	jmp    801002be <consoleread+0x32>
+        release(&cons.lock);
+801002ed:	83 ec 0c             	sub    $0xc,%esp
+801002f0:	68 80 0f 11 80       	push   $0x80110f80
+801002f5:	e8 20 54 00 00       	call   8010571a <release>
+        ilock(ip);
+801002fa:	89 3c 24             	mov    %edi,(%esp)
+801002fd:	e8 49 12 00 00       	call   8010154b <ilock>
+        return -1;
+80100302:	83 c4 10             	add    $0x10,%esp
+80100305:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+8010030a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010030d:	5b                   	pop    %ebx
+8010030e:	5e                   	pop    %esi
+8010030f:	5f                   	pop    %edi
+80100310:	5d                   	pop    %ebp
+80100311:	c3                   	ret
+    c = input.buf[input.r++ % INPUT_BUF];
+80100312:	8d 50 01             	lea    0x1(%eax),%edx
+80100315:	89 15 60 0f 11 80    	mov    %edx,0x80110f60
+8010031b:	89 c2                	mov    %eax,%edx
+8010031d:	83 e2 7f             	and    $0x7f,%edx
+80100320:	0f b6 92 e0 0e 11 80 	movzbl -0x7feef120(%edx),%edx
+80100327:	0f be ca             	movsbl %dl,%ecx
+    if(c == C('D')){  // EOF
+8010032a:	80 fa 04             	cmp    $0x4,%dl
+8010032d:	74 14                	je     80100343 <consoleread+0xb7>
+    *dst++ = c;
+8010032f:	8d 46 01             	lea    0x1(%esi),%eax
+80100332:	88 16                	mov    %dl,(%esi)
+    --n;
+80100334:	83 eb 01             	sub    $0x1,%ebx
+    if(c == '\n')
+80100337:	83 f9 0a             	cmp    $0xa,%ecx
+8010033a:	74 13                	je     8010034f <consoleread+0xc3>
+    *dst++ = c;
+8010033c:	89 c6                	mov    %eax,%esi
+8010033e:	e9 73 ff ff ff       	jmp    801002b6 <consoleread+0x2a>
+      if(n < target){
+80100343:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80100346:	39 cb                	cmp    %ecx,%ebx
+80100348:	73 05                	jae    8010034f <consoleread+0xc3>
+        input.r--;
+8010034a:	a3 60 0f 11 80       	mov    %eax,0x80110f60
+  release(&cons.lock);
+8010034f:	83 ec 0c             	sub    $0xc,%esp
+80100352:	68 80 0f 11 80       	push   $0x80110f80
+80100357:	e8 be 53 00 00       	call   8010571a <release>
+  ilock(ip);
+8010035c:	89 3c 24             	mov    %edi,(%esp)
+8010035f:	e8 e7 11 00 00       	call   8010154b <ilock>
+  return target - n;
+80100364:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100367:	29 d8                	sub    %ebx,%eax
+80100369:	83 c4 10             	add    $0x10,%esp
+8010036c:	eb 9c                	jmp    8010030a <consoleread+0x7e>
+
+8010036e <panic>:
+{
+8010036e:	55                   	push   %ebp
+8010036f:	89 e5                	mov    %esp,%ebp
+80100371:	53                   	push   %ebx
+80100372:	83 ec 34             	sub    $0x34,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100375:	fa                   	cli
+  cons.locking = 0;
+80100376:	c7 05 b4 0f 11 80 00 	movl   $0x0,0x80110fb4
+8010037d:	00 00 00 
+  cprintf("lapicid %d: panic: ", lapicid());
+80100380:	e8 1e 20 00 00       	call   801023a3 <lapicid>
+80100385:	83 ec 08             	sub    $0x8,%esp
+80100388:	50                   	push   %eax
+80100389:	68 cd 85 10 80       	push   $0x801085cd
+8010038e:	e8 9c 02 00 00       	call   8010062f <cprintf>
+  cprintf(s);
+80100393:	83 c4 04             	add    $0x4,%esp
+80100396:	ff 75 08             	push   0x8(%ebp)
+80100399:	e8 91 02 00 00       	call   8010062f <cprintf>
+  cprintf("\n");
+8010039e:	c7 04 24 6f 90 10 80 	movl   $0x8010906f,(%esp)
+801003a5:	e8 85 02 00 00       	call   8010062f <cprintf>
+  getcallerpcs(&s, pcs);
+801003aa:	83 c4 08             	add    $0x8,%esp
+801003ad:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801003b0:	50                   	push   %eax
+801003b1:	8d 45 08             	lea    0x8(%ebp),%eax
+801003b4:	50                   	push   %eax
+801003b5:	e8 d2 51 00 00       	call   8010558c <getcallerpcs>
+  for(i=0; i<10; i++)
+801003ba:	83 c4 10             	add    $0x10,%esp
+801003bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+801003c2:	eb 17                	jmp    801003db <panic+0x6d>
+    cprintf(" %p", pcs[i]);
+801003c4:	83 ec 08             	sub    $0x8,%esp
+801003c7:	ff 74 9d d0          	push   -0x30(%ebp,%ebx,4)
+801003cb:	68 e1 85 10 80       	push   $0x801085e1
+801003d0:	e8 5a 02 00 00       	call   8010062f <cprintf>
+  for(i=0; i<10; i++)
+801003d5:	83 c3 01             	add    $0x1,%ebx
+801003d8:	83 c4 10             	add    $0x10,%esp
+801003db:	83 fb 09             	cmp    $0x9,%ebx
+801003de:	7e e4                	jle    801003c4 <panic+0x56>
+  panicked = 1; // freeze other CPU
+801003e0:	c7 05 b8 0f 11 80 01 	movl   $0x1,0x80110fb8
+801003e7:	00 00 00 
+  for(;;)
+801003ea:	eb fe                	jmp    801003ea <panic+0x7c>
+
+801003ec <cgaputc>:
+{
+801003ec:	55                   	push   %ebp
+801003ed:	89 e5                	mov    %esp,%ebp
+801003ef:	57                   	push   %edi
+801003f0:	56                   	push   %esi
+801003f1:	53                   	push   %ebx
+801003f2:	83 ec 0c             	sub    $0xc,%esp
+801003f5:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801003f7:	bf d4 03 00 00       	mov    $0x3d4,%edi
+801003fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100401:	89 fa                	mov    %edi,%edx
+80100403:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100404:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100409:	89 ca                	mov    %ecx,%edx
+8010040b:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+8010040c:	0f b6 f0             	movzbl %al,%esi
+8010040f:	c1 e6 08             	shl    $0x8,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100412:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100417:	89 fa                	mov    %edi,%edx
+80100419:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010041a:	89 ca                	mov    %ecx,%edx
+8010041c:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+8010041d:	0f b6 c8             	movzbl %al,%ecx
+80100420:	09 f1                	or     %esi,%ecx
+  if(c == '\n')
+80100422:	83 fb 0a             	cmp    $0xa,%ebx
+80100425:	74 60                	je     80100487 <cgaputc+0x9b>
+  else if(c == BACKSPACE){
+80100427:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+8010042d:	74 79                	je     801004a8 <cgaputc+0xbc>
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+8010042f:	0f b6 c3             	movzbl %bl,%eax
+80100432:	8d 59 01             	lea    0x1(%ecx),%ebx
+80100435:	80 cc 07             	or     $0x7,%ah
+80100438:	66 89 84 09 00 80 0b 	mov    %ax,-0x7ff48000(%ecx,%ecx,1)
+8010043f:	80 
+  if(pos < 0 || pos > 25*80)
+80100440:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+80100446:	77 6d                	ja     801004b5 <cgaputc+0xc9>
+  if((pos/80) >= 24){  // Scroll up.
+80100448:	81 fb 7f 07 00 00    	cmp    $0x77f,%ebx
+8010044e:	7f 72                	jg     801004c2 <cgaputc+0xd6>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100450:	be d4 03 00 00       	mov    $0x3d4,%esi
+80100455:	b8 0e 00 00 00       	mov    $0xe,%eax
+8010045a:	89 f2                	mov    %esi,%edx
+8010045c:	ee                   	out    %al,(%dx)
+  outb(CRTPORT+1, pos>>8);
+8010045d:	0f b6 c7             	movzbl %bh,%eax
+80100460:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100465:	89 ca                	mov    %ecx,%edx
+80100467:	ee                   	out    %al,(%dx)
+80100468:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010046d:	89 f2                	mov    %esi,%edx
+8010046f:	ee                   	out    %al,(%dx)
+80100470:	89 d8                	mov    %ebx,%eax
+80100472:	89 ca                	mov    %ecx,%edx
+80100474:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100475:	66 c7 84 1b 00 80 0b 	movw   $0x720,-0x7ff48000(%ebx,%ebx,1)
+8010047c:	80 20 07 
+}
+8010047f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100482:	5b                   	pop    %ebx
+80100483:	5e                   	pop    %esi
+80100484:	5f                   	pop    %edi
+80100485:	5d                   	pop    %ebp
+80100486:	c3                   	ret
+    pos += 80 - pos%80;
+80100487:	ba 67 66 66 66       	mov    $0x66666667,%edx
+8010048c:	89 c8                	mov    %ecx,%eax
+8010048e:	f7 ea                	imul   %edx
+80100490:	c1 fa 05             	sar    $0x5,%edx
+80100493:	8d 04 92             	lea    (%edx,%edx,4),%eax
+80100496:	c1 e0 04             	shl    $0x4,%eax
+80100499:	89 ca                	mov    %ecx,%edx
+8010049b:	29 c2                	sub    %eax,%edx
+8010049d:	bb 50 00 00 00       	mov    $0x50,%ebx
+801004a2:	29 d3                	sub    %edx,%ebx
+801004a4:	01 cb                	add    %ecx,%ebx
+801004a6:	eb 98                	jmp    80100440 <cgaputc+0x54>
+    if(pos > 0) --pos;
+801004a8:	85 c9                	test   %ecx,%ecx
+801004aa:	7e 05                	jle    801004b1 <cgaputc+0xc5>
+801004ac:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+801004af:	eb 8f                	jmp    80100440 <cgaputc+0x54>
+  pos |= inb(CRTPORT+1);
+801004b1:	89 cb                	mov    %ecx,%ebx
+801004b3:	eb 8b                	jmp    80100440 <cgaputc+0x54>
+    panic("pos under/overflow");
+801004b5:	83 ec 0c             	sub    $0xc,%esp
+801004b8:	68 e5 85 10 80       	push   $0x801085e5
+801004bd:	e8 ac fe ff ff       	call   8010036e <panic>
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+801004c2:	83 ec 04             	sub    $0x4,%esp
+801004c5:	68 60 0e 00 00       	push   $0xe60
+801004ca:	68 a0 80 0b 80       	push   $0x800b80a0
+801004cf:	68 00 80 0b 80       	push   $0x800b8000
+801004d4:	e8 00 53 00 00       	call   801057d9 <memmove>
+    pos -= 80;
+801004d9:	83 eb 50             	sub    $0x50,%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+801004dc:	b8 80 07 00 00       	mov    $0x780,%eax
+801004e1:	29 d8                	sub    %ebx,%eax
+801004e3:	8d 94 1b 00 80 0b 80 	lea    -0x7ff48000(%ebx,%ebx,1),%edx
+801004ea:	83 c4 0c             	add    $0xc,%esp
+801004ed:	01 c0                	add    %eax,%eax
+801004ef:	50                   	push   %eax
+801004f0:	6a 00                	push   $0x0
+801004f2:	52                   	push   %edx
+801004f3:	e8 69 52 00 00       	call   80105761 <memset>
+801004f8:	83 c4 10             	add    $0x10,%esp
+801004fb:	e9 50 ff ff ff       	jmp    80100450 <cgaputc+0x64>
+
+80100500 <consputc>:
+  if(panicked){
+80100500:	83 3d b8 0f 11 80 00 	cmpl   $0x0,0x80110fb8
+80100507:	74 03                	je     8010050c <consputc+0xc>
+  asm volatile("cli");
+80100509:	fa                   	cli
+    for(;;)
+8010050a:	eb fe                	jmp    8010050a <consputc+0xa>
+{
+8010050c:	55                   	push   %ebp
+8010050d:	89 e5                	mov    %esp,%ebp
+8010050f:	53                   	push   %ebx
+80100510:	83 ec 04             	sub    $0x4,%esp
+80100513:	89 c3                	mov    %eax,%ebx
+  if(c == BACKSPACE){
+80100515:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010051a:	74 18                	je     80100534 <consputc+0x34>
+    uartputc(c);
+8010051c:	83 ec 0c             	sub    $0xc,%esp
+8010051f:	50                   	push   %eax
+80100520:	e8 f1 69 00 00       	call   80106f16 <uartputc>
+80100525:	83 c4 10             	add    $0x10,%esp
+  cgaputc(c);
+80100528:	89 d8                	mov    %ebx,%eax
+8010052a:	e8 bd fe ff ff       	call   801003ec <cgaputc>
+}
+8010052f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100532:	c9                   	leave
+80100533:	c3                   	ret
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80100534:	83 ec 0c             	sub    $0xc,%esp
+80100537:	6a 08                	push   $0x8
+80100539:	e8 d8 69 00 00       	call   80106f16 <uartputc>
+8010053e:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80100545:	e8 cc 69 00 00       	call   80106f16 <uartputc>
+8010054a:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100551:	e8 c0 69 00 00       	call   80106f16 <uartputc>
+80100556:	83 c4 10             	add    $0x10,%esp
+80100559:	eb cd                	jmp    80100528 <consputc+0x28>
+
+8010055b <printint>:
+{
+8010055b:	55                   	push   %ebp
+8010055c:	89 e5                	mov    %esp,%ebp
+8010055e:	57                   	push   %edi
+8010055f:	56                   	push   %esi
+80100560:	53                   	push   %ebx
+80100561:	83 ec 2c             	sub    $0x2c,%esp
+80100564:	89 c3                	mov    %eax,%ebx
+80100566:	89 d6                	mov    %edx,%esi
+80100568:	89 c8                	mov    %ecx,%eax
+  if(sign && (sign = xx < 0))
+8010056a:	85 c9                	test   %ecx,%ecx
+8010056c:	74 09                	je     80100577 <printint+0x1c>
+8010056e:	89 d8                	mov    %ebx,%eax
+80100570:	c1 e8 1f             	shr    $0x1f,%eax
+80100573:	85 db                	test   %ebx,%ebx
+80100575:	78 3c                	js     801005b3 <printint+0x58>
+    x = xx;
+80100577:	89 d9                	mov    %ebx,%ecx
+  i = 0;
+80100579:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010057e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    buf[i++] = digits[x % base];
+80100581:	89 c8                	mov    %ecx,%eax
+80100583:	ba 00 00 00 00       	mov    $0x0,%edx
+80100588:	f7 f6                	div    %esi
+8010058a:	89 df                	mov    %ebx,%edi
+8010058c:	83 c3 01             	add    $0x1,%ebx
+8010058f:	0f b6 92 10 86 10 80 	movzbl -0x7fef79f0(%edx),%edx
+80100596:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+8010059a:	89 ca                	mov    %ecx,%edx
+8010059c:	89 c1                	mov    %eax,%ecx
+8010059e:	39 f2                	cmp    %esi,%edx
+801005a0:	73 df                	jae    80100581 <printint+0x26>
+  if(sign)
+801005a2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801005a5:	85 c0                	test   %eax,%eax
+801005a7:	74 1a                	je     801005c3 <printint+0x68>
+    buf[i++] = '-';
+801005a9:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+801005ae:	8d 5f 02             	lea    0x2(%edi),%ebx
+801005b1:	eb 10                	jmp    801005c3 <printint+0x68>
+    x = -xx;
+801005b3:	89 d9                	mov    %ebx,%ecx
+801005b5:	f7 d9                	neg    %ecx
+801005b7:	eb c0                	jmp    80100579 <printint+0x1e>
+    consputc(buf[i]);
+801005b9:	0f be 44 1d d8       	movsbl -0x28(%ebp,%ebx,1),%eax
+801005be:	e8 3d ff ff ff       	call   80100500 <consputc>
+  while(--i >= 0)
+801005c3:	83 eb 01             	sub    $0x1,%ebx
+801005c6:	79 f1                	jns    801005b9 <printint+0x5e>
+}
+801005c8:	83 c4 2c             	add    $0x2c,%esp
+801005cb:	5b                   	pop    %ebx
+801005cc:	5e                   	pop    %esi
+801005cd:	5f                   	pop    %edi
+801005ce:	5d                   	pop    %ebp
+801005cf:	c3                   	ret
+
+801005d0 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+801005d0:	55                   	push   %ebp
+801005d1:	89 e5                	mov    %esp,%ebp
+801005d3:	57                   	push   %edi
+801005d4:	56                   	push   %esi
+801005d5:	53                   	push   %ebx
+801005d6:	83 ec 18             	sub    $0x18,%esp
+801005d9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801005dc:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+801005df:	ff 75 08             	push   0x8(%ebp)
+801005e2:	e8 26 10 00 00       	call   8010160d <iunlock>
+  acquire(&cons.lock);
+801005e7:	c7 04 24 80 0f 11 80 	movl   $0x80110f80,(%esp)
+801005ee:	e8 c2 50 00 00       	call   801056b5 <acquire>
+  for(i = 0; i < n; i++)
+801005f3:	83 c4 10             	add    $0x10,%esp
+801005f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+801005fb:	eb 0c                	jmp    80100609 <consolewrite+0x39>
+    consputc(buf[i] & 0xff);
+801005fd:	0f b6 04 1f          	movzbl (%edi,%ebx,1),%eax
+80100601:	e8 fa fe ff ff       	call   80100500 <consputc>
+  for(i = 0; i < n; i++)
+80100606:	83 c3 01             	add    $0x1,%ebx
+80100609:	39 f3                	cmp    %esi,%ebx
+8010060b:	7c f0                	jl     801005fd <consolewrite+0x2d>
+  release(&cons.lock);
+8010060d:	83 ec 0c             	sub    $0xc,%esp
+80100610:	68 80 0f 11 80       	push   $0x80110f80
+80100615:	e8 00 51 00 00       	call   8010571a <release>
+  ilock(ip);
+8010061a:	83 c4 04             	add    $0x4,%esp
+8010061d:	ff 75 08             	push   0x8(%ebp)
+80100620:	e8 26 0f 00 00       	call   8010154b <ilock>
+
+  return n;
+}
+80100625:	89 f0                	mov    %esi,%eax
+80100627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010062a:	5b                   	pop    %ebx
+8010062b:	5e                   	pop    %esi
+8010062c:	5f                   	pop    %edi
+8010062d:	5d                   	pop    %ebp
+8010062e:	c3                   	ret
+
+8010062f <cprintf>:
+{
+8010062f:	55                   	push   %ebp
+80100630:	89 e5                	mov    %esp,%ebp
+80100632:	57                   	push   %edi
+80100633:	56                   	push   %esi
+80100634:	53                   	push   %ebx
+80100635:	83 ec 0c             	sub    $0xc,%esp
+  if (fmt == 0)
+80100638:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+8010063c:	74 0a                	je     80100648 <cprintf+0x19>
+  argp = (uint*)(void*)(&fmt + 1);
+8010063e:	8d 75 0c             	lea    0xc(%ebp),%esi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100641:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100646:	eb 15                	jmp    8010065d <cprintf+0x2e>
+    panic("null fmt");
+80100648:	83 ec 0c             	sub    $0xc,%esp
+8010064b:	68 ff 85 10 80       	push   $0x801085ff
+80100650:	e8 19 fd ff ff       	call   8010036e <panic>
+      consputc(c);
+80100655:	e8 a6 fe ff ff       	call   80100500 <consputc>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010065a:	83 c3 01             	add    $0x1,%ebx
+8010065d:	8b 55 08             	mov    0x8(%ebp),%edx
+80100660:	0f b6 04 1a          	movzbl (%edx,%ebx,1),%eax
+80100664:	85 c0                	test   %eax,%eax
+80100666:	0f 84 ad 00 00 00    	je     80100719 <cprintf+0xea>
+    if(c != '%'){
+8010066c:	83 f8 25             	cmp    $0x25,%eax
+8010066f:	75 e4                	jne    80100655 <cprintf+0x26>
+    c = fmt[++i] & 0xff;
+80100671:	83 c3 01             	add    $0x1,%ebx
+80100674:	0f b6 3c 1a          	movzbl (%edx,%ebx,1),%edi
+    if(c == 0)
+80100678:	85 ff                	test   %edi,%edi
+8010067a:	0f 84 99 00 00 00    	je     80100719 <cprintf+0xea>
+    switch(c){
+80100680:	83 ff 70             	cmp    $0x70,%edi
+80100683:	74 2e                	je     801006b3 <cprintf+0x84>
+80100685:	7f 22                	jg     801006a9 <cprintf+0x7a>
+80100687:	83 ff 25             	cmp    $0x25,%edi
+8010068a:	74 68                	je     801006f4 <cprintf+0xc5>
+8010068c:	83 ff 64             	cmp    $0x64,%edi
+8010068f:	75 72                	jne    80100703 <cprintf+0xd4>
+      printint(*argp++, 10, 1);
+80100691:	8d 7e 04             	lea    0x4(%esi),%edi
+80100694:	8b 06                	mov    (%esi),%eax
+80100696:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010069b:	ba 0a 00 00 00       	mov    $0xa,%edx
+801006a0:	e8 b6 fe ff ff       	call   8010055b <printint>
+801006a5:	89 fe                	mov    %edi,%esi
+      break;
+801006a7:	eb b1                	jmp    8010065a <cprintf+0x2b>
+    switch(c){
+801006a9:	83 ff 73             	cmp    $0x73,%edi
+801006ac:	74 1d                	je     801006cb <cprintf+0x9c>
+801006ae:	83 ff 78             	cmp    $0x78,%edi
+801006b1:	75 50                	jne    80100703 <cprintf+0xd4>
+      printint(*argp++, 16, 0);
+801006b3:	8d 7e 04             	lea    0x4(%esi),%edi
+801006b6:	8b 06                	mov    (%esi),%eax
+801006b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+801006bd:	ba 10 00 00 00       	mov    $0x10,%edx
+801006c2:	e8 94 fe ff ff       	call   8010055b <printint>
+801006c7:	89 fe                	mov    %edi,%esi
+      break;
+801006c9:	eb 8f                	jmp    8010065a <cprintf+0x2b>
+      if((s = (char*)*argp++) == 0)
+801006cb:	8d 7e 04             	lea    0x4(%esi),%edi
+801006ce:	8b 36                	mov    (%esi),%esi
+801006d0:	85 f6                	test   %esi,%esi
+801006d2:	75 12                	jne    801006e6 <cprintf+0xb7>
+        s = "(null)";
+801006d4:	be f8 85 10 80       	mov    $0x801085f8,%esi
+801006d9:	eb 0b                	jmp    801006e6 <cprintf+0xb7>
+        consputc(*s);
+801006db:	0f be c0             	movsbl %al,%eax
+801006de:	e8 1d fe ff ff       	call   80100500 <consputc>
+      for(; *s; s++)
+801006e3:	83 c6 01             	add    $0x1,%esi
+801006e6:	0f b6 06             	movzbl (%esi),%eax
+801006e9:	84 c0                	test   %al,%al
+801006eb:	75 ee                	jne    801006db <cprintf+0xac>
+      if((s = (char*)*argp++) == 0)
+801006ed:	89 fe                	mov    %edi,%esi
+801006ef:	e9 66 ff ff ff       	jmp    8010065a <cprintf+0x2b>
+      consputc('%');
+801006f4:	b8 25 00 00 00       	mov    $0x25,%eax
+801006f9:	e8 02 fe ff ff       	call   80100500 <consputc>
+      break;
+801006fe:	e9 57 ff ff ff       	jmp    8010065a <cprintf+0x2b>
+      consputc('%');
+80100703:	b8 25 00 00 00       	mov    $0x25,%eax
+80100708:	e8 f3 fd ff ff       	call   80100500 <consputc>
+      consputc(c);
+8010070d:	89 f8                	mov    %edi,%eax
+8010070f:	e8 ec fd ff ff       	call   80100500 <consputc>
+      break;
+80100714:	e9 41 ff ff ff       	jmp    8010065a <cprintf+0x2b>
+}
+80100719:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010071c:	5b                   	pop    %ebx
+8010071d:	5e                   	pop    %esi
+8010071e:	5f                   	pop    %edi
+8010071f:	5d                   	pop    %ebp
+80100720:	c3                   	ret
+
+80100721 <consoleintr>:
+{
+80100721:	55                   	push   %ebp
+80100722:	89 e5                	mov    %esp,%ebp
+80100724:	57                   	push   %edi
+80100725:	56                   	push   %esi
+80100726:	53                   	push   %ebx
+80100727:	83 ec 18             	sub    $0x18,%esp
+8010072a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&cons.lock);
+8010072d:	68 80 0f 11 80       	push   $0x80110f80
+80100732:	e8 7e 4f 00 00       	call   801056b5 <acquire>
+  while((c = getc()) >= 0){
+80100737:	83 c4 10             	add    $0x10,%esp
+  int c, doprocdump = 0;
+8010073a:	be 00 00 00 00       	mov    $0x0,%esi
+  while((c = getc()) >= 0){
+8010073f:	eb 13                	jmp    80100754 <consoleintr+0x33>
+    switch(c){
+80100741:	83 ff 08             	cmp    $0x8,%edi
+80100744:	0f 84 d9 00 00 00    	je     80100823 <consoleintr+0x102>
+8010074a:	83 ff 10             	cmp    $0x10,%edi
+8010074d:	75 25                	jne    80100774 <consoleintr+0x53>
+8010074f:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+80100754:	ff d3                	call   *%ebx
+80100756:	89 c7                	mov    %eax,%edi
+80100758:	85 c0                	test   %eax,%eax
+8010075a:	0f 88 f5 00 00 00    	js     80100855 <consoleintr+0x134>
+    switch(c){
+80100760:	83 ff 15             	cmp    $0x15,%edi
+80100763:	0f 84 93 00 00 00    	je     801007fc <consoleintr+0xdb>
+80100769:	7e d6                	jle    80100741 <consoleintr+0x20>
+8010076b:	83 ff 7f             	cmp    $0x7f,%edi
+8010076e:	0f 84 af 00 00 00    	je     80100823 <consoleintr+0x102>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100774:	85 ff                	test   %edi,%edi
+80100776:	74 dc                	je     80100754 <consoleintr+0x33>
+80100778:	a1 68 0f 11 80       	mov    0x80110f68,%eax
+8010077d:	89 c2                	mov    %eax,%edx
+8010077f:	2b 15 60 0f 11 80    	sub    0x80110f60,%edx
+80100785:	83 fa 7f             	cmp    $0x7f,%edx
+80100788:	77 ca                	ja     80100754 <consoleintr+0x33>
+        c = (c == '\r') ? '\n' : c;
+8010078a:	83 ff 0d             	cmp    $0xd,%edi
+8010078d:	0f 84 b8 00 00 00    	je     8010084b <consoleintr+0x12a>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100793:	8d 50 01             	lea    0x1(%eax),%edx
+80100796:	89 15 68 0f 11 80    	mov    %edx,0x80110f68
+8010079c:	83 e0 7f             	and    $0x7f,%eax
+8010079f:	89 f9                	mov    %edi,%ecx
+801007a1:	88 88 e0 0e 11 80    	mov    %cl,-0x7feef120(%eax)
+        consputc(c);
+801007a7:	89 f8                	mov    %edi,%eax
+801007a9:	e8 52 fd ff ff       	call   80100500 <consputc>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+801007ae:	83 ff 0a             	cmp    $0xa,%edi
+801007b1:	0f 94 c0             	sete   %al
+801007b4:	83 ff 04             	cmp    $0x4,%edi
+801007b7:	0f 94 c2             	sete   %dl
+801007ba:	08 d0                	or     %dl,%al
+801007bc:	75 10                	jne    801007ce <consoleintr+0xad>
+801007be:	a1 60 0f 11 80       	mov    0x80110f60,%eax
+801007c3:	83 e8 80             	sub    $0xffffff80,%eax
+801007c6:	39 05 68 0f 11 80    	cmp    %eax,0x80110f68
+801007cc:	75 86                	jne    80100754 <consoleintr+0x33>
+          input.w = input.e;
+801007ce:	a1 68 0f 11 80       	mov    0x80110f68,%eax
+801007d3:	a3 64 0f 11 80       	mov    %eax,0x80110f64
+          wakeup(&input.r);
+801007d8:	83 ec 0c             	sub    $0xc,%esp
+801007db:	68 60 0f 11 80       	push   $0x80110f60
+801007e0:	e8 b7 40 00 00       	call   8010489c <wakeup>
+801007e5:	83 c4 10             	add    $0x10,%esp
+801007e8:	e9 67 ff ff ff       	jmp    80100754 <consoleintr+0x33>
+        input.e--;
+801007ed:	a3 68 0f 11 80       	mov    %eax,0x80110f68
+        consputc(BACKSPACE);
+801007f2:	b8 00 01 00 00       	mov    $0x100,%eax
+801007f7:	e8 04 fd ff ff       	call   80100500 <consputc>
+      while(input.e != input.w &&
+801007fc:	a1 68 0f 11 80       	mov    0x80110f68,%eax
+80100801:	3b 05 64 0f 11 80    	cmp    0x80110f64,%eax
+80100807:	0f 84 47 ff ff ff    	je     80100754 <consoleintr+0x33>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+8010080d:	83 e8 01             	sub    $0x1,%eax
+80100810:	89 c2                	mov    %eax,%edx
+80100812:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+80100815:	80 ba e0 0e 11 80 0a 	cmpb   $0xa,-0x7feef120(%edx)
+8010081c:	75 cf                	jne    801007ed <consoleintr+0xcc>
+8010081e:	e9 31 ff ff ff       	jmp    80100754 <consoleintr+0x33>
+      if(input.e != input.w){
+80100823:	a1 68 0f 11 80       	mov    0x80110f68,%eax
+80100828:	3b 05 64 0f 11 80    	cmp    0x80110f64,%eax
+8010082e:	0f 84 20 ff ff ff    	je     80100754 <consoleintr+0x33>
+        input.e--;
+80100834:	83 e8 01             	sub    $0x1,%eax
+80100837:	a3 68 0f 11 80       	mov    %eax,0x80110f68
+        consputc(BACKSPACE);
+8010083c:	b8 00 01 00 00       	mov    $0x100,%eax
+80100841:	e8 ba fc ff ff       	call   80100500 <consputc>
+80100846:	e9 09 ff ff ff       	jmp    80100754 <consoleintr+0x33>
+        c = (c == '\r') ? '\n' : c;
+8010084b:	bf 0a 00 00 00       	mov    $0xa,%edi
+80100850:	e9 3e ff ff ff       	jmp    80100793 <consoleintr+0x72>
+  release(&cons.lock);
+80100855:	83 ec 0c             	sub    $0xc,%esp
+80100858:	68 80 0f 11 80       	push   $0x80110f80
+8010085d:	e8 b8 4e 00 00       	call   8010571a <release>
+  if(doprocdump) {
+80100862:	83 c4 10             	add    $0x10,%esp
+80100865:	85 f6                	test   %esi,%esi
+80100867:	75 08                	jne    80100871 <consoleintr+0x150>
+}
+80100869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010086c:	5b                   	pop    %ebx
+8010086d:	5e                   	pop    %esi
+8010086e:	5f                   	pop    %edi
+8010086f:	5d                   	pop    %ebp
+80100870:	c3                   	ret
+    procdump();  // now call procdump() wo. cons.lock held
+80100871:	e8 f1 43 00 00       	call   80104c67 <procdump>
+}
+80100876:	eb f1                	jmp    80100869 <consoleintr+0x148>
+
+80100878 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100878:	55                   	push   %ebp
+80100879:	89 e5                	mov    %esp,%ebp
+8010087b:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+8010087e:	68 08 86 10 80       	push   $0x80108608
+80100883:	68 80 0f 11 80       	push   $0x80110f80
+80100888:	e8 e4 4c 00 00       	call   80105571 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+8010088d:	c7 05 6c 19 11 80 d0 	movl   $0x801005d0,0x8011196c
+80100894:	05 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100897:	c7 05 68 19 11 80 8c 	movl   $0x8010028c,0x80111968
+8010089e:	02 10 80 
+  cons.locking = 1;
+801008a1:	c7 05 b4 0f 11 80 01 	movl   $0x1,0x80110fb4
+801008a8:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+801008ab:	83 c4 08             	add    $0x8,%esp
+801008ae:	6a 00                	push   $0x0
+801008b0:	6a 01                	push   $0x1
+801008b2:	e8 89 16 00 00       	call   80101f40 <ioapicenable>
+}
+801008b7:	83 c4 10             	add    $0x10,%esp
+801008ba:	c9                   	leave
+801008bb:	c3                   	ret
+
+801008bc <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+801008bc:	55                   	push   %ebp
+801008bd:	89 e5                	mov    %esp,%ebp
+801008bf:	57                   	push   %edi
+801008c0:	56                   	push   %esi
+801008c1:	53                   	push   %ebx
+801008c2:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+801008c8:	e8 01 37 00 00       	call   80103fce <myproc>
+801008cd:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+
+  begin_op();
+801008d3:	e8 23 1f 00 00       	call   801027fb <begin_op>
+
+  if((ip = namei(path)) == 0){
+801008d8:	83 ec 0c             	sub    $0xc,%esp
+801008db:	ff 75 08             	push   0x8(%ebp)
+801008de:	e8 c4 12 00 00       	call   80101ba7 <namei>
+801008e3:	83 c4 10             	add    $0x10,%esp
+801008e6:	85 c0                	test   %eax,%eax
+801008e8:	74 56                	je     80100940 <exec+0x84>
+801008ea:	89 c3                	mov    %eax,%ebx
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+801008ec:	83 ec 0c             	sub    $0xc,%esp
+801008ef:	50                   	push   %eax
+801008f0:	e8 56 0c 00 00       	call   8010154b <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+801008f5:	6a 34                	push   $0x34
+801008f7:	6a 00                	push   $0x0
+801008f9:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+801008ff:	50                   	push   %eax
+80100900:	53                   	push   %ebx
+80100901:	e8 37 0e 00 00       	call   8010173d <readi>
+80100906:	83 c4 20             	add    $0x20,%esp
+80100909:	83 f8 34             	cmp    $0x34,%eax
+8010090c:	75 0c                	jne    8010091a <exec+0x5e>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+8010090e:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80100915:	45 4c 46 
+80100918:	74 42                	je     8010095c <exec+0xa0>
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+  if(ip){
+8010091a:	85 db                	test   %ebx,%ebx
+8010091c:	0f 84 bc 02 00 00    	je     80100bde <exec+0x322>
+    iunlockput(ip);
+80100922:	83 ec 0c             	sub    $0xc,%esp
+80100925:	53                   	push   %ebx
+80100926:	e8 c7 0d 00 00       	call   801016f2 <iunlockput>
+    end_op();
+8010092b:	e8 45 1f 00 00       	call   80102875 <end_op>
+80100930:	83 c4 10             	add    $0x10,%esp
+  }
+  return -1;
+80100933:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80100938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010093b:	5b                   	pop    %ebx
+8010093c:	5e                   	pop    %esi
+8010093d:	5f                   	pop    %edi
+8010093e:	5d                   	pop    %ebp
+8010093f:	c3                   	ret
+    end_op();
+80100940:	e8 30 1f 00 00       	call   80102875 <end_op>
+    cprintf("exec: fail\n");
+80100945:	83 ec 0c             	sub    $0xc,%esp
+80100948:	68 21 86 10 80       	push   $0x80108621
+8010094d:	e8 dd fc ff ff       	call   8010062f <cprintf>
+    return -1;
+80100952:	83 c4 10             	add    $0x10,%esp
+80100955:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010095a:	eb dc                	jmp    80100938 <exec+0x7c>
+  if((pgdir = setupkvm()) == 0)
+8010095c:	e8 98 79 00 00       	call   801082f9 <setupkvm>
+80100961:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100967:	85 c0                	test   %eax,%eax
+80100969:	74 af                	je     8010091a <exec+0x5e>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010096b:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  sz = 0;
+80100971:	bf 00 00 00 00       	mov    $0x0,%edi
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100976:	be 00 00 00 00       	mov    $0x0,%esi
+8010097b:	eb 0c                	jmp    80100989 <exec+0xcd>
+8010097d:	83 c6 01             	add    $0x1,%esi
+80100980:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+80100986:	83 c0 20             	add    $0x20,%eax
+80100989:	0f b7 95 50 ff ff ff 	movzwl -0xb0(%ebp),%edx
+80100990:	39 f2                	cmp    %esi,%edx
+80100992:	0f 8e 98 00 00 00    	jle    80100a30 <exec+0x174>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80100998:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+8010099e:	6a 20                	push   $0x20
+801009a0:	50                   	push   %eax
+801009a1:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+801009a7:	50                   	push   %eax
+801009a8:	53                   	push   %ebx
+801009a9:	e8 8f 0d 00 00       	call   8010173d <readi>
+801009ae:	83 c4 10             	add    $0x10,%esp
+801009b1:	83 f8 20             	cmp    $0x20,%eax
+801009b4:	0f 85 b4 00 00 00    	jne    80100a6e <exec+0x1b2>
+    if(ph.type != ELF_PROG_LOAD)
+801009ba:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+801009c1:	75 ba                	jne    8010097d <exec+0xc1>
+    if(ph.memsz < ph.filesz)
+801009c3:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+801009c9:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+801009cf:	0f 82 99 00 00 00    	jb     80100a6e <exec+0x1b2>
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+801009d5:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+801009db:	0f 82 8d 00 00 00    	jb     80100a6e <exec+0x1b2>
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+801009e1:	83 ec 04             	sub    $0x4,%esp
+801009e4:	50                   	push   %eax
+801009e5:	57                   	push   %edi
+801009e6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+801009ec:	e8 89 77 00 00       	call   8010817a <allocuvm>
+801009f1:	89 c7                	mov    %eax,%edi
+801009f3:	83 c4 10             	add    $0x10,%esp
+801009f6:	85 c0                	test   %eax,%eax
+801009f8:	74 74                	je     80100a6e <exec+0x1b2>
+    if(ph.vaddr % PGSIZE != 0)
+801009fa:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+80100a00:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80100a05:	75 67                	jne    80100a6e <exec+0x1b2>
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80100a07:	83 ec 0c             	sub    $0xc,%esp
+80100a0a:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+80100a10:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+80100a16:	53                   	push   %ebx
+80100a17:	50                   	push   %eax
+80100a18:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100a1e:	e8 02 76 00 00       	call   80108025 <loaduvm>
+80100a23:	83 c4 20             	add    $0x20,%esp
+80100a26:	85 c0                	test   %eax,%eax
+80100a28:	0f 89 4f ff ff ff    	jns    8010097d <exec+0xc1>
+80100a2e:	eb 3e                	jmp    80100a6e <exec+0x1b2>
+  iunlockput(ip);
+80100a30:	83 ec 0c             	sub    $0xc,%esp
+80100a33:	53                   	push   %ebx
+80100a34:	e8 b9 0c 00 00       	call   801016f2 <iunlockput>
+  end_op();
+80100a39:	e8 37 1e 00 00       	call   80102875 <end_op>
+  sz = PGROUNDUP(sz);
+80100a3e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+80100a44:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100a49:	83 c4 0c             	add    $0xc,%esp
+80100a4c:	8d 90 00 20 00 00    	lea    0x2000(%eax),%edx
+80100a52:	52                   	push   %edx
+80100a53:	50                   	push   %eax
+80100a54:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+80100a5a:	57                   	push   %edi
+80100a5b:	e8 1a 77 00 00       	call   8010817a <allocuvm>
+80100a60:	89 c6                	mov    %eax,%esi
+80100a62:	83 c4 10             	add    $0x10,%esp
+80100a65:	85 c0                	test   %eax,%eax
+80100a67:	75 1b                	jne    80100a84 <exec+0x1c8>
+  ip = 0;
+80100a69:	bb 00 00 00 00       	mov    $0x0,%ebx
+    freevm(pgdir);
+80100a6e:	83 ec 0c             	sub    $0xc,%esp
+80100a71:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100a77:	e8 fb 77 00 00       	call   80108277 <freevm>
+80100a7c:	83 c4 10             	add    $0x10,%esp
+80100a7f:	e9 96 fe ff ff       	jmp    8010091a <exec+0x5e>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100a84:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+80100a8a:	83 ec 08             	sub    $0x8,%esp
+80100a8d:	50                   	push   %eax
+80100a8e:	57                   	push   %edi
+80100a8f:	e8 ea 78 00 00       	call   8010837e <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80100a94:	83 c4 10             	add    $0x10,%esp
+80100a97:	bf 00 00 00 00       	mov    $0x0,%edi
+80100a9c:	89 b5 f4 fe ff ff    	mov    %esi,-0x10c(%ebp)
+80100aa2:	eb 0a                	jmp    80100aae <exec+0x1f2>
+    ustack[3+argc] = sp;
+80100aa4:	89 b4 bd 64 ff ff ff 	mov    %esi,-0x9c(%ebp,%edi,4)
+  for(argc = 0; argv[argc]; argc++) {
+80100aab:	83 c7 01             	add    $0x1,%edi
+80100aae:	8b 45 0c             	mov    0xc(%ebp),%eax
+80100ab1:	8d 1c b8             	lea    (%eax,%edi,4),%ebx
+80100ab4:	8b 03                	mov    (%ebx),%eax
+80100ab6:	85 c0                	test   %eax,%eax
+80100ab8:	74 47                	je     80100b01 <exec+0x245>
+    if(argc >= MAXARG)
+80100aba:	83 ff 1f             	cmp    $0x1f,%edi
+80100abd:	0f 87 11 01 00 00    	ja     80100bd4 <exec+0x318>
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100ac3:	83 ec 0c             	sub    $0xc,%esp
+80100ac6:	50                   	push   %eax
+80100ac7:	e8 3e 4e 00 00       	call   8010590a <strlen>
+80100acc:	29 c6                	sub    %eax,%esi
+80100ace:	83 ee 01             	sub    $0x1,%esi
+80100ad1:	83 e6 fc             	and    $0xfffffffc,%esi
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100ad4:	83 c4 04             	add    $0x4,%esp
+80100ad7:	ff 33                	push   (%ebx)
+80100ad9:	e8 2c 4e 00 00       	call   8010590a <strlen>
+80100ade:	83 c0 01             	add    $0x1,%eax
+80100ae1:	50                   	push   %eax
+80100ae2:	ff 33                	push   (%ebx)
+80100ae4:	56                   	push   %esi
+80100ae5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100aeb:	e8 22 7a 00 00       	call   80108512 <copyout>
+80100af0:	83 c4 20             	add    $0x20,%esp
+80100af3:	85 c0                	test   %eax,%eax
+80100af5:	79 ad                	jns    80100aa4 <exec+0x1e8>
+  ip = 0;
+80100af7:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100afc:	e9 6d ff ff ff       	jmp    80100a6e <exec+0x1b2>
+  ustack[3+argc] = 0;
+80100b01:	89 f1                	mov    %esi,%ecx
+80100b03:	89 c3                	mov    %eax,%ebx
+80100b05:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+80100b0b:	c7 84 bd 64 ff ff ff 	movl   $0x0,-0x9c(%ebp,%edi,4)
+80100b12:	00 00 00 00 
+  ustack[0] = 0xffffffff;  // fake return PC
+80100b16:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80100b1d:	ff ff ff 
+  ustack[1] = argc;
+80100b20:	89 bd 5c ff ff ff    	mov    %edi,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100b26:	8d 14 bd 04 00 00 00 	lea    0x4(,%edi,4),%edx
+80100b2d:	89 c8                	mov    %ecx,%eax
+80100b2f:	29 d0                	sub    %edx,%eax
+80100b31:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  sp -= (3+argc+1) * 4;
+80100b37:	8d 04 bd 10 00 00 00 	lea    0x10(,%edi,4),%eax
+80100b3e:	29 c1                	sub    %eax,%ecx
+80100b40:	89 cf                	mov    %ecx,%edi
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80100b42:	50                   	push   %eax
+80100b43:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+80100b49:	50                   	push   %eax
+80100b4a:	51                   	push   %ecx
+80100b4b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100b51:	e8 bc 79 00 00       	call   80108512 <copyout>
+80100b56:	83 c4 10             	add    $0x10,%esp
+80100b59:	85 c0                	test   %eax,%eax
+80100b5b:	0f 88 0d ff ff ff    	js     80100a6e <exec+0x1b2>
+  for(last=s=path; *s; s++)
+80100b61:	8b 55 08             	mov    0x8(%ebp),%edx
+80100b64:	89 d0                	mov    %edx,%eax
+80100b66:	eb 03                	jmp    80100b6b <exec+0x2af>
+80100b68:	83 c0 01             	add    $0x1,%eax
+80100b6b:	0f b6 08             	movzbl (%eax),%ecx
+80100b6e:	84 c9                	test   %cl,%cl
+80100b70:	74 0a                	je     80100b7c <exec+0x2c0>
+    if(*s == '/')
+80100b72:	80 f9 2f             	cmp    $0x2f,%cl
+80100b75:	75 f1                	jne    80100b68 <exec+0x2ac>
+      last = s+1;
+80100b77:	8d 50 01             	lea    0x1(%eax),%edx
+80100b7a:	eb ec                	jmp    80100b68 <exec+0x2ac>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+80100b7c:	8b 9d ec fe ff ff    	mov    -0x114(%ebp),%ebx
+80100b82:	89 d8                	mov    %ebx,%eax
+80100b84:	83 c0 74             	add    $0x74,%eax
+80100b87:	83 ec 04             	sub    $0x4,%esp
+80100b8a:	6a 10                	push   $0x10
+80100b8c:	52                   	push   %edx
+80100b8d:	50                   	push   %eax
+80100b8e:	e8 3a 4d 00 00       	call   801058cd <safestrcpy>
+  oldpgdir = curproc->pgdir;
+80100b93:	89 d8                	mov    %ebx,%eax
+80100b95:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  curproc->pgdir = pgdir;
+80100b98:	8b 8d f0 fe ff ff    	mov    -0x110(%ebp),%ecx
+80100b9e:	89 48 04             	mov    %ecx,0x4(%eax)
+  curproc->sz = sz;
+80100ba1:	89 30                	mov    %esi,(%eax)
+  curproc->tf->eip = elf.entry;  // main
+80100ba3:	89 c1                	mov    %eax,%ecx
+80100ba5:	8b 40 18             	mov    0x18(%eax),%eax
+80100ba8:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+80100bae:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80100bb1:	8b 41 18             	mov    0x18(%ecx),%eax
+80100bb4:	89 78 44             	mov    %edi,0x44(%eax)
+  switchuvm(curproc);
+80100bb7:	89 0c 24             	mov    %ecx,(%esp)
+80100bba:	e8 71 72 00 00       	call   80107e30 <switchuvm>
+  freevm(oldpgdir);
+80100bbf:	89 1c 24             	mov    %ebx,(%esp)
+80100bc2:	e8 b0 76 00 00       	call   80108277 <freevm>
+  return 0;
+80100bc7:	83 c4 10             	add    $0x10,%esp
+80100bca:	b8 00 00 00 00       	mov    $0x0,%eax
+80100bcf:	e9 64 fd ff ff       	jmp    80100938 <exec+0x7c>
+  ip = 0;
+80100bd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100bd9:	e9 90 fe ff ff       	jmp    80100a6e <exec+0x1b2>
+  return -1;
+80100bde:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100be3:	e9 50 fd ff ff       	jmp    80100938 <exec+0x7c>
+
+80100be8 <fileinit>:
+  struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+80100be8:	55                   	push   %ebp
+80100be9:	89 e5                	mov    %esp,%ebp
+80100beb:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80100bee:	68 2d 86 10 80       	push   $0x8010862d
+80100bf3:	68 c0 0f 11 80       	push   $0x80110fc0
+80100bf8:	e8 74 49 00 00       	call   80105571 <initlock>
+}
+80100bfd:	83 c4 10             	add    $0x10,%esp
+80100c00:	c9                   	leave
+80100c01:	c3                   	ret
+
+80100c02 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80100c02:	55                   	push   %ebp
+80100c03:	89 e5                	mov    %esp,%ebp
+80100c05:	53                   	push   %ebx
+80100c06:	83 ec 10             	sub    $0x10,%esp
+  struct file *f;
+
+  acquire(&ftable.lock);
+80100c09:	68 c0 0f 11 80       	push   $0x80110fc0
+80100c0e:	e8 a2 4a 00 00       	call   801056b5 <acquire>
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100c13:	83 c4 10             	add    $0x10,%esp
+80100c16:	bb f4 0f 11 80       	mov    $0x80110ff4,%ebx
+80100c1b:	81 fb 54 19 11 80    	cmp    $0x80111954,%ebx
+80100c21:	73 29                	jae    80100c4c <filealloc+0x4a>
+    if(f->ref == 0){
+80100c23:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+80100c27:	74 05                	je     80100c2e <filealloc+0x2c>
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100c29:	83 c3 18             	add    $0x18,%ebx
+80100c2c:	eb ed                	jmp    80100c1b <filealloc+0x19>
+      f->ref = 1;
+80100c2e:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      release(&ftable.lock);
+80100c35:	83 ec 0c             	sub    $0xc,%esp
+80100c38:	68 c0 0f 11 80       	push   $0x80110fc0
+80100c3d:	e8 d8 4a 00 00       	call   8010571a <release>
+      return f;
+80100c42:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  release(&ftable.lock);
+  return 0;
+}
+80100c45:	89 d8                	mov    %ebx,%eax
+80100c47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100c4a:	c9                   	leave
+80100c4b:	c3                   	ret
+  release(&ftable.lock);
+80100c4c:	83 ec 0c             	sub    $0xc,%esp
+80100c4f:	68 c0 0f 11 80       	push   $0x80110fc0
+80100c54:	e8 c1 4a 00 00       	call   8010571a <release>
+  return 0;
+80100c59:	83 c4 10             	add    $0x10,%esp
+80100c5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100c61:	eb e2                	jmp    80100c45 <filealloc+0x43>
+
+80100c63 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80100c63:	55                   	push   %ebp
+80100c64:	89 e5                	mov    %esp,%ebp
+80100c66:	53                   	push   %ebx
+80100c67:	83 ec 10             	sub    $0x10,%esp
+80100c6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+80100c6d:	68 c0 0f 11 80       	push   $0x80110fc0
+80100c72:	e8 3e 4a 00 00       	call   801056b5 <acquire>
+  if(f->ref < 1)
+80100c77:	8b 43 04             	mov    0x4(%ebx),%eax
+80100c7a:	83 c4 10             	add    $0x10,%esp
+80100c7d:	85 c0                	test   %eax,%eax
+80100c7f:	7e 1a                	jle    80100c9b <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+80100c81:	83 c0 01             	add    $0x1,%eax
+80100c84:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80100c87:	83 ec 0c             	sub    $0xc,%esp
+80100c8a:	68 c0 0f 11 80       	push   $0x80110fc0
+80100c8f:	e8 86 4a 00 00       	call   8010571a <release>
+  return f;
+}
+80100c94:	89 d8                	mov    %ebx,%eax
+80100c96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100c99:	c9                   	leave
+80100c9a:	c3                   	ret
+    panic("filedup");
+80100c9b:	83 ec 0c             	sub    $0xc,%esp
+80100c9e:	68 34 86 10 80       	push   $0x80108634
+80100ca3:	e8 c6 f6 ff ff       	call   8010036e <panic>
+
+80100ca8 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80100ca8:	55                   	push   %ebp
+80100ca9:	89 e5                	mov    %esp,%ebp
+80100cab:	53                   	push   %ebx
+80100cac:	83 ec 30             	sub    $0x30,%esp
+80100caf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+80100cb2:	68 c0 0f 11 80       	push   $0x80110fc0
+80100cb7:	e8 f9 49 00 00       	call   801056b5 <acquire>
+  if(f->ref < 1)
+80100cbc:	8b 43 04             	mov    0x4(%ebx),%eax
+80100cbf:	83 c4 10             	add    $0x10,%esp
+80100cc2:	85 c0                	test   %eax,%eax
+80100cc4:	7e 71                	jle    80100d37 <fileclose+0x8f>
+    panic("fileclose");
+  if(--f->ref > 0){
+80100cc6:	83 e8 01             	sub    $0x1,%eax
+80100cc9:	89 43 04             	mov    %eax,0x4(%ebx)
+80100ccc:	85 c0                	test   %eax,%eax
+80100cce:	7f 74                	jg     80100d44 <fileclose+0x9c>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+80100cd0:	8b 03                	mov    (%ebx),%eax
+80100cd2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100cd5:	8b 43 04             	mov    0x4(%ebx),%eax
+80100cd8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100cdb:	8b 43 08             	mov    0x8(%ebx),%eax
+80100cde:	89 45 e8             	mov    %eax,-0x18(%ebp)
+80100ce1:	8b 43 0c             	mov    0xc(%ebx),%eax
+80100ce4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+80100ce7:	8b 43 10             	mov    0x10(%ebx),%eax
+80100cea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+80100ced:	8b 43 14             	mov    0x14(%ebx),%eax
+80100cf0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  f->ref = 0;
+80100cf3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  f->type = FD_NONE;
+80100cfa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  release(&ftable.lock);
+80100d00:	83 ec 0c             	sub    $0xc,%esp
+80100d03:	68 c0 0f 11 80       	push   $0x80110fc0
+80100d08:	e8 0d 4a 00 00       	call   8010571a <release>
+
+  if(ff.type == FD_PIPE)
+80100d0d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100d10:	83 c4 10             	add    $0x10,%esp
+80100d13:	83 f8 01             	cmp    $0x1,%eax
+80100d16:	74 41                	je     80100d59 <fileclose+0xb1>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+80100d18:	83 f8 02             	cmp    $0x2,%eax
+80100d1b:	75 37                	jne    80100d54 <fileclose+0xac>
+    begin_op();
+80100d1d:	e8 d9 1a 00 00       	call   801027fb <begin_op>
+    iput(ff.ip);
+80100d22:	83 ec 0c             	sub    $0xc,%esp
+80100d25:	ff 75 f0             	push   -0x10(%ebp)
+80100d28:	e8 25 09 00 00       	call   80101652 <iput>
+    end_op();
+80100d2d:	e8 43 1b 00 00       	call   80102875 <end_op>
+80100d32:	83 c4 10             	add    $0x10,%esp
+80100d35:	eb 1d                	jmp    80100d54 <fileclose+0xac>
+    panic("fileclose");
+80100d37:	83 ec 0c             	sub    $0xc,%esp
+80100d3a:	68 3c 86 10 80       	push   $0x8010863c
+80100d3f:	e8 2a f6 ff ff       	call   8010036e <panic>
+    release(&ftable.lock);
+80100d44:	83 ec 0c             	sub    $0xc,%esp
+80100d47:	68 c0 0f 11 80       	push   $0x80110fc0
+80100d4c:	e8 c9 49 00 00       	call   8010571a <release>
+    return;
+80100d51:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80100d54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100d57:	c9                   	leave
+80100d58:	c3                   	ret
+    pipeclose(ff.pipe, ff.writable);
+80100d59:	83 ec 08             	sub    $0x8,%esp
+80100d5c:	0f be 45 e9          	movsbl -0x17(%ebp),%eax
+80100d60:	50                   	push   %eax
+80100d61:	ff 75 ec             	push   -0x14(%ebp)
+80100d64:	e8 3c 21 00 00       	call   80102ea5 <pipeclose>
+80100d69:	83 c4 10             	add    $0x10,%esp
+80100d6c:	eb e6                	jmp    80100d54 <fileclose+0xac>
+
+80100d6e <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80100d6e:	55                   	push   %ebp
+80100d6f:	89 e5                	mov    %esp,%ebp
+80100d71:	53                   	push   %ebx
+80100d72:	83 ec 04             	sub    $0x4,%esp
+80100d75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+80100d78:	83 3b 02             	cmpl   $0x2,(%ebx)
+80100d7b:	75 31                	jne    80100dae <filestat+0x40>
+    ilock(f->ip);
+80100d7d:	83 ec 0c             	sub    $0xc,%esp
+80100d80:	ff 73 10             	push   0x10(%ebx)
+80100d83:	e8 c3 07 00 00       	call   8010154b <ilock>
+    stati(f->ip, st);
+80100d88:	83 c4 08             	add    $0x8,%esp
+80100d8b:	ff 75 0c             	push   0xc(%ebp)
+80100d8e:	ff 73 10             	push   0x10(%ebx)
+80100d91:	e8 7c 09 00 00       	call   80101712 <stati>
+    iunlock(f->ip);
+80100d96:	83 c4 04             	add    $0x4,%esp
+80100d99:	ff 73 10             	push   0x10(%ebx)
+80100d9c:	e8 6c 08 00 00       	call   8010160d <iunlock>
+    return 0;
+80100da1:	83 c4 10             	add    $0x10,%esp
+80100da4:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  return -1;
+}
+80100da9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100dac:	c9                   	leave
+80100dad:	c3                   	ret
+  return -1;
+80100dae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100db3:	eb f4                	jmp    80100da9 <filestat+0x3b>
+
+80100db5 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80100db5:	55                   	push   %ebp
+80100db6:	89 e5                	mov    %esp,%ebp
+80100db8:	56                   	push   %esi
+80100db9:	53                   	push   %ebx
+80100dba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  if(f->readable == 0)
+80100dbd:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80100dc1:	74 70                	je     80100e33 <fileread+0x7e>
+    return -1;
+  if(f->type == FD_PIPE)
+80100dc3:	8b 03                	mov    (%ebx),%eax
+80100dc5:	83 f8 01             	cmp    $0x1,%eax
+80100dc8:	74 44                	je     80100e0e <fileread+0x59>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+80100dca:	83 f8 02             	cmp    $0x2,%eax
+80100dcd:	75 57                	jne    80100e26 <fileread+0x71>
+    ilock(f->ip);
+80100dcf:	83 ec 0c             	sub    $0xc,%esp
+80100dd2:	ff 73 10             	push   0x10(%ebx)
+80100dd5:	e8 71 07 00 00       	call   8010154b <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+80100dda:	ff 75 10             	push   0x10(%ebp)
+80100ddd:	ff 73 14             	push   0x14(%ebx)
+80100de0:	ff 75 0c             	push   0xc(%ebp)
+80100de3:	ff 73 10             	push   0x10(%ebx)
+80100de6:	e8 52 09 00 00       	call   8010173d <readi>
+80100deb:	89 c6                	mov    %eax,%esi
+80100ded:	83 c4 20             	add    $0x20,%esp
+80100df0:	85 c0                	test   %eax,%eax
+80100df2:	7e 03                	jle    80100df7 <fileread+0x42>
+      f->off += r;
+80100df4:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+80100df7:	83 ec 0c             	sub    $0xc,%esp
+80100dfa:	ff 73 10             	push   0x10(%ebx)
+80100dfd:	e8 0b 08 00 00       	call   8010160d <iunlock>
+    return r;
+80100e02:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+80100e05:	89 f0                	mov    %esi,%eax
+80100e07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100e0a:	5b                   	pop    %ebx
+80100e0b:	5e                   	pop    %esi
+80100e0c:	5d                   	pop    %ebp
+80100e0d:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+80100e0e:	83 ec 04             	sub    $0x4,%esp
+80100e11:	ff 75 10             	push   0x10(%ebp)
+80100e14:	ff 75 0c             	push   0xc(%ebp)
+80100e17:	ff 73 0c             	push   0xc(%ebx)
+80100e1a:	e8 d7 21 00 00       	call   80102ff6 <piperead>
+80100e1f:	89 c6                	mov    %eax,%esi
+80100e21:	83 c4 10             	add    $0x10,%esp
+80100e24:	eb df                	jmp    80100e05 <fileread+0x50>
+  panic("fileread");
+80100e26:	83 ec 0c             	sub    $0xc,%esp
+80100e29:	68 46 86 10 80       	push   $0x80108646
+80100e2e:	e8 3b f5 ff ff       	call   8010036e <panic>
+    return -1;
+80100e33:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80100e38:	eb cb                	jmp    80100e05 <fileread+0x50>
+
+80100e3a <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80100e3a:	55                   	push   %ebp
+80100e3b:	89 e5                	mov    %esp,%ebp
+80100e3d:	57                   	push   %edi
+80100e3e:	56                   	push   %esi
+80100e3f:	53                   	push   %ebx
+80100e40:	83 ec 1c             	sub    $0x1c,%esp
+80100e43:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+
+  if(f->writable == 0)
+80100e46:	80 7e 09 00          	cmpb   $0x0,0x9(%esi)
+80100e4a:	0f 84 cc 00 00 00    	je     80100f1c <filewrite+0xe2>
+    return -1;
+  if(f->type == FD_PIPE)
+80100e50:	8b 06                	mov    (%esi),%eax
+80100e52:	83 f8 01             	cmp    $0x1,%eax
+80100e55:	74 10                	je     80100e67 <filewrite+0x2d>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+80100e57:	83 f8 02             	cmp    $0x2,%eax
+80100e5a:	0f 85 af 00 00 00    	jne    80100f0f <filewrite+0xd5>
+    // i-node, indirect block, allocation blocks,
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int i = 0;
+80100e60:	bf 00 00 00 00       	mov    $0x0,%edi
+80100e65:	eb 67                	jmp    80100ece <filewrite+0x94>
+    return pipewrite(f->pipe, addr, n);
+80100e67:	83 ec 04             	sub    $0x4,%esp
+80100e6a:	ff 75 10             	push   0x10(%ebp)
+80100e6d:	ff 75 0c             	push   0xc(%ebp)
+80100e70:	ff 76 0c             	push   0xc(%esi)
+80100e73:	e8 b9 20 00 00       	call   80102f31 <pipewrite>
+80100e78:	83 c4 10             	add    $0x10,%esp
+80100e7b:	e9 82 00 00 00       	jmp    80100f02 <filewrite+0xc8>
+    while(i < n){
+      int n1 = n - i;
+      if(n1 > max)
+        n1 = max;
+
+      begin_op();
+80100e80:	e8 76 19 00 00       	call   801027fb <begin_op>
+      ilock(f->ip);
+80100e85:	83 ec 0c             	sub    $0xc,%esp
+80100e88:	ff 76 10             	push   0x10(%esi)
+80100e8b:	e8 bb 06 00 00       	call   8010154b <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+80100e90:	ff 75 e4             	push   -0x1c(%ebp)
+80100e93:	ff 76 14             	push   0x14(%esi)
+80100e96:	89 f8                	mov    %edi,%eax
+80100e98:	03 45 0c             	add    0xc(%ebp),%eax
+80100e9b:	50                   	push   %eax
+80100e9c:	ff 76 10             	push   0x10(%esi)
+80100e9f:	e8 94 09 00 00       	call   80101838 <writei>
+80100ea4:	89 c3                	mov    %eax,%ebx
+80100ea6:	83 c4 20             	add    $0x20,%esp
+80100ea9:	85 c0                	test   %eax,%eax
+80100eab:	7e 03                	jle    80100eb0 <filewrite+0x76>
+        f->off += r;
+80100ead:	01 46 14             	add    %eax,0x14(%esi)
+      iunlock(f->ip);
+80100eb0:	83 ec 0c             	sub    $0xc,%esp
+80100eb3:	ff 76 10             	push   0x10(%esi)
+80100eb6:	e8 52 07 00 00       	call   8010160d <iunlock>
+      end_op();
+80100ebb:	e8 b5 19 00 00       	call   80102875 <end_op>
+
+      if(r < 0)
+80100ec0:	83 c4 10             	add    $0x10,%esp
+80100ec3:	85 db                	test   %ebx,%ebx
+80100ec5:	78 31                	js     80100ef8 <filewrite+0xbe>
+        break;
+      if(r != n1)
+80100ec7:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+80100eca:	75 1f                	jne    80100eeb <filewrite+0xb1>
+        panic("short filewrite");
+      i += r;
+80100ecc:	01 df                	add    %ebx,%edi
+    while(i < n){
+80100ece:	3b 7d 10             	cmp    0x10(%ebp),%edi
+80100ed1:	7d 25                	jge    80100ef8 <filewrite+0xbe>
+      int n1 = n - i;
+80100ed3:	8b 45 10             	mov    0x10(%ebp),%eax
+80100ed6:	29 f8                	sub    %edi,%eax
+80100ed8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(n1 > max)
+80100edb:	3d 00 06 00 00       	cmp    $0x600,%eax
+80100ee0:	7e 9e                	jle    80100e80 <filewrite+0x46>
+        n1 = max;
+80100ee2:	c7 45 e4 00 06 00 00 	movl   $0x600,-0x1c(%ebp)
+80100ee9:	eb 95                	jmp    80100e80 <filewrite+0x46>
+        panic("short filewrite");
+80100eeb:	83 ec 0c             	sub    $0xc,%esp
+80100eee:	68 4f 86 10 80       	push   $0x8010864f
+80100ef3:	e8 76 f4 ff ff       	call   8010036e <panic>
+    }
+    return i == n ? n : -1;
+80100ef8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+80100efb:	74 0d                	je     80100f0a <filewrite+0xd0>
+80100efd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  panic("filewrite");
+}
+80100f02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f05:	5b                   	pop    %ebx
+80100f06:	5e                   	pop    %esi
+80100f07:	5f                   	pop    %edi
+80100f08:	5d                   	pop    %ebp
+80100f09:	c3                   	ret
+    return i == n ? n : -1;
+80100f0a:	8b 45 10             	mov    0x10(%ebp),%eax
+80100f0d:	eb f3                	jmp    80100f02 <filewrite+0xc8>
+  panic("filewrite");
+80100f0f:	83 ec 0c             	sub    $0xc,%esp
+80100f12:	68 55 86 10 80       	push   $0x80108655
+80100f17:	e8 52 f4 ff ff       	call   8010036e <panic>
+    return -1;
+80100f1c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100f21:	eb df                	jmp    80100f02 <filewrite+0xc8>
+
+80100f23 <skipelem>:
+//   skipelem("a", name) = "", setting name = "a"
+//   skipelem("", name) = skipelem("////", name) = 0
+//
+static char*
+skipelem(char *path, char *name)
+{
+80100f23:	55                   	push   %ebp
+80100f24:	89 e5                	mov    %esp,%ebp
+80100f26:	57                   	push   %edi
+80100f27:	56                   	push   %esi
+80100f28:	53                   	push   %ebx
+80100f29:	83 ec 0c             	sub    $0xc,%esp
+80100f2c:	89 d6                	mov    %edx,%esi
+  char *s;
+  int len;
+
+  while(*path == '/')
+80100f2e:	eb 03                	jmp    80100f33 <skipelem+0x10>
+    path++;
+80100f30:	83 c0 01             	add    $0x1,%eax
+  while(*path == '/')
+80100f33:	0f b6 10             	movzbl (%eax),%edx
+80100f36:	80 fa 2f             	cmp    $0x2f,%dl
+80100f39:	74 f5                	je     80100f30 <skipelem+0xd>
+  if(*path == 0)
+80100f3b:	84 d2                	test   %dl,%dl
+80100f3d:	74 53                	je     80100f92 <skipelem+0x6f>
+80100f3f:	89 c3                	mov    %eax,%ebx
+80100f41:	eb 03                	jmp    80100f46 <skipelem+0x23>
+    return 0;
+  s = path;
+  while(*path != '/' && *path != 0)
+    path++;
+80100f43:	83 c3 01             	add    $0x1,%ebx
+  while(*path != '/' && *path != 0)
+80100f46:	0f b6 13             	movzbl (%ebx),%edx
+80100f49:	80 fa 2f             	cmp    $0x2f,%dl
+80100f4c:	74 04                	je     80100f52 <skipelem+0x2f>
+80100f4e:	84 d2                	test   %dl,%dl
+80100f50:	75 f1                	jne    80100f43 <skipelem+0x20>
+  len = path - s;
+80100f52:	89 df                	mov    %ebx,%edi
+80100f54:	29 c7                	sub    %eax,%edi
+  if(len >= DIRSIZ)
+80100f56:	83 ff 0d             	cmp    $0xd,%edi
+80100f59:	7e 11                	jle    80100f6c <skipelem+0x49>
+    memmove(name, s, DIRSIZ);
+80100f5b:	83 ec 04             	sub    $0x4,%esp
+80100f5e:	6a 0e                	push   $0xe
+80100f60:	50                   	push   %eax
+80100f61:	56                   	push   %esi
+80100f62:	e8 72 48 00 00       	call   801057d9 <memmove>
+80100f67:	83 c4 10             	add    $0x10,%esp
+80100f6a:	eb 17                	jmp    80100f83 <skipelem+0x60>
+  else {
+    memmove(name, s, len);
+80100f6c:	83 ec 04             	sub    $0x4,%esp
+80100f6f:	57                   	push   %edi
+80100f70:	50                   	push   %eax
+80100f71:	56                   	push   %esi
+80100f72:	e8 62 48 00 00       	call   801057d9 <memmove>
+    name[len] = 0;
+80100f77:	c6 04 3e 00          	movb   $0x0,(%esi,%edi,1)
+80100f7b:	83 c4 10             	add    $0x10,%esp
+80100f7e:	eb 03                	jmp    80100f83 <skipelem+0x60>
+  }
+  while(*path == '/')
+    path++;
+80100f80:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80100f83:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80100f86:	74 f8                	je     80100f80 <skipelem+0x5d>
+  return path;
+}
+80100f88:	89 d8                	mov    %ebx,%eax
+80100f8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f8d:	5b                   	pop    %ebx
+80100f8e:	5e                   	pop    %esi
+80100f8f:	5f                   	pop    %edi
+80100f90:	5d                   	pop    %ebp
+80100f91:	c3                   	ret
+    return 0;
+80100f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100f97:	eb ef                	jmp    80100f88 <skipelem+0x65>
+
+80100f99 <bzero>:
+{
+80100f99:	55                   	push   %ebp
+80100f9a:	89 e5                	mov    %esp,%ebp
+80100f9c:	53                   	push   %ebx
+80100f9d:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, bno);
+80100fa0:	52                   	push   %edx
+80100fa1:	50                   	push   %eax
+80100fa2:	e8 e8 f1 ff ff       	call   8010018f <bread>
+80100fa7:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+80100fa9:	8d 40 5c             	lea    0x5c(%eax),%eax
+80100fac:	83 c4 0c             	add    $0xc,%esp
+80100faf:	68 00 02 00 00       	push   $0x200
+80100fb4:	6a 00                	push   $0x0
+80100fb6:	50                   	push   %eax
+80100fb7:	e8 a5 47 00 00       	call   80105761 <memset>
+  log_write(bp);
+80100fbc:	89 1c 24             	mov    %ebx,(%esp)
+80100fbf:	e8 60 19 00 00       	call   80102924 <log_write>
+  brelse(bp);
+80100fc4:	89 1c 24             	mov    %ebx,(%esp)
+80100fc7:	e8 30 f2 ff ff       	call   801001fc <brelse>
+}
+80100fcc:	83 c4 10             	add    $0x10,%esp
+80100fcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100fd2:	c9                   	leave
+80100fd3:	c3                   	ret
+
+80100fd4 <bfree>:
+{
+80100fd4:	55                   	push   %ebp
+80100fd5:	89 e5                	mov    %esp,%ebp
+80100fd7:	56                   	push   %esi
+80100fd8:	53                   	push   %ebx
+80100fd9:	89 c3                	mov    %eax,%ebx
+80100fdb:	89 d6                	mov    %edx,%esi
+  bp = bread(dev, BBLOCK(b, sb));
+80100fdd:	89 d0                	mov    %edx,%eax
+80100fdf:	c1 e8 0c             	shr    $0xc,%eax
+80100fe2:	83 ec 08             	sub    $0x8,%esp
+80100fe5:	03 05 2c 36 11 80    	add    0x8011362c,%eax
+80100feb:	50                   	push   %eax
+80100fec:	53                   	push   %ebx
+80100fed:	e8 9d f1 ff ff       	call   8010018f <bread>
+80100ff2:	89 c3                	mov    %eax,%ebx
+  bi = b % BPB;
+80100ff4:	89 f2                	mov    %esi,%edx
+80100ff6:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  m = 1 << (bi % 8);
+80100ffc:	89 f1                	mov    %esi,%ecx
+80100ffe:	83 e1 07             	and    $0x7,%ecx
+80101001:	b8 01 00 00 00       	mov    $0x1,%eax
+80101006:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101008:	83 c4 10             	add    $0x10,%esp
+8010100b:	c1 fa 03             	sar    $0x3,%edx
+8010100e:	0f b6 4c 13 5c       	movzbl 0x5c(%ebx,%edx,1),%ecx
+80101013:	0f b6 f1             	movzbl %cl,%esi
+80101016:	85 c6                	test   %eax,%esi
+80101018:	74 23                	je     8010103d <bfree+0x69>
+  bp->data[bi/8] &= ~m;
+8010101a:	f7 d0                	not    %eax
+8010101c:	21 c8                	and    %ecx,%eax
+8010101e:	88 44 13 5c          	mov    %al,0x5c(%ebx,%edx,1)
+  log_write(bp);
+80101022:	83 ec 0c             	sub    $0xc,%esp
+80101025:	53                   	push   %ebx
+80101026:	e8 f9 18 00 00       	call   80102924 <log_write>
+  brelse(bp);
+8010102b:	89 1c 24             	mov    %ebx,(%esp)
+8010102e:	e8 c9 f1 ff ff       	call   801001fc <brelse>
+}
+80101033:	83 c4 10             	add    $0x10,%esp
+80101036:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101039:	5b                   	pop    %ebx
+8010103a:	5e                   	pop    %esi
+8010103b:	5d                   	pop    %ebp
+8010103c:	c3                   	ret
+    panic("freeing free block");
+8010103d:	83 ec 0c             	sub    $0xc,%esp
+80101040:	68 5f 86 10 80       	push   $0x8010865f
+80101045:	e8 24 f3 ff ff       	call   8010036e <panic>
+
+8010104a <balloc>:
+{
+8010104a:	55                   	push   %ebp
+8010104b:	89 e5                	mov    %esp,%ebp
+8010104d:	57                   	push   %edi
+8010104e:	56                   	push   %esi
+8010104f:	53                   	push   %ebx
+80101050:	83 ec 1c             	sub    $0x1c,%esp
+80101053:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+80101056:	be 00 00 00 00       	mov    $0x0,%esi
+8010105b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010105e:	eb 15                	jmp    80101075 <balloc+0x2b>
+    brelse(bp);
+80101060:	83 ec 0c             	sub    $0xc,%esp
+80101063:	ff 75 e0             	push   -0x20(%ebp)
+80101066:	e8 91 f1 ff ff       	call   801001fc <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+8010106b:	81 45 e4 00 10 00 00 	addl   $0x1000,-0x1c(%ebp)
+80101072:	83 c4 10             	add    $0x10,%esp
+80101075:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101078:	3b 05 14 36 11 80    	cmp    0x80113614,%eax
+8010107e:	73 6e                	jae    801010ee <balloc+0xa4>
+    bp = bread(dev, BBLOCK(b, sb));
+80101080:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101083:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+80101089:	85 db                	test   %ebx,%ebx
+8010108b:	0f 49 c3             	cmovns %ebx,%eax
+8010108e:	c1 f8 0c             	sar    $0xc,%eax
+80101091:	83 ec 08             	sub    $0x8,%esp
+80101094:	03 05 2c 36 11 80    	add    0x8011362c,%eax
+8010109a:	50                   	push   %eax
+8010109b:	ff 75 dc             	push   -0x24(%ebp)
+8010109e:	e8 ec f0 ff ff       	call   8010018f <bread>
+801010a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+801010a6:	83 c4 10             	add    $0x10,%esp
+801010a9:	b8 00 00 00 00       	mov    $0x0,%eax
+801010ae:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+801010b3:	7f ab                	jg     80101060 <balloc+0x16>
+801010b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801010b8:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+801010bb:	3b 1d 14 36 11 80    	cmp    0x80113614,%ebx
+801010c1:	73 9d                	jae    80101060 <balloc+0x16>
+      m = 1 << (bi % 8);
+801010c3:	89 c1                	mov    %eax,%ecx
+801010c5:	83 e1 07             	and    $0x7,%ecx
+801010c8:	be 01 00 00 00       	mov    $0x1,%esi
+801010cd:	d3 e6                	shl    %cl,%esi
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+801010cf:	8d 50 07             	lea    0x7(%eax),%edx
+801010d2:	85 c0                	test   %eax,%eax
+801010d4:	0f 49 d0             	cmovns %eax,%edx
+801010d7:	c1 fa 03             	sar    $0x3,%edx
+801010da:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801010dd:	0f b6 4c 17 5c       	movzbl 0x5c(%edi,%edx,1),%ecx
+801010e2:	0f b6 f9             	movzbl %cl,%edi
+801010e5:	85 f7                	test   %esi,%edi
+801010e7:	74 12                	je     801010fb <balloc+0xb1>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+801010e9:	83 c0 01             	add    $0x1,%eax
+801010ec:	eb c0                	jmp    801010ae <balloc+0x64>
+  panic("balloc: out of blocks");
+801010ee:	83 ec 0c             	sub    $0xc,%esp
+801010f1:	68 72 86 10 80       	push   $0x80108672
+801010f6:	e8 73 f2 ff ff       	call   8010036e <panic>
+        bp->data[bi/8] |= m;  // Mark block in use.
+801010fb:	89 c8                	mov    %ecx,%eax
+801010fd:	89 f1                	mov    %esi,%ecx
+801010ff:	09 c1                	or     %eax,%ecx
+80101101:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101104:	88 4c 16 5c          	mov    %cl,0x5c(%esi,%edx,1)
+        log_write(bp);
+80101108:	83 ec 0c             	sub    $0xc,%esp
+8010110b:	56                   	push   %esi
+8010110c:	e8 13 18 00 00       	call   80102924 <log_write>
+        brelse(bp);
+80101111:	89 34 24             	mov    %esi,(%esp)
+80101114:	e8 e3 f0 ff ff       	call   801001fc <brelse>
+        bzero(dev, b + bi);
+80101119:	89 da                	mov    %ebx,%edx
+8010111b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010111e:	e8 76 fe ff ff       	call   80100f99 <bzero>
+}
+80101123:	89 d8                	mov    %ebx,%eax
+80101125:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101128:	5b                   	pop    %ebx
+80101129:	5e                   	pop    %esi
+8010112a:	5f                   	pop    %edi
+8010112b:	5d                   	pop    %ebp
+8010112c:	c3                   	ret
+
+8010112d <bmap>:
+{
+8010112d:	55                   	push   %ebp
+8010112e:	89 e5                	mov    %esp,%ebp
+80101130:	57                   	push   %edi
+80101131:	56                   	push   %esi
+80101132:	53                   	push   %ebx
+80101133:	83 ec 1c             	sub    $0x1c,%esp
+80101136:	89 c3                	mov    %eax,%ebx
+80101138:	89 d7                	mov    %edx,%edi
+  if(bn < NDIRECT){
+8010113a:	83 fa 0b             	cmp    $0xb,%edx
+8010113d:	76 45                	jbe    80101184 <bmap+0x57>
+  bn -= NDIRECT;
+8010113f:	8d 72 f4             	lea    -0xc(%edx),%esi
+  if(bn < NINDIRECT){
+80101142:	83 fe 7f             	cmp    $0x7f,%esi
+80101145:	77 7f                	ja     801011c6 <bmap+0x99>
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101147:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+8010114d:	85 c0                	test   %eax,%eax
+8010114f:	74 4a                	je     8010119b <bmap+0x6e>
+    bp = bread(ip->dev, addr);
+80101151:	83 ec 08             	sub    $0x8,%esp
+80101154:	50                   	push   %eax
+80101155:	ff 33                	push   (%ebx)
+80101157:	e8 33 f0 ff ff       	call   8010018f <bread>
+8010115c:	89 c7                	mov    %eax,%edi
+    if((addr = a[bn]) == 0){
+8010115e:	8d 44 b0 5c          	lea    0x5c(%eax,%esi,4),%eax
+80101162:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101165:	8b 30                	mov    (%eax),%esi
+80101167:	83 c4 10             	add    $0x10,%esp
+8010116a:	85 f6                	test   %esi,%esi
+8010116c:	74 3c                	je     801011aa <bmap+0x7d>
+    brelse(bp);
+8010116e:	83 ec 0c             	sub    $0xc,%esp
+80101171:	57                   	push   %edi
+80101172:	e8 85 f0 ff ff       	call   801001fc <brelse>
+    return addr;
+80101177:	83 c4 10             	add    $0x10,%esp
+}
+8010117a:	89 f0                	mov    %esi,%eax
+8010117c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010117f:	5b                   	pop    %ebx
+80101180:	5e                   	pop    %esi
+80101181:	5f                   	pop    %edi
+80101182:	5d                   	pop    %ebp
+80101183:	c3                   	ret
+    if((addr = ip->addrs[bn]) == 0)
+80101184:	8b 74 90 5c          	mov    0x5c(%eax,%edx,4),%esi
+80101188:	85 f6                	test   %esi,%esi
+8010118a:	75 ee                	jne    8010117a <bmap+0x4d>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+8010118c:	8b 00                	mov    (%eax),%eax
+8010118e:	e8 b7 fe ff ff       	call   8010104a <balloc>
+80101193:	89 c6                	mov    %eax,%esi
+80101195:	89 44 bb 5c          	mov    %eax,0x5c(%ebx,%edi,4)
+    return addr;
+80101199:	eb df                	jmp    8010117a <bmap+0x4d>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+8010119b:	8b 03                	mov    (%ebx),%eax
+8010119d:	e8 a8 fe ff ff       	call   8010104a <balloc>
+801011a2:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+801011a8:	eb a7                	jmp    80101151 <bmap+0x24>
+      a[bn] = addr = balloc(ip->dev);
+801011aa:	8b 03                	mov    (%ebx),%eax
+801011ac:	e8 99 fe ff ff       	call   8010104a <balloc>
+801011b1:	89 c6                	mov    %eax,%esi
+801011b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801011b6:	89 30                	mov    %esi,(%eax)
+      log_write(bp);
+801011b8:	83 ec 0c             	sub    $0xc,%esp
+801011bb:	57                   	push   %edi
+801011bc:	e8 63 17 00 00       	call   80102924 <log_write>
+801011c1:	83 c4 10             	add    $0x10,%esp
+801011c4:	eb a8                	jmp    8010116e <bmap+0x41>
+  panic("bmap: out of range");
+801011c6:	83 ec 0c             	sub    $0xc,%esp
+801011c9:	68 88 86 10 80       	push   $0x80108688
+801011ce:	e8 9b f1 ff ff       	call   8010036e <panic>
+
+801011d3 <iget>:
+{
+801011d3:	55                   	push   %ebp
+801011d4:	89 e5                	mov    %esp,%ebp
+801011d6:	57                   	push   %edi
+801011d7:	56                   	push   %esi
+801011d8:	53                   	push   %ebx
+801011d9:	83 ec 28             	sub    $0x28,%esp
+801011dc:	89 c7                	mov    %eax,%edi
+801011de:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(&icache.lock);
+801011e1:	68 c0 19 11 80       	push   $0x801119c0
+801011e6:	e8 ca 44 00 00       	call   801056b5 <acquire>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801011eb:	83 c4 10             	add    $0x10,%esp
+  empty = 0;
+801011ee:	be 00 00 00 00       	mov    $0x0,%esi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801011f3:	bb f4 19 11 80       	mov    $0x801119f4,%ebx
+801011f8:	eb 0a                	jmp    80101204 <iget+0x31>
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+801011fa:	85 f6                	test   %esi,%esi
+801011fc:	74 3b                	je     80101239 <iget+0x66>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801011fe:	81 c3 90 00 00 00    	add    $0x90,%ebx
+80101204:	81 fb 14 36 11 80    	cmp    $0x80113614,%ebx
+8010120a:	73 35                	jae    80101241 <iget+0x6e>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+8010120c:	8b 43 08             	mov    0x8(%ebx),%eax
+8010120f:	85 c0                	test   %eax,%eax
+80101211:	7e e7                	jle    801011fa <iget+0x27>
+80101213:	39 3b                	cmp    %edi,(%ebx)
+80101215:	75 e3                	jne    801011fa <iget+0x27>
+80101217:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010121a:	39 4b 04             	cmp    %ecx,0x4(%ebx)
+8010121d:	75 db                	jne    801011fa <iget+0x27>
+      ip->ref++;
+8010121f:	83 c0 01             	add    $0x1,%eax
+80101222:	89 43 08             	mov    %eax,0x8(%ebx)
+      release(&icache.lock);
+80101225:	83 ec 0c             	sub    $0xc,%esp
+80101228:	68 c0 19 11 80       	push   $0x801119c0
+8010122d:	e8 e8 44 00 00       	call   8010571a <release>
+      return ip;
+80101232:	83 c4 10             	add    $0x10,%esp
+80101235:	89 de                	mov    %ebx,%esi
+80101237:	eb 32                	jmp    8010126b <iget+0x98>
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+80101239:	85 c0                	test   %eax,%eax
+8010123b:	75 c1                	jne    801011fe <iget+0x2b>
+      empty = ip;
+8010123d:	89 de                	mov    %ebx,%esi
+8010123f:	eb bd                	jmp    801011fe <iget+0x2b>
+  if(empty == 0)
+80101241:	85 f6                	test   %esi,%esi
+80101243:	74 30                	je     80101275 <iget+0xa2>
+  ip->dev = dev;
+80101245:	89 3e                	mov    %edi,(%esi)
+  ip->inum = inum;
+80101247:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010124a:	89 46 04             	mov    %eax,0x4(%esi)
+  ip->ref = 1;
+8010124d:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+  ip->valid = 0;
+80101254:	c7 46 4c 00 00 00 00 	movl   $0x0,0x4c(%esi)
+  release(&icache.lock);
+8010125b:	83 ec 0c             	sub    $0xc,%esp
+8010125e:	68 c0 19 11 80       	push   $0x801119c0
+80101263:	e8 b2 44 00 00       	call   8010571a <release>
+  return ip;
+80101268:	83 c4 10             	add    $0x10,%esp
+}
+8010126b:	89 f0                	mov    %esi,%eax
+8010126d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101270:	5b                   	pop    %ebx
+80101271:	5e                   	pop    %esi
+80101272:	5f                   	pop    %edi
+80101273:	5d                   	pop    %ebp
+80101274:	c3                   	ret
+    panic("iget: no inodes");
+80101275:	83 ec 0c             	sub    $0xc,%esp
+80101278:	68 9b 86 10 80       	push   $0x8010869b
+8010127d:	e8 ec f0 ff ff       	call   8010036e <panic>
+
+80101282 <readsb>:
+{
+80101282:	55                   	push   %ebp
+80101283:	89 e5                	mov    %esp,%ebp
+80101285:	53                   	push   %ebx
+80101286:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, 1);
+80101289:	6a 01                	push   $0x1
+8010128b:	ff 75 08             	push   0x8(%ebp)
+8010128e:	e8 fc ee ff ff       	call   8010018f <bread>
+80101293:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101295:	8d 40 5c             	lea    0x5c(%eax),%eax
+80101298:	83 c4 0c             	add    $0xc,%esp
+8010129b:	6a 1c                	push   $0x1c
+8010129d:	50                   	push   %eax
+8010129e:	ff 75 0c             	push   0xc(%ebp)
+801012a1:	e8 33 45 00 00       	call   801057d9 <memmove>
+  brelse(bp);
+801012a6:	89 1c 24             	mov    %ebx,(%esp)
+801012a9:	e8 4e ef ff ff       	call   801001fc <brelse>
+}
+801012ae:	83 c4 10             	add    $0x10,%esp
+801012b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801012b4:	c9                   	leave
+801012b5:	c3                   	ret
+
+801012b6 <iinit>:
+{
+801012b6:	55                   	push   %ebp
+801012b7:	89 e5                	mov    %esp,%ebp
+801012b9:	53                   	push   %ebx
+801012ba:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&icache.lock, "icache");
+801012bd:	68 ab 86 10 80       	push   $0x801086ab
+801012c2:	68 c0 19 11 80       	push   $0x801119c0
+801012c7:	e8 a5 42 00 00       	call   80105571 <initlock>
+  for(i = 0; i < NINODE; i++) {
+801012cc:	83 c4 10             	add    $0x10,%esp
+801012cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+801012d4:	eb 21                	jmp    801012f7 <iinit+0x41>
+    initsleeplock(&icache.inode[i].lock, "inode");
+801012d6:	83 ec 08             	sub    $0x8,%esp
+801012d9:	68 b2 86 10 80       	push   $0x801086b2
+801012de:	8d 14 db             	lea    (%ebx,%ebx,8),%edx
+801012e1:	89 d0                	mov    %edx,%eax
+801012e3:	c1 e0 04             	shl    $0x4,%eax
+801012e6:	05 00 1a 11 80       	add    $0x80111a00,%eax
+801012eb:	50                   	push   %eax
+801012ec:	e8 4d 41 00 00       	call   8010543e <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+801012f1:	83 c3 01             	add    $0x1,%ebx
+801012f4:	83 c4 10             	add    $0x10,%esp
+801012f7:	83 fb 31             	cmp    $0x31,%ebx
+801012fa:	7e da                	jle    801012d6 <iinit+0x20>
+  readsb(dev, &sb);
+801012fc:	83 ec 08             	sub    $0x8,%esp
+801012ff:	68 14 36 11 80       	push   $0x80113614
+80101304:	ff 75 08             	push   0x8(%ebp)
+80101307:	e8 76 ff ff ff       	call   80101282 <readsb>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+8010130c:	ff 35 2c 36 11 80    	push   0x8011362c
+80101312:	ff 35 28 36 11 80    	push   0x80113628
+80101318:	ff 35 24 36 11 80    	push   0x80113624
+8010131e:	ff 35 20 36 11 80    	push   0x80113620
+80101324:	ff 35 1c 36 11 80    	push   0x8011361c
+8010132a:	ff 35 18 36 11 80    	push   0x80113618
+80101330:	ff 35 14 36 11 80    	push   0x80113614
+80101336:	68 18 87 10 80       	push   $0x80108718
+8010133b:	e8 ef f2 ff ff       	call   8010062f <cprintf>
+}
+80101340:	83 c4 30             	add    $0x30,%esp
+80101343:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101346:	c9                   	leave
+80101347:	c3                   	ret
+
+80101348 <ialloc>:
+{
+80101348:	55                   	push   %ebp
+80101349:	89 e5                	mov    %esp,%ebp
+8010134b:	57                   	push   %edi
+8010134c:	56                   	push   %esi
+8010134d:	53                   	push   %ebx
+8010134e:	83 ec 1c             	sub    $0x1c,%esp
+80101351:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101354:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101357:	bb 01 00 00 00       	mov    $0x1,%ebx
+8010135c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010135f:	3b 1d 1c 36 11 80    	cmp    0x8011361c,%ebx
+80101365:	73 3f                	jae    801013a6 <ialloc+0x5e>
+    bp = bread(dev, IBLOCK(inum, sb));
+80101367:	89 d8                	mov    %ebx,%eax
+80101369:	c1 e8 03             	shr    $0x3,%eax
+8010136c:	83 ec 08             	sub    $0x8,%esp
+8010136f:	03 05 28 36 11 80    	add    0x80113628,%eax
+80101375:	50                   	push   %eax
+80101376:	ff 75 08             	push   0x8(%ebp)
+80101379:	e8 11 ee ff ff       	call   8010018f <bread>
+8010137e:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + inum%IPB;
+80101380:	89 d8                	mov    %ebx,%eax
+80101382:	83 e0 07             	and    $0x7,%eax
+80101385:	c1 e0 06             	shl    $0x6,%eax
+80101388:	8d 7c 06 5c          	lea    0x5c(%esi,%eax,1),%edi
+    if(dip->type == 0){  // a free inode
+8010138c:	83 c4 10             	add    $0x10,%esp
+8010138f:	66 83 3f 00          	cmpw   $0x0,(%edi)
+80101393:	74 1e                	je     801013b3 <ialloc+0x6b>
+    brelse(bp);
+80101395:	83 ec 0c             	sub    $0xc,%esp
+80101398:	56                   	push   %esi
+80101399:	e8 5e ee ff ff       	call   801001fc <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+8010139e:	83 c3 01             	add    $0x1,%ebx
+801013a1:	83 c4 10             	add    $0x10,%esp
+801013a4:	eb b6                	jmp    8010135c <ialloc+0x14>
+  panic("ialloc: no inodes");
+801013a6:	83 ec 0c             	sub    $0xc,%esp
+801013a9:	68 b8 86 10 80       	push   $0x801086b8
+801013ae:	e8 bb ef ff ff       	call   8010036e <panic>
+      memset(dip, 0, sizeof(*dip));
+801013b3:	83 ec 04             	sub    $0x4,%esp
+801013b6:	6a 40                	push   $0x40
+801013b8:	6a 00                	push   $0x0
+801013ba:	57                   	push   %edi
+801013bb:	e8 a1 43 00 00       	call   80105761 <memset>
+      dip->type = type;
+801013c0:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+801013c4:	66 89 07             	mov    %ax,(%edi)
+      log_write(bp);   // mark it allocated on the disk
+801013c7:	89 34 24             	mov    %esi,(%esp)
+801013ca:	e8 55 15 00 00       	call   80102924 <log_write>
+      brelse(bp);
+801013cf:	89 34 24             	mov    %esi,(%esp)
+801013d2:	e8 25 ee ff ff       	call   801001fc <brelse>
+      return iget(dev, inum);
+801013d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801013da:	8b 45 08             	mov    0x8(%ebp),%eax
+801013dd:	e8 f1 fd ff ff       	call   801011d3 <iget>
+}
+801013e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801013e5:	5b                   	pop    %ebx
+801013e6:	5e                   	pop    %esi
+801013e7:	5f                   	pop    %edi
+801013e8:	5d                   	pop    %ebp
+801013e9:	c3                   	ret
+
+801013ea <iupdate>:
+{
+801013ea:	55                   	push   %ebp
+801013eb:	89 e5                	mov    %esp,%ebp
+801013ed:	56                   	push   %esi
+801013ee:	53                   	push   %ebx
+801013ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801013f2:	8b 43 04             	mov    0x4(%ebx),%eax
+801013f5:	c1 e8 03             	shr    $0x3,%eax
+801013f8:	83 ec 08             	sub    $0x8,%esp
+801013fb:	03 05 28 36 11 80    	add    0x80113628,%eax
+80101401:	50                   	push   %eax
+80101402:	ff 33                	push   (%ebx)
+80101404:	e8 86 ed ff ff       	call   8010018f <bread>
+80101409:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+8010140b:	8b 43 04             	mov    0x4(%ebx),%eax
+8010140e:	83 e0 07             	and    $0x7,%eax
+80101411:	c1 e0 06             	shl    $0x6,%eax
+80101414:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+  dip->type = ip->type;
+80101418:	0f b7 53 50          	movzwl 0x50(%ebx),%edx
+8010141c:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+8010141f:	0f b7 53 52          	movzwl 0x52(%ebx),%edx
+80101423:	66 89 50 02          	mov    %dx,0x2(%eax)
+  dip->minor = ip->minor;
+80101427:	0f b7 53 54          	movzwl 0x54(%ebx),%edx
+8010142b:	66 89 50 04          	mov    %dx,0x4(%eax)
+  dip->nlink = ip->nlink;
+8010142f:	0f b7 53 56          	movzwl 0x56(%ebx),%edx
+80101433:	66 89 50 06          	mov    %dx,0x6(%eax)
+  dip->size = ip->size;
+80101437:	8b 53 58             	mov    0x58(%ebx),%edx
+8010143a:	89 50 08             	mov    %edx,0x8(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+8010143d:	83 c3 5c             	add    $0x5c,%ebx
+80101440:	83 c0 0c             	add    $0xc,%eax
+80101443:	83 c4 0c             	add    $0xc,%esp
+80101446:	6a 34                	push   $0x34
+80101448:	53                   	push   %ebx
+80101449:	50                   	push   %eax
+8010144a:	e8 8a 43 00 00       	call   801057d9 <memmove>
+  log_write(bp);
+8010144f:	89 34 24             	mov    %esi,(%esp)
+80101452:	e8 cd 14 00 00       	call   80102924 <log_write>
+  brelse(bp);
+80101457:	89 34 24             	mov    %esi,(%esp)
+8010145a:	e8 9d ed ff ff       	call   801001fc <brelse>
+}
+8010145f:	83 c4 10             	add    $0x10,%esp
+80101462:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101465:	5b                   	pop    %ebx
+80101466:	5e                   	pop    %esi
+80101467:	5d                   	pop    %ebp
+80101468:	c3                   	ret
+
+80101469 <itrunc>:
+{
+80101469:	55                   	push   %ebp
+8010146a:	89 e5                	mov    %esp,%ebp
+8010146c:	57                   	push   %edi
+8010146d:	56                   	push   %esi
+8010146e:	53                   	push   %ebx
+8010146f:	83 ec 1c             	sub    $0x1c,%esp
+80101472:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NDIRECT; i++){
+80101474:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101479:	eb 03                	jmp    8010147e <itrunc+0x15>
+8010147b:	83 c3 01             	add    $0x1,%ebx
+8010147e:	83 fb 0b             	cmp    $0xb,%ebx
+80101481:	7f 19                	jg     8010149c <itrunc+0x33>
+    if(ip->addrs[i]){
+80101483:	8b 54 9e 5c          	mov    0x5c(%esi,%ebx,4),%edx
+80101487:	85 d2                	test   %edx,%edx
+80101489:	74 f0                	je     8010147b <itrunc+0x12>
+      bfree(ip->dev, ip->addrs[i]);
+8010148b:	8b 06                	mov    (%esi),%eax
+8010148d:	e8 42 fb ff ff       	call   80100fd4 <bfree>
+      ip->addrs[i] = 0;
+80101492:	c7 44 9e 5c 00 00 00 	movl   $0x0,0x5c(%esi,%ebx,4)
+80101499:	00 
+8010149a:	eb df                	jmp    8010147b <itrunc+0x12>
+  if(ip->addrs[NDIRECT]){
+8010149c:	8b 86 8c 00 00 00    	mov    0x8c(%esi),%eax
+801014a2:	85 c0                	test   %eax,%eax
+801014a4:	75 1b                	jne    801014c1 <itrunc+0x58>
+  ip->size = 0;
+801014a6:	c7 46 58 00 00 00 00 	movl   $0x0,0x58(%esi)
+  iupdate(ip);
+801014ad:	83 ec 0c             	sub    $0xc,%esp
+801014b0:	56                   	push   %esi
+801014b1:	e8 34 ff ff ff       	call   801013ea <iupdate>
+}
+801014b6:	83 c4 10             	add    $0x10,%esp
+801014b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014bc:	5b                   	pop    %ebx
+801014bd:	5e                   	pop    %esi
+801014be:	5f                   	pop    %edi
+801014bf:	5d                   	pop    %ebp
+801014c0:	c3                   	ret
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+801014c1:	83 ec 08             	sub    $0x8,%esp
+801014c4:	50                   	push   %eax
+801014c5:	ff 36                	push   (%esi)
+801014c7:	e8 c3 ec ff ff       	call   8010018f <bread>
+801014cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    a = (uint*)bp->data;
+801014cf:	8d 78 5c             	lea    0x5c(%eax),%edi
+    for(j = 0; j < NINDIRECT; j++){
+801014d2:	83 c4 10             	add    $0x10,%esp
+801014d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+801014da:	eb 03                	jmp    801014df <itrunc+0x76>
+801014dc:	83 c3 01             	add    $0x1,%ebx
+801014df:	83 fb 7f             	cmp    $0x7f,%ebx
+801014e2:	77 10                	ja     801014f4 <itrunc+0x8b>
+      if(a[j])
+801014e4:	8b 14 9f             	mov    (%edi,%ebx,4),%edx
+801014e7:	85 d2                	test   %edx,%edx
+801014e9:	74 f1                	je     801014dc <itrunc+0x73>
+        bfree(ip->dev, a[j]);
+801014eb:	8b 06                	mov    (%esi),%eax
+801014ed:	e8 e2 fa ff ff       	call   80100fd4 <bfree>
+801014f2:	eb e8                	jmp    801014dc <itrunc+0x73>
+    brelse(bp);
+801014f4:	83 ec 0c             	sub    $0xc,%esp
+801014f7:	ff 75 e4             	push   -0x1c(%ebp)
+801014fa:	e8 fd ec ff ff       	call   801001fc <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+801014ff:	8b 06                	mov    (%esi),%eax
+80101501:	8b 96 8c 00 00 00    	mov    0x8c(%esi),%edx
+80101507:	e8 c8 fa ff ff       	call   80100fd4 <bfree>
+    ip->addrs[NDIRECT] = 0;
+8010150c:	c7 86 8c 00 00 00 00 	movl   $0x0,0x8c(%esi)
+80101513:	00 00 00 
+80101516:	83 c4 10             	add    $0x10,%esp
+80101519:	eb 8b                	jmp    801014a6 <itrunc+0x3d>
+
+8010151b <idup>:
+{
+8010151b:	55                   	push   %ebp
+8010151c:	89 e5                	mov    %esp,%ebp
+8010151e:	53                   	push   %ebx
+8010151f:	83 ec 10             	sub    $0x10,%esp
+80101522:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+80101525:	68 c0 19 11 80       	push   $0x801119c0
+8010152a:	e8 86 41 00 00       	call   801056b5 <acquire>
+  ip->ref++;
+8010152f:	8b 43 08             	mov    0x8(%ebx),%eax
+80101532:	83 c0 01             	add    $0x1,%eax
+80101535:	89 43 08             	mov    %eax,0x8(%ebx)
+  release(&icache.lock);
+80101538:	c7 04 24 c0 19 11 80 	movl   $0x801119c0,(%esp)
+8010153f:	e8 d6 41 00 00       	call   8010571a <release>
+}
+80101544:	89 d8                	mov    %ebx,%eax
+80101546:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101549:	c9                   	leave
+8010154a:	c3                   	ret
+
+8010154b <ilock>:
+{
+8010154b:	55                   	push   %ebp
+8010154c:	89 e5                	mov    %esp,%ebp
+8010154e:	56                   	push   %esi
+8010154f:	53                   	push   %ebx
+80101550:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80101553:	85 db                	test   %ebx,%ebx
+80101555:	74 22                	je     80101579 <ilock+0x2e>
+80101557:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+8010155b:	7e 1c                	jle    80101579 <ilock+0x2e>
+  acquiresleep(&ip->lock);
+8010155d:	83 ec 0c             	sub    $0xc,%esp
+80101560:	8d 43 0c             	lea    0xc(%ebx),%eax
+80101563:	50                   	push   %eax
+80101564:	e8 08 3f 00 00       	call   80105471 <acquiresleep>
+  if(ip->valid == 0){
+80101569:	83 c4 10             	add    $0x10,%esp
+8010156c:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+80101570:	74 14                	je     80101586 <ilock+0x3b>
+}
+80101572:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101575:	5b                   	pop    %ebx
+80101576:	5e                   	pop    %esi
+80101577:	5d                   	pop    %ebp
+80101578:	c3                   	ret
+    panic("ilock");
+80101579:	83 ec 0c             	sub    $0xc,%esp
+8010157c:	68 ca 86 10 80       	push   $0x801086ca
+80101581:	e8 e8 ed ff ff       	call   8010036e <panic>
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101586:	8b 43 04             	mov    0x4(%ebx),%eax
+80101589:	c1 e8 03             	shr    $0x3,%eax
+8010158c:	83 ec 08             	sub    $0x8,%esp
+8010158f:	03 05 28 36 11 80    	add    0x80113628,%eax
+80101595:	50                   	push   %eax
+80101596:	ff 33                	push   (%ebx)
+80101598:	e8 f2 eb ff ff       	call   8010018f <bread>
+8010159d:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+8010159f:	8b 43 04             	mov    0x4(%ebx),%eax
+801015a2:	83 e0 07             	and    $0x7,%eax
+801015a5:	c1 e0 06             	shl    $0x6,%eax
+801015a8:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+    ip->type = dip->type;
+801015ac:	0f b7 10             	movzwl (%eax),%edx
+801015af:	66 89 53 50          	mov    %dx,0x50(%ebx)
+    ip->major = dip->major;
+801015b3:	0f b7 50 02          	movzwl 0x2(%eax),%edx
+801015b7:	66 89 53 52          	mov    %dx,0x52(%ebx)
+    ip->minor = dip->minor;
+801015bb:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+801015bf:	66 89 53 54          	mov    %dx,0x54(%ebx)
+    ip->nlink = dip->nlink;
+801015c3:	0f b7 50 06          	movzwl 0x6(%eax),%edx
+801015c7:	66 89 53 56          	mov    %dx,0x56(%ebx)
+    ip->size = dip->size;
+801015cb:	8b 50 08             	mov    0x8(%eax),%edx
+801015ce:	89 53 58             	mov    %edx,0x58(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801015d1:	83 c0 0c             	add    $0xc,%eax
+801015d4:	8d 53 5c             	lea    0x5c(%ebx),%edx
+801015d7:	83 c4 0c             	add    $0xc,%esp
+801015da:	6a 34                	push   $0x34
+801015dc:	50                   	push   %eax
+801015dd:	52                   	push   %edx
+801015de:	e8 f6 41 00 00       	call   801057d9 <memmove>
+    brelse(bp);
+801015e3:	89 34 24             	mov    %esi,(%esp)
+801015e6:	e8 11 ec ff ff       	call   801001fc <brelse>
+    ip->valid = 1;
+801015eb:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+    if(ip->type == 0)
+801015f2:	83 c4 10             	add    $0x10,%esp
+801015f5:	66 83 7b 50 00       	cmpw   $0x0,0x50(%ebx)
+801015fa:	0f 85 72 ff ff ff    	jne    80101572 <ilock+0x27>
+      panic("ilock: no type");
+80101600:	83 ec 0c             	sub    $0xc,%esp
+80101603:	68 d0 86 10 80       	push   $0x801086d0
+80101608:	e8 61 ed ff ff       	call   8010036e <panic>
+
+8010160d <iunlock>:
+{
+8010160d:	55                   	push   %ebp
+8010160e:	89 e5                	mov    %esp,%ebp
+80101610:	56                   	push   %esi
+80101611:	53                   	push   %ebx
+80101612:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101615:	85 db                	test   %ebx,%ebx
+80101617:	74 2c                	je     80101645 <iunlock+0x38>
+80101619:	8d 73 0c             	lea    0xc(%ebx),%esi
+8010161c:	83 ec 0c             	sub    $0xc,%esp
+8010161f:	56                   	push   %esi
+80101620:	e8 fe 3e 00 00       	call   80105523 <holdingsleep>
+80101625:	83 c4 10             	add    $0x10,%esp
+80101628:	85 c0                	test   %eax,%eax
+8010162a:	74 19                	je     80101645 <iunlock+0x38>
+8010162c:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80101630:	7e 13                	jle    80101645 <iunlock+0x38>
+  releasesleep(&ip->lock);
+80101632:	83 ec 0c             	sub    $0xc,%esp
+80101635:	56                   	push   %esi
+80101636:	e8 99 3e 00 00       	call   801054d4 <releasesleep>
+}
+8010163b:	83 c4 10             	add    $0x10,%esp
+8010163e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101641:	5b                   	pop    %ebx
+80101642:	5e                   	pop    %esi
+80101643:	5d                   	pop    %ebp
+80101644:	c3                   	ret
+    panic("iunlock");
+80101645:	83 ec 0c             	sub    $0xc,%esp
+80101648:	68 df 86 10 80       	push   $0x801086df
+8010164d:	e8 1c ed ff ff       	call   8010036e <panic>
+
+80101652 <iput>:
+{
+80101652:	55                   	push   %ebp
+80101653:	89 e5                	mov    %esp,%ebp
+80101655:	57                   	push   %edi
+80101656:	56                   	push   %esi
+80101657:	53                   	push   %ebx
+80101658:	83 ec 18             	sub    $0x18,%esp
+8010165b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+8010165e:	8d 73 0c             	lea    0xc(%ebx),%esi
+80101661:	56                   	push   %esi
+80101662:	e8 0a 3e 00 00       	call   80105471 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+80101667:	83 c4 10             	add    $0x10,%esp
+8010166a:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+8010166e:	74 07                	je     80101677 <iput+0x25>
+80101670:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+80101675:	74 35                	je     801016ac <iput+0x5a>
+  releasesleep(&ip->lock);
+80101677:	83 ec 0c             	sub    $0xc,%esp
+8010167a:	56                   	push   %esi
+8010167b:	e8 54 3e 00 00       	call   801054d4 <releasesleep>
+  acquire(&icache.lock);
+80101680:	c7 04 24 c0 19 11 80 	movl   $0x801119c0,(%esp)
+80101687:	e8 29 40 00 00       	call   801056b5 <acquire>
+  ip->ref--;
+8010168c:	8b 43 08             	mov    0x8(%ebx),%eax
+8010168f:	83 e8 01             	sub    $0x1,%eax
+80101692:	89 43 08             	mov    %eax,0x8(%ebx)
+  release(&icache.lock);
+80101695:	c7 04 24 c0 19 11 80 	movl   $0x801119c0,(%esp)
+8010169c:	e8 79 40 00 00       	call   8010571a <release>
+}
+801016a1:	83 c4 10             	add    $0x10,%esp
+801016a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801016a7:	5b                   	pop    %ebx
+801016a8:	5e                   	pop    %esi
+801016a9:	5f                   	pop    %edi
+801016aa:	5d                   	pop    %ebp
+801016ab:	c3                   	ret
+    acquire(&icache.lock);
+801016ac:	83 ec 0c             	sub    $0xc,%esp
+801016af:	68 c0 19 11 80       	push   $0x801119c0
+801016b4:	e8 fc 3f 00 00       	call   801056b5 <acquire>
+    int r = ip->ref;
+801016b9:	8b 7b 08             	mov    0x8(%ebx),%edi
+    release(&icache.lock);
+801016bc:	c7 04 24 c0 19 11 80 	movl   $0x801119c0,(%esp)
+801016c3:	e8 52 40 00 00       	call   8010571a <release>
+    if(r == 1){
+801016c8:	83 c4 10             	add    $0x10,%esp
+801016cb:	83 ff 01             	cmp    $0x1,%edi
+801016ce:	75 a7                	jne    80101677 <iput+0x25>
+      itrunc(ip);
+801016d0:	89 d8                	mov    %ebx,%eax
+801016d2:	e8 92 fd ff ff       	call   80101469 <itrunc>
+      ip->type = 0;
+801016d7:	66 c7 43 50 00 00    	movw   $0x0,0x50(%ebx)
+      iupdate(ip);
+801016dd:	83 ec 0c             	sub    $0xc,%esp
+801016e0:	53                   	push   %ebx
+801016e1:	e8 04 fd ff ff       	call   801013ea <iupdate>
+      ip->valid = 0;
+801016e6:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+801016ed:	83 c4 10             	add    $0x10,%esp
+801016f0:	eb 85                	jmp    80101677 <iput+0x25>
+
+801016f2 <iunlockput>:
+{
+801016f2:	55                   	push   %ebp
+801016f3:	89 e5                	mov    %esp,%ebp
+801016f5:	53                   	push   %ebx
+801016f6:	83 ec 10             	sub    $0x10,%esp
+801016f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  iunlock(ip);
+801016fc:	53                   	push   %ebx
+801016fd:	e8 0b ff ff ff       	call   8010160d <iunlock>
+  iput(ip);
+80101702:	89 1c 24             	mov    %ebx,(%esp)
+80101705:	e8 48 ff ff ff       	call   80101652 <iput>
+}
+8010170a:	83 c4 10             	add    $0x10,%esp
+8010170d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101710:	c9                   	leave
+80101711:	c3                   	ret
+
+80101712 <stati>:
+{
+80101712:	55                   	push   %ebp
+80101713:	89 e5                	mov    %esp,%ebp
+80101715:	8b 55 08             	mov    0x8(%ebp),%edx
+80101718:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+8010171b:	8b 0a                	mov    (%edx),%ecx
+8010171d:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80101720:	8b 4a 04             	mov    0x4(%edx),%ecx
+80101723:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80101726:	0f b7 4a 50          	movzwl 0x50(%edx),%ecx
+8010172a:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+8010172d:	0f b7 4a 56          	movzwl 0x56(%edx),%ecx
+80101731:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80101735:	8b 52 58             	mov    0x58(%edx),%edx
+80101738:	89 50 10             	mov    %edx,0x10(%eax)
+}
+8010173b:	5d                   	pop    %ebp
+8010173c:	c3                   	ret
+
+8010173d <readi>:
+{
+8010173d:	55                   	push   %ebp
+8010173e:	89 e5                	mov    %esp,%ebp
+80101740:	57                   	push   %edi
+80101741:	56                   	push   %esi
+80101742:	53                   	push   %ebx
+80101743:	83 ec 1c             	sub    $0x1c,%esp
+80101746:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80101749:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+8010174c:	66 83 79 50 03       	cmpw   $0x3,0x50(%ecx)
+80101751:	74 2c                	je     8010177f <readi+0x42>
+  if(off > ip->size || off + n < off)
+80101753:	8b 41 58             	mov    0x58(%ecx),%eax
+80101756:	39 f8                	cmp    %edi,%eax
+80101758:	0f 82 cc 00 00 00    	jb     8010182a <readi+0xed>
+8010175e:	89 fa                	mov    %edi,%edx
+80101760:	03 55 14             	add    0x14(%ebp),%edx
+80101763:	0f 82 c8 00 00 00    	jb     80101831 <readi+0xf4>
+  if(off + n > ip->size)
+80101769:	39 d0                	cmp    %edx,%eax
+8010176b:	73 05                	jae    80101772 <readi+0x35>
+    n = ip->size - off;
+8010176d:	29 f8                	sub    %edi,%eax
+8010176f:	89 45 14             	mov    %eax,0x14(%ebp)
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101772:	be 00 00 00 00       	mov    $0x0,%esi
+80101777:	89 4d 08             	mov    %ecx,0x8(%ebp)
+8010177a:	e9 8d 00 00 00       	jmp    8010180c <readi+0xcf>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+8010177f:	0f b7 41 52          	movzwl 0x52(%ecx),%eax
+80101783:	66 83 f8 09          	cmp    $0x9,%ax
+80101787:	0f 87 8f 00 00 00    	ja     8010181c <readi+0xdf>
+8010178d:	98                   	cwtl
+8010178e:	8b 04 c5 60 19 11 80 	mov    -0x7feee6a0(,%eax,8),%eax
+80101795:	85 c0                	test   %eax,%eax
+80101797:	0f 84 86 00 00 00    	je     80101823 <readi+0xe6>
+    return devsw[ip->major].read(ip, dst, n);
+8010179d:	83 ec 04             	sub    $0x4,%esp
+801017a0:	ff 75 14             	push   0x14(%ebp)
+801017a3:	ff 75 0c             	push   0xc(%ebp)
+801017a6:	51                   	push   %ecx
+801017a7:	ff d0                	call   *%eax
+801017a9:	83 c4 10             	add    $0x10,%esp
+801017ac:	eb 66                	jmp    80101814 <readi+0xd7>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801017ae:	89 fa                	mov    %edi,%edx
+801017b0:	c1 ea 09             	shr    $0x9,%edx
+801017b3:	8b 45 08             	mov    0x8(%ebp),%eax
+801017b6:	e8 72 f9 ff ff       	call   8010112d <bmap>
+801017bb:	83 ec 08             	sub    $0x8,%esp
+801017be:	50                   	push   %eax
+801017bf:	8b 45 08             	mov    0x8(%ebp),%eax
+801017c2:	ff 30                	push   (%eax)
+801017c4:	e8 c6 e9 ff ff       	call   8010018f <bread>
+801017c9:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+801017cb:	89 f8                	mov    %edi,%eax
+801017cd:	25 ff 01 00 00       	and    $0x1ff,%eax
+801017d2:	bb 00 02 00 00       	mov    $0x200,%ebx
+801017d7:	29 c3                	sub    %eax,%ebx
+801017d9:	8b 55 14             	mov    0x14(%ebp),%edx
+801017dc:	29 f2                	sub    %esi,%edx
+801017de:	39 d3                	cmp    %edx,%ebx
+801017e0:	0f 47 da             	cmova  %edx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+801017e3:	83 c4 0c             	add    $0xc,%esp
+801017e6:	53                   	push   %ebx
+801017e7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801017ea:	8d 44 01 5c          	lea    0x5c(%ecx,%eax,1),%eax
+801017ee:	50                   	push   %eax
+801017ef:	ff 75 0c             	push   0xc(%ebp)
+801017f2:	e8 e2 3f 00 00       	call   801057d9 <memmove>
+    brelse(bp);
+801017f7:	83 c4 04             	add    $0x4,%esp
+801017fa:	ff 75 e4             	push   -0x1c(%ebp)
+801017fd:	e8 fa e9 ff ff       	call   801001fc <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101802:	01 de                	add    %ebx,%esi
+80101804:	01 df                	add    %ebx,%edi
+80101806:	01 5d 0c             	add    %ebx,0xc(%ebp)
+80101809:	83 c4 10             	add    $0x10,%esp
+8010180c:	3b 75 14             	cmp    0x14(%ebp),%esi
+8010180f:	72 9d                	jb     801017ae <readi+0x71>
+  return n;
+80101811:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+80101814:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101817:	5b                   	pop    %ebx
+80101818:	5e                   	pop    %esi
+80101819:	5f                   	pop    %edi
+8010181a:	5d                   	pop    %ebp
+8010181b:	c3                   	ret
+      return -1;
+8010181c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101821:	eb f1                	jmp    80101814 <readi+0xd7>
+80101823:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101828:	eb ea                	jmp    80101814 <readi+0xd7>
+    return -1;
+8010182a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010182f:	eb e3                	jmp    80101814 <readi+0xd7>
+80101831:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101836:	eb dc                	jmp    80101814 <readi+0xd7>
+
+80101838 <writei>:
+{
+80101838:	55                   	push   %ebp
+80101839:	89 e5                	mov    %esp,%ebp
+8010183b:	57                   	push   %edi
+8010183c:	56                   	push   %esi
+8010183d:	53                   	push   %ebx
+8010183e:	83 ec 1c             	sub    $0x1c,%esp
+80101841:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80101844:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80101847:	66 83 79 50 03       	cmpw   $0x3,0x50(%ecx)
+8010184c:	74 2c                	je     8010187a <writei+0x42>
+  if(off > ip->size || off + n < off)
+8010184e:	39 79 58             	cmp    %edi,0x58(%ecx)
+80101851:	0f 82 f8 00 00 00    	jb     8010194f <writei+0x117>
+80101857:	89 f8                	mov    %edi,%eax
+80101859:	03 45 14             	add    0x14(%ebp),%eax
+8010185c:	0f 82 f4 00 00 00    	jb     80101956 <writei+0x11e>
+  if(off + n > MAXFILE*BSIZE)
+80101862:	3d 00 18 01 00       	cmp    $0x11800,%eax
+80101867:	0f 87 f0 00 00 00    	ja     8010195d <writei+0x125>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+8010186d:	be 00 00 00 00       	mov    $0x0,%esi
+80101872:	89 4d 08             	mov    %ecx,0x8(%ebp)
+80101875:	e9 98 00 00 00       	jmp    80101912 <writei+0xda>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+8010187a:	0f b7 41 52          	movzwl 0x52(%ecx),%eax
+8010187e:	66 83 f8 09          	cmp    $0x9,%ax
+80101882:	0f 87 b9 00 00 00    	ja     80101941 <writei+0x109>
+80101888:	98                   	cwtl
+80101889:	8b 04 c5 64 19 11 80 	mov    -0x7feee69c(,%eax,8),%eax
+80101890:	85 c0                	test   %eax,%eax
+80101892:	0f 84 b0 00 00 00    	je     80101948 <writei+0x110>
+    return devsw[ip->major].write(ip, src, n);
+80101898:	83 ec 04             	sub    $0x4,%esp
+8010189b:	ff 75 14             	push   0x14(%ebp)
+8010189e:	ff 75 0c             	push   0xc(%ebp)
+801018a1:	51                   	push   %ecx
+801018a2:	ff d0                	call   *%eax
+801018a4:	83 c4 10             	add    $0x10,%esp
+801018a7:	eb 7f                	jmp    80101928 <writei+0xf0>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801018a9:	89 fa                	mov    %edi,%edx
+801018ab:	c1 ea 09             	shr    $0x9,%edx
+801018ae:	8b 45 08             	mov    0x8(%ebp),%eax
+801018b1:	e8 77 f8 ff ff       	call   8010112d <bmap>
+801018b6:	83 ec 08             	sub    $0x8,%esp
+801018b9:	50                   	push   %eax
+801018ba:	8b 45 08             	mov    0x8(%ebp),%eax
+801018bd:	ff 30                	push   (%eax)
+801018bf:	e8 cb e8 ff ff       	call   8010018f <bread>
+801018c4:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+801018c6:	89 f8                	mov    %edi,%eax
+801018c8:	25 ff 01 00 00       	and    $0x1ff,%eax
+801018cd:	bb 00 02 00 00       	mov    $0x200,%ebx
+801018d2:	29 c3                	sub    %eax,%ebx
+801018d4:	8b 55 14             	mov    0x14(%ebp),%edx
+801018d7:	29 f2                	sub    %esi,%edx
+801018d9:	39 d3                	cmp    %edx,%ebx
+801018db:	0f 47 da             	cmova  %edx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+801018de:	83 c4 0c             	add    $0xc,%esp
+801018e1:	53                   	push   %ebx
+801018e2:	ff 75 0c             	push   0xc(%ebp)
+801018e5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801018e8:	8d 44 01 5c          	lea    0x5c(%ecx,%eax,1),%eax
+801018ec:	50                   	push   %eax
+801018ed:	e8 e7 3e 00 00       	call   801057d9 <memmove>
+    log_write(bp);
+801018f2:	83 c4 04             	add    $0x4,%esp
+801018f5:	ff 75 e4             	push   -0x1c(%ebp)
+801018f8:	e8 27 10 00 00       	call   80102924 <log_write>
+    brelse(bp);
+801018fd:	83 c4 04             	add    $0x4,%esp
+80101900:	ff 75 e4             	push   -0x1c(%ebp)
+80101903:	e8 f4 e8 ff ff       	call   801001fc <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101908:	01 de                	add    %ebx,%esi
+8010190a:	01 df                	add    %ebx,%edi
+8010190c:	01 5d 0c             	add    %ebx,0xc(%ebp)
+8010190f:	83 c4 10             	add    $0x10,%esp
+80101912:	3b 75 14             	cmp    0x14(%ebp),%esi
+80101915:	72 92                	jb     801018a9 <writei+0x71>
+  if(n > 0 && off > ip->size){
+80101917:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010191a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010191e:	74 05                	je     80101925 <writei+0xed>
+80101920:	39 79 58             	cmp    %edi,0x58(%ecx)
+80101923:	72 0b                	jb     80101930 <writei+0xf8>
+  return n;
+80101925:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+80101928:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010192b:	5b                   	pop    %ebx
+8010192c:	5e                   	pop    %esi
+8010192d:	5f                   	pop    %edi
+8010192e:	5d                   	pop    %ebp
+8010192f:	c3                   	ret
+    ip->size = off;
+80101930:	89 79 58             	mov    %edi,0x58(%ecx)
+    iupdate(ip);
+80101933:	83 ec 0c             	sub    $0xc,%esp
+80101936:	51                   	push   %ecx
+80101937:	e8 ae fa ff ff       	call   801013ea <iupdate>
+8010193c:	83 c4 10             	add    $0x10,%esp
+8010193f:	eb e4                	jmp    80101925 <writei+0xed>
+      return -1;
+80101941:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101946:	eb e0                	jmp    80101928 <writei+0xf0>
+80101948:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010194d:	eb d9                	jmp    80101928 <writei+0xf0>
+    return -1;
+8010194f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101954:	eb d2                	jmp    80101928 <writei+0xf0>
+80101956:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010195b:	eb cb                	jmp    80101928 <writei+0xf0>
+    return -1;
+8010195d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101962:	eb c4                	jmp    80101928 <writei+0xf0>
+
+80101964 <namecmp>:
+{
+80101964:	55                   	push   %ebp
+80101965:	89 e5                	mov    %esp,%ebp
+80101967:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+8010196a:	6a 0e                	push   $0xe
+8010196c:	ff 75 0c             	push   0xc(%ebp)
+8010196f:	ff 75 08             	push   0x8(%ebp)
+80101972:	e8 ce 3e 00 00       	call   80105845 <strncmp>
+}
+80101977:	c9                   	leave
+80101978:	c3                   	ret
+
+80101979 <dirlookup>:
+{
+80101979:	55                   	push   %ebp
+8010197a:	89 e5                	mov    %esp,%ebp
+8010197c:	57                   	push   %edi
+8010197d:	56                   	push   %esi
+8010197e:	53                   	push   %ebx
+8010197f:	83 ec 1c             	sub    $0x1c,%esp
+80101982:	8b 75 08             	mov    0x8(%ebp),%esi
+80101985:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(dp->type != T_DIR)
+80101988:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+8010198d:	75 07                	jne    80101996 <dirlookup+0x1d>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+8010198f:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101994:	eb 1d                	jmp    801019b3 <dirlookup+0x3a>
+    panic("dirlookup not DIR");
+80101996:	83 ec 0c             	sub    $0xc,%esp
+80101999:	68 e7 86 10 80       	push   $0x801086e7
+8010199e:	e8 cb e9 ff ff       	call   8010036e <panic>
+      panic("dirlookup read");
+801019a3:	83 ec 0c             	sub    $0xc,%esp
+801019a6:	68 f9 86 10 80       	push   $0x801086f9
+801019ab:	e8 be e9 ff ff       	call   8010036e <panic>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801019b0:	83 c3 10             	add    $0x10,%ebx
+801019b3:	3b 5e 58             	cmp    0x58(%esi),%ebx
+801019b6:	73 48                	jae    80101a00 <dirlookup+0x87>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801019b8:	6a 10                	push   $0x10
+801019ba:	53                   	push   %ebx
+801019bb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+801019be:	50                   	push   %eax
+801019bf:	56                   	push   %esi
+801019c0:	e8 78 fd ff ff       	call   8010173d <readi>
+801019c5:	83 c4 10             	add    $0x10,%esp
+801019c8:	83 f8 10             	cmp    $0x10,%eax
+801019cb:	75 d6                	jne    801019a3 <dirlookup+0x2a>
+    if(de.inum == 0)
+801019cd:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801019d2:	74 dc                	je     801019b0 <dirlookup+0x37>
+    if(namecmp(name, de.name) == 0){
+801019d4:	83 ec 08             	sub    $0x8,%esp
+801019d7:	8d 45 da             	lea    -0x26(%ebp),%eax
+801019da:	50                   	push   %eax
+801019db:	57                   	push   %edi
+801019dc:	e8 83 ff ff ff       	call   80101964 <namecmp>
+801019e1:	83 c4 10             	add    $0x10,%esp
+801019e4:	85 c0                	test   %eax,%eax
+801019e6:	75 c8                	jne    801019b0 <dirlookup+0x37>
+      if(poff)
+801019e8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+801019ec:	74 05                	je     801019f3 <dirlookup+0x7a>
+        *poff = off;
+801019ee:	8b 45 10             	mov    0x10(%ebp),%eax
+801019f1:	89 18                	mov    %ebx,(%eax)
+      inum = de.inum;
+801019f3:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+801019f7:	8b 06                	mov    (%esi),%eax
+801019f9:	e8 d5 f7 ff ff       	call   801011d3 <iget>
+801019fe:	eb 05                	jmp    80101a05 <dirlookup+0x8c>
+  return 0;
+80101a00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80101a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a08:	5b                   	pop    %ebx
+80101a09:	5e                   	pop    %esi
+80101a0a:	5f                   	pop    %edi
+80101a0b:	5d                   	pop    %ebp
+80101a0c:	c3                   	ret
+
+80101a0d <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80101a0d:	55                   	push   %ebp
+80101a0e:	89 e5                	mov    %esp,%ebp
+80101a10:	57                   	push   %edi
+80101a11:	56                   	push   %esi
+80101a12:	53                   	push   %ebx
+80101a13:	83 ec 1c             	sub    $0x1c,%esp
+80101a16:	89 c3                	mov    %eax,%ebx
+80101a18:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80101a1b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80101a1e:	80 38 2f             	cmpb   $0x2f,(%eax)
+80101a21:	74 17                	je     80101a3a <namex+0x2d>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80101a23:	e8 a6 25 00 00       	call   80103fce <myproc>
+80101a28:	83 ec 0c             	sub    $0xc,%esp
+80101a2b:	ff 70 70             	push   0x70(%eax)
+80101a2e:	e8 e8 fa ff ff       	call   8010151b <idup>
+80101a33:	89 c6                	mov    %eax,%esi
+80101a35:	83 c4 10             	add    $0x10,%esp
+80101a38:	eb 53                	jmp    80101a8d <namex+0x80>
+    ip = iget(ROOTDEV, ROOTINO);
+80101a3a:	ba 01 00 00 00       	mov    $0x1,%edx
+80101a3f:	b8 01 00 00 00       	mov    $0x1,%eax
+80101a44:	e8 8a f7 ff ff       	call   801011d3 <iget>
+80101a49:	89 c6                	mov    %eax,%esi
+80101a4b:	eb 40                	jmp    80101a8d <namex+0x80>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+    if(ip->type != T_DIR){
+      iunlockput(ip);
+80101a4d:	83 ec 0c             	sub    $0xc,%esp
+80101a50:	56                   	push   %esi
+80101a51:	e8 9c fc ff ff       	call   801016f2 <iunlockput>
+      return 0;
+80101a56:	83 c4 10             	add    $0x10,%esp
+80101a59:	be 00 00 00 00       	mov    $0x0,%esi
+  if(nameiparent){
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80101a5e:	89 f0                	mov    %esi,%eax
+80101a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a63:	5b                   	pop    %ebx
+80101a64:	5e                   	pop    %esi
+80101a65:	5f                   	pop    %edi
+80101a66:	5d                   	pop    %ebp
+80101a67:	c3                   	ret
+    if((next = dirlookup(ip, name, 0)) == 0){
+80101a68:	83 ec 04             	sub    $0x4,%esp
+80101a6b:	6a 00                	push   $0x0
+80101a6d:	ff 75 e4             	push   -0x1c(%ebp)
+80101a70:	56                   	push   %esi
+80101a71:	e8 03 ff ff ff       	call   80101979 <dirlookup>
+80101a76:	89 c7                	mov    %eax,%edi
+80101a78:	83 c4 10             	add    $0x10,%esp
+80101a7b:	85 c0                	test   %eax,%eax
+80101a7d:	74 4a                	je     80101ac9 <namex+0xbc>
+    iunlockput(ip);
+80101a7f:	83 ec 0c             	sub    $0xc,%esp
+80101a82:	56                   	push   %esi
+80101a83:	e8 6a fc ff ff       	call   801016f2 <iunlockput>
+80101a88:	83 c4 10             	add    $0x10,%esp
+    ip = next;
+80101a8b:	89 fe                	mov    %edi,%esi
+  while((path = skipelem(path, name)) != 0){
+80101a8d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101a90:	89 d8                	mov    %ebx,%eax
+80101a92:	e8 8c f4 ff ff       	call   80100f23 <skipelem>
+80101a97:	89 c3                	mov    %eax,%ebx
+80101a99:	85 c0                	test   %eax,%eax
+80101a9b:	74 3c                	je     80101ad9 <namex+0xcc>
+    ilock(ip);
+80101a9d:	83 ec 0c             	sub    $0xc,%esp
+80101aa0:	56                   	push   %esi
+80101aa1:	e8 a5 fa ff ff       	call   8010154b <ilock>
+    if(ip->type != T_DIR){
+80101aa6:	83 c4 10             	add    $0x10,%esp
+80101aa9:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+80101aae:	75 9d                	jne    80101a4d <namex+0x40>
+    if(nameiparent && *path == '\0'){
+80101ab0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80101ab4:	74 b2                	je     80101a68 <namex+0x5b>
+80101ab6:	80 3b 00             	cmpb   $0x0,(%ebx)
+80101ab9:	75 ad                	jne    80101a68 <namex+0x5b>
+      iunlock(ip);
+80101abb:	83 ec 0c             	sub    $0xc,%esp
+80101abe:	56                   	push   %esi
+80101abf:	e8 49 fb ff ff       	call   8010160d <iunlock>
+      return ip;
+80101ac4:	83 c4 10             	add    $0x10,%esp
+80101ac7:	eb 95                	jmp    80101a5e <namex+0x51>
+      iunlockput(ip);
+80101ac9:	83 ec 0c             	sub    $0xc,%esp
+80101acc:	56                   	push   %esi
+80101acd:	e8 20 fc ff ff       	call   801016f2 <iunlockput>
+      return 0;
+80101ad2:	83 c4 10             	add    $0x10,%esp
+80101ad5:	89 fe                	mov    %edi,%esi
+80101ad7:	eb 85                	jmp    80101a5e <namex+0x51>
+  if(nameiparent){
+80101ad9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80101add:	0f 84 7b ff ff ff    	je     80101a5e <namex+0x51>
+    iput(ip);
+80101ae3:	83 ec 0c             	sub    $0xc,%esp
+80101ae6:	56                   	push   %esi
+80101ae7:	e8 66 fb ff ff       	call   80101652 <iput>
+    return 0;
+80101aec:	83 c4 10             	add    $0x10,%esp
+80101aef:	89 de                	mov    %ebx,%esi
+80101af1:	e9 68 ff ff ff       	jmp    80101a5e <namex+0x51>
+
+80101af6 <dirlink>:
+{
+80101af6:	55                   	push   %ebp
+80101af7:	89 e5                	mov    %esp,%ebp
+80101af9:	57                   	push   %edi
+80101afa:	56                   	push   %esi
+80101afb:	53                   	push   %ebx
+80101afc:	83 ec 20             	sub    $0x20,%esp
+80101aff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80101b02:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80101b05:	6a 00                	push   $0x0
+80101b07:	57                   	push   %edi
+80101b08:	53                   	push   %ebx
+80101b09:	e8 6b fe ff ff       	call   80101979 <dirlookup>
+80101b0e:	83 c4 10             	add    $0x10,%esp
+80101b11:	85 c0                	test   %eax,%eax
+80101b13:	75 2d                	jne    80101b42 <dirlink+0x4c>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101b15:	b8 00 00 00 00       	mov    $0x0,%eax
+80101b1a:	89 c6                	mov    %eax,%esi
+80101b1c:	3b 43 58             	cmp    0x58(%ebx),%eax
+80101b1f:	73 41                	jae    80101b62 <dirlink+0x6c>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80101b21:	6a 10                	push   $0x10
+80101b23:	50                   	push   %eax
+80101b24:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80101b27:	50                   	push   %eax
+80101b28:	53                   	push   %ebx
+80101b29:	e8 0f fc ff ff       	call   8010173d <readi>
+80101b2e:	83 c4 10             	add    $0x10,%esp
+80101b31:	83 f8 10             	cmp    $0x10,%eax
+80101b34:	75 1f                	jne    80101b55 <dirlink+0x5f>
+    if(de.inum == 0)
+80101b36:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80101b3b:	74 25                	je     80101b62 <dirlink+0x6c>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101b3d:	8d 46 10             	lea    0x10(%esi),%eax
+80101b40:	eb d8                	jmp    80101b1a <dirlink+0x24>
+    iput(ip);
+80101b42:	83 ec 0c             	sub    $0xc,%esp
+80101b45:	50                   	push   %eax
+80101b46:	e8 07 fb ff ff       	call   80101652 <iput>
+    return -1;
+80101b4b:	83 c4 10             	add    $0x10,%esp
+80101b4e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101b53:	eb 3d                	jmp    80101b92 <dirlink+0x9c>
+      panic("dirlink read");
+80101b55:	83 ec 0c             	sub    $0xc,%esp
+80101b58:	68 08 87 10 80       	push   $0x80108708
+80101b5d:	e8 0c e8 ff ff       	call   8010036e <panic>
+  strncpy(de.name, name, DIRSIZ);
+80101b62:	83 ec 04             	sub    $0x4,%esp
+80101b65:	6a 0e                	push   $0xe
+80101b67:	57                   	push   %edi
+80101b68:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80101b6b:	8d 45 da             	lea    -0x26(%ebp),%eax
+80101b6e:	50                   	push   %eax
+80101b6f:	e8 10 3d 00 00       	call   80105884 <strncpy>
+  de.inum = inum;
+80101b74:	8b 45 10             	mov    0x10(%ebp),%eax
+80101b77:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80101b7b:	6a 10                	push   $0x10
+80101b7d:	56                   	push   %esi
+80101b7e:	57                   	push   %edi
+80101b7f:	53                   	push   %ebx
+80101b80:	e8 b3 fc ff ff       	call   80101838 <writei>
+80101b85:	83 c4 20             	add    $0x20,%esp
+80101b88:	83 f8 10             	cmp    $0x10,%eax
+80101b8b:	75 0d                	jne    80101b9a <dirlink+0xa4>
+  return 0;
+80101b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80101b92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101b95:	5b                   	pop    %ebx
+80101b96:	5e                   	pop    %esi
+80101b97:	5f                   	pop    %edi
+80101b98:	5d                   	pop    %ebp
+80101b99:	c3                   	ret
+    panic("dirlink");
+80101b9a:	83 ec 0c             	sub    $0xc,%esp
+80101b9d:	68 68 8e 10 80       	push   $0x80108e68
+80101ba2:	e8 c7 e7 ff ff       	call   8010036e <panic>
+
+80101ba7 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80101ba7:	55                   	push   %ebp
+80101ba8:	89 e5                	mov    %esp,%ebp
+80101baa:	83 ec 18             	sub    $0x18,%esp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80101bad:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+80101bb0:	ba 00 00 00 00       	mov    $0x0,%edx
+80101bb5:	8b 45 08             	mov    0x8(%ebp),%eax
+80101bb8:	e8 50 fe ff ff       	call   80101a0d <namex>
+}
+80101bbd:	c9                   	leave
+80101bbe:	c3                   	ret
+
+80101bbf <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80101bbf:	55                   	push   %ebp
+80101bc0:	89 e5                	mov    %esp,%ebp
+80101bc2:	83 ec 08             	sub    $0x8,%esp
+  return namex(path, 1, name);
+80101bc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80101bc8:	ba 01 00 00 00       	mov    $0x1,%edx
+80101bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+80101bd0:	e8 38 fe ff ff       	call   80101a0d <namex>
+}
+80101bd5:	c9                   	leave
+80101bd6:	c3                   	ret
+
+80101bd7 <idewait>:
+static void idestart(struct buf*);
+
+// Wait for IDE disk to become ready.
+static int
+idewait(int checkerr)
+{
+80101bd7:	89 c1                	mov    %eax,%ecx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80101bd9:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101bde:	ec                   	in     (%dx),%al
+  int r;
+
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80101bdf:	89 c2                	mov    %eax,%edx
+80101be1:	83 e2 c0             	and    $0xffffffc0,%edx
+80101be4:	80 fa 40             	cmp    $0x40,%dl
+80101be7:	75 f0                	jne    80101bd9 <idewait+0x2>
+    ;
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80101be9:	85 c9                	test   %ecx,%ecx
+80101beb:	74 09                	je     80101bf6 <idewait+0x1f>
+80101bed:	a8 21                	test   $0x21,%al
+80101bef:	75 08                	jne    80101bf9 <idewait+0x22>
+    return -1;
+  return 0;
+80101bf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+80101bf6:	89 c8                	mov    %ecx,%eax
+80101bf8:	c3                   	ret
+    return -1;
+80101bf9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+80101bfe:	eb f6                	jmp    80101bf6 <idewait+0x1f>
+
+80101c00 <idestart>:
+}
+
+// Start the request for b.  Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+80101c00:	55                   	push   %ebp
+80101c01:	89 e5                	mov    %esp,%ebp
+80101c03:	56                   	push   %esi
+80101c04:	53                   	push   %ebx
+  if(b == 0)
+80101c05:	85 c0                	test   %eax,%eax
+80101c07:	0f 84 8f 00 00 00    	je     80101c9c <idestart+0x9c>
+80101c0d:	89 c6                	mov    %eax,%esi
+    panic("idestart");
+  if(b->blockno >= FSSIZE)
+80101c0f:	8b 58 08             	mov    0x8(%eax),%ebx
+80101c12:	81 fb cf 07 00 00    	cmp    $0x7cf,%ebx
+80101c18:	0f 87 8b 00 00 00    	ja     80101ca9 <idestart+0xa9>
+  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+
+  if (sector_per_block > 7) panic("idestart");
+
+  idewait(0);
+80101c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+80101c23:	e8 af ff ff ff       	call   80101bd7 <idewait>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101c28:	b8 00 00 00 00       	mov    $0x0,%eax
+80101c2d:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80101c32:	ee                   	out    %al,(%dx)
+80101c33:	b8 01 00 00 00       	mov    $0x1,%eax
+80101c38:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80101c3d:	ee                   	out    %al,(%dx)
+80101c3e:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80101c43:	89 d8                	mov    %ebx,%eax
+80101c45:	ee                   	out    %al,(%dx)
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+80101c46:	0f b6 c7             	movzbl %bh,%eax
+80101c49:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80101c4e:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+80101c4f:	89 d8                	mov    %ebx,%eax
+80101c51:	c1 f8 10             	sar    $0x10,%eax
+80101c54:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80101c59:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80101c5a:	0f b6 46 04          	movzbl 0x4(%esi),%eax
+80101c5e:	c1 e0 04             	shl    $0x4,%eax
+80101c61:	83 e0 10             	and    $0x10,%eax
+80101c64:	c1 fb 18             	sar    $0x18,%ebx
+80101c67:	83 e3 0f             	and    $0xf,%ebx
+80101c6a:	09 d8                	or     %ebx,%eax
+80101c6c:	83 c8 e0             	or     $0xffffffe0,%eax
+80101c6f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80101c74:	ee                   	out    %al,(%dx)
+  if(b->flags & B_DIRTY){
+80101c75:	f6 06 04             	testb  $0x4,(%esi)
+80101c78:	74 3c                	je     80101cb6 <idestart+0xb6>
+80101c7a:	b8 30 00 00 00       	mov    $0x30,%eax
+80101c7f:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101c84:	ee                   	out    %al,(%dx)
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, BSIZE/4);
+80101c85:	83 c6 5c             	add    $0x5c,%esi
+  asm volatile("cld; rep outsl" :
+80101c88:	b9 80 00 00 00       	mov    $0x80,%ecx
+80101c8d:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80101c92:	fc                   	cld
+80101c93:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+80101c95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101c98:	5b                   	pop    %ebx
+80101c99:	5e                   	pop    %esi
+80101c9a:	5d                   	pop    %ebp
+80101c9b:	c3                   	ret
+    panic("idestart");
+80101c9c:	83 ec 0c             	sub    $0xc,%esp
+80101c9f:	68 6b 87 10 80       	push   $0x8010876b
+80101ca4:	e8 c5 e6 ff ff       	call   8010036e <panic>
+    panic("incorrect blockno");
+80101ca9:	83 ec 0c             	sub    $0xc,%esp
+80101cac:	68 74 87 10 80       	push   $0x80108774
+80101cb1:	e8 b8 e6 ff ff       	call   8010036e <panic>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101cb6:	b8 20 00 00 00       	mov    $0x20,%eax
+80101cbb:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101cc0:	ee                   	out    %al,(%dx)
+}
+80101cc1:	eb d2                	jmp    80101c95 <idestart+0x95>
+
+80101cc3 <ideinit>:
+{
+80101cc3:	55                   	push   %ebp
+80101cc4:	89 e5                	mov    %esp,%ebp
+80101cc6:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+80101cc9:	68 86 87 10 80       	push   $0x80108786
+80101cce:	68 60 36 11 80       	push   $0x80113660
+80101cd3:	e8 99 38 00 00       	call   80105571 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80101cd8:	83 c4 08             	add    $0x8,%esp
+80101cdb:	a1 e4 37 11 80       	mov    0x801137e4,%eax
+80101ce0:	83 e8 01             	sub    $0x1,%eax
+80101ce3:	50                   	push   %eax
+80101ce4:	6a 0e                	push   $0xe
+80101ce6:	e8 55 02 00 00       	call   80101f40 <ioapicenable>
+  idewait(0);
+80101ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+80101cf0:	e8 e2 fe ff ff       	call   80101bd7 <idewait>
+80101cf5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+80101cfa:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80101cff:	ee                   	out    %al,(%dx)
+  for(i=0; i<1000; i++){
+80101d00:	83 c4 10             	add    $0x10,%esp
+80101d03:	b9 00 00 00 00       	mov    $0x0,%ecx
+80101d08:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+80101d0e:	7f 19                	jg     80101d29 <ideinit+0x66>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80101d10:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101d15:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80101d16:	84 c0                	test   %al,%al
+80101d18:	75 05                	jne    80101d1f <ideinit+0x5c>
+  for(i=0; i<1000; i++){
+80101d1a:	83 c1 01             	add    $0x1,%ecx
+80101d1d:	eb e9                	jmp    80101d08 <ideinit+0x45>
+      havedisk1 = 1;
+80101d1f:	c7 05 40 36 11 80 01 	movl   $0x1,0x80113640
+80101d26:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101d29:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80101d2e:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80101d33:	ee                   	out    %al,(%dx)
+}
+80101d34:	c9                   	leave
+80101d35:	c3                   	ret
+
+80101d36 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+80101d36:	55                   	push   %ebp
+80101d37:	89 e5                	mov    %esp,%ebp
+80101d39:	57                   	push   %edi
+80101d3a:	53                   	push   %ebx
+  struct buf *b;
+
+  // First queued buffer is the active request.
+  acquire(&idelock);
+80101d3b:	83 ec 0c             	sub    $0xc,%esp
+80101d3e:	68 60 36 11 80       	push   $0x80113660
+80101d43:	e8 6d 39 00 00       	call   801056b5 <acquire>
+
+  if((b = idequeue) == 0){
+80101d48:	8b 1d 44 36 11 80    	mov    0x80113644,%ebx
+80101d4e:	83 c4 10             	add    $0x10,%esp
+80101d51:	85 db                	test   %ebx,%ebx
+80101d53:	74 4f                	je     80101da4 <ideintr+0x6e>
+    release(&idelock);
+    return;
+  }
+  idequeue = b->qnext;
+80101d55:	8b 43 58             	mov    0x58(%ebx),%eax
+80101d58:	a3 44 36 11 80       	mov    %eax,0x80113644
+
+  // Read data if needed.
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+80101d5d:	f6 03 04             	testb  $0x4,(%ebx)
+80101d60:	74 54                	je     80101db6 <ideintr+0x80>
+    insl(0x1f0, b->data, BSIZE/4);
+
+  // Wake process waiting for this buf.
+  b->flags |= B_VALID;
+80101d62:	8b 03                	mov    (%ebx),%eax
+80101d64:	89 c2                	mov    %eax,%edx
+80101d66:	83 ca 02             	or     $0x2,%edx
+80101d69:	89 13                	mov    %edx,(%ebx)
+  b->flags &= ~B_DIRTY;
+80101d6b:	83 e0 fb             	and    $0xfffffffb,%eax
+80101d6e:	83 c8 02             	or     $0x2,%eax
+80101d71:	89 03                	mov    %eax,(%ebx)
+  wakeup(b);
+80101d73:	83 ec 0c             	sub    $0xc,%esp
+80101d76:	53                   	push   %ebx
+80101d77:	e8 20 2b 00 00       	call   8010489c <wakeup>
+
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+80101d7c:	a1 44 36 11 80       	mov    0x80113644,%eax
+80101d81:	83 c4 10             	add    $0x10,%esp
+80101d84:	85 c0                	test   %eax,%eax
+80101d86:	74 05                	je     80101d8d <ideintr+0x57>
+    idestart(idequeue);
+80101d88:	e8 73 fe ff ff       	call   80101c00 <idestart>
+
+  release(&idelock);
+80101d8d:	83 ec 0c             	sub    $0xc,%esp
+80101d90:	68 60 36 11 80       	push   $0x80113660
+80101d95:	e8 80 39 00 00       	call   8010571a <release>
+80101d9a:	83 c4 10             	add    $0x10,%esp
+}
+80101d9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101da0:	5b                   	pop    %ebx
+80101da1:	5f                   	pop    %edi
+80101da2:	5d                   	pop    %ebp
+80101da3:	c3                   	ret
+    release(&idelock);
+80101da4:	83 ec 0c             	sub    $0xc,%esp
+80101da7:	68 60 36 11 80       	push   $0x80113660
+80101dac:	e8 69 39 00 00       	call   8010571a <release>
+    return;
+80101db1:	83 c4 10             	add    $0x10,%esp
+80101db4:	eb e7                	jmp    80101d9d <ideintr+0x67>
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+80101db6:	b8 01 00 00 00       	mov    $0x1,%eax
+80101dbb:	e8 17 fe ff ff       	call   80101bd7 <idewait>
+80101dc0:	85 c0                	test   %eax,%eax
+80101dc2:	78 9e                	js     80101d62 <ideintr+0x2c>
+    insl(0x1f0, b->data, BSIZE/4);
+80101dc4:	8d 7b 5c             	lea    0x5c(%ebx),%edi
+  asm volatile("cld; rep insl" :
+80101dc7:	b9 80 00 00 00       	mov    $0x80,%ecx
+80101dcc:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80101dd1:	fc                   	cld
+80101dd2:	f3 6d                	rep insl (%dx),%es:(%edi)
+}
+80101dd4:	eb 8c                	jmp    80101d62 <ideintr+0x2c>
+
+80101dd6 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80101dd6:	55                   	push   %ebp
+80101dd7:	89 e5                	mov    %esp,%ebp
+80101dd9:	53                   	push   %ebx
+80101dda:	83 ec 10             	sub    $0x10,%esp
+80101ddd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct buf **pp;
+
+  if(!holdingsleep(&b->lock))
+80101de0:	8d 43 0c             	lea    0xc(%ebx),%eax
+80101de3:	50                   	push   %eax
+80101de4:	e8 3a 37 00 00       	call   80105523 <holdingsleep>
+80101de9:	83 c4 10             	add    $0x10,%esp
+80101dec:	85 c0                	test   %eax,%eax
+80101dee:	74 37                	je     80101e27 <iderw+0x51>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+80101df0:	8b 03                	mov    (%ebx),%eax
+80101df2:	83 e0 06             	and    $0x6,%eax
+80101df5:	83 f8 02             	cmp    $0x2,%eax
+80101df8:	74 3a                	je     80101e34 <iderw+0x5e>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+80101dfa:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+80101dfe:	74 09                	je     80101e09 <iderw+0x33>
+80101e00:	83 3d 40 36 11 80 00 	cmpl   $0x0,0x80113640
+80101e07:	74 38                	je     80101e41 <iderw+0x6b>
+    panic("iderw: ide disk 1 not present");
+
+  acquire(&idelock);  //DOC:acquire-lock
+80101e09:	83 ec 0c             	sub    $0xc,%esp
+80101e0c:	68 60 36 11 80       	push   $0x80113660
+80101e11:	e8 9f 38 00 00       	call   801056b5 <acquire>
+
+  // Append b to idequeue.
+  b->qnext = 0;
+80101e16:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80101e1d:	83 c4 10             	add    $0x10,%esp
+80101e20:	ba 44 36 11 80       	mov    $0x80113644,%edx
+80101e25:	eb 2a                	jmp    80101e51 <iderw+0x7b>
+    panic("iderw: buf not locked");
+80101e27:	83 ec 0c             	sub    $0xc,%esp
+80101e2a:	68 8a 87 10 80       	push   $0x8010878a
+80101e2f:	e8 3a e5 ff ff       	call   8010036e <panic>
+    panic("iderw: nothing to do");
+80101e34:	83 ec 0c             	sub    $0xc,%esp
+80101e37:	68 a0 87 10 80       	push   $0x801087a0
+80101e3c:	e8 2d e5 ff ff       	call   8010036e <panic>
+    panic("iderw: ide disk 1 not present");
+80101e41:	83 ec 0c             	sub    $0xc,%esp
+80101e44:	68 b5 87 10 80       	push   $0x801087b5
+80101e49:	e8 20 e5 ff ff       	call   8010036e <panic>
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80101e4e:	8d 50 58             	lea    0x58(%eax),%edx
+80101e51:	8b 02                	mov    (%edx),%eax
+80101e53:	85 c0                	test   %eax,%eax
+80101e55:	75 f7                	jne    80101e4e <iderw+0x78>
+    ;
+  *pp = b;
+80101e57:	89 1a                	mov    %ebx,(%edx)
+
+  // Start disk if necessary.
+  if(idequeue == b)
+80101e59:	39 1d 44 36 11 80    	cmp    %ebx,0x80113644
+80101e5f:	75 1a                	jne    80101e7b <iderw+0xa5>
+    idestart(b);
+80101e61:	89 d8                	mov    %ebx,%eax
+80101e63:	e8 98 fd ff ff       	call   80101c00 <idestart>
+80101e68:	eb 11                	jmp    80101e7b <iderw+0xa5>
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+    sleep(b, &idelock);
+80101e6a:	83 ec 08             	sub    $0x8,%esp
+80101e6d:	68 60 36 11 80       	push   $0x80113660
+80101e72:	53                   	push   %ebx
+80101e73:	e8 91 28 00 00       	call   80104709 <sleep>
+80101e78:	83 c4 10             	add    $0x10,%esp
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80101e7b:	8b 03                	mov    (%ebx),%eax
+80101e7d:	83 e0 06             	and    $0x6,%eax
+80101e80:	83 f8 02             	cmp    $0x2,%eax
+80101e83:	75 e5                	jne    80101e6a <iderw+0x94>
+  }
+
+
+  release(&idelock);
+80101e85:	83 ec 0c             	sub    $0xc,%esp
+80101e88:	68 60 36 11 80       	push   $0x80113660
+80101e8d:	e8 88 38 00 00       	call   8010571a <release>
+}
+80101e92:	83 c4 10             	add    $0x10,%esp
+80101e95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101e98:	c9                   	leave
+80101e99:	c3                   	ret
+
+80101e9a <ioapicread>:
+};
+
+static uint
+ioapicread(int reg)
+{
+  ioapic->reg = reg;
+80101e9a:	8b 15 94 36 11 80    	mov    0x80113694,%edx
+80101ea0:	89 02                	mov    %eax,(%edx)
+  return ioapic->data;
+80101ea2:	a1 94 36 11 80       	mov    0x80113694,%eax
+80101ea7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+80101eaa:	c3                   	ret
+
+80101eab <ioapicwrite>:
+
+static void
+ioapicwrite(int reg, uint data)
+{
+  ioapic->reg = reg;
+80101eab:	8b 0d 94 36 11 80    	mov    0x80113694,%ecx
+80101eb1:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80101eb3:	a1 94 36 11 80       	mov    0x80113694,%eax
+80101eb8:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80101ebb:	c3                   	ret
+
+80101ebc <ioapicinit>:
+
+void
+ioapicinit(void)
+{
+80101ebc:	55                   	push   %ebp
+80101ebd:	89 e5                	mov    %esp,%ebp
+80101ebf:	57                   	push   %edi
+80101ec0:	56                   	push   %esi
+80101ec1:	53                   	push   %ebx
+80101ec2:	83 ec 0c             	sub    $0xc,%esp
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80101ec5:	c7 05 94 36 11 80 00 	movl   $0xfec00000,0x80113694
+80101ecc:	00 c0 fe 
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80101ecf:	b8 01 00 00 00       	mov    $0x1,%eax
+80101ed4:	e8 c1 ff ff ff       	call   80101e9a <ioapicread>
+80101ed9:	c1 e8 10             	shr    $0x10,%eax
+80101edc:	0f b6 f8             	movzbl %al,%edi
+  id = ioapicread(REG_ID) >> 24;
+80101edf:	b8 00 00 00 00       	mov    $0x0,%eax
+80101ee4:	e8 b1 ff ff ff       	call   80101e9a <ioapicread>
+80101ee9:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80101eec:	0f b6 15 e0 37 11 80 	movzbl 0x801137e0,%edx
+80101ef3:	39 c2                	cmp    %eax,%edx
+80101ef5:	75 07                	jne    80101efe <ioapicinit+0x42>
+{
+80101ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101efc:	eb 36                	jmp    80101f34 <ioapicinit+0x78>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80101efe:	83 ec 0c             	sub    $0xc,%esp
+80101f01:	68 d4 87 10 80       	push   $0x801087d4
+80101f06:	e8 24 e7 ff ff       	call   8010062f <cprintf>
+80101f0b:	83 c4 10             	add    $0x10,%esp
+80101f0e:	eb e7                	jmp    80101ef7 <ioapicinit+0x3b>
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+80101f10:	8d 53 20             	lea    0x20(%ebx),%edx
+80101f13:	81 ca 00 00 01 00    	or     $0x10000,%edx
+80101f19:	8d 74 1b 10          	lea    0x10(%ebx,%ebx,1),%esi
+80101f1d:	89 f0                	mov    %esi,%eax
+80101f1f:	e8 87 ff ff ff       	call   80101eab <ioapicwrite>
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+80101f24:	8d 46 01             	lea    0x1(%esi),%eax
+80101f27:	ba 00 00 00 00       	mov    $0x0,%edx
+80101f2c:	e8 7a ff ff ff       	call   80101eab <ioapicwrite>
+  for(i = 0; i <= maxintr; i++){
+80101f31:	83 c3 01             	add    $0x1,%ebx
+80101f34:	39 fb                	cmp    %edi,%ebx
+80101f36:	7e d8                	jle    80101f10 <ioapicinit+0x54>
+  }
+}
+80101f38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101f3b:	5b                   	pop    %ebx
+80101f3c:	5e                   	pop    %esi
+80101f3d:	5f                   	pop    %edi
+80101f3e:	5d                   	pop    %ebp
+80101f3f:	c3                   	ret
+
+80101f40 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80101f40:	55                   	push   %ebp
+80101f41:	89 e5                	mov    %esp,%ebp
+80101f43:	53                   	push   %ebx
+80101f44:	83 ec 04             	sub    $0x4,%esp
+80101f47:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+80101f4a:	8d 50 20             	lea    0x20(%eax),%edx
+80101f4d:	8d 5c 00 10          	lea    0x10(%eax,%eax,1),%ebx
+80101f51:	89 d8                	mov    %ebx,%eax
+80101f53:	e8 53 ff ff ff       	call   80101eab <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80101f58:	8b 55 0c             	mov    0xc(%ebp),%edx
+80101f5b:	c1 e2 18             	shl    $0x18,%edx
+80101f5e:	8d 43 01             	lea    0x1(%ebx),%eax
+80101f61:	e8 45 ff ff ff       	call   80101eab <ioapicwrite>
+}
+80101f66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101f69:	c9                   	leave
+80101f6a:	c3                   	ret
+
+80101f6b <kfree>:
+// which normally should have been returned by a
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+void
+kfree(char *v)
+{
+80101f6b:	55                   	push   %ebp
+80101f6c:	89 e5                	mov    %esp,%ebp
+80101f6e:	53                   	push   %ebx
+80101f6f:	83 ec 04             	sub    $0x4,%esp
+80101f72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80101f75:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80101f7b:	75 61                	jne    80101fde <kfree+0x73>
+80101f7d:	81 fb 00 31 15 80    	cmp    $0x80153100,%ebx
+80101f83:	72 59                	jb     80101fde <kfree+0x73>
+
+// Convert kernel virtual address to physical address
+static inline uint V2P(void *a) {
+    // define panic() here because memlayout.h is included before defs.h
+    extern void panic(char*) __attribute__((noreturn));
+    if (a < (void*) KERNBASE)
+80101f85:	81 fb ff ff ff 7f    	cmp    $0x7fffffff,%ebx
+80101f8b:	76 44                	jbe    80101fd1 <kfree+0x66>
+        panic("V2P on address < KERNBASE "
+              "(not a kernel virtual address; consider walking page "
+              "table to determine physical address of a user virtual address)");
+    return (uint)a - KERNBASE;
+80101f8d:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80101f93:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80101f98:	77 44                	ja     80101fde <kfree+0x73>
+    panic("kfree");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE);
+80101f9a:	83 ec 04             	sub    $0x4,%esp
+80101f9d:	68 00 10 00 00       	push   $0x1000
+80101fa2:	6a 01                	push   $0x1
+80101fa4:	53                   	push   %ebx
+80101fa5:	e8 b7 37 00 00       	call   80105761 <memset>
+
+  if(kmem.use_lock)
+80101faa:	83 c4 10             	add    $0x10,%esp
+80101fad:	83 3d d4 36 11 80 00 	cmpl   $0x0,0x801136d4
+80101fb4:	75 35                	jne    80101feb <kfree+0x80>
+    acquire(&kmem.lock);
+  r = (struct run*)v;
+  r->next = kmem.freelist;
+80101fb6:	a1 d8 36 11 80       	mov    0x801136d8,%eax
+80101fbb:	89 03                	mov    %eax,(%ebx)
+  kmem.freelist = r;
+80101fbd:	89 1d d8 36 11 80    	mov    %ebx,0x801136d8
+  if(kmem.use_lock)
+80101fc3:	83 3d d4 36 11 80 00 	cmpl   $0x0,0x801136d4
+80101fca:	75 31                	jne    80101ffd <kfree+0x92>
+    release(&kmem.lock);
+}
+80101fcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101fcf:	c9                   	leave
+80101fd0:	c3                   	ret
+        panic("V2P on address < KERNBASE "
+80101fd1:	83 ec 0c             	sub    $0xc,%esp
+80101fd4:	68 08 88 10 80       	push   $0x80108808
+80101fd9:	e8 90 e3 ff ff       	call   8010036e <panic>
+    panic("kfree");
+80101fde:	83 ec 0c             	sub    $0xc,%esp
+80101fe1:	68 96 88 10 80       	push   $0x80108896
+80101fe6:	e8 83 e3 ff ff       	call   8010036e <panic>
+    acquire(&kmem.lock);
+80101feb:	83 ec 0c             	sub    $0xc,%esp
+80101fee:	68 a0 36 11 80       	push   $0x801136a0
+80101ff3:	e8 bd 36 00 00       	call   801056b5 <acquire>
+80101ff8:	83 c4 10             	add    $0x10,%esp
+80101ffb:	eb b9                	jmp    80101fb6 <kfree+0x4b>
+    release(&kmem.lock);
+80101ffd:	83 ec 0c             	sub    $0xc,%esp
+80102000:	68 a0 36 11 80       	push   $0x801136a0
+80102005:	e8 10 37 00 00       	call   8010571a <release>
+8010200a:	83 c4 10             	add    $0x10,%esp
+}
+8010200d:	eb bd                	jmp    80101fcc <kfree+0x61>
+
+8010200f <freerange>:
+{
+8010200f:	55                   	push   %ebp
+80102010:	89 e5                	mov    %esp,%ebp
+80102012:	56                   	push   %esi
+80102013:	53                   	push   %ebx
+80102014:	8b 45 08             	mov    0x8(%ebp),%eax
+80102017:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if (vend < vstart) panic("freerange");
+8010201a:	39 c3                	cmp    %eax,%ebx
+8010201c:	72 0c                	jb     8010202a <freerange+0x1b>
+  p = (char*)PGROUNDUP((uint)vstart);
+8010201e:	05 ff 0f 00 00       	add    $0xfff,%eax
+80102023:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102028:	eb 1b                	jmp    80102045 <freerange+0x36>
+  if (vend < vstart) panic("freerange");
+8010202a:	83 ec 0c             	sub    $0xc,%esp
+8010202d:	68 9c 88 10 80       	push   $0x8010889c
+80102032:	e8 37 e3 ff ff       	call   8010036e <panic>
+    kfree(p);
+80102037:	83 ec 0c             	sub    $0xc,%esp
+8010203a:	50                   	push   %eax
+8010203b:	e8 2b ff ff ff       	call   80101f6b <kfree>
+80102040:	83 c4 10             	add    $0x10,%esp
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102043:	89 f0                	mov    %esi,%eax
+80102045:	8d b0 00 10 00 00    	lea    0x1000(%eax),%esi
+8010204b:	39 f3                	cmp    %esi,%ebx
+8010204d:	73 e8                	jae    80102037 <freerange+0x28>
+}
+8010204f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102052:	5b                   	pop    %ebx
+80102053:	5e                   	pop    %esi
+80102054:	5d                   	pop    %ebp
+80102055:	c3                   	ret
+
+80102056 <kinit1>:
+{
+80102056:	55                   	push   %ebp
+80102057:	89 e5                	mov    %esp,%ebp
+80102059:	83 ec 10             	sub    $0x10,%esp
+  initlock(&kmem.lock, "kmem");
+8010205c:	68 a6 88 10 80       	push   $0x801088a6
+80102061:	68 a0 36 11 80       	push   $0x801136a0
+80102066:	e8 06 35 00 00       	call   80105571 <initlock>
+  kmem.use_lock = 0;
+8010206b:	c7 05 d4 36 11 80 00 	movl   $0x0,0x801136d4
+80102072:	00 00 00 
+  freerange(vstart, vend);
+80102075:	83 c4 08             	add    $0x8,%esp
+80102078:	ff 75 0c             	push   0xc(%ebp)
+8010207b:	ff 75 08             	push   0x8(%ebp)
+8010207e:	e8 8c ff ff ff       	call   8010200f <freerange>
+}
+80102083:	83 c4 10             	add    $0x10,%esp
+80102086:	c9                   	leave
+80102087:	c3                   	ret
+
+80102088 <kinit2>:
+{
+80102088:	55                   	push   %ebp
+80102089:	89 e5                	mov    %esp,%ebp
+8010208b:	83 ec 10             	sub    $0x10,%esp
+  freerange(vstart, vend);
+8010208e:	ff 75 0c             	push   0xc(%ebp)
+80102091:	ff 75 08             	push   0x8(%ebp)
+80102094:	e8 76 ff ff ff       	call   8010200f <freerange>
+  kmem.use_lock = 1;
+80102099:	c7 05 d4 36 11 80 01 	movl   $0x1,0x801136d4
+801020a0:	00 00 00 
+}
+801020a3:	83 c4 10             	add    $0x10,%esp
+801020a6:	c9                   	leave
+801020a7:	c3                   	ret
+
+801020a8 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+801020a8:	55                   	push   %ebp
+801020a9:	89 e5                	mov    %esp,%ebp
+801020ab:	53                   	push   %ebx
+801020ac:	83 ec 04             	sub    $0x4,%esp
+  struct run *r;
+
+  if(kmem.use_lock)
+801020af:	83 3d d4 36 11 80 00 	cmpl   $0x0,0x801136d4
+801020b6:	75 21                	jne    801020d9 <kalloc+0x31>
+    acquire(&kmem.lock);
+  r = kmem.freelist;
+801020b8:	8b 1d d8 36 11 80    	mov    0x801136d8,%ebx
+  if(r)
+801020be:	85 db                	test   %ebx,%ebx
+801020c0:	74 07                	je     801020c9 <kalloc+0x21>
+    kmem.freelist = r->next;
+801020c2:	8b 03                	mov    (%ebx),%eax
+801020c4:	a3 d8 36 11 80       	mov    %eax,0x801136d8
+  if(kmem.use_lock)
+801020c9:	83 3d d4 36 11 80 00 	cmpl   $0x0,0x801136d4
+801020d0:	75 19                	jne    801020eb <kalloc+0x43>
+    release(&kmem.lock);
+  return (char*)r;
+}
+801020d2:	89 d8                	mov    %ebx,%eax
+801020d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801020d7:	c9                   	leave
+801020d8:	c3                   	ret
+    acquire(&kmem.lock);
+801020d9:	83 ec 0c             	sub    $0xc,%esp
+801020dc:	68 a0 36 11 80       	push   $0x801136a0
+801020e1:	e8 cf 35 00 00       	call   801056b5 <acquire>
+801020e6:	83 c4 10             	add    $0x10,%esp
+801020e9:	eb cd                	jmp    801020b8 <kalloc+0x10>
+    release(&kmem.lock);
+801020eb:	83 ec 0c             	sub    $0xc,%esp
+801020ee:	68 a0 36 11 80       	push   $0x801136a0
+801020f3:	e8 22 36 00 00       	call   8010571a <release>
+801020f8:	83 c4 10             	add    $0x10,%esp
+  return (char*)r;
+801020fb:	eb d5                	jmp    801020d2 <kalloc+0x2a>
+
+801020fd <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801020fd:	ba 64 00 00 00       	mov    $0x64,%edx
+80102102:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80102103:	a8 01                	test   $0x1,%al
+80102105:	0f 84 b4 00 00 00    	je     801021bf <kbdgetc+0xc2>
+8010210b:	ba 60 00 00 00       	mov    $0x60,%edx
+80102110:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+80102111:	0f b6 c8             	movzbl %al,%ecx
+
+  if(data == 0xE0){
+80102114:	3c e0                	cmp    $0xe0,%al
+80102116:	74 61                	je     80102179 <kbdgetc+0x7c>
+    shift |= E0ESC;
+    return 0;
+  } else if(data & 0x80){
+80102118:	84 c0                	test   %al,%al
+8010211a:	78 6a                	js     80102186 <kbdgetc+0x89>
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+8010211c:	8b 15 dc 36 11 80    	mov    0x801136dc,%edx
+80102122:	f6 c2 40             	test   $0x40,%dl
+80102125:	74 0f                	je     80102136 <kbdgetc+0x39>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80102127:	83 c8 80             	or     $0xffffff80,%eax
+8010212a:	0f b6 c8             	movzbl %al,%ecx
+    shift &= ~E0ESC;
+8010212d:	83 e2 bf             	and    $0xffffffbf,%edx
+80102130:	89 15 dc 36 11 80    	mov    %edx,0x801136dc
+  }
+
+  shift |= shiftcode[data];
+80102136:	0f b6 91 e0 89 10 80 	movzbl -0x7fef7620(%ecx),%edx
+8010213d:	0b 15 dc 36 11 80    	or     0x801136dc,%edx
+80102143:	89 15 dc 36 11 80    	mov    %edx,0x801136dc
+  shift ^= togglecode[data];
+80102149:	0f b6 81 e0 88 10 80 	movzbl -0x7fef7720(%ecx),%eax
+80102150:	31 c2                	xor    %eax,%edx
+80102152:	89 15 dc 36 11 80    	mov    %edx,0x801136dc
+  c = charcode[shift & (CTL | SHIFT)][data];
+80102158:	89 d0                	mov    %edx,%eax
+8010215a:	83 e0 03             	and    $0x3,%eax
+8010215d:	8b 04 85 c0 88 10 80 	mov    -0x7fef7740(,%eax,4),%eax
+80102164:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80102168:	f6 c2 08             	test   $0x8,%dl
+8010216b:	74 57                	je     801021c4 <kbdgetc+0xc7>
+    if('a' <= c && c <= 'z')
+8010216d:	8d 50 9f             	lea    -0x61(%eax),%edx
+80102170:	83 fa 19             	cmp    $0x19,%edx
+80102173:	77 3e                	ja     801021b3 <kbdgetc+0xb6>
+      c += 'A' - 'a';
+80102175:	83 e8 20             	sub    $0x20,%eax
+80102178:	c3                   	ret
+    shift |= E0ESC;
+80102179:	83 0d dc 36 11 80 40 	orl    $0x40,0x801136dc
+    return 0;
+80102180:	b8 00 00 00 00       	mov    $0x0,%eax
+80102185:	c3                   	ret
+    data = (shift & E0ESC ? data : data & 0x7F);
+80102186:	8b 15 dc 36 11 80    	mov    0x801136dc,%edx
+8010218c:	f6 c2 40             	test   $0x40,%dl
+8010218f:	75 05                	jne    80102196 <kbdgetc+0x99>
+80102191:	89 c1                	mov    %eax,%ecx
+80102193:	83 e1 7f             	and    $0x7f,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80102196:	0f b6 81 e0 89 10 80 	movzbl -0x7fef7620(%ecx),%eax
+8010219d:	83 c8 40             	or     $0x40,%eax
+801021a0:	0f b6 c0             	movzbl %al,%eax
+801021a3:	f7 d0                	not    %eax
+801021a5:	21 c2                	and    %eax,%edx
+801021a7:	89 15 dc 36 11 80    	mov    %edx,0x801136dc
+    return 0;
+801021ad:	b8 00 00 00 00       	mov    $0x0,%eax
+801021b2:	c3                   	ret
+    else if('A' <= c && c <= 'Z')
+801021b3:	8d 50 bf             	lea    -0x41(%eax),%edx
+801021b6:	83 fa 19             	cmp    $0x19,%edx
+801021b9:	77 09                	ja     801021c4 <kbdgetc+0xc7>
+      c += 'a' - 'A';
+801021bb:	83 c0 20             	add    $0x20,%eax
+  }
+  return c;
+801021be:	c3                   	ret
+    return -1;
+801021bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801021c4:	c3                   	ret
+
+801021c5 <kbdintr>:
+
+void
+kbdintr(void)
+{
+801021c5:	55                   	push   %ebp
+801021c6:	89 e5                	mov    %esp,%ebp
+801021c8:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+801021cb:	68 fd 20 10 80       	push   $0x801020fd
+801021d0:	e8 4c e5 ff ff       	call   80100721 <consoleintr>
+}
+801021d5:	83 c4 10             	add    $0x10,%esp
+801021d8:	c9                   	leave
+801021d9:	c3                   	ret
+
+801021da <shutdown>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801021da:	b8 00 00 00 00       	mov    $0x0,%eax
+801021df:	ba 01 05 00 00       	mov    $0x501,%edx
+801021e4:	ee                   	out    %al,(%dx)
+  /*
+     This only works in QEMU and assumes QEMU was run 
+     with -device isa-debug-exit
+   */
+  outb(0x501, 0x0);
+}
+801021e5:	c3                   	ret
+
+801021e6 <lapicw>:
+
+//PAGEBREAK!
+static void
+lapicw(int index, int value)
+{
+  lapic[index] = value;
+801021e6:	8b 0d e0 36 11 80    	mov    0x801136e0,%ecx
+801021ec:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+801021ef:	89 10                	mov    %edx,(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801021f1:	a1 e0 36 11 80       	mov    0x801136e0,%eax
+801021f6:	8b 40 20             	mov    0x20(%eax),%eax
+}
+801021f9:	c3                   	ret
+
+801021fa <cmos_read>:
+801021fa:	ba 70 00 00 00       	mov    $0x70,%edx
+801021ff:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102200:	ba 71 00 00 00       	mov    $0x71,%edx
+80102205:	ec                   	in     (%dx),%al
+cmos_read(uint reg)
+{
+  outb(CMOS_PORT,  reg);
+  microdelay(200);
+
+  return inb(CMOS_RETURN);
+80102206:	0f b6 c0             	movzbl %al,%eax
+}
+80102209:	c3                   	ret
+
+8010220a <fill_rtcdate>:
+
+static void
+fill_rtcdate(struct rtcdate *r)
+{
+8010220a:	55                   	push   %ebp
+8010220b:	89 e5                	mov    %esp,%ebp
+8010220d:	53                   	push   %ebx
+8010220e:	83 ec 04             	sub    $0x4,%esp
+80102211:	89 c3                	mov    %eax,%ebx
+  r->second = cmos_read(SECS);
+80102213:	b8 00 00 00 00       	mov    $0x0,%eax
+80102218:	e8 dd ff ff ff       	call   801021fa <cmos_read>
+8010221d:	89 03                	mov    %eax,(%ebx)
+  r->minute = cmos_read(MINS);
+8010221f:	b8 02 00 00 00       	mov    $0x2,%eax
+80102224:	e8 d1 ff ff ff       	call   801021fa <cmos_read>
+80102229:	89 43 04             	mov    %eax,0x4(%ebx)
+  r->hour   = cmos_read(HOURS);
+8010222c:	b8 04 00 00 00       	mov    $0x4,%eax
+80102231:	e8 c4 ff ff ff       	call   801021fa <cmos_read>
+80102236:	89 43 08             	mov    %eax,0x8(%ebx)
+  r->day    = cmos_read(DAY);
+80102239:	b8 07 00 00 00       	mov    $0x7,%eax
+8010223e:	e8 b7 ff ff ff       	call   801021fa <cmos_read>
+80102243:	89 43 0c             	mov    %eax,0xc(%ebx)
+  r->month  = cmos_read(MONTH);
+80102246:	b8 08 00 00 00       	mov    $0x8,%eax
+8010224b:	e8 aa ff ff ff       	call   801021fa <cmos_read>
+80102250:	89 43 10             	mov    %eax,0x10(%ebx)
+  r->year   = cmos_read(YEAR);
+80102253:	b8 09 00 00 00       	mov    $0x9,%eax
+80102258:	e8 9d ff ff ff       	call   801021fa <cmos_read>
+8010225d:	89 43 14             	mov    %eax,0x14(%ebx)
+}
+80102260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102263:	c9                   	leave
+80102264:	c3                   	ret
+
+80102265 <lapicinit>:
+  if(!lapic)
+80102265:	83 3d e0 36 11 80 00 	cmpl   $0x0,0x801136e0
+8010226c:	0f 84 fe 00 00 00    	je     80102370 <lapicinit+0x10b>
+{
+80102272:	55                   	push   %ebp
+80102273:	89 e5                	mov    %esp,%ebp
+80102275:	83 ec 08             	sub    $0x8,%esp
+  lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+80102278:	ba 3f 01 00 00       	mov    $0x13f,%edx
+8010227d:	b8 3c 00 00 00       	mov    $0x3c,%eax
+80102282:	e8 5f ff ff ff       	call   801021e6 <lapicw>
+  lapicw(TDCR, X1);
+80102287:	ba 0b 00 00 00       	mov    $0xb,%edx
+8010228c:	b8 f8 00 00 00       	mov    $0xf8,%eax
+80102291:	e8 50 ff ff ff       	call   801021e6 <lapicw>
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+80102296:	ba 20 00 02 00       	mov    $0x20020,%edx
+8010229b:	b8 c8 00 00 00       	mov    $0xc8,%eax
+801022a0:	e8 41 ff ff ff       	call   801021e6 <lapicw>
+  lapicw(TICR, TICK);
+801022a5:	ba 80 96 98 00       	mov    $0x989680,%edx
+801022aa:	b8 e0 00 00 00       	mov    $0xe0,%eax
+801022af:	e8 32 ff ff ff       	call   801021e6 <lapicw>
+  lapicw(LINT0, MASKED);
+801022b4:	ba 00 00 01 00       	mov    $0x10000,%edx
+801022b9:	b8 d4 00 00 00       	mov    $0xd4,%eax
+801022be:	e8 23 ff ff ff       	call   801021e6 <lapicw>
+  lapicw(LINT1, MASKED);
+801022c3:	ba 00 00 01 00       	mov    $0x10000,%edx
+801022c8:	b8 d8 00 00 00       	mov    $0xd8,%eax
+801022cd:	e8 14 ff ff ff       	call   801021e6 <lapicw>
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+801022d2:	a1 e0 36 11 80       	mov    0x801136e0,%eax
+801022d7:	8b 40 30             	mov    0x30(%eax),%eax
+801022da:	c1 e8 10             	shr    $0x10,%eax
+801022dd:	a8 fc                	test   $0xfc,%al
+801022df:	75 7b                	jne    8010235c <lapicinit+0xf7>
+  lapicw(ERROR, T_IRQ0 + IRQ_ERROR);
+801022e1:	ba 33 00 00 00       	mov    $0x33,%edx
+801022e6:	b8 dc 00 00 00       	mov    $0xdc,%eax
+801022eb:	e8 f6 fe ff ff       	call   801021e6 <lapicw>
+  lapicw(ESR, 0);
+801022f0:	ba 00 00 00 00       	mov    $0x0,%edx
+801022f5:	b8 a0 00 00 00       	mov    $0xa0,%eax
+801022fa:	e8 e7 fe ff ff       	call   801021e6 <lapicw>
+  lapicw(ESR, 0);
+801022ff:	ba 00 00 00 00       	mov    $0x0,%edx
+80102304:	b8 a0 00 00 00       	mov    $0xa0,%eax
+80102309:	e8 d8 fe ff ff       	call   801021e6 <lapicw>
+  lapicw(EOI, 0);
+8010230e:	ba 00 00 00 00       	mov    $0x0,%edx
+80102313:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80102318:	e8 c9 fe ff ff       	call   801021e6 <lapicw>
+  lapicw(ICRHI, 0);
+8010231d:	ba 00 00 00 00       	mov    $0x0,%edx
+80102322:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80102327:	e8 ba fe ff ff       	call   801021e6 <lapicw>
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+8010232c:	ba 00 85 08 00       	mov    $0x88500,%edx
+80102331:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102336:	e8 ab fe ff ff       	call   801021e6 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+8010233b:	a1 e0 36 11 80       	mov    0x801136e0,%eax
+80102340:	8b 80 00 03 00 00    	mov    0x300(%eax),%eax
+80102346:	f6 c4 10             	test   $0x10,%ah
+80102349:	75 f0                	jne    8010233b <lapicinit+0xd6>
+  lapicw(TPR, 0);
+8010234b:	ba 00 00 00 00       	mov    $0x0,%edx
+80102350:	b8 20 00 00 00       	mov    $0x20,%eax
+80102355:	e8 8c fe ff ff       	call   801021e6 <lapicw>
+}
+8010235a:	c9                   	leave
+8010235b:	c3                   	ret
+    lapicw(PCINT, MASKED);
+8010235c:	ba 00 00 01 00       	mov    $0x10000,%edx
+80102361:	b8 d0 00 00 00       	mov    $0xd0,%eax
+80102366:	e8 7b fe ff ff       	call   801021e6 <lapicw>
+8010236b:	e9 71 ff ff ff       	jmp    801022e1 <lapicinit+0x7c>
+80102370:	c3                   	ret
+
+80102371 <lapiconeshot>:
+  if(!lapic)
+80102371:	83 3d e0 36 11 80 00 	cmpl   $0x0,0x801136e0
+80102378:	74 28                	je     801023a2 <lapiconeshot+0x31>
+{
+8010237a:	55                   	push   %ebp
+8010237b:	89 e5                	mov    %esp,%ebp
+8010237d:	83 ec 08             	sub    $0x8,%esp
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+80102380:	ba 20 00 00 00       	mov    $0x20,%edx
+80102385:	b8 c8 00 00 00       	mov    $0xc8,%eax
+8010238a:	e8 57 fe ff ff       	call   801021e6 <lapicw>
+  lapicw(TICR, n * TICK);
+8010238f:	69 55 08 80 96 98 00 	imul   $0x989680,0x8(%ebp),%edx
+80102396:	b8 e0 00 00 00       	mov    $0xe0,%eax
+8010239b:	e8 46 fe ff ff       	call   801021e6 <lapicw>
+}
+801023a0:	c9                   	leave
+801023a1:	c3                   	ret
+801023a2:	c3                   	ret
+
+801023a3 <lapicid>:
+  if (!lapic)
+801023a3:	a1 e0 36 11 80       	mov    0x801136e0,%eax
+801023a8:	85 c0                	test   %eax,%eax
+801023aa:	74 07                	je     801023b3 <lapicid+0x10>
+  return lapic[ID] >> 24;
+801023ac:	8b 40 20             	mov    0x20(%eax),%eax
+801023af:	c1 e8 18             	shr    $0x18,%eax
+801023b2:	c3                   	ret
+    return 0;
+801023b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801023b8:	c3                   	ret
+
+801023b9 <lapiceoi>:
+  if(lapic)
+801023b9:	83 3d e0 36 11 80 00 	cmpl   $0x0,0x801136e0
+801023c0:	74 17                	je     801023d9 <lapiceoi+0x20>
+{
+801023c2:	55                   	push   %ebp
+801023c3:	89 e5                	mov    %esp,%ebp
+801023c5:	83 ec 08             	sub    $0x8,%esp
+    lapicw(EOI, 0);
+801023c8:	ba 00 00 00 00       	mov    $0x0,%edx
+801023cd:	b8 2c 00 00 00       	mov    $0x2c,%eax
+801023d2:	e8 0f fe ff ff       	call   801021e6 <lapicw>
+}
+801023d7:	c9                   	leave
+801023d8:	c3                   	ret
+801023d9:	c3                   	ret
+
+801023da <microdelay>:
+}
+801023da:	c3                   	ret
+
+801023db <lapicsendipi>:
+{
+801023db:	55                   	push   %ebp
+801023dc:	89 e5                	mov    %esp,%ebp
+801023de:	83 ec 08             	sub    $0x8,%esp
+  lapicw(ICRHI, apicid<<24);
+801023e1:	0f b6 55 08          	movzbl 0x8(%ebp),%edx
+801023e5:	c1 e2 18             	shl    $0x18,%edx
+801023e8:	b8 c4 00 00 00       	mov    $0xc4,%eax
+801023ed:	e8 f4 fd ff ff       	call   801021e6 <lapicw>
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+801023f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+801023f5:	80 ce 40             	or     $0x40,%dh
+801023f8:	b8 c0 00 00 00       	mov    $0xc0,%eax
+801023fd:	e8 e4 fd ff ff       	call   801021e6 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+80102402:	a1 e0 36 11 80       	mov    0x801136e0,%eax
+80102407:	8b 80 00 03 00 00    	mov    0x300(%eax),%eax
+8010240d:	f6 c4 10             	test   $0x10,%ah
+80102410:	75 f0                	jne    80102402 <lapicsendipi+0x27>
+}
+80102412:	c9                   	leave
+80102413:	c3                   	ret
+
+80102414 <lapicstartap>:
+{
+80102414:	55                   	push   %ebp
+80102415:	89 e5                	mov    %esp,%ebp
+80102417:	57                   	push   %edi
+80102418:	56                   	push   %esi
+80102419:	53                   	push   %ebx
+8010241a:	83 ec 0c             	sub    $0xc,%esp
+8010241d:	8b 75 08             	mov    0x8(%ebp),%esi
+80102420:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102423:	b8 0f 00 00 00       	mov    $0xf,%eax
+80102428:	ba 70 00 00 00       	mov    $0x70,%edx
+8010242d:	ee                   	out    %al,(%dx)
+8010242e:	b8 0a 00 00 00       	mov    $0xa,%eax
+80102433:	ba 71 00 00 00       	mov    $0x71,%edx
+80102438:	ee                   	out    %al,(%dx)
+  wrv[0] = 0;
+80102439:	66 c7 05 67 04 00 80 	movw   $0x0,0x80000467
+80102440:	00 00 
+  wrv[1] = addr >> 4;
+80102442:	89 f8                	mov    %edi,%eax
+80102444:	c1 e8 04             	shr    $0x4,%eax
+80102447:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapicw(ICRHI, apicid<<24);
+8010244d:	c1 e6 18             	shl    $0x18,%esi
+80102450:	89 f2                	mov    %esi,%edx
+80102452:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80102457:	e8 8a fd ff ff       	call   801021e6 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+8010245c:	ba 00 c5 00 00       	mov    $0xc500,%edx
+80102461:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102466:	e8 7b fd ff ff       	call   801021e6 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL);
+8010246b:	ba 00 85 00 00       	mov    $0x8500,%edx
+80102470:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102475:	e8 6c fd ff ff       	call   801021e6 <lapicw>
+  for(i = 0; i < 2; i++){
+8010247a:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010247f:	eb 21                	jmp    801024a2 <lapicstartap+0x8e>
+    lapicw(ICRHI, apicid<<24);
+80102481:	89 f2                	mov    %esi,%edx
+80102483:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80102488:	e8 59 fd ff ff       	call   801021e6 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+8010248d:	89 fa                	mov    %edi,%edx
+8010248f:	c1 ea 0c             	shr    $0xc,%edx
+80102492:	80 ce 06             	or     $0x6,%dh
+80102495:	b8 c0 00 00 00       	mov    $0xc0,%eax
+8010249a:	e8 47 fd ff ff       	call   801021e6 <lapicw>
+  for(i = 0; i < 2; i++){
+8010249f:	83 c3 01             	add    $0x1,%ebx
+801024a2:	83 fb 01             	cmp    $0x1,%ebx
+801024a5:	7e da                	jle    80102481 <lapicstartap+0x6d>
+}
+801024a7:	83 c4 0c             	add    $0xc,%esp
+801024aa:	5b                   	pop    %ebx
+801024ab:	5e                   	pop    %esi
+801024ac:	5f                   	pop    %edi
+801024ad:	5d                   	pop    %ebp
+801024ae:	c3                   	ret
+
+801024af <cmostime>:
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+801024af:	55                   	push   %ebp
+801024b0:	89 e5                	mov    %esp,%ebp
+801024b2:	57                   	push   %edi
+801024b3:	56                   	push   %esi
+801024b4:	53                   	push   %ebx
+801024b5:	83 ec 3c             	sub    $0x3c,%esp
+801024b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+801024bb:	b8 0b 00 00 00       	mov    $0xb,%eax
+801024c0:	e8 35 fd ff ff       	call   801021fa <cmos_read>
+
+  bcd = (sb & (1 << 2)) == 0;
+801024c5:	83 e0 04             	and    $0x4,%eax
+801024c8:	89 c7                	mov    %eax,%edi
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+801024ca:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801024cd:	e8 38 fd ff ff       	call   8010220a <fill_rtcdate>
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+801024d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+801024d7:	e8 1e fd ff ff       	call   801021fa <cmos_read>
+801024dc:	a8 80                	test   $0x80,%al
+801024de:	75 ea                	jne    801024ca <cmostime+0x1b>
+        continue;
+    fill_rtcdate(&t2);
+801024e0:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+801024e3:	89 d8                	mov    %ebx,%eax
+801024e5:	e8 20 fd ff ff       	call   8010220a <fill_rtcdate>
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+801024ea:	83 ec 04             	sub    $0x4,%esp
+801024ed:	6a 18                	push   $0x18
+801024ef:	53                   	push   %ebx
+801024f0:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801024f3:	50                   	push   %eax
+801024f4:	e8 ab 32 00 00       	call   801057a4 <memcmp>
+801024f9:	83 c4 10             	add    $0x10,%esp
+801024fc:	85 c0                	test   %eax,%eax
+801024fe:	75 ca                	jne    801024ca <cmostime+0x1b>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80102500:	85 ff                	test   %edi,%edi
+80102502:	75 78                	jne    8010257c <cmostime+0xcd>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80102504:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80102507:	89 c2                	mov    %eax,%edx
+80102509:	c1 ea 04             	shr    $0x4,%edx
+8010250c:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010250f:	83 e0 0f             	and    $0xf,%eax
+80102512:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102515:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    CONV(minute);
+80102518:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+8010251b:	89 c2                	mov    %eax,%edx
+8010251d:	c1 ea 04             	shr    $0x4,%edx
+80102520:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102523:	83 e0 0f             	and    $0xf,%eax
+80102526:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102529:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    CONV(hour  );
+8010252c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010252f:	89 c2                	mov    %eax,%edx
+80102531:	c1 ea 04             	shr    $0x4,%edx
+80102534:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102537:	83 e0 0f             	and    $0xf,%eax
+8010253a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+8010253d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    CONV(day   );
+80102540:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102543:	89 c2                	mov    %eax,%edx
+80102545:	c1 ea 04             	shr    $0x4,%edx
+80102548:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010254b:	83 e0 0f             	and    $0xf,%eax
+8010254e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102551:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    CONV(month );
+80102554:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102557:	89 c2                	mov    %eax,%edx
+80102559:	c1 ea 04             	shr    $0x4,%edx
+8010255c:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010255f:	83 e0 0f             	and    $0xf,%eax
+80102562:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102565:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    CONV(year  );
+80102568:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010256b:	89 c2                	mov    %eax,%edx
+8010256d:	c1 ea 04             	shr    $0x4,%edx
+80102570:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102573:	83 e0 0f             	and    $0xf,%eax
+80102576:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102579:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+8010257c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010257f:	89 06                	mov    %eax,(%esi)
+80102581:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102584:	89 46 04             	mov    %eax,0x4(%esi)
+80102587:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010258a:	89 46 08             	mov    %eax,0x8(%esi)
+8010258d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102590:	89 46 0c             	mov    %eax,0xc(%esi)
+80102593:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102596:	89 46 10             	mov    %eax,0x10(%esi)
+80102599:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010259c:	89 46 14             	mov    %eax,0x14(%esi)
+  r->year += 2000;
+8010259f:	05 d0 07 00 00       	add    $0x7d0,%eax
+801025a4:	89 46 14             	mov    %eax,0x14(%esi)
+}
+801025a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801025aa:	5b                   	pop    %ebx
+801025ab:	5e                   	pop    %esi
+801025ac:	5f                   	pop    %edi
+801025ad:	5d                   	pop    %ebp
+801025ae:	c3                   	ret
+
+801025af <read_head>:
+}
+
+// Read the log header from disk into the in-memory log header
+static void
+read_head(void)
+{
+801025af:	55                   	push   %ebp
+801025b0:	89 e5                	mov    %esp,%ebp
+801025b2:	53                   	push   %ebx
+801025b3:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+801025b6:	ff 35 34 37 11 80    	push   0x80113734
+801025bc:	ff 35 44 37 11 80    	push   0x80113744
+801025c2:	e8 c8 db ff ff       	call   8010018f <bread>
+  struct logheader *lh = (struct logheader *) (buf->data);
+  int i;
+  log.lh.n = lh->n;
+801025c7:	8b 58 5c             	mov    0x5c(%eax),%ebx
+801025ca:	89 1d 48 37 11 80    	mov    %ebx,0x80113748
+  for (i = 0; i < log.lh.n; i++) {
+801025d0:	83 c4 10             	add    $0x10,%esp
+801025d3:	ba 00 00 00 00       	mov    $0x0,%edx
+801025d8:	eb 0e                	jmp    801025e8 <read_head+0x39>
+    log.lh.block[i] = lh->block[i];
+801025da:	8b 4c 90 60          	mov    0x60(%eax,%edx,4),%ecx
+801025de:	89 0c 95 4c 37 11 80 	mov    %ecx,-0x7feec8b4(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+801025e5:	83 c2 01             	add    $0x1,%edx
+801025e8:	39 d3                	cmp    %edx,%ebx
+801025ea:	7f ee                	jg     801025da <read_head+0x2b>
+  }
+  brelse(buf);
+801025ec:	83 ec 0c             	sub    $0xc,%esp
+801025ef:	50                   	push   %eax
+801025f0:	e8 07 dc ff ff       	call   801001fc <brelse>
+}
+801025f5:	83 c4 10             	add    $0x10,%esp
+801025f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801025fb:	c9                   	leave
+801025fc:	c3                   	ret
+
+801025fd <install_trans>:
+{
+801025fd:	55                   	push   %ebp
+801025fe:	89 e5                	mov    %esp,%ebp
+80102600:	57                   	push   %edi
+80102601:	56                   	push   %esi
+80102602:	53                   	push   %ebx
+80102603:	83 ec 0c             	sub    $0xc,%esp
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102606:	be 00 00 00 00       	mov    $0x0,%esi
+8010260b:	eb 66                	jmp    80102673 <install_trans+0x76>
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+8010260d:	89 f0                	mov    %esi,%eax
+8010260f:	03 05 34 37 11 80    	add    0x80113734,%eax
+80102615:	83 c0 01             	add    $0x1,%eax
+80102618:	83 ec 08             	sub    $0x8,%esp
+8010261b:	50                   	push   %eax
+8010261c:	ff 35 44 37 11 80    	push   0x80113744
+80102622:	e8 68 db ff ff       	call   8010018f <bread>
+80102627:	89 c7                	mov    %eax,%edi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80102629:	83 c4 08             	add    $0x8,%esp
+8010262c:	ff 34 b5 4c 37 11 80 	push   -0x7feec8b4(,%esi,4)
+80102633:	ff 35 44 37 11 80    	push   0x80113744
+80102639:	e8 51 db ff ff       	call   8010018f <bread>
+8010263e:	89 c3                	mov    %eax,%ebx
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80102640:	8d 57 5c             	lea    0x5c(%edi),%edx
+80102643:	8d 40 5c             	lea    0x5c(%eax),%eax
+80102646:	83 c4 0c             	add    $0xc,%esp
+80102649:	68 00 02 00 00       	push   $0x200
+8010264e:	52                   	push   %edx
+8010264f:	50                   	push   %eax
+80102650:	e8 84 31 00 00       	call   801057d9 <memmove>
+    bwrite(dbuf);  // write dst to disk
+80102655:	89 1c 24             	mov    %ebx,(%esp)
+80102658:	e8 60 db ff ff       	call   801001bd <bwrite>
+    brelse(lbuf);
+8010265d:	89 3c 24             	mov    %edi,(%esp)
+80102660:	e8 97 db ff ff       	call   801001fc <brelse>
+    brelse(dbuf);
+80102665:	89 1c 24             	mov    %ebx,(%esp)
+80102668:	e8 8f db ff ff       	call   801001fc <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+8010266d:	83 c6 01             	add    $0x1,%esi
+80102670:	83 c4 10             	add    $0x10,%esp
+80102673:	39 35 48 37 11 80    	cmp    %esi,0x80113748
+80102679:	7f 92                	jg     8010260d <install_trans+0x10>
+}
+8010267b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010267e:	5b                   	pop    %ebx
+8010267f:	5e                   	pop    %esi
+80102680:	5f                   	pop    %edi
+80102681:	5d                   	pop    %ebp
+80102682:	c3                   	ret
+
+80102683 <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+80102683:	55                   	push   %ebp
+80102684:	89 e5                	mov    %esp,%ebp
+80102686:	53                   	push   %ebx
+80102687:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+8010268a:	ff 35 34 37 11 80    	push   0x80113734
+80102690:	ff 35 44 37 11 80    	push   0x80113744
+80102696:	e8 f4 da ff ff       	call   8010018f <bread>
+8010269b:	89 c3                	mov    %eax,%ebx
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i;
+  hb->n = log.lh.n;
+8010269d:	8b 0d 48 37 11 80    	mov    0x80113748,%ecx
+801026a3:	89 48 5c             	mov    %ecx,0x5c(%eax)
+  for (i = 0; i < log.lh.n; i++) {
+801026a6:	83 c4 10             	add    $0x10,%esp
+801026a9:	b8 00 00 00 00       	mov    $0x0,%eax
+801026ae:	eb 0e                	jmp    801026be <write_head+0x3b>
+    hb->block[i] = log.lh.block[i];
+801026b0:	8b 14 85 4c 37 11 80 	mov    -0x7feec8b4(,%eax,4),%edx
+801026b7:	89 54 83 60          	mov    %edx,0x60(%ebx,%eax,4)
+  for (i = 0; i < log.lh.n; i++) {
+801026bb:	83 c0 01             	add    $0x1,%eax
+801026be:	39 c1                	cmp    %eax,%ecx
+801026c0:	7f ee                	jg     801026b0 <write_head+0x2d>
+  }
+  bwrite(buf);
+801026c2:	83 ec 0c             	sub    $0xc,%esp
+801026c5:	53                   	push   %ebx
+801026c6:	e8 f2 da ff ff       	call   801001bd <bwrite>
+  brelse(buf);
+801026cb:	89 1c 24             	mov    %ebx,(%esp)
+801026ce:	e8 29 db ff ff       	call   801001fc <brelse>
+}
+801026d3:	83 c4 10             	add    $0x10,%esp
+801026d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801026d9:	c9                   	leave
+801026da:	c3                   	ret
+
+801026db <recover_from_log>:
+
+static void
+recover_from_log(void)
+{
+801026db:	55                   	push   %ebp
+801026dc:	89 e5                	mov    %esp,%ebp
+801026de:	83 ec 08             	sub    $0x8,%esp
+  read_head();
+801026e1:	e8 c9 fe ff ff       	call   801025af <read_head>
+  install_trans(); // if committed, copy from log to disk
+801026e6:	e8 12 ff ff ff       	call   801025fd <install_trans>
+  log.lh.n = 0;
+801026eb:	c7 05 48 37 11 80 00 	movl   $0x0,0x80113748
+801026f2:	00 00 00 
+  write_head(); // clear the log
+801026f5:	e8 89 ff ff ff       	call   80102683 <write_head>
+}
+801026fa:	c9                   	leave
+801026fb:	c3                   	ret
+
+801026fc <write_log>:
+}
+
+// Copy modified blocks from cache to log.
+static void
+write_log(void)
+{
+801026fc:	55                   	push   %ebp
+801026fd:	89 e5                	mov    %esp,%ebp
+801026ff:	57                   	push   %edi
+80102700:	56                   	push   %esi
+80102701:	53                   	push   %ebx
+80102702:	83 ec 0c             	sub    $0xc,%esp
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102705:	be 00 00 00 00       	mov    $0x0,%esi
+8010270a:	eb 66                	jmp    80102772 <write_log+0x76>
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+8010270c:	89 f0                	mov    %esi,%eax
+8010270e:	03 05 34 37 11 80    	add    0x80113734,%eax
+80102714:	83 c0 01             	add    $0x1,%eax
+80102717:	83 ec 08             	sub    $0x8,%esp
+8010271a:	50                   	push   %eax
+8010271b:	ff 35 44 37 11 80    	push   0x80113744
+80102721:	e8 69 da ff ff       	call   8010018f <bread>
+80102726:	89 c3                	mov    %eax,%ebx
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80102728:	83 c4 08             	add    $0x8,%esp
+8010272b:	ff 34 b5 4c 37 11 80 	push   -0x7feec8b4(,%esi,4)
+80102732:	ff 35 44 37 11 80    	push   0x80113744
+80102738:	e8 52 da ff ff       	call   8010018f <bread>
+8010273d:	89 c7                	mov    %eax,%edi
+    memmove(to->data, from->data, BSIZE);
+8010273f:	8d 50 5c             	lea    0x5c(%eax),%edx
+80102742:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80102745:	83 c4 0c             	add    $0xc,%esp
+80102748:	68 00 02 00 00       	push   $0x200
+8010274d:	52                   	push   %edx
+8010274e:	50                   	push   %eax
+8010274f:	e8 85 30 00 00       	call   801057d9 <memmove>
+    bwrite(to);  // write the log
+80102754:	89 1c 24             	mov    %ebx,(%esp)
+80102757:	e8 61 da ff ff       	call   801001bd <bwrite>
+    brelse(from);
+8010275c:	89 3c 24             	mov    %edi,(%esp)
+8010275f:	e8 98 da ff ff       	call   801001fc <brelse>
+    brelse(to);
+80102764:	89 1c 24             	mov    %ebx,(%esp)
+80102767:	e8 90 da ff ff       	call   801001fc <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+8010276c:	83 c6 01             	add    $0x1,%esi
+8010276f:	83 c4 10             	add    $0x10,%esp
+80102772:	39 35 48 37 11 80    	cmp    %esi,0x80113748
+80102778:	7f 92                	jg     8010270c <write_log+0x10>
+  }
+}
+8010277a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010277d:	5b                   	pop    %ebx
+8010277e:	5e                   	pop    %esi
+8010277f:	5f                   	pop    %edi
+80102780:	5d                   	pop    %ebp
+80102781:	c3                   	ret
+
+80102782 <commit>:
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+80102782:	83 3d 48 37 11 80 00 	cmpl   $0x0,0x80113748
+80102789:	7f 01                	jg     8010278c <commit+0xa>
+8010278b:	c3                   	ret
+{
+8010278c:	55                   	push   %ebp
+8010278d:	89 e5                	mov    %esp,%ebp
+8010278f:	83 ec 08             	sub    $0x8,%esp
+    write_log();     // Write modified blocks from cache to log
+80102792:	e8 65 ff ff ff       	call   801026fc <write_log>
+    write_head();    // Write header to disk -- the real commit
+80102797:	e8 e7 fe ff ff       	call   80102683 <write_head>
+    install_trans(); // Now install writes to home locations
+8010279c:	e8 5c fe ff ff       	call   801025fd <install_trans>
+    log.lh.n = 0;
+801027a1:	c7 05 48 37 11 80 00 	movl   $0x0,0x80113748
+801027a8:	00 00 00 
+    write_head();    // Erase the transaction from the log
+801027ab:	e8 d3 fe ff ff       	call   80102683 <write_head>
+  }
+}
+801027b0:	c9                   	leave
+801027b1:	c3                   	ret
+
+801027b2 <initlog>:
+{
+801027b2:	55                   	push   %ebp
+801027b3:	89 e5                	mov    %esp,%ebp
+801027b5:	53                   	push   %ebx
+801027b6:	83 ec 2c             	sub    $0x2c,%esp
+801027b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+801027bc:	68 f1 8c 10 80       	push   $0x80108cf1
+801027c1:	68 00 37 11 80       	push   $0x80113700
+801027c6:	e8 a6 2d 00 00       	call   80105571 <initlock>
+  readsb(dev, &sb);
+801027cb:	83 c4 08             	add    $0x8,%esp
+801027ce:	8d 45 dc             	lea    -0x24(%ebp),%eax
+801027d1:	50                   	push   %eax
+801027d2:	53                   	push   %ebx
+801027d3:	e8 aa ea ff ff       	call   80101282 <readsb>
+  log.start = sb.logstart;
+801027d8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801027db:	a3 34 37 11 80       	mov    %eax,0x80113734
+  log.size = sb.nlog;
+801027e0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+801027e3:	a3 38 37 11 80       	mov    %eax,0x80113738
+  log.dev = dev;
+801027e8:	89 1d 44 37 11 80    	mov    %ebx,0x80113744
+  recover_from_log();
+801027ee:	e8 e8 fe ff ff       	call   801026db <recover_from_log>
+}
+801027f3:	83 c4 10             	add    $0x10,%esp
+801027f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801027f9:	c9                   	leave
+801027fa:	c3                   	ret
+
+801027fb <begin_op>:
+{
+801027fb:	55                   	push   %ebp
+801027fc:	89 e5                	mov    %esp,%ebp
+801027fe:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80102801:	68 00 37 11 80       	push   $0x80113700
+80102806:	e8 aa 2e 00 00       	call   801056b5 <acquire>
+8010280b:	83 c4 10             	add    $0x10,%esp
+8010280e:	eb 15                	jmp    80102825 <begin_op+0x2a>
+      sleep(&log, &log.lock);
+80102810:	83 ec 08             	sub    $0x8,%esp
+80102813:	68 00 37 11 80       	push   $0x80113700
+80102818:	68 00 37 11 80       	push   $0x80113700
+8010281d:	e8 e7 1e 00 00       	call   80104709 <sleep>
+80102822:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+80102825:	83 3d 40 37 11 80 00 	cmpl   $0x0,0x80113740
+8010282c:	75 e2                	jne    80102810 <begin_op+0x15>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+8010282e:	a1 3c 37 11 80       	mov    0x8011373c,%eax
+80102833:	83 c0 01             	add    $0x1,%eax
+80102836:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80102839:	8d 14 09             	lea    (%ecx,%ecx,1),%edx
+8010283c:	03 15 48 37 11 80    	add    0x80113748,%edx
+80102842:	83 fa 1e             	cmp    $0x1e,%edx
+80102845:	7e 17                	jle    8010285e <begin_op+0x63>
+      sleep(&log, &log.lock);
+80102847:	83 ec 08             	sub    $0x8,%esp
+8010284a:	68 00 37 11 80       	push   $0x80113700
+8010284f:	68 00 37 11 80       	push   $0x80113700
+80102854:	e8 b0 1e 00 00       	call   80104709 <sleep>
+80102859:	83 c4 10             	add    $0x10,%esp
+8010285c:	eb c7                	jmp    80102825 <begin_op+0x2a>
+      log.outstanding += 1;
+8010285e:	a3 3c 37 11 80       	mov    %eax,0x8011373c
+      release(&log.lock);
+80102863:	83 ec 0c             	sub    $0xc,%esp
+80102866:	68 00 37 11 80       	push   $0x80113700
+8010286b:	e8 aa 2e 00 00       	call   8010571a <release>
+}
+80102870:	83 c4 10             	add    $0x10,%esp
+80102873:	c9                   	leave
+80102874:	c3                   	ret
+
+80102875 <end_op>:
+{
+80102875:	55                   	push   %ebp
+80102876:	89 e5                	mov    %esp,%ebp
+80102878:	53                   	push   %ebx
+80102879:	83 ec 10             	sub    $0x10,%esp
+  acquire(&log.lock);
+8010287c:	68 00 37 11 80       	push   $0x80113700
+80102881:	e8 2f 2e 00 00       	call   801056b5 <acquire>
+  log.outstanding -= 1;
+80102886:	a1 3c 37 11 80       	mov    0x8011373c,%eax
+8010288b:	83 e8 01             	sub    $0x1,%eax
+8010288e:	a3 3c 37 11 80       	mov    %eax,0x8011373c
+  if(log.committing)
+80102893:	8b 1d 40 37 11 80    	mov    0x80113740,%ebx
+80102899:	83 c4 10             	add    $0x10,%esp
+8010289c:	85 db                	test   %ebx,%ebx
+8010289e:	75 2c                	jne    801028cc <end_op+0x57>
+  if(log.outstanding == 0){
+801028a0:	85 c0                	test   %eax,%eax
+801028a2:	75 35                	jne    801028d9 <end_op+0x64>
+    log.committing = 1;
+801028a4:	c7 05 40 37 11 80 01 	movl   $0x1,0x80113740
+801028ab:	00 00 00 
+    do_commit = 1;
+801028ae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  release(&log.lock);
+801028b3:	83 ec 0c             	sub    $0xc,%esp
+801028b6:	68 00 37 11 80       	push   $0x80113700
+801028bb:	e8 5a 2e 00 00       	call   8010571a <release>
+  if(do_commit){
+801028c0:	83 c4 10             	add    $0x10,%esp
+801028c3:	85 db                	test   %ebx,%ebx
+801028c5:	75 24                	jne    801028eb <end_op+0x76>
+}
+801028c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801028ca:	c9                   	leave
+801028cb:	c3                   	ret
+    panic("log.committing");
+801028cc:	83 ec 0c             	sub    $0xc,%esp
+801028cf:	68 e0 8a 10 80       	push   $0x80108ae0
+801028d4:	e8 95 da ff ff       	call   8010036e <panic>
+    wakeup(&log);
+801028d9:	83 ec 0c             	sub    $0xc,%esp
+801028dc:	68 00 37 11 80       	push   $0x80113700
+801028e1:	e8 b6 1f 00 00       	call   8010489c <wakeup>
+801028e6:	83 c4 10             	add    $0x10,%esp
+801028e9:	eb c8                	jmp    801028b3 <end_op+0x3e>
+    commit();
+801028eb:	e8 92 fe ff ff       	call   80102782 <commit>
+    acquire(&log.lock);
+801028f0:	83 ec 0c             	sub    $0xc,%esp
+801028f3:	68 00 37 11 80       	push   $0x80113700
+801028f8:	e8 b8 2d 00 00       	call   801056b5 <acquire>
+    log.committing = 0;
+801028fd:	c7 05 40 37 11 80 00 	movl   $0x0,0x80113740
+80102904:	00 00 00 
+    wakeup(&log);
+80102907:	c7 04 24 00 37 11 80 	movl   $0x80113700,(%esp)
+8010290e:	e8 89 1f 00 00       	call   8010489c <wakeup>
+    release(&log.lock);
+80102913:	c7 04 24 00 37 11 80 	movl   $0x80113700,(%esp)
+8010291a:	e8 fb 2d 00 00       	call   8010571a <release>
+8010291f:	83 c4 10             	add    $0x10,%esp
+}
+80102922:	eb a3                	jmp    801028c7 <end_op+0x52>
+
+80102924 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80102924:	55                   	push   %ebp
+80102925:	89 e5                	mov    %esp,%ebp
+80102927:	53                   	push   %ebx
+80102928:	83 ec 04             	sub    $0x4,%esp
+8010292b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+8010292e:	8b 15 48 37 11 80    	mov    0x80113748,%edx
+80102934:	83 fa 1d             	cmp    $0x1d,%edx
+80102937:	7f 2c                	jg     80102965 <log_write+0x41>
+80102939:	a1 38 37 11 80       	mov    0x80113738,%eax
+8010293e:	83 e8 01             	sub    $0x1,%eax
+80102941:	39 c2                	cmp    %eax,%edx
+80102943:	7d 20                	jge    80102965 <log_write+0x41>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80102945:	83 3d 3c 37 11 80 00 	cmpl   $0x0,0x8011373c
+8010294c:	7e 24                	jle    80102972 <log_write+0x4e>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+8010294e:	83 ec 0c             	sub    $0xc,%esp
+80102951:	68 00 37 11 80       	push   $0x80113700
+80102956:	e8 5a 2d 00 00       	call   801056b5 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+8010295b:	83 c4 10             	add    $0x10,%esp
+8010295e:	b8 00 00 00 00       	mov    $0x0,%eax
+80102963:	eb 1d                	jmp    80102982 <log_write+0x5e>
+    panic("too big a transaction");
+80102965:	83 ec 0c             	sub    $0xc,%esp
+80102968:	68 ef 8a 10 80       	push   $0x80108aef
+8010296d:	e8 fc d9 ff ff       	call   8010036e <panic>
+    panic("log_write outside of trans");
+80102972:	83 ec 0c             	sub    $0xc,%esp
+80102975:	68 05 8b 10 80       	push   $0x80108b05
+8010297a:	e8 ef d9 ff ff       	call   8010036e <panic>
+  for (i = 0; i < log.lh.n; i++) {
+8010297f:	83 c0 01             	add    $0x1,%eax
+80102982:	8b 15 48 37 11 80    	mov    0x80113748,%edx
+80102988:	39 c2                	cmp    %eax,%edx
+8010298a:	7e 0c                	jle    80102998 <log_write+0x74>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+8010298c:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010298f:	39 0c 85 4c 37 11 80 	cmp    %ecx,-0x7feec8b4(,%eax,4)
+80102996:	75 e7                	jne    8010297f <log_write+0x5b>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80102998:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010299b:	89 0c 85 4c 37 11 80 	mov    %ecx,-0x7feec8b4(,%eax,4)
+  if (i == log.lh.n)
+801029a2:	39 c2                	cmp    %eax,%edx
+801029a4:	74 1c                	je     801029c2 <log_write+0x9e>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+801029a6:	8b 03                	mov    (%ebx),%eax
+801029a8:	83 c8 04             	or     $0x4,%eax
+801029ab:	89 03                	mov    %eax,(%ebx)
+  release(&log.lock);
+801029ad:	83 ec 0c             	sub    $0xc,%esp
+801029b0:	68 00 37 11 80       	push   $0x80113700
+801029b5:	e8 60 2d 00 00       	call   8010571a <release>
+}
+801029ba:	83 c4 10             	add    $0x10,%esp
+801029bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801029c0:	c9                   	leave
+801029c1:	c3                   	ret
+    log.lh.n++;
+801029c2:	83 c2 01             	add    $0x1,%edx
+801029c5:	89 15 48 37 11 80    	mov    %edx,0x80113748
+801029cb:	eb d9                	jmp    801029a6 <log_write+0x82>
+
+801029cd <startothers>:
+pde_t entrypgdir[];  // For entry.S
+
+// Start the non-boot (AP) processors.
+static void
+startothers(void)
+{
+801029cd:	55                   	push   %ebp
+801029ce:	89 e5                	mov    %esp,%ebp
+801029d0:	53                   	push   %ebx
+801029d1:	83 ec 08             	sub    $0x8,%esp
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+801029d4:	68 8a 00 00 00       	push   $0x8a
+801029d9:	68 ec c4 10 80       	push   $0x8010c4ec
+801029de:	68 00 70 00 80       	push   $0x80007000
+801029e3:	e8 f1 2d 00 00       	call   801057d9 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+801029e8:	83 c4 10             	add    $0x10,%esp
+801029eb:	bb 00 38 11 80       	mov    $0x80113800,%ebx
+801029f0:	eb 13                	jmp    80102a05 <startothers+0x38>
+801029f2:	83 ec 0c             	sub    $0xc,%esp
+801029f5:	68 08 88 10 80       	push   $0x80108808
+801029fa:	e8 6f d9 ff ff       	call   8010036e <panic>
+801029ff:	81 c3 d8 00 00 00    	add    $0xd8,%ebx
+80102a05:	69 05 e4 37 11 80 d8 	imul   $0xd8,0x801137e4,%eax
+80102a0c:	00 00 00 
+80102a0f:	05 00 38 11 80       	add    $0x80113800,%eax
+80102a14:	39 c3                	cmp    %eax,%ebx
+80102a16:	73 58                	jae    80102a70 <startothers+0xa3>
+    if(c == mycpu())  // We've started already.
+80102a18:	e8 e6 11 00 00       	call   80103c03 <mycpu>
+80102a1d:	39 c3                	cmp    %eax,%ebx
+80102a1f:	74 de                	je     801029ff <startothers+0x32>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80102a21:	e8 82 f6 ff ff       	call   801020a8 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80102a26:	05 00 10 00 00       	add    $0x1000,%eax
+80102a2b:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    *(void(**)(void))(code-8) = mpenter;
+80102a30:	c7 05 f8 6f 00 80 b4 	movl   $0x80102ab4,0x80006ff8
+80102a37:	2a 10 80 
+    if (a < (void*) KERNBASE)
+80102a3a:	b8 00 b0 10 80       	mov    $0x8010b000,%eax
+80102a3f:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80102a44:	76 ac                	jbe    801029f2 <startothers+0x25>
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80102a46:	c7 05 f4 6f 00 80 00 	movl   $0x10b000,0x80006ff4
+80102a4d:	b0 10 00 
+
+    lapicstartap(c->apicid, V2P(code));
+80102a50:	83 ec 08             	sub    $0x8,%esp
+80102a53:	68 00 70 00 00       	push   $0x7000
+80102a58:	0f b6 03             	movzbl (%ebx),%eax
+80102a5b:	50                   	push   %eax
+80102a5c:	e8 b3 f9 ff ff       	call   80102414 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80102a61:	83 c4 10             	add    $0x10,%esp
+80102a64:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80102a6a:	85 c0                	test   %eax,%eax
+80102a6c:	74 f6                	je     80102a64 <startothers+0x97>
+80102a6e:	eb 8f                	jmp    801029ff <startothers+0x32>
+      ;
+  }
+}
+80102a70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102a73:	c9                   	leave
+80102a74:	c3                   	ret
+
+80102a75 <mpmain>:
+{
+80102a75:	55                   	push   %ebp
+80102a76:	89 e5                	mov    %esp,%ebp
+80102a78:	53                   	push   %ebx
+80102a79:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+80102a7c:	e8 82 12 00 00       	call   80103d03 <cpuid>
+80102a81:	89 c3                	mov    %eax,%ebx
+80102a83:	e8 7b 12 00 00       	call   80103d03 <cpuid>
+80102a88:	83 ec 04             	sub    $0x4,%esp
+80102a8b:	53                   	push   %ebx
+80102a8c:	50                   	push   %eax
+80102a8d:	68 20 8b 10 80       	push   $0x80108b20
+80102a92:	e8 98 db ff ff       	call   8010062f <cprintf>
+  idtinit();       // load idt register
+80102a97:	e8 8e 41 00 00       	call   80106c2a <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80102a9c:	e8 62 11 00 00       	call   80103c03 <mycpu>
+80102aa1:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+80102aa3:	b8 01 00 00 00       	mov    $0x1,%eax
+80102aa8:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+80102aaf:	e8 39 18 00 00       	call   801042ed <scheduler>
+
+80102ab4 <mpenter>:
+{
+80102ab4:	55                   	push   %ebp
+80102ab5:	89 e5                	mov    %esp,%ebp
+80102ab7:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80102aba:	e8 4c 53 00 00       	call   80107e0b <switchkvm>
+  seginit();
+80102abf:	e8 d2 50 00 00       	call   80107b96 <seginit>
+  lapicinit();
+80102ac4:	e8 9c f7 ff ff       	call   80102265 <lapicinit>
+  mpmain();
+80102ac9:	e8 a7 ff ff ff       	call   80102a75 <mpmain>
+
+80102ace <main>:
+{
+80102ace:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80102ad2:	83 e4 f0             	and    $0xfffffff0,%esp
+80102ad5:	ff 71 fc             	push   -0x4(%ecx)
+80102ad8:	55                   	push   %ebp
+80102ad9:	89 e5                	mov    %esp,%ebp
+80102adb:	51                   	push   %ecx
+80102adc:	83 ec 0c             	sub    $0xc,%esp
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+80102adf:	68 00 00 40 80       	push   $0x80400000
+80102ae4:	68 00 31 15 80       	push   $0x80153100
+80102ae9:	e8 68 f5 ff ff       	call   80102056 <kinit1>
+  kvmalloc();      // kernel page table
+80102aee:	e8 74 58 00 00       	call   80108367 <kvmalloc>
+  mpinit();        // detect other processors
+80102af3:	e8 db 01 00 00       	call   80102cd3 <mpinit>
+  lapicinit();     // interrupt controller
+80102af8:	e8 68 f7 ff ff       	call   80102265 <lapicinit>
+  seginit();       // segment descriptors
+80102afd:	e8 94 50 00 00       	call   80107b96 <seginit>
+  picinit();       // disable pic
+80102b02:	e8 a2 02 00 00       	call   80102da9 <picinit>
+  ioapicinit();    // another interrupt controller
+80102b07:	e8 b0 f3 ff ff       	call   80101ebc <ioapicinit>
+  consoleinit();   // console hardware
+80102b0c:	e8 67 dd ff ff       	call   80100878 <consoleinit>
+  uartinit();      // serial port
+80102b11:	e8 45 44 00 00       	call   80106f5b <uartinit>
+  pinit();         // process table
+80102b16:	e8 73 10 00 00       	call   80103b8e <pinit>
+  tvinit();        // trap vectors
+80102b1b:	e8 05 40 00 00       	call   80106b25 <tvinit>
+  binit();         // buffer cache
+80102b20:	e8 f2 d5 ff ff       	call   80100117 <binit>
+  fileinit();      // file table
+80102b25:	e8 be e0 ff ff       	call   80100be8 <fileinit>
+  ideinit();       // disk 
+80102b2a:	e8 94 f1 ff ff       	call   80101cc3 <ideinit>
+  startothers();   // start other processors
+80102b2f:	e8 99 fe ff ff       	call   801029cd <startothers>
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80102b34:	83 c4 08             	add    $0x8,%esp
+80102b37:	68 00 00 00 8e       	push   $0x8e000000
+80102b3c:	68 00 00 40 80       	push   $0x80400000
+80102b41:	e8 42 f5 ff ff       	call   80102088 <kinit2>
+  userinit();      // first user process
+80102b46:	e8 a6 14 00 00       	call   80103ff1 <userinit>
+  mpmain();        // finish this processor's setup
+80102b4b:	e8 25 ff ff ff       	call   80102a75 <mpmain>
+
+80102b50 <sum>:
+int ncpu;
+uchar ioapicid;
+
+static uchar
+sum(uchar *addr, int len)
+{
+80102b50:	55                   	push   %ebp
+80102b51:	89 e5                	mov    %esp,%ebp
+80102b53:	56                   	push   %esi
+80102b54:	53                   	push   %ebx
+80102b55:	89 c6                	mov    %eax,%esi
+  int i, sum;
+
+  sum = 0;
+80102b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  for(i=0; i<len; i++)
+80102b5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+80102b61:	eb 09                	jmp    80102b6c <sum+0x1c>
+    sum += addr[i];
+80102b63:	0f b6 1c 0e          	movzbl (%esi,%ecx,1),%ebx
+80102b67:	01 d8                	add    %ebx,%eax
+  for(i=0; i<len; i++)
+80102b69:	83 c1 01             	add    $0x1,%ecx
+80102b6c:	39 d1                	cmp    %edx,%ecx
+80102b6e:	7c f3                	jl     80102b63 <sum+0x13>
+  return sum;
+}
+80102b70:	5b                   	pop    %ebx
+80102b71:	5e                   	pop    %esi
+80102b72:	5d                   	pop    %ebp
+80102b73:	c3                   	ret
+
+80102b74 <mpsearch1>:
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80102b74:	55                   	push   %ebp
+80102b75:	89 e5                	mov    %esp,%ebp
+80102b77:	56                   	push   %esi
+80102b78:	53                   	push   %ebx
+}
+
+// Convert physical address to kernel virtual address
+static inline void *P2V(uint a) {
+    extern void panic(char*) __attribute__((noreturn));
+    if (a > KERNBASE)
+80102b79:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+80102b7e:	77 0b                	ja     80102b8b <mpsearch1+0x17>
+        panic("P2V on address > KERNBASE");
+    return (char*)a + KERNBASE;
+80102b80:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+  e = addr+len;
+80102b86:	8d 34 13             	lea    (%ebx,%edx,1),%esi
+  for(p = addr; p < e; p += sizeof(struct mp))
+80102b89:	eb 10                	jmp    80102b9b <mpsearch1+0x27>
+        panic("P2V on address > KERNBASE");
+80102b8b:	83 ec 0c             	sub    $0xc,%esp
+80102b8e:	68 34 8b 10 80       	push   $0x80108b34
+80102b93:	e8 d6 d7 ff ff       	call   8010036e <panic>
+80102b98:	83 c3 10             	add    $0x10,%ebx
+80102b9b:	39 f3                	cmp    %esi,%ebx
+80102b9d:	73 29                	jae    80102bc8 <mpsearch1+0x54>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80102b9f:	83 ec 04             	sub    $0x4,%esp
+80102ba2:	6a 04                	push   $0x4
+80102ba4:	68 4e 8b 10 80       	push   $0x80108b4e
+80102ba9:	53                   	push   %ebx
+80102baa:	e8 f5 2b 00 00       	call   801057a4 <memcmp>
+80102baf:	83 c4 10             	add    $0x10,%esp
+80102bb2:	85 c0                	test   %eax,%eax
+80102bb4:	75 e2                	jne    80102b98 <mpsearch1+0x24>
+80102bb6:	ba 10 00 00 00       	mov    $0x10,%edx
+80102bbb:	89 d8                	mov    %ebx,%eax
+80102bbd:	e8 8e ff ff ff       	call   80102b50 <sum>
+80102bc2:	84 c0                	test   %al,%al
+80102bc4:	75 d2                	jne    80102b98 <mpsearch1+0x24>
+80102bc6:	eb 05                	jmp    80102bcd <mpsearch1+0x59>
+      return (struct mp*)p;
+  return 0;
+80102bc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+80102bcd:	89 d8                	mov    %ebx,%eax
+80102bcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102bd2:	5b                   	pop    %ebx
+80102bd3:	5e                   	pop    %esi
+80102bd4:	5d                   	pop    %ebp
+80102bd5:	c3                   	ret
+
+80102bd6 <mpsearch>:
+// 1) in the first KB of the EBDA;
+// 2) in the last KB of system base memory;
+// 3) in the BIOS ROM between 0xE0000 and 0xFFFFF.
+static struct mp*
+mpsearch(void)
+{
+80102bd6:	55                   	push   %ebp
+80102bd7:	89 e5                	mov    %esp,%ebp
+80102bd9:	83 ec 08             	sub    $0x8,%esp
+  uchar *bda;
+  uint p;
+  struct mp *mp;
+
+  bda = (uchar *) P2V(0x400);
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80102bdc:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80102be3:	c1 e0 08             	shl    $0x8,%eax
+80102be6:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80102bed:	09 d0                	or     %edx,%eax
+80102bef:	c1 e0 04             	shl    $0x4,%eax
+80102bf2:	74 1f                	je     80102c13 <mpsearch+0x3d>
+    if((mp = mpsearch1(p, 1024)))
+80102bf4:	ba 00 04 00 00       	mov    $0x400,%edx
+80102bf9:	e8 76 ff ff ff       	call   80102b74 <mpsearch1>
+80102bfe:	85 c0                	test   %eax,%eax
+80102c00:	75 0f                	jne    80102c11 <mpsearch+0x3b>
+  } else {
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+    if((mp = mpsearch1(p-1024, 1024)))
+      return mp;
+  }
+  return mpsearch1(0xF0000, 0x10000);
+80102c02:	ba 00 00 01 00       	mov    $0x10000,%edx
+80102c07:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+80102c0c:	e8 63 ff ff ff       	call   80102b74 <mpsearch1>
+}
+80102c11:	c9                   	leave
+80102c12:	c3                   	ret
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80102c13:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80102c1a:	c1 e0 08             	shl    $0x8,%eax
+80102c1d:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+80102c24:	09 d0                	or     %edx,%eax
+80102c26:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80102c29:	2d 00 04 00 00       	sub    $0x400,%eax
+80102c2e:	ba 00 04 00 00       	mov    $0x400,%edx
+80102c33:	e8 3c ff ff ff       	call   80102b74 <mpsearch1>
+80102c38:	85 c0                	test   %eax,%eax
+80102c3a:	75 d5                	jne    80102c11 <mpsearch+0x3b>
+80102c3c:	eb c4                	jmp    80102c02 <mpsearch+0x2c>
+
+80102c3e <mpconfig>:
+// Check for correct signature, calculate the checksum and,
+// if correct, check the version.
+// To do: check extended table checksum.
+static struct mpconf*
+mpconfig(struct mp **pmp)
+{
+80102c3e:	55                   	push   %ebp
+80102c3f:	89 e5                	mov    %esp,%ebp
+80102c41:	57                   	push   %edi
+80102c42:	56                   	push   %esi
+80102c43:	53                   	push   %ebx
+80102c44:	83 ec 0c             	sub    $0xc,%esp
+80102c47:	89 c7                	mov    %eax,%edi
+  struct mpconf *conf;
+  struct mp *mp;
+
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80102c49:	e8 88 ff ff ff       	call   80102bd6 <mpsearch>
+80102c4e:	89 c6                	mov    %eax,%esi
+80102c50:	85 c0                	test   %eax,%eax
+80102c52:	74 66                	je     80102cba <mpconfig+0x7c>
+80102c54:	8b 58 04             	mov    0x4(%eax),%ebx
+80102c57:	85 db                	test   %ebx,%ebx
+80102c59:	74 48                	je     80102ca3 <mpconfig+0x65>
+    if (a > KERNBASE)
+80102c5b:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+80102c61:	77 4a                	ja     80102cad <mpconfig+0x6f>
+    return (char*)a + KERNBASE;
+80102c63:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+    return 0;
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+  if(memcmp(conf, "PCMP", 4) != 0)
+80102c69:	83 ec 04             	sub    $0x4,%esp
+80102c6c:	6a 04                	push   $0x4
+80102c6e:	68 53 8b 10 80       	push   $0x80108b53
+80102c73:	53                   	push   %ebx
+80102c74:	e8 2b 2b 00 00       	call   801057a4 <memcmp>
+80102c79:	83 c4 10             	add    $0x10,%esp
+80102c7c:	85 c0                	test   %eax,%eax
+80102c7e:	75 3e                	jne    80102cbe <mpconfig+0x80>
+    return 0;
+  if(conf->version != 1 && conf->version != 4)
+80102c80:	0f b6 43 06          	movzbl 0x6(%ebx),%eax
+80102c84:	3c 01                	cmp    $0x1,%al
+80102c86:	0f 95 c2             	setne  %dl
+80102c89:	3c 04                	cmp    $0x4,%al
+80102c8b:	0f 95 c0             	setne  %al
+80102c8e:	84 c2                	test   %al,%dl
+80102c90:	75 33                	jne    80102cc5 <mpconfig+0x87>
+    return 0;
+  if(sum((uchar*)conf, conf->length) != 0)
+80102c92:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+80102c96:	89 d8                	mov    %ebx,%eax
+80102c98:	e8 b3 fe ff ff       	call   80102b50 <sum>
+80102c9d:	84 c0                	test   %al,%al
+80102c9f:	75 2b                	jne    80102ccc <mpconfig+0x8e>
+    return 0;
+  *pmp = mp;
+80102ca1:	89 37                	mov    %esi,(%edi)
+  return conf;
+}
+80102ca3:	89 d8                	mov    %ebx,%eax
+80102ca5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102ca8:	5b                   	pop    %ebx
+80102ca9:	5e                   	pop    %esi
+80102caa:	5f                   	pop    %edi
+80102cab:	5d                   	pop    %ebp
+80102cac:	c3                   	ret
+        panic("P2V on address > KERNBASE");
+80102cad:	83 ec 0c             	sub    $0xc,%esp
+80102cb0:	68 34 8b 10 80       	push   $0x80108b34
+80102cb5:	e8 b4 d6 ff ff       	call   8010036e <panic>
+    return 0;
+80102cba:	89 c3                	mov    %eax,%ebx
+80102cbc:	eb e5                	jmp    80102ca3 <mpconfig+0x65>
+    return 0;
+80102cbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102cc3:	eb de                	jmp    80102ca3 <mpconfig+0x65>
+    return 0;
+80102cc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102cca:	eb d7                	jmp    80102ca3 <mpconfig+0x65>
+    return 0;
+80102ccc:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102cd1:	eb d0                	jmp    80102ca3 <mpconfig+0x65>
+
+80102cd3 <mpinit>:
+
+void
+mpinit(void)
+{
+80102cd3:	55                   	push   %ebp
+80102cd4:	89 e5                	mov    %esp,%ebp
+80102cd6:	57                   	push   %edi
+80102cd7:	56                   	push   %esi
+80102cd8:	53                   	push   %ebx
+80102cd9:	83 ec 1c             	sub    $0x1c,%esp
+  struct mp *mp;
+  struct mpconf *conf;
+  struct mpproc *proc;
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+80102cdc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80102cdf:	e8 5a ff ff ff       	call   80102c3e <mpconfig>
+80102ce4:	85 c0                	test   %eax,%eax
+80102ce6:	74 19                	je     80102d01 <mpinit+0x2e>
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80102ce8:	8b 50 24             	mov    0x24(%eax),%edx
+80102ceb:	89 15 e0 36 11 80    	mov    %edx,0x801136e0
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80102cf1:	8d 50 2c             	lea    0x2c(%eax),%edx
+80102cf4:	0f b7 48 04          	movzwl 0x4(%eax),%ecx
+80102cf8:	01 c1                	add    %eax,%ecx
+  ismp = 1;
+80102cfa:	bb 01 00 00 00       	mov    $0x1,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80102cff:	eb 20                	jmp    80102d21 <mpinit+0x4e>
+    panic("Expect to run on an SMP");
+80102d01:	83 ec 0c             	sub    $0xc,%esp
+80102d04:	68 58 8b 10 80       	push   $0x80108b58
+80102d09:	e8 60 d6 ff ff       	call   8010036e <panic>
+    switch(*p){
+80102d0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102d13:	eb 0c                	jmp    80102d21 <mpinit+0x4e>
+80102d15:	83 e8 03             	sub    $0x3,%eax
+80102d18:	3c 01                	cmp    $0x1,%al
+80102d1a:	76 1a                	jbe    80102d36 <mpinit+0x63>
+80102d1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80102d21:	39 ca                	cmp    %ecx,%edx
+80102d23:	73 4d                	jae    80102d72 <mpinit+0x9f>
+    switch(*p){
+80102d25:	0f b6 02             	movzbl (%edx),%eax
+80102d28:	3c 02                	cmp    $0x2,%al
+80102d2a:	74 38                	je     80102d64 <mpinit+0x91>
+80102d2c:	77 e7                	ja     80102d15 <mpinit+0x42>
+80102d2e:	84 c0                	test   %al,%al
+80102d30:	74 09                	je     80102d3b <mpinit+0x68>
+80102d32:	3c 01                	cmp    $0x1,%al
+80102d34:	75 d8                	jne    80102d0e <mpinit+0x3b>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80102d36:	83 c2 08             	add    $0x8,%edx
+      continue;
+80102d39:	eb e6                	jmp    80102d21 <mpinit+0x4e>
+      if(ncpu < NCPU) {
+80102d3b:	8b 35 e4 37 11 80    	mov    0x801137e4,%esi
+80102d41:	83 fe 07             	cmp    $0x7,%esi
+80102d44:	7f 19                	jg     80102d5f <mpinit+0x8c>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80102d46:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+80102d4a:	69 fe d8 00 00 00    	imul   $0xd8,%esi,%edi
+80102d50:	88 87 00 38 11 80    	mov    %al,-0x7feec800(%edi)
+        ncpu++;
+80102d56:	83 c6 01             	add    $0x1,%esi
+80102d59:	89 35 e4 37 11 80    	mov    %esi,0x801137e4
+      p += sizeof(struct mpproc);
+80102d5f:	83 c2 14             	add    $0x14,%edx
+      continue;
+80102d62:	eb bd                	jmp    80102d21 <mpinit+0x4e>
+      ioapicid = ioapic->apicno;
+80102d64:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+80102d68:	a2 e0 37 11 80       	mov    %al,0x801137e0
+      p += sizeof(struct mpioapic);
+80102d6d:	83 c2 08             	add    $0x8,%edx
+      continue;
+80102d70:	eb af                	jmp    80102d21 <mpinit+0x4e>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80102d72:	85 db                	test   %ebx,%ebx
+80102d74:	74 26                	je     80102d9c <mpinit+0xc9>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80102d76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102d79:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+80102d7d:	74 15                	je     80102d94 <mpinit+0xc1>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102d7f:	b8 70 00 00 00       	mov    $0x70,%eax
+80102d84:	ba 22 00 00 00       	mov    $0x22,%edx
+80102d89:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102d8a:	ba 23 00 00 00       	mov    $0x23,%edx
+80102d8f:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+80102d90:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102d93:	ee                   	out    %al,(%dx)
+  }
+}
+80102d94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102d97:	5b                   	pop    %ebx
+80102d98:	5e                   	pop    %esi
+80102d99:	5f                   	pop    %edi
+80102d9a:	5d                   	pop    %ebp
+80102d9b:	c3                   	ret
+    panic("Didn't find a suitable machine");
+80102d9c:	83 ec 0c             	sub    $0xc,%esp
+80102d9f:	68 70 8b 10 80       	push   $0x80108b70
+80102da4:	e8 c5 d5 ff ff       	call   8010036e <panic>
+
+80102da9 <picinit>:
+80102da9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102dae:	ba 21 00 00 00       	mov    $0x21,%edx
+80102db3:	ee                   	out    %al,(%dx)
+80102db4:	ba a1 00 00 00       	mov    $0xa1,%edx
+80102db9:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80102dba:	c3                   	ret
+
+80102dbb <pipealloc>:
+  int writeopen;  // write fd is still open
+};
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80102dbb:	55                   	push   %ebp
+80102dbc:	89 e5                	mov    %esp,%ebp
+80102dbe:	57                   	push   %edi
+80102dbf:	56                   	push   %esi
+80102dc0:	53                   	push   %ebx
+80102dc1:	83 ec 0c             	sub    $0xc,%esp
+80102dc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102dc7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+80102dca:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80102dd0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80102dd6:	e8 27 de ff ff       	call   80100c02 <filealloc>
+80102ddb:	89 03                	mov    %eax,(%ebx)
+80102ddd:	85 c0                	test   %eax,%eax
+80102ddf:	0f 84 88 00 00 00    	je     80102e6d <pipealloc+0xb2>
+80102de5:	e8 18 de ff ff       	call   80100c02 <filealloc>
+80102dea:	89 06                	mov    %eax,(%esi)
+80102dec:	85 c0                	test   %eax,%eax
+80102dee:	74 7d                	je     80102e6d <pipealloc+0xb2>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+80102df0:	e8 b3 f2 ff ff       	call   801020a8 <kalloc>
+80102df5:	89 c7                	mov    %eax,%edi
+80102df7:	85 c0                	test   %eax,%eax
+80102df9:	74 72                	je     80102e6d <pipealloc+0xb2>
+    goto bad;
+  p->readopen = 1;
+80102dfb:	c7 80 3c 02 00 00 01 	movl   $0x1,0x23c(%eax)
+80102e02:	00 00 00 
+  p->writeopen = 1;
+80102e05:	c7 80 40 02 00 00 01 	movl   $0x1,0x240(%eax)
+80102e0c:	00 00 00 
+  p->nwrite = 0;
+80102e0f:	c7 80 38 02 00 00 00 	movl   $0x0,0x238(%eax)
+80102e16:	00 00 00 
+  p->nread = 0;
+80102e19:	c7 80 34 02 00 00 00 	movl   $0x0,0x234(%eax)
+80102e20:	00 00 00 
+  initlock(&p->lock, "pipe");
+80102e23:	83 ec 08             	sub    $0x8,%esp
+80102e26:	68 8f 8b 10 80       	push   $0x80108b8f
+80102e2b:	50                   	push   %eax
+80102e2c:	e8 40 27 00 00       	call   80105571 <initlock>
+  (*f0)->type = FD_PIPE;
+80102e31:	8b 03                	mov    (%ebx),%eax
+80102e33:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80102e39:	8b 03                	mov    (%ebx),%eax
+80102e3b:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+80102e3f:	8b 03                	mov    (%ebx),%eax
+80102e41:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+80102e45:	8b 03                	mov    (%ebx),%eax
+80102e47:	89 78 0c             	mov    %edi,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+80102e4a:	8b 06                	mov    (%esi),%eax
+80102e4c:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80102e52:	8b 06                	mov    (%esi),%eax
+80102e54:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80102e58:	8b 06                	mov    (%esi),%eax
+80102e5a:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+80102e5e:	8b 06                	mov    (%esi),%eax
+80102e60:	89 78 0c             	mov    %edi,0xc(%eax)
+  return 0;
+80102e63:	83 c4 10             	add    $0x10,%esp
+80102e66:	b8 00 00 00 00       	mov    $0x0,%eax
+80102e6b:	eb 29                	jmp    80102e96 <pipealloc+0xdb>
+
+//PAGEBREAK: 20
+ bad:
+  if(p)
+    kfree((char*)p);
+  if(*f0)
+80102e6d:	8b 03                	mov    (%ebx),%eax
+80102e6f:	85 c0                	test   %eax,%eax
+80102e71:	74 0c                	je     80102e7f <pipealloc+0xc4>
+    fileclose(*f0);
+80102e73:	83 ec 0c             	sub    $0xc,%esp
+80102e76:	50                   	push   %eax
+80102e77:	e8 2c de ff ff       	call   80100ca8 <fileclose>
+80102e7c:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80102e7f:	8b 06                	mov    (%esi),%eax
+80102e81:	85 c0                	test   %eax,%eax
+80102e83:	74 19                	je     80102e9e <pipealloc+0xe3>
+    fileclose(*f1);
+80102e85:	83 ec 0c             	sub    $0xc,%esp
+80102e88:	50                   	push   %eax
+80102e89:	e8 1a de ff ff       	call   80100ca8 <fileclose>
+80102e8e:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80102e91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80102e96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e99:	5b                   	pop    %ebx
+80102e9a:	5e                   	pop    %esi
+80102e9b:	5f                   	pop    %edi
+80102e9c:	5d                   	pop    %ebp
+80102e9d:	c3                   	ret
+  return -1;
+80102e9e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102ea3:	eb f1                	jmp    80102e96 <pipealloc+0xdb>
+
+80102ea5 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80102ea5:	55                   	push   %ebp
+80102ea6:	89 e5                	mov    %esp,%ebp
+80102ea8:	53                   	push   %ebx
+80102ea9:	83 ec 10             	sub    $0x10,%esp
+80102eac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&p->lock);
+80102eaf:	53                   	push   %ebx
+80102eb0:	e8 00 28 00 00       	call   801056b5 <acquire>
+  if(writable){
+80102eb5:	83 c4 10             	add    $0x10,%esp
+80102eb8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+80102ebc:	74 3f                	je     80102efd <pipeclose+0x58>
+    p->writeopen = 0;
+80102ebe:	c7 83 40 02 00 00 00 	movl   $0x0,0x240(%ebx)
+80102ec5:	00 00 00 
+    wakeup(&p->nread);
+80102ec8:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80102ece:	83 ec 0c             	sub    $0xc,%esp
+80102ed1:	50                   	push   %eax
+80102ed2:	e8 c5 19 00 00       	call   8010489c <wakeup>
+80102ed7:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+80102eda:	83 bb 3c 02 00 00 00 	cmpl   $0x0,0x23c(%ebx)
+80102ee1:	75 09                	jne    80102eec <pipeclose+0x47>
+80102ee3:	83 bb 40 02 00 00 00 	cmpl   $0x0,0x240(%ebx)
+80102eea:	74 2f                	je     80102f1b <pipeclose+0x76>
+    release(&p->lock);
+    kfree((char*)p);
+  } else
+    release(&p->lock);
+80102eec:	83 ec 0c             	sub    $0xc,%esp
+80102eef:	53                   	push   %ebx
+80102ef0:	e8 25 28 00 00       	call   8010571a <release>
+80102ef5:	83 c4 10             	add    $0x10,%esp
+}
+80102ef8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102efb:	c9                   	leave
+80102efc:	c3                   	ret
+    p->readopen = 0;
+80102efd:	c7 83 3c 02 00 00 00 	movl   $0x0,0x23c(%ebx)
+80102f04:	00 00 00 
+    wakeup(&p->nwrite);
+80102f07:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+80102f0d:	83 ec 0c             	sub    $0xc,%esp
+80102f10:	50                   	push   %eax
+80102f11:	e8 86 19 00 00       	call   8010489c <wakeup>
+80102f16:	83 c4 10             	add    $0x10,%esp
+80102f19:	eb bf                	jmp    80102eda <pipeclose+0x35>
+    release(&p->lock);
+80102f1b:	83 ec 0c             	sub    $0xc,%esp
+80102f1e:	53                   	push   %ebx
+80102f1f:	e8 f6 27 00 00       	call   8010571a <release>
+    kfree((char*)p);
+80102f24:	89 1c 24             	mov    %ebx,(%esp)
+80102f27:	e8 3f f0 ff ff       	call   80101f6b <kfree>
+80102f2c:	83 c4 10             	add    $0x10,%esp
+80102f2f:	eb c7                	jmp    80102ef8 <pipeclose+0x53>
+
+80102f31 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+80102f31:	55                   	push   %ebp
+80102f32:	89 e5                	mov    %esp,%ebp
+80102f34:	57                   	push   %edi
+80102f35:	56                   	push   %esi
+80102f36:	53                   	push   %ebx
+80102f37:	83 ec 18             	sub    $0x18,%esp
+80102f3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102f3d:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  acquire(&p->lock);
+80102f40:	53                   	push   %ebx
+80102f41:	e8 6f 27 00 00       	call   801056b5 <acquire>
+  for(i = 0; i < n; i++){
+80102f46:	83 c4 10             	add    $0x10,%esp
+80102f49:	bf 00 00 00 00       	mov    $0x0,%edi
+80102f4e:	39 f7                	cmp    %esi,%edi
+80102f50:	7c 40                	jl     80102f92 <pipewrite+0x61>
+      wakeup(&p->nread);
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+    }
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+80102f52:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80102f58:	83 ec 0c             	sub    $0xc,%esp
+80102f5b:	50                   	push   %eax
+80102f5c:	e8 3b 19 00 00       	call   8010489c <wakeup>
+  release(&p->lock);
+80102f61:	89 1c 24             	mov    %ebx,(%esp)
+80102f64:	e8 b1 27 00 00       	call   8010571a <release>
+  return n;
+80102f69:	83 c4 10             	add    $0x10,%esp
+80102f6c:	89 f0                	mov    %esi,%eax
+80102f6e:	eb 5c                	jmp    80102fcc <pipewrite+0x9b>
+      wakeup(&p->nread);
+80102f70:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80102f76:	83 ec 0c             	sub    $0xc,%esp
+80102f79:	50                   	push   %eax
+80102f7a:	e8 1d 19 00 00       	call   8010489c <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80102f7f:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+80102f85:	83 c4 08             	add    $0x8,%esp
+80102f88:	53                   	push   %ebx
+80102f89:	50                   	push   %eax
+80102f8a:	e8 7a 17 00 00       	call   80104709 <sleep>
+80102f8f:	83 c4 10             	add    $0x10,%esp
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80102f92:	8b 93 38 02 00 00    	mov    0x238(%ebx),%edx
+80102f98:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80102f9e:	05 00 02 00 00       	add    $0x200,%eax
+80102fa3:	39 c2                	cmp    %eax,%edx
+80102fa5:	75 2d                	jne    80102fd4 <pipewrite+0xa3>
+      if(p->readopen == 0 || myproc()->killed){
+80102fa7:	83 bb 3c 02 00 00 00 	cmpl   $0x0,0x23c(%ebx)
+80102fae:	74 0b                	je     80102fbb <pipewrite+0x8a>
+80102fb0:	e8 19 10 00 00       	call   80103fce <myproc>
+80102fb5:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80102fb9:	74 b5                	je     80102f70 <pipewrite+0x3f>
+        release(&p->lock);
+80102fbb:	83 ec 0c             	sub    $0xc,%esp
+80102fbe:	53                   	push   %ebx
+80102fbf:	e8 56 27 00 00       	call   8010571a <release>
+        return -1;
+80102fc4:	83 c4 10             	add    $0x10,%esp
+80102fc7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80102fcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102fcf:	5b                   	pop    %ebx
+80102fd0:	5e                   	pop    %esi
+80102fd1:	5f                   	pop    %edi
+80102fd2:	5d                   	pop    %ebp
+80102fd3:	c3                   	ret
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+80102fd4:	8d 42 01             	lea    0x1(%edx),%eax
+80102fd7:	89 83 38 02 00 00    	mov    %eax,0x238(%ebx)
+80102fdd:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+80102fe3:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102fe6:	0f b6 04 38          	movzbl (%eax,%edi,1),%eax
+80102fea:	88 44 13 34          	mov    %al,0x34(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+80102fee:	83 c7 01             	add    $0x1,%edi
+80102ff1:	e9 58 ff ff ff       	jmp    80102f4e <pipewrite+0x1d>
+
+80102ff6 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80102ff6:	55                   	push   %ebp
+80102ff7:	89 e5                	mov    %esp,%ebp
+80102ff9:	57                   	push   %edi
+80102ffa:	56                   	push   %esi
+80102ffb:	53                   	push   %ebx
+80102ffc:	83 ec 18             	sub    $0x18,%esp
+80102fff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103002:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+80103005:	53                   	push   %ebx
+80103006:	e8 aa 26 00 00       	call   801056b5 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+8010300b:	83 c4 10             	add    $0x10,%esp
+8010300e:	eb 13                	jmp    80103023 <piperead+0x2d>
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80103010:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80103016:	83 ec 08             	sub    $0x8,%esp
+80103019:	53                   	push   %ebx
+8010301a:	50                   	push   %eax
+8010301b:	e8 e9 16 00 00       	call   80104709 <sleep>
+80103020:	83 c4 10             	add    $0x10,%esp
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80103023:	8b 83 38 02 00 00    	mov    0x238(%ebx),%eax
+80103029:	39 83 34 02 00 00    	cmp    %eax,0x234(%ebx)
+8010302f:	75 7a                	jne    801030ab <piperead+0xb5>
+80103031:	8b b3 40 02 00 00    	mov    0x240(%ebx),%esi
+80103037:	85 f6                	test   %esi,%esi
+80103039:	74 3a                	je     80103075 <piperead+0x7f>
+    if(myproc()->killed){
+8010303b:	e8 8e 0f 00 00       	call   80103fce <myproc>
+80103040:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80103044:	74 ca                	je     80103010 <piperead+0x1a>
+      release(&p->lock);
+80103046:	83 ec 0c             	sub    $0xc,%esp
+80103049:	53                   	push   %ebx
+8010304a:	e8 cb 26 00 00       	call   8010571a <release>
+      return -1;
+8010304f:	83 c4 10             	add    $0x10,%esp
+80103052:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80103057:	eb 48                	jmp    801030a1 <piperead+0xab>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+    if(p->nread == p->nwrite)
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+80103059:	8d 50 01             	lea    0x1(%eax),%edx
+8010305c:	89 93 34 02 00 00    	mov    %edx,0x234(%ebx)
+80103062:	25 ff 01 00 00       	and    $0x1ff,%eax
+80103067:	0f b6 44 03 34       	movzbl 0x34(%ebx,%eax,1),%eax
+8010306c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010306f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103072:	83 c6 01             	add    $0x1,%esi
+80103075:	39 fe                	cmp    %edi,%esi
+80103077:	7d 0e                	jge    80103087 <piperead+0x91>
+    if(p->nread == p->nwrite)
+80103079:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+8010307f:	3b 83 38 02 00 00    	cmp    0x238(%ebx),%eax
+80103085:	75 d2                	jne    80103059 <piperead+0x63>
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80103087:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+8010308d:	83 ec 0c             	sub    $0xc,%esp
+80103090:	50                   	push   %eax
+80103091:	e8 06 18 00 00       	call   8010489c <wakeup>
+  release(&p->lock);
+80103096:	89 1c 24             	mov    %ebx,(%esp)
+80103099:	e8 7c 26 00 00       	call   8010571a <release>
+  return i;
+8010309e:	83 c4 10             	add    $0x10,%esp
+}
+801030a1:	89 f0                	mov    %esi,%eax
+801030a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801030a6:	5b                   	pop    %ebx
+801030a7:	5e                   	pop    %esi
+801030a8:	5f                   	pop    %edi
+801030a9:	5d                   	pop    %ebp
+801030aa:	c3                   	ret
+801030ab:	be 00 00 00 00       	mov    $0x0,%esi
+801030b0:	eb c3                	jmp    80103075 <piperead+0x7f>
+
+801030b2 <addtime>:
+// Add cycles to a time kept as whole ticks plus the cycles
+// towards the next one.  Subtracting a tick at a time avoids
+// 64-bit division, which the kernel does not have.
+static void
+addtime(uint *ticks, uint *rem, uint64 cycles)
+{
+801030b2:	55                   	push   %ebp
+801030b3:	89 e5                	mov    %esp,%ebp
+801030b5:	57                   	push   %edi
+801030b6:	56                   	push   %esi
+801030b7:	53                   	push   %ebx
+801030b8:	83 ec 0c             	sub    $0xc,%esp
+801030bb:	89 c6                	mov    %eax,%esi
+801030bd:	89 d7                	mov    %edx,%edi
+  cycles += *rem;
+801030bf:	8b 02                	mov    (%edx),%eax
+801030c1:	ba 00 00 00 00       	mov    $0x0,%edx
+801030c6:	03 45 08             	add    0x8(%ebp),%eax
+801030c9:	13 55 0c             	adc    0xc(%ebp),%edx
+  while(cycles >= tsc_per_tick){
+801030cc:	89 7d ec             	mov    %edi,-0x14(%ebp)
+801030cf:	eb 0b                	jmp    801030dc <addtime+0x2a>
+    cycles -= tsc_per_tick;
+801030d1:	29 c8                	sub    %ecx,%eax
+801030d3:	19 da                	sbb    %ebx,%edx
+    (*ticks)++;
+801030d5:	8b 1e                	mov    (%esi),%ebx
+801030d7:	8d 4b 01             	lea    0x1(%ebx),%ecx
+801030da:	89 0e                	mov    %ecx,(%esi)
+  while(cycles >= tsc_per_tick){
+801030dc:	8b 0d 60 c0 10 80    	mov    0x8010c060,%ecx
+801030e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+801030e7:	39 c8                	cmp    %ecx,%eax
+801030e9:	89 d7                	mov    %edx,%edi
+801030eb:	19 df                	sbb    %ebx,%edi
+801030ed:	73 e2                	jae    801030d1 <addtime+0x1f>
+  }
+  *rem = cycles;
+801030ef:	8b 7d ec             	mov    -0x14(%ebp),%edi
+801030f2:	89 07                	mov    %eax,(%edi)
+}
+801030f4:	83 c4 0c             	add    $0xc,%esp
+801030f7:	5b                   	pop    %ebx
+801030f8:	5e                   	pop    %esi
+801030f9:	5f                   	pop    %edi
+801030fa:	5d                   	pop    %ebp
+801030fb:	c3                   	ret
+
+801030fc <idle>:
+// and sends an IPI.  The timer interrupt also ends the halt.
+// The time halted is measured with the TSC rather than by counting
+// timer interrupts, which a TICKLESS CPU does not take while idle.
+static void
+idle(struct cpu *c)
+{
+801030fc:	55                   	push   %ebp
+801030fd:	89 e5                	mov    %esp,%ebp
+801030ff:	57                   	push   %edi
+80103100:	56                   	push   %esi
+80103101:	53                   	push   %ebx
+80103102:	83 ec 0c             	sub    $0xc,%esp
+80103105:	89 c3                	mov    %eax,%ebx
+  asm volatile("cli");
+80103107:	fa                   	cli
+  asm volatile("lock; xchgl %0, %1" :
+80103108:	b8 01 00 00 00       	mov    $0x1,%eax
+8010310d:	f0 87 83 b4 00 00 00 	lock xchg %eax,0xb4(%ebx)
+  uint64 start;
+  int i;
+
+  cli();
+  xchg(&c->idle, 1);
+  for(i = 0; i < ncpu; i++)
+80103114:	b8 00 00 00 00       	mov    $0x0,%eax
+80103119:	eb 03                	jmp    8010311e <idle+0x22>
+8010311b:	83 c0 01             	add    $0x1,%eax
+8010311e:	8b 15 e4 37 11 80    	mov    0x801137e4,%edx
+80103124:	39 c2                	cmp    %eax,%edx
+80103126:	7e 13                	jle    8010313b <idle+0x3f>
+    if(cpus[i].runqueue->size > 0)
+80103128:	69 c8 d8 00 00 00    	imul   $0xd8,%eax,%ecx
+8010312e:	8b 89 b0 38 11 80    	mov    -0x7feec750(%ecx),%ecx
+80103134:	8b 49 34             	mov    0x34(%ecx),%ecx
+80103137:	85 c9                	test   %ecx,%ecx
+80103139:	7e e0                	jle    8010311b <idle+0x1f>
+      break;
+  if(i == ncpu && iso_rq.size == 0 && idleprio_rq.size == 0){
+8010313b:	39 c2                	cmp    %eax,%edx
+8010313d:	74 12                	je     80103151 <idle+0x55>
+    arm_timer(c, 0);
+    start = rdtsc();
+    stihlt();
+    addtime(&c->idle_ticks, &c->idle_cycles, rdtsc() - start);
+  }
+  c->idle = 0;
+8010313f:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+80103146:	00 00 00 
+}
+80103149:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010314c:	5b                   	pop    %ebx
+8010314d:	5e                   	pop    %esi
+8010314e:	5f                   	pop    %edi
+8010314f:	5d                   	pop    %ebp
+80103150:	c3                   	ret
+  if(i == ncpu && iso_rq.size == 0 && idleprio_rq.size == 0){
+80103151:	a1 b4 3f 11 80       	mov    0x80113fb4,%eax
+80103156:	85 c0                	test   %eax,%eax
+80103158:	75 e5                	jne    8010313f <idle+0x43>
+8010315a:	a1 f4 3e 11 80       	mov    0x80113ef4,%eax
+8010315f:	85 c0                	test   %eax,%eax
+80103161:	75 dc                	jne    8010313f <idle+0x43>
+  asm volatile("rdtsc" : "=A" (tsc));
+80103163:	0f 31                	rdtsc
+80103165:	89 c6                	mov    %eax,%esi
+80103167:	89 d7                	mov    %edx,%edi
+  asm volatile("sti; hlt");
+80103169:	fb                   	sti
+8010316a:	f4                   	hlt
+  asm volatile("rdtsc" : "=A" (tsc));
+8010316b:	0f 31                	rdtsc
+    addtime(&c->idle_ticks, &c->idle_cycles, rdtsc() - start);
+8010316d:	8d 8b c4 00 00 00    	lea    0xc4(%ebx),%ecx
+80103173:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+80103176:	8d 8b c0 00 00 00    	lea    0xc0(%ebx),%ecx
+8010317c:	29 f0                	sub    %esi,%eax
+8010317e:	19 fa                	sbb    %edi,%edx
+80103180:	52                   	push   %edx
+80103181:	50                   	push   %eax
+80103182:	8b 55 ec             	mov    -0x14(%ebp),%edx
+80103185:	89 c8                	mov    %ecx,%eax
+80103187:	e8 26 ff ff ff       	call   801030b2 <addtime>
+8010318c:	83 c4 08             	add    $0x8,%esp
+8010318f:	eb ae                	jmp    8010313f <idle+0x43>
+
+80103191 <bfs_class>:
+// normal processes waiting for the lock are not held up behind
+// every other runnable process.
+static int
+bfs_class(struct proc *p)
+{
+  if(p->sched_class == SCHED_IDLEPRIO && p->nsleeplocks > 0)
+80103191:	8b 90 c0 00 00 00    	mov    0xc0(%eax),%edx
+80103197:	83 fa 02             	cmp    $0x2,%edx
+8010319a:	74 03                	je     8010319f <bfs_class+0xe>
+    return SCHED_NORMAL;
+  return p->sched_class;
+}
+8010319c:	89 d0                	mov    %edx,%eax
+8010319e:	c3                   	ret
+  if(p->sched_class == SCHED_IDLEPRIO && p->nsleeplocks > 0)
+8010319f:	83 b8 c4 00 00 00 00 	cmpl   $0x0,0xc4(%eax)
+801031a6:	7e f4                	jle    8010319c <bfs_class+0xb>
+    return SCHED_NORMAL;
+801031a8:	ba 00 00 00 00       	mov    $0x0,%edx
+801031ad:	eb ed                	jmp    8010319c <bfs_class+0xb>
+
+801031af <bfs_preempts>:
+// before normal processes, and never gives way to one, which would
+// only be switched straight back out for it.  Otherwise the earlier
+// deadline wins.
+static int
+bfs_preempts(struct proc *p, struct proc *running)
+{
+801031af:	55                   	push   %ebp
+801031b0:	89 e5                	mov    %esp,%ebp
+801031b2:	57                   	push   %edi
+801031b3:	56                   	push   %esi
+801031b4:	53                   	push   %ebx
+801031b5:	83 ec 1c             	sub    $0x1c,%esp
+801031b8:	89 c6                	mov    %eax,%esi
+801031ba:	89 d7                	mov    %edx,%edi
+  int class = bfs_class(p), rclass = bfs_class(running);
+801031bc:	e8 d0 ff ff ff       	call   80103191 <bfs_class>
+801031c1:	89 c3                	mov    %eax,%ebx
+801031c3:	89 f8                	mov    %edi,%eax
+801031c5:	e8 c7 ff ff ff       	call   80103191 <bfs_class>
+
+  if(rclass == SCHED_IDLEPRIO && class != SCHED_IDLEPRIO)
+801031ca:	83 f8 02             	cmp    $0x2,%eax
+801031cd:	0f 94 c1             	sete   %cl
+801031d0:	83 fb 02             	cmp    $0x2,%ebx
+801031d3:	0f 95 c2             	setne  %dl
+801031d6:	84 d1                	test   %dl,%cl
+801031d8:	75 66                	jne    80103240 <bfs_preempts+0x91>
+    return 1;
+  if(!iso_throttled){
+801031da:	8b 15 40 96 11 80    	mov    0x80119640,%edx
+801031e0:	85 d2                	test   %edx,%edx
+801031e2:	75 24                	jne    80103208 <bfs_preempts+0x59>
+    if(class == SCHED_ISO && rclass != SCHED_ISO)
+801031e4:	83 fb 01             	cmp    $0x1,%ebx
+801031e7:	0f 94 45 e7          	sete   -0x19(%ebp)
+801031eb:	83 f8 01             	cmp    $0x1,%eax
+801031ee:	0f 95 c1             	setne  %cl
+801031f1:	84 4d e7             	test   %cl,-0x19(%ebp)
+801031f4:	75 59                	jne    8010324f <bfs_preempts+0xa0>
+      return 1;
+    if(rclass == SCHED_ISO && class != SCHED_ISO)
+801031f6:	83 f8 01             	cmp    $0x1,%eax
+801031f9:	0f 94 45 e7          	sete   -0x19(%ebp)
+801031fd:	83 fb 01             	cmp    $0x1,%ebx
+80103200:	0f 95 c1             	setne  %cl
+80103203:	84 4d e7             	test   %cl,-0x19(%ebp)
+80103206:	75 3d                	jne    80103245 <bfs_preempts+0x96>
+      return 0;
+  }
+  if(class == SCHED_IDLEPRIO && rclass != SCHED_IDLEPRIO)
+80103208:	83 fb 02             	cmp    $0x2,%ebx
+8010320b:	0f 94 c2             	sete   %dl
+8010320e:	83 f8 02             	cmp    $0x2,%eax
+80103211:	0f 95 c0             	setne  %al
+80103214:	84 c2                	test   %al,%dl
+80103216:	75 3e                	jne    80103256 <bfs_preempts+0xa7>
+    return 0;
+  return p->virtual_deadline < running->virtual_deadline;
+80103218:	8b 86 cc 00 00 00    	mov    0xcc(%esi),%eax
+8010321e:	8b 8f cc 00 00 00    	mov    0xcc(%edi),%ecx
+80103224:	ba 01 00 00 00       	mov    $0x1,%edx
+80103229:	8b bf c8 00 00 00    	mov    0xc8(%edi),%edi
+8010322f:	39 be c8 00 00 00    	cmp    %edi,0xc8(%esi)
+80103235:	19 c8                	sbb    %ecx,%eax
+80103237:	72 0c                	jb     80103245 <bfs_preempts+0x96>
+80103239:	ba 00 00 00 00       	mov    $0x0,%edx
+8010323e:	eb 05                	jmp    80103245 <bfs_preempts+0x96>
+    return 1;
+80103240:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+80103245:	89 d0                	mov    %edx,%eax
+80103247:	83 c4 1c             	add    $0x1c,%esp
+8010324a:	5b                   	pop    %ebx
+8010324b:	5e                   	pop    %esi
+8010324c:	5f                   	pop    %edi
+8010324d:	5d                   	pop    %ebp
+8010324e:	c3                   	ret
+      return 1;
+8010324f:	ba 01 00 00 00       	mov    $0x1,%edx
+80103254:	eb ef                	jmp    80103245 <bfs_preempts+0x96>
+    return 0;
+80103256:	ba 00 00 00 00       	mov    $0x0,%edx
+8010325b:	eb e8                	jmp    80103245 <bfs_preempts+0x96>
+
+8010325d <bfs_preempt>:
+// SCHED_ISO, preferring one running SCHED_IDLEPRIO, then p's own.
+// Nothing is preempted while a CPU is idle or between processes:
+// it is about to pick p up anyway.
+static struct cpu*
+bfs_preempt(struct proc *p)
+{
+8010325d:	55                   	push   %ebp
+8010325e:	89 e5                	mov    %esp,%ebp
+80103260:	57                   	push   %edi
+80103261:	56                   	push   %esi
+80103262:	53                   	push   %ebx
+80103263:	83 ec 0c             	sub    $0xc,%esp
+  struct cpu *c, *best;
+  int i;
+
+  if(bfs_class(p) == SCHED_ISO && !iso_throttled){
+80103266:	8b 45 08             	mov    0x8(%ebp),%eax
+80103269:	e8 23 ff ff ff       	call   80103191 <bfs_class>
+8010326e:	83 f8 01             	cmp    $0x1,%eax
+80103271:	74 64                	je     801032d7 <bfs_preempt+0x7a>
+        best = c;
+    }
+    return best;
+  }
+
+  c = &cpus[p->cpu];
+80103273:	8b 45 08             	mov    0x8(%ebp),%eax
+80103276:	8b 80 38 01 00 00    	mov    0x138(%eax),%eax
+8010327c:	69 d8 d8 00 00 00    	imul   $0xd8,%eax,%ebx
+80103282:	81 c3 00 38 11 80    	add    $0x80113800,%ebx
+  if(c->idle || c->proc == NULL)
+80103288:	8b 93 b4 00 00 00    	mov    0xb4(%ebx),%edx
+8010328e:	85 d2                	test   %edx,%edx
+80103290:	0f 85 21 01 00 00    	jne    801033b7 <bfs_preempt+0x15a>
+80103296:	69 c0 d8 00 00 00    	imul   $0xd8,%eax,%eax
+8010329c:	8b 90 ac 38 11 80    	mov    -0x7feec754(%eax),%edx
+801032a2:	85 d2                	test   %edx,%edx
+801032a4:	0f 84 14 01 00 00    	je     801033be <bfs_preempt+0x161>
+    return NULL;
+  if(bfs_preempts(p, c->proc))
+801032aa:	8b 45 08             	mov    0x8(%ebp),%eax
+801032ad:	e8 fd fe ff ff       	call   801031af <bfs_preempts>
+801032b2:	89 c6                	mov    %eax,%esi
+801032b4:	85 c0                	test   %eax,%eax
+801032b6:	0f 85 e2 00 00 00    	jne    8010339e <bfs_preempt+0x141>
+    return c;
+  if(bfs_class(p) != SCHED_IDLEPRIO){
+801032bc:	8b 45 08             	mov    0x8(%ebp),%eax
+801032bf:	e8 cd fe ff ff       	call   80103191 <bfs_class>
+801032c4:	83 f8 02             	cmp    $0x2,%eax
+801032c7:	0f 85 92 00 00 00    	jne    8010335f <bfs_preempt+0x102>
+      c = &cpus[i];
+      if(!c->idle && c->proc != NULL && bfs_class(c->proc) == SCHED_IDLEPRIO)
+        return c;
+    }
+  }
+  return NULL;
+801032cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+801032d2:	e9 c7 00 00 00       	jmp    8010339e <bfs_preempt+0x141>
+  if(bfs_class(p) == SCHED_ISO && !iso_throttled){
+801032d7:	8b 35 40 96 11 80    	mov    0x80119640,%esi
+801032dd:	85 f6                	test   %esi,%esi
+801032df:	75 92                	jne    80103273 <bfs_preempt+0x16>
+    best = NULL;
+801032e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+801032e6:	eb 05                	jmp    801032ed <bfs_preempt+0x90>
+        best = c;
+801032e8:	89 fb                	mov    %edi,%ebx
+    for(i = 0; i < ncpu; i++){
+801032ea:	83 c6 01             	add    $0x1,%esi
+801032ed:	39 35 e4 37 11 80    	cmp    %esi,0x801137e4
+801032f3:	0f 8e a5 00 00 00    	jle    8010339e <bfs_preempt+0x141>
+      c = &cpus[i];
+801032f9:	69 fe d8 00 00 00    	imul   $0xd8,%esi,%edi
+801032ff:	81 c7 00 38 11 80    	add    $0x80113800,%edi
+      if(c->idle || c->proc == NULL)
+80103305:	8b 87 b4 00 00 00    	mov    0xb4(%edi),%eax
+8010330b:	85 c0                	test   %eax,%eax
+8010330d:	0f 85 95 00 00 00    	jne    801033a8 <bfs_preempt+0x14b>
+80103313:	69 c6 d8 00 00 00    	imul   $0xd8,%esi,%eax
+80103319:	8b 90 ac 38 11 80    	mov    -0x7feec754(%eax),%edx
+8010331f:	85 d2                	test   %edx,%edx
+80103321:	0f 84 88 00 00 00    	je     801033af <bfs_preempt+0x152>
+      if(!bfs_preempts(p, c->proc))
+80103327:	8b 45 08             	mov    0x8(%ebp),%eax
+8010332a:	e8 80 fe ff ff       	call   801031af <bfs_preempts>
+8010332f:	85 c0                	test   %eax,%eax
+80103331:	74 b7                	je     801032ea <bfs_preempt+0x8d>
+      if(bfs_class(c->proc) == SCHED_IDLEPRIO)
+80103333:	69 c6 d8 00 00 00    	imul   $0xd8,%esi,%eax
+80103339:	8b 80 ac 38 11 80    	mov    -0x7feec754(%eax),%eax
+8010333f:	e8 4d fe ff ff       	call   80103191 <bfs_class>
+80103344:	83 f8 02             	cmp    $0x2,%eax
+80103347:	74 6a                	je     801033b3 <bfs_preempt+0x156>
+      if(best == NULL || i == p->cpu)
+80103349:	85 db                	test   %ebx,%ebx
+8010334b:	74 9b                	je     801032e8 <bfs_preempt+0x8b>
+8010334d:	8b 45 08             	mov    0x8(%ebp),%eax
+80103350:	39 b0 38 01 00 00    	cmp    %esi,0x138(%eax)
+80103356:	75 92                	jne    801032ea <bfs_preempt+0x8d>
+        best = c;
+80103358:	89 fb                	mov    %edi,%ebx
+8010335a:	eb 8e                	jmp    801032ea <bfs_preempt+0x8d>
+    for(i = 0; i < ncpu; i++){
+8010335c:	83 c6 01             	add    $0x1,%esi
+8010335f:	39 35 e4 37 11 80    	cmp    %esi,0x801137e4
+80103365:	7e 32                	jle    80103399 <bfs_preempt+0x13c>
+      c = &cpus[i];
+80103367:	69 de d8 00 00 00    	imul   $0xd8,%esi,%ebx
+8010336d:	81 c3 00 38 11 80    	add    $0x80113800,%ebx
+      if(!c->idle && c->proc != NULL && bfs_class(c->proc) == SCHED_IDLEPRIO)
+80103373:	8b 83 b4 00 00 00    	mov    0xb4(%ebx),%eax
+80103379:	85 c0                	test   %eax,%eax
+8010337b:	75 df                	jne    8010335c <bfs_preempt+0xff>
+8010337d:	69 c6 d8 00 00 00    	imul   $0xd8,%esi,%eax
+80103383:	8b 80 ac 38 11 80    	mov    -0x7feec754(%eax),%eax
+80103389:	85 c0                	test   %eax,%eax
+8010338b:	74 cf                	je     8010335c <bfs_preempt+0xff>
+8010338d:	e8 ff fd ff ff       	call   80103191 <bfs_class>
+80103392:	83 f8 02             	cmp    $0x2,%eax
+80103395:	75 c5                	jne    8010335c <bfs_preempt+0xff>
+80103397:	eb 05                	jmp    8010339e <bfs_preempt+0x141>
+  return NULL;
+80103399:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+8010339e:	89 d8                	mov    %ebx,%eax
+801033a0:	83 c4 0c             	add    $0xc,%esp
+801033a3:	5b                   	pop    %ebx
+801033a4:	5e                   	pop    %esi
+801033a5:	5f                   	pop    %edi
+801033a6:	5d                   	pop    %ebp
+801033a7:	c3                   	ret
+        return NULL;
+801033a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+801033ad:	eb ef                	jmp    8010339e <bfs_preempt+0x141>
+801033af:	89 d3                	mov    %edx,%ebx
+801033b1:	eb eb                	jmp    8010339e <bfs_preempt+0x141>
+        return c;
+801033b3:	89 fb                	mov    %edi,%ebx
+801033b5:	eb e7                	jmp    8010339e <bfs_preempt+0x141>
+    return NULL;
+801033b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+801033bc:	eb e0                	jmp    8010339e <bfs_preempt+0x141>
+801033be:	89 d3                	mov    %edx,%ebx
+801033c0:	eb dc                	jmp    8010339e <bfs_preempt+0x141>
+
+801033c2 <bfs_work_queued>:
+static int
+bfs_work_queued(void)
+{
+  int i;
+
+  if(iso_rq.size > 0)
+801033c2:	a1 b4 3f 11 80       	mov    0x80113fb4,%eax
+801033c7:	85 c0                	test   %eax,%eax
+801033c9:	7f 31                	jg     801033fc <bfs_work_queued+0x3a>
+    return 1;
+  for(i = 0; i < ncpu; i++)
+801033cb:	b8 00 00 00 00       	mov    $0x0,%eax
+801033d0:	eb 03                	jmp    801033d5 <bfs_work_queued+0x13>
+801033d2:	83 c0 01             	add    $0x1,%eax
+801033d5:	39 05 e4 37 11 80    	cmp    %eax,0x801137e4
+801033db:	7e 19                	jle    801033f6 <bfs_work_queued+0x34>
+    if(cpus[i].runqueue->size > 0)
+801033dd:	69 d0 d8 00 00 00    	imul   $0xd8,%eax,%edx
+801033e3:	8b 92 b0 38 11 80    	mov    -0x7feec750(%edx),%edx
+801033e9:	8b 52 34             	mov    0x34(%edx),%edx
+801033ec:	85 d2                	test   %edx,%edx
+801033ee:	7e e2                	jle    801033d2 <bfs_work_queued+0x10>
+      return 1;
+801033f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return 0;
+}
+801033f5:	c3                   	ret
+  return 0;
+801033f6:	b8 00 00 00 00       	mov    $0x0,%eax
+801033fb:	c3                   	ret
+    return 1;
+801033fc:	b8 01 00 00 00       	mov    $0x1,%eax
+80103401:	c3                   	ret
+
+80103402 <bfs_tick>:
+
+static int
+bfs_tick(struct proc *p, uint64 cycles)
+{
+80103402:	55                   	push   %ebp
+80103403:	89 e5                	mov    %esp,%ebp
+80103405:	57                   	push   %edi
+80103406:	56                   	push   %esi
+80103407:	53                   	push   %ebx
+80103408:	83 ec 2c             	sub    $0x2c,%esp
+8010340b:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010340e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80103411:	8b 75 10             	mov    0x10(%ebp),%esi
+80103414:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+80103417:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  if(cycles + tsc_per_tick/2 >= p->slice){
+8010341a:	a1 60 c0 10 80       	mov    0x8010c060,%eax
+8010341f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103422:	d1 e8                	shr    %eax
+80103424:	ba 00 00 00 00       	mov    $0x0,%edx
+80103429:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010342c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+8010342f:	01 d8                	add    %ebx,%eax
+80103431:	11 f2                	adc    %esi,%edx
+80103433:	8b 8f 88 00 00 00    	mov    0x88(%edi),%ecx
+80103439:	8b 9f 8c 00 00 00    	mov    0x8c(%edi),%ebx
+8010343f:	39 c8                	cmp    %ecx,%eax
+80103441:	89 d0                	mov    %edx,%eax
+80103443:	19 d8                	sbb    %ebx,%eax
+80103445:	73 62                	jae    801034a9 <bfs_tick+0xa7>
+    p->slice = 0;
+    p->ticks_left = 0;
+    return 1;
+  }
+  p->slice -= cycles;
+80103447:	2b 4d d0             	sub    -0x30(%ebp),%ecx
+8010344a:	1b 5d d4             	sbb    -0x2c(%ebp),%ebx
+8010344d:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+80103450:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+80103453:	89 8f 88 00 00 00    	mov    %ecx,0x88(%edi)
+80103459:	89 9f 8c 00 00 00    	mov    %ebx,0x8c(%edi)
+  // ticks_left is the slice rounded to whole ticks.  Recount it
+  // from its old value rather than divide, which would need 64-bit
+  // division; it moves by about one tick per call.
+  while(p->ticks_left > 0 &&
+8010345f:	89 fb                	mov    %edi,%ebx
+80103461:	8b 8b 84 00 00 00    	mov    0x84(%ebx),%ecx
+80103467:	85 c9                	test   %ecx,%ecx
+80103469:	0f 8e ae 00 00 00    	jle    8010351d <bfs_tick+0x11b>
+        (uint64)p->ticks_left * tsc_per_tick > p->slice + tsc_per_tick/2)
+8010346f:	89 c8                	mov    %ecx,%eax
+80103471:	99                   	cltd
+80103472:	89 d0                	mov    %edx,%eax
+80103474:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103477:	0f af c7             	imul   %edi,%eax
+8010347a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010347d:	89 f8                	mov    %edi,%eax
+8010347f:	f7 e1                	mul    %ecx
+80103481:	89 c6                	mov    %eax,%esi
+80103483:	89 d7                	mov    %edx,%edi
+80103485:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103488:	01 c7                	add    %eax,%edi
+8010348a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010348d:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80103490:	03 45 d0             	add    -0x30(%ebp),%eax
+80103493:	13 55 d4             	adc    -0x2c(%ebp),%edx
+  while(p->ticks_left > 0 &&
+80103496:	39 f0                	cmp    %esi,%eax
+80103498:	89 d0                	mov    %edx,%eax
+8010349a:	19 f8                	sbb    %edi,%eax
+8010349c:	73 30                	jae    801034ce <bfs_tick+0xcc>
+    p->ticks_left--;
+8010349e:	83 e9 01             	sub    $0x1,%ecx
+801034a1:	89 8b 84 00 00 00    	mov    %ecx,0x84(%ebx)
+801034a7:	eb b8                	jmp    80103461 <bfs_tick+0x5f>
+    p->slice = 0;
+801034a9:	c7 87 88 00 00 00 00 	movl   $0x0,0x88(%edi)
+801034b0:	00 00 00 
+801034b3:	c7 87 8c 00 00 00 00 	movl   $0x0,0x8c(%edi)
+801034ba:	00 00 00 
+    p->ticks_left = 0;
+801034bd:	c7 87 84 00 00 00 00 	movl   $0x0,0x84(%edi)
+801034c4:	00 00 00 
+    return 1;
+801034c7:	b8 01 00 00 00       	mov    $0x1,%eax
+801034cc:	eb 47                	jmp    80103515 <bfs_tick+0x113>
+801034ce:	89 df                	mov    %ebx,%edi
+801034d0:	eb 06                	jmp    801034d8 <bfs_tick+0xd6>
+  while((uint64)(p->ticks_left + 1) * tsc_per_tick <= p->slice + tsc_per_tick/2)
+    p->ticks_left++;
+801034d2:	89 8f 84 00 00 00    	mov    %ecx,0x84(%edi)
+  while((uint64)(p->ticks_left + 1) * tsc_per_tick <= p->slice + tsc_per_tick/2)
+801034d8:	8b 87 84 00 00 00    	mov    0x84(%edi),%eax
+801034de:	8d 48 01             	lea    0x1(%eax),%ecx
+801034e1:	89 c8                	mov    %ecx,%eax
+801034e3:	99                   	cltd
+801034e4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+801034e7:	89 f3                	mov    %esi,%ebx
+801034e9:	0f af da             	imul   %edx,%ebx
+801034ec:	89 f0                	mov    %esi,%eax
+801034ee:	f7 e1                	mul    %ecx
+801034f0:	01 da                	add    %ebx,%edx
+801034f2:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+801034f5:	8b 75 dc             	mov    -0x24(%ebp),%esi
+801034f8:	03 5d d0             	add    -0x30(%ebp),%ebx
+801034fb:	13 75 d4             	adc    -0x2c(%ebp),%esi
+801034fe:	39 c3                	cmp    %eax,%ebx
+80103500:	19 d6                	sbb    %edx,%esi
+80103502:	73 ce                	jae    801034d2 <bfs_tick+0xd0>
+  // SCHED_IDLEPRIO keeps the rest of its quantum, but only gets
+  // to use it while nothing else wants the CPU.
+  if(bfs_class(p) == SCHED_IDLEPRIO && bfs_work_queued())
+80103504:	89 f8                	mov    %edi,%eax
+80103506:	e8 86 fc ff ff       	call   80103191 <bfs_class>
+8010350b:	83 f8 02             	cmp    $0x2,%eax
+8010350e:	74 11                	je     80103521 <bfs_tick+0x11f>
+    return 1;
+  return 0;
+80103510:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80103515:	83 c4 2c             	add    $0x2c,%esp
+80103518:	5b                   	pop    %ebx
+80103519:	5e                   	pop    %esi
+8010351a:	5f                   	pop    %edi
+8010351b:	5d                   	pop    %ebp
+8010351c:	c3                   	ret
+8010351d:	89 df                	mov    %ebx,%edi
+8010351f:	eb b7                	jmp    801034d8 <bfs_tick+0xd6>
+  if(bfs_class(p) == SCHED_IDLEPRIO && bfs_work_queued())
+80103521:	e8 9c fe ff ff       	call   801033c2 <bfs_work_queued>
+80103526:	85 c0                	test   %eax,%eax
+80103528:	74 eb                	je     80103515 <bfs_tick+0x113>
+    return 1;
+8010352a:	b8 01 00 00 00       	mov    $0x1,%eax
+8010352f:	eb e4                	jmp    80103515 <bfs_tick+0x113>
+
+80103531 <rr_fork>:
+static uint64 rr_clock;   // protected by ptable.lock
+
+static void
+rr_fork(struct proc *p)
+{
+}
+80103531:	c3                   	ret
+
+80103532 <rr_tick>:
+  return p;
+}
+
+static int
+rr_tick(struct proc *p, uint64 cycles)
+{
+80103532:	55                   	push   %ebp
+80103533:	89 e5                	mov    %esp,%ebp
+  p->ticks_left = 0;
+80103535:	8b 45 08             	mov    0x8(%ebp),%eax
+80103538:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%eax)
+8010353f:	00 00 00 
+  return 1;
+}
+80103542:	b8 01 00 00 00       	mov    $0x1,%eax
+80103547:	5d                   	pop    %ebp
+80103548:	c3                   	ret
+
+80103549 <waitq>:
+static struct proc**
+waitq(void *chan)
+{
+  uint h = (uint)chan;
+
+  h ^= h >> 6;
+80103549:	89 c2                	mov    %eax,%edx
+8010354b:	c1 ea 06             	shr    $0x6,%edx
+8010354e:	31 c2                	xor    %eax,%edx
+  h ^= h >> 12;
+80103550:	89 d0                	mov    %edx,%eax
+80103552:	c1 e8 0c             	shr    $0xc,%eax
+80103555:	31 d0                	xor    %edx,%eax
+  return &ptable.waitq[h & (NWAITQ - 1)];
+80103557:	83 e0 3f             	and    $0x3f,%eax
+8010355a:	8d 04 85 34 95 11 80 	lea    -0x7fee6acc(,%eax,4),%eax
+}
+80103561:	c3                   	ret
+
+80103562 <bfs_renice>:
+{
+80103562:	55                   	push   %ebp
+80103563:	89 e5                	mov    %esp,%ebp
+80103565:	53                   	push   %ebx
+80103566:	83 ec 10             	sub    $0x10,%esp
+80103569:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  p->virtual_deadline = compute_virtual_deadline(p->nice_value);
+8010356c:	ff b3 bc 00 00 00    	push   0xbc(%ebx)
+80103572:	e8 bd ca ff ff       	call   80100034 <compute_virtual_deadline>
+80103577:	89 83 c8 00 00 00    	mov    %eax,0xc8(%ebx)
+8010357d:	89 93 cc 00 00 00    	mov    %edx,0xcc(%ebx)
+}
+80103583:	83 c4 10             	add    $0x10,%esp
+80103586:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103589:	c9                   	leave
+8010358a:	c3                   	ret
+
+8010358b <bfs_fork>:
+{
+8010358b:	55                   	push   %ebp
+8010358c:	89 e5                	mov    %esp,%ebp
+8010358e:	53                   	push   %ebx
+8010358f:	83 ec 10             	sub    $0x10,%esp
+80103592:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  p->slice = 0;
+80103595:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+8010359c:	00 00 00 
+8010359f:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+801035a6:	00 00 00 
+  p->ticks_left = 0;
+801035a9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+801035b0:	00 00 00 
+  p->virtual_deadline = compute_virtual_deadline(p->nice_value);
+801035b3:	ff b3 bc 00 00 00    	push   0xbc(%ebx)
+801035b9:	e8 76 ca ff ff       	call   80100034 <compute_virtual_deadline>
+801035be:	89 83 c8 00 00 00    	mov    %eax,0xc8(%ebx)
+801035c4:	89 93 cc 00 00 00    	mov    %edx,0xcc(%ebx)
+}
+801035ca:	83 c4 10             	add    $0x10,%esp
+801035cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801035d0:	c9                   	leave
+801035d1:	c3                   	ret
+
+801035d2 <iso_pop>:
+{
+801035d2:	55                   	push   %ebp
+801035d3:	89 e5                	mov    %esp,%ebp
+801035d5:	53                   	push   %ebx
+801035d6:	83 ec 04             	sub    $0x4,%esp
+  if(iso_rq.size == 0)
+801035d9:	8b 15 b4 3f 11 80    	mov    0x80113fb4,%edx
+801035df:	85 d2                	test   %edx,%edx
+801035e1:	74 62                	je     80103645 <iso_pop+0x73>
+  if(iso_throttled && c->runqueue->size > 0 &&
+801035e3:	8b 15 40 96 11 80    	mov    0x80119640,%edx
+801035e9:	85 d2                	test   %edx,%edx
+801035eb:	74 27                	je     80103614 <iso_pop+0x42>
+801035ed:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+801035f3:	8b 50 34             	mov    0x34(%eax),%edx
+801035f6:	85 d2                	test   %edx,%edx
+801035f8:	7e 1a                	jle    80103614 <iso_pop+0x42>
+     c->runqueue->min_deadline <= iso_rq.min_deadline)
+801035fa:	8b 50 3c             	mov    0x3c(%eax),%edx
+801035fd:	8b 40 38             	mov    0x38(%eax),%eax
+80103600:	8b 0d b8 3f 11 80    	mov    0x80113fb8,%ecx
+80103606:	8b 1d bc 3f 11 80    	mov    0x80113fbc,%ebx
+  if(iso_throttled && c->runqueue->size > 0 &&
+8010360c:	39 c1                	cmp    %eax,%ecx
+8010360e:	89 d9                	mov    %ebx,%ecx
+80103610:	19 d1                	sbb    %edx,%ecx
+80103612:	73 38                	jae    8010364c <iso_pop+0x7a>
+  acquire(&iso_rq.lock);
+80103614:	83 ec 0c             	sub    $0xc,%esp
+80103617:	68 80 3f 11 80       	push   $0x80113f80
+8010361c:	e8 94 20 00 00       	call   801056b5 <acquire>
+  p = pop_min(&iso_rq);
+80103621:	c7 04 24 80 3f 11 80 	movl   $0x80113f80,(%esp)
+80103628:	e8 f0 1d 00 00       	call   8010541d <pop_min>
+8010362d:	89 c3                	mov    %eax,%ebx
+  release(&iso_rq.lock);
+8010362f:	c7 04 24 80 3f 11 80 	movl   $0x80113f80,(%esp)
+80103636:	e8 df 20 00 00       	call   8010571a <release>
+  return p;
+8010363b:	83 c4 10             	add    $0x10,%esp
+}
+8010363e:	89 d8                	mov    %ebx,%eax
+80103640:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103643:	c9                   	leave
+80103644:	c3                   	ret
+    return NULL;
+80103645:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010364a:	eb f2                	jmp    8010363e <iso_pop+0x6c>
+    return NULL;
+8010364c:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103651:	eb eb                	jmp    8010363e <iso_pop+0x6c>
+
+80103653 <rq_pop>:
+{
+80103653:	55                   	push   %ebp
+80103654:	89 e5                	mov    %esp,%ebp
+80103656:	57                   	push   %edi
+80103657:	56                   	push   %esi
+80103658:	53                   	push   %ebx
+80103659:	83 ec 1c             	sub    $0x1c,%esp
+8010365c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  best = c->runqueue->size > 0 ? c->runqueue : NULL;
+8010365f:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+80103665:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80103668:	8b 40 34             	mov    0x34(%eax),%eax
+8010366b:	85 c0                	test   %eax,%eax
+8010366d:	7e 0d                	jle    8010367c <rq_pop+0x29>
+8010366f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103672:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      best = rq;
+80103675:	bf 00 00 00 00       	mov    $0x0,%edi
+8010367a:	eb 33                	jmp    801036af <rq_pop+0x5c>
+  best = c->runqueue->size > 0 ? c->runqueue : NULL;
+8010367c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+80103683:	eb f0                	jmp    80103675 <rq_pop+0x22>
+      if(rq->min_deadline + slack < best->min_deadline)
+80103685:	8b 4e 38             	mov    0x38(%esi),%ecx
+80103688:	8b 5e 3c             	mov    0x3c(%esi),%ebx
+8010368b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010368e:	99                   	cltd
+8010368f:	01 c8                	add    %ecx,%eax
+80103691:	11 da                	adc    %ebx,%edx
+80103693:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80103696:	8b 59 3c             	mov    0x3c(%ecx),%ebx
+80103699:	8b 49 38             	mov    0x38(%ecx),%ecx
+8010369c:	39 c8                	cmp    %ecx,%eax
+8010369e:	89 d0                	mov    %edx,%eax
+801036a0:	19 d8                	sbb    %ebx,%eax
+801036a2:	73 08                	jae    801036ac <rq_pop+0x59>
+        best = rq;
+801036a4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+801036a7:	eb 03                	jmp    801036ac <rq_pop+0x59>
+      best = rq;
+801036a9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  for(i = 0; i < ncpu; i++){
+801036ac:	83 c7 01             	add    $0x1,%edi
+801036af:	39 3d e4 37 11 80    	cmp    %edi,0x801137e4
+801036b5:	7e 68                	jle    8010371f <rq_pop+0xcc>
+    rq = cpus[i].runqueue;
+801036b7:	69 c7 d8 00 00 00    	imul   $0xd8,%edi,%eax
+801036bd:	8b b0 b0 38 11 80    	mov    -0x7feec750(%eax),%esi
+    if(rq == c->runqueue || rq->size == 0)
+801036c3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801036c6:	39 f3                	cmp    %esi,%ebx
+801036c8:	74 e2                	je     801036ac <rq_pop+0x59>
+801036ca:	8b 46 34             	mov    0x34(%esi),%eax
+801036cd:	85 c0                	test   %eax,%eax
+801036cf:	74 db                	je     801036ac <rq_pop+0x59>
+    if(best == NULL)
+801036d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801036d4:	85 c0                	test   %eax,%eax
+801036d6:	74 d1                	je     801036a9 <rq_pop+0x56>
+    else if(best == c->runqueue){
+801036d8:	39 c3                	cmp    %eax,%ebx
+801036da:	74 a9                	je     80103685 <rq_pop+0x32>
+    } else if(rq->min_deadline < best->min_deadline ||
+801036dc:	8b 4e 38             	mov    0x38(%esi),%ecx
+801036df:	8b 5e 3c             	mov    0x3c(%esi),%ebx
+801036e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801036e5:	8b 50 3c             	mov    0x3c(%eax),%edx
+801036e8:	8b 40 38             	mov    0x38(%eax),%eax
+801036eb:	39 c1                	cmp    %eax,%ecx
+801036ed:	19 d3                	sbb    %edx,%ebx
+801036ef:	72 29                	jb     8010371a <rq_pop+0xc7>
+              (rq->min_deadline == best->min_deadline &&
+801036f1:	8b 46 38             	mov    0x38(%esi),%eax
+801036f4:	8b 56 3c             	mov    0x3c(%esi),%edx
+801036f7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801036fa:	8b 59 3c             	mov    0x3c(%ecx),%ebx
+801036fd:	8b 49 38             	mov    0x38(%ecx),%ecx
+    } else if(rq->min_deadline < best->min_deadline ||
+80103700:	31 c8                	xor    %ecx,%eax
+80103702:	31 da                	xor    %ebx,%edx
+80103704:	09 d0                	or     %edx,%eax
+80103706:	75 a4                	jne    801036ac <rq_pop+0x59>
+               rq->size > best->size))
+80103708:	8b 56 34             	mov    0x34(%esi),%edx
+8010370b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010370e:	8b 40 34             	mov    0x34(%eax),%eax
+              (rq->min_deadline == best->min_deadline &&
+80103711:	39 c2                	cmp    %eax,%edx
+80103713:	7e 97                	jle    801036ac <rq_pop+0x59>
+      best = rq;
+80103715:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80103718:	eb 92                	jmp    801036ac <rq_pop+0x59>
+8010371a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010371d:	eb 8d                	jmp    801036ac <rq_pop+0x59>
+  if(best == NULL)
+8010371f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103722:	85 ff                	test   %edi,%edi
+80103724:	74 1f                	je     80103745 <rq_pop+0xf2>
+  acquire(&best->lock);
+80103726:	83 ec 0c             	sub    $0xc,%esp
+80103729:	57                   	push   %edi
+8010372a:	e8 86 1f 00 00       	call   801056b5 <acquire>
+  p = pop_min(best);
+8010372f:	89 3c 24             	mov    %edi,(%esp)
+80103732:	e8 e6 1c 00 00       	call   8010541d <pop_min>
+80103737:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  release(&best->lock);
+8010373a:	89 3c 24             	mov    %edi,(%esp)
+8010373d:	e8 d8 1f 00 00       	call   8010571a <release>
+  return p;
+80103742:	83 c4 10             	add    $0x10,%esp
+}
+80103745:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103748:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010374b:	5b                   	pop    %ebx
+8010374c:	5e                   	pop    %esi
+8010374d:	5f                   	pop    %edi
+8010374e:	5d                   	pop    %ebp
+8010374f:	c3                   	ret
+
+80103750 <rr_pick_next>:
+{
+80103750:	55                   	push   %ebp
+80103751:	89 e5                	mov    %esp,%ebp
+80103753:	83 ec 08             	sub    $0x8,%esp
+  struct proc *p = rq_pop(c, 0);
+80103756:	ba 00 00 00 00       	mov    $0x0,%edx
+8010375b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010375e:	e8 f0 fe ff ff       	call   80103653 <rq_pop>
+  if(p != NULL)
+80103763:	85 c0                	test   %eax,%eax
+80103765:	74 0a                	je     80103771 <rr_pick_next+0x21>
+    p->ticks_left = 1;
+80103767:	c7 80 84 00 00 00 01 	movl   $0x1,0x84(%eax)
+8010376e:	00 00 00 
+}
+80103771:	c9                   	leave
+80103772:	c3                   	ret
+
+80103773 <bfs_pick_next>:
+{
+80103773:	55                   	push   %ebp
+80103774:	89 e5                	mov    %esp,%ebp
+80103776:	53                   	push   %ebx
+80103777:	83 ec 04             	sub    $0x4,%esp
+  if((p = iso_pop(c)) == NULL && (p = rq_pop(c, affinity_window)) == NULL &&
+8010377a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010377d:	e8 50 fe ff ff       	call   801035d2 <iso_pop>
+80103782:	89 c3                	mov    %eax,%ebx
+80103784:	85 c0                	test   %eax,%eax
+80103786:	74 36                	je     801037be <bfs_pick_next+0x4b>
+  if(p != NULL && p->slice == 0){
+80103788:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+8010378e:	0b 83 88 00 00 00    	or     0x88(%ebx),%eax
+80103794:	75 21                	jne    801037b7 <bfs_pick_next+0x44>
+    p->slice = (uint64)BFS_DEFAULT_QUANTUM * tsc_per_tick;
+80103796:	b8 32 00 00 00       	mov    $0x32,%eax
+8010379b:	f7 25 60 c0 10 80    	mull   0x8010c060
+801037a1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+801037a7:	89 93 8c 00 00 00    	mov    %edx,0x8c(%ebx)
+    p->ticks_left = BFS_DEFAULT_QUANTUM;
+801037ad:	c7 83 84 00 00 00 32 	movl   $0x32,0x84(%ebx)
+801037b4:	00 00 00 
+}
+801037b7:	89 d8                	mov    %ebx,%eax
+801037b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801037bc:	c9                   	leave
+801037bd:	c3                   	ret
+  if((p = iso_pop(c)) == NULL && (p = rq_pop(c, affinity_window)) == NULL &&
+801037be:	8b 15 08 c0 10 80    	mov    0x8010c008,%edx
+801037c4:	8b 45 08             	mov    0x8(%ebp),%eax
+801037c7:	e8 87 fe ff ff       	call   80103653 <rq_pop>
+801037cc:	89 c3                	mov    %eax,%ebx
+801037ce:	85 c0                	test   %eax,%eax
+801037d0:	75 b6                	jne    80103788 <bfs_pick_next+0x15>
+     idleprio_rq.size > 0){
+801037d2:	a1 f4 3e 11 80       	mov    0x80113ef4,%eax
+  if((p = iso_pop(c)) == NULL && (p = rq_pop(c, affinity_window)) == NULL &&
+801037d7:	85 c0                	test   %eax,%eax
+801037d9:	7f 06                	jg     801037e1 <bfs_pick_next+0x6e>
+  if(p != NULL && p->slice == 0){
+801037db:	85 db                	test   %ebx,%ebx
+801037dd:	75 a9                	jne    80103788 <bfs_pick_next+0x15>
+801037df:	eb d6                	jmp    801037b7 <bfs_pick_next+0x44>
+    acquire(&idleprio_rq.lock);
+801037e1:	83 ec 0c             	sub    $0xc,%esp
+801037e4:	68 c0 3e 11 80       	push   $0x80113ec0
+801037e9:	e8 c7 1e 00 00       	call   801056b5 <acquire>
+    p = pop_min(&idleprio_rq);
+801037ee:	c7 04 24 c0 3e 11 80 	movl   $0x80113ec0,(%esp)
+801037f5:	e8 23 1c 00 00       	call   8010541d <pop_min>
+801037fa:	89 c3                	mov    %eax,%ebx
+    release(&idleprio_rq.lock);
+801037fc:	c7 04 24 c0 3e 11 80 	movl   $0x80113ec0,(%esp)
+80103803:	e8 12 1f 00 00       	call   8010571a <release>
+80103808:	83 c4 10             	add    $0x10,%esp
+8010380b:	eb ce                	jmp    801037db <bfs_pick_next+0x68>
+
+8010380d <rq_remove>:
+{
+8010380d:	55                   	push   %ebp
+8010380e:	89 e5                	mov    %esp,%ebp
+80103810:	56                   	push   %esi
+80103811:	53                   	push   %ebx
+80103812:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct skiplist *rq = p->runqueue;
+80103815:	8b 9e 34 01 00 00    	mov    0x134(%esi),%ebx
+  if(rq == NULL)
+8010381b:	85 db                	test   %ebx,%ebx
+8010381d:	74 48                	je     80103867 <rq_remove+0x5a>
+  acquire(&rq->lock);
+8010381f:	83 ec 0c             	sub    $0xc,%esp
+80103822:	53                   	push   %ebx
+80103823:	e8 8d 1e 00 00       	call   801056b5 <acquire>
+  if(p->runqueue != rq){
+80103828:	83 c4 10             	add    $0x10,%esp
+8010382b:	39 9e 34 01 00 00    	cmp    %ebx,0x134(%esi)
+80103831:	74 18                	je     8010384b <rq_remove+0x3e>
+    release(&rq->lock);
+80103833:	83 ec 0c             	sub    $0xc,%esp
+80103836:	53                   	push   %ebx
+80103837:	e8 de 1e 00 00       	call   8010571a <release>
+    return 0;
+8010383c:	83 c4 10             	add    $0x10,%esp
+8010383f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80103844:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103847:	5b                   	pop    %ebx
+80103848:	5e                   	pop    %esi
+80103849:	5d                   	pop    %ebp
+8010384a:	c3                   	ret
+  delete_node(rq, p);
+8010384b:	83 ec 08             	sub    $0x8,%esp
+8010384e:	56                   	push   %esi
+8010384f:	53                   	push   %ebx
+80103850:	e8 9a 1b 00 00       	call   801053ef <delete_node>
+  release(&rq->lock);
+80103855:	89 1c 24             	mov    %ebx,(%esp)
+80103858:	e8 bd 1e 00 00       	call   8010571a <release>
+  return 1;
+8010385d:	83 c4 10             	add    $0x10,%esp
+80103860:	b8 01 00 00 00       	mov    $0x1,%eax
+80103865:	eb dd                	jmp    80103844 <rq_remove+0x37>
+    return 0;
+80103867:	b8 00 00 00 00       	mov    $0x0,%eax
+8010386c:	eb d6                	jmp    80103844 <rq_remove+0x37>
+
+8010386e <rq_insert_on>:
+{
+8010386e:	55                   	push   %ebp
+8010386f:	89 e5                	mov    %esp,%ebp
+80103871:	56                   	push   %esi
+80103872:	53                   	push   %ebx
+80103873:	89 c3                	mov    %eax,%ebx
+80103875:	89 d6                	mov    %edx,%esi
+  acquire(&rq->lock);
+80103877:	83 ec 0c             	sub    $0xc,%esp
+8010387a:	50                   	push   %eax
+8010387b:	e8 35 1e 00 00       	call   801056b5 <acquire>
+  insert_node(rq, p);
+80103880:	83 c4 08             	add    $0x8,%esp
+80103883:	56                   	push   %esi
+80103884:	53                   	push   %ebx
+80103885:	e8 d7 19 00 00       	call   80105261 <insert_node>
+  release(&rq->lock);
+8010388a:	89 1c 24             	mov    %ebx,(%esp)
+8010388d:	e8 88 1e 00 00       	call   8010571a <release>
+}
+80103892:	83 c4 10             	add    $0x10,%esp
+80103895:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103898:	5b                   	pop    %ebx
+80103899:	5e                   	pop    %esi
+8010389a:	5d                   	pop    %ebp
+8010389b:	c3                   	ret
+
+8010389c <rq_insert>:
+{
+8010389c:	55                   	push   %ebp
+8010389d:	89 e5                	mov    %esp,%ebp
+8010389f:	83 ec 08             	sub    $0x8,%esp
+801038a2:	89 c2                	mov    %eax,%edx
+  rq_insert_on(cpus[p->cpu].runqueue, p);
+801038a4:	69 80 38 01 00 00 d8 	imul   $0xd8,0x138(%eax),%eax
+801038ab:	00 00 00 
+801038ae:	8b 80 b0 38 11 80    	mov    -0x7feec750(%eax),%eax
+801038b4:	e8 b5 ff ff ff       	call   8010386e <rq_insert_on>
+}
+801038b9:	c9                   	leave
+801038ba:	c3                   	ret
+
+801038bb <rr_enqueue>:
+{
+801038bb:	55                   	push   %ebp
+801038bc:	89 e5                	mov    %esp,%ebp
+801038be:	56                   	push   %esi
+801038bf:	53                   	push   %ebx
+801038c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  p->virtual_deadline = rr_clock++;
+801038c3:	a1 38 96 11 80       	mov    0x80119638,%eax
+801038c8:	8b 15 3c 96 11 80    	mov    0x8011963c,%edx
+801038ce:	89 c1                	mov    %eax,%ecx
+801038d0:	89 d3                	mov    %edx,%ebx
+801038d2:	83 c1 01             	add    $0x1,%ecx
+801038d5:	83 d3 00             	adc    $0x0,%ebx
+801038d8:	89 0d 38 96 11 80    	mov    %ecx,0x80119638
+801038de:	89 1d 3c 96 11 80    	mov    %ebx,0x8011963c
+801038e4:	89 86 c8 00 00 00    	mov    %eax,0xc8(%esi)
+801038ea:	89 96 cc 00 00 00    	mov    %edx,0xcc(%esi)
+  rq_insert(p);
+801038f0:	89 f0                	mov    %esi,%eax
+801038f2:	e8 a5 ff ff ff       	call   8010389c <rq_insert>
+}
+801038f7:	5b                   	pop    %ebx
+801038f8:	5e                   	pop    %esi
+801038f9:	5d                   	pop    %ebp
+801038fa:	c3                   	ret
+
+801038fb <bfs_enqueue>:
+{
+801038fb:	55                   	push   %ebp
+801038fc:	89 e5                	mov    %esp,%ebp
+801038fe:	53                   	push   %ebx
+801038ff:	83 ec 04             	sub    $0x4,%esp
+80103902:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(p->slice == 0)
+80103905:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+8010390b:	0b 83 88 00 00 00    	or     0x88(%ebx),%eax
+80103911:	74 1a                	je     8010392d <bfs_enqueue+0x32>
+  switch(bfs_class(p)){
+80103913:	89 d8                	mov    %ebx,%eax
+80103915:	e8 77 f8 ff ff       	call   80103191 <bfs_class>
+8010391a:	83 f8 01             	cmp    $0x1,%eax
+8010391d:	74 2d                	je     8010394c <bfs_enqueue+0x51>
+8010391f:	83 f8 02             	cmp    $0x2,%eax
+80103922:	74 39                	je     8010395d <bfs_enqueue+0x62>
+    rq_insert(p);
+80103924:	89 d8                	mov    %ebx,%eax
+80103926:	e8 71 ff ff ff       	call   8010389c <rq_insert>
+}
+8010392b:	eb 2b                	jmp    80103958 <bfs_enqueue+0x5d>
+    p->virtual_deadline = compute_virtual_deadline(p->nice_value);
+8010392d:	83 ec 0c             	sub    $0xc,%esp
+80103930:	ff b3 bc 00 00 00    	push   0xbc(%ebx)
+80103936:	e8 f9 c6 ff ff       	call   80100034 <compute_virtual_deadline>
+8010393b:	89 83 c8 00 00 00    	mov    %eax,0xc8(%ebx)
+80103941:	89 93 cc 00 00 00    	mov    %edx,0xcc(%ebx)
+80103947:	83 c4 10             	add    $0x10,%esp
+8010394a:	eb c7                	jmp    80103913 <bfs_enqueue+0x18>
+    rq_insert_on(&iso_rq, p);
+8010394c:	89 da                	mov    %ebx,%edx
+8010394e:	b8 80 3f 11 80       	mov    $0x80113f80,%eax
+80103953:	e8 16 ff ff ff       	call   8010386e <rq_insert_on>
+}
+80103958:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010395b:	c9                   	leave
+8010395c:	c3                   	ret
+    rq_insert_on(&idleprio_rq, p);
+8010395d:	89 da                	mov    %ebx,%edx
+8010395f:	b8 c0 3e 11 80       	mov    $0x80113ec0,%eax
+80103964:	e8 05 ff ff ff       	call   8010386e <rq_insert_on>
+    break;
+80103969:	eb ed                	jmp    80103958 <bfs_enqueue+0x5d>
+
+8010396b <allocproc>:
+{
+8010396b:	55                   	push   %ebp
+8010396c:	89 e5                	mov    %esp,%ebp
+8010396e:	53                   	push   %ebx
+8010396f:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80103972:	68 00 46 11 80       	push   $0x80114600
+80103977:	e8 39 1d 00 00       	call   801056b5 <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+8010397c:	83 c4 10             	add    $0x10,%esp
+8010397f:	bb 34 46 11 80       	mov    $0x80114634,%ebx
+80103984:	eb 06                	jmp    8010398c <allocproc+0x21>
+80103986:	81 c3 3c 01 00 00    	add    $0x13c,%ebx
+8010398c:	81 fb 34 95 11 80    	cmp    $0x80119534,%ebx
+80103992:	0f 83 d0 00 00 00    	jae    80103a68 <allocproc+0xfd>
+    if(p->state == UNUSED)
+80103998:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+8010399c:	75 e8                	jne    80103986 <allocproc+0x1b>
+  p->state = EMBRYO;
+8010399e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  p->runtime = 0;
+801039a5:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+801039ac:	00 00 00 
+801039af:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+801039b6:	00 00 00 
+  p->wait_time = 0;
+801039b9:	c7 83 a0 00 00 00 00 	movl   $0x0,0xa0(%ebx)
+801039c0:	00 00 00 
+801039c3:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+801039ca:	00 00 00 
+  p->max_wait = 0;
+801039cd:	c7 83 a8 00 00 00 00 	movl   $0x0,0xa8(%ebx)
+801039d4:	00 00 00 
+801039d7:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+801039de:	00 00 00 
+  p->dispatches = 0;
+801039e1:	c7 83 b0 00 00 00 00 	movl   $0x0,0xb0(%ebx)
+801039e8:	00 00 00 
+  p->nvcsw = 0;
+801039eb:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+801039f2:	00 00 00 
+  p->nivcsw = 0;
+801039f5:	c7 83 b8 00 00 00 00 	movl   $0x0,0xb8(%ebx)
+801039fc:	00 00 00 
+  p->pid = nextpid++;
+801039ff:	a1 0c c0 10 80       	mov    0x8010c00c,%eax
+80103a04:	8d 50 01             	lea    0x1(%eax),%edx
+80103a07:	89 15 0c c0 10 80    	mov    %edx,0x8010c00c
+80103a0d:	89 43 10             	mov    %eax,0x10(%ebx)
+  release(&ptable.lock);
+80103a10:	83 ec 0c             	sub    $0xc,%esp
+80103a13:	68 00 46 11 80       	push   $0x80114600
+80103a18:	e8 fd 1c 00 00       	call   8010571a <release>
+  if((p->kstack = kalloc()) == 0){
+80103a1d:	e8 86 e6 ff ff       	call   801020a8 <kalloc>
+80103a22:	89 43 08             	mov    %eax,0x8(%ebx)
+80103a25:	83 c4 10             	add    $0x10,%esp
+80103a28:	85 c0                	test   %eax,%eax
+80103a2a:	74 53                	je     80103a7f <allocproc+0x114>
+  sp -= sizeof *p->tf;
+80103a2c:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  p->tf = (struct trapframe*)sp;
+80103a32:	89 53 18             	mov    %edx,0x18(%ebx)
+  *(uint*)sp = (uint)trapret;
+80103a35:	c7 80 b0 0f 00 00 a9 	movl   $0x80106aa9,0xfb0(%eax)
+80103a3c:	6a 10 80 
+  sp -= sizeof *p->context;
+80103a3f:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  p->context = (struct context*)sp;
+80103a44:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80103a47:	83 ec 04             	sub    $0x4,%esp
+80103a4a:	6a 14                	push   $0x14
+80103a4c:	6a 00                	push   $0x0
+80103a4e:	50                   	push   %eax
+80103a4f:	e8 0d 1d 00 00       	call   80105761 <memset>
+  p->context->eip = (uint)forkret;
+80103a54:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80103a57:	c7 40 10 8a 3a 10 80 	movl   $0x80103a8a,0x10(%eax)
+  return p;
+80103a5e:	83 c4 10             	add    $0x10,%esp
+}
+80103a61:	89 d8                	mov    %ebx,%eax
+80103a63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103a66:	c9                   	leave
+80103a67:	c3                   	ret
+  release(&ptable.lock);
+80103a68:	83 ec 0c             	sub    $0xc,%esp
+80103a6b:	68 00 46 11 80       	push   $0x80114600
+80103a70:	e8 a5 1c 00 00       	call   8010571a <release>
+  return 0;
+80103a75:	83 c4 10             	add    $0x10,%esp
+80103a78:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103a7d:	eb e2                	jmp    80103a61 <allocproc+0xf6>
+    p->state = UNUSED;
+80103a7f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    return 0;
+80103a86:	89 c3                	mov    %eax,%ebx
+80103a88:	eb d7                	jmp    80103a61 <allocproc+0xf6>
+
+80103a8a <forkret>:
+{
+80103a8a:	55                   	push   %ebp
+80103a8b:	89 e5                	mov    %esp,%ebp
+80103a8d:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+80103a90:	68 00 46 11 80       	push   $0x80114600
+80103a95:	e8 80 1c 00 00       	call   8010571a <release>
+  if (first) {
+80103a9a:	83 c4 10             	add    $0x10,%esp
+80103a9d:	83 3d 00 c0 10 80 00 	cmpl   $0x0,0x8010c000
+80103aa4:	75 02                	jne    80103aa8 <forkret+0x1e>
+}
+80103aa6:	c9                   	leave
+80103aa7:	c3                   	ret
+    first = 0;
+80103aa8:	c7 05 00 c0 10 80 00 	movl   $0x0,0x8010c000
+80103aaf:	00 00 00 
+    iinit(ROOTDEV);
+80103ab2:	83 ec 0c             	sub    $0xc,%esp
+80103ab5:	6a 01                	push   $0x1
+80103ab7:	e8 fa d7 ff ff       	call   801012b6 <iinit>
+    initlog(ROOTDEV);
+80103abc:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80103ac3:	e8 ea ec ff ff       	call   801027b2 <initlog>
+80103ac8:	83 c4 10             	add    $0x10,%esp
+}
+80103acb:	eb d9                	jmp    80103aa6 <forkret+0x1c>
+
+80103acd <isotick>:
+  iso_load -= iso_load >> BFS_ISO_SHIFT;
+80103acd:	a1 44 96 11 80       	mov    0x80119644,%eax
+80103ad2:	89 c2                	mov    %eax,%edx
+80103ad4:	c1 ea 09             	shr    $0x9,%edx
+80103ad7:	29 d0                	sub    %edx,%eax
+80103ad9:	a3 44 96 11 80       	mov    %eax,0x80119644
+  for(i = 0; i < ncpu; i++)
+80103ade:	b8 00 00 00 00       	mov    $0x0,%eax
+80103ae3:	eb 03                	jmp    80103ae8 <isotick+0x1b>
+80103ae5:	83 c0 01             	add    $0x1,%eax
+80103ae8:	8b 15 e4 37 11 80    	mov    0x801137e4,%edx
+80103aee:	39 c2                	cmp    %eax,%edx
+80103af0:	7e 22                	jle    80103b14 <isotick+0x47>
+    if((p = cpus[i].proc) != NULL && p->sched_class == SCHED_ISO)
+80103af2:	69 d0 d8 00 00 00    	imul   $0xd8,%eax,%edx
+80103af8:	8b 92 ac 38 11 80    	mov    -0x7feec754(%edx),%edx
+80103afe:	85 d2                	test   %edx,%edx
+80103b00:	74 e3                	je     80103ae5 <isotick+0x18>
+80103b02:	83 ba c0 00 00 00 01 	cmpl   $0x1,0xc0(%edx)
+80103b09:	75 da                	jne    80103ae5 <isotick+0x18>
+      iso_load += 128;
+80103b0b:	83 2d 44 96 11 80 80 	subl   $0xffffff80,0x80119644
+80103b12:	eb d1                	jmp    80103ae5 <isotick+0x18>
+  full = (128 * ncpu) << BFS_ISO_SHIFT;
+80103b14:	c1 e2 10             	shl    $0x10,%edx
+  if(iso_load * 100 > iso_cpu * full)
+80103b17:	a1 44 96 11 80       	mov    0x80119644,%eax
+80103b1c:	6b c8 64             	imul   $0x64,%eax,%ecx
+80103b1f:	0f af 15 04 c0 10 80 	imul   0x8010c004,%edx
+80103b26:	39 ca                	cmp    %ecx,%edx
+80103b28:	73 0b                	jae    80103b35 <isotick+0x68>
+    iso_throttled = 1;
+80103b2a:	c7 05 40 96 11 80 01 	movl   $0x1,0x80119640
+80103b31:	00 00 00 
+80103b34:	c3                   	ret
+  else if(iso_load * 1000 < iso_cpu * 9 * full)
+80103b35:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+80103b3b:	8d 14 d2             	lea    (%edx,%edx,8),%edx
+80103b3e:	39 d0                	cmp    %edx,%eax
+80103b40:	73 0a                	jae    80103b4c <isotick+0x7f>
+    iso_throttled = 0;
+80103b42:	c7 05 40 96 11 80 00 	movl   $0x0,0x80119640
+80103b49:	00 00 00 
+}
+80103b4c:	c3                   	ret
+
+80103b4d <isocpu>:
+{
+80103b4d:	55                   	push   %ebp
+80103b4e:	89 e5                	mov    %esp,%ebp
+80103b50:	8b 45 08             	mov    0x8(%ebp),%eax
+  int old = iso_cpu;
+80103b53:	8b 15 04 c0 10 80    	mov    0x8010c004,%edx
+  if(percent < 0 || percent > 100)
+80103b59:	83 f8 64             	cmp    $0x64,%eax
+80103b5c:	77 09                	ja     80103b67 <isocpu+0x1a>
+  iso_cpu = percent;
+80103b5e:	a3 04 c0 10 80       	mov    %eax,0x8010c004
+}
+80103b63:	89 d0                	mov    %edx,%eax
+80103b65:	5d                   	pop    %ebp
+80103b66:	c3                   	ret
+    return -1;
+80103b67:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80103b6c:	eb f5                	jmp    80103b63 <isocpu+0x16>
+
+80103b6e <affinity>:
+{
+80103b6e:	55                   	push   %ebp
+80103b6f:	89 e5                	mov    %esp,%ebp
+80103b71:	8b 45 08             	mov    0x8(%ebp),%eax
+  int old = affinity_window;
+80103b74:	8b 15 08 c0 10 80    	mov    0x8010c008,%edx
+  if(window < 0)
+80103b7a:	85 c0                	test   %eax,%eax
+80103b7c:	78 09                	js     80103b87 <affinity+0x19>
+  affinity_window = window;
+80103b7e:	a3 08 c0 10 80       	mov    %eax,0x8010c008
+}
+80103b83:	89 d0                	mov    %edx,%eax
+80103b85:	5d                   	pop    %ebp
+80103b86:	c3                   	ret
+    return -1;
+80103b87:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80103b8c:	eb f5                	jmp    80103b83 <affinity+0x15>
+
+80103b8e <pinit>:
+{
+80103b8e:	55                   	push   %ebp
+80103b8f:	89 e5                	mov    %esp,%ebp
+80103b91:	56                   	push   %esi
+80103b92:	53                   	push   %ebx
+  initlock(&ptable.lock, "ptable");
+80103b93:	83 ec 08             	sub    $0x8,%esp
+80103b96:	68 94 8b 10 80       	push   $0x80108b94
+80103b9b:	68 00 46 11 80       	push   $0x80114600
+80103ba0:	e8 cc 19 00 00       	call   80105571 <initlock>
+  for(int i = 0; i < NCPU; i++){
+80103ba5:	83 c4 10             	add    $0x10,%esp
+80103ba8:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103bad:	eb 27                	jmp    80103bd6 <pinit+0x48>
+    init_skiplist(&runqueues[i]);
+80103baf:	69 f3 b8 00 00 00    	imul   $0xb8,%ebx,%esi
+80103bb5:	81 c6 40 40 11 80    	add    $0x80114040,%esi
+80103bbb:	83 ec 0c             	sub    $0xc,%esp
+80103bbe:	56                   	push   %esi
+80103bbf:	e8 4d 15 00 00       	call   80105111 <init_skiplist>
+    cpus[i].runqueue = &runqueues[i];
+80103bc4:	69 c3 d8 00 00 00    	imul   $0xd8,%ebx,%eax
+80103bca:	89 b0 b0 38 11 80    	mov    %esi,-0x7feec750(%eax)
+  for(int i = 0; i < NCPU; i++){
+80103bd0:	83 c3 01             	add    $0x1,%ebx
+80103bd3:	83 c4 10             	add    $0x10,%esp
+80103bd6:	83 fb 07             	cmp    $0x7,%ebx
+80103bd9:	7e d4                	jle    80103baf <pinit+0x21>
+  init_skiplist(&iso_rq);
+80103bdb:	83 ec 0c             	sub    $0xc,%esp
+80103bde:	68 80 3f 11 80       	push   $0x80113f80
+80103be3:	e8 29 15 00 00       	call   80105111 <init_skiplist>
+  init_skiplist(&idleprio_rq);
+80103be8:	c7 04 24 c0 3e 11 80 	movl   $0x80113ec0,(%esp)
+80103bef:	e8 1d 15 00 00       	call   80105111 <init_skiplist>
+  schedloginit();
+80103bf4:	e8 23 11 00 00       	call   80104d1c <schedloginit>
+}
+80103bf9:	83 c4 10             	add    $0x10,%esp
+80103bfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103bff:	5b                   	pop    %ebx
+80103c00:	5e                   	pop    %esi
+80103c01:	5d                   	pop    %ebp
+80103c02:	c3                   	ret
+
+80103c03 <mycpu>:
+{
+80103c03:	55                   	push   %ebp
+80103c04:	89 e5                	mov    %esp,%ebp
+80103c06:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80103c09:	9c                   	pushf
+80103c0a:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80103c0b:	f6 c4 02             	test   $0x2,%ah
+80103c0e:	75 28                	jne    80103c38 <mycpu+0x35>
+  apicid = lapicid();
+80103c10:	e8 8e e7 ff ff       	call   801023a3 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80103c15:	ba 00 00 00 00       	mov    $0x0,%edx
+80103c1a:	39 15 e4 37 11 80    	cmp    %edx,0x801137e4
+80103c20:	7e 23                	jle    80103c45 <mycpu+0x42>
+    if (cpus[i].apicid == apicid)
+80103c22:	69 ca d8 00 00 00    	imul   $0xd8,%edx,%ecx
+80103c28:	0f b6 89 00 38 11 80 	movzbl -0x7feec800(%ecx),%ecx
+80103c2f:	39 c1                	cmp    %eax,%ecx
+80103c31:	74 1f                	je     80103c52 <mycpu+0x4f>
+  for (i = 0; i < ncpu; ++i) {
+80103c33:	83 c2 01             	add    $0x1,%edx
+80103c36:	eb e2                	jmp    80103c1a <mycpu+0x17>
+    panic("mycpu called with interrupts enabled\n");
+80103c38:	83 ec 0c             	sub    $0xc,%esp
+80103c3b:	68 80 8c 10 80       	push   $0x80108c80
+80103c40:	e8 29 c7 ff ff       	call   8010036e <panic>
+  panic("unknown apicid\n");
+80103c45:	83 ec 0c             	sub    $0xc,%esp
+80103c48:	68 9b 8b 10 80       	push   $0x80108b9b
+80103c4d:	e8 1c c7 ff ff       	call   8010036e <panic>
+      return &cpus[i];
+80103c52:	69 c2 d8 00 00 00    	imul   $0xd8,%edx,%eax
+80103c58:	05 00 38 11 80       	add    $0x80113800,%eax
+}
+80103c5d:	c9                   	leave
+80103c5e:	c3                   	ret
+
+80103c5f <charge>:
+{
+80103c5f:	55                   	push   %ebp
+80103c60:	89 e5                	mov    %esp,%ebp
+80103c62:	57                   	push   %edi
+80103c63:	56                   	push   %esi
+80103c64:	53                   	push   %ebx
+80103c65:	83 ec 0c             	sub    $0xc,%esp
+80103c68:	89 c1                	mov    %eax,%ecx
+  asm volatile("rdtsc" : "=A" (tsc));
+80103c6a:	0f 31                	rdtsc
+  uint64 cycles = now - p->stamp;
+80103c6c:	89 c6                	mov    %eax,%esi
+80103c6e:	89 d7                	mov    %edx,%edi
+80103c70:	2b b1 98 00 00 00    	sub    0x98(%ecx),%esi
+80103c76:	1b b9 9c 00 00 00    	sbb    0x9c(%ecx),%edi
+  p->runtime += cycles;
+80103c7c:	01 b1 90 00 00 00    	add    %esi,0x90(%ecx)
+80103c82:	11 b9 94 00 00 00    	adc    %edi,0x94(%ecx)
+  p->stamp = now;
+80103c88:	89 81 98 00 00 00    	mov    %eax,0x98(%ecx)
+80103c8e:	89 91 9c 00 00 00    	mov    %edx,0x9c(%ecx)
+  if(p->sched_class == SCHED_ISO)
+80103c94:	83 b9 c0 00 00 00 01 	cmpl   $0x1,0xc0(%ecx)
+80103c9b:	74 0c                	je     80103ca9 <charge+0x4a>
+}
+80103c9d:	89 f0                	mov    %esi,%eax
+80103c9f:	89 fa                	mov    %edi,%edx
+80103ca1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103ca4:	5b                   	pop    %ebx
+80103ca5:	5e                   	pop    %esi
+80103ca6:	5f                   	pop    %edi
+80103ca7:	5d                   	pop    %ebp
+80103ca8:	c3                   	ret
+    addtime(&mycpu()->iso_ticks, &mycpu()->iso_cycles, cycles);
+80103ca9:	e8 55 ff ff ff       	call   80103c03 <mycpu>
+80103cae:	89 c3                	mov    %eax,%ebx
+80103cb0:	e8 4e ff ff ff       	call   80103c03 <mycpu>
+80103cb5:	8d 93 d4 00 00 00    	lea    0xd4(%ebx),%edx
+80103cbb:	05 d0 00 00 00       	add    $0xd0,%eax
+80103cc0:	83 ec 08             	sub    $0x8,%esp
+80103cc3:	57                   	push   %edi
+80103cc4:	56                   	push   %esi
+80103cc5:	e8 e8 f3 ff ff       	call   801030b2 <addtime>
+80103cca:	83 c4 10             	add    $0x10,%esp
+  return cycles;
+80103ccd:	eb ce                	jmp    80103c9d <charge+0x3e>
+
+80103ccf <schedtick>:
+{
+80103ccf:	55                   	push   %ebp
+80103cd0:	89 e5                	mov    %esp,%ebp
+80103cd2:	56                   	push   %esi
+80103cd3:	53                   	push   %ebx
+80103cd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(policy->tick(p, charge(p)))
+80103cd7:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+80103cdc:	8b 70 14             	mov    0x14(%eax),%esi
+80103cdf:	89 d8                	mov    %ebx,%eax
+80103ce1:	e8 79 ff ff ff       	call   80103c5f <charge>
+80103ce6:	83 ec 04             	sub    $0x4,%esp
+80103ce9:	52                   	push   %edx
+80103cea:	50                   	push   %eax
+80103ceb:	53                   	push   %ebx
+80103cec:	ff d6                	call   *%esi
+80103cee:	83 c4 10             	add    $0x10,%esp
+80103cf1:	85 c0                	test   %eax,%eax
+80103cf3:	75 07                	jne    80103cfc <schedtick+0x2d>
+}
+80103cf5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103cf8:	5b                   	pop    %ebx
+80103cf9:	5e                   	pop    %esi
+80103cfa:	5d                   	pop    %ebp
+80103cfb:	c3                   	ret
+    return 1;
+80103cfc:	b8 01 00 00 00       	mov    $0x1,%eax
+80103d01:	eb f2                	jmp    80103cf5 <schedtick+0x26>
+
+80103d03 <cpuid>:
+cpuid() {
+80103d03:	55                   	push   %ebp
+80103d04:	89 e5                	mov    %esp,%ebp
+80103d06:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80103d09:	e8 f5 fe ff ff       	call   80103c03 <mycpu>
+80103d0e:	2d 00 38 11 80       	sub    $0x80113800,%eax
+80103d13:	c1 f8 03             	sar    $0x3,%eax
+80103d16:	69 c0 13 da 4b 68    	imul   $0x684bda13,%eax,%eax
+}
+80103d1c:	c9                   	leave
+80103d1d:	c3                   	ret
+
+80103d1e <kick_idle_cpu>:
+{
+80103d1e:	55                   	push   %ebp
+80103d1f:	89 e5                	mov    %esp,%ebp
+80103d21:	53                   	push   %ebx
+80103d22:	83 ec 04             	sub    $0x4,%esp
+80103d25:	89 c3                	mov    %eax,%ebx
+  int i, self = cpuid();
+80103d27:	e8 d7 ff ff ff       	call   80103d03 <cpuid>
+80103d2c:	89 c1                	mov    %eax,%ecx
+  if(cpus[target].idle){
+80103d2e:	69 c3 d8 00 00 00    	imul   $0xd8,%ebx,%eax
+80103d34:	05 00 38 11 80       	add    $0x80113800,%eax
+80103d39:	8b 80 b4 00 00 00    	mov    0xb4(%eax),%eax
+80103d3f:	85 c0                	test   %eax,%eax
+80103d41:	75 07                	jne    80103d4a <kick_idle_cpu+0x2c>
+  for(i = 0; i < ncpu; i++){
+80103d43:	b8 00 00 00 00       	mov    $0x0,%eax
+80103d48:	eb 24                	jmp    80103d6e <kick_idle_cpu+0x50>
+    if(target != self)
+80103d4a:	39 d9                	cmp    %ebx,%ecx
+80103d4c:	74 5d                	je     80103dab <kick_idle_cpu+0x8d>
+      lapicsendipi(cpus[target].apicid, T_IRQ0 + IRQ_RESCHED);
+80103d4e:	69 db d8 00 00 00    	imul   $0xd8,%ebx,%ebx
+80103d54:	83 ec 08             	sub    $0x8,%esp
+80103d57:	6a 3e                	push   $0x3e
+80103d59:	0f b6 83 00 38 11 80 	movzbl -0x7feec800(%ebx),%eax
+80103d60:	50                   	push   %eax
+80103d61:	e8 75 e6 ff ff       	call   801023db <lapicsendipi>
+80103d66:	83 c4 10             	add    $0x10,%esp
+    return;
+80103d69:	eb 40                	jmp    80103dab <kick_idle_cpu+0x8d>
+  for(i = 0; i < ncpu; i++){
+80103d6b:	83 c0 01             	add    $0x1,%eax
+80103d6e:	39 05 e4 37 11 80    	cmp    %eax,0x801137e4
+80103d74:	7e 35                	jle    80103dab <kick_idle_cpu+0x8d>
+    if(i != self && cpus[i].idle){
+80103d76:	39 c8                	cmp    %ecx,%eax
+80103d78:	74 f1                	je     80103d6b <kick_idle_cpu+0x4d>
+80103d7a:	69 d0 d8 00 00 00    	imul   $0xd8,%eax,%edx
+80103d80:	81 c2 00 38 11 80    	add    $0x80113800,%edx
+80103d86:	8b 92 b4 00 00 00    	mov    0xb4(%edx),%edx
+80103d8c:	85 d2                	test   %edx,%edx
+80103d8e:	74 db                	je     80103d6b <kick_idle_cpu+0x4d>
+      lapicsendipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+80103d90:	69 c0 d8 00 00 00    	imul   $0xd8,%eax,%eax
+80103d96:	83 ec 08             	sub    $0x8,%esp
+80103d99:	6a 3e                	push   $0x3e
+80103d9b:	0f b6 80 00 38 11 80 	movzbl -0x7feec800(%eax),%eax
+80103da2:	50                   	push   %eax
+80103da3:	e8 33 e6 ff ff       	call   801023db <lapicsendipi>
+      return;
+80103da8:	83 c4 10             	add    $0x10,%esp
+}
+80103dab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103dae:	c9                   	leave
+80103daf:	c3                   	ret
+
+80103db0 <enqueue_process>:
+{
+80103db0:	55                   	push   %ebp
+80103db1:	89 e5                	mov    %esp,%ebp
+80103db3:	53                   	push   %ebx
+80103db4:	83 ec 10             	sub    $0x10,%esp
+80103db7:	89 c3                	mov    %eax,%ebx
+  policy->enqueue(p);
+80103db9:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+80103dbe:	8b 40 08             	mov    0x8(%eax),%eax
+80103dc1:	53                   	push   %ebx
+80103dc2:	ff d0                	call   *%eax
+  kick_idle_cpu(p->cpu);
+80103dc4:	8b 83 38 01 00 00    	mov    0x138(%ebx),%eax
+80103dca:	e8 4f ff ff ff       	call   80103d1e <kick_idle_cpu>
+}
+80103dcf:	83 c4 10             	add    $0x10,%esp
+80103dd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103dd5:	c9                   	leave
+80103dd6:	c3                   	ret
+
+80103dd7 <setpolicy>:
+{
+80103dd7:	55                   	push   %ebp
+80103dd8:	89 e5                	mov    %esp,%ebp
+80103dda:	57                   	push   %edi
+80103ddb:	56                   	push   %esi
+80103ddc:	53                   	push   %ebx
+80103ddd:	83 ec 1c             	sub    $0x1c,%esp
+80103de0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(n < 0 || n >= NELEM(policies))
+80103de3:	83 fb 01             	cmp    $0x1,%ebx
+80103de6:	0f 87 b7 00 00 00    	ja     80103ea3 <setpolicy+0xcc>
+  acquire(&ptable.lock);
+80103dec:	83 ec 0c             	sub    $0xc,%esp
+80103def:	68 00 46 11 80       	push   $0x80114600
+80103df4:	e8 bc 18 00 00       	call   801056b5 <acquire>
+  for(old = 0; policies[old] != policy; old++)
+80103df9:	83 c4 10             	add    $0x10,%esp
+80103dfc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+80103e03:	8b 3d 10 c0 10 80    	mov    0x8010c010,%edi
+80103e09:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103e0c:	39 3c 85 e4 8c 10 80 	cmp    %edi,-0x7fef731c(,%eax,4)
+80103e13:	75 17                	jne    80103e2c <setpolicy+0x55>
+  if(n != old){
+80103e15:	39 d8                	cmp    %ebx,%eax
+80103e17:	74 6f                	je     80103e88 <setpolicy+0xb1>
+    policy = policies[n];
+80103e19:	8b 04 9d e4 8c 10 80 	mov    -0x7fef731c(,%ebx,4),%eax
+80103e20:	a3 10 c0 10 80       	mov    %eax,0x8010c010
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80103e25:	bb 34 46 11 80       	mov    $0x80114634,%ebx
+80103e2a:	eb 38                	jmp    80103e64 <setpolicy+0x8d>
+  for(old = 0; policies[old] != policy; old++)
+80103e2c:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+80103e30:	eb d1                	jmp    80103e03 <setpolicy+0x2c>
+      queued = p->state == RUNNABLE && oldpolicy->dequeue(p);
+80103e32:	8b 47 0c             	mov    0xc(%edi),%eax
+80103e35:	83 ec 0c             	sub    $0xc,%esp
+80103e38:	53                   	push   %ebx
+80103e39:	ff d0                	call   *%eax
+80103e3b:	89 c6                	mov    %eax,%esi
+80103e3d:	83 c4 10             	add    $0x10,%esp
+80103e40:	85 c0                	test   %eax,%eax
+80103e42:	74 05                	je     80103e49 <setpolicy+0x72>
+80103e44:	be 01 00 00 00       	mov    $0x1,%esi
+      policy->fork(p);
+80103e49:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+80103e4e:	8b 40 04             	mov    0x4(%eax),%eax
+80103e51:	83 ec 0c             	sub    $0xc,%esp
+80103e54:	53                   	push   %ebx
+80103e55:	ff d0                	call   *%eax
+      if(queued)
+80103e57:	83 c4 10             	add    $0x10,%esp
+80103e5a:	85 f6                	test   %esi,%esi
+80103e5c:	75 21                	jne    80103e7f <setpolicy+0xa8>
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80103e5e:	81 c3 3c 01 00 00    	add    $0x13c,%ebx
+80103e64:	81 fb 34 95 11 80    	cmp    $0x80119534,%ebx
+80103e6a:	73 1c                	jae    80103e88 <setpolicy+0xb1>
+      if(p->state == UNUSED)
+80103e6c:	8b 43 0c             	mov    0xc(%ebx),%eax
+80103e6f:	85 c0                	test   %eax,%eax
+80103e71:	74 eb                	je     80103e5e <setpolicy+0x87>
+      queued = p->state == RUNNABLE && oldpolicy->dequeue(p);
+80103e73:	83 f8 03             	cmp    $0x3,%eax
+80103e76:	74 ba                	je     80103e32 <setpolicy+0x5b>
+80103e78:	be 00 00 00 00       	mov    $0x0,%esi
+80103e7d:	eb ca                	jmp    80103e49 <setpolicy+0x72>
+        enqueue_process(p);
+80103e7f:	89 d8                	mov    %ebx,%eax
+80103e81:	e8 2a ff ff ff       	call   80103db0 <enqueue_process>
+80103e86:	eb d6                	jmp    80103e5e <setpolicy+0x87>
+  release(&ptable.lock);
+80103e88:	83 ec 0c             	sub    $0xc,%esp
+80103e8b:	68 00 46 11 80       	push   $0x80114600
+80103e90:	e8 85 18 00 00       	call   8010571a <release>
+  return old;
+80103e95:	83 c4 10             	add    $0x10,%esp
+}
+80103e98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103e9e:	5b                   	pop    %ebx
+80103e9f:	5e                   	pop    %esi
+80103ea0:	5f                   	pop    %edi
+80103ea1:	5d                   	pop    %ebp
+80103ea2:	c3                   	ret
+    return -1;
+80103ea3:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+80103eaa:	eb ec                	jmp    80103e98 <setpolicy+0xc1>
+
+80103eac <select_cpu>:
+{
+80103eac:	55                   	push   %ebp
+80103ead:	89 e5                	mov    %esp,%ebp
+80103eaf:	53                   	push   %ebx
+80103eb0:	83 ec 04             	sub    $0x4,%esp
+  int i, best = cpuid();
+80103eb3:	e8 4b fe ff ff       	call   80103d03 <cpuid>
+80103eb8:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < ncpu; i++)
+80103eba:	b8 00 00 00 00       	mov    $0x0,%eax
+80103ebf:	eb 03                	jmp    80103ec4 <select_cpu+0x18>
+80103ec1:	83 c0 01             	add    $0x1,%eax
+80103ec4:	39 05 e4 37 11 80    	cmp    %eax,0x801137e4
+80103eca:	7e 26                	jle    80103ef2 <select_cpu+0x46>
+    if(cpus[i].runqueue->size < cpus[best].runqueue->size)
+80103ecc:	69 d0 d8 00 00 00    	imul   $0xd8,%eax,%edx
+80103ed2:	8b 92 b0 38 11 80    	mov    -0x7feec750(%edx),%edx
+80103ed8:	8b 4a 34             	mov    0x34(%edx),%ecx
+80103edb:	69 d3 d8 00 00 00    	imul   $0xd8,%ebx,%edx
+80103ee1:	8b 92 b0 38 11 80    	mov    -0x7feec750(%edx),%edx
+80103ee7:	8b 52 34             	mov    0x34(%edx),%edx
+80103eea:	39 d1                	cmp    %edx,%ecx
+80103eec:	7d d3                	jge    80103ec1 <select_cpu+0x15>
+      best = i;
+80103eee:	89 c3                	mov    %eax,%ebx
+80103ef0:	eb cf                	jmp    80103ec1 <select_cpu+0x15>
+}
+80103ef2:	89 d8                	mov    %ebx,%eax
+80103ef4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103ef7:	c9                   	leave
+80103ef8:	c3                   	ret
+
+80103ef9 <preempt_for>:
+  if(policy->preempt == 0 || (c = policy->preempt(p)) == NULL)
+80103ef9:	8b 15 10 c0 10 80    	mov    0x8010c010,%edx
+80103eff:	8b 52 18             	mov    0x18(%edx),%edx
+80103f02:	85 d2                	test   %edx,%edx
+80103f04:	74 3f                	je     80103f45 <preempt_for+0x4c>
+{
+80103f06:	55                   	push   %ebp
+80103f07:	89 e5                	mov    %esp,%ebp
+80103f09:	53                   	push   %ebx
+80103f0a:	83 ec 10             	sub    $0x10,%esp
+  if(policy->preempt == 0 || (c = policy->preempt(p)) == NULL)
+80103f0d:	50                   	push   %eax
+80103f0e:	ff d2                	call   *%edx
+80103f10:	89 c3                	mov    %eax,%ebx
+80103f12:	83 c4 10             	add    $0x10,%esp
+80103f15:	85 c0                	test   %eax,%eax
+80103f17:	74 27                	je     80103f40 <preempt_for+0x47>
+  c->resched = 1;
+80103f19:	c7 80 b8 00 00 00 01 	movl   $0x1,0xb8(%eax)
+80103f20:	00 00 00 
+  if(c != mycpu())
+80103f23:	e8 db fc ff ff       	call   80103c03 <mycpu>
+80103f28:	39 c3                	cmp    %eax,%ebx
+80103f2a:	74 14                	je     80103f40 <preempt_for+0x47>
+    lapicsendipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+80103f2c:	0f b6 03             	movzbl (%ebx),%eax
+80103f2f:	83 ec 08             	sub    $0x8,%esp
+80103f32:	6a 3e                	push   $0x3e
+80103f34:	0f b6 c0             	movzbl %al,%eax
+80103f37:	50                   	push   %eax
+80103f38:	e8 9e e4 ff ff       	call   801023db <lapicsendipi>
+80103f3d:	83 c4 10             	add    $0x10,%esp
+}
+80103f40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103f43:	c9                   	leave
+80103f44:	c3                   	ret
+80103f45:	c3                   	ret
+
+80103f46 <wakeup_process>:
+// Make sleeping process p runnable, preempting a running
+// process for it if the policy says so.
+// The ptable lock must be held.
+static void
+wakeup_process(struct proc *p)
+{
+80103f46:	55                   	push   %ebp
+80103f47:	89 e5                	mov    %esp,%ebp
+80103f49:	53                   	push   %ebx
+80103f4a:	83 ec 04             	sub    $0x4,%esp
+80103f4d:	89 c3                	mov    %eax,%ebx
+  *p->waitprev = p->waitnext;
+80103f4f:	8b 50 28             	mov    0x28(%eax),%edx
+80103f52:	8b 40 24             	mov    0x24(%eax),%eax
+80103f55:	89 02                	mov    %eax,(%edx)
+  if(p->waitnext)
+80103f57:	85 c0                	test   %eax,%eax
+80103f59:	74 06                	je     80103f61 <wakeup_process+0x1b>
+    p->waitnext->waitprev = p->waitprev;
+80103f5b:	8b 53 28             	mov    0x28(%ebx),%edx
+80103f5e:	89 50 28             	mov    %edx,0x28(%eax)
+  p->waitnext = 0;
+80103f61:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+  p->waitprev = 0;
+80103f68:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+  p->state = RUNNABLE;
+80103f6f:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+80103f76:	0f 31                	rdtsc
+  p->stamp = rdtsc();
+80103f78:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+80103f7e:	89 93 9c 00 00 00    	mov    %edx,0x9c(%ebx)
+  enqueue_process(p);
+80103f84:	89 d8                	mov    %ebx,%eax
+80103f86:	e8 25 fe ff ff       	call   80103db0 <enqueue_process>
+  schedlog_event(SCHEDLOG_WAKEUP, p);
+80103f8b:	83 ec 08             	sub    $0x8,%esp
+80103f8e:	53                   	push   %ebx
+80103f8f:	6a 02                	push   $0x2
+80103f91:	e8 f0 0d 00 00       	call   80104d86 <schedlog_event>
+  preempt_for(p);
+80103f96:	89 d8                	mov    %ebx,%eax
+80103f98:	e8 5c ff ff ff       	call   80103ef9 <preempt_for>
+}
+80103f9d:	83 c4 10             	add    $0x10,%esp
+80103fa0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103fa3:	c9                   	leave
+80103fa4:	c3                   	ret
+
+80103fa5 <wakeup1>:
+//PAGEBREAK!
+// Wake up all processes sleeping on chan.
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+80103fa5:	55                   	push   %ebp
+80103fa6:	89 e5                	mov    %esp,%ebp
+80103fa8:	56                   	push   %esi
+80103fa9:	53                   	push   %ebx
+80103faa:	89 c6                	mov    %eax,%esi
+  struct proc *p, *next;
+
+  for(p = *waitq(chan); p; p = next){
+80103fac:	e8 98 f5 ff ff       	call   80103549 <waitq>
+80103fb1:	8b 00                	mov    (%eax),%eax
+80103fb3:	eb 02                	jmp    80103fb7 <wakeup1+0x12>
+{
+80103fb5:	89 d8                	mov    %ebx,%eax
+  for(p = *waitq(chan); p; p = next){
+80103fb7:	85 c0                	test   %eax,%eax
+80103fb9:	74 0f                	je     80103fca <wakeup1+0x25>
+    next = p->waitnext;
+80103fbb:	8b 58 24             	mov    0x24(%eax),%ebx
+    if(p->chan == chan)
+80103fbe:	39 70 20             	cmp    %esi,0x20(%eax)
+80103fc1:	75 f2                	jne    80103fb5 <wakeup1+0x10>
+      wakeup_process(p);
+80103fc3:	e8 7e ff ff ff       	call   80103f46 <wakeup_process>
+80103fc8:	eb eb                	jmp    80103fb5 <wakeup1+0x10>
+  }
+}
+80103fca:	5b                   	pop    %ebx
+80103fcb:	5e                   	pop    %esi
+80103fcc:	5d                   	pop    %ebp
+80103fcd:	c3                   	ret
+
+80103fce <myproc>:
+myproc(void) {
+80103fce:	55                   	push   %ebp
+80103fcf:	89 e5                	mov    %esp,%ebp
+80103fd1:	53                   	push   %ebx
+80103fd2:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80103fd5:	e8 f8 15 00 00       	call   801055d2 <pushcli>
+  c = mycpu();
+80103fda:	e8 24 fc ff ff       	call   80103c03 <mycpu>
+  p = c->proc;
+80103fdf:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80103fe5:	e8 2c 16 00 00       	call   80105616 <popcli>
+}
+80103fea:	89 d8                	mov    %ebx,%eax
+80103fec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103fef:	c9                   	leave
+80103ff0:	c3                   	ret
+
+80103ff1 <userinit>:
+{
+80103ff1:	55                   	push   %ebp
+80103ff2:	89 e5                	mov    %esp,%ebp
+80103ff4:	53                   	push   %ebx
+80103ff5:	83 ec 04             	sub    $0x4,%esp
+  p = allocproc();
+80103ff8:	e8 6e f9 ff ff       	call   8010396b <allocproc>
+80103ffd:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80103fff:	a3 48 96 11 80       	mov    %eax,0x80119648
+  if((p->pgdir = setupkvm()) == 0)
+80104004:	e8 f0 42 00 00       	call   801082f9 <setupkvm>
+80104009:	89 43 04             	mov    %eax,0x4(%ebx)
+8010400c:	85 c0                	test   %eax,%eax
+8010400e:	0f 84 f9 00 00 00    	je     8010410d <userinit+0x11c>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80104014:	83 ec 04             	sub    $0x4,%esp
+80104017:	68 2c 00 00 00       	push   $0x2c
+8010401c:	68 c0 c4 10 80       	push   $0x8010c4c0
+80104021:	50                   	push   %eax
+80104022:	e8 7d 3f 00 00       	call   80107fa4 <inituvm>
+  p->sz = PGSIZE;
+80104027:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+8010402d:	8b 43 18             	mov    0x18(%ebx),%eax
+80104030:	83 c4 0c             	add    $0xc,%esp
+80104033:	6a 4c                	push   $0x4c
+80104035:	6a 00                	push   $0x0
+80104037:	50                   	push   %eax
+80104038:	e8 24 17 00 00       	call   80105761 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+8010403d:	8b 43 18             	mov    0x18(%ebx),%eax
+80104040:	66 c7 40 3c 1b 00    	movw   $0x1b,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80104046:	8b 43 18             	mov    0x18(%ebx),%eax
+80104049:	66 c7 40 2c 23 00    	movw   $0x23,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+8010404f:	8b 43 18             	mov    0x18(%ebx),%eax
+80104052:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80104056:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+8010405a:	8b 43 18             	mov    0x18(%ebx),%eax
+8010405d:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80104061:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80104065:	8b 43 18             	mov    0x18(%ebx),%eax
+80104068:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+8010406f:	8b 43 18             	mov    0x18(%ebx),%eax
+80104072:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80104079:	8b 43 18             	mov    0x18(%ebx),%eax
+8010407c:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80104083:	8d 43 74             	lea    0x74(%ebx),%eax
+80104086:	83 c4 0c             	add    $0xc,%esp
+80104089:	6a 10                	push   $0x10
+8010408b:	68 c4 8b 10 80       	push   $0x80108bc4
+80104090:	50                   	push   %eax
+80104091:	e8 37 18 00 00       	call   801058cd <safestrcpy>
+  p->cwd = namei("/");
+80104096:	c7 04 24 cd 8b 10 80 	movl   $0x80108bcd,(%esp)
+8010409d:	e8 05 db ff ff       	call   80101ba7 <namei>
+801040a2:	89 43 70             	mov    %eax,0x70(%ebx)
+  acquire(&ptable.lock);
+801040a5:	c7 04 24 00 46 11 80 	movl   $0x80114600,(%esp)
+801040ac:	e8 04 16 00 00       	call   801056b5 <acquire>
+  p->state = RUNNABLE;
+801040b1:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+801040b8:	0f 31                	rdtsc
+  p->stamp = rdtsc();
+801040ba:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+801040c0:	89 93 9c 00 00 00    	mov    %edx,0x9c(%ebx)
+  p->nice_value = 0;
+801040c6:	c7 83 bc 00 00 00 00 	movl   $0x0,0xbc(%ebx)
+801040cd:	00 00 00 
+  p->sched_class = SCHED_NORMAL;
+801040d0:	c7 83 c0 00 00 00 00 	movl   $0x0,0xc0(%ebx)
+801040d7:	00 00 00 
+  p->cpu = cpuid();
+801040da:	e8 24 fc ff ff       	call   80103d03 <cpuid>
+801040df:	89 83 38 01 00 00    	mov    %eax,0x138(%ebx)
+  policy->fork(p);
+801040e5:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+801040ea:	8b 40 04             	mov    0x4(%eax),%eax
+801040ed:	89 1c 24             	mov    %ebx,(%esp)
+801040f0:	ff d0                	call   *%eax
+  enqueue_process(p);
+801040f2:	89 d8                	mov    %ebx,%eax
+801040f4:	e8 b7 fc ff ff       	call   80103db0 <enqueue_process>
+  release(&ptable.lock);
+801040f9:	c7 04 24 00 46 11 80 	movl   $0x80114600,(%esp)
+80104100:	e8 15 16 00 00       	call   8010571a <release>
+}
+80104105:	83 c4 10             	add    $0x10,%esp
+80104108:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010410b:	c9                   	leave
+8010410c:	c3                   	ret
+    panic("userinit: out of memory?");
+8010410d:	83 ec 0c             	sub    $0xc,%esp
+80104110:	68 ab 8b 10 80       	push   $0x80108bab
+80104115:	e8 54 c2 ff ff       	call   8010036e <panic>
+
+8010411a <growproc>:
+{
+8010411a:	55                   	push   %ebp
+8010411b:	89 e5                	mov    %esp,%ebp
+8010411d:	56                   	push   %esi
+8010411e:	53                   	push   %ebx
+8010411f:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+80104122:	e8 a7 fe ff ff       	call   80103fce <myproc>
+80104127:	89 c3                	mov    %eax,%ebx
+  sz = curproc->sz;
+80104129:	8b 00                	mov    (%eax),%eax
+  if(n > 0){
+8010412b:	85 f6                	test   %esi,%esi
+8010412d:	7f 1c                	jg     8010414b <growproc+0x31>
+  } else if(n < 0){
+8010412f:	78 37                	js     80104168 <growproc+0x4e>
+  curproc->sz = sz;
+80104131:	89 03                	mov    %eax,(%ebx)
+  switchuvm(curproc);
+80104133:	83 ec 0c             	sub    $0xc,%esp
+80104136:	53                   	push   %ebx
+80104137:	e8 f4 3c 00 00       	call   80107e30 <switchuvm>
+  return 0;
+8010413c:	83 c4 10             	add    $0x10,%esp
+8010413f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80104144:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104147:	5b                   	pop    %ebx
+80104148:	5e                   	pop    %esi
+80104149:	5d                   	pop    %ebp
+8010414a:	c3                   	ret
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+8010414b:	83 ec 04             	sub    $0x4,%esp
+8010414e:	01 c6                	add    %eax,%esi
+80104150:	56                   	push   %esi
+80104151:	50                   	push   %eax
+80104152:	ff 73 04             	push   0x4(%ebx)
+80104155:	e8 20 40 00 00       	call   8010817a <allocuvm>
+8010415a:	83 c4 10             	add    $0x10,%esp
+8010415d:	85 c0                	test   %eax,%eax
+8010415f:	75 d0                	jne    80104131 <growproc+0x17>
+      return -1;
+80104161:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104166:	eb dc                	jmp    80104144 <growproc+0x2a>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80104168:	83 ec 04             	sub    $0x4,%esp
+8010416b:	01 c6                	add    %eax,%esi
+8010416d:	56                   	push   %esi
+8010416e:	50                   	push   %eax
+8010416f:	ff 73 04             	push   0x4(%ebx)
+80104172:	e8 5d 3f 00 00       	call   801080d4 <deallocuvm>
+80104177:	83 c4 10             	add    $0x10,%esp
+8010417a:	85 c0                	test   %eax,%eax
+8010417c:	75 b3                	jne    80104131 <growproc+0x17>
+      return -1;
+8010417e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104183:	eb bf                	jmp    80104144 <growproc+0x2a>
+
+80104185 <nicefork>:
+{
+80104185:	55                   	push   %ebp
+80104186:	89 e5                	mov    %esp,%ebp
+80104188:	57                   	push   %edi
+80104189:	56                   	push   %esi
+8010418a:	53                   	push   %ebx
+8010418b:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+8010418e:	e8 3b fe ff ff       	call   80103fce <myproc>
+80104193:	89 c7                	mov    %eax,%edi
+80104195:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if((np = allocproc()) == 0){
+80104198:	e8 ce f7 ff ff       	call   8010396b <allocproc>
+8010419d:	85 c0                	test   %eax,%eax
+8010419f:	0f 84 32 01 00 00    	je     801042d7 <nicefork+0x152>
+801041a5:	89 c3                	mov    %eax,%ebx
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+801041a7:	83 ec 08             	sub    $0x8,%esp
+801041aa:	ff 37                	push   (%edi)
+801041ac:	ff 77 04             	push   0x4(%edi)
+801041af:	e8 fa 41 00 00       	call   801083ae <copyuvm>
+801041b4:	89 43 04             	mov    %eax,0x4(%ebx)
+801041b7:	83 c4 10             	add    $0x10,%esp
+801041ba:	85 c0                	test   %eax,%eax
+801041bc:	74 28                	je     801041e6 <nicefork+0x61>
+  np->sz = curproc->sz;
+801041be:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801041c1:	8b 02                	mov    (%edx),%eax
+801041c3:	89 03                	mov    %eax,(%ebx)
+  np->parent = curproc;
+801041c5:	89 53 14             	mov    %edx,0x14(%ebx)
+  *np->tf = *curproc->tf;
+801041c8:	8b 72 18             	mov    0x18(%edx),%esi
+801041cb:	b9 13 00 00 00       	mov    $0x13,%ecx
+801041d0:	8b 7b 18             	mov    0x18(%ebx),%edi
+801041d3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  np->tf->eax = 0;
+801041d5:	8b 43 18             	mov    0x18(%ebx),%eax
+801041d8:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < NOFILE; i++)
+801041df:	be 00 00 00 00       	mov    $0x0,%esi
+801041e4:	eb 29                	jmp    8010420f <nicefork+0x8a>
+    kfree(np->kstack);
+801041e6:	83 ec 0c             	sub    $0xc,%esp
+801041e9:	ff 73 08             	push   0x8(%ebx)
+801041ec:	e8 7a dd ff ff       	call   80101f6b <kfree>
+    np->kstack = 0;
+801041f1:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    np->state = UNUSED;
+801041f8:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    return -1;
+801041ff:	83 c4 10             	add    $0x10,%esp
+80104202:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80104207:	e9 c1 00 00 00       	jmp    801042cd <nicefork+0x148>
+  for(i = 0; i < NOFILE; i++)
+8010420c:	83 c6 01             	add    $0x1,%esi
+8010420f:	83 fe 0f             	cmp    $0xf,%esi
+80104212:	7f 1d                	jg     80104231 <nicefork+0xac>
+    if(curproc->ofile[i])
+80104214:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104217:	8b 44 b0 30          	mov    0x30(%eax,%esi,4),%eax
+8010421b:	85 c0                	test   %eax,%eax
+8010421d:	74 ed                	je     8010420c <nicefork+0x87>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+8010421f:	83 ec 0c             	sub    $0xc,%esp
+80104222:	50                   	push   %eax
+80104223:	e8 3b ca ff ff       	call   80100c63 <filedup>
+80104228:	89 44 b3 30          	mov    %eax,0x30(%ebx,%esi,4)
+8010422c:	83 c4 10             	add    $0x10,%esp
+8010422f:	eb db                	jmp    8010420c <nicefork+0x87>
+  np->cwd = idup(curproc->cwd);
+80104231:	83 ec 0c             	sub    $0xc,%esp
+80104234:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80104237:	ff 77 70             	push   0x70(%edi)
+8010423a:	e8 dc d2 ff ff       	call   8010151b <idup>
+8010423f:	89 43 70             	mov    %eax,0x70(%ebx)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80104242:	8d 57 74             	lea    0x74(%edi),%edx
+80104245:	8d 43 74             	lea    0x74(%ebx),%eax
+80104248:	83 c4 0c             	add    $0xc,%esp
+8010424b:	6a 10                	push   $0x10
+8010424d:	52                   	push   %edx
+8010424e:	50                   	push   %eax
+8010424f:	e8 79 16 00 00       	call   801058cd <safestrcpy>
+  pid = np->pid;
+80104254:	8b 73 10             	mov    0x10(%ebx),%esi
+  acquire(&ptable.lock);
+80104257:	c7 04 24 00 46 11 80 	movl   $0x80114600,(%esp)
+8010425e:	e8 52 14 00 00       	call   801056b5 <acquire>
+  np->state = RUNNABLE;
+80104263:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+8010426a:	0f 31                	rdtsc
+  np->stamp = rdtsc();
+8010426c:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+80104272:	89 93 9c 00 00 00    	mov    %edx,0x9c(%ebx)
+  np->nice_value = nice_value;
+80104278:	8b 45 08             	mov    0x8(%ebp),%eax
+8010427b:	89 83 bc 00 00 00    	mov    %eax,0xbc(%ebx)
+  np->sched_class = curproc->sched_class;
+80104281:	8b 87 c0 00 00 00    	mov    0xc0(%edi),%eax
+80104287:	89 83 c0 00 00 00    	mov    %eax,0xc0(%ebx)
+  np->cpu = select_cpu();
+8010428d:	e8 1a fc ff ff       	call   80103eac <select_cpu>
+80104292:	89 83 38 01 00 00    	mov    %eax,0x138(%ebx)
+  policy->fork(np);
+80104298:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+8010429d:	8b 40 04             	mov    0x4(%eax),%eax
+801042a0:	89 1c 24             	mov    %ebx,(%esp)
+801042a3:	ff d0                	call   *%eax
+  enqueue_process(np);
+801042a5:	89 d8                	mov    %ebx,%eax
+801042a7:	e8 04 fb ff ff       	call   80103db0 <enqueue_process>
+  schedlog_event(SCHEDLOG_FORK, np);
+801042ac:	83 c4 08             	add    $0x8,%esp
+801042af:	53                   	push   %ebx
+801042b0:	6a 01                	push   $0x1
+801042b2:	e8 cf 0a 00 00       	call   80104d86 <schedlog_event>
+  preempt_for(np);
+801042b7:	89 d8                	mov    %ebx,%eax
+801042b9:	e8 3b fc ff ff       	call   80103ef9 <preempt_for>
+  release(&ptable.lock);
+801042be:	c7 04 24 00 46 11 80 	movl   $0x80114600,(%esp)
+801042c5:	e8 50 14 00 00       	call   8010571a <release>
+  return pid;
+801042ca:	83 c4 10             	add    $0x10,%esp
+}
+801042cd:	89 f0                	mov    %esi,%eax
+801042cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801042d2:	5b                   	pop    %ebx
+801042d3:	5e                   	pop    %esi
+801042d4:	5f                   	pop    %edi
+801042d5:	5d                   	pop    %ebp
+801042d6:	c3                   	ret
+    return -1;
+801042d7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801042dc:	eb ef                	jmp    801042cd <nicefork+0x148>
+
+801042de <fork>:
+int fork(void) {
+801042de:	55                   	push   %ebp
+801042df:	89 e5                	mov    %esp,%ebp
+801042e1:	83 ec 14             	sub    $0x14,%esp
+  return nicefork(0);
+801042e4:	6a 00                	push   $0x0
+801042e6:	e8 9a fe ff ff       	call   80104185 <nicefork>
+}
+801042eb:	c9                   	leave
+801042ec:	c3                   	ret
+
+801042ed <scheduler>:
+{
+801042ed:	55                   	push   %ebp
+801042ee:	89 e5                	mov    %esp,%ebp
+801042f0:	57                   	push   %edi
+801042f1:	56                   	push   %esi
+801042f2:	53                   	push   %ebx
+801042f3:	83 ec 1c             	sub    $0x1c,%esp
+  struct cpu *c = mycpu();
+801042f6:	e8 08 f9 ff ff       	call   80103c03 <mycpu>
+  c->proc = 0;
+801042fb:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+80104302:	00 00 00 
+80104305:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104308:	e9 e6 00 00 00       	jmp    801043f3 <scheduler+0x106>
+      idle(c);
+8010430d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104310:	e8 e7 ed ff ff       	call   801030fc <idle>
+      continue;
+80104315:	e9 d9 00 00 00       	jmp    801043f3 <scheduler+0x106>
+      panic("scheduler: queued proc not runnable");
+8010431a:	83 ec 0c             	sub    $0xc,%esp
+8010431d:	68 a8 8c 10 80       	push   $0x80108ca8
+80104322:	e8 47 c0 ff ff       	call   8010036e <panic>
+    wait = now > p->stamp ? now - p->stamp : 0;
+80104327:	b8 00 00 00 00       	mov    $0x0,%eax
+8010432c:	ba 00 00 00 00       	mov    $0x0,%edx
+    p->wait_time += wait;
+80104331:	89 c6                	mov    %eax,%esi
+80104333:	01 83 a0 00 00 00    	add    %eax,0xa0(%ebx)
+80104339:	11 93 a4 00 00 00    	adc    %edx,0xa4(%ebx)
+    if(wait > p->max_wait)
+8010433f:	8b 83 ac 00 00 00    	mov    0xac(%ebx),%eax
+80104345:	39 b3 a8 00 00 00    	cmp    %esi,0xa8(%ebx)
+8010434b:	19 d0                	sbb    %edx,%eax
+8010434d:	73 0c                	jae    8010435b <scheduler+0x6e>
+      p->max_wait = wait;
+8010434f:	89 b3 a8 00 00 00    	mov    %esi,0xa8(%ebx)
+80104355:	89 93 ac 00 00 00    	mov    %edx,0xac(%ebx)
+    p->dispatches++;
+8010435b:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+80104361:	83 c0 01             	add    $0x1,%eax
+80104364:	89 83 b0 00 00 00    	mov    %eax,0xb0(%ebx)
+    p->stamp = now;
+8010436a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010436d:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80104370:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+80104376:	89 93 9c 00 00 00    	mov    %edx,0x9c(%ebx)
+    schedlog_event(SCHEDLOG_RUN, p);
+8010437c:	83 ec 08             	sub    $0x8,%esp
+8010437f:	53                   	push   %ebx
+80104380:	6a 03                	push   $0x3
+80104382:	e8 ff 09 00 00       	call   80104d86 <schedlog_event>
+    swtch(&(c->scheduler), p->context);
+80104387:	83 c4 08             	add    $0x8,%esp
+8010438a:	ff 73 1c             	push   0x1c(%ebx)
+8010438d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104390:	83 c0 04             	add    $0x4,%eax
+80104393:	50                   	push   %eax
+80104394:	e8 89 15 00 00       	call   80105922 <swtch>
+    switchkvm();
+80104399:	e8 6d 3a 00 00       	call   80107e0b <switchkvm>
+    policy->tick(p, charge(p));
+8010439e:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+801043a3:	8b 70 14             	mov    0x14(%eax),%esi
+801043a6:	89 d8                	mov    %ebx,%eax
+801043a8:	e8 b2 f8 ff ff       	call   80103c5f <charge>
+801043ad:	83 c4 0c             	add    $0xc,%esp
+801043b0:	52                   	push   %edx
+801043b1:	50                   	push   %eax
+801043b2:	53                   	push   %ebx
+801043b3:	ff d6                	call   *%esi
+    if (p->state == RUNNABLE) {
+801043b5:	8b 43 0c             	mov    0xc(%ebx),%eax
+801043b8:	83 c4 10             	add    $0x10,%esp
+801043bb:	83 f8 03             	cmp    $0x3,%eax
+801043be:	0f 84 ff 00 00 00    	je     801044c3 <scheduler+0x1d6>
+    } else if (p->state == SLEEPING) {
+801043c4:	83 f8 02             	cmp    $0x2,%eax
+801043c7:	0f 84 1f 01 00 00    	je     801044ec <scheduler+0x1ff>
+    } else if (p->state == ZOMBIE) {
+801043cd:	83 f8 05             	cmp    $0x5,%eax
+801043d0:	0f 84 38 01 00 00    	je     8010450e <scheduler+0x221>
+    c->proc = 0;
+801043d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801043d9:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+801043e0:	00 00 00 
+    release(&ptable.lock);
+801043e3:	83 ec 0c             	sub    $0xc,%esp
+801043e6:	68 00 46 11 80       	push   $0x80114600
+801043eb:	e8 2a 13 00 00       	call   8010571a <release>
+801043f0:	83 c4 10             	add    $0x10,%esp
+  asm volatile("sti");
+801043f3:	fb                   	sti
+    p = policy->pick_next(c);
+801043f4:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+801043f9:	8b 40 10             	mov    0x10(%eax),%eax
+801043fc:	83 ec 0c             	sub    $0xc,%esp
+801043ff:	ff 75 e4             	push   -0x1c(%ebp)
+80104402:	ff d0                	call   *%eax
+80104404:	89 c3                	mov    %eax,%ebx
+    if(p == NULL){
+80104406:	83 c4 10             	add    $0x10,%esp
+80104409:	85 c0                	test   %eax,%eax
+8010440b:	0f 84 fc fe ff ff    	je     8010430d <scheduler+0x20>
+    acquire(&ptable.lock);
+80104411:	83 ec 0c             	sub    $0xc,%esp
+80104414:	68 00 46 11 80       	push   $0x80114600
+80104419:	e8 97 12 00 00       	call   801056b5 <acquire>
+    if(p->state != RUNNABLE)
+8010441e:	83 c4 10             	add    $0x10,%esp
+80104421:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+80104425:	0f 85 ef fe ff ff    	jne    8010431a <scheduler+0x2d>
+    c->proc = p;
+8010442b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010442e:	89 9e ac 00 00 00    	mov    %ebx,0xac(%esi)
+    switchuvm(p);
+80104434:	83 ec 0c             	sub    $0xc,%esp
+80104437:	53                   	push   %ebx
+80104438:	e8 f3 39 00 00       	call   80107e30 <switchuvm>
+    p->state = RUNNING;
+8010443d:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+    if(p->cpu != c - cpus)
+80104444:	89 f0                	mov    %esi,%eax
+80104446:	2d 00 38 11 80       	sub    $0x80113800,%eax
+8010444b:	c1 f8 03             	sar    $0x3,%eax
+8010444e:	69 c0 13 da 4b 68    	imul   $0x684bda13,%eax,%eax
+80104454:	83 c4 10             	add    $0x10,%esp
+80104457:	39 83 38 01 00 00    	cmp    %eax,0x138(%ebx)
+8010445d:	74 0f                	je     8010446e <scheduler+0x181>
+      c->migrations++;
+8010445f:	8b 8e cc 00 00 00    	mov    0xcc(%esi),%ecx
+80104465:	8d 51 01             	lea    0x1(%ecx),%edx
+80104468:	89 96 cc 00 00 00    	mov    %edx,0xcc(%esi)
+    p->cpu = c - cpus;
+8010446e:	89 83 38 01 00 00    	mov    %eax,0x138(%ebx)
+    c->dispatches++;
+80104474:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80104477:	8b 81 c8 00 00 00    	mov    0xc8(%ecx),%eax
+8010447d:	83 c0 01             	add    $0x1,%eax
+80104480:	89 81 c8 00 00 00    	mov    %eax,0xc8(%ecx)
+    c->resched = 0;
+80104486:	c7 81 b8 00 00 00 00 	movl   $0x0,0xb8(%ecx)
+8010448d:	00 00 00 
+  asm volatile("rdtsc" : "=A" (tsc));
+80104490:	0f 31                	rdtsc
+80104492:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80104495:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    wait = now > p->stamp ? now - p->stamp : 0;
+80104498:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+8010449e:	8b 93 9c 00 00 00    	mov    0x9c(%ebx),%edx
+801044a4:	8b 75 d8             	mov    -0x28(%ebp),%esi
+801044a7:	8b 7d dc             	mov    -0x24(%ebp),%edi
+801044aa:	39 f0                	cmp    %esi,%eax
+801044ac:	89 d1                	mov    %edx,%ecx
+801044ae:	19 f9                	sbb    %edi,%ecx
+801044b0:	0f 83 71 fe ff ff    	jae    80104327 <scheduler+0x3a>
+801044b6:	29 c6                	sub    %eax,%esi
+801044b8:	19 d7                	sbb    %edx,%edi
+801044ba:	89 f0                	mov    %esi,%eax
+801044bc:	89 fa                	mov    %edi,%edx
+801044be:	e9 6e fe ff ff       	jmp    80104331 <scheduler+0x44>
+      p->nivcsw++;
+801044c3:	8b 83 b8 00 00 00    	mov    0xb8(%ebx),%eax
+801044c9:	83 c0 01             	add    $0x1,%eax
+801044cc:	89 83 b8 00 00 00    	mov    %eax,0xb8(%ebx)
+      enqueue_process(p);
+801044d2:	89 d8                	mov    %ebx,%eax
+801044d4:	e8 d7 f8 ff ff       	call   80103db0 <enqueue_process>
+      schedlog_event(SCHEDLOG_PREEMPT, p);
+801044d9:	83 ec 08             	sub    $0x8,%esp
+801044dc:	53                   	push   %ebx
+801044dd:	6a 04                	push   $0x4
+801044df:	e8 a2 08 00 00       	call   80104d86 <schedlog_event>
+801044e4:	83 c4 10             	add    $0x10,%esp
+801044e7:	e9 ea fe ff ff       	jmp    801043d6 <scheduler+0xe9>
+      p->nvcsw++;
+801044ec:	8b 83 b4 00 00 00    	mov    0xb4(%ebx),%eax
+801044f2:	83 c0 01             	add    $0x1,%eax
+801044f5:	89 83 b4 00 00 00    	mov    %eax,0xb4(%ebx)
+      schedlog_event(SCHEDLOG_SLEEP, p);
+801044fb:	83 ec 08             	sub    $0x8,%esp
+801044fe:	53                   	push   %ebx
+801044ff:	6a 05                	push   $0x5
+80104501:	e8 80 08 00 00       	call   80104d86 <schedlog_event>
+80104506:	83 c4 10             	add    $0x10,%esp
+80104509:	e9 c8 fe ff ff       	jmp    801043d6 <scheduler+0xe9>
+      schedlog_event(SCHEDLOG_EXIT, p);
+8010450e:	83 ec 08             	sub    $0x8,%esp
+80104511:	53                   	push   %ebx
+80104512:	6a 06                	push   $0x6
+80104514:	e8 6d 08 00 00       	call   80104d86 <schedlog_event>
+80104519:	83 c4 10             	add    $0x10,%esp
+8010451c:	e9 b5 fe ff ff       	jmp    801043d6 <scheduler+0xe9>
+
+80104521 <sched>:
+{
+80104521:	55                   	push   %ebp
+80104522:	89 e5                	mov    %esp,%ebp
+80104524:	56                   	push   %esi
+80104525:	53                   	push   %ebx
+  struct proc *p = myproc();
+80104526:	e8 a3 fa ff ff       	call   80103fce <myproc>
+8010452b:	89 c3                	mov    %eax,%ebx
+  if(!holding(&ptable.lock))
+8010452d:	83 ec 0c             	sub    $0xc,%esp
+80104530:	68 00 46 11 80       	push   $0x80114600
+80104535:	e8 3c 11 00 00       	call   80105676 <holding>
+8010453a:	83 c4 10             	add    $0x10,%esp
+8010453d:	85 c0                	test   %eax,%eax
+8010453f:	74 4f                	je     80104590 <sched+0x6f>
+  if(mycpu()->ncli != 1)
+80104541:	e8 bd f6 ff ff       	call   80103c03 <mycpu>
+80104546:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+8010454d:	75 4e                	jne    8010459d <sched+0x7c>
+  if(p->state == RUNNING)
+8010454f:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+80104553:	74 55                	je     801045aa <sched+0x89>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80104555:	9c                   	pushf
+80104556:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80104557:	f6 c4 02             	test   $0x2,%ah
+8010455a:	75 5b                	jne    801045b7 <sched+0x96>
+  intena = mycpu()->intena;
+8010455c:	e8 a2 f6 ff ff       	call   80103c03 <mycpu>
+80104561:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+80104567:	e8 97 f6 ff ff       	call   80103c03 <mycpu>
+8010456c:	83 ec 08             	sub    $0x8,%esp
+8010456f:	ff 70 04             	push   0x4(%eax)
+80104572:	83 c3 1c             	add    $0x1c,%ebx
+80104575:	53                   	push   %ebx
+80104576:	e8 a7 13 00 00       	call   80105922 <swtch>
+  mycpu()->intena = intena;
+8010457b:	e8 83 f6 ff ff       	call   80103c03 <mycpu>
+80104580:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80104586:	83 c4 10             	add    $0x10,%esp
+80104589:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010458c:	5b                   	pop    %ebx
+8010458d:	5e                   	pop    %esi
+8010458e:	5d                   	pop    %ebp
+8010458f:	c3                   	ret
+    panic("sched ptable.lock");
+80104590:	83 ec 0c             	sub    $0xc,%esp
+80104593:	68 cf 8b 10 80       	push   $0x80108bcf
+80104598:	e8 d1 bd ff ff       	call   8010036e <panic>
+    panic("sched locks");
+8010459d:	83 ec 0c             	sub    $0xc,%esp
+801045a0:	68 e1 8b 10 80       	push   $0x80108be1
+801045a5:	e8 c4 bd ff ff       	call   8010036e <panic>
+    panic("sched running");
+801045aa:	83 ec 0c             	sub    $0xc,%esp
+801045ad:	68 ed 8b 10 80       	push   $0x80108bed
+801045b2:	e8 b7 bd ff ff       	call   8010036e <panic>
+    panic("sched interruptible");
+801045b7:	83 ec 0c             	sub    $0xc,%esp
+801045ba:	68 fb 8b 10 80       	push   $0x80108bfb
+801045bf:	e8 aa bd ff ff       	call   8010036e <panic>
+
+801045c4 <exit>:
+{
+801045c4:	55                   	push   %ebp
+801045c5:	89 e5                	mov    %esp,%ebp
+801045c7:	56                   	push   %esi
+801045c8:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+801045c9:	e8 00 fa ff ff       	call   80103fce <myproc>
+  if(curproc == initproc)
+801045ce:	39 05 48 96 11 80    	cmp    %eax,0x80119648
+801045d4:	74 09                	je     801045df <exit+0x1b>
+801045d6:	89 c6                	mov    %eax,%esi
+  for(fd = 0; fd < NOFILE; fd++){
+801045d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+801045dd:	eb 24                	jmp    80104603 <exit+0x3f>
+    panic("init exiting");
+801045df:	83 ec 0c             	sub    $0xc,%esp
+801045e2:	68 0f 8c 10 80       	push   $0x80108c0f
+801045e7:	e8 82 bd ff ff       	call   8010036e <panic>
+      fileclose(curproc->ofile[fd]);
+801045ec:	83 ec 0c             	sub    $0xc,%esp
+801045ef:	50                   	push   %eax
+801045f0:	e8 b3 c6 ff ff       	call   80100ca8 <fileclose>
+      curproc->ofile[fd] = 0;
+801045f5:	c7 44 9e 30 00 00 00 	movl   $0x0,0x30(%esi,%ebx,4)
+801045fc:	00 
+801045fd:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80104600:	83 c3 01             	add    $0x1,%ebx
+80104603:	83 fb 0f             	cmp    $0xf,%ebx
+80104606:	7f 0a                	jg     80104612 <exit+0x4e>
+    if(curproc->ofile[fd]){
+80104608:	8b 44 9e 30          	mov    0x30(%esi,%ebx,4),%eax
+8010460c:	85 c0                	test   %eax,%eax
+8010460e:	75 dc                	jne    801045ec <exit+0x28>
+80104610:	eb ee                	jmp    80104600 <exit+0x3c>
+  begin_op();
+80104612:	e8 e4 e1 ff ff       	call   801027fb <begin_op>
+  iput(curproc->cwd);
+80104617:	83 ec 0c             	sub    $0xc,%esp
+8010461a:	ff 76 70             	push   0x70(%esi)
+8010461d:	e8 30 d0 ff ff       	call   80101652 <iput>
+  end_op();
+80104622:	e8 4e e2 ff ff       	call   80102875 <end_op>
+  curproc->cwd = 0;
+80104627:	c7 46 70 00 00 00 00 	movl   $0x0,0x70(%esi)
+  acquire(&ptable.lock);
+8010462e:	c7 04 24 00 46 11 80 	movl   $0x80114600,(%esp)
+80104635:	e8 7b 10 00 00       	call   801056b5 <acquire>
+  wakeup1(curproc->parent);
+8010463a:	8b 46 14             	mov    0x14(%esi),%eax
+8010463d:	e8 63 f9 ff ff       	call   80103fa5 <wakeup1>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104642:	83 c4 10             	add    $0x10,%esp
+80104645:	bb 34 46 11 80       	mov    $0x80114634,%ebx
+8010464a:	eb 06                	jmp    80104652 <exit+0x8e>
+8010464c:	81 c3 3c 01 00 00    	add    $0x13c,%ebx
+80104652:	81 fb 34 95 11 80    	cmp    $0x80119534,%ebx
+80104658:	73 1a                	jae    80104674 <exit+0xb0>
+    if(p->parent == curproc){
+8010465a:	39 73 14             	cmp    %esi,0x14(%ebx)
+8010465d:	75 ed                	jne    8010464c <exit+0x88>
+      p->parent = initproc;
+8010465f:	a1 48 96 11 80       	mov    0x80119648,%eax
+80104664:	89 43 14             	mov    %eax,0x14(%ebx)
+      if(p->state == ZOMBIE)
+80104667:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+8010466b:	75 df                	jne    8010464c <exit+0x88>
+        wakeup1(initproc);
+8010466d:	e8 33 f9 ff ff       	call   80103fa5 <wakeup1>
+80104672:	eb d8                	jmp    8010464c <exit+0x88>
+  curproc->state = ZOMBIE;
+80104674:	c7 46 0c 05 00 00 00 	movl   $0x5,0xc(%esi)
+  sched();
+8010467b:	e8 a1 fe ff ff       	call   80104521 <sched>
+  panic("zombie exit");
+80104680:	83 ec 0c             	sub    $0xc,%esp
+80104683:	68 1c 8c 10 80       	push   $0x80108c1c
+80104688:	e8 e1 bc ff ff       	call   8010036e <panic>
+
+8010468d <yield>:
+{
+8010468d:	55                   	push   %ebp
+8010468e:	89 e5                	mov    %esp,%ebp
+80104690:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+80104693:	68 00 46 11 80       	push   $0x80114600
+80104698:	e8 18 10 00 00       	call   801056b5 <acquire>
+  myproc()->state = RUNNABLE;
+8010469d:	e8 2c f9 ff ff       	call   80103fce <myproc>
+801046a2:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  sched();
+801046a9:	e8 73 fe ff ff       	call   80104521 <sched>
+  release(&ptable.lock);
+801046ae:	c7 04 24 00 46 11 80 	movl   $0x80114600,(%esp)
+801046b5:	e8 60 10 00 00       	call   8010571a <release>
+}
+801046ba:	83 c4 10             	add    $0x10,%esp
+801046bd:	c9                   	leave
+801046be:	c3                   	ret
+
+801046bf <checkresched>:
+{
+801046bf:	55                   	push   %ebp
+801046c0:	89 e5                	mov    %esp,%ebp
+801046c2:	53                   	push   %ebx
+801046c3:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+801046c6:	e8 07 0f 00 00       	call   801055d2 <pushcli>
+  c = mycpu();
+801046cb:	e8 33 f5 ff ff       	call   80103c03 <mycpu>
+  resched = c->resched;
+801046d0:	8b 98 b8 00 00 00    	mov    0xb8(%eax),%ebx
+  c->resched = 0;
+801046d6:	c7 80 b8 00 00 00 00 	movl   $0x0,0xb8(%eax)
+801046dd:	00 00 00 
+  popcli();
+801046e0:	e8 31 0f 00 00       	call   80105616 <popcli>
+  if(resched && myproc() && myproc()->state == RUNNING)
+801046e5:	85 db                	test   %ebx,%ebx
+801046e7:	75 05                	jne    801046ee <checkresched+0x2f>
+}
+801046e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801046ec:	c9                   	leave
+801046ed:	c3                   	ret
+  if(resched && myproc() && myproc()->state == RUNNING)
+801046ee:	e8 db f8 ff ff       	call   80103fce <myproc>
+801046f3:	85 c0                	test   %eax,%eax
+801046f5:	74 f2                	je     801046e9 <checkresched+0x2a>
+801046f7:	e8 d2 f8 ff ff       	call   80103fce <myproc>
+801046fc:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80104700:	75 e7                	jne    801046e9 <checkresched+0x2a>
+    yield();
+80104702:	e8 86 ff ff ff       	call   8010468d <yield>
+}
+80104707:	eb e0                	jmp    801046e9 <checkresched+0x2a>
+
+80104709 <sleep>:
+{
+80104709:	55                   	push   %ebp
+8010470a:	89 e5                	mov    %esp,%ebp
+8010470c:	57                   	push   %edi
+8010470d:	56                   	push   %esi
+8010470e:	53                   	push   %ebx
+8010470f:	83 ec 0c             	sub    $0xc,%esp
+80104712:	8b 7d 08             	mov    0x8(%ebp),%edi
+80104715:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p = myproc();
+80104718:	e8 b1 f8 ff ff       	call   80103fce <myproc>
+  if(p == 0)
+8010471d:	85 c0                	test   %eax,%eax
+8010471f:	0f 84 86 00 00 00    	je     801047ab <sleep+0xa2>
+80104725:	89 c3                	mov    %eax,%ebx
+  if(lk == 0)
+80104727:	85 f6                	test   %esi,%esi
+80104729:	0f 84 89 00 00 00    	je     801047b8 <sleep+0xaf>
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+8010472f:	81 fe 00 46 11 80    	cmp    $0x80114600,%esi
+80104735:	74 18                	je     8010474f <sleep+0x46>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+80104737:	83 ec 0c             	sub    $0xc,%esp
+8010473a:	68 00 46 11 80       	push   $0x80114600
+8010473f:	e8 71 0f 00 00       	call   801056b5 <acquire>
+    release(lk);
+80104744:	89 34 24             	mov    %esi,(%esp)
+80104747:	e8 ce 0f 00 00       	call   8010571a <release>
+8010474c:	83 c4 10             	add    $0x10,%esp
+  p->chan = chan;
+8010474f:	89 7b 20             	mov    %edi,0x20(%ebx)
+  p->state = SLEEPING;
+80104752:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  p->waitprev = waitq(chan);
+80104759:	89 f8                	mov    %edi,%eax
+8010475b:	e8 e9 ed ff ff       	call   80103549 <waitq>
+80104760:	89 43 28             	mov    %eax,0x28(%ebx)
+  p->waitnext = *p->waitprev;
+80104763:	8b 00                	mov    (%eax),%eax
+80104765:	89 43 24             	mov    %eax,0x24(%ebx)
+  if(p->waitnext)
+80104768:	85 c0                	test   %eax,%eax
+8010476a:	74 06                	je     80104772 <sleep+0x69>
+    p->waitnext->waitprev = &p->waitnext;
+8010476c:	8d 53 24             	lea    0x24(%ebx),%edx
+8010476f:	89 50 28             	mov    %edx,0x28(%eax)
+  *p->waitprev = p;
+80104772:	8b 43 28             	mov    0x28(%ebx),%eax
+80104775:	89 18                	mov    %ebx,(%eax)
+  sched();
+80104777:	e8 a5 fd ff ff       	call   80104521 <sched>
+  p->chan = 0;
+8010477c:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+  if(lk != &ptable.lock){  //DOC: sleeplock2
+80104783:	81 fe 00 46 11 80    	cmp    $0x80114600,%esi
+80104789:	74 18                	je     801047a3 <sleep+0x9a>
+    release(&ptable.lock);
+8010478b:	83 ec 0c             	sub    $0xc,%esp
+8010478e:	68 00 46 11 80       	push   $0x80114600
+80104793:	e8 82 0f 00 00       	call   8010571a <release>
+    acquire(lk);
+80104798:	89 34 24             	mov    %esi,(%esp)
+8010479b:	e8 15 0f 00 00       	call   801056b5 <acquire>
+801047a0:	83 c4 10             	add    $0x10,%esp
+}
+801047a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801047a6:	5b                   	pop    %ebx
+801047a7:	5e                   	pop    %esi
+801047a8:	5f                   	pop    %edi
+801047a9:	5d                   	pop    %ebp
+801047aa:	c3                   	ret
+    panic("sleep");
+801047ab:	83 ec 0c             	sub    $0xc,%esp
+801047ae:	68 28 8c 10 80       	push   $0x80108c28
+801047b3:	e8 b6 bb ff ff       	call   8010036e <panic>
+    panic("sleep without lk");
+801047b8:	83 ec 0c             	sub    $0xc,%esp
+801047bb:	68 2e 8c 10 80       	push   $0x80108c2e
+801047c0:	e8 a9 bb ff ff       	call   8010036e <panic>
+
+801047c5 <wait>:
+{
+801047c5:	55                   	push   %ebp
+801047c6:	89 e5                	mov    %esp,%ebp
+801047c8:	56                   	push   %esi
+801047c9:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+801047ca:	e8 ff f7 ff ff       	call   80103fce <myproc>
+801047cf:	89 c6                	mov    %eax,%esi
+  acquire(&ptable.lock);
+801047d1:	83 ec 0c             	sub    $0xc,%esp
+801047d4:	68 00 46 11 80       	push   $0x80114600
+801047d9:	e8 d7 0e 00 00       	call   801056b5 <acquire>
+801047de:	83 c4 10             	add    $0x10,%esp
+    havekids = 0;
+801047e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801047e6:	bb 34 46 11 80       	mov    $0x80114634,%ebx
+801047eb:	eb 5e                	jmp    8010484b <wait+0x86>
+        pid = p->pid;
+801047ed:	8b 73 10             	mov    0x10(%ebx),%esi
+        kfree(p->kstack);
+801047f0:	83 ec 0c             	sub    $0xc,%esp
+801047f3:	ff 73 08             	push   0x8(%ebx)
+801047f6:	e8 70 d7 ff ff       	call   80101f6b <kfree>
+        p->kstack = 0;
+801047fb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+        freevm(p->pgdir);
+80104802:	83 c4 04             	add    $0x4,%esp
+80104805:	ff 73 04             	push   0x4(%ebx)
+80104808:	e8 6a 3a 00 00       	call   80108277 <freevm>
+        p->pid = 0;
+8010480d:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+        p->parent = 0;
+80104814:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+        p->name[0] = 0;
+8010481b:	c6 43 74 00          	movb   $0x0,0x74(%ebx)
+        p->killed = 0;
+8010481f:	c7 43 2c 00 00 00 00 	movl   $0x0,0x2c(%ebx)
+        p->state = UNUSED;
+80104826:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+        release(&ptable.lock);
+8010482d:	c7 04 24 00 46 11 80 	movl   $0x80114600,(%esp)
+80104834:	e8 e1 0e 00 00       	call   8010571a <release>
+        return pid;
+80104839:	83 c4 10             	add    $0x10,%esp
+}
+8010483c:	89 f0                	mov    %esi,%eax
+8010483e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104841:	5b                   	pop    %ebx
+80104842:	5e                   	pop    %esi
+80104843:	5d                   	pop    %ebp
+80104844:	c3                   	ret
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104845:	81 c3 3c 01 00 00    	add    $0x13c,%ebx
+8010484b:	81 fb 34 95 11 80    	cmp    $0x80119534,%ebx
+80104851:	73 12                	jae    80104865 <wait+0xa0>
+      if(p->parent != curproc)
+80104853:	39 73 14             	cmp    %esi,0x14(%ebx)
+80104856:	75 ed                	jne    80104845 <wait+0x80>
+      if(p->state == ZOMBIE){
+80104858:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+8010485c:	74 8f                	je     801047ed <wait+0x28>
+      havekids = 1;
+8010485e:	b8 01 00 00 00       	mov    $0x1,%eax
+80104863:	eb e0                	jmp    80104845 <wait+0x80>
+    if(!havekids || curproc->killed){
+80104865:	85 c0                	test   %eax,%eax
+80104867:	74 1c                	je     80104885 <wait+0xc0>
+80104869:	83 7e 2c 00          	cmpl   $0x0,0x2c(%esi)
+8010486d:	75 16                	jne    80104885 <wait+0xc0>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+8010486f:	83 ec 08             	sub    $0x8,%esp
+80104872:	68 00 46 11 80       	push   $0x80114600
+80104877:	56                   	push   %esi
+80104878:	e8 8c fe ff ff       	call   80104709 <sleep>
+    havekids = 0;
+8010487d:	83 c4 10             	add    $0x10,%esp
+80104880:	e9 5c ff ff ff       	jmp    801047e1 <wait+0x1c>
+      release(&ptable.lock);
+80104885:	83 ec 0c             	sub    $0xc,%esp
+80104888:	68 00 46 11 80       	push   $0x80114600
+8010488d:	e8 88 0e 00 00       	call   8010571a <release>
+      return -1;
+80104892:	83 c4 10             	add    $0x10,%esp
+80104895:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010489a:	eb a0                	jmp    8010483c <wait+0x77>
+
+8010489c <wakeup>:
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+8010489c:	55                   	push   %ebp
+8010489d:	89 e5                	mov    %esp,%ebp
+8010489f:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+801048a2:	68 00 46 11 80       	push   $0x80114600
+801048a7:	e8 09 0e 00 00       	call   801056b5 <acquire>
+  wakeup1(chan);
+801048ac:	8b 45 08             	mov    0x8(%ebp),%eax
+801048af:	e8 f1 f6 ff ff       	call   80103fa5 <wakeup1>
+  release(&ptable.lock);
+801048b4:	c7 04 24 00 46 11 80 	movl   $0x80114600,(%esp)
+801048bb:	e8 5a 0e 00 00       	call   8010571a <release>
+}
+801048c0:	83 c4 10             	add    $0x10,%esp
+801048c3:	c9                   	leave
+801048c4:	c3                   	ret
+
+801048c5 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+801048c5:	55                   	push   %ebp
+801048c6:	89 e5                	mov    %esp,%ebp
+801048c8:	53                   	push   %ebx
+801048c9:	83 ec 10             	sub    $0x10,%esp
+801048cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+801048cf:	68 00 46 11 80       	push   $0x80114600
+801048d4:	e8 dc 0d 00 00       	call   801056b5 <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801048d9:	83 c4 10             	add    $0x10,%esp
+801048dc:	b8 34 46 11 80       	mov    $0x80114634,%eax
+801048e1:	eb 0c                	jmp    801048ef <kill+0x2a>
+    if(p->pid == pid){
+      p->killed = 1;
+      // Wake process from sleep if necessary.
+      if(p->state == SLEEPING)
+        wakeup_process(p);
+801048e3:	e8 5e f6 ff ff       	call   80103f46 <wakeup_process>
+801048e8:	eb 1e                	jmp    80104908 <kill+0x43>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801048ea:	05 3c 01 00 00       	add    $0x13c,%eax
+801048ef:	3d 34 95 11 80       	cmp    $0x80119534,%eax
+801048f4:	73 2c                	jae    80104922 <kill+0x5d>
+    if(p->pid == pid){
+801048f6:	39 58 10             	cmp    %ebx,0x10(%eax)
+801048f9:	75 ef                	jne    801048ea <kill+0x25>
+      p->killed = 1;
+801048fb:	c7 40 2c 01 00 00 00 	movl   $0x1,0x2c(%eax)
+      if(p->state == SLEEPING)
+80104902:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+80104906:	74 db                	je     801048e3 <kill+0x1e>
+      release(&ptable.lock);
+80104908:	83 ec 0c             	sub    $0xc,%esp
+8010490b:	68 00 46 11 80       	push   $0x80114600
+80104910:	e8 05 0e 00 00       	call   8010571a <release>
+      return 0;
+80104915:	83 c4 10             	add    $0x10,%esp
+80104918:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+8010491d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104920:	c9                   	leave
+80104921:	c3                   	ret
+  release(&ptable.lock);
+80104922:	83 ec 0c             	sub    $0xc,%esp
+80104925:	68 00 46 11 80       	push   $0x80114600
+8010492a:	e8 eb 0d 00 00       	call   8010571a <release>
+  return -1;
+8010492f:	83 c4 10             	add    $0x10,%esp
+80104932:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104937:	eb e4                	jmp    8010491d <kill+0x58>
+
+80104939 <setnice>:
+// moved to its new place in the runqueue straight away, and may
+// preempt the process running on its CPU.
+// Returns -1 if there is no such process or value is out of range.
+int
+setnice(int pid, int value)
+{
+80104939:	55                   	push   %ebp
+8010493a:	89 e5                	mov    %esp,%ebp
+8010493c:	57                   	push   %edi
+8010493d:	56                   	push   %esi
+8010493e:	53                   	push   %ebx
+8010493f:	83 ec 0c             	sub    $0xc,%esp
+80104942:	8b 75 08             	mov    0x8(%ebp),%esi
+80104945:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct proc *p;
+  int queued;
+
+  if(value < BFS_NICE_FIRST_LEVEL || value > BFS_NICE_LAST_LEVEL)
+80104948:	8d 47 14             	lea    0x14(%edi),%eax
+8010494b:	83 f8 27             	cmp    $0x27,%eax
+8010494e:	0f 87 bf 00 00 00    	ja     80104a13 <setnice+0xda>
+    return -1;
+
+  acquire(&ptable.lock);
+80104954:	83 ec 0c             	sub    $0xc,%esp
+80104957:	68 00 46 11 80       	push   $0x80114600
+8010495c:	e8 54 0d 00 00       	call   801056b5 <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104961:	83 c4 10             	add    $0x10,%esp
+80104964:	bb 34 46 11 80       	mov    $0x80114634,%ebx
+80104969:	eb 2f                	jmp    8010499a <setnice+0x61>
+    if(p->pid == pid && p->state != UNUSED){
+      p->nice_value = value;
+      if(policy->renice){
+        queued = p->state == RUNNABLE && policy->dequeue(p);
+8010496b:	8b 42 0c             	mov    0xc(%edx),%eax
+8010496e:	83 ec 0c             	sub    $0xc,%esp
+80104971:	53                   	push   %ebx
+80104972:	ff d0                	call   *%eax
+80104974:	89 c6                	mov    %eax,%esi
+80104976:	83 c4 10             	add    $0x10,%esp
+80104979:	85 c0                	test   %eax,%eax
+8010497b:	74 4d                	je     801049ca <setnice+0x91>
+8010497d:	be 01 00 00 00       	mov    $0x1,%esi
+80104982:	eb 46                	jmp    801049ca <setnice+0x91>
+        policy->renice(p);
+        if(queued){
+          enqueue_process(p);
+80104984:	89 d8                	mov    %ebx,%eax
+80104986:	e8 25 f4 ff ff       	call   80103db0 <enqueue_process>
+          preempt_for(p);
+8010498b:	89 d8                	mov    %ebx,%eax
+8010498d:	e8 67 f5 ff ff       	call   80103ef9 <preempt_for>
+80104992:	eb 4b                	jmp    801049df <setnice+0xa6>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104994:	81 c3 3c 01 00 00    	add    $0x13c,%ebx
+8010499a:	81 fb 34 95 11 80    	cmp    $0x80119534,%ebx
+801049a0:	73 5a                	jae    801049fc <setnice+0xc3>
+    if(p->pid == pid && p->state != UNUSED){
+801049a2:	39 73 10             	cmp    %esi,0x10(%ebx)
+801049a5:	75 ed                	jne    80104994 <setnice+0x5b>
+801049a7:	8b 43 0c             	mov    0xc(%ebx),%eax
+801049aa:	85 c0                	test   %eax,%eax
+801049ac:	74 e6                	je     80104994 <setnice+0x5b>
+      p->nice_value = value;
+801049ae:	89 bb bc 00 00 00    	mov    %edi,0xbc(%ebx)
+      if(policy->renice){
+801049b4:	8b 15 10 c0 10 80    	mov    0x8010c010,%edx
+801049ba:	83 7a 1c 00          	cmpl   $0x0,0x1c(%edx)
+801049be:	74 1f                	je     801049df <setnice+0xa6>
+        queued = p->state == RUNNABLE && policy->dequeue(p);
+801049c0:	83 f8 03             	cmp    $0x3,%eax
+801049c3:	74 a6                	je     8010496b <setnice+0x32>
+801049c5:	be 00 00 00 00       	mov    $0x0,%esi
+        policy->renice(p);
+801049ca:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+801049cf:	8b 40 1c             	mov    0x1c(%eax),%eax
+801049d2:	83 ec 0c             	sub    $0xc,%esp
+801049d5:	53                   	push   %ebx
+801049d6:	ff d0                	call   *%eax
+        if(queued){
+801049d8:	83 c4 10             	add    $0x10,%esp
+801049db:	85 f6                	test   %esi,%esi
+801049dd:	75 a5                	jne    80104984 <setnice+0x4b>
+        }
+      }
+      release(&ptable.lock);
+801049df:	83 ec 0c             	sub    $0xc,%esp
+801049e2:	68 00 46 11 80       	push   $0x80114600
+801049e7:	e8 2e 0d 00 00       	call   8010571a <release>
+      return 0;
+801049ec:	83 c4 10             	add    $0x10,%esp
+801049ef:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+801049f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801049f7:	5b                   	pop    %ebx
+801049f8:	5e                   	pop    %esi
+801049f9:	5f                   	pop    %edi
+801049fa:	5d                   	pop    %ebp
+801049fb:	c3                   	ret
+  release(&ptable.lock);
+801049fc:	83 ec 0c             	sub    $0xc,%esp
+801049ff:	68 00 46 11 80       	push   $0x80114600
+80104a04:	e8 11 0d 00 00       	call   8010571a <release>
+  return -1;
+80104a09:	83 c4 10             	add    $0x10,%esp
+80104a0c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104a11:	eb e1                	jmp    801049f4 <setnice+0xbb>
+    return -1;
+80104a13:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104a18:	eb da                	jmp    801049f4 <setnice+0xbb>
+
+80104a1a <setclass>:
+// is queued, it moves to the class's runqueue straight away.
+// Returns its previous class, or -1 if there is no such process
+// or class.
+int
+setclass(int pid, int class)
+{
+80104a1a:	55                   	push   %ebp
+80104a1b:	89 e5                	mov    %esp,%ebp
+80104a1d:	57                   	push   %edi
+80104a1e:	56                   	push   %esi
+80104a1f:	53                   	push   %ebx
+80104a20:	83 ec 0c             	sub    $0xc,%esp
+80104a23:	8b 75 08             	mov    0x8(%ebp),%esi
+80104a26:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct proc *p;
+  int old, queued;
+
+  if(class != SCHED_NORMAL && class != SCHED_ISO && class != SCHED_IDLEPRIO)
+80104a29:	83 ff 02             	cmp    $0x2,%edi
+80104a2c:	0f 87 9e 00 00 00    	ja     80104ad0 <setclass+0xb6>
+    return -1;
+
+  acquire(&ptable.lock);
+80104a32:	83 ec 0c             	sub    $0xc,%esp
+80104a35:	68 00 46 11 80       	push   $0x80114600
+80104a3a:	e8 76 0c 00 00       	call   801056b5 <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104a3f:	83 c4 10             	add    $0x10,%esp
+80104a42:	bb 34 46 11 80       	mov    $0x80114634,%ebx
+80104a47:	eb 31                	jmp    80104a7a <setclass+0x60>
+    if(p->pid == pid && p->state != UNUSED){
+      old = p->sched_class;
+      queued = p->state == RUNNABLE && policy->dequeue(p);
+80104a49:	a1 10 c0 10 80       	mov    0x8010c010,%eax
+80104a4e:	8b 40 0c             	mov    0xc(%eax),%eax
+80104a51:	83 ec 0c             	sub    $0xc,%esp
+80104a54:	53                   	push   %ebx
+80104a55:	ff d0                	call   *%eax
+80104a57:	83 c4 10             	add    $0x10,%esp
+80104a5a:	85 c0                	test   %eax,%eax
+80104a5c:	74 3b                	je     80104a99 <setclass+0x7f>
+      p->sched_class = class;
+80104a5e:	89 bb c0 00 00 00    	mov    %edi,0xc0(%ebx)
+      if(queued){
+        enqueue_process(p);
+80104a64:	89 d8                	mov    %ebx,%eax
+80104a66:	e8 45 f3 ff ff       	call   80103db0 <enqueue_process>
+        preempt_for(p);
+80104a6b:	89 d8                	mov    %ebx,%eax
+80104a6d:	e8 87 f4 ff ff       	call   80103ef9 <preempt_for>
+80104a72:	eb 2b                	jmp    80104a9f <setclass+0x85>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104a74:	81 c3 3c 01 00 00    	add    $0x13c,%ebx
+80104a7a:	81 fb 34 95 11 80    	cmp    $0x80119534,%ebx
+80104a80:	73 37                	jae    80104ab9 <setclass+0x9f>
+    if(p->pid == pid && p->state != UNUSED){
+80104a82:	39 73 10             	cmp    %esi,0x10(%ebx)
+80104a85:	75 ed                	jne    80104a74 <setclass+0x5a>
+80104a87:	8b 43 0c             	mov    0xc(%ebx),%eax
+80104a8a:	85 c0                	test   %eax,%eax
+80104a8c:	74 e6                	je     80104a74 <setclass+0x5a>
+      old = p->sched_class;
+80104a8e:	8b b3 c0 00 00 00    	mov    0xc0(%ebx),%esi
+      queued = p->state == RUNNABLE && policy->dequeue(p);
+80104a94:	83 f8 03             	cmp    $0x3,%eax
+80104a97:	74 b0                	je     80104a49 <setclass+0x2f>
+      p->sched_class = class;
+80104a99:	89 bb c0 00 00 00    	mov    %edi,0xc0(%ebx)
+      }
+      release(&ptable.lock);
+80104a9f:	83 ec 0c             	sub    $0xc,%esp
+80104aa2:	68 00 46 11 80       	push   $0x80114600
+80104aa7:	e8 6e 0c 00 00       	call   8010571a <release>
+      return old;
+80104aac:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80104aaf:	89 f0                	mov    %esi,%eax
+80104ab1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104ab4:	5b                   	pop    %ebx
+80104ab5:	5e                   	pop    %esi
+80104ab6:	5f                   	pop    %edi
+80104ab7:	5d                   	pop    %ebp
+80104ab8:	c3                   	ret
+  release(&ptable.lock);
+80104ab9:	83 ec 0c             	sub    $0xc,%esp
+80104abc:	68 00 46 11 80       	push   $0x80114600
+80104ac1:	e8 54 0c 00 00       	call   8010571a <release>
+  return -1;
+80104ac6:	83 c4 10             	add    $0x10,%esp
+80104ac9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80104ace:	eb df                	jmp    80104aaf <setclass+0x95>
+    return -1;
+80104ad0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80104ad5:	eb d8                	jmp    80104aaf <setclass+0x95>
+
+80104ad7 <getnice>:
+
+// Return the nice value of process pid, or NICE_NOPROC if there
+// is no such process.
+int
+getnice(int pid)
+{
+80104ad7:	55                   	push   %ebp
+80104ad8:	89 e5                	mov    %esp,%ebp
+80104ada:	53                   	push   %ebx
+80104adb:	83 ec 10             	sub    $0x10,%esp
+80104ade:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+  int nice;
+
+  acquire(&ptable.lock);
+80104ae1:	68 00 46 11 80       	push   $0x80114600
+80104ae6:	e8 ca 0b 00 00       	call   801056b5 <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104aeb:	83 c4 10             	add    $0x10,%esp
+80104aee:	b8 34 46 11 80       	mov    $0x80114634,%eax
+80104af3:	eb 05                	jmp    80104afa <getnice+0x23>
+80104af5:	05 3c 01 00 00       	add    $0x13c,%eax
+80104afa:	3d 34 95 11 80       	cmp    $0x80119534,%eax
+80104aff:	73 28                	jae    80104b29 <getnice+0x52>
+    if(p->pid == pid && p->state != UNUSED){
+80104b01:	39 58 10             	cmp    %ebx,0x10(%eax)
+80104b04:	75 ef                	jne    80104af5 <getnice+0x1e>
+80104b06:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+80104b0a:	74 e9                	je     80104af5 <getnice+0x1e>
+      nice = p->nice_value;
+80104b0c:	8b 98 bc 00 00 00    	mov    0xbc(%eax),%ebx
+      release(&ptable.lock);
+80104b12:	83 ec 0c             	sub    $0xc,%esp
+80104b15:	68 00 46 11 80       	push   $0x80114600
+80104b1a:	e8 fb 0b 00 00       	call   8010571a <release>
+      return nice;
+80104b1f:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  release(&ptable.lock);
+  return NICE_NOPROC;
+}
+80104b22:	89 d8                	mov    %ebx,%eax
+80104b24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104b27:	c9                   	leave
+80104b28:	c3                   	ret
+  release(&ptable.lock);
+80104b29:	83 ec 0c             	sub    $0xc,%esp
+80104b2c:	68 00 46 11 80       	push   $0x80114600
+80104b31:	e8 e4 0b 00 00       	call   8010571a <release>
+  return NICE_NOPROC;
+80104b36:	83 c4 10             	add    $0x10,%esp
+80104b39:	bb 64 00 00 00       	mov    $0x64,%ebx
+80104b3e:	eb e2                	jmp    80104b22 <getnice+0x4b>
+
+80104b40 <getschedstats>:
+
+// Copy the scheduling statistics of process pid into st.
+// Returns -1 if there is no such process.
+int
+getschedstats(int pid, struct schedstat *st)
+{
+80104b40:	55                   	push   %ebp
+80104b41:	89 e5                	mov    %esp,%ebp
+80104b43:	56                   	push   %esi
+80104b44:	53                   	push   %ebx
+80104b45:	8b 75 08             	mov    0x8(%ebp),%esi
+80104b48:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+80104b4b:	83 ec 0c             	sub    $0xc,%esp
+80104b4e:	68 00 46 11 80       	push   $0x80114600
+80104b53:	e8 5d 0b 00 00       	call   801056b5 <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104b58:	83 c4 10             	add    $0x10,%esp
+80104b5b:	b9 34 46 11 80       	mov    $0x80114634,%ecx
+80104b60:	eb 06                	jmp    80104b68 <getschedstats+0x28>
+80104b62:	81 c1 3c 01 00 00    	add    $0x13c,%ecx
+80104b68:	81 f9 34 95 11 80    	cmp    $0x80119534,%ecx
+80104b6e:	73 7f                	jae    80104bef <getschedstats+0xaf>
+    if(p->pid == pid && p->state != UNUSED){
+80104b70:	39 71 10             	cmp    %esi,0x10(%ecx)
+80104b73:	75 ed                	jne    80104b62 <getschedstats+0x22>
+80104b75:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+80104b79:	74 e7                	je     80104b62 <getschedstats+0x22>
+      st->runtime = p->runtime;
+80104b7b:	8b 81 90 00 00 00    	mov    0x90(%ecx),%eax
+80104b81:	8b 91 94 00 00 00    	mov    0x94(%ecx),%edx
+80104b87:	89 03                	mov    %eax,(%ebx)
+80104b89:	89 53 04             	mov    %edx,0x4(%ebx)
+      st->wait_time = p->wait_time;
+80104b8c:	8b 81 a0 00 00 00    	mov    0xa0(%ecx),%eax
+80104b92:	8b 91 a4 00 00 00    	mov    0xa4(%ecx),%edx
+80104b98:	89 43 08             	mov    %eax,0x8(%ebx)
+80104b9b:	89 53 0c             	mov    %edx,0xc(%ebx)
+      st->max_wait = p->max_wait;
+80104b9e:	8b 81 a8 00 00 00    	mov    0xa8(%ecx),%eax
+80104ba4:	8b 91 ac 00 00 00    	mov    0xac(%ecx),%edx
+80104baa:	89 43 10             	mov    %eax,0x10(%ebx)
+80104bad:	89 53 14             	mov    %edx,0x14(%ebx)
+      st->dispatches = p->dispatches;
+80104bb0:	8b 81 b0 00 00 00    	mov    0xb0(%ecx),%eax
+80104bb6:	89 43 18             	mov    %eax,0x18(%ebx)
+      st->nvcsw = p->nvcsw;
+80104bb9:	8b 81 b4 00 00 00    	mov    0xb4(%ecx),%eax
+80104bbf:	89 43 1c             	mov    %eax,0x1c(%ebx)
+      st->nivcsw = p->nivcsw;
+80104bc2:	8b 81 b8 00 00 00    	mov    0xb8(%ecx),%eax
+80104bc8:	89 43 20             	mov    %eax,0x20(%ebx)
+      st->tsc_per_tick = tsc_per_tick;
+80104bcb:	a1 60 c0 10 80       	mov    0x8010c060,%eax
+80104bd0:	89 43 24             	mov    %eax,0x24(%ebx)
+      release(&ptable.lock);
+80104bd3:	83 ec 0c             	sub    $0xc,%esp
+80104bd6:	68 00 46 11 80       	push   $0x80114600
+80104bdb:	e8 3a 0b 00 00       	call   8010571a <release>
+      return 0;
+80104be0:	83 c4 10             	add    $0x10,%esp
+80104be3:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80104be8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104beb:	5b                   	pop    %ebx
+80104bec:	5e                   	pop    %esi
+80104bed:	5d                   	pop    %ebp
+80104bee:	c3                   	ret
+  release(&ptable.lock);
+80104bef:	83 ec 0c             	sub    $0xc,%esp
+80104bf2:	68 00 46 11 80       	push   $0x80114600
+80104bf7:	e8 1e 0b 00 00       	call   8010571a <release>
+  return -1;
+80104bfc:	83 c4 10             	add    $0x10,%esp
+80104bff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104c04:	eb e2                	jmp    80104be8 <getschedstats+0xa8>
+
+80104c06 <getcpustat>:
+
+// Copy CPU n's scheduler statistics into st.
+// Returns -1 if there is no such CPU.
+int
+getcpustat(int n, struct cpustat *st)
+{
+80104c06:	55                   	push   %ebp
+80104c07:	89 e5                	mov    %esp,%ebp
+80104c09:	8b 45 08             	mov    0x8(%ebp),%eax
+80104c0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(n < 0 || n >= ncpu)
+80104c0f:	85 c0                	test   %eax,%eax
+80104c11:	78 46                	js     80104c59 <getcpustat+0x53>
+80104c13:	39 05 e4 37 11 80    	cmp    %eax,0x801137e4
+80104c19:	7e 45                	jle    80104c60 <getcpustat+0x5a>
+    return -1;
+  st->ticks = cpus[n].ticks;
+80104c1b:	69 c0 d8 00 00 00    	imul   $0xd8,%eax,%eax
+80104c21:	8b 88 bc 38 11 80    	mov    -0x7feec744(%eax),%ecx
+80104c27:	89 0a                	mov    %ecx,(%edx)
+  st->idle_ticks = cpus[n].idle_ticks;
+80104c29:	8b 88 c0 38 11 80    	mov    -0x7feec740(%eax),%ecx
+80104c2f:	89 4a 04             	mov    %ecx,0x4(%edx)
+  st->dispatches = cpus[n].dispatches;
+80104c32:	8b 88 c8 38 11 80    	mov    -0x7feec738(%eax),%ecx
+80104c38:	89 4a 08             	mov    %ecx,0x8(%edx)
+  st->migrations = cpus[n].migrations;
+80104c3b:	8b 88 cc 38 11 80    	mov    -0x7feec734(%eax),%ecx
+  st->ticks = cpus[n].ticks;
+80104c41:	05 00 38 11 80       	add    $0x80113800,%eax
+  st->migrations = cpus[n].migrations;
+80104c46:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  st->iso_ticks = cpus[n].iso_ticks;
+80104c49:	8b 80 d0 00 00 00    	mov    0xd0(%eax),%eax
+80104c4f:	89 42 10             	mov    %eax,0x10(%edx)
+  return 0;
+80104c52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80104c57:	5d                   	pop    %ebp
+80104c58:	c3                   	ret
+    return -1;
+80104c59:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104c5e:	eb f7                	jmp    80104c57 <getcpustat+0x51>
+80104c60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104c65:	eb f0                	jmp    80104c57 <getcpustat+0x51>
+
+80104c67 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+80104c67:	55                   	push   %ebp
+80104c68:	89 e5                	mov    %esp,%ebp
+80104c6a:	56                   	push   %esi
+80104c6b:	53                   	push   %ebx
+80104c6c:	83 ec 30             	sub    $0x30,%esp
+  int i;
+  struct proc *p;
+  char *state;
+  uint pc[10];
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104c6f:	bb 34 46 11 80       	mov    $0x80114634,%ebx
+80104c74:	eb 36                	jmp    80104cac <procdump+0x45>
+    if(p->state == UNUSED)
+      continue;
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+      state = states[p->state];
+    else
+      state = "???";
+80104c76:	b8 3f 8c 10 80       	mov    $0x80108c3f,%eax
+    cprintf("%d %s %s", p->pid, state, p->name);
+80104c7b:	8d 53 74             	lea    0x74(%ebx),%edx
+80104c7e:	52                   	push   %edx
+80104c7f:	50                   	push   %eax
+80104c80:	ff 73 10             	push   0x10(%ebx)
+80104c83:	68 43 8c 10 80       	push   $0x80108c43
+80104c88:	e8 a2 b9 ff ff       	call   8010062f <cprintf>
+    if(p->state == SLEEPING){
+80104c8d:	83 c4 10             	add    $0x10,%esp
+80104c90:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80104c94:	74 3c                	je     80104cd2 <procdump+0x6b>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80104c96:	83 ec 0c             	sub    $0xc,%esp
+80104c99:	68 6f 90 10 80       	push   $0x8010906f
+80104c9e:	e8 8c b9 ff ff       	call   8010062f <cprintf>
+80104ca3:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104ca6:	81 c3 3c 01 00 00    	add    $0x13c,%ebx
+80104cac:	81 fb 34 95 11 80    	cmp    $0x80119534,%ebx
+80104cb2:	73 61                	jae    80104d15 <procdump+0xae>
+    if(p->state == UNUSED)
+80104cb4:	8b 43 0c             	mov    0xc(%ebx),%eax
+80104cb7:	85 c0                	test   %eax,%eax
+80104cb9:	74 eb                	je     80104ca6 <procdump+0x3f>
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80104cbb:	83 f8 05             	cmp    $0x5,%eax
+80104cbe:	77 b6                	ja     80104c76 <procdump+0xf>
+80104cc0:	8b 04 85 cc 8c 10 80 	mov    -0x7fef7334(,%eax,4),%eax
+80104cc7:	85 c0                	test   %eax,%eax
+80104cc9:	75 b0                	jne    80104c7b <procdump+0x14>
+      state = "???";
+80104ccb:	b8 3f 8c 10 80       	mov    $0x80108c3f,%eax
+80104cd0:	eb a9                	jmp    80104c7b <procdump+0x14>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80104cd2:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80104cd5:	8b 40 0c             	mov    0xc(%eax),%eax
+80104cd8:	83 c0 08             	add    $0x8,%eax
+80104cdb:	83 ec 08             	sub    $0x8,%esp
+80104cde:	8d 55 d0             	lea    -0x30(%ebp),%edx
+80104ce1:	52                   	push   %edx
+80104ce2:	50                   	push   %eax
+80104ce3:	e8 a4 08 00 00       	call   8010558c <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80104ce8:	83 c4 10             	add    $0x10,%esp
+80104ceb:	be 00 00 00 00       	mov    $0x0,%esi
+80104cf0:	eb 14                	jmp    80104d06 <procdump+0x9f>
+        cprintf(" %p", pc[i]);
+80104cf2:	83 ec 08             	sub    $0x8,%esp
+80104cf5:	50                   	push   %eax
+80104cf6:	68 e1 85 10 80       	push   $0x801085e1
+80104cfb:	e8 2f b9 ff ff       	call   8010062f <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80104d00:	83 c6 01             	add    $0x1,%esi
+80104d03:	83 c4 10             	add    $0x10,%esp
+80104d06:	83 fe 09             	cmp    $0x9,%esi
+80104d09:	7f 8b                	jg     80104c96 <procdump+0x2f>
+80104d0b:	8b 44 b5 d0          	mov    -0x30(%ebp,%esi,4),%eax
+80104d0f:	85 c0                	test   %eax,%eax
+80104d11:	75 df                	jne    80104cf2 <procdump+0x8b>
+80104d13:	eb 81                	jmp    80104c96 <procdump+0x2f>
+  }
+}
+80104d15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104d18:	5b                   	pop    %ebx
+80104d19:	5e                   	pop    %esi
+80104d1a:	5d                   	pop    %ebp
+80104d1b:	c3                   	ret
+
+80104d1c <schedloginit>:
+int schedlog_active = 0;
+uint64 schedlog_lasttick = 0;
+
+void
+schedloginit(void)
+{
+80104d1c:	55                   	push   %ebp
+80104d1d:	89 e5                	mov    %esp,%ebp
+80104d1f:	53                   	push   %ebx
+80104d20:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for(i = 0; i < NCPU; i++)
+80104d23:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104d28:	eb 1f                	jmp    80104d49 <schedloginit+0x2d>
+    initlock(&schedlogs[i].lock, "schedlog");
+80104d2a:	83 ec 08             	sub    $0x8,%esp
+80104d2d:	68 ec 8c 10 80       	push   $0x80108cec
+80104d32:	69 c3 3c 70 00 00    	imul   $0x703c,%ebx,%eax
+80104d38:	05 80 96 11 80       	add    $0x80119680,%eax
+80104d3d:	50                   	push   %eax
+80104d3e:	e8 2e 08 00 00       	call   80105571 <initlock>
+  for(i = 0; i < NCPU; i++)
+80104d43:	83 c3 01             	add    $0x1,%ebx
+80104d46:	83 c4 10             	add    $0x10,%esp
+80104d49:	83 fb 07             	cmp    $0x7,%ebx
+80104d4c:	7e dc                	jle    80104d2a <schedloginit+0xe>
+}
+80104d4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104d51:	c9                   	leave
+80104d52:	c3                   	ret
+
+80104d53 <schedlog>:
+
+// Trace scheduler events for the next n ticks.
+void
+schedlog(int n)
+{
+80104d53:	55                   	push   %ebp
+80104d54:	89 e5                	mov    %esp,%ebp
+80104d56:	53                   	push   %ebx
+80104d57:	83 ec 04             	sub    $0x4,%esp
+  schedlog_lasttick = readticks64() + n;
+80104d5a:	e8 99 1d 00 00       	call   80106af8 <readticks64>
+80104d5f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80104d62:	89 cb                	mov    %ecx,%ebx
+80104d64:	c1 fb 1f             	sar    $0x1f,%ebx
+80104d67:	01 c1                	add    %eax,%ecx
+80104d69:	11 d3                	adc    %edx,%ebx
+80104d6b:	89 0d 60 96 11 80    	mov    %ecx,0x80119660
+80104d71:	89 1d 64 96 11 80    	mov    %ebx,0x80119664
+  schedlog_active = 1;
+80104d77:	c7 05 68 96 11 80 01 	movl   $0x1,0x80119668
+80104d7e:	00 00 00 
+}
+80104d81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104d84:	c9                   	leave
+80104d85:	c3                   	ret
+
+80104d86 <schedlog_event>:
+
+// Record an event of the given type for p on this CPU's ring.
+void
+schedlog_event(int type, struct proc *p)
+{
+80104d86:	55                   	push   %ebp
+80104d87:	89 e5                	mov    %esp,%ebp
+80104d89:	57                   	push   %edi
+80104d8a:	56                   	push   %esi
+80104d8b:	53                   	push   %ebx
+80104d8c:	83 ec 1c             	sub    $0x1c,%esp
+80104d8f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct schedevent *e;
+  uint64 now;
+  int id;
+
+  if(!schedlog_active)
+80104d92:	83 3d 68 96 11 80 00 	cmpl   $0x0,0x80119668
+80104d99:	75 08                	jne    80104da3 <schedlog_event+0x1d>
+  e->pid = p->pid;
+  e->virtual_deadline = p->virtual_deadline;
+  e->ticks_left = p->ticks_left;
+  release(&schedlogs[id].lock);
+  popcli();
+}
+80104d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104d9e:	5b                   	pop    %ebx
+80104d9f:	5e                   	pop    %esi
+80104da0:	5f                   	pop    %edi
+80104da1:	5d                   	pop    %ebp
+80104da2:	c3                   	ret
+  now = readticks64();
+80104da3:	e8 50 1d 00 00       	call   80106af8 <readticks64>
+80104da8:	89 c3                	mov    %eax,%ebx
+80104daa:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  if(now > schedlog_lasttick){
+80104dad:	39 05 60 96 11 80    	cmp    %eax,0x80119660
+80104db3:	a1 64 96 11 80       	mov    0x80119664,%eax
+80104db8:	19 d0                	sbb    %edx,%eax
+80104dba:	73 0c                	jae    80104dc8 <schedlog_event+0x42>
+    schedlog_active = 0;
+80104dbc:	c7 05 68 96 11 80 00 	movl   $0x0,0x80119668
+80104dc3:	00 00 00 
+    return;
+80104dc6:	eb d3                	jmp    80104d9b <schedlog_event+0x15>
+  pushcli();
+80104dc8:	e8 05 08 00 00       	call   801055d2 <pushcli>
+  id = cpuid();
+80104dcd:	e8 31 ef ff ff       	call   80103d03 <cpuid>
+80104dd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquire(&schedlogs[id].lock);
+80104dd5:	69 f8 3c 70 00 00    	imul   $0x703c,%eax,%edi
+80104ddb:	81 c7 80 96 11 80    	add    $0x80119680,%edi
+80104de1:	83 ec 0c             	sub    $0xc,%esp
+80104de4:	57                   	push   %edi
+80104de5:	e8 cb 08 00 00       	call   801056b5 <acquire>
+  if(schedlogs[id].tail - schedlogs[id].head == NSCHEDLOG)
+80104dea:	8b 47 38             	mov    0x38(%edi),%eax
+80104ded:	8b 57 34             	mov    0x34(%edi),%edx
+80104df0:	89 c1                	mov    %eax,%ecx
+80104df2:	29 d1                	sub    %edx,%ecx
+80104df4:	83 c4 10             	add    $0x10,%esp
+80104df7:	81 f9 00 04 00 00    	cmp    $0x400,%ecx
+80104dfd:	74 76                	je     80104e75 <schedlog_event+0xef>
+  e = &schedlogs[id].ev[schedlogs[id].tail++ % NSCHEDLOG];
+80104dff:	69 55 e4 3c 70 00 00 	imul   $0x703c,-0x1c(%ebp),%edx
+80104e06:	8d 48 01             	lea    0x1(%eax),%ecx
+80104e09:	89 8a b8 96 11 80    	mov    %ecx,-0x7fee6948(%edx)
+80104e0f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  e->tick = now;
+80104e14:	6b c0 1c             	imul   $0x1c,%eax,%eax
+80104e17:	8d 8c 02 80 96 11 80 	lea    -0x7fee6980(%edx,%eax,1),%ecx
+80104e1e:	89 59 3c             	mov    %ebx,0x3c(%ecx)
+80104e21:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80104e24:	89 59 40             	mov    %ebx,0x40(%ecx)
+  e->cpu = id;
+80104e27:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+80104e2b:	88 41 44             	mov    %al,0x44(%ecx)
+  e->type = type;
+80104e2e:	8b 45 08             	mov    0x8(%ebp),%eax
+80104e31:	88 41 45             	mov    %al,0x45(%ecx)
+  e->nice = p->nice_value;
+80104e34:	8b 86 bc 00 00 00    	mov    0xbc(%esi),%eax
+80104e3a:	66 89 41 46          	mov    %ax,0x46(%ecx)
+  e->pid = p->pid;
+80104e3e:	8b 46 10             	mov    0x10(%esi),%eax
+80104e41:	89 41 48             	mov    %eax,0x48(%ecx)
+  e->virtual_deadline = p->virtual_deadline;
+80104e44:	8b 86 c8 00 00 00    	mov    0xc8(%esi),%eax
+80104e4a:	8b 96 cc 00 00 00    	mov    0xcc(%esi),%edx
+80104e50:	89 41 4c             	mov    %eax,0x4c(%ecx)
+80104e53:	89 51 50             	mov    %edx,0x50(%ecx)
+  e->ticks_left = p->ticks_left;
+80104e56:	8b 86 84 00 00 00    	mov    0x84(%esi),%eax
+80104e5c:	89 41 54             	mov    %eax,0x54(%ecx)
+  release(&schedlogs[id].lock);
+80104e5f:	83 ec 0c             	sub    $0xc,%esp
+80104e62:	57                   	push   %edi
+80104e63:	e8 b2 08 00 00       	call   8010571a <release>
+  popcli();
+80104e68:	e8 a9 07 00 00       	call   80105616 <popcli>
+80104e6d:	83 c4 10             	add    $0x10,%esp
+80104e70:	e9 26 ff ff ff       	jmp    80104d9b <schedlog_event+0x15>
+    schedlogs[id].head++;
+80104e75:	69 4d e4 3c 70 00 00 	imul   $0x703c,-0x1c(%ebp),%ecx
+80104e7c:	83 c2 01             	add    $0x1,%edx
+80104e7f:	89 91 b4 96 11 80    	mov    %edx,-0x7fee694c(%ecx)
+80104e85:	e9 75 ff ff ff       	jmp    80104dff <schedlog_event+0x79>
+
+80104e8a <schedlogread>:
+
+// Move up to n of the oldest recorded events into buf, merging the
+// per-CPU rings by tick.  Returns the number of events copied.
+int
+schedlogread(struct schedevent *buf, int n)
+{
+80104e8a:	55                   	push   %ebp
+80104e8b:	89 e5                	mov    %esp,%ebp
+80104e8d:	57                   	push   %edi
+80104e8e:	56                   	push   %esi
+80104e8f:	53                   	push   %ebx
+80104e90:	83 ec 1c             	sub    $0x1c,%esp
+80104e93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i, best, copied;
+
+  for(i = 0; i < ncpu; i++)
+80104e96:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104e9b:	eb 1a                	jmp    80104eb7 <schedlogread+0x2d>
+    acquire(&schedlogs[i].lock);
+80104e9d:	83 ec 0c             	sub    $0xc,%esp
+80104ea0:	69 c3 3c 70 00 00    	imul   $0x703c,%ebx,%eax
+80104ea6:	05 80 96 11 80       	add    $0x80119680,%eax
+80104eab:	50                   	push   %eax
+80104eac:	e8 04 08 00 00       	call   801056b5 <acquire>
+  for(i = 0; i < ncpu; i++)
+80104eb1:	83 c3 01             	add    $0x1,%ebx
+80104eb4:	83 c4 10             	add    $0x10,%esp
+80104eb7:	a1 e4 37 11 80       	mov    0x801137e4,%eax
+80104ebc:	39 d8                	cmp    %ebx,%eax
+80104ebe:	7f dd                	jg     80104e9d <schedlogread+0x13>
+
+  for(copied = 0; copied < n; copied++){
+80104ec0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104ec3:	be 00 00 00 00       	mov    $0x0,%esi
+80104ec8:	89 7d 0c             	mov    %edi,0xc(%ebp)
+80104ecb:	e9 c8 00 00 00       	jmp    80104f98 <schedlogread+0x10e>
+      if(schedlogs[i].head == schedlogs[i].tail)
+        continue;
+      if(best < 0 ||
+         schedlogs[i].ev[schedlogs[i].head % NSCHEDLOG].tick <
+         schedlogs[best].ev[schedlogs[best].head % NSCHEDLOG].tick)
+        best = i;
+80104ed0:	89 c1                	mov    %eax,%ecx
+    for(i = 0; i < ncpu; i++){
+80104ed2:	83 c0 01             	add    $0x1,%eax
+80104ed5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+80104ed8:	7e 61                	jle    80104f3b <schedlogread+0xb1>
+      if(schedlogs[i].head == schedlogs[i].tail)
+80104eda:	69 d0 3c 70 00 00    	imul   $0x703c,%eax,%edx
+80104ee0:	8b 9a b4 96 11 80    	mov    -0x7fee694c(%edx),%ebx
+80104ee6:	81 c2 80 96 11 80    	add    $0x80119680,%edx
+80104eec:	3b 5a 38             	cmp    0x38(%edx),%ebx
+80104eef:	74 e1                	je     80104ed2 <schedlogread+0x48>
+      if(best < 0 ||
+80104ef1:	85 c9                	test   %ecx,%ecx
+80104ef3:	78 db                	js     80104ed0 <schedlogread+0x46>
+         schedlogs[i].ev[schedlogs[i].head % NSCHEDLOG].tick <
+80104ef5:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+80104efb:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+80104efe:	69 d0 3c 70 00 00    	imul   $0x703c,%eax,%edx
+80104f04:	8d b4 13 b0 96 11 80 	lea    -0x7fee6950(%ebx,%edx,1),%esi
+80104f0b:	8b 5e 10             	mov    0x10(%esi),%ebx
+         schedlogs[best].ev[schedlogs[best].head % NSCHEDLOG].tick)
+80104f0e:	69 f9 3c 70 00 00    	imul   $0x703c,%ecx,%edi
+80104f14:	8b 97 b4 96 11 80    	mov    -0x7fee694c(%edi),%edx
+80104f1a:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+80104f20:	6b d2 1c             	imul   $0x1c,%edx,%edx
+80104f23:	8d 94 17 b0 96 11 80 	lea    -0x7fee6950(%edi,%edx,1),%edx
+80104f2a:	8b 7a 10             	mov    0x10(%edx),%edi
+      if(best < 0 ||
+80104f2d:	8b 52 0c             	mov    0xc(%edx),%edx
+80104f30:	39 56 0c             	cmp    %edx,0xc(%esi)
+80104f33:	19 fb                	sbb    %edi,%ebx
+80104f35:	73 9b                	jae    80104ed2 <schedlogread+0x48>
+        best = i;
+80104f37:	89 c1                	mov    %eax,%ecx
+80104f39:	eb 97                	jmp    80104ed2 <schedlogread+0x48>
+    }
+    if(best < 0)
+80104f3b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80104f3e:	85 c9                	test   %ecx,%ecx
+80104f40:	78 6d                	js     80104faf <schedlogread+0x125>
+      break;
+    buf[copied] = schedlogs[best].ev[schedlogs[best].head++ % NSCHEDLOG];
+80104f42:	69 c9 3c 70 00 00    	imul   $0x703c,%ecx,%ecx
+80104f48:	8b 81 b4 96 11 80    	mov    -0x7fee694c(%ecx),%eax
+80104f4e:	8d 58 01             	lea    0x1(%eax),%ebx
+80104f51:	89 99 b4 96 11 80    	mov    %ebx,-0x7fee694c(%ecx)
+80104f57:	25 ff 03 00 00       	and    $0x3ff,%eax
+80104f5c:	6b d6 1c             	imul   $0x1c,%esi,%edx
+80104f5f:	03 55 08             	add    0x8(%ebp),%edx
+80104f62:	6b c0 1c             	imul   $0x1c,%eax,%eax
+80104f65:	8d 84 01 b0 96 11 80 	lea    -0x7fee6950(%ecx,%eax,1),%eax
+80104f6c:	8b 48 0c             	mov    0xc(%eax),%ecx
+80104f6f:	89 0a                	mov    %ecx,(%edx)
+80104f71:	8b 48 10             	mov    0x10(%eax),%ecx
+80104f74:	89 4a 04             	mov    %ecx,0x4(%edx)
+80104f77:	8b 48 14             	mov    0x14(%eax),%ecx
+80104f7a:	89 4a 08             	mov    %ecx,0x8(%edx)
+80104f7d:	8b 48 18             	mov    0x18(%eax),%ecx
+80104f80:	89 4a 0c             	mov    %ecx,0xc(%edx)
+80104f83:	8b 48 1c             	mov    0x1c(%eax),%ecx
+80104f86:	89 4a 10             	mov    %ecx,0x10(%edx)
+80104f89:	8b 48 20             	mov    0x20(%eax),%ecx
+80104f8c:	89 4a 14             	mov    %ecx,0x14(%edx)
+80104f8f:	8b 40 24             	mov    0x24(%eax),%eax
+80104f92:	89 42 18             	mov    %eax,0x18(%edx)
+  for(copied = 0; copied < n; copied++){
+80104f95:	83 c6 01             	add    $0x1,%esi
+80104f98:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80104f9b:	7d 12                	jge    80104faf <schedlogread+0x125>
+    best = -1;
+80104f9d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+    for(i = 0; i < ncpu; i++){
+80104fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+80104fa7:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80104faa:	e9 26 ff ff ff       	jmp    80104ed5 <schedlogread+0x4b>
+  }
+
+  for(i = ncpu - 1; i >= 0; i--)
+80104faf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80104fb2:	83 eb 01             	sub    $0x1,%ebx
+80104fb5:	eb 1a                	jmp    80104fd1 <schedlogread+0x147>
+    release(&schedlogs[i].lock);
+80104fb7:	83 ec 0c             	sub    $0xc,%esp
+80104fba:	69 c3 3c 70 00 00    	imul   $0x703c,%ebx,%eax
+80104fc0:	05 80 96 11 80       	add    $0x80119680,%eax
+80104fc5:	50                   	push   %eax
+80104fc6:	e8 4f 07 00 00       	call   8010571a <release>
+  for(i = ncpu - 1; i >= 0; i--)
+80104fcb:	83 eb 01             	sub    $0x1,%ebx
+80104fce:	83 c4 10             	add    $0x10,%esp
+80104fd1:	85 db                	test   %ebx,%ebx
+80104fd3:	79 e2                	jns    80104fb7 <schedlogread+0x12d>
+  return copied;
+}
+80104fd5:	89 f0                	mov    %esi,%eax
+80104fd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104fda:	5b                   	pop    %ebx
+80104fdb:	5e                   	pop    %esi
+80104fdc:	5f                   	pop    %edi
+80104fdd:	5d                   	pop    %ebp
+80104fde:	c3                   	ret
+
+80104fdf <insert_to_level>:
+
+
+
+// Link a process's own node for one level in after prev_node.
+// Nodes live in struct proc, so nothing is allocated here.
+static void insert_to_level(struct node * new_node, struct proc * p, uint64 virtual_deadline, struct node * prev_node, struct node * forward) {
+80104fdf:	55                   	push   %ebp
+80104fe0:	89 e5                	mov    %esp,%ebp
+80104fe2:	53                   	push   %ebx
+80104fe3:	89 c1                	mov    %eax,%ecx
+80104fe5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  new_node->proc = p;
+80104fe8:	89 10                	mov    %edx,(%eax)
+  new_node->virtual_deadline = virtual_deadline;
+80104fea:	8b 45 08             	mov    0x8(%ebp),%eax
+80104fed:	8b 55 0c             	mov    0xc(%ebp),%edx
+80104ff0:	89 41 04             	mov    %eax,0x4(%ecx)
+80104ff3:	89 51 08             	mov    %edx,0x8(%ecx)
+
+  struct node * next_node = prev_node->next;
+80104ff6:	8b 43 10             	mov    0x10(%ebx),%eax
+
+  prev_node->next = new_node;
+80104ff9:	89 4b 10             	mov    %ecx,0x10(%ebx)
+
+  new_node->prev = prev_node;
+80104ffc:	89 59 0c             	mov    %ebx,0xc(%ecx)
+  new_node->next = next_node;
+80104fff:	89 41 10             	mov    %eax,0x10(%ecx)
+  new_node->forward = forward;
+80105002:	8b 55 14             	mov    0x14(%ebp),%edx
+80105005:	89 51 14             	mov    %edx,0x14(%ecx)
+
+  if (next_node != NULL) {
+80105008:	85 c0                	test   %eax,%eax
+8010500a:	74 03                	je     8010500f <insert_to_level+0x30>
+    next_node->prev = new_node;
+8010500c:	89 48 0c             	mov    %ecx,0xc(%eax)
+  }
+}
+8010500f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105012:	c9                   	leave
+80105013:	c3                   	ret
+
+80105014 <random>:
+
+// xorshift32 on the skip list's own state.  The state lives in
+// the skip list, under its lock, rather than in one global that
+// every CPU's inserts would write.
+static uint random(struct skiplist * skiplist) {
+80105014:	89 c2                	mov    %eax,%edx
+  uint x = skiplist->seed;
+80105016:	8b 48 44             	mov    0x44(%eax),%ecx
+
+  x ^= x << 13;
+80105019:	89 c8                	mov    %ecx,%eax
+8010501b:	c1 e0 0d             	shl    $0xd,%eax
+8010501e:	31 c8                	xor    %ecx,%eax
+  x ^= x >> 17;
+80105020:	89 c1                	mov    %eax,%ecx
+80105022:	c1 e9 11             	shr    $0x11,%ecx
+80105025:	31 c1                	xor    %eax,%ecx
+  x ^= x << 5;
+80105027:	89 c8                	mov    %ecx,%eax
+80105029:	c1 e0 05             	shl    $0x5,%eax
+8010502c:	31 c8                	xor    %ecx,%eax
+  skiplist->seed = x;
+8010502e:	89 42 44             	mov    %eax,0x44(%edx)
+  return x;
+}
+80105031:	c3                   	ret
+
+80105032 <unlink_node>:
+  TRACE(TRACE_RUNQUEUE, "inserted|[%d]%d\n", p->pid, p->max_level);
+}
+
+// Unlink p's node from every level it occupies.  The nodes are
+// embedded in p, so no search is needed to find them.
+static void unlink_node(struct skiplist * skiplist, struct proc * p) {
+80105032:	55                   	push   %ebp
+80105033:	89 e5                	mov    %esp,%ebp
+80105035:	56                   	push   %esi
+80105036:	53                   	push   %ebx
+80105037:	89 c1                	mov    %eax,%ecx
+80105039:	89 d3                	mov    %edx,%ebx
+  for (int level = 0; level <= p->max_level; level++) {
+8010503b:	b8 00 00 00 00       	mov    $0x0,%eax
+80105040:	eb 10                	jmp    80105052 <unlink_node+0x20>
+    struct node * node = &p->nodes[level];
+
+    node->prev->next = node->next;
+    if (node->next != NULL) {
+      node->next->prev = node->prev;
+80105042:	8d 34 40             	lea    (%eax,%eax,2),%esi
+80105045:	8b b4 f3 e0 00 00 00 	mov    0xe0(%ebx,%esi,8),%esi
+8010504c:	89 72 0c             	mov    %esi,0xc(%edx)
+  for (int level = 0; level <= p->max_level; level++) {
+8010504f:	83 c0 01             	add    $0x1,%eax
+80105052:	39 83 d0 00 00 00    	cmp    %eax,0xd0(%ebx)
+80105058:	7c 2c                	jl     80105086 <unlink_node+0x54>
+    node->prev->next = node->next;
+8010505a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+8010505d:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+80105060:	8b b2 e0 00 00 00    	mov    0xe0(%edx),%esi
+80105066:	8b 92 e4 00 00 00    	mov    0xe4(%edx),%edx
+8010506c:	89 56 10             	mov    %edx,0x10(%esi)
+    if (node->next != NULL) {
+8010506f:	85 d2                	test   %edx,%edx
+80105071:	75 cf                	jne    80105042 <unlink_node+0x10>
+    } else {
+      skiplist->tails[level] = node->prev;
+80105073:	8d 14 40             	lea    (%eax,%eax,2),%edx
+80105076:	8b 94 d3 e0 00 00 00 	mov    0xe0(%ebx,%edx,8),%edx
+8010507d:	89 94 81 a8 00 00 00 	mov    %edx,0xa8(%ecx,%eax,4)
+80105084:	eb c9                	jmp    8010504f <unlink_node+0x1d>
+    }
+  }
+  skiplist->size--;
+80105086:	8b 41 34             	mov    0x34(%ecx),%eax
+80105089:	83 e8 01             	sub    $0x1,%eax
+8010508c:	89 41 34             	mov    %eax,0x34(%ecx)
+  if (skiplist->headers[0].next != NULL) {
+8010508f:	8b 41 58             	mov    0x58(%ecx),%eax
+80105092:	85 c0                	test   %eax,%eax
+80105094:	74 0c                	je     801050a2 <unlink_node+0x70>
+    skiplist->min_deadline = skiplist->headers[0].next->virtual_deadline;
+80105096:	8b 50 08             	mov    0x8(%eax),%edx
+80105099:	8b 40 04             	mov    0x4(%eax),%eax
+8010509c:	89 41 38             	mov    %eax,0x38(%ecx)
+8010509f:	89 51 3c             	mov    %edx,0x3c(%ecx)
+  }
+  TRACE(TRACE_RUNQUEUE, "removed|[%d]%d\n", p->pid, p->max_level);
+801050a2:	f6 05 00 a0 10 80 01 	testb  $0x1,0x8010a000
+801050a9:	75 1b                	jne    801050c6 <unlink_node+0x94>
+  p->max_level = -1;
+801050ab:	c7 83 d0 00 00 00 ff 	movl   $0xffffffff,0xd0(%ebx)
+801050b2:	ff ff ff 
+  p->runqueue = NULL;
+801050b5:	c7 83 34 01 00 00 00 	movl   $0x0,0x134(%ebx)
+801050bc:	00 00 00 
+}
+801050bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801050c2:	5b                   	pop    %ebx
+801050c3:	5e                   	pop    %esi
+801050c4:	5d                   	pop    %ebp
+801050c5:	c3                   	ret
+  TRACE(TRACE_RUNQUEUE, "removed|[%d]%d\n", p->pid, p->max_level);
+801050c6:	83 ec 04             	sub    $0x4,%esp
+801050c9:	ff b3 d0 00 00 00    	push   0xd0(%ebx)
+801050cf:	ff 73 10             	push   0x10(%ebx)
+801050d2:	68 f5 8c 10 80       	push   $0x80108cf5
+801050d7:	e8 53 b5 ff ff       	call   8010062f <cprintf>
+801050dc:	83 c4 10             	add    $0x10,%esp
+801050df:	eb ca                	jmp    801050ab <unlink_node+0x79>
+
+801050e1 <randomize_max_level>:
+static int randomize_max_level(struct skiplist * skiplist) {
+801050e1:	55                   	push   %ebp
+801050e2:	89 e5                	mov    %esp,%ebp
+801050e4:	53                   	push   %ebx
+801050e5:	83 ec 04             	sub    $0x4,%esp
+801050e8:	89 c3                	mov    %eax,%ebx
+  int insertion_max_level = __builtin_ctz(random(skiplist)) / 2;
+801050ea:	e8 25 ff ff ff       	call   80105014 <random>
+801050ef:	31 d2                	xor    %edx,%edx
+801050f1:	f3 0f bc d0          	tzcnt  %eax,%edx
+801050f5:	89 d0                	mov    %edx,%eax
+801050f7:	c1 e8 1f             	shr    $0x1f,%eax
+801050fa:	01 d0                	add    %edx,%eax
+801050fc:	d1 f8                	sar    %eax
+801050fe:	89 c2                	mov    %eax,%edx
+  if (insertion_max_level > skiplist->levels - 1) {
+80105100:	8b 4b 40             	mov    0x40(%ebx),%ecx
+80105103:	39 c1                	cmp    %eax,%ecx
+80105105:	7f 03                	jg     8010510a <randomize_max_level+0x29>
+    insertion_max_level = skiplist->levels - 1;
+80105107:	8d 51 ff             	lea    -0x1(%ecx),%edx
+}
+8010510a:	89 d0                	mov    %edx,%eax
+8010510c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010510f:	c9                   	leave
+80105110:	c3                   	ret
+
+80105111 <init_skiplist>:
+void init_skiplist(struct skiplist * skiplist) {
+80105111:	55                   	push   %ebp
+80105112:	89 e5                	mov    %esp,%ebp
+80105114:	57                   	push   %edi
+80105115:	56                   	push   %esi
+80105116:	53                   	push   %ebx
+80105117:	83 ec 14             	sub    $0x14,%esp
+8010511a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&skiplist->lock, "runqueue");
+8010511d:	68 05 8d 10 80       	push   $0x80108d05
+80105122:	53                   	push   %ebx
+80105123:	e8 49 04 00 00       	call   80105571 <initlock>
+  skiplist->levels = SKIPLIST_LEVELS;
+80105128:	c7 43 40 04 00 00 00 	movl   $0x4,0x40(%ebx)
+  skiplist->size = 0;
+8010512f:	c7 43 34 00 00 00 00 	movl   $0x0,0x34(%ebx)
+  skiplist->min_deadline = 0;
+80105136:	c7 43 38 00 00 00 00 	movl   $0x0,0x38(%ebx)
+8010513d:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  skiplist->seed = 2463534242U + 0x9E3779B9U * nskiplists++;
+80105144:	a1 60 18 15 80       	mov    0x80151860,%eax
+80105149:	8d 50 01             	lea    0x1(%eax),%edx
+8010514c:	89 15 60 18 15 80    	mov    %edx,0x80151860
+80105152:	69 c0 b9 79 37 9e    	imul   $0x9e3779b9,%eax,%eax
+80105158:	2d 5e 73 29 6d       	sub    $0x6d29735e,%eax
+8010515d:	89 43 44             	mov    %eax,0x44(%ebx)
+  for (int i = 0; i < SKIPLIST_LEVELS; i++) {
+80105160:	83 c4 10             	add    $0x10,%esp
+80105163:	b8 00 00 00 00       	mov    $0x0,%eax
+80105168:	eb 24                	jmp    8010518e <init_skiplist+0x7d>
+    skiplist->headers[i].forward = (i > 0) ? &skiplist->headers[i-1] : NULL;
+8010516a:	bf 00 00 00 00       	mov    $0x0,%edi
+8010516f:	8d 14 00             	lea    (%eax,%eax,1),%edx
+80105172:	8d 34 02             	lea    (%edx,%eax,1),%esi
+80105175:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+8010517c:	89 7c 0b 5c          	mov    %edi,0x5c(%ebx,%ecx,1)
+    skiplist->tails[i] = &skiplist->headers[i];
+80105180:	8d 54 0b 48          	lea    0x48(%ebx,%ecx,1),%edx
+80105184:	89 94 83 a8 00 00 00 	mov    %edx,0xa8(%ebx,%eax,4)
+  for (int i = 0; i < SKIPLIST_LEVELS; i++) {
+8010518b:	83 c0 01             	add    $0x1,%eax
+8010518e:	83 f8 03             	cmp    $0x3,%eax
+80105191:	7f 46                	jg     801051d9 <init_skiplist+0xc8>
+    skiplist->headers[i].proc = NULL;
+80105193:	8d 0c 00             	lea    (%eax,%eax,1),%ecx
+80105196:	01 c1                	add    %eax,%ecx
+80105198:	8d 14 cd 00 00 00 00 	lea    0x0(,%ecx,8),%edx
+8010519f:	01 da                	add    %ebx,%edx
+801051a1:	c7 42 48 00 00 00 00 	movl   $0x0,0x48(%edx)
+    skiplist->headers[i].virtual_deadline = 0;
+801051a8:	c7 42 4c 00 00 00 00 	movl   $0x0,0x4c(%edx)
+801051af:	c7 42 50 00 00 00 00 	movl   $0x0,0x50(%edx)
+    skiplist->headers[i].next = NULL;
+801051b6:	c7 42 58 00 00 00 00 	movl   $0x0,0x58(%edx)
+    skiplist->headers[i].prev = NULL;
+801051bd:	c7 42 54 00 00 00 00 	movl   $0x0,0x54(%edx)
+    skiplist->headers[i].forward = (i > 0) ? &skiplist->headers[i-1] : NULL;
+801051c4:	85 c0                	test   %eax,%eax
+801051c6:	7e a2                	jle    8010516a <init_skiplist+0x59>
+801051c8:	8d 4c 40 fd          	lea    -0x3(%eax,%eax,2),%ecx
+801051cc:	8d 14 cd 00 00 00 00 	lea    0x0(,%ecx,8),%edx
+801051d3:	8d 7c 13 48          	lea    0x48(%ebx,%edx,1),%edi
+801051d7:	eb 96                	jmp    8010516f <init_skiplist+0x5e>
+}
+801051d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801051dc:	5b                   	pop    %ebx
+801051dd:	5e                   	pop    %esi
+801051de:	5f                   	pop    %edi
+801051df:	5d                   	pop    %ebp
+801051e0:	c3                   	ret
+
+801051e1 <print_skiplist>:
+void print_skiplist(struct skiplist * skiplist) {
+801051e1:	55                   	push   %ebp
+801051e2:	89 e5                	mov    %esp,%ebp
+801051e4:	57                   	push   %edi
+801051e5:	56                   	push   %esi
+801051e6:	53                   	push   %ebx
+801051e7:	83 ec 0c             	sub    $0xc,%esp
+801051ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int current_level = skiplist->levels - 1;
+801051ed:	8b 47 40             	mov    0x40(%edi),%eax
+801051f0:	8d 70 ff             	lea    -0x1(%eax),%esi
+  while (current_level >= 0) {
+801051f3:	eb 3f                	jmp    80105234 <print_skiplist+0x53>
+      cprintf("%d(pid:%d) -> ", (uint)current_node->virtual_deadline, current_node->proc ? current_node->proc->pid : -1);
+801051f5:	8b 50 10             	mov    0x10(%eax),%edx
+801051f8:	8b 43 04             	mov    0x4(%ebx),%eax
+801051fb:	83 ec 04             	sub    $0x4,%esp
+801051fe:	52                   	push   %edx
+801051ff:	50                   	push   %eax
+80105200:	68 19 8d 10 80       	push   $0x80108d19
+80105205:	e8 25 b4 ff ff       	call   8010062f <cprintf>
+      current_node = current_node->next;
+8010520a:	8b 5b 10             	mov    0x10(%ebx),%ebx
+8010520d:	83 c4 10             	add    $0x10,%esp
+    while (current_node != NULL) {
+80105210:	85 db                	test   %ebx,%ebx
+80105212:	74 0d                	je     80105221 <print_skiplist+0x40>
+      cprintf("%d(pid:%d) -> ", (uint)current_node->virtual_deadline, current_node->proc ? current_node->proc->pid : -1);
+80105214:	8b 03                	mov    (%ebx),%eax
+80105216:	85 c0                	test   %eax,%eax
+80105218:	75 db                	jne    801051f5 <print_skiplist+0x14>
+8010521a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010521f:	eb d7                	jmp    801051f8 <print_skiplist+0x17>
+    cprintf("\n");
+80105221:	83 ec 0c             	sub    $0xc,%esp
+80105224:	68 6f 90 10 80       	push   $0x8010906f
+80105229:	e8 01 b4 ff ff       	call   8010062f <cprintf>
+    current_level--;
+8010522e:	83 ee 01             	sub    $0x1,%esi
+80105231:	83 c4 10             	add    $0x10,%esp
+  while (current_level >= 0) {
+80105234:	85 f6                	test   %esi,%esi
+80105236:	78 21                	js     80105259 <print_skiplist+0x78>
+    struct node * current_node = &skiplist->headers[current_level];
+80105238:	8d 14 76             	lea    (%esi,%esi,2),%edx
+8010523b:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+80105242:	8d 5c 07 48          	lea    0x48(%edi,%eax,1),%ebx
+    cprintf("level %d: ", current_level);
+80105246:	83 ec 08             	sub    $0x8,%esp
+80105249:	56                   	push   %esi
+8010524a:	68 0e 8d 10 80       	push   $0x80108d0e
+8010524f:	e8 db b3 ff ff       	call   8010062f <cprintf>
+    while (current_node != NULL) {
+80105254:	83 c4 10             	add    $0x10,%esp
+80105257:	eb b7                	jmp    80105210 <print_skiplist+0x2f>
+}
+80105259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010525c:	5b                   	pop    %ebx
+8010525d:	5e                   	pop    %esi
+8010525e:	5f                   	pop    %edi
+8010525f:	5d                   	pop    %ebp
+80105260:	c3                   	ret
+
+80105261 <insert_node>:
+void insert_node(struct skiplist * skiplist, struct proc * p) {
+80105261:	55                   	push   %ebp
+80105262:	89 e5                	mov    %esp,%ebp
+80105264:	57                   	push   %edi
+80105265:	56                   	push   %esi
+80105266:	53                   	push   %ebx
+80105267:	83 ec 1c             	sub    $0x1c,%esp
+8010526a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  p->max_level = randomize_max_level(skiplist);
+8010526d:	8b 45 08             	mov    0x8(%ebp),%eax
+80105270:	e8 6c fe ff ff       	call   801050e1 <randomize_max_level>
+80105275:	89 83 d0 00 00 00    	mov    %eax,0xd0(%ebx)
+  struct node * prev_nodes[p->max_level + 1];
+8010527b:	8d 04 85 13 00 00 00 	lea    0x13(,%eax,4),%eax
+80105282:	83 e0 f0             	and    $0xfffffff0,%eax
+80105285:	29 c4                	sub    %eax,%esp
+80105287:	89 65 e0             	mov    %esp,-0x20(%ebp)
+  int current_level = skiplist->levels - 1;
+8010528a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010528d:	8b 40 40             	mov    0x40(%eax),%eax
+80105290:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105293:	8d 70 ff             	lea    -0x1(%eax),%esi
+  struct node * current_node = &skiplist->headers[current_level];
+80105296:	8d 04 76             	lea    (%esi,%esi,2),%eax
+80105299:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010529c:	8d 44 c1 48          	lea    0x48(%ecx,%eax,8),%eax
+  struct node * last = skiplist->tails[0];
+801052a0:	8b 91 a8 00 00 00    	mov    0xa8(%ecx),%edx
+  if (last == &skiplist->headers[0] || p->virtual_deadline >= last->virtual_deadline) {
+801052a6:	83 c1 48             	add    $0x48,%ecx
+801052a9:	39 d1                	cmp    %edx,%ecx
+801052ab:	74 39                	je     801052e6 <insert_node+0x85>
+801052ad:	8b 8b cc 00 00 00    	mov    0xcc(%ebx),%ecx
+801052b3:	8b 7a 08             	mov    0x8(%edx),%edi
+801052b6:	8b 52 04             	mov    0x4(%edx),%edx
+801052b9:	39 93 c8 00 00 00    	cmp    %edx,0xc8(%ebx)
+801052bf:	19 f9                	sbb    %edi,%ecx
+801052c1:	73 30                	jae    801052f3 <insert_node+0x92>
+801052c3:	89 e7                	mov    %esp,%edi
+801052c5:	eb 4d                	jmp    80105314 <insert_node+0xb3>
+      prev_nodes[current_level] = skiplist->tails[current_level];
+801052c7:	8b 8c 96 a8 00 00 00 	mov    0xa8(%esi,%edx,4),%ecx
+801052ce:	89 0c 97             	mov    %ecx,(%edi,%edx,4)
+    for (current_level = 0; current_level <= p->max_level; current_level++) {
+801052d1:	83 c2 01             	add    $0x1,%edx
+801052d4:	39 93 d0 00 00 00    	cmp    %edx,0xd0(%ebx)
+801052da:	7d eb                	jge    801052c7 <insert_node+0x66>
+    current_level = -1;
+801052dc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801052e1:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801052e4:	eb 2e                	jmp    80105314 <insert_node+0xb3>
+801052e6:	ba 00 00 00 00       	mov    $0x0,%edx
+801052eb:	8b 75 08             	mov    0x8(%ebp),%esi
+801052ee:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801052f1:	eb e1                	jmp    801052d4 <insert_node+0x73>
+801052f3:	ba 00 00 00 00       	mov    $0x0,%edx
+801052f8:	8b 75 08             	mov    0x8(%ebp),%esi
+801052fb:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801052fe:	eb d4                	jmp    801052d4 <insert_node+0x73>
+    if (p->max_level >= current_level) {
+80105300:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80105303:	39 b3 d0 00 00 00    	cmp    %esi,0xd0(%ebx)
+80105309:	7c 03                	jl     8010530e <insert_node+0xad>
+      prev_nodes[current_level] = current_node;
+8010530b:	89 0c b7             	mov    %ecx,(%edi,%esi,4)
+    current_node = current_node->forward;
+8010530e:	8b 41 14             	mov    0x14(%ecx),%eax
+    current_level--;
+80105311:	83 ee 01             	sub    $0x1,%esi
+  while (current_level >= 0) {
+80105314:	85 f6                	test   %esi,%esi
+80105316:	78 22                	js     8010533a <insert_node+0xd9>
+80105318:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    while (current_node->next != NULL && p->virtual_deadline >= current_node->next->virtual_deadline) {
+8010531b:	89 c1                	mov    %eax,%ecx
+8010531d:	8b 40 10             	mov    0x10(%eax),%eax
+80105320:	85 c0                	test   %eax,%eax
+80105322:	74 dc                	je     80105300 <insert_node+0x9f>
+80105324:	8b 93 cc 00 00 00    	mov    0xcc(%ebx),%edx
+8010532a:	8b 70 04             	mov    0x4(%eax),%esi
+8010532d:	39 b3 c8 00 00 00    	cmp    %esi,0xc8(%ebx)
+80105333:	1b 50 08             	sbb    0x8(%eax),%edx
+80105336:	73 e3                	jae    8010531b <insert_node+0xba>
+80105338:	eb c6                	jmp    80105300 <insert_node+0x9f>
+  struct node * forward = NULL;
+8010533a:	b8 00 00 00 00       	mov    $0x0,%eax
+  current_level = 0;
+8010533f:	bf 00 00 00 00       	mov    $0x0,%edi
+80105344:	eb 06                	jmp    8010534c <insert_node+0xeb>
+    current_level++;
+80105346:	83 c7 01             	add    $0x1,%edi
+    forward = &p->nodes[current_level];
+80105349:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  while (current_level <= p->max_level) {
+8010534c:	39 bb d0 00 00 00    	cmp    %edi,0xd0(%ebx)
+80105352:	7c 4b                	jl     8010539f <insert_node+0x13e>
+    insert_to_level(&p->nodes[current_level], p, p->virtual_deadline, prev_nodes[current_level], forward);
+80105354:	8d 34 3f             	lea    (%edi,%edi,1),%esi
+80105357:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+8010535a:	8d 8c d3 d4 00 00 00 	lea    0xd4(%ebx,%edx,8),%ecx
+80105361:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80105364:	50                   	push   %eax
+80105365:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80105368:	ff 34 b8             	push   (%eax,%edi,4)
+8010536b:	ff b3 cc 00 00 00    	push   0xcc(%ebx)
+80105371:	ff b3 c8 00 00 00    	push   0xc8(%ebx)
+80105377:	89 da                	mov    %ebx,%edx
+80105379:	89 c8                	mov    %ecx,%eax
+8010537b:	e8 5f fc ff ff       	call   80104fdf <insert_to_level>
+    if (forward->next == NULL) {
+80105380:	8d 04 3e             	lea    (%esi,%edi,1),%eax
+80105383:	83 c4 10             	add    $0x10,%esp
+80105386:	83 bc c3 e4 00 00 00 	cmpl   $0x0,0xe4(%ebx,%eax,8)
+8010538d:	00 
+8010538e:	75 b6                	jne    80105346 <insert_node+0xe5>
+      skiplist->tails[current_level] = forward;
+80105390:	8b 45 08             	mov    0x8(%ebp),%eax
+80105393:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105396:	89 8c b8 a8 00 00 00 	mov    %ecx,0xa8(%eax,%edi,4)
+8010539d:	eb a7                	jmp    80105346 <insert_node+0xe5>
+  p->runqueue = skiplist;
+8010539f:	8b 45 08             	mov    0x8(%ebp),%eax
+801053a2:	89 83 34 01 00 00    	mov    %eax,0x134(%ebx)
+  skiplist->size++;
+801053a8:	8b 40 34             	mov    0x34(%eax),%eax
+801053ab:	83 c0 01             	add    $0x1,%eax
+801053ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+801053b1:	89 47 34             	mov    %eax,0x34(%edi)
+  skiplist->min_deadline = skiplist->headers[0].next->virtual_deadline;
+801053b4:	8b 47 58             	mov    0x58(%edi),%eax
+801053b7:	8b 50 08             	mov    0x8(%eax),%edx
+801053ba:	8b 40 04             	mov    0x4(%eax),%eax
+801053bd:	89 47 38             	mov    %eax,0x38(%edi)
+801053c0:	89 57 3c             	mov    %edx,0x3c(%edi)
+  TRACE(TRACE_RUNQUEUE, "inserted|[%d]%d\n", p->pid, p->max_level);
+801053c3:	f6 05 00 a0 10 80 01 	testb  $0x1,0x8010a000
+801053ca:	75 08                	jne    801053d4 <insert_node+0x173>
+}
+801053cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801053cf:	5b                   	pop    %ebx
+801053d0:	5e                   	pop    %esi
+801053d1:	5f                   	pop    %edi
+801053d2:	5d                   	pop    %ebp
+801053d3:	c3                   	ret
+  TRACE(TRACE_RUNQUEUE, "inserted|[%d]%d\n", p->pid, p->max_level);
+801053d4:	83 ec 04             	sub    $0x4,%esp
+801053d7:	ff b3 d0 00 00 00    	push   0xd0(%ebx)
+801053dd:	ff 73 10             	push   0x10(%ebx)
+801053e0:	68 28 8d 10 80       	push   $0x80108d28
+801053e5:	e8 45 b2 ff ff       	call   8010062f <cprintf>
+801053ea:	83 c4 10             	add    $0x10,%esp
+}
+801053ed:	eb dd                	jmp    801053cc <insert_node+0x16b>
+
+801053ef <delete_node>:
+
+void delete_node(struct skiplist * skiplist, struct proc * p) {
+801053ef:	55                   	push   %ebp
+801053f0:	89 e5                	mov    %esp,%ebp
+801053f2:	83 ec 08             	sub    $0x8,%esp
+801053f5:	8b 45 08             	mov    0x8(%ebp),%eax
+801053f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if (p->runqueue == skiplist) {
+801053fb:	39 82 34 01 00 00    	cmp    %eax,0x134(%edx)
+80105401:	74 02                	je     80105405 <delete_node+0x16>
+    unlink_node(skiplist, p);
+  }
+}
+80105403:	c9                   	leave
+80105404:	c3                   	ret
+    unlink_node(skiplist, p);
+80105405:	e8 28 fc ff ff       	call   80105032 <unlink_node>
+}
+8010540a:	eb f7                	jmp    80105403 <delete_node+0x14>
+
+8010540c <get_minimum>:
+
+// Return the process with the earliest virtual deadline,
+// or NULL if the skip list is empty.
+struct proc * get_minimum(struct skiplist * skiplist) {
+8010540c:	55                   	push   %ebp
+8010540d:	89 e5                	mov    %esp,%ebp
+  if (skiplist->headers[0].next != NULL) {
+8010540f:	8b 45 08             	mov    0x8(%ebp),%eax
+80105412:	8b 40 58             	mov    0x58(%eax),%eax
+80105415:	85 c0                	test   %eax,%eax
+80105417:	74 02                	je     8010541b <get_minimum+0xf>
+    return skiplist->headers[0].next->proc;
+80105419:	8b 00                	mov    (%eax),%eax
+  }
+  return NULL;
+}
+8010541b:	5d                   	pop    %ebp
+8010541c:	c3                   	ret
+
+8010541d <pop_min>:
+
+// Remove and return the process with the earliest virtual deadline,
+// or NULL if the skip list is empty.  It is first on every level it
+// occupies, so this is O(1) in the size of the list.
+struct proc * pop_min(struct skiplist * skiplist) {
+8010541d:	55                   	push   %ebp
+8010541e:	89 e5                	mov    %esp,%ebp
+80105420:	53                   	push   %ebx
+80105421:	83 ec 04             	sub    $0x4,%esp
+80105424:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct proc * p;
+
+  if (skiplist->headers[0].next == NULL) {
+80105427:	8b 58 58             	mov    0x58(%eax),%ebx
+8010542a:	85 db                	test   %ebx,%ebx
+8010542c:	74 09                	je     80105437 <pop_min+0x1a>
+    return NULL;
+  }
+  p = skiplist->headers[0].next->proc;
+8010542e:	8b 1b                	mov    (%ebx),%ebx
+  unlink_node(skiplist, p);
+80105430:	89 da                	mov    %ebx,%edx
+80105432:	e8 fb fb ff ff       	call   80105032 <unlink_node>
+  return p;
+80105437:	89 d8                	mov    %ebx,%eax
+80105439:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010543c:	c9                   	leave
+8010543d:	c3                   	ret
+
+8010543e <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+8010543e:	55                   	push   %ebp
+8010543f:	89 e5                	mov    %esp,%ebp
+80105441:	53                   	push   %ebx
+80105442:	83 ec 0c             	sub    $0xc,%esp
+80105445:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+80105448:	68 39 8d 10 80       	push   $0x80108d39
+8010544d:	8d 43 04             	lea    0x4(%ebx),%eax
+80105450:	50                   	push   %eax
+80105451:	e8 1b 01 00 00       	call   80105571 <initlock>
+  lk->name = name;
+80105456:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105459:	89 43 38             	mov    %eax,0x38(%ebx)
+  lk->locked = 0;
+8010545c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+80105462:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+}
+80105469:	83 c4 10             	add    $0x10,%esp
+8010546c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010546f:	c9                   	leave
+80105470:	c3                   	ret
+
+80105471 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80105471:	55                   	push   %ebp
+80105472:	89 e5                	mov    %esp,%ebp
+80105474:	56                   	push   %esi
+80105475:	53                   	push   %ebx
+80105476:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80105479:	8d 73 04             	lea    0x4(%ebx),%esi
+8010547c:	83 ec 0c             	sub    $0xc,%esp
+8010547f:	56                   	push   %esi
+80105480:	e8 30 02 00 00       	call   801056b5 <acquire>
+  while (lk->locked) {
+80105485:	83 c4 10             	add    $0x10,%esp
+80105488:	eb 0d                	jmp    80105497 <acquiresleep+0x26>
+    sleep(lk, &lk->lk);
+8010548a:	83 ec 08             	sub    $0x8,%esp
+8010548d:	56                   	push   %esi
+8010548e:	53                   	push   %ebx
+8010548f:	e8 75 f2 ff ff       	call   80104709 <sleep>
+80105494:	83 c4 10             	add    $0x10,%esp
+  while (lk->locked) {
+80105497:	83 3b 00             	cmpl   $0x0,(%ebx)
+8010549a:	75 ee                	jne    8010548a <acquiresleep+0x19>
+  }
+  lk->locked = 1;
+8010549c:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+801054a2:	e8 27 eb ff ff       	call   80103fce <myproc>
+801054a7:	8b 40 10             	mov    0x10(%eax),%eax
+801054aa:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  myproc()->nsleeplocks++;
+801054ad:	e8 1c eb ff ff       	call   80103fce <myproc>
+801054b2:	8b 88 c4 00 00 00    	mov    0xc4(%eax),%ecx
+801054b8:	8d 51 01             	lea    0x1(%ecx),%edx
+801054bb:	89 90 c4 00 00 00    	mov    %edx,0xc4(%eax)
+  release(&lk->lk);
+801054c1:	83 ec 0c             	sub    $0xc,%esp
+801054c4:	56                   	push   %esi
+801054c5:	e8 50 02 00 00       	call   8010571a <release>
+}
+801054ca:	83 c4 10             	add    $0x10,%esp
+801054cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801054d0:	5b                   	pop    %ebx
+801054d1:	5e                   	pop    %esi
+801054d2:	5d                   	pop    %ebp
+801054d3:	c3                   	ret
+
+801054d4 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+801054d4:	55                   	push   %ebp
+801054d5:	89 e5                	mov    %esp,%ebp
+801054d7:	56                   	push   %esi
+801054d8:	53                   	push   %ebx
+801054d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+801054dc:	8d 73 04             	lea    0x4(%ebx),%esi
+801054df:	83 ec 0c             	sub    $0xc,%esp
+801054e2:	56                   	push   %esi
+801054e3:	e8 cd 01 00 00       	call   801056b5 <acquire>
+  lk->locked = 0;
+801054e8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+801054ee:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  myproc()->nsleeplocks--;
+801054f5:	e8 d4 ea ff ff       	call   80103fce <myproc>
+801054fa:	8b 88 c4 00 00 00    	mov    0xc4(%eax),%ecx
+80105500:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80105503:	89 90 c4 00 00 00    	mov    %edx,0xc4(%eax)
+  wakeup(lk);
+80105509:	89 1c 24             	mov    %ebx,(%esp)
+8010550c:	e8 8b f3 ff ff       	call   8010489c <wakeup>
+  release(&lk->lk);
+80105511:	89 34 24             	mov    %esi,(%esp)
+80105514:	e8 01 02 00 00       	call   8010571a <release>
+}
+80105519:	83 c4 10             	add    $0x10,%esp
+8010551c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010551f:	5b                   	pop    %ebx
+80105520:	5e                   	pop    %esi
+80105521:	5d                   	pop    %ebp
+80105522:	c3                   	ret
+
+80105523 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80105523:	55                   	push   %ebp
+80105524:	89 e5                	mov    %esp,%ebp
+80105526:	56                   	push   %esi
+80105527:	53                   	push   %ebx
+80105528:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+8010552b:	8d 73 04             	lea    0x4(%ebx),%esi
+8010552e:	83 ec 0c             	sub    $0xc,%esp
+80105531:	56                   	push   %esi
+80105532:	e8 7e 01 00 00       	call   801056b5 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+80105537:	83 c4 10             	add    $0x10,%esp
+8010553a:	83 3b 00             	cmpl   $0x0,(%ebx)
+8010553d:	75 17                	jne    80105556 <holdingsleep+0x33>
+8010553f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  release(&lk->lk);
+80105544:	83 ec 0c             	sub    $0xc,%esp
+80105547:	56                   	push   %esi
+80105548:	e8 cd 01 00 00       	call   8010571a <release>
+  return r;
+}
+8010554d:	89 d8                	mov    %ebx,%eax
+8010554f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105552:	5b                   	pop    %ebx
+80105553:	5e                   	pop    %esi
+80105554:	5d                   	pop    %ebp
+80105555:	c3                   	ret
+  r = lk->locked && (lk->pid == myproc()->pid);
+80105556:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+80105559:	e8 70 ea ff ff       	call   80103fce <myproc>
+8010555e:	3b 58 10             	cmp    0x10(%eax),%ebx
+80105561:	74 07                	je     8010556a <holdingsleep+0x47>
+80105563:	bb 00 00 00 00       	mov    $0x0,%ebx
+80105568:	eb da                	jmp    80105544 <holdingsleep+0x21>
+8010556a:	bb 01 00 00 00       	mov    $0x1,%ebx
+8010556f:	eb d3                	jmp    80105544 <holdingsleep+0x21>
+
+80105571 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80105571:	55                   	push   %ebp
+80105572:	89 e5                	mov    %esp,%ebp
+80105574:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80105577:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010557a:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->locked = 0;
+8010557d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->cpu = 0;
+80105583:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+8010558a:	5d                   	pop    %ebp
+8010558b:	c3                   	ret
+
+8010558c <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+8010558c:	55                   	push   %ebp
+8010558d:	89 e5                	mov    %esp,%ebp
+8010558f:	53                   	push   %ebx
+80105590:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80105593:	8b 45 08             	mov    0x8(%ebp),%eax
+80105596:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+80105599:	b8 00 00 00 00       	mov    $0x0,%eax
+8010559e:	83 f8 09             	cmp    $0x9,%eax
+801055a1:	7f 25                	jg     801055c8 <getcallerpcs+0x3c>
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801055a3:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+801055a9:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+801055af:	77 17                	ja     801055c8 <getcallerpcs+0x3c>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+801055b1:	8b 5a 04             	mov    0x4(%edx),%ebx
+801055b4:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+    ebp = (uint*)ebp[0]; // saved %ebp
+801055b7:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+801055b9:	83 c0 01             	add    $0x1,%eax
+801055bc:	eb e0                	jmp    8010559e <getcallerpcs+0x12>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+801055be:	c7 04 81 00 00 00 00 	movl   $0x0,(%ecx,%eax,4)
+  for(; i < 10; i++)
+801055c5:	83 c0 01             	add    $0x1,%eax
+801055c8:	83 f8 09             	cmp    $0x9,%eax
+801055cb:	7e f1                	jle    801055be <getcallerpcs+0x32>
+}
+801055cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801055d0:	c9                   	leave
+801055d1:	c3                   	ret
+
+801055d2 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+801055d2:	55                   	push   %ebp
+801055d3:	89 e5                	mov    %esp,%ebp
+801055d5:	53                   	push   %ebx
+801055d6:	83 ec 04             	sub    $0x4,%esp
+801055d9:	9c                   	pushf
+801055da:	5b                   	pop    %ebx
+  asm volatile("cli");
+801055db:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+801055dc:	e8 22 e6 ff ff       	call   80103c03 <mycpu>
+801055e1:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+801055e8:	74 19                	je     80105603 <pushcli+0x31>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+801055ea:	e8 14 e6 ff ff       	call   80103c03 <mycpu>
+801055ef:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+801055f5:	8d 51 01             	lea    0x1(%ecx),%edx
+801055f8:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+}
+801055fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105601:	c9                   	leave
+80105602:	c3                   	ret
+    mycpu()->intena = eflags & FL_IF;
+80105603:	e8 fb e5 ff ff       	call   80103c03 <mycpu>
+80105608:	81 e3 00 02 00 00    	and    $0x200,%ebx
+8010560e:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80105614:	eb d4                	jmp    801055ea <pushcli+0x18>
+
+80105616 <popcli>:
+
+void
+popcli(void)
+{
+80105616:	55                   	push   %ebp
+80105617:	89 e5                	mov    %esp,%ebp
+80105619:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+8010561c:	9c                   	pushf
+8010561d:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+8010561e:	f6 c4 02             	test   $0x2,%ah
+80105621:	75 28                	jne    8010564b <popcli+0x35>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80105623:	e8 db e5 ff ff       	call   80103c03 <mycpu>
+80105628:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+8010562e:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80105631:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+80105637:	85 d2                	test   %edx,%edx
+80105639:	78 1d                	js     80105658 <popcli+0x42>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+8010563b:	e8 c3 e5 ff ff       	call   80103c03 <mycpu>
+80105640:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+80105647:	74 1c                	je     80105665 <popcli+0x4f>
+    sti();
+}
+80105649:	c9                   	leave
+8010564a:	c3                   	ret
+    panic("popcli - interruptible");
+8010564b:	83 ec 0c             	sub    $0xc,%esp
+8010564e:	68 44 8d 10 80       	push   $0x80108d44
+80105653:	e8 16 ad ff ff       	call   8010036e <panic>
+    panic("popcli");
+80105658:	83 ec 0c             	sub    $0xc,%esp
+8010565b:	68 5b 8d 10 80       	push   $0x80108d5b
+80105660:	e8 09 ad ff ff       	call   8010036e <panic>
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80105665:	e8 99 e5 ff ff       	call   80103c03 <mycpu>
+8010566a:	83 b8 a8 00 00 00 00 	cmpl   $0x0,0xa8(%eax)
+80105671:	74 d6                	je     80105649 <popcli+0x33>
+  asm volatile("sti");
+80105673:	fb                   	sti
+}
+80105674:	eb d3                	jmp    80105649 <popcli+0x33>
+
+80105676 <holding>:
+{
+80105676:	55                   	push   %ebp
+80105677:	89 e5                	mov    %esp,%ebp
+80105679:	53                   	push   %ebx
+8010567a:	83 ec 04             	sub    $0x4,%esp
+8010567d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80105680:	e8 4d ff ff ff       	call   801055d2 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80105685:	83 3b 00             	cmpl   $0x0,(%ebx)
+80105688:	75 11                	jne    8010569b <holding+0x25>
+8010568a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  popcli();
+8010568f:	e8 82 ff ff ff       	call   80105616 <popcli>
+}
+80105694:	89 d8                	mov    %ebx,%eax
+80105696:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105699:	c9                   	leave
+8010569a:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+8010569b:	8b 5b 08             	mov    0x8(%ebx),%ebx
+8010569e:	e8 60 e5 ff ff       	call   80103c03 <mycpu>
+801056a3:	39 c3                	cmp    %eax,%ebx
+801056a5:	74 07                	je     801056ae <holding+0x38>
+801056a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+801056ac:	eb e1                	jmp    8010568f <holding+0x19>
+801056ae:	bb 01 00 00 00       	mov    $0x1,%ebx
+801056b3:	eb da                	jmp    8010568f <holding+0x19>
+
+801056b5 <acquire>:
+{
+801056b5:	55                   	push   %ebp
+801056b6:	89 e5                	mov    %esp,%ebp
+801056b8:	53                   	push   %ebx
+801056b9:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+801056bc:	e8 11 ff ff ff       	call   801055d2 <pushcli>
+  if(holding(lk))
+801056c1:	83 ec 0c             	sub    $0xc,%esp
+801056c4:	ff 75 08             	push   0x8(%ebp)
+801056c7:	e8 aa ff ff ff       	call   80105676 <holding>
+801056cc:	83 c4 10             	add    $0x10,%esp
+801056cf:	85 c0                	test   %eax,%eax
+801056d1:	75 3a                	jne    8010570d <acquire+0x58>
+  while(xchg(&lk->locked, 1) != 0)
+801056d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("lock; xchgl %0, %1" :
+801056d6:	b8 01 00 00 00       	mov    $0x1,%eax
+801056db:	f0 87 02             	lock xchg %eax,(%edx)
+801056de:	85 c0                	test   %eax,%eax
+801056e0:	75 f1                	jne    801056d3 <acquire+0x1e>
+  __sync_synchronize();
+801056e2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+801056e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801056ea:	e8 14 e5 ff ff       	call   80103c03 <mycpu>
+801056ef:	89 43 08             	mov    %eax,0x8(%ebx)
+  getcallerpcs(&lk, lk->pcs);
+801056f2:	8b 45 08             	mov    0x8(%ebp),%eax
+801056f5:	83 c0 0c             	add    $0xc,%eax
+801056f8:	83 ec 08             	sub    $0x8,%esp
+801056fb:	50                   	push   %eax
+801056fc:	8d 45 08             	lea    0x8(%ebp),%eax
+801056ff:	50                   	push   %eax
+80105700:	e8 87 fe ff ff       	call   8010558c <getcallerpcs>
+}
+80105705:	83 c4 10             	add    $0x10,%esp
+80105708:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010570b:	c9                   	leave
+8010570c:	c3                   	ret
+    panic("acquire");
+8010570d:	83 ec 0c             	sub    $0xc,%esp
+80105710:	68 62 8d 10 80       	push   $0x80108d62
+80105715:	e8 54 ac ff ff       	call   8010036e <panic>
+
+8010571a <release>:
+{
+8010571a:	55                   	push   %ebp
+8010571b:	89 e5                	mov    %esp,%ebp
+8010571d:	53                   	push   %ebx
+8010571e:	83 ec 10             	sub    $0x10,%esp
+80105721:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holding(lk))
+80105724:	53                   	push   %ebx
+80105725:	e8 4c ff ff ff       	call   80105676 <holding>
+8010572a:	83 c4 10             	add    $0x10,%esp
+8010572d:	85 c0                	test   %eax,%eax
+8010572f:	74 23                	je     80105754 <release+0x3a>
+  lk->pcs[0] = 0;
+80105731:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80105738:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+8010573f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80105744:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  popcli();
+8010574a:	e8 c7 fe ff ff       	call   80105616 <popcli>
+}
+8010574f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105752:	c9                   	leave
+80105753:	c3                   	ret
+    panic("release");
+80105754:	83 ec 0c             	sub    $0xc,%esp
+80105757:	68 6a 8d 10 80       	push   $0x80108d6a
+8010575c:	e8 0d ac ff ff       	call   8010036e <panic>
+
+80105761 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80105761:	55                   	push   %ebp
+80105762:	89 e5                	mov    %esp,%ebp
+80105764:	57                   	push   %edi
+80105765:	53                   	push   %ebx
+80105766:	8b 55 08             	mov    0x8(%ebp),%edx
+80105769:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010576c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+8010576f:	f6 c2 03             	test   $0x3,%dl
+80105772:	75 25                	jne    80105799 <memset+0x38>
+80105774:	f6 c1 03             	test   $0x3,%cl
+80105777:	75 20                	jne    80105799 <memset+0x38>
+    c &= 0xFF;
+80105779:	0f b6 f8             	movzbl %al,%edi
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+8010577c:	c1 e9 02             	shr    $0x2,%ecx
+8010577f:	c1 e0 18             	shl    $0x18,%eax
+80105782:	89 fb                	mov    %edi,%ebx
+80105784:	c1 e3 10             	shl    $0x10,%ebx
+80105787:	09 d8                	or     %ebx,%eax
+80105789:	89 fb                	mov    %edi,%ebx
+8010578b:	c1 e3 08             	shl    $0x8,%ebx
+8010578e:	09 d8                	or     %ebx,%eax
+80105790:	09 f8                	or     %edi,%eax
+  asm volatile("cld; rep stosl" :
+80105792:	89 d7                	mov    %edx,%edi
+80105794:	fc                   	cld
+80105795:	f3 ab                	rep stos %eax,%es:(%edi)
+}
+80105797:	eb 05                	jmp    8010579e <memset+0x3d>
+  asm volatile("cld; rep stosb" :
+80105799:	89 d7                	mov    %edx,%edi
+8010579b:	fc                   	cld
+8010579c:	f3 aa                	rep stos %al,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+8010579e:	89 d0                	mov    %edx,%eax
+801057a0:	5b                   	pop    %ebx
+801057a1:	5f                   	pop    %edi
+801057a2:	5d                   	pop    %ebp
+801057a3:	c3                   	ret
+
+801057a4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+801057a4:	55                   	push   %ebp
+801057a5:	89 e5                	mov    %esp,%ebp
+801057a7:	56                   	push   %esi
+801057a8:	53                   	push   %ebx
+801057a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801057ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+801057af:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+801057b2:	eb 08                	jmp    801057bc <memcmp+0x18>
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+801057b4:	83 c1 01             	add    $0x1,%ecx
+801057b7:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+801057ba:	89 f0                	mov    %esi,%eax
+801057bc:	8d 70 ff             	lea    -0x1(%eax),%esi
+801057bf:	85 c0                	test   %eax,%eax
+801057c1:	74 12                	je     801057d5 <memcmp+0x31>
+    if(*s1 != *s2)
+801057c3:	0f b6 01             	movzbl (%ecx),%eax
+801057c6:	0f b6 1a             	movzbl (%edx),%ebx
+801057c9:	38 d8                	cmp    %bl,%al
+801057cb:	74 e7                	je     801057b4 <memcmp+0x10>
+      return *s1 - *s2;
+801057cd:	0f b6 c0             	movzbl %al,%eax
+801057d0:	0f b6 db             	movzbl %bl,%ebx
+801057d3:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+801057d5:	5b                   	pop    %ebx
+801057d6:	5e                   	pop    %esi
+801057d7:	5d                   	pop    %ebp
+801057d8:	c3                   	ret
+
+801057d9 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+801057d9:	55                   	push   %ebp
+801057da:	89 e5                	mov    %esp,%ebp
+801057dc:	56                   	push   %esi
+801057dd:	53                   	push   %ebx
+801057de:	8b 75 08             	mov    0x8(%ebp),%esi
+801057e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+801057e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+801057e7:	39 f2                	cmp    %esi,%edx
+801057e9:	73 3c                	jae    80105827 <memmove+0x4e>
+801057eb:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+801057ee:	39 ce                	cmp    %ecx,%esi
+801057f0:	73 39                	jae    8010582b <memmove+0x52>
+    s += n;
+    d += n;
+801057f2:	8d 14 06             	lea    (%esi,%eax,1),%edx
+    while(n-- > 0)
+801057f5:	eb 0d                	jmp    80105804 <memmove+0x2b>
+      *--d = *--s;
+801057f7:	83 e9 01             	sub    $0x1,%ecx
+801057fa:	83 ea 01             	sub    $0x1,%edx
+801057fd:	0f b6 01             	movzbl (%ecx),%eax
+80105800:	88 02                	mov    %al,(%edx)
+    while(n-- > 0)
+80105802:	89 d8                	mov    %ebx,%eax
+80105804:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80105807:	85 c0                	test   %eax,%eax
+80105809:	75 ec                	jne    801057f7 <memmove+0x1e>
+8010580b:	eb 14                	jmp    80105821 <memmove+0x48>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+8010580d:	0f b6 02             	movzbl (%edx),%eax
+80105810:	88 01                	mov    %al,(%ecx)
+80105812:	8d 49 01             	lea    0x1(%ecx),%ecx
+80105815:	8d 52 01             	lea    0x1(%edx),%edx
+    while(n-- > 0)
+80105818:	89 d8                	mov    %ebx,%eax
+8010581a:	8d 58 ff             	lea    -0x1(%eax),%ebx
+8010581d:	85 c0                	test   %eax,%eax
+8010581f:	75 ec                	jne    8010580d <memmove+0x34>
+
+  return dst;
+}
+80105821:	89 f0                	mov    %esi,%eax
+80105823:	5b                   	pop    %ebx
+80105824:	5e                   	pop    %esi
+80105825:	5d                   	pop    %ebp
+80105826:	c3                   	ret
+80105827:	89 f1                	mov    %esi,%ecx
+80105829:	eb ef                	jmp    8010581a <memmove+0x41>
+8010582b:	89 f1                	mov    %esi,%ecx
+8010582d:	eb eb                	jmp    8010581a <memmove+0x41>
+
+8010582f <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+8010582f:	55                   	push   %ebp
+80105830:	89 e5                	mov    %esp,%ebp
+80105832:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+80105835:	ff 75 10             	push   0x10(%ebp)
+80105838:	ff 75 0c             	push   0xc(%ebp)
+8010583b:	ff 75 08             	push   0x8(%ebp)
+8010583e:	e8 96 ff ff ff       	call   801057d9 <memmove>
+}
+80105843:	c9                   	leave
+80105844:	c3                   	ret
+
+80105845 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80105845:	55                   	push   %ebp
+80105846:	89 e5                	mov    %esp,%ebp
+80105848:	53                   	push   %ebx
+80105849:	8b 55 08             	mov    0x8(%ebp),%edx
+8010584c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010584f:	8b 45 10             	mov    0x10(%ebp),%eax
+  while(n > 0 && *p && *p == *q)
+80105852:	eb 09                	jmp    8010585d <strncmp+0x18>
+    n--, p++, q++;
+80105854:	83 e8 01             	sub    $0x1,%eax
+80105857:	83 c2 01             	add    $0x1,%edx
+8010585a:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+8010585d:	85 c0                	test   %eax,%eax
+8010585f:	74 0b                	je     8010586c <strncmp+0x27>
+80105861:	0f b6 1a             	movzbl (%edx),%ebx
+80105864:	84 db                	test   %bl,%bl
+80105866:	74 04                	je     8010586c <strncmp+0x27>
+80105868:	3a 19                	cmp    (%ecx),%bl
+8010586a:	74 e8                	je     80105854 <strncmp+0xf>
+  if(n == 0)
+8010586c:	85 c0                	test   %eax,%eax
+8010586e:	74 0d                	je     8010587d <strncmp+0x38>
+    return 0;
+  return (uchar)*p - (uchar)*q;
+80105870:	0f b6 02             	movzbl (%edx),%eax
+80105873:	0f b6 11             	movzbl (%ecx),%edx
+80105876:	29 d0                	sub    %edx,%eax
+}
+80105878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010587b:	c9                   	leave
+8010587c:	c3                   	ret
+    return 0;
+8010587d:	b8 00 00 00 00       	mov    $0x0,%eax
+80105882:	eb f4                	jmp    80105878 <strncmp+0x33>
+
+80105884 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80105884:	55                   	push   %ebp
+80105885:	89 e5                	mov    %esp,%ebp
+80105887:	57                   	push   %edi
+80105888:	56                   	push   %esi
+80105889:	53                   	push   %ebx
+8010588a:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010588d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80105890:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+80105893:	89 fa                	mov    %edi,%edx
+80105895:	eb 04                	jmp    8010589b <strncpy+0x17>
+80105897:	89 f1                	mov    %esi,%ecx
+80105899:	89 da                	mov    %ebx,%edx
+8010589b:	89 c3                	mov    %eax,%ebx
+8010589d:	83 e8 01             	sub    $0x1,%eax
+801058a0:	85 db                	test   %ebx,%ebx
+801058a2:	7e 11                	jle    801058b5 <strncpy+0x31>
+801058a4:	8d 71 01             	lea    0x1(%ecx),%esi
+801058a7:	8d 5a 01             	lea    0x1(%edx),%ebx
+801058aa:	0f b6 09             	movzbl (%ecx),%ecx
+801058ad:	88 0a                	mov    %cl,(%edx)
+801058af:	84 c9                	test   %cl,%cl
+801058b1:	75 e4                	jne    80105897 <strncpy+0x13>
+801058b3:	89 da                	mov    %ebx,%edx
+    ;
+  while(n-- > 0)
+801058b5:	8d 48 ff             	lea    -0x1(%eax),%ecx
+801058b8:	85 c0                	test   %eax,%eax
+801058ba:	7e 0a                	jle    801058c6 <strncpy+0x42>
+    *s++ = 0;
+801058bc:	c6 02 00             	movb   $0x0,(%edx)
+  while(n-- > 0)
+801058bf:	89 c8                	mov    %ecx,%eax
+    *s++ = 0;
+801058c1:	8d 52 01             	lea    0x1(%edx),%edx
+801058c4:	eb ef                	jmp    801058b5 <strncpy+0x31>
+  return os;
+}
+801058c6:	89 f8                	mov    %edi,%eax
+801058c8:	5b                   	pop    %ebx
+801058c9:	5e                   	pop    %esi
+801058ca:	5f                   	pop    %edi
+801058cb:	5d                   	pop    %ebp
+801058cc:	c3                   	ret
+
+801058cd <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+801058cd:	55                   	push   %ebp
+801058ce:	89 e5                	mov    %esp,%ebp
+801058d0:	57                   	push   %edi
+801058d1:	56                   	push   %esi
+801058d2:	53                   	push   %ebx
+801058d3:	8b 7d 08             	mov    0x8(%ebp),%edi
+801058d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801058d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+801058dc:	85 c0                	test   %eax,%eax
+801058de:	7e 23                	jle    80105903 <safestrcpy+0x36>
+801058e0:	89 fa                	mov    %edi,%edx
+801058e2:	eb 04                	jmp    801058e8 <safestrcpy+0x1b>
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+801058e4:	89 f1                	mov    %esi,%ecx
+801058e6:	89 da                	mov    %ebx,%edx
+801058e8:	83 e8 01             	sub    $0x1,%eax
+801058eb:	85 c0                	test   %eax,%eax
+801058ed:	7e 11                	jle    80105900 <safestrcpy+0x33>
+801058ef:	8d 71 01             	lea    0x1(%ecx),%esi
+801058f2:	8d 5a 01             	lea    0x1(%edx),%ebx
+801058f5:	0f b6 09             	movzbl (%ecx),%ecx
+801058f8:	88 0a                	mov    %cl,(%edx)
+801058fa:	84 c9                	test   %cl,%cl
+801058fc:	75 e6                	jne    801058e4 <safestrcpy+0x17>
+801058fe:	89 da                	mov    %ebx,%edx
+    ;
+  *s = 0;
+80105900:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80105903:	89 f8                	mov    %edi,%eax
+80105905:	5b                   	pop    %ebx
+80105906:	5e                   	pop    %esi
+80105907:	5f                   	pop    %edi
+80105908:	5d                   	pop    %ebp
+80105909:	c3                   	ret
+
+8010590a <strlen>:
+
+int
+strlen(const char *s)
+{
+8010590a:	55                   	push   %ebp
+8010590b:	89 e5                	mov    %esp,%ebp
+8010590d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+80105910:	b8 00 00 00 00       	mov    $0x0,%eax
+80105915:	eb 03                	jmp    8010591a <strlen+0x10>
+80105917:	83 c0 01             	add    $0x1,%eax
+8010591a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+8010591e:	75 f7                	jne    80105917 <strlen+0xd>
+    ;
+  return n;
+}
+80105920:	5d                   	pop    %ebp
+80105921:	c3                   	ret
+
+80105922 <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80105922:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+80105926:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+8010592a:	55                   	push   %ebp
+  pushl %ebx
+8010592b:	53                   	push   %ebx
+  pushl %esi
+8010592c:	56                   	push   %esi
+  pushl %edi
+8010592d:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+8010592e:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80105930:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+80105932:	5f                   	pop    %edi
+  popl %esi
+80105933:	5e                   	pop    %esi
+  popl %ebx
+80105934:	5b                   	pop    %ebx
+  popl %ebp
+80105935:	5d                   	pop    %ebp
+  ret
+80105936:	c3                   	ret
+
+80105937 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80105937:	55                   	push   %ebp
+80105938:	89 e5                	mov    %esp,%ebp
+8010593a:	53                   	push   %ebx
+8010593b:	83 ec 04             	sub    $0x4,%esp
+8010593e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80105941:	e8 88 e6 ff ff       	call   80103fce <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80105946:	8b 00                	mov    (%eax),%eax
+80105948:	39 c3                	cmp    %eax,%ebx
+8010594a:	73 18                	jae    80105964 <fetchint+0x2d>
+8010594c:	8d 53 04             	lea    0x4(%ebx),%edx
+8010594f:	39 d0                	cmp    %edx,%eax
+80105951:	72 18                	jb     8010596b <fetchint+0x34>
+    return -1;
+  *ip = *(int*)(addr);
+80105953:	8b 13                	mov    (%ebx),%edx
+80105955:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105958:	89 10                	mov    %edx,(%eax)
+  return 0;
+8010595a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010595f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105962:	c9                   	leave
+80105963:	c3                   	ret
+    return -1;
+80105964:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105969:	eb f4                	jmp    8010595f <fetchint+0x28>
+8010596b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105970:	eb ed                	jmp    8010595f <fetchint+0x28>
+
+80105972 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80105972:	55                   	push   %ebp
+80105973:	89 e5                	mov    %esp,%ebp
+80105975:	53                   	push   %ebx
+80105976:	83 ec 04             	sub    $0x4,%esp
+80105979:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+8010597c:	e8 4d e6 ff ff       	call   80103fce <myproc>
+
+  if(addr >= curproc->sz)
+80105981:	3b 18                	cmp    (%eax),%ebx
+80105983:	73 25                	jae    801059aa <fetchstr+0x38>
+    return -1;
+  *pp = (char*)addr;
+80105985:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105988:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+8010598a:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+8010598c:	89 d8                	mov    %ebx,%eax
+8010598e:	eb 03                	jmp    80105993 <fetchstr+0x21>
+80105990:	83 c0 01             	add    $0x1,%eax
+80105993:	39 d0                	cmp    %edx,%eax
+80105995:	73 09                	jae    801059a0 <fetchstr+0x2e>
+    if(*s == 0)
+80105997:	80 38 00             	cmpb   $0x0,(%eax)
+8010599a:	75 f4                	jne    80105990 <fetchstr+0x1e>
+      return s - *pp;
+8010599c:	29 d8                	sub    %ebx,%eax
+8010599e:	eb 05                	jmp    801059a5 <fetchstr+0x33>
+  }
+  return -1;
+801059a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801059a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801059a8:	c9                   	leave
+801059a9:	c3                   	ret
+    return -1;
+801059aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801059af:	eb f4                	jmp    801059a5 <fetchstr+0x33>
+
+801059b1 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+801059b1:	55                   	push   %ebp
+801059b2:	89 e5                	mov    %esp,%ebp
+801059b4:	83 ec 08             	sub    $0x8,%esp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801059b7:	e8 12 e6 ff ff       	call   80103fce <myproc>
+801059bc:	8b 50 18             	mov    0x18(%eax),%edx
+801059bf:	8b 45 08             	mov    0x8(%ebp),%eax
+801059c2:	c1 e0 02             	shl    $0x2,%eax
+801059c5:	03 42 44             	add    0x44(%edx),%eax
+801059c8:	83 ec 08             	sub    $0x8,%esp
+801059cb:	ff 75 0c             	push   0xc(%ebp)
+801059ce:	83 c0 04             	add    $0x4,%eax
+801059d1:	50                   	push   %eax
+801059d2:	e8 60 ff ff ff       	call   80105937 <fetchint>
+}
+801059d7:	c9                   	leave
+801059d8:	c3                   	ret
+
+801059d9 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+801059d9:	55                   	push   %ebp
+801059da:	89 e5                	mov    %esp,%ebp
+801059dc:	56                   	push   %esi
+801059dd:	53                   	push   %ebx
+801059de:	83 ec 10             	sub    $0x10,%esp
+801059e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int i;
+  struct proc *curproc = myproc();
+801059e4:	e8 e5 e5 ff ff       	call   80103fce <myproc>
+801059e9:	89 c6                	mov    %eax,%esi
+ 
+  if(argint(n, &i) < 0)
+801059eb:	83 ec 08             	sub    $0x8,%esp
+801059ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801059f1:	50                   	push   %eax
+801059f2:	ff 75 08             	push   0x8(%ebp)
+801059f5:	e8 b7 ff ff ff       	call   801059b1 <argint>
+801059fa:	83 c4 10             	add    $0x10,%esp
+801059fd:	85 c0                	test   %eax,%eax
+801059ff:	78 24                	js     80105a25 <argptr+0x4c>
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80105a01:	85 db                	test   %ebx,%ebx
+80105a03:	78 27                	js     80105a2c <argptr+0x53>
+80105a05:	8b 16                	mov    (%esi),%edx
+80105a07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80105a0a:	39 d0                	cmp    %edx,%eax
+80105a0c:	73 25                	jae    80105a33 <argptr+0x5a>
+80105a0e:	01 c3                	add    %eax,%ebx
+80105a10:	39 da                	cmp    %ebx,%edx
+80105a12:	72 26                	jb     80105a3a <argptr+0x61>
+    return -1;
+  *pp = (char*)i;
+80105a14:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105a17:	89 02                	mov    %eax,(%edx)
+  return 0;
+80105a19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105a1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105a21:	5b                   	pop    %ebx
+80105a22:	5e                   	pop    %esi
+80105a23:	5d                   	pop    %ebp
+80105a24:	c3                   	ret
+    return -1;
+80105a25:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105a2a:	eb f2                	jmp    80105a1e <argptr+0x45>
+    return -1;
+80105a2c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105a31:	eb eb                	jmp    80105a1e <argptr+0x45>
+80105a33:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105a38:	eb e4                	jmp    80105a1e <argptr+0x45>
+80105a3a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105a3f:	eb dd                	jmp    80105a1e <argptr+0x45>
+
+80105a41 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80105a41:	55                   	push   %ebp
+80105a42:	89 e5                	mov    %esp,%ebp
+80105a44:	83 ec 20             	sub    $0x20,%esp
+  int addr;
+  if(argint(n, &addr) < 0)
+80105a47:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80105a4a:	50                   	push   %eax
+80105a4b:	ff 75 08             	push   0x8(%ebp)
+80105a4e:	e8 5e ff ff ff       	call   801059b1 <argint>
+80105a53:	83 c4 10             	add    $0x10,%esp
+80105a56:	85 c0                	test   %eax,%eax
+80105a58:	78 13                	js     80105a6d <argstr+0x2c>
+    return -1;
+  return fetchstr(addr, pp);
+80105a5a:	83 ec 08             	sub    $0x8,%esp
+80105a5d:	ff 75 0c             	push   0xc(%ebp)
+80105a60:	ff 75 f4             	push   -0xc(%ebp)
+80105a63:	e8 0a ff ff ff       	call   80105972 <fetchstr>
+80105a68:	83 c4 10             	add    $0x10,%esp
+}
+80105a6b:	c9                   	leave
+80105a6c:	c3                   	ret
+    return -1;
+80105a6d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105a72:	eb f7                	jmp    80105a6b <argstr+0x2a>
+
+80105a74 <syscall>:
+[SYS_getschedstats] sys_getschedstats,
+};
+
+void
+syscall(void)
+{
+80105a74:	55                   	push   %ebp
+80105a75:	89 e5                	mov    %esp,%ebp
+80105a77:	53                   	push   %ebx
+80105a78:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80105a7b:	e8 4e e5 ff ff       	call   80103fce <myproc>
+80105a80:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+80105a82:	8b 40 18             	mov    0x18(%eax),%eax
+80105a85:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80105a88:	8d 50 ff             	lea    -0x1(%eax),%edx
+80105a8b:	83 fa 22             	cmp    $0x22,%edx
+80105a8e:	77 17                	ja     80105aa7 <syscall+0x33>
+80105a90:	8b 14 85 a0 8d 10 80 	mov    -0x7fef7260(,%eax,4),%edx
+80105a97:	85 d2                	test   %edx,%edx
+80105a99:	74 0c                	je     80105aa7 <syscall+0x33>
+    curproc->tf->eax = syscalls[num]();
+80105a9b:	ff d2                	call   *%edx
+80105a9d:	89 c2                	mov    %eax,%edx
+80105a9f:	8b 43 18             	mov    0x18(%ebx),%eax
+80105aa2:	89 50 1c             	mov    %edx,0x1c(%eax)
+80105aa5:	eb 1f                	jmp    80105ac6 <syscall+0x52>
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+80105aa7:	8d 53 74             	lea    0x74(%ebx),%edx
+    cprintf("%d %s: unknown sys call %d\n",
+80105aaa:	50                   	push   %eax
+80105aab:	52                   	push   %edx
+80105aac:	ff 73 10             	push   0x10(%ebx)
+80105aaf:	68 72 8d 10 80       	push   $0x80108d72
+80105ab4:	e8 76 ab ff ff       	call   8010062f <cprintf>
+    curproc->tf->eax = -1;
+80105ab9:	8b 43 18             	mov    0x18(%ebx),%eax
+80105abc:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+80105ac3:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80105ac6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105ac9:	c9                   	leave
+80105aca:	c3                   	ret
+
+80105acb <argfd>:
+
+// Fetch the nth word-sized system call argument as a file descriptor
+// and return both the descriptor and the corresponding struct file.
+static int
+argfd(int n, int *pfd, struct file **pf)
+{
+80105acb:	55                   	push   %ebp
+80105acc:	89 e5                	mov    %esp,%ebp
+80105ace:	56                   	push   %esi
+80105acf:	53                   	push   %ebx
+80105ad0:	83 ec 18             	sub    $0x18,%esp
+80105ad3:	89 d6                	mov    %edx,%esi
+80105ad5:	89 cb                	mov    %ecx,%ebx
+  int fd;
+  struct file *f;
+
+  if(argint(n, &fd) < 0)
+80105ad7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80105ada:	52                   	push   %edx
+80105adb:	50                   	push   %eax
+80105adc:	e8 d0 fe ff ff       	call   801059b1 <argint>
+80105ae1:	83 c4 10             	add    $0x10,%esp
+80105ae4:	85 c0                	test   %eax,%eax
+80105ae6:	78 35                	js     80105b1d <argfd+0x52>
+    return -1;
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80105ae8:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80105aec:	77 28                	ja     80105b16 <argfd+0x4b>
+80105aee:	e8 db e4 ff ff       	call   80103fce <myproc>
+80105af3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105af6:	8b 44 90 30          	mov    0x30(%eax,%edx,4),%eax
+80105afa:	85 c0                	test   %eax,%eax
+80105afc:	74 18                	je     80105b16 <argfd+0x4b>
+    return -1;
+  if(pfd)
+80105afe:	85 f6                	test   %esi,%esi
+80105b00:	74 02                	je     80105b04 <argfd+0x39>
+    *pfd = fd;
+80105b02:	89 16                	mov    %edx,(%esi)
+  if(pf)
+80105b04:	85 db                	test   %ebx,%ebx
+80105b06:	74 1c                	je     80105b24 <argfd+0x59>
+    *pf = f;
+80105b08:	89 03                	mov    %eax,(%ebx)
+  return 0;
+80105b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105b0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105b12:	5b                   	pop    %ebx
+80105b13:	5e                   	pop    %esi
+80105b14:	5d                   	pop    %ebp
+80105b15:	c3                   	ret
+    return -1;
+80105b16:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105b1b:	eb f2                	jmp    80105b0f <argfd+0x44>
+    return -1;
+80105b1d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105b22:	eb eb                	jmp    80105b0f <argfd+0x44>
+  return 0;
+80105b24:	b8 00 00 00 00       	mov    $0x0,%eax
+80105b29:	eb e4                	jmp    80105b0f <argfd+0x44>
+
+80105b2b <fdalloc>:
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+static int
+fdalloc(struct file *f)
+{
+80105b2b:	55                   	push   %ebp
+80105b2c:	89 e5                	mov    %esp,%ebp
+80105b2e:	53                   	push   %ebx
+80105b2f:	83 ec 04             	sub    $0x4,%esp
+80105b32:	89 c3                	mov    %eax,%ebx
+  int fd;
+  struct proc *curproc = myproc();
+80105b34:	e8 95 e4 ff ff       	call   80103fce <myproc>
+80105b39:	89 c2                	mov    %eax,%edx
+
+  for(fd = 0; fd < NOFILE; fd++){
+80105b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+80105b40:	83 f8 0f             	cmp    $0xf,%eax
+80105b43:	7f 12                	jg     80105b57 <fdalloc+0x2c>
+    if(curproc->ofile[fd] == 0){
+80105b45:	83 7c 82 30 00       	cmpl   $0x0,0x30(%edx,%eax,4)
+80105b4a:	74 05                	je     80105b51 <fdalloc+0x26>
+  for(fd = 0; fd < NOFILE; fd++){
+80105b4c:	83 c0 01             	add    $0x1,%eax
+80105b4f:	eb ef                	jmp    80105b40 <fdalloc+0x15>
+      curproc->ofile[fd] = f;
+80105b51:	89 5c 82 30          	mov    %ebx,0x30(%edx,%eax,4)
+      return fd;
+80105b55:	eb 05                	jmp    80105b5c <fdalloc+0x31>
+    }
+  }
+  return -1;
+80105b57:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105b5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105b5f:	c9                   	leave
+80105b60:	c3                   	ret
+
+80105b61 <isdirempty>:
+}
+
+// Is the directory dp empty except for "." and ".." ?
+static int
+isdirempty(struct inode *dp)
+{
+80105b61:	55                   	push   %ebp
+80105b62:	89 e5                	mov    %esp,%ebp
+80105b64:	56                   	push   %esi
+80105b65:	53                   	push   %ebx
+80105b66:	83 ec 10             	sub    $0x10,%esp
+80105b69:	89 c3                	mov    %eax,%ebx
+  int off;
+  struct dirent de;
+
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80105b6b:	b8 20 00 00 00       	mov    $0x20,%eax
+80105b70:	89 c6                	mov    %eax,%esi
+80105b72:	3b 43 58             	cmp    0x58(%ebx),%eax
+80105b75:	73 2e                	jae    80105ba5 <isdirempty+0x44>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80105b77:	6a 10                	push   $0x10
+80105b79:	50                   	push   %eax
+80105b7a:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80105b7d:	50                   	push   %eax
+80105b7e:	53                   	push   %ebx
+80105b7f:	e8 b9 bb ff ff       	call   8010173d <readi>
+80105b84:	83 c4 10             	add    $0x10,%esp
+80105b87:	83 f8 10             	cmp    $0x10,%eax
+80105b8a:	75 0c                	jne    80105b98 <isdirempty+0x37>
+      panic("isdirempty: readi");
+    if(de.inum != 0)
+80105b8c:	66 83 7d e8 00       	cmpw   $0x0,-0x18(%ebp)
+80105b91:	75 1e                	jne    80105bb1 <isdirempty+0x50>
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80105b93:	8d 46 10             	lea    0x10(%esi),%eax
+80105b96:	eb d8                	jmp    80105b70 <isdirempty+0xf>
+      panic("isdirempty: readi");
+80105b98:	83 ec 0c             	sub    $0xc,%esp
+80105b9b:	68 30 8e 10 80       	push   $0x80108e30
+80105ba0:	e8 c9 a7 ff ff       	call   8010036e <panic>
+      return 0;
+  }
+  return 1;
+80105ba5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80105baa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105bad:	5b                   	pop    %ebx
+80105bae:	5e                   	pop    %esi
+80105baf:	5d                   	pop    %ebp
+80105bb0:	c3                   	ret
+      return 0;
+80105bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+80105bb6:	eb f2                	jmp    80105baa <isdirempty+0x49>
+
+80105bb8 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80105bb8:	55                   	push   %ebp
+80105bb9:	89 e5                	mov    %esp,%ebp
+80105bbb:	57                   	push   %edi
+80105bbc:	56                   	push   %esi
+80105bbd:	53                   	push   %ebx
+80105bbe:	83 ec 34             	sub    $0x34,%esp
+80105bc1:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80105bc4:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+80105bc7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80105bca:	8d 55 da             	lea    -0x26(%ebp),%edx
+80105bcd:	52                   	push   %edx
+80105bce:	50                   	push   %eax
+80105bcf:	e8 eb bf ff ff       	call   80101bbf <nameiparent>
+80105bd4:	89 c6                	mov    %eax,%esi
+80105bd6:	83 c4 10             	add    $0x10,%esp
+80105bd9:	85 c0                	test   %eax,%eax
+80105bdb:	0f 84 33 01 00 00    	je     80105d14 <create+0x15c>
+    return 0;
+  ilock(dp);
+80105be1:	83 ec 0c             	sub    $0xc,%esp
+80105be4:	50                   	push   %eax
+80105be5:	e8 61 b9 ff ff       	call   8010154b <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80105bea:	83 c4 0c             	add    $0xc,%esp
+80105bed:	6a 00                	push   $0x0
+80105bef:	8d 45 da             	lea    -0x26(%ebp),%eax
+80105bf2:	50                   	push   %eax
+80105bf3:	56                   	push   %esi
+80105bf4:	e8 80 bd ff ff       	call   80101979 <dirlookup>
+80105bf9:	89 c3                	mov    %eax,%ebx
+80105bfb:	83 c4 10             	add    $0x10,%esp
+80105bfe:	85 c0                	test   %eax,%eax
+80105c00:	74 3d                	je     80105c3f <create+0x87>
+    iunlockput(dp);
+80105c02:	83 ec 0c             	sub    $0xc,%esp
+80105c05:	56                   	push   %esi
+80105c06:	e8 e7 ba ff ff       	call   801016f2 <iunlockput>
+    ilock(ip);
+80105c0b:	89 1c 24             	mov    %ebx,(%esp)
+80105c0e:	e8 38 b9 ff ff       	call   8010154b <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80105c13:	83 c4 10             	add    $0x10,%esp
+80105c16:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+80105c1b:	75 07                	jne    80105c24 <create+0x6c>
+80105c1d:	66 83 7b 50 02       	cmpw   $0x2,0x50(%ebx)
+80105c22:	74 11                	je     80105c35 <create+0x7d>
+      return ip;
+    iunlockput(ip);
+80105c24:	83 ec 0c             	sub    $0xc,%esp
+80105c27:	53                   	push   %ebx
+80105c28:	e8 c5 ba ff ff       	call   801016f2 <iunlockput>
+    return 0;
+80105c2d:	83 c4 10             	add    $0x10,%esp
+80105c30:	bb 00 00 00 00       	mov    $0x0,%ebx
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80105c35:	89 d8                	mov    %ebx,%eax
+80105c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105c3a:	5b                   	pop    %ebx
+80105c3b:	5e                   	pop    %esi
+80105c3c:	5f                   	pop    %edi
+80105c3d:	5d                   	pop    %ebp
+80105c3e:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80105c3f:	83 ec 08             	sub    $0x8,%esp
+80105c42:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80105c46:	50                   	push   %eax
+80105c47:	ff 36                	push   (%esi)
+80105c49:	e8 fa b6 ff ff       	call   80101348 <ialloc>
+80105c4e:	89 c3                	mov    %eax,%ebx
+80105c50:	83 c4 10             	add    $0x10,%esp
+80105c53:	85 c0                	test   %eax,%eax
+80105c55:	74 52                	je     80105ca9 <create+0xf1>
+  ilock(ip);
+80105c57:	83 ec 0c             	sub    $0xc,%esp
+80105c5a:	50                   	push   %eax
+80105c5b:	e8 eb b8 ff ff       	call   8010154b <ilock>
+  ip->major = major;
+80105c60:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+80105c64:	66 89 43 52          	mov    %ax,0x52(%ebx)
+  ip->minor = minor;
+80105c68:	66 89 7b 54          	mov    %di,0x54(%ebx)
+  ip->nlink = 1;
+80105c6c:	66 c7 43 56 01 00    	movw   $0x1,0x56(%ebx)
+  iupdate(ip);
+80105c72:	89 1c 24             	mov    %ebx,(%esp)
+80105c75:	e8 70 b7 ff ff       	call   801013ea <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80105c7a:	83 c4 10             	add    $0x10,%esp
+80105c7d:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+80105c82:	74 32                	je     80105cb6 <create+0xfe>
+  if(dirlink(dp, name, ip->inum) < 0)
+80105c84:	83 ec 04             	sub    $0x4,%esp
+80105c87:	ff 73 04             	push   0x4(%ebx)
+80105c8a:	8d 45 da             	lea    -0x26(%ebp),%eax
+80105c8d:	50                   	push   %eax
+80105c8e:	56                   	push   %esi
+80105c8f:	e8 62 be ff ff       	call   80101af6 <dirlink>
+80105c94:	83 c4 10             	add    $0x10,%esp
+80105c97:	85 c0                	test   %eax,%eax
+80105c99:	78 6c                	js     80105d07 <create+0x14f>
+  iunlockput(dp);
+80105c9b:	83 ec 0c             	sub    $0xc,%esp
+80105c9e:	56                   	push   %esi
+80105c9f:	e8 4e ba ff ff       	call   801016f2 <iunlockput>
+  return ip;
+80105ca4:	83 c4 10             	add    $0x10,%esp
+80105ca7:	eb 8c                	jmp    80105c35 <create+0x7d>
+    panic("create: ialloc");
+80105ca9:	83 ec 0c             	sub    $0xc,%esp
+80105cac:	68 42 8e 10 80       	push   $0x80108e42
+80105cb1:	e8 b8 a6 ff ff       	call   8010036e <panic>
+    dp->nlink++;  // for ".."
+80105cb6:	0f b7 46 56          	movzwl 0x56(%esi),%eax
+80105cba:	83 c0 01             	add    $0x1,%eax
+80105cbd:	66 89 46 56          	mov    %ax,0x56(%esi)
+    iupdate(dp);
+80105cc1:	83 ec 0c             	sub    $0xc,%esp
+80105cc4:	56                   	push   %esi
+80105cc5:	e8 20 b7 ff ff       	call   801013ea <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80105cca:	83 c4 0c             	add    $0xc,%esp
+80105ccd:	ff 73 04             	push   0x4(%ebx)
+80105cd0:	68 52 8e 10 80       	push   $0x80108e52
+80105cd5:	53                   	push   %ebx
+80105cd6:	e8 1b be ff ff       	call   80101af6 <dirlink>
+80105cdb:	83 c4 10             	add    $0x10,%esp
+80105cde:	85 c0                	test   %eax,%eax
+80105ce0:	78 18                	js     80105cfa <create+0x142>
+80105ce2:	83 ec 04             	sub    $0x4,%esp
+80105ce5:	ff 76 04             	push   0x4(%esi)
+80105ce8:	68 51 8e 10 80       	push   $0x80108e51
+80105ced:	53                   	push   %ebx
+80105cee:	e8 03 be ff ff       	call   80101af6 <dirlink>
+80105cf3:	83 c4 10             	add    $0x10,%esp
+80105cf6:	85 c0                	test   %eax,%eax
+80105cf8:	79 8a                	jns    80105c84 <create+0xcc>
+      panic("create dots");
+80105cfa:	83 ec 0c             	sub    $0xc,%esp
+80105cfd:	68 54 8e 10 80       	push   $0x80108e54
+80105d02:	e8 67 a6 ff ff       	call   8010036e <panic>
+    panic("create: dirlink");
+80105d07:	83 ec 0c             	sub    $0xc,%esp
+80105d0a:	68 60 8e 10 80       	push   $0x80108e60
+80105d0f:	e8 5a a6 ff ff       	call   8010036e <panic>
+    return 0;
+80105d14:	89 c3                	mov    %eax,%ebx
+80105d16:	e9 1a ff ff ff       	jmp    80105c35 <create+0x7d>
+
+80105d1b <sys_dup>:
+{
+80105d1b:	55                   	push   %ebp
+80105d1c:	89 e5                	mov    %esp,%ebp
+80105d1e:	53                   	push   %ebx
+80105d1f:	83 ec 14             	sub    $0x14,%esp
+  if(argfd(0, 0, &f) < 0)
+80105d22:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80105d25:	ba 00 00 00 00       	mov    $0x0,%edx
+80105d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+80105d2f:	e8 97 fd ff ff       	call   80105acb <argfd>
+80105d34:	85 c0                	test   %eax,%eax
+80105d36:	78 23                	js     80105d5b <sys_dup+0x40>
+  if((fd=fdalloc(f)) < 0)
+80105d38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80105d3b:	e8 eb fd ff ff       	call   80105b2b <fdalloc>
+80105d40:	89 c3                	mov    %eax,%ebx
+80105d42:	85 c0                	test   %eax,%eax
+80105d44:	78 1c                	js     80105d62 <sys_dup+0x47>
+  filedup(f);
+80105d46:	83 ec 0c             	sub    $0xc,%esp
+80105d49:	ff 75 f4             	push   -0xc(%ebp)
+80105d4c:	e8 12 af ff ff       	call   80100c63 <filedup>
+  return fd;
+80105d51:	83 c4 10             	add    $0x10,%esp
+}
+80105d54:	89 d8                	mov    %ebx,%eax
+80105d56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105d59:	c9                   	leave
+80105d5a:	c3                   	ret
+    return -1;
+80105d5b:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80105d60:	eb f2                	jmp    80105d54 <sys_dup+0x39>
+    return -1;
+80105d62:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80105d67:	eb eb                	jmp    80105d54 <sys_dup+0x39>
+
+80105d69 <sys_read>:
+{
+80105d69:	55                   	push   %ebp
+80105d6a:	89 e5                	mov    %esp,%ebp
+80105d6c:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80105d6f:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80105d72:	ba 00 00 00 00       	mov    $0x0,%edx
+80105d77:	b8 00 00 00 00       	mov    $0x0,%eax
+80105d7c:	e8 4a fd ff ff       	call   80105acb <argfd>
+80105d81:	85 c0                	test   %eax,%eax
+80105d83:	78 43                	js     80105dc8 <sys_read+0x5f>
+80105d85:	83 ec 08             	sub    $0x8,%esp
+80105d88:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80105d8b:	50                   	push   %eax
+80105d8c:	6a 02                	push   $0x2
+80105d8e:	e8 1e fc ff ff       	call   801059b1 <argint>
+80105d93:	83 c4 10             	add    $0x10,%esp
+80105d96:	85 c0                	test   %eax,%eax
+80105d98:	78 2e                	js     80105dc8 <sys_read+0x5f>
+80105d9a:	83 ec 04             	sub    $0x4,%esp
+80105d9d:	ff 75 f0             	push   -0x10(%ebp)
+80105da0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80105da3:	50                   	push   %eax
+80105da4:	6a 01                	push   $0x1
+80105da6:	e8 2e fc ff ff       	call   801059d9 <argptr>
+80105dab:	83 c4 10             	add    $0x10,%esp
+80105dae:	85 c0                	test   %eax,%eax
+80105db0:	78 16                	js     80105dc8 <sys_read+0x5f>
+  return fileread(f, p, n);
+80105db2:	83 ec 04             	sub    $0x4,%esp
+80105db5:	ff 75 f0             	push   -0x10(%ebp)
+80105db8:	ff 75 ec             	push   -0x14(%ebp)
+80105dbb:	ff 75 f4             	push   -0xc(%ebp)
+80105dbe:	e8 f2 af ff ff       	call   80100db5 <fileread>
+80105dc3:	83 c4 10             	add    $0x10,%esp
+}
+80105dc6:	c9                   	leave
+80105dc7:	c3                   	ret
+    return -1;
+80105dc8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105dcd:	eb f7                	jmp    80105dc6 <sys_read+0x5d>
+
+80105dcf <sys_write>:
+{
+80105dcf:	55                   	push   %ebp
+80105dd0:	89 e5                	mov    %esp,%ebp
+80105dd2:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80105dd5:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80105dd8:	ba 00 00 00 00       	mov    $0x0,%edx
+80105ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+80105de2:	e8 e4 fc ff ff       	call   80105acb <argfd>
+80105de7:	85 c0                	test   %eax,%eax
+80105de9:	78 43                	js     80105e2e <sys_write+0x5f>
+80105deb:	83 ec 08             	sub    $0x8,%esp
+80105dee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80105df1:	50                   	push   %eax
+80105df2:	6a 02                	push   $0x2
+80105df4:	e8 b8 fb ff ff       	call   801059b1 <argint>
+80105df9:	83 c4 10             	add    $0x10,%esp
+80105dfc:	85 c0                	test   %eax,%eax
+80105dfe:	78 2e                	js     80105e2e <sys_write+0x5f>
+80105e00:	83 ec 04             	sub    $0x4,%esp
+80105e03:	ff 75 f0             	push   -0x10(%ebp)
+80105e06:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80105e09:	50                   	push   %eax
+80105e0a:	6a 01                	push   $0x1
+80105e0c:	e8 c8 fb ff ff       	call   801059d9 <argptr>
+80105e11:	83 c4 10             	add    $0x10,%esp
+80105e14:	85 c0                	test   %eax,%eax
+80105e16:	78 16                	js     80105e2e <sys_write+0x5f>
+  return filewrite(f, p, n);
+80105e18:	83 ec 04             	sub    $0x4,%esp
+80105e1b:	ff 75 f0             	push   -0x10(%ebp)
+80105e1e:	ff 75 ec             	push   -0x14(%ebp)
+80105e21:	ff 75 f4             	push   -0xc(%ebp)
+80105e24:	e8 11 b0 ff ff       	call   80100e3a <filewrite>
+80105e29:	83 c4 10             	add    $0x10,%esp
+}
+80105e2c:	c9                   	leave
+80105e2d:	c3                   	ret
+    return -1;
+80105e2e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105e33:	eb f7                	jmp    80105e2c <sys_write+0x5d>
+
+80105e35 <sys_close>:
+{
+80105e35:	55                   	push   %ebp
+80105e36:	89 e5                	mov    %esp,%ebp
+80105e38:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, &fd, &f) < 0)
+80105e3b:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+80105e3e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80105e41:	b8 00 00 00 00       	mov    $0x0,%eax
+80105e46:	e8 80 fc ff ff       	call   80105acb <argfd>
+80105e4b:	85 c0                	test   %eax,%eax
+80105e4d:	78 25                	js     80105e74 <sys_close+0x3f>
+  myproc()->ofile[fd] = 0;
+80105e4f:	e8 7a e1 ff ff       	call   80103fce <myproc>
+80105e54:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105e57:	c7 44 90 30 00 00 00 	movl   $0x0,0x30(%eax,%edx,4)
+80105e5e:	00 
+  fileclose(f);
+80105e5f:	83 ec 0c             	sub    $0xc,%esp
+80105e62:	ff 75 f0             	push   -0x10(%ebp)
+80105e65:	e8 3e ae ff ff       	call   80100ca8 <fileclose>
+  return 0;
+80105e6a:	83 c4 10             	add    $0x10,%esp
+80105e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105e72:	c9                   	leave
+80105e73:	c3                   	ret
+    return -1;
+80105e74:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105e79:	eb f7                	jmp    80105e72 <sys_close+0x3d>
+
+80105e7b <sys_fstat>:
+{
+80105e7b:	55                   	push   %ebp
+80105e7c:	89 e5                	mov    %esp,%ebp
+80105e7e:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+80105e81:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80105e84:	ba 00 00 00 00       	mov    $0x0,%edx
+80105e89:	b8 00 00 00 00       	mov    $0x0,%eax
+80105e8e:	e8 38 fc ff ff       	call   80105acb <argfd>
+80105e93:	85 c0                	test   %eax,%eax
+80105e95:	78 2a                	js     80105ec1 <sys_fstat+0x46>
+80105e97:	83 ec 04             	sub    $0x4,%esp
+80105e9a:	6a 14                	push   $0x14
+80105e9c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80105e9f:	50                   	push   %eax
+80105ea0:	6a 01                	push   $0x1
+80105ea2:	e8 32 fb ff ff       	call   801059d9 <argptr>
+80105ea7:	83 c4 10             	add    $0x10,%esp
+80105eaa:	85 c0                	test   %eax,%eax
+80105eac:	78 13                	js     80105ec1 <sys_fstat+0x46>
+  return filestat(f, st);
+80105eae:	83 ec 08             	sub    $0x8,%esp
+80105eb1:	ff 75 f0             	push   -0x10(%ebp)
+80105eb4:	ff 75 f4             	push   -0xc(%ebp)
+80105eb7:	e8 b2 ae ff ff       	call   80100d6e <filestat>
+80105ebc:	83 c4 10             	add    $0x10,%esp
+}
+80105ebf:	c9                   	leave
+80105ec0:	c3                   	ret
+    return -1;
+80105ec1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105ec6:	eb f7                	jmp    80105ebf <sys_fstat+0x44>
+
+80105ec8 <sys_link>:
+{
+80105ec8:	55                   	push   %ebp
+80105ec9:	89 e5                	mov    %esp,%ebp
+80105ecb:	56                   	push   %esi
+80105ecc:	53                   	push   %ebx
+80105ecd:	83 ec 28             	sub    $0x28,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80105ed0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80105ed3:	50                   	push   %eax
+80105ed4:	6a 00                	push   $0x0
+80105ed6:	e8 66 fb ff ff       	call   80105a41 <argstr>
+80105edb:	83 c4 10             	add    $0x10,%esp
+80105ede:	85 c0                	test   %eax,%eax
+80105ee0:	0f 88 d3 00 00 00    	js     80105fb9 <sys_link+0xf1>
+80105ee6:	83 ec 08             	sub    $0x8,%esp
+80105ee9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80105eec:	50                   	push   %eax
+80105eed:	6a 01                	push   $0x1
+80105eef:	e8 4d fb ff ff       	call   80105a41 <argstr>
+80105ef4:	83 c4 10             	add    $0x10,%esp
+80105ef7:	85 c0                	test   %eax,%eax
+80105ef9:	0f 88 ba 00 00 00    	js     80105fb9 <sys_link+0xf1>
+  begin_op();
+80105eff:	e8 f7 c8 ff ff       	call   801027fb <begin_op>
+  if((ip = namei(old)) == 0){
+80105f04:	83 ec 0c             	sub    $0xc,%esp
+80105f07:	ff 75 e0             	push   -0x20(%ebp)
+80105f0a:	e8 98 bc ff ff       	call   80101ba7 <namei>
+80105f0f:	89 c3                	mov    %eax,%ebx
+80105f11:	83 c4 10             	add    $0x10,%esp
+80105f14:	85 c0                	test   %eax,%eax
+80105f16:	0f 84 a4 00 00 00    	je     80105fc0 <sys_link+0xf8>
+  ilock(ip);
+80105f1c:	83 ec 0c             	sub    $0xc,%esp
+80105f1f:	50                   	push   %eax
+80105f20:	e8 26 b6 ff ff       	call   8010154b <ilock>
+  if(ip->type == T_DIR){
+80105f25:	83 c4 10             	add    $0x10,%esp
+80105f28:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80105f2d:	0f 84 99 00 00 00    	je     80105fcc <sys_link+0x104>
+  ip->nlink++;
+80105f33:	0f b7 43 56          	movzwl 0x56(%ebx),%eax
+80105f37:	83 c0 01             	add    $0x1,%eax
+80105f3a:	66 89 43 56          	mov    %ax,0x56(%ebx)
+  iupdate(ip);
+80105f3e:	83 ec 0c             	sub    $0xc,%esp
+80105f41:	53                   	push   %ebx
+80105f42:	e8 a3 b4 ff ff       	call   801013ea <iupdate>
+  iunlock(ip);
+80105f47:	89 1c 24             	mov    %ebx,(%esp)
+80105f4a:	e8 be b6 ff ff       	call   8010160d <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80105f4f:	83 c4 08             	add    $0x8,%esp
+80105f52:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80105f55:	50                   	push   %eax
+80105f56:	ff 75 e4             	push   -0x1c(%ebp)
+80105f59:	e8 61 bc ff ff       	call   80101bbf <nameiparent>
+80105f5e:	89 c6                	mov    %eax,%esi
+80105f60:	83 c4 10             	add    $0x10,%esp
+80105f63:	85 c0                	test   %eax,%eax
+80105f65:	0f 84 85 00 00 00    	je     80105ff0 <sys_link+0x128>
+  ilock(dp);
+80105f6b:	83 ec 0c             	sub    $0xc,%esp
+80105f6e:	50                   	push   %eax
+80105f6f:	e8 d7 b5 ff ff       	call   8010154b <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80105f74:	83 c4 10             	add    $0x10,%esp
+80105f77:	8b 03                	mov    (%ebx),%eax
+80105f79:	39 06                	cmp    %eax,(%esi)
+80105f7b:	75 67                	jne    80105fe4 <sys_link+0x11c>
+80105f7d:	83 ec 04             	sub    $0x4,%esp
+80105f80:	ff 73 04             	push   0x4(%ebx)
+80105f83:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80105f86:	50                   	push   %eax
+80105f87:	56                   	push   %esi
+80105f88:	e8 69 bb ff ff       	call   80101af6 <dirlink>
+80105f8d:	83 c4 10             	add    $0x10,%esp
+80105f90:	85 c0                	test   %eax,%eax
+80105f92:	78 50                	js     80105fe4 <sys_link+0x11c>
+  iunlockput(dp);
+80105f94:	83 ec 0c             	sub    $0xc,%esp
+80105f97:	56                   	push   %esi
+80105f98:	e8 55 b7 ff ff       	call   801016f2 <iunlockput>
+  iput(ip);
+80105f9d:	89 1c 24             	mov    %ebx,(%esp)
+80105fa0:	e8 ad b6 ff ff       	call   80101652 <iput>
+  end_op();
+80105fa5:	e8 cb c8 ff ff       	call   80102875 <end_op>
+  return 0;
+80105faa:	83 c4 10             	add    $0x10,%esp
+80105fad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105fb5:	5b                   	pop    %ebx
+80105fb6:	5e                   	pop    %esi
+80105fb7:	5d                   	pop    %ebp
+80105fb8:	c3                   	ret
+    return -1;
+80105fb9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105fbe:	eb f2                	jmp    80105fb2 <sys_link+0xea>
+    end_op();
+80105fc0:	e8 b0 c8 ff ff       	call   80102875 <end_op>
+    return -1;
+80105fc5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105fca:	eb e6                	jmp    80105fb2 <sys_link+0xea>
+    iunlockput(ip);
+80105fcc:	83 ec 0c             	sub    $0xc,%esp
+80105fcf:	53                   	push   %ebx
+80105fd0:	e8 1d b7 ff ff       	call   801016f2 <iunlockput>
+    end_op();
+80105fd5:	e8 9b c8 ff ff       	call   80102875 <end_op>
+    return -1;
+80105fda:	83 c4 10             	add    $0x10,%esp
+80105fdd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105fe2:	eb ce                	jmp    80105fb2 <sys_link+0xea>
+    iunlockput(dp);
+80105fe4:	83 ec 0c             	sub    $0xc,%esp
+80105fe7:	56                   	push   %esi
+80105fe8:	e8 05 b7 ff ff       	call   801016f2 <iunlockput>
+    goto bad;
+80105fed:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80105ff0:	83 ec 0c             	sub    $0xc,%esp
+80105ff3:	53                   	push   %ebx
+80105ff4:	e8 52 b5 ff ff       	call   8010154b <ilock>
+  ip->nlink--;
+80105ff9:	0f b7 43 56          	movzwl 0x56(%ebx),%eax
+80105ffd:	83 e8 01             	sub    $0x1,%eax
+80106000:	66 89 43 56          	mov    %ax,0x56(%ebx)
+  iupdate(ip);
+80106004:	89 1c 24             	mov    %ebx,(%esp)
+80106007:	e8 de b3 ff ff       	call   801013ea <iupdate>
+  iunlockput(ip);
+8010600c:	89 1c 24             	mov    %ebx,(%esp)
+8010600f:	e8 de b6 ff ff       	call   801016f2 <iunlockput>
+  end_op();
+80106014:	e8 5c c8 ff ff       	call   80102875 <end_op>
+  return -1;
+80106019:	83 c4 10             	add    $0x10,%esp
+8010601c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106021:	eb 8f                	jmp    80105fb2 <sys_link+0xea>
+
+80106023 <sys_unlink>:
+{
+80106023:	55                   	push   %ebp
+80106024:	89 e5                	mov    %esp,%ebp
+80106026:	57                   	push   %edi
+80106027:	56                   	push   %esi
+80106028:	53                   	push   %ebx
+80106029:	83 ec 44             	sub    $0x44,%esp
+  if(argstr(0, &path) < 0)
+8010602c:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+8010602f:	50                   	push   %eax
+80106030:	6a 00                	push   $0x0
+80106032:	e8 0a fa ff ff       	call   80105a41 <argstr>
+80106037:	83 c4 10             	add    $0x10,%esp
+8010603a:	85 c0                	test   %eax,%eax
+8010603c:	0f 88 83 01 00 00    	js     801061c5 <sys_unlink+0x1a2>
+  begin_op();
+80106042:	e8 b4 c7 ff ff       	call   801027fb <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80106047:	83 ec 08             	sub    $0x8,%esp
+8010604a:	8d 45 ca             	lea    -0x36(%ebp),%eax
+8010604d:	50                   	push   %eax
+8010604e:	ff 75 c4             	push   -0x3c(%ebp)
+80106051:	e8 69 bb ff ff       	call   80101bbf <nameiparent>
+80106056:	89 c6                	mov    %eax,%esi
+80106058:	83 c4 10             	add    $0x10,%esp
+8010605b:	85 c0                	test   %eax,%eax
+8010605d:	0f 84 ed 00 00 00    	je     80106150 <sys_unlink+0x12d>
+  ilock(dp);
+80106063:	83 ec 0c             	sub    $0xc,%esp
+80106066:	50                   	push   %eax
+80106067:	e8 df b4 ff ff       	call   8010154b <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+8010606c:	83 c4 08             	add    $0x8,%esp
+8010606f:	68 52 8e 10 80       	push   $0x80108e52
+80106074:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80106077:	50                   	push   %eax
+80106078:	e8 e7 b8 ff ff       	call   80101964 <namecmp>
+8010607d:	83 c4 10             	add    $0x10,%esp
+80106080:	85 c0                	test   %eax,%eax
+80106082:	0f 84 fc 00 00 00    	je     80106184 <sys_unlink+0x161>
+80106088:	83 ec 08             	sub    $0x8,%esp
+8010608b:	68 51 8e 10 80       	push   $0x80108e51
+80106090:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80106093:	50                   	push   %eax
+80106094:	e8 cb b8 ff ff       	call   80101964 <namecmp>
+80106099:	83 c4 10             	add    $0x10,%esp
+8010609c:	85 c0                	test   %eax,%eax
+8010609e:	0f 84 e0 00 00 00    	je     80106184 <sys_unlink+0x161>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+801060a4:	83 ec 04             	sub    $0x4,%esp
+801060a7:	8d 45 c0             	lea    -0x40(%ebp),%eax
+801060aa:	50                   	push   %eax
+801060ab:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801060ae:	50                   	push   %eax
+801060af:	56                   	push   %esi
+801060b0:	e8 c4 b8 ff ff       	call   80101979 <dirlookup>
+801060b5:	89 c3                	mov    %eax,%ebx
+801060b7:	83 c4 10             	add    $0x10,%esp
+801060ba:	85 c0                	test   %eax,%eax
+801060bc:	0f 84 c2 00 00 00    	je     80106184 <sys_unlink+0x161>
+  ilock(ip);
+801060c2:	83 ec 0c             	sub    $0xc,%esp
+801060c5:	50                   	push   %eax
+801060c6:	e8 80 b4 ff ff       	call   8010154b <ilock>
+  if(ip->nlink < 1)
+801060cb:	83 c4 10             	add    $0x10,%esp
+801060ce:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+801060d3:	0f 8e 83 00 00 00    	jle    8010615c <sys_unlink+0x139>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+801060d9:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+801060de:	0f 84 85 00 00 00    	je     80106169 <sys_unlink+0x146>
+  memset(&de, 0, sizeof(de));
+801060e4:	83 ec 04             	sub    $0x4,%esp
+801060e7:	6a 10                	push   $0x10
+801060e9:	6a 00                	push   $0x0
+801060eb:	8d 7d d8             	lea    -0x28(%ebp),%edi
+801060ee:	57                   	push   %edi
+801060ef:	e8 6d f6 ff ff       	call   80105761 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801060f4:	6a 10                	push   $0x10
+801060f6:	ff 75 c0             	push   -0x40(%ebp)
+801060f9:	57                   	push   %edi
+801060fa:	56                   	push   %esi
+801060fb:	e8 38 b7 ff ff       	call   80101838 <writei>
+80106100:	83 c4 20             	add    $0x20,%esp
+80106103:	83 f8 10             	cmp    $0x10,%eax
+80106106:	0f 85 90 00 00 00    	jne    8010619c <sys_unlink+0x179>
+  if(ip->type == T_DIR){
+8010610c:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80106111:	0f 84 92 00 00 00    	je     801061a9 <sys_unlink+0x186>
+  iunlockput(dp);
+80106117:	83 ec 0c             	sub    $0xc,%esp
+8010611a:	56                   	push   %esi
+8010611b:	e8 d2 b5 ff ff       	call   801016f2 <iunlockput>
+  ip->nlink--;
+80106120:	0f b7 43 56          	movzwl 0x56(%ebx),%eax
+80106124:	83 e8 01             	sub    $0x1,%eax
+80106127:	66 89 43 56          	mov    %ax,0x56(%ebx)
+  iupdate(ip);
+8010612b:	89 1c 24             	mov    %ebx,(%esp)
+8010612e:	e8 b7 b2 ff ff       	call   801013ea <iupdate>
+  iunlockput(ip);
+80106133:	89 1c 24             	mov    %ebx,(%esp)
+80106136:	e8 b7 b5 ff ff       	call   801016f2 <iunlockput>
+  end_op();
+8010613b:	e8 35 c7 ff ff       	call   80102875 <end_op>
+  return 0;
+80106140:	83 c4 10             	add    $0x10,%esp
+80106143:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010614b:	5b                   	pop    %ebx
+8010614c:	5e                   	pop    %esi
+8010614d:	5f                   	pop    %edi
+8010614e:	5d                   	pop    %ebp
+8010614f:	c3                   	ret
+    end_op();
+80106150:	e8 20 c7 ff ff       	call   80102875 <end_op>
+    return -1;
+80106155:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010615a:	eb ec                	jmp    80106148 <sys_unlink+0x125>
+    panic("unlink: nlink < 1");
+8010615c:	83 ec 0c             	sub    $0xc,%esp
+8010615f:	68 70 8e 10 80       	push   $0x80108e70
+80106164:	e8 05 a2 ff ff       	call   8010036e <panic>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80106169:	89 d8                	mov    %ebx,%eax
+8010616b:	e8 f1 f9 ff ff       	call   80105b61 <isdirempty>
+80106170:	85 c0                	test   %eax,%eax
+80106172:	0f 85 6c ff ff ff    	jne    801060e4 <sys_unlink+0xc1>
+    iunlockput(ip);
+80106178:	83 ec 0c             	sub    $0xc,%esp
+8010617b:	53                   	push   %ebx
+8010617c:	e8 71 b5 ff ff       	call   801016f2 <iunlockput>
+    goto bad;
+80106181:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+80106184:	83 ec 0c             	sub    $0xc,%esp
+80106187:	56                   	push   %esi
+80106188:	e8 65 b5 ff ff       	call   801016f2 <iunlockput>
+  end_op();
+8010618d:	e8 e3 c6 ff ff       	call   80102875 <end_op>
+  return -1;
+80106192:	83 c4 10             	add    $0x10,%esp
+80106195:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010619a:	eb ac                	jmp    80106148 <sys_unlink+0x125>
+    panic("unlink: writei");
+8010619c:	83 ec 0c             	sub    $0xc,%esp
+8010619f:	68 82 8e 10 80       	push   $0x80108e82
+801061a4:	e8 c5 a1 ff ff       	call   8010036e <panic>
+    dp->nlink--;
+801061a9:	0f b7 46 56          	movzwl 0x56(%esi),%eax
+801061ad:	83 e8 01             	sub    $0x1,%eax
+801061b0:	66 89 46 56          	mov    %ax,0x56(%esi)
+    iupdate(dp);
+801061b4:	83 ec 0c             	sub    $0xc,%esp
+801061b7:	56                   	push   %esi
+801061b8:	e8 2d b2 ff ff       	call   801013ea <iupdate>
+801061bd:	83 c4 10             	add    $0x10,%esp
+801061c0:	e9 52 ff ff ff       	jmp    80106117 <sys_unlink+0xf4>
+    return -1;
+801061c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801061ca:	e9 79 ff ff ff       	jmp    80106148 <sys_unlink+0x125>
+
+801061cf <sys_open>:
+
+int
+sys_open(void)
+{
+801061cf:	55                   	push   %ebp
+801061d0:	89 e5                	mov    %esp,%ebp
+801061d2:	57                   	push   %edi
+801061d3:	56                   	push   %esi
+801061d4:	53                   	push   %ebx
+801061d5:	83 ec 24             	sub    $0x24,%esp
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801061d8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801061db:	50                   	push   %eax
+801061dc:	6a 00                	push   $0x0
+801061de:	e8 5e f8 ff ff       	call   80105a41 <argstr>
+801061e3:	83 c4 10             	add    $0x10,%esp
+801061e6:	85 c0                	test   %eax,%eax
+801061e8:	0f 88 a0 00 00 00    	js     8010628e <sys_open+0xbf>
+801061ee:	83 ec 08             	sub    $0x8,%esp
+801061f1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+801061f4:	50                   	push   %eax
+801061f5:	6a 01                	push   $0x1
+801061f7:	e8 b5 f7 ff ff       	call   801059b1 <argint>
+801061fc:	83 c4 10             	add    $0x10,%esp
+801061ff:	85 c0                	test   %eax,%eax
+80106201:	0f 88 87 00 00 00    	js     8010628e <sys_open+0xbf>
+    return -1;
+
+  begin_op();
+80106207:	e8 ef c5 ff ff       	call   801027fb <begin_op>
+
+  if(omode & O_CREATE){
+8010620c:	f6 45 e1 02          	testb  $0x2,-0x1f(%ebp)
+80106210:	0f 84 8b 00 00 00    	je     801062a1 <sys_open+0xd2>
+    ip = create(path, T_FILE, 0, 0);
+80106216:	83 ec 0c             	sub    $0xc,%esp
+80106219:	6a 00                	push   $0x0
+8010621b:	b9 00 00 00 00       	mov    $0x0,%ecx
+80106220:	ba 02 00 00 00       	mov    $0x2,%edx
+80106225:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106228:	e8 8b f9 ff ff       	call   80105bb8 <create>
+8010622d:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+8010622f:	83 c4 10             	add    $0x10,%esp
+80106232:	85 c0                	test   %eax,%eax
+80106234:	74 5f                	je     80106295 <sys_open+0xc6>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80106236:	e8 c7 a9 ff ff       	call   80100c02 <filealloc>
+8010623b:	89 c3                	mov    %eax,%ebx
+8010623d:	85 c0                	test   %eax,%eax
+8010623f:	0f 84 c1 00 00 00    	je     80106306 <sys_open+0x137>
+80106245:	e8 e1 f8 ff ff       	call   80105b2b <fdalloc>
+8010624a:	89 c7                	mov    %eax,%edi
+8010624c:	85 c0                	test   %eax,%eax
+8010624e:	0f 88 a6 00 00 00    	js     801062fa <sys_open+0x12b>
+      fileclose(f);
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80106254:	83 ec 0c             	sub    $0xc,%esp
+80106257:	56                   	push   %esi
+80106258:	e8 b0 b3 ff ff       	call   8010160d <iunlock>
+  end_op();
+8010625d:	e8 13 c6 ff ff       	call   80102875 <end_op>
+
+  f->type = FD_INODE;
+80106262:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  f->ip = ip;
+80106268:	89 73 10             	mov    %esi,0x10(%ebx)
+  f->off = 0;
+8010626b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  f->readable = !(omode & O_WRONLY);
+80106272:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80106275:	83 c4 10             	add    $0x10,%esp
+80106278:	a8 01                	test   $0x1,%al
+8010627a:	0f 94 43 08          	sete   0x8(%ebx)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+8010627e:	a8 03                	test   $0x3,%al
+80106280:	0f 95 43 09          	setne  0x9(%ebx)
+  return fd;
+}
+80106284:	89 f8                	mov    %edi,%eax
+80106286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106289:	5b                   	pop    %ebx
+8010628a:	5e                   	pop    %esi
+8010628b:	5f                   	pop    %edi
+8010628c:	5d                   	pop    %ebp
+8010628d:	c3                   	ret
+    return -1;
+8010628e:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80106293:	eb ef                	jmp    80106284 <sys_open+0xb5>
+      end_op();
+80106295:	e8 db c5 ff ff       	call   80102875 <end_op>
+      return -1;
+8010629a:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010629f:	eb e3                	jmp    80106284 <sys_open+0xb5>
+    if((ip = namei(path)) == 0){
+801062a1:	83 ec 0c             	sub    $0xc,%esp
+801062a4:	ff 75 e4             	push   -0x1c(%ebp)
+801062a7:	e8 fb b8 ff ff       	call   80101ba7 <namei>
+801062ac:	89 c6                	mov    %eax,%esi
+801062ae:	83 c4 10             	add    $0x10,%esp
+801062b1:	85 c0                	test   %eax,%eax
+801062b3:	74 39                	je     801062ee <sys_open+0x11f>
+    ilock(ip);
+801062b5:	83 ec 0c             	sub    $0xc,%esp
+801062b8:	50                   	push   %eax
+801062b9:	e8 8d b2 ff ff       	call   8010154b <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+801062be:	83 c4 10             	add    $0x10,%esp
+801062c1:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+801062c6:	0f 85 6a ff ff ff    	jne    80106236 <sys_open+0x67>
+801062cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+801062d0:	0f 84 60 ff ff ff    	je     80106236 <sys_open+0x67>
+      iunlockput(ip);
+801062d6:	83 ec 0c             	sub    $0xc,%esp
+801062d9:	56                   	push   %esi
+801062da:	e8 13 b4 ff ff       	call   801016f2 <iunlockput>
+      end_op();
+801062df:	e8 91 c5 ff ff       	call   80102875 <end_op>
+      return -1;
+801062e4:	83 c4 10             	add    $0x10,%esp
+801062e7:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801062ec:	eb 96                	jmp    80106284 <sys_open+0xb5>
+      end_op();
+801062ee:	e8 82 c5 ff ff       	call   80102875 <end_op>
+      return -1;
+801062f3:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801062f8:	eb 8a                	jmp    80106284 <sys_open+0xb5>
+      fileclose(f);
+801062fa:	83 ec 0c             	sub    $0xc,%esp
+801062fd:	53                   	push   %ebx
+801062fe:	e8 a5 a9 ff ff       	call   80100ca8 <fileclose>
+80106303:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80106306:	83 ec 0c             	sub    $0xc,%esp
+80106309:	56                   	push   %esi
+8010630a:	e8 e3 b3 ff ff       	call   801016f2 <iunlockput>
+    end_op();
+8010630f:	e8 61 c5 ff ff       	call   80102875 <end_op>
+    return -1;
+80106314:	83 c4 10             	add    $0x10,%esp
+80106317:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010631c:	e9 63 ff ff ff       	jmp    80106284 <sys_open+0xb5>
+
+80106321 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80106321:	55                   	push   %ebp
+80106322:	89 e5                	mov    %esp,%ebp
+80106324:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80106327:	e8 cf c4 ff ff       	call   801027fb <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010632c:	83 ec 08             	sub    $0x8,%esp
+8010632f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106332:	50                   	push   %eax
+80106333:	6a 00                	push   $0x0
+80106335:	e8 07 f7 ff ff       	call   80105a41 <argstr>
+8010633a:	83 c4 10             	add    $0x10,%esp
+8010633d:	85 c0                	test   %eax,%eax
+8010633f:	78 36                	js     80106377 <sys_mkdir+0x56>
+80106341:	83 ec 0c             	sub    $0xc,%esp
+80106344:	6a 00                	push   $0x0
+80106346:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010634b:	ba 01 00 00 00       	mov    $0x1,%edx
+80106350:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80106353:	e8 60 f8 ff ff       	call   80105bb8 <create>
+80106358:	83 c4 10             	add    $0x10,%esp
+8010635b:	85 c0                	test   %eax,%eax
+8010635d:	74 18                	je     80106377 <sys_mkdir+0x56>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010635f:	83 ec 0c             	sub    $0xc,%esp
+80106362:	50                   	push   %eax
+80106363:	e8 8a b3 ff ff       	call   801016f2 <iunlockput>
+  end_op();
+80106368:	e8 08 c5 ff ff       	call   80102875 <end_op>
+  return 0;
+8010636d:	83 c4 10             	add    $0x10,%esp
+80106370:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106375:	c9                   	leave
+80106376:	c3                   	ret
+    end_op();
+80106377:	e8 f9 c4 ff ff       	call   80102875 <end_op>
+    return -1;
+8010637c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106381:	eb f2                	jmp    80106375 <sys_mkdir+0x54>
+
+80106383 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+80106383:	55                   	push   %ebp
+80106384:	89 e5                	mov    %esp,%ebp
+80106386:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+80106389:	e8 6d c4 ff ff       	call   801027fb <begin_op>
+  if((argstr(0, &path)) < 0 ||
+8010638e:	83 ec 08             	sub    $0x8,%esp
+80106391:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106394:	50                   	push   %eax
+80106395:	6a 00                	push   $0x0
+80106397:	e8 a5 f6 ff ff       	call   80105a41 <argstr>
+8010639c:	83 c4 10             	add    $0x10,%esp
+8010639f:	85 c0                	test   %eax,%eax
+801063a1:	78 62                	js     80106405 <sys_mknod+0x82>
+     argint(1, &major) < 0 ||
+801063a3:	83 ec 08             	sub    $0x8,%esp
+801063a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801063a9:	50                   	push   %eax
+801063aa:	6a 01                	push   $0x1
+801063ac:	e8 00 f6 ff ff       	call   801059b1 <argint>
+  if((argstr(0, &path)) < 0 ||
+801063b1:	83 c4 10             	add    $0x10,%esp
+801063b4:	85 c0                	test   %eax,%eax
+801063b6:	78 4d                	js     80106405 <sys_mknod+0x82>
+     argint(2, &minor) < 0 ||
+801063b8:	83 ec 08             	sub    $0x8,%esp
+801063bb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801063be:	50                   	push   %eax
+801063bf:	6a 02                	push   $0x2
+801063c1:	e8 eb f5 ff ff       	call   801059b1 <argint>
+     argint(1, &major) < 0 ||
+801063c6:	83 c4 10             	add    $0x10,%esp
+801063c9:	85 c0                	test   %eax,%eax
+801063cb:	78 38                	js     80106405 <sys_mknod+0x82>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+801063cd:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+801063d1:	83 ec 0c             	sub    $0xc,%esp
+801063d4:	0f bf 45 ec          	movswl -0x14(%ebp),%eax
+801063d8:	50                   	push   %eax
+801063d9:	ba 03 00 00 00       	mov    $0x3,%edx
+801063de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801063e1:	e8 d2 f7 ff ff       	call   80105bb8 <create>
+     argint(2, &minor) < 0 ||
+801063e6:	83 c4 10             	add    $0x10,%esp
+801063e9:	85 c0                	test   %eax,%eax
+801063eb:	74 18                	je     80106405 <sys_mknod+0x82>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+801063ed:	83 ec 0c             	sub    $0xc,%esp
+801063f0:	50                   	push   %eax
+801063f1:	e8 fc b2 ff ff       	call   801016f2 <iunlockput>
+  end_op();
+801063f6:	e8 7a c4 ff ff       	call   80102875 <end_op>
+  return 0;
+801063fb:	83 c4 10             	add    $0x10,%esp
+801063fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106403:	c9                   	leave
+80106404:	c3                   	ret
+    end_op();
+80106405:	e8 6b c4 ff ff       	call   80102875 <end_op>
+    return -1;
+8010640a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010640f:	eb f2                	jmp    80106403 <sys_mknod+0x80>
+
+80106411 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80106411:	55                   	push   %ebp
+80106412:	89 e5                	mov    %esp,%ebp
+80106414:	56                   	push   %esi
+80106415:	53                   	push   %ebx
+80106416:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+80106419:	e8 b0 db ff ff       	call   80103fce <myproc>
+8010641e:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+80106420:	e8 d6 c3 ff ff       	call   801027fb <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80106425:	83 ec 08             	sub    $0x8,%esp
+80106428:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010642b:	50                   	push   %eax
+8010642c:	6a 00                	push   $0x0
+8010642e:	e8 0e f6 ff ff       	call   80105a41 <argstr>
+80106433:	83 c4 10             	add    $0x10,%esp
+80106436:	85 c0                	test   %eax,%eax
+80106438:	78 52                	js     8010648c <sys_chdir+0x7b>
+8010643a:	83 ec 0c             	sub    $0xc,%esp
+8010643d:	ff 75 f4             	push   -0xc(%ebp)
+80106440:	e8 62 b7 ff ff       	call   80101ba7 <namei>
+80106445:	89 c3                	mov    %eax,%ebx
+80106447:	83 c4 10             	add    $0x10,%esp
+8010644a:	85 c0                	test   %eax,%eax
+8010644c:	74 3e                	je     8010648c <sys_chdir+0x7b>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+8010644e:	83 ec 0c             	sub    $0xc,%esp
+80106451:	50                   	push   %eax
+80106452:	e8 f4 b0 ff ff       	call   8010154b <ilock>
+  if(ip->type != T_DIR){
+80106457:	83 c4 10             	add    $0x10,%esp
+8010645a:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+8010645f:	75 37                	jne    80106498 <sys_chdir+0x87>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80106461:	83 ec 0c             	sub    $0xc,%esp
+80106464:	53                   	push   %ebx
+80106465:	e8 a3 b1 ff ff       	call   8010160d <iunlock>
+  iput(curproc->cwd);
+8010646a:	83 c4 04             	add    $0x4,%esp
+8010646d:	ff 76 70             	push   0x70(%esi)
+80106470:	e8 dd b1 ff ff       	call   80101652 <iput>
+  end_op();
+80106475:	e8 fb c3 ff ff       	call   80102875 <end_op>
+  curproc->cwd = ip;
+8010647a:	89 5e 70             	mov    %ebx,0x70(%esi)
+  return 0;
+8010647d:	83 c4 10             	add    $0x10,%esp
+80106480:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106485:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106488:	5b                   	pop    %ebx
+80106489:	5e                   	pop    %esi
+8010648a:	5d                   	pop    %ebp
+8010648b:	c3                   	ret
+    end_op();
+8010648c:	e8 e4 c3 ff ff       	call   80102875 <end_op>
+    return -1;
+80106491:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106496:	eb ed                	jmp    80106485 <sys_chdir+0x74>
+    iunlockput(ip);
+80106498:	83 ec 0c             	sub    $0xc,%esp
+8010649b:	53                   	push   %ebx
+8010649c:	e8 51 b2 ff ff       	call   801016f2 <iunlockput>
+    end_op();
+801064a1:	e8 cf c3 ff ff       	call   80102875 <end_op>
+    return -1;
+801064a6:	83 c4 10             	add    $0x10,%esp
+801064a9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801064ae:	eb d5                	jmp    80106485 <sys_chdir+0x74>
+
+801064b0 <sys_exec>:
+
+int
+sys_exec(void)
+{
+801064b0:	55                   	push   %ebp
+801064b1:	89 e5                	mov    %esp,%ebp
+801064b3:	53                   	push   %ebx
+801064b4:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801064ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801064bd:	50                   	push   %eax
+801064be:	6a 00                	push   $0x0
+801064c0:	e8 7c f5 ff ff       	call   80105a41 <argstr>
+801064c5:	83 c4 10             	add    $0x10,%esp
+801064c8:	85 c0                	test   %eax,%eax
+801064ca:	78 38                	js     80106504 <sys_exec+0x54>
+801064cc:	83 ec 08             	sub    $0x8,%esp
+801064cf:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+801064d5:	50                   	push   %eax
+801064d6:	6a 01                	push   $0x1
+801064d8:	e8 d4 f4 ff ff       	call   801059b1 <argint>
+801064dd:	83 c4 10             	add    $0x10,%esp
+801064e0:	85 c0                	test   %eax,%eax
+801064e2:	78 20                	js     80106504 <sys_exec+0x54>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+801064e4:	83 ec 04             	sub    $0x4,%esp
+801064e7:	68 80 00 00 00       	push   $0x80
+801064ec:	6a 00                	push   $0x0
+801064ee:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+801064f4:	50                   	push   %eax
+801064f5:	e8 67 f2 ff ff       	call   80105761 <memset>
+801064fa:	83 c4 10             	add    $0x10,%esp
+  for(i=0;; i++){
+801064fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+80106502:	eb 2c                	jmp    80106530 <sys_exec+0x80>
+    return -1;
+80106504:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106509:	eb 78                	jmp    80106583 <sys_exec+0xd3>
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+      return -1;
+    if(uarg == 0){
+      argv[i] = 0;
+8010650b:	c7 84 9d 74 ff ff ff 	movl   $0x0,-0x8c(%ebp,%ebx,4)
+80106512:	00 00 00 00 
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+      return -1;
+  }
+  return exec(path, argv);
+80106516:	83 ec 08             	sub    $0x8,%esp
+80106519:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+8010651f:	50                   	push   %eax
+80106520:	ff 75 f4             	push   -0xc(%ebp)
+80106523:	e8 94 a3 ff ff       	call   801008bc <exec>
+80106528:	83 c4 10             	add    $0x10,%esp
+8010652b:	eb 56                	jmp    80106583 <sys_exec+0xd3>
+  for(i=0;; i++){
+8010652d:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80106530:	83 fb 1f             	cmp    $0x1f,%ebx
+80106533:	77 49                	ja     8010657e <sys_exec+0xce>
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80106535:	83 ec 08             	sub    $0x8,%esp
+80106538:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+8010653e:	50                   	push   %eax
+8010653f:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+80106545:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+80106548:	50                   	push   %eax
+80106549:	e8 e9 f3 ff ff       	call   80105937 <fetchint>
+8010654e:	83 c4 10             	add    $0x10,%esp
+80106551:	85 c0                	test   %eax,%eax
+80106553:	78 33                	js     80106588 <sys_exec+0xd8>
+    if(uarg == 0){
+80106555:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+8010655b:	85 c0                	test   %eax,%eax
+8010655d:	74 ac                	je     8010650b <sys_exec+0x5b>
+    if(fetchstr(uarg, &argv[i]) < 0)
+8010655f:	83 ec 08             	sub    $0x8,%esp
+80106562:	8d 94 9d 74 ff ff ff 	lea    -0x8c(%ebp,%ebx,4),%edx
+80106569:	52                   	push   %edx
+8010656a:	50                   	push   %eax
+8010656b:	e8 02 f4 ff ff       	call   80105972 <fetchstr>
+80106570:	83 c4 10             	add    $0x10,%esp
+80106573:	85 c0                	test   %eax,%eax
+80106575:	79 b6                	jns    8010652d <sys_exec+0x7d>
+      return -1;
+80106577:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010657c:	eb 05                	jmp    80106583 <sys_exec+0xd3>
+      return -1;
+8010657e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106583:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106586:	c9                   	leave
+80106587:	c3                   	ret
+      return -1;
+80106588:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010658d:	eb f4                	jmp    80106583 <sys_exec+0xd3>
+
+8010658f <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+8010658f:	55                   	push   %ebp
+80106590:	89 e5                	mov    %esp,%ebp
+80106592:	53                   	push   %ebx
+80106593:	83 ec 18             	sub    $0x18,%esp
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80106596:	6a 08                	push   $0x8
+80106598:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010659b:	50                   	push   %eax
+8010659c:	6a 00                	push   $0x0
+8010659e:	e8 36 f4 ff ff       	call   801059d9 <argptr>
+801065a3:	83 c4 10             	add    $0x10,%esp
+801065a6:	85 c0                	test   %eax,%eax
+801065a8:	78 73                	js     8010661d <sys_pipe+0x8e>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+801065aa:	83 ec 08             	sub    $0x8,%esp
+801065ad:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801065b0:	50                   	push   %eax
+801065b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801065b4:	50                   	push   %eax
+801065b5:	e8 01 c8 ff ff       	call   80102dbb <pipealloc>
+801065ba:	83 c4 10             	add    $0x10,%esp
+801065bd:	85 c0                	test   %eax,%eax
+801065bf:	78 63                	js     80106624 <sys_pipe+0x95>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+801065c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+801065c4:	e8 62 f5 ff ff       	call   80105b2b <fdalloc>
+801065c9:	89 c3                	mov    %eax,%ebx
+801065cb:	85 c0                	test   %eax,%eax
+801065cd:	78 2e                	js     801065fd <sys_pipe+0x6e>
+801065cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801065d2:	e8 54 f5 ff ff       	call   80105b2b <fdalloc>
+801065d7:	85 c0                	test   %eax,%eax
+801065d9:	78 15                	js     801065f0 <sys_pipe+0x61>
+      myproc()->ofile[fd0] = 0;
+    fileclose(rf);
+    fileclose(wf);
+    return -1;
+  }
+  fd[0] = fd0;
+801065db:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801065de:	89 1a                	mov    %ebx,(%edx)
+  fd[1] = fd1;
+801065e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801065e3:	89 42 04             	mov    %eax,0x4(%edx)
+  return 0;
+801065e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801065eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801065ee:	c9                   	leave
+801065ef:	c3                   	ret
+      myproc()->ofile[fd0] = 0;
+801065f0:	e8 d9 d9 ff ff       	call   80103fce <myproc>
+801065f5:	c7 44 98 30 00 00 00 	movl   $0x0,0x30(%eax,%ebx,4)
+801065fc:	00 
+    fileclose(rf);
+801065fd:	83 ec 0c             	sub    $0xc,%esp
+80106600:	ff 75 f0             	push   -0x10(%ebp)
+80106603:	e8 a0 a6 ff ff       	call   80100ca8 <fileclose>
+    fileclose(wf);
+80106608:	83 c4 04             	add    $0x4,%esp
+8010660b:	ff 75 ec             	push   -0x14(%ebp)
+8010660e:	e8 95 a6 ff ff       	call   80100ca8 <fileclose>
+    return -1;
+80106613:	83 c4 10             	add    $0x10,%esp
+80106616:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010661b:	eb ce                	jmp    801065eb <sys_pipe+0x5c>
+    return -1;
+8010661d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106622:	eb c7                	jmp    801065eb <sys_pipe+0x5c>
+    return -1;
+80106624:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106629:	eb c0                	jmp    801065eb <sys_pipe+0x5c>
+
+8010662b <sys_fork>:
+#include "sched.h"
+#include "trace.h"
+
+int
+sys_fork(void)
+{
+8010662b:	55                   	push   %ebp
+8010662c:	89 e5                	mov    %esp,%ebp
+8010662e:	83 ec 08             	sub    $0x8,%esp
+  return fork();
+80106631:	e8 a8 dc ff ff       	call   801042de <fork>
+}
+80106636:	c9                   	leave
+80106637:	c3                   	ret
+
+80106638 <sys_exit>:
+
+int
+sys_exit(void)
+{
+80106638:	55                   	push   %ebp
+80106639:	89 e5                	mov    %esp,%ebp
+8010663b:	83 ec 08             	sub    $0x8,%esp
+  exit();
+8010663e:	e8 81 df ff ff       	call   801045c4 <exit>
+  return 0;  // not reached
+}
+80106643:	b8 00 00 00 00       	mov    $0x0,%eax
+80106648:	c9                   	leave
+80106649:	c3                   	ret
+
+8010664a <sys_wait>:
+
+int
+sys_wait(void)
+{
+8010664a:	55                   	push   %ebp
+8010664b:	89 e5                	mov    %esp,%ebp
+8010664d:	83 ec 08             	sub    $0x8,%esp
+  return wait();
+80106650:	e8 70 e1 ff ff       	call   801047c5 <wait>
+}
+80106655:	c9                   	leave
+80106656:	c3                   	ret
+
+80106657 <sys_kill>:
+
+int
+sys_kill(void)
+{
+80106657:	55                   	push   %ebp
+80106658:	89 e5                	mov    %esp,%ebp
+8010665a:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+8010665d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106660:	50                   	push   %eax
+80106661:	6a 00                	push   $0x0
+80106663:	e8 49 f3 ff ff       	call   801059b1 <argint>
+80106668:	83 c4 10             	add    $0x10,%esp
+8010666b:	85 c0                	test   %eax,%eax
+8010666d:	78 10                	js     8010667f <sys_kill+0x28>
+    return -1;
+  return kill(pid);
+8010666f:	83 ec 0c             	sub    $0xc,%esp
+80106672:	ff 75 f4             	push   -0xc(%ebp)
+80106675:	e8 4b e2 ff ff       	call   801048c5 <kill>
+8010667a:	83 c4 10             	add    $0x10,%esp
+}
+8010667d:	c9                   	leave
+8010667e:	c3                   	ret
+    return -1;
+8010667f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106684:	eb f7                	jmp    8010667d <sys_kill+0x26>
+
+80106686 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80106686:	55                   	push   %ebp
+80106687:	89 e5                	mov    %esp,%ebp
+80106689:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+8010668c:	e8 3d d9 ff ff       	call   80103fce <myproc>
+80106691:	8b 40 10             	mov    0x10(%eax),%eax
+}
+80106694:	c9                   	leave
+80106695:	c3                   	ret
+
+80106696 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80106696:	55                   	push   %ebp
+80106697:	89 e5                	mov    %esp,%ebp
+80106699:	53                   	push   %ebx
+8010669a:	83 ec 1c             	sub    $0x1c,%esp
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+8010669d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801066a0:	50                   	push   %eax
+801066a1:	6a 00                	push   $0x0
+801066a3:	e8 09 f3 ff ff       	call   801059b1 <argint>
+801066a8:	83 c4 10             	add    $0x10,%esp
+801066ab:	85 c0                	test   %eax,%eax
+801066ad:	78 20                	js     801066cf <sys_sbrk+0x39>
+    return -1;
+  addr = myproc()->sz;
+801066af:	e8 1a d9 ff ff       	call   80103fce <myproc>
+801066b4:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+801066b6:	83 ec 0c             	sub    $0xc,%esp
+801066b9:	ff 75 f4             	push   -0xc(%ebp)
+801066bc:	e8 59 da ff ff       	call   8010411a <growproc>
+801066c1:	83 c4 10             	add    $0x10,%esp
+801066c4:	85 c0                	test   %eax,%eax
+801066c6:	78 0e                	js     801066d6 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+801066c8:	89 d8                	mov    %ebx,%eax
+801066ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801066cd:	c9                   	leave
+801066ce:	c3                   	ret
+    return -1;
+801066cf:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801066d4:	eb f2                	jmp    801066c8 <sys_sbrk+0x32>
+    return -1;
+801066d6:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801066db:	eb eb                	jmp    801066c8 <sys_sbrk+0x32>
+
+801066dd <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+801066dd:	55                   	push   %ebp
+801066de:	89 e5                	mov    %esp,%ebp
+801066e0:	53                   	push   %ebx
+801066e1:	83 ec 1c             	sub    $0x1c,%esp
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+801066e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801066e7:	50                   	push   %eax
+801066e8:	6a 00                	push   $0x0
+801066ea:	e8 c2 f2 ff ff       	call   801059b1 <argint>
+801066ef:	83 c4 10             	add    $0x10,%esp
+801066f2:	85 c0                	test   %eax,%eax
+801066f4:	78 75                	js     8010676b <sys_sleep+0x8e>
+    return -1;
+  acquire(&tickslock);
+801066f6:	83 ec 0c             	sub    $0xc,%esp
+801066f9:	68 a0 18 15 80       	push   $0x801518a0
+801066fe:	e8 b2 ef ff ff       	call   801056b5 <acquire>
+  ticks0 = ticks;
+80106703:	8b 1d 88 18 15 80    	mov    0x80151888,%ebx
+  while(ticks - ticks0 < n){
+80106709:	83 c4 10             	add    $0x10,%esp
+8010670c:	a1 88 18 15 80       	mov    0x80151888,%eax
+80106711:	29 d8                	sub    %ebx,%eax
+80106713:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+80106716:	73 39                	jae    80106751 <sys_sleep+0x74>
+    if(myproc()->killed){
+80106718:	e8 b1 d8 ff ff       	call   80103fce <myproc>
+8010671d:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80106721:	75 17                	jne    8010673a <sys_sleep+0x5d>
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+80106723:	83 ec 08             	sub    $0x8,%esp
+80106726:	68 a0 18 15 80       	push   $0x801518a0
+8010672b:	68 88 18 15 80       	push   $0x80151888
+80106730:	e8 d4 df ff ff       	call   80104709 <sleep>
+80106735:	83 c4 10             	add    $0x10,%esp
+80106738:	eb d2                	jmp    8010670c <sys_sleep+0x2f>
+      release(&tickslock);
+8010673a:	83 ec 0c             	sub    $0xc,%esp
+8010673d:	68 a0 18 15 80       	push   $0x801518a0
+80106742:	e8 d3 ef ff ff       	call   8010571a <release>
+      return -1;
+80106747:	83 c4 10             	add    $0x10,%esp
+8010674a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010674f:	eb 15                	jmp    80106766 <sys_sleep+0x89>
+  }
+  release(&tickslock);
+80106751:	83 ec 0c             	sub    $0xc,%esp
+80106754:	68 a0 18 15 80       	push   $0x801518a0
+80106759:	e8 bc ef ff ff       	call   8010571a <release>
+  return 0;
+8010675e:	83 c4 10             	add    $0x10,%esp
+80106761:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106766:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106769:	c9                   	leave
+8010676a:	c3                   	ret
+    return -1;
+8010676b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106770:	eb f4                	jmp    80106766 <sys_sleep+0x89>
+
+80106772 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80106772:	55                   	push   %ebp
+80106773:	89 e5                	mov    %esp,%ebp
+80106775:	53                   	push   %ebx
+80106776:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80106779:	68 a0 18 15 80       	push   $0x801518a0
+8010677e:	e8 32 ef ff ff       	call   801056b5 <acquire>
+  xticks = ticks;
+80106783:	8b 1d 88 18 15 80    	mov    0x80151888,%ebx
+  release(&tickslock);
+80106789:	c7 04 24 a0 18 15 80 	movl   $0x801518a0,(%esp)
+80106790:	e8 85 ef ff ff       	call   8010571a <release>
+  return xticks;
+}
+80106795:	89 d8                	mov    %ebx,%eax
+80106797:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010679a:	c9                   	leave
+8010679b:	c3                   	ret
+
+8010679c <sys_yield>:
+
+int
+sys_yield(void)
+{
+8010679c:	55                   	push   %ebp
+8010679d:	89 e5                	mov    %esp,%ebp
+8010679f:	83 ec 08             	sub    $0x8,%esp
+  yield();
+801067a2:	e8 e6 de ff ff       	call   8010468d <yield>
+  return 0;
+}
+801067a7:	b8 00 00 00 00       	mov    $0x0,%eax
+801067ac:	c9                   	leave
+801067ad:	c3                   	ret
+
+801067ae <sys_shutdown>:
+
+int sys_shutdown(void)
+{
+801067ae:	55                   	push   %ebp
+801067af:	89 e5                	mov    %esp,%ebp
+801067b1:	83 ec 08             	sub    $0x8,%esp
+  shutdown();
+801067b4:	e8 21 ba ff ff       	call   801021da <shutdown>
+  return 0;
+}
+801067b9:	b8 00 00 00 00       	mov    $0x0,%eax
+801067be:	c9                   	leave
+801067bf:	c3                   	ret
+
+801067c0 <sys_schedlog>:
+
+int sys_schedlog(void) {
+801067c0:	55                   	push   %ebp
+801067c1:	89 e5                	mov    %esp,%ebp
+801067c3:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+801067c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801067c9:	50                   	push   %eax
+801067ca:	6a 00                	push   $0x0
+801067cc:	e8 e0 f1 ff ff       	call   801059b1 <argint>
+801067d1:	83 c4 10             	add    $0x10,%esp
+801067d4:	85 c0                	test   %eax,%eax
+801067d6:	78 15                	js     801067ed <sys_schedlog+0x2d>
+    return -1;
+
+  schedlog(n);
+801067d8:	83 ec 0c             	sub    $0xc,%esp
+801067db:	ff 75 f4             	push   -0xc(%ebp)
+801067de:	e8 70 e5 ff ff       	call   80104d53 <schedlog>
+  return 0;
+801067e3:	83 c4 10             	add    $0x10,%esp
+801067e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801067eb:	c9                   	leave
+801067ec:	c3                   	ret
+    return -1;
+801067ed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801067f2:	eb f7                	jmp    801067eb <sys_schedlog+0x2b>
+
+801067f4 <sys_schedlogread>:
+
+int sys_schedlogread(void)
+{
+801067f4:	55                   	push   %ebp
+801067f5:	89 e5                	mov    %esp,%ebp
+801067f7:	83 ec 20             	sub    $0x20,%esp
+  struct schedevent *buf;
+  int n;
+
+  if(argint(1, &n) < 0)
+801067fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801067fd:	50                   	push   %eax
+801067fe:	6a 01                	push   $0x1
+80106800:	e8 ac f1 ff ff       	call   801059b1 <argint>
+80106805:	83 c4 10             	add    $0x10,%esp
+80106808:	85 c0                	test   %eax,%eax
+8010680a:	78 3d                	js     80106849 <sys_schedlogread+0x55>
+    return -1;
+  if(n > NCPU*NSCHEDLOG)
+8010680c:	81 7d f0 00 20 00 00 	cmpl   $0x2000,-0x10(%ebp)
+80106813:	7e 07                	jle    8010681c <sys_schedlogread+0x28>
+    n = NCPU*NSCHEDLOG;
+80106815:	c7 45 f0 00 20 00 00 	movl   $0x2000,-0x10(%ebp)
+  if(argptr(0, (void*)&buf, n*sizeof(*buf)) < 0)
+8010681c:	6b 45 f0 1c          	imul   $0x1c,-0x10(%ebp),%eax
+80106820:	83 ec 04             	sub    $0x4,%esp
+80106823:	50                   	push   %eax
+80106824:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106827:	50                   	push   %eax
+80106828:	6a 00                	push   $0x0
+8010682a:	e8 aa f1 ff ff       	call   801059d9 <argptr>
+8010682f:	83 c4 10             	add    $0x10,%esp
+80106832:	85 c0                	test   %eax,%eax
+80106834:	78 1a                	js     80106850 <sys_schedlogread+0x5c>
+    return -1;
+
+  return schedlogread(buf, n);
+80106836:	83 ec 08             	sub    $0x8,%esp
+80106839:	ff 75 f0             	push   -0x10(%ebp)
+8010683c:	ff 75 f4             	push   -0xc(%ebp)
+8010683f:	e8 46 e6 ff ff       	call   80104e8a <schedlogread>
+80106844:	83 c4 10             	add    $0x10,%esp
+}
+80106847:	c9                   	leave
+80106848:	c3                   	ret
+    return -1;
+80106849:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010684e:	eb f7                	jmp    80106847 <sys_schedlogread+0x53>
+    return -1;
+80106850:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106855:	eb f0                	jmp    80106847 <sys_schedlogread+0x53>
+
+80106857 <sys_nicefork>:
+
+int sys_nicefork(void)
+{
+80106857:	55                   	push   %ebp
+80106858:	89 e5                	mov    %esp,%ebp
+8010685a:	83 ec 20             	sub    $0x20,%esp
+  int nice_value;
+
+  if(argint(0, &nice_value) < 0)
+8010685d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106860:	50                   	push   %eax
+80106861:	6a 00                	push   $0x0
+80106863:	e8 49 f1 ff ff       	call   801059b1 <argint>
+80106868:	83 c4 10             	add    $0x10,%esp
+8010686b:	85 c0                	test   %eax,%eax
+8010686d:	78 10                	js     8010687f <sys_nicefork+0x28>
+    return -1;
+
+  return nicefork(nice_value);
+8010686f:	83 ec 0c             	sub    $0xc,%esp
+80106872:	ff 75 f4             	push   -0xc(%ebp)
+80106875:	e8 0b d9 ff ff       	call   80104185 <nicefork>
+8010687a:	83 c4 10             	add    $0x10,%esp
+}
+8010687d:	c9                   	leave
+8010687e:	c3                   	ret
+    return -1;
+8010687f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106884:	eb f7                	jmp    8010687d <sys_nicefork+0x26>
+
+80106886 <sys_tracectl>:
+
+// Set the enabled tracepoint categories (TRACE_* in trace.h)
+// and return the previous set, or -1 if tracepoints were
+// compiled out.
+int sys_tracectl(void)
+{
+80106886:	55                   	push   %ebp
+80106887:	89 e5                	mov    %esp,%ebp
+80106889:	83 ec 20             	sub    $0x20,%esp
+  int mask;
+
+  if(argint(0, &mask) < 0)
+8010688c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010688f:	50                   	push   %eax
+80106890:	6a 00                	push   $0x0
+80106892:	e8 1a f1 ff ff       	call   801059b1 <argint>
+80106897:	83 c4 10             	add    $0x10,%esp
+8010689a:	85 c0                	test   %eax,%eax
+8010689c:	78 10                	js     801068ae <sys_tracectl+0x28>
+    return -1;
+#ifdef NOTRACE
+  return -1;
+#else
+  int old = trace_mask;
+8010689e:	a1 00 a0 10 80       	mov    0x8010a000,%eax
+  trace_mask = mask;
+801068a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801068a6:	89 15 00 a0 10 80    	mov    %edx,0x8010a000
+  return old;
+#endif
+}
+801068ac:	c9                   	leave
+801068ad:	c3                   	ret
+    return -1;
+801068ae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801068b3:	eb f7                	jmp    801068ac <sys_tracectl+0x26>
+
+801068b5 <sys_getcpustat>:
+
+int sys_getcpustat(void)
+{
+801068b5:	55                   	push   %ebp
+801068b6:	89 e5                	mov    %esp,%ebp
+801068b8:	83 ec 20             	sub    $0x20,%esp
+  int n;
+  struct cpustat *st;
+
+  if(argint(0, &n) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+801068bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801068be:	50                   	push   %eax
+801068bf:	6a 00                	push   $0x0
+801068c1:	e8 eb f0 ff ff       	call   801059b1 <argint>
+801068c6:	83 c4 10             	add    $0x10,%esp
+801068c9:	85 c0                	test   %eax,%eax
+801068cb:	78 2a                	js     801068f7 <sys_getcpustat+0x42>
+801068cd:	83 ec 04             	sub    $0x4,%esp
+801068d0:	6a 14                	push   $0x14
+801068d2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801068d5:	50                   	push   %eax
+801068d6:	6a 01                	push   $0x1
+801068d8:	e8 fc f0 ff ff       	call   801059d9 <argptr>
+801068dd:	83 c4 10             	add    $0x10,%esp
+801068e0:	85 c0                	test   %eax,%eax
+801068e2:	78 13                	js     801068f7 <sys_getcpustat+0x42>
+    return -1;
+
+  return getcpustat(n, st);
+801068e4:	83 ec 08             	sub    $0x8,%esp
+801068e7:	ff 75 f0             	push   -0x10(%ebp)
+801068ea:	ff 75 f4             	push   -0xc(%ebp)
+801068ed:	e8 14 e3 ff ff       	call   80104c06 <getcpustat>
+801068f2:	83 c4 10             	add    $0x10,%esp
+}
+801068f5:	c9                   	leave
+801068f6:	c3                   	ret
+    return -1;
+801068f7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801068fc:	eb f7                	jmp    801068f5 <sys_getcpustat+0x40>
+
+801068fe <sys_setpolicy>:
+
+int sys_setpolicy(void)
+{
+801068fe:	55                   	push   %ebp
+801068ff:	89 e5                	mov    %esp,%ebp
+80106901:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+80106904:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106907:	50                   	push   %eax
+80106908:	6a 00                	push   $0x0
+8010690a:	e8 a2 f0 ff ff       	call   801059b1 <argint>
+8010690f:	83 c4 10             	add    $0x10,%esp
+80106912:	85 c0                	test   %eax,%eax
+80106914:	78 10                	js     80106926 <sys_setpolicy+0x28>
+    return -1;
+
+  return setpolicy(n);
+80106916:	83 ec 0c             	sub    $0xc,%esp
+80106919:	ff 75 f4             	push   -0xc(%ebp)
+8010691c:	e8 b6 d4 ff ff       	call   80103dd7 <setpolicy>
+80106921:	83 c4 10             	add    $0x10,%esp
+}
+80106924:	c9                   	leave
+80106925:	c3                   	ret
+    return -1;
+80106926:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010692b:	eb f7                	jmp    80106924 <sys_setpolicy+0x26>
+
+8010692d <sys_affinity>:
+
+int sys_affinity(void)
+{
+8010692d:	55                   	push   %ebp
+8010692e:	89 e5                	mov    %esp,%ebp
+80106930:	83 ec 20             	sub    $0x20,%esp
+  int window;
+
+  if(argint(0, &window) < 0)
+80106933:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106936:	50                   	push   %eax
+80106937:	6a 00                	push   $0x0
+80106939:	e8 73 f0 ff ff       	call   801059b1 <argint>
+8010693e:	83 c4 10             	add    $0x10,%esp
+80106941:	85 c0                	test   %eax,%eax
+80106943:	78 10                	js     80106955 <sys_affinity+0x28>
+    return -1;
+
+  return affinity(window);
+80106945:	83 ec 0c             	sub    $0xc,%esp
+80106948:	ff 75 f4             	push   -0xc(%ebp)
+8010694b:	e8 1e d2 ff ff       	call   80103b6e <affinity>
+80106950:	83 c4 10             	add    $0x10,%esp
+}
+80106953:	c9                   	leave
+80106954:	c3                   	ret
+    return -1;
+80106955:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010695a:	eb f7                	jmp    80106953 <sys_affinity+0x26>
+
+8010695c <sys_setnice>:
+
+int sys_setnice(void)
+{
+8010695c:	55                   	push   %ebp
+8010695d:	89 e5                	mov    %esp,%ebp
+8010695f:	83 ec 20             	sub    $0x20,%esp
+  int pid, value;
+
+  if(argint(0, &pid) < 0 || argint(1, &value) < 0)
+80106962:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106965:	50                   	push   %eax
+80106966:	6a 00                	push   $0x0
+80106968:	e8 44 f0 ff ff       	call   801059b1 <argint>
+8010696d:	83 c4 10             	add    $0x10,%esp
+80106970:	85 c0                	test   %eax,%eax
+80106972:	78 28                	js     8010699c <sys_setnice+0x40>
+80106974:	83 ec 08             	sub    $0x8,%esp
+80106977:	8d 45 f0             	lea    -0x10(%ebp),%eax
+8010697a:	50                   	push   %eax
+8010697b:	6a 01                	push   $0x1
+8010697d:	e8 2f f0 ff ff       	call   801059b1 <argint>
+80106982:	83 c4 10             	add    $0x10,%esp
+80106985:	85 c0                	test   %eax,%eax
+80106987:	78 13                	js     8010699c <sys_setnice+0x40>
+    return -1;
+
+  return setnice(pid, value);
+80106989:	83 ec 08             	sub    $0x8,%esp
+8010698c:	ff 75 f0             	push   -0x10(%ebp)
+8010698f:	ff 75 f4             	push   -0xc(%ebp)
+80106992:	e8 a2 df ff ff       	call   80104939 <setnice>
+80106997:	83 c4 10             	add    $0x10,%esp
+}
+8010699a:	c9                   	leave
+8010699b:	c3                   	ret
+    return -1;
+8010699c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801069a1:	eb f7                	jmp    8010699a <sys_setnice+0x3e>
+
+801069a3 <sys_getnice>:
+
+int sys_getnice(void)
+{
+801069a3:	55                   	push   %ebp
+801069a4:	89 e5                	mov    %esp,%ebp
+801069a6:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+801069a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801069ac:	50                   	push   %eax
+801069ad:	6a 00                	push   $0x0
+801069af:	e8 fd ef ff ff       	call   801059b1 <argint>
+801069b4:	83 c4 10             	add    $0x10,%esp
+801069b7:	85 c0                	test   %eax,%eax
+801069b9:	78 10                	js     801069cb <sys_getnice+0x28>
+    return NICE_NOPROC;
+
+  return getnice(pid);
+801069bb:	83 ec 0c             	sub    $0xc,%esp
+801069be:	ff 75 f4             	push   -0xc(%ebp)
+801069c1:	e8 11 e1 ff ff       	call   80104ad7 <getnice>
+801069c6:	83 c4 10             	add    $0x10,%esp
+}
+801069c9:	c9                   	leave
+801069ca:	c3                   	ret
+    return NICE_NOPROC;
+801069cb:	b8 64 00 00 00       	mov    $0x64,%eax
+801069d0:	eb f7                	jmp    801069c9 <sys_getnice+0x26>
+
+801069d2 <sys_setclass>:
+
+int sys_setclass(void)
+{
+801069d2:	55                   	push   %ebp
+801069d3:	89 e5                	mov    %esp,%ebp
+801069d5:	83 ec 20             	sub    $0x20,%esp
+  int pid, class;
+
+  if(argint(0, &pid) < 0 || argint(1, &class) < 0)
+801069d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801069db:	50                   	push   %eax
+801069dc:	6a 00                	push   $0x0
+801069de:	e8 ce ef ff ff       	call   801059b1 <argint>
+801069e3:	83 c4 10             	add    $0x10,%esp
+801069e6:	85 c0                	test   %eax,%eax
+801069e8:	78 28                	js     80106a12 <sys_setclass+0x40>
+801069ea:	83 ec 08             	sub    $0x8,%esp
+801069ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801069f0:	50                   	push   %eax
+801069f1:	6a 01                	push   $0x1
+801069f3:	e8 b9 ef ff ff       	call   801059b1 <argint>
+801069f8:	83 c4 10             	add    $0x10,%esp
+801069fb:	85 c0                	test   %eax,%eax
+801069fd:	78 13                	js     80106a12 <sys_setclass+0x40>
+    return -1;
+
+  return setclass(pid, class);
+801069ff:	83 ec 08             	sub    $0x8,%esp
+80106a02:	ff 75 f0             	push   -0x10(%ebp)
+80106a05:	ff 75 f4             	push   -0xc(%ebp)
+80106a08:	e8 0d e0 ff ff       	call   80104a1a <setclass>
+80106a0d:	83 c4 10             	add    $0x10,%esp
+}
+80106a10:	c9                   	leave
+80106a11:	c3                   	ret
+    return -1;
+80106a12:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106a17:	eb f7                	jmp    80106a10 <sys_setclass+0x3e>
+
+80106a19 <sys_isocpu>:
+
+int sys_isocpu(void)
+{
+80106a19:	55                   	push   %ebp
+80106a1a:	89 e5                	mov    %esp,%ebp
+80106a1c:	83 ec 20             	sub    $0x20,%esp
+  int percent;
+
+  if(argint(0, &percent) < 0)
+80106a1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106a22:	50                   	push   %eax
+80106a23:	6a 00                	push   $0x0
+80106a25:	e8 87 ef ff ff       	call   801059b1 <argint>
+80106a2a:	83 c4 10             	add    $0x10,%esp
+80106a2d:	85 c0                	test   %eax,%eax
+80106a2f:	78 10                	js     80106a41 <sys_isocpu+0x28>
+    return -1;
+
+  return isocpu(percent);
+80106a31:	83 ec 0c             	sub    $0xc,%esp
+80106a34:	ff 75 f4             	push   -0xc(%ebp)
+80106a37:	e8 11 d1 ff ff       	call   80103b4d <isocpu>
+80106a3c:	83 c4 10             	add    $0x10,%esp
+}
+80106a3f:	c9                   	leave
+80106a40:	c3                   	ret
+    return -1;
+80106a41:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106a46:	eb f7                	jmp    80106a3f <sys_isocpu+0x26>
+
+80106a48 <sys_getschedstats>:
+
+int sys_getschedstats(void)
+{
+80106a48:	55                   	push   %ebp
+80106a49:	89 e5                	mov    %esp,%ebp
+80106a4b:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+  struct schedstat *st;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+80106a4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106a51:	50                   	push   %eax
+80106a52:	6a 00                	push   $0x0
+80106a54:	e8 58 ef ff ff       	call   801059b1 <argint>
+80106a59:	83 c4 10             	add    $0x10,%esp
+80106a5c:	85 c0                	test   %eax,%eax
+80106a5e:	78 2a                	js     80106a8a <sys_getschedstats+0x42>
+80106a60:	83 ec 04             	sub    $0x4,%esp
+80106a63:	6a 28                	push   $0x28
+80106a65:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80106a68:	50                   	push   %eax
+80106a69:	6a 01                	push   $0x1
+80106a6b:	e8 69 ef ff ff       	call   801059d9 <argptr>
+80106a70:	83 c4 10             	add    $0x10,%esp
+80106a73:	85 c0                	test   %eax,%eax
+80106a75:	78 13                	js     80106a8a <sys_getschedstats+0x42>
+    return -1;
+
+  return getschedstats(pid, st);
+80106a77:	83 ec 08             	sub    $0x8,%esp
+80106a7a:	ff 75 f0             	push   -0x10(%ebp)
+80106a7d:	ff 75 f4             	push   -0xc(%ebp)
+80106a80:	e8 bb e0 ff ff       	call   80104b40 <getschedstats>
+80106a85:	83 c4 10             	add    $0x10,%esp
+}
+80106a88:	c9                   	leave
+80106a89:	c3                   	ret
+    return -1;
+80106a8a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106a8f:	eb f7                	jmp    80106a88 <sys_getschedstats+0x40>
+
+80106a91 <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+80106a91:	1e                   	push   %ds
+  pushl %es
+80106a92:	06                   	push   %es
+  pushl %fs
+80106a93:	0f a0                	push   %fs
+  pushl %gs
+80106a95:	0f a8                	push   %gs
+  pushal
+80106a97:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80106a98:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80106a9c:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80106a9e:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80106aa0:	54                   	push   %esp
+  call trap
+80106aa1:	e8 a8 01 00 00       	call   80106c4e <trap>
+  addl $4, %esp
+80106aa6:	83 c4 04             	add    $0x4,%esp
+
+80106aa9 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80106aa9:	61                   	popa
+  popl %gs
+80106aaa:	0f a9                	pop    %gs
+  popl %fs
+80106aac:	0f a1                	pop    %fs
+  popl %es
+80106aae:	07                   	pop    %es
+  popl %ds
+80106aaf:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80106ab0:	83 c4 08             	add    $0x8,%esp
+  iret
+80106ab3:	cf                   	iret
+
+80106ab4 <calibratetsc>:
+
+// Track the TSC cycles per timer tick as a moving average, so
+// runtime measured in cycles can be related to ticks.
+static void
+calibratetsc(void)
+{
+80106ab4:	55                   	push   %ebp
+80106ab5:	89 e5                	mov    %esp,%ebp
+80106ab7:	56                   	push   %esi
+80106ab8:	53                   	push   %ebx
+  asm volatile("rdtsc" : "=A" (tsc));
+80106ab9:	0f 31                	rdtsc
+80106abb:	89 d3                	mov    %edx,%ebx
+80106abd:	89 c2                	mov    %eax,%edx
+80106abf:	89 d9                	mov    %ebx,%ecx
+  static uint64 last;
+  uint64 now = rdtsc();
+  uint delta = now - last;
+80106ac1:	a1 e0 20 15 80       	mov    0x801520e0,%eax
+80106ac6:	89 d3                	mov    %edx,%ebx
+80106ac8:	29 c3                	sub    %eax,%ebx
+
+  if(last != 0)
+80106aca:	0b 05 e4 20 15 80    	or     0x801520e4,%eax
+80106ad0:	74 16                	je     80106ae8 <calibratetsc+0x34>
+    tsc_per_tick = tsc_per_tick - tsc_per_tick/4 + delta/4;
+80106ad2:	a1 60 c0 10 80       	mov    0x8010c060,%eax
+80106ad7:	89 c6                	mov    %eax,%esi
+80106ad9:	c1 ee 02             	shr    $0x2,%esi
+80106adc:	29 f0                	sub    %esi,%eax
+80106ade:	c1 eb 02             	shr    $0x2,%ebx
+80106ae1:	01 d8                	add    %ebx,%eax
+80106ae3:	a3 60 c0 10 80       	mov    %eax,0x8010c060
+  last = now;
+80106ae8:	89 15 e0 20 15 80    	mov    %edx,0x801520e0
+80106aee:	89 0d e4 20 15 80    	mov    %ecx,0x801520e4
+}
+80106af4:	5b                   	pop    %ebx
+80106af5:	5e                   	pop    %esi
+80106af6:	5d                   	pop    %ebp
+80106af7:	c3                   	ret
+
+80106af8 <readticks64>:
+
+// Read ticks64.  Loading it takes two 32-bit loads, so CPU 0 could
+// update it halfway through; the sequence count detects that.
+uint64
+readticks64(void)
+{
+80106af8:	55                   	push   %ebp
+80106af9:	89 e5                	mov    %esp,%ebp
+80106afb:	53                   	push   %ebx
+  uint seq;
+  uint64 t;
+
+  do{
+    seq = ticks64seq;
+80106afc:	8b 15 e8 20 15 80    	mov    0x801520e8,%edx
+    t = ticks64;
+80106b02:	8b 0d 80 18 15 80    	mov    0x80151880,%ecx
+80106b08:	8b 1d 84 18 15 80    	mov    0x80151884,%ebx
+  } while((seq & 1) || seq != ticks64seq);
+80106b0e:	f6 c2 01             	test   $0x1,%dl
+80106b11:	75 e9                	jne    80106afc <readticks64+0x4>
+80106b13:	a1 e8 20 15 80       	mov    0x801520e8,%eax
+80106b18:	39 d0                	cmp    %edx,%eax
+80106b1a:	75 e0                	jne    80106afc <readticks64+0x4>
+  return t;
+}
+80106b1c:	89 c8                	mov    %ecx,%eax
+80106b1e:	89 da                	mov    %ebx,%edx
+80106b20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106b23:	c9                   	leave
+80106b24:	c3                   	ret
+
+80106b25 <tvinit>:
+
+void
+tvinit(void)
+{
+80106b25:	55                   	push   %ebp
+80106b26:	89 e5                	mov    %esp,%ebp
+80106b28:	53                   	push   %ebx
+80106b29:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80106b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+80106b31:	eb 76                	jmp    80106ba9 <tvinit+0x84>
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80106b33:	8b 0c 85 64 c0 10 80 	mov    -0x7fef3f9c(,%eax,4),%ecx
+80106b3a:	66 89 0c c5 e0 18 15 	mov    %cx,-0x7feae720(,%eax,8)
+80106b41:	80 
+80106b42:	66 c7 04 c5 e2 18 15 	movw   $0x8,-0x7feae71e(,%eax,8)
+80106b49:	80 08 00 
+80106b4c:	0f b6 14 c5 e4 18 15 	movzbl -0x7feae71c(,%eax,8),%edx
+80106b53:	80 
+80106b54:	83 e2 e0             	and    $0xffffffe0,%edx
+80106b57:	88 14 c5 e4 18 15 80 	mov    %dl,-0x7feae71c(,%eax,8)
+80106b5e:	c6 04 c5 e4 18 15 80 	movb   $0x0,-0x7feae71c(,%eax,8)
+80106b65:	00 
+80106b66:	0f b6 14 c5 e5 18 15 	movzbl -0x7feae71b(,%eax,8),%edx
+80106b6d:	80 
+80106b6e:	83 e2 f0             	and    $0xfffffff0,%edx
+80106b71:	83 ca 0e             	or     $0xe,%edx
+80106b74:	88 14 c5 e5 18 15 80 	mov    %dl,-0x7feae71b(,%eax,8)
+80106b7b:	89 d3                	mov    %edx,%ebx
+80106b7d:	83 e3 ef             	and    $0xffffffef,%ebx
+80106b80:	88 1c c5 e5 18 15 80 	mov    %bl,-0x7feae71b(,%eax,8)
+80106b87:	83 e2 8f             	and    $0xffffff8f,%edx
+80106b8a:	88 14 c5 e5 18 15 80 	mov    %dl,-0x7feae71b(,%eax,8)
+80106b91:	83 ca 80             	or     $0xffffff80,%edx
+80106b94:	88 14 c5 e5 18 15 80 	mov    %dl,-0x7feae71b(,%eax,8)
+80106b9b:	c1 e9 10             	shr    $0x10,%ecx
+80106b9e:	66 89 0c c5 e6 18 15 	mov    %cx,-0x7feae71a(,%eax,8)
+80106ba5:	80 
+  for(i = 0; i < 256; i++)
+80106ba6:	83 c0 01             	add    $0x1,%eax
+80106ba9:	3d ff 00 00 00       	cmp    $0xff,%eax
+80106bae:	7e 83                	jle    80106b33 <tvinit+0xe>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80106bb0:	8b 15 64 c1 10 80    	mov    0x8010c164,%edx
+80106bb6:	66 89 15 e0 1a 15 80 	mov    %dx,0x80151ae0
+80106bbd:	66 c7 05 e2 1a 15 80 	movw   $0x8,0x80151ae2
+80106bc4:	08 00 
+80106bc6:	0f b6 05 e4 1a 15 80 	movzbl 0x80151ae4,%eax
+80106bcd:	83 e0 e0             	and    $0xffffffe0,%eax
+80106bd0:	a2 e4 1a 15 80       	mov    %al,0x80151ae4
+80106bd5:	c6 05 e4 1a 15 80 00 	movb   $0x0,0x80151ae4
+80106bdc:	0f b6 05 e5 1a 15 80 	movzbl 0x80151ae5,%eax
+80106be3:	83 c8 0f             	or     $0xf,%eax
+80106be6:	a2 e5 1a 15 80       	mov    %al,0x80151ae5
+80106beb:	83 e0 ef             	and    $0xffffffef,%eax
+80106bee:	a2 e5 1a 15 80       	mov    %al,0x80151ae5
+80106bf3:	89 c1                	mov    %eax,%ecx
+80106bf5:	83 c9 60             	or     $0x60,%ecx
+80106bf8:	88 0d e5 1a 15 80    	mov    %cl,0x80151ae5
+80106bfe:	83 c8 e0             	or     $0xffffffe0,%eax
+80106c01:	a2 e5 1a 15 80       	mov    %al,0x80151ae5
+80106c06:	c1 ea 10             	shr    $0x10,%edx
+80106c09:	66 89 15 e6 1a 15 80 	mov    %dx,0x80151ae6
+
+  initlock(&tickslock, "time");
+80106c10:	83 ec 08             	sub    $0x8,%esp
+80106c13:	68 91 8e 10 80       	push   $0x80108e91
+80106c18:	68 a0 18 15 80       	push   $0x801518a0
+80106c1d:	e8 4f e9 ff ff       	call   80105571 <initlock>
+}
+80106c22:	83 c4 10             	add    $0x10,%esp
+80106c25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106c28:	c9                   	leave
+80106c29:	c3                   	ret
+
+80106c2a <idtinit>:
+
+void
+idtinit(void)
+{
+80106c2a:	55                   	push   %ebp
+80106c2b:	89 e5                	mov    %esp,%ebp
+80106c2d:	83 ec 10             	sub    $0x10,%esp
+  pd[0] = size-1;
+80106c30:	66 c7 45 fa ff 07    	movw   $0x7ff,-0x6(%ebp)
+  pd[1] = (uint)p;
+80106c36:	b8 e0 18 15 80       	mov    $0x801518e0,%eax
+80106c3b:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80106c3f:	c1 e8 10             	shr    $0x10,%eax
+80106c42:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+80106c46:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80106c49:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80106c4c:	c9                   	leave
+80106c4d:	c3                   	ret
+
+80106c4e <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80106c4e:	55                   	push   %ebp
+80106c4f:	89 e5                	mov    %esp,%ebp
+80106c51:	57                   	push   %edi
+80106c52:	56                   	push   %esi
+80106c53:	53                   	push   %ebx
+80106c54:	83 ec 1c             	sub    $0x1c,%esp
+80106c57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+80106c5a:	8b 43 30             	mov    0x30(%ebx),%eax
+80106c5d:	83 f8 40             	cmp    $0x40,%eax
+80106c60:	74 13                	je     80106c75 <trap+0x27>
+      exit();
+    checkresched();
+    return;
+  }
+
+  switch(tf->trapno){
+80106c62:	83 e8 20             	sub    $0x20,%eax
+80106c65:	83 f8 1f             	cmp    $0x1f,%eax
+80106c68:	0f 87 ab 01 00 00    	ja     80106e19 <trap+0x1cb>
+80106c6e:	ff 24 85 38 8f 10 80 	jmp    *-0x7fef70c8(,%eax,4)
+    if(myproc()->killed)
+80106c75:	e8 54 d3 ff ff       	call   80103fce <myproc>
+80106c7a:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80106c7e:	75 22                	jne    80106ca2 <trap+0x54>
+    myproc()->tf = tf;
+80106c80:	e8 49 d3 ff ff       	call   80103fce <myproc>
+80106c85:	89 58 18             	mov    %ebx,0x18(%eax)
+    syscall();
+80106c88:	e8 e7 ed ff ff       	call   80105a74 <syscall>
+    if(myproc()->killed)
+80106c8d:	e8 3c d3 ff ff       	call   80103fce <myproc>
+80106c92:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80106c96:	75 11                	jne    80106ca9 <trap+0x5b>
+    checkresched();
+80106c98:	e8 22 da ff ff       	call   801046bf <checkresched>
+    return;
+80106c9d:	e9 9b 00 00 00       	jmp    80106d3d <trap+0xef>
+      exit();
+80106ca2:	e8 1d d9 ff ff       	call   801045c4 <exit>
+80106ca7:	eb d7                	jmp    80106c80 <trap+0x32>
+      exit();
+80106ca9:	e8 16 d9 ff ff       	call   801045c4 <exit>
+80106cae:	eb e8                	jmp    80106c98 <trap+0x4a>
+  case T_IRQ0 + IRQ_TIMER:
+    if(cpuid() == 0){
+80106cb0:	e8 4e d0 ff ff       	call   80103d03 <cpuid>
+80106cb5:	85 c0                	test   %eax,%eax
+80106cb7:	0f 84 88 00 00 00    	je     80106d45 <trap+0xf7>
+      ticks64seq++;
+      wakeup(&ticks);
+      release(&tickslock);
+      isotick();
+    }
+    mycpu()->ticks++;
+80106cbd:	e8 41 cf ff ff       	call   80103c03 <mycpu>
+80106cc2:	8b 88 bc 00 00 00    	mov    0xbc(%eax),%ecx
+80106cc8:	8d 51 01             	lea    0x1(%ecx),%edx
+80106ccb:	89 90 bc 00 00 00    	mov    %edx,0xbc(%eax)
+    lapiceoi();
+80106cd1:	e8 e3 b6 ff ff       	call   801023b9 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80106cd6:	e8 f3 d2 ff ff       	call   80103fce <myproc>
+80106cdb:	85 c0                	test   %eax,%eax
+80106cdd:	74 1c                	je     80106cfb <trap+0xad>
+80106cdf:	e8 ea d2 ff ff       	call   80103fce <myproc>
+80106ce4:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80106ce8:	74 11                	je     80106cfb <trap+0xad>
+80106cea:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80106cee:	83 e0 03             	and    $0x3,%eax
+80106cf1:	66 83 f8 03          	cmp    $0x3,%ax
+80106cf5:	0f 84 b1 01 00 00    	je     80106eac <trap+0x25e>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80106cfb:	e8 ce d2 ff ff       	call   80103fce <myproc>
+80106d00:	85 c0                	test   %eax,%eax
+80106d02:	74 0f                	je     80106d13 <trap+0xc5>
+80106d04:	e8 c5 d2 ff ff       	call   80103fce <myproc>
+80106d09:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80106d0d:	0f 84 a3 01 00 00    	je     80106eb6 <trap+0x268>
+     tf->trapno == T_IRQ0+IRQ_TIMER)
+    if(schedtick(myproc()))
+      yield();
+
+  // Or because a wakeup asked for this CPU.
+  checkresched();
+80106d13:	e8 a7 d9 ff ff       	call   801046bf <checkresched>
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80106d18:	e8 b1 d2 ff ff       	call   80103fce <myproc>
+80106d1d:	85 c0                	test   %eax,%eax
+80106d1f:	74 1c                	je     80106d3d <trap+0xef>
+80106d21:	e8 a8 d2 ff ff       	call   80103fce <myproc>
+80106d26:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80106d2a:	74 11                	je     80106d3d <trap+0xef>
+80106d2c:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80106d30:	83 e0 03             	and    $0x3,%eax
+80106d33:	66 83 f8 03          	cmp    $0x3,%ax
+80106d37:	0f 84 a6 01 00 00    	je     80106ee3 <trap+0x295>
+    exit();
+}
+80106d3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106d40:	5b                   	pop    %ebx
+80106d41:	5e                   	pop    %esi
+80106d42:	5f                   	pop    %edi
+80106d43:	5d                   	pop    %ebp
+80106d44:	c3                   	ret
+      calibratetsc();
+80106d45:	e8 6a fd ff ff       	call   80106ab4 <calibratetsc>
+      acquire(&tickslock);
+80106d4a:	83 ec 0c             	sub    $0xc,%esp
+80106d4d:	68 a0 18 15 80       	push   $0x801518a0
+80106d52:	e8 5e e9 ff ff       	call   801056b5 <acquire>
+      ticks++;
+80106d57:	83 05 88 18 15 80 01 	addl   $0x1,0x80151888
+      ticks64seq++;
+80106d5e:	a1 e8 20 15 80       	mov    0x801520e8,%eax
+80106d63:	83 c0 01             	add    $0x1,%eax
+80106d66:	a3 e8 20 15 80       	mov    %eax,0x801520e8
+      ticks64++;
+80106d6b:	a1 80 18 15 80       	mov    0x80151880,%eax
+80106d70:	8b 15 84 18 15 80    	mov    0x80151884,%edx
+80106d76:	83 c0 01             	add    $0x1,%eax
+80106d79:	83 d2 00             	adc    $0x0,%edx
+80106d7c:	a3 80 18 15 80       	mov    %eax,0x80151880
+80106d81:	89 15 84 18 15 80    	mov    %edx,0x80151884
+      ticks64seq++;
+80106d87:	a1 e8 20 15 80       	mov    0x801520e8,%eax
+80106d8c:	83 c0 01             	add    $0x1,%eax
+80106d8f:	a3 e8 20 15 80       	mov    %eax,0x801520e8
+      wakeup(&ticks);
+80106d94:	c7 04 24 88 18 15 80 	movl   $0x80151888,(%esp)
+80106d9b:	e8 fc da ff ff       	call   8010489c <wakeup>
+      release(&tickslock);
+80106da0:	c7 04 24 a0 18 15 80 	movl   $0x801518a0,(%esp)
+80106da7:	e8 6e e9 ff ff       	call   8010571a <release>
+      isotick();
+80106dac:	e8 1c cd ff ff       	call   80103acd <isotick>
+80106db1:	83 c4 10             	add    $0x10,%esp
+80106db4:	e9 04 ff ff ff       	jmp    80106cbd <trap+0x6f>
+    lapiceoi();
+80106db9:	e8 fb b5 ff ff       	call   801023b9 <lapiceoi>
+    break;
+80106dbe:	e9 13 ff ff ff       	jmp    80106cd6 <trap+0x88>
+    ideintr();
+80106dc3:	e8 6e af ff ff       	call   80101d36 <ideintr>
+    lapiceoi();
+80106dc8:	e8 ec b5 ff ff       	call   801023b9 <lapiceoi>
+    break;
+80106dcd:	e9 04 ff ff ff       	jmp    80106cd6 <trap+0x88>
+    kbdintr();
+80106dd2:	e8 ee b3 ff ff       	call   801021c5 <kbdintr>
+    lapiceoi();
+80106dd7:	e8 dd b5 ff ff       	call   801023b9 <lapiceoi>
+    break;
+80106ddc:	e9 f5 fe ff ff       	jmp    80106cd6 <trap+0x88>
+    uartintr();
+80106de1:	e8 17 02 00 00       	call   80106ffd <uartintr>
+    lapiceoi();
+80106de6:	e8 ce b5 ff ff       	call   801023b9 <lapiceoi>
+    break;
+80106deb:	e9 e6 fe ff ff       	jmp    80106cd6 <trap+0x88>
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80106df0:	8b 7b 38             	mov    0x38(%ebx),%edi
+            cpuid(), tf->cs, tf->eip);
+80106df3:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80106df7:	e8 07 cf ff ff       	call   80103d03 <cpuid>
+80106dfc:	57                   	push   %edi
+80106dfd:	0f b7 f6             	movzwl %si,%esi
+80106e00:	56                   	push   %esi
+80106e01:	50                   	push   %eax
+80106e02:	68 9c 8e 10 80       	push   $0x80108e9c
+80106e07:	e8 23 98 ff ff       	call   8010062f <cprintf>
+    lapiceoi();
+80106e0c:	e8 a8 b5 ff ff       	call   801023b9 <lapiceoi>
+    break;
+80106e11:	83 c4 10             	add    $0x10,%esp
+80106e14:	e9 bd fe ff ff       	jmp    80106cd6 <trap+0x88>
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80106e19:	e8 b0 d1 ff ff       	call   80103fce <myproc>
+80106e1e:	85 c0                	test   %eax,%eax
+80106e20:	74 5f                	je     80106e81 <trap+0x233>
+80106e22:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80106e26:	74 59                	je     80106e81 <trap+0x233>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80106e28:	0f 20 d7             	mov    %cr2,%edi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80106e2b:	8b 43 38             	mov    0x38(%ebx),%eax
+80106e2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106e31:	e8 cd ce ff ff       	call   80103d03 <cpuid>
+80106e36:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106e39:	8b 53 34             	mov    0x34(%ebx),%edx
+80106e3c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80106e3f:	8b 73 30             	mov    0x30(%ebx),%esi
+            myproc()->pid, myproc()->name, tf->trapno,
+80106e42:	e8 87 d1 ff ff       	call   80103fce <myproc>
+80106e47:	8d 48 74             	lea    0x74(%eax),%ecx
+80106e4a:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80106e4d:	e8 7c d1 ff ff       	call   80103fce <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80106e52:	57                   	push   %edi
+80106e53:	ff 75 e4             	push   -0x1c(%ebp)
+80106e56:	ff 75 e0             	push   -0x20(%ebp)
+80106e59:	ff 75 dc             	push   -0x24(%ebp)
+80106e5c:	56                   	push   %esi
+80106e5d:	ff 75 d8             	push   -0x28(%ebp)
+80106e60:	ff 70 10             	push   0x10(%eax)
+80106e63:	68 f4 8e 10 80       	push   $0x80108ef4
+80106e68:	e8 c2 97 ff ff       	call   8010062f <cprintf>
+    myproc()->killed = 1;
+80106e6d:	83 c4 20             	add    $0x20,%esp
+80106e70:	e8 59 d1 ff ff       	call   80103fce <myproc>
+80106e75:	c7 40 2c 01 00 00 00 	movl   $0x1,0x2c(%eax)
+80106e7c:	e9 55 fe ff ff       	jmp    80106cd6 <trap+0x88>
+80106e81:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80106e84:	8b 73 38             	mov    0x38(%ebx),%esi
+80106e87:	e8 77 ce ff ff       	call   80103d03 <cpuid>
+80106e8c:	83 ec 0c             	sub    $0xc,%esp
+80106e8f:	57                   	push   %edi
+80106e90:	56                   	push   %esi
+80106e91:	50                   	push   %eax
+80106e92:	ff 73 30             	push   0x30(%ebx)
+80106e95:	68 c0 8e 10 80       	push   $0x80108ec0
+80106e9a:	e8 90 97 ff ff       	call   8010062f <cprintf>
+      panic("trap");
+80106e9f:	83 c4 14             	add    $0x14,%esp
+80106ea2:	68 96 8e 10 80       	push   $0x80108e96
+80106ea7:	e8 c2 94 ff ff       	call   8010036e <panic>
+    exit();
+80106eac:	e8 13 d7 ff ff       	call   801045c4 <exit>
+80106eb1:	e9 45 fe ff ff       	jmp    80106cfb <trap+0xad>
+  if(myproc() && myproc()->state == RUNNING &&
+80106eb6:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+80106eba:	0f 85 53 fe ff ff    	jne    80106d13 <trap+0xc5>
+    if(schedtick(myproc()))
+80106ec0:	e8 09 d1 ff ff       	call   80103fce <myproc>
+80106ec5:	83 ec 0c             	sub    $0xc,%esp
+80106ec8:	50                   	push   %eax
+80106ec9:	e8 01 ce ff ff       	call   80103ccf <schedtick>
+80106ece:	83 c4 10             	add    $0x10,%esp
+80106ed1:	85 c0                	test   %eax,%eax
+80106ed3:	0f 84 3a fe ff ff    	je     80106d13 <trap+0xc5>
+      yield();
+80106ed9:	e8 af d7 ff ff       	call   8010468d <yield>
+80106ede:	e9 30 fe ff ff       	jmp    80106d13 <trap+0xc5>
+    exit();
+80106ee3:	e8 dc d6 ff ff       	call   801045c4 <exit>
+80106ee8:	e9 50 fe ff ff       	jmp    80106d3d <trap+0xef>
+
+80106eed <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80106eed:	83 3d ec 20 15 80 00 	cmpl   $0x0,0x801520ec
+80106ef4:	74 14                	je     80106f0a <uartgetc+0x1d>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80106ef6:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80106efb:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+80106efc:	a8 01                	test   $0x1,%al
+80106efe:	74 10                	je     80106f10 <uartgetc+0x23>
+80106f00:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106f05:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80106f06:	0f b6 c0             	movzbl %al,%eax
+80106f09:	c3                   	ret
+    return -1;
+80106f0a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106f0f:	c3                   	ret
+    return -1;
+80106f10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106f15:	c3                   	ret
+
+80106f16 <uartputc>:
+  if(!uart)
+80106f16:	83 3d ec 20 15 80 00 	cmpl   $0x0,0x801520ec
+80106f1d:	74 3b                	je     80106f5a <uartputc+0x44>
+{
+80106f1f:	55                   	push   %ebp
+80106f20:	89 e5                	mov    %esp,%ebp
+80106f22:	53                   	push   %ebx
+80106f23:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106f26:	bb 00 00 00 00       	mov    $0x0,%ebx
+80106f2b:	eb 10                	jmp    80106f3d <uartputc+0x27>
+    microdelay(10);
+80106f2d:	83 ec 0c             	sub    $0xc,%esp
+80106f30:	6a 0a                	push   $0xa
+80106f32:	e8 a3 b4 ff ff       	call   801023da <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106f37:	83 c3 01             	add    $0x1,%ebx
+80106f3a:	83 c4 10             	add    $0x10,%esp
+80106f3d:	83 fb 7f             	cmp    $0x7f,%ebx
+80106f40:	7f 0a                	jg     80106f4c <uartputc+0x36>
+80106f42:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80106f47:	ec                   	in     (%dx),%al
+80106f48:	a8 20                	test   $0x20,%al
+80106f4a:	74 e1                	je     80106f2d <uartputc+0x17>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80106f4c:	8b 45 08             	mov    0x8(%ebp),%eax
+80106f4f:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106f54:	ee                   	out    %al,(%dx)
+}
+80106f55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106f58:	c9                   	leave
+80106f59:	c3                   	ret
+80106f5a:	c3                   	ret
+
+80106f5b <uartinit>:
+{
+80106f5b:	55                   	push   %ebp
+80106f5c:	89 e5                	mov    %esp,%ebp
+80106f5e:	56                   	push   %esi
+80106f5f:	53                   	push   %ebx
+80106f60:	b9 00 00 00 00       	mov    $0x0,%ecx
+80106f65:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80106f6a:	89 c8                	mov    %ecx,%eax
+80106f6c:	ee                   	out    %al,(%dx)
+80106f6d:	be fb 03 00 00       	mov    $0x3fb,%esi
+80106f72:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80106f77:	89 f2                	mov    %esi,%edx
+80106f79:	ee                   	out    %al,(%dx)
+80106f7a:	b8 0c 00 00 00       	mov    $0xc,%eax
+80106f7f:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106f84:	ee                   	out    %al,(%dx)
+80106f85:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80106f8a:	89 c8                	mov    %ecx,%eax
+80106f8c:	89 da                	mov    %ebx,%edx
+80106f8e:	ee                   	out    %al,(%dx)
+80106f8f:	b8 03 00 00 00       	mov    $0x3,%eax
+80106f94:	89 f2                	mov    %esi,%edx
+80106f96:	ee                   	out    %al,(%dx)
+80106f97:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80106f9c:	89 c8                	mov    %ecx,%eax
+80106f9e:	ee                   	out    %al,(%dx)
+80106f9f:	b8 01 00 00 00       	mov    $0x1,%eax
+80106fa4:	89 da                	mov    %ebx,%edx
+80106fa6:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80106fa7:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80106fac:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80106fad:	3c ff                	cmp    $0xff,%al
+80106faf:	74 45                	je     80106ff6 <uartinit+0x9b>
+  uart = 1;
+80106fb1:	c7 05 ec 20 15 80 01 	movl   $0x1,0x801520ec
+80106fb8:	00 00 00 
+80106fbb:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80106fc0:	ec                   	in     (%dx),%al
+80106fc1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106fc6:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+80106fc7:	83 ec 08             	sub    $0x8,%esp
+80106fca:	6a 00                	push   $0x0
+80106fcc:	6a 04                	push   $0x4
+80106fce:	e8 6d af ff ff       	call   80101f40 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80106fd3:	83 c4 10             	add    $0x10,%esp
+80106fd6:	bb b8 8f 10 80       	mov    $0x80108fb8,%ebx
+80106fdb:	eb 12                	jmp    80106fef <uartinit+0x94>
+    uartputc(*p);
+80106fdd:	83 ec 0c             	sub    $0xc,%esp
+80106fe0:	0f be c0             	movsbl %al,%eax
+80106fe3:	50                   	push   %eax
+80106fe4:	e8 2d ff ff ff       	call   80106f16 <uartputc>
+  for(p="xv6...\n"; *p; p++)
+80106fe9:	83 c3 01             	add    $0x1,%ebx
+80106fec:	83 c4 10             	add    $0x10,%esp
+80106fef:	0f b6 03             	movzbl (%ebx),%eax
+80106ff2:	84 c0                	test   %al,%al
+80106ff4:	75 e7                	jne    80106fdd <uartinit+0x82>
+}
+80106ff6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106ff9:	5b                   	pop    %ebx
+80106ffa:	5e                   	pop    %esi
+80106ffb:	5d                   	pop    %ebp
+80106ffc:	c3                   	ret
+
+80106ffd <uartintr>:
+
+void
+uartintr(void)
+{
+80106ffd:	55                   	push   %ebp
+80106ffe:	89 e5                	mov    %esp,%ebp
+80107000:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80107003:	68 ed 6e 10 80       	push   $0x80106eed
+80107008:	e8 14 97 ff ff       	call   80100721 <consoleintr>
+}
+8010700d:	83 c4 10             	add    $0x10,%esp
+80107010:	c9                   	leave
+80107011:	c3                   	ret
+
+80107012 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80107012:	6a 00                	push   $0x0
+  pushl $0
+80107014:	6a 00                	push   $0x0
+  jmp alltraps
+80107016:	e9 76 fa ff ff       	jmp    80106a91 <alltraps>
+
+8010701b <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+8010701b:	6a 00                	push   $0x0
+  pushl $1
+8010701d:	6a 01                	push   $0x1
+  jmp alltraps
+8010701f:	e9 6d fa ff ff       	jmp    80106a91 <alltraps>
+
+80107024 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80107024:	6a 00                	push   $0x0
+  pushl $2
+80107026:	6a 02                	push   $0x2
+  jmp alltraps
+80107028:	e9 64 fa ff ff       	jmp    80106a91 <alltraps>
+
+8010702d <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+8010702d:	6a 00                	push   $0x0
+  pushl $3
+8010702f:	6a 03                	push   $0x3
+  jmp alltraps
+80107031:	e9 5b fa ff ff       	jmp    80106a91 <alltraps>
+
+80107036 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80107036:	6a 00                	push   $0x0
+  pushl $4
+80107038:	6a 04                	push   $0x4
+  jmp alltraps
+8010703a:	e9 52 fa ff ff       	jmp    80106a91 <alltraps>
+
+8010703f <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+8010703f:	6a 00                	push   $0x0
+  pushl $5
+80107041:	6a 05                	push   $0x5
+  jmp alltraps
+80107043:	e9 49 fa ff ff       	jmp    80106a91 <alltraps>
+
+80107048 <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+80107048:	6a 00                	push   $0x0
+  pushl $6
+8010704a:	6a 06                	push   $0x6
+  jmp alltraps
+8010704c:	e9 40 fa ff ff       	jmp    80106a91 <alltraps>
+
+80107051 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80107051:	6a 00                	push   $0x0
+  pushl $7
+80107053:	6a 07                	push   $0x7
+  jmp alltraps
+80107055:	e9 37 fa ff ff       	jmp    80106a91 <alltraps>
+
+8010705a <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+8010705a:	6a 08                	push   $0x8
+  jmp alltraps
+8010705c:	e9 30 fa ff ff       	jmp    80106a91 <alltraps>
+
+80107061 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80107061:	6a 00                	push   $0x0
+  pushl $9
+80107063:	6a 09                	push   $0x9
+  jmp alltraps
+80107065:	e9 27 fa ff ff       	jmp    80106a91 <alltraps>
+
+8010706a <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+8010706a:	6a 0a                	push   $0xa
+  jmp alltraps
+8010706c:	e9 20 fa ff ff       	jmp    80106a91 <alltraps>
+
+80107071 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80107071:	6a 0b                	push   $0xb
+  jmp alltraps
+80107073:	e9 19 fa ff ff       	jmp    80106a91 <alltraps>
+
+80107078 <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+80107078:	6a 0c                	push   $0xc
+  jmp alltraps
+8010707a:	e9 12 fa ff ff       	jmp    80106a91 <alltraps>
+
+8010707f <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+8010707f:	6a 0d                	push   $0xd
+  jmp alltraps
+80107081:	e9 0b fa ff ff       	jmp    80106a91 <alltraps>
+
+80107086 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80107086:	6a 0e                	push   $0xe
+  jmp alltraps
+80107088:	e9 04 fa ff ff       	jmp    80106a91 <alltraps>
+
+8010708d <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+8010708d:	6a 00                	push   $0x0
+  pushl $15
+8010708f:	6a 0f                	push   $0xf
+  jmp alltraps
+80107091:	e9 fb f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107096 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80107096:	6a 00                	push   $0x0
+  pushl $16
+80107098:	6a 10                	push   $0x10
+  jmp alltraps
+8010709a:	e9 f2 f9 ff ff       	jmp    80106a91 <alltraps>
+
+8010709f <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+8010709f:	6a 11                	push   $0x11
+  jmp alltraps
+801070a1:	e9 eb f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070a6 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+801070a6:	6a 00                	push   $0x0
+  pushl $18
+801070a8:	6a 12                	push   $0x12
+  jmp alltraps
+801070aa:	e9 e2 f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070af <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+801070af:	6a 00                	push   $0x0
+  pushl $19
+801070b1:	6a 13                	push   $0x13
+  jmp alltraps
+801070b3:	e9 d9 f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070b8 <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+801070b8:	6a 00                	push   $0x0
+  pushl $20
+801070ba:	6a 14                	push   $0x14
+  jmp alltraps
+801070bc:	e9 d0 f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070c1 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+801070c1:	6a 00                	push   $0x0
+  pushl $21
+801070c3:	6a 15                	push   $0x15
+  jmp alltraps
+801070c5:	e9 c7 f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070ca <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+801070ca:	6a 00                	push   $0x0
+  pushl $22
+801070cc:	6a 16                	push   $0x16
+  jmp alltraps
+801070ce:	e9 be f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070d3 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+801070d3:	6a 00                	push   $0x0
+  pushl $23
+801070d5:	6a 17                	push   $0x17
+  jmp alltraps
+801070d7:	e9 b5 f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070dc <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+801070dc:	6a 00                	push   $0x0
+  pushl $24
+801070de:	6a 18                	push   $0x18
+  jmp alltraps
+801070e0:	e9 ac f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070e5 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+801070e5:	6a 00                	push   $0x0
+  pushl $25
+801070e7:	6a 19                	push   $0x19
+  jmp alltraps
+801070e9:	e9 a3 f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070ee <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+801070ee:	6a 00                	push   $0x0
+  pushl $26
+801070f0:	6a 1a                	push   $0x1a
+  jmp alltraps
+801070f2:	e9 9a f9 ff ff       	jmp    80106a91 <alltraps>
+
+801070f7 <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+801070f7:	6a 00                	push   $0x0
+  pushl $27
+801070f9:	6a 1b                	push   $0x1b
+  jmp alltraps
+801070fb:	e9 91 f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107100 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80107100:	6a 00                	push   $0x0
+  pushl $28
+80107102:	6a 1c                	push   $0x1c
+  jmp alltraps
+80107104:	e9 88 f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107109 <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+80107109:	6a 00                	push   $0x0
+  pushl $29
+8010710b:	6a 1d                	push   $0x1d
+  jmp alltraps
+8010710d:	e9 7f f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107112 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80107112:	6a 00                	push   $0x0
+  pushl $30
+80107114:	6a 1e                	push   $0x1e
+  jmp alltraps
+80107116:	e9 76 f9 ff ff       	jmp    80106a91 <alltraps>
+
+8010711b <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+8010711b:	6a 00                	push   $0x0
+  pushl $31
+8010711d:	6a 1f                	push   $0x1f
+  jmp alltraps
+8010711f:	e9 6d f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107124 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80107124:	6a 00                	push   $0x0
+  pushl $32
+80107126:	6a 20                	push   $0x20
+  jmp alltraps
+80107128:	e9 64 f9 ff ff       	jmp    80106a91 <alltraps>
+
+8010712d <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+8010712d:	6a 00                	push   $0x0
+  pushl $33
+8010712f:	6a 21                	push   $0x21
+  jmp alltraps
+80107131:	e9 5b f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107136 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80107136:	6a 00                	push   $0x0
+  pushl $34
+80107138:	6a 22                	push   $0x22
+  jmp alltraps
+8010713a:	e9 52 f9 ff ff       	jmp    80106a91 <alltraps>
+
+8010713f <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+8010713f:	6a 00                	push   $0x0
+  pushl $35
+80107141:	6a 23                	push   $0x23
+  jmp alltraps
+80107143:	e9 49 f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107148 <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+80107148:	6a 00                	push   $0x0
+  pushl $36
+8010714a:	6a 24                	push   $0x24
+  jmp alltraps
+8010714c:	e9 40 f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107151 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80107151:	6a 00                	push   $0x0
+  pushl $37
+80107153:	6a 25                	push   $0x25
+  jmp alltraps
+80107155:	e9 37 f9 ff ff       	jmp    80106a91 <alltraps>
+
+8010715a <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+8010715a:	6a 00                	push   $0x0
+  pushl $38
+8010715c:	6a 26                	push   $0x26
+  jmp alltraps
+8010715e:	e9 2e f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107163 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80107163:	6a 00                	push   $0x0
+  pushl $39
+80107165:	6a 27                	push   $0x27
+  jmp alltraps
+80107167:	e9 25 f9 ff ff       	jmp    80106a91 <alltraps>
+
+8010716c <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+8010716c:	6a 00                	push   $0x0
+  pushl $40
+8010716e:	6a 28                	push   $0x28
+  jmp alltraps
+80107170:	e9 1c f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107175 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80107175:	6a 00                	push   $0x0
+  pushl $41
+80107177:	6a 29                	push   $0x29
+  jmp alltraps
+80107179:	e9 13 f9 ff ff       	jmp    80106a91 <alltraps>
+
+8010717e <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+8010717e:	6a 00                	push   $0x0
+  pushl $42
+80107180:	6a 2a                	push   $0x2a
+  jmp alltraps
+80107182:	e9 0a f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107187 <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+80107187:	6a 00                	push   $0x0
+  pushl $43
+80107189:	6a 2b                	push   $0x2b
+  jmp alltraps
+8010718b:	e9 01 f9 ff ff       	jmp    80106a91 <alltraps>
+
+80107190 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80107190:	6a 00                	push   $0x0
+  pushl $44
+80107192:	6a 2c                	push   $0x2c
+  jmp alltraps
+80107194:	e9 f8 f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107199 <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+80107199:	6a 00                	push   $0x0
+  pushl $45
+8010719b:	6a 2d                	push   $0x2d
+  jmp alltraps
+8010719d:	e9 ef f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071a2 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+801071a2:	6a 00                	push   $0x0
+  pushl $46
+801071a4:	6a 2e                	push   $0x2e
+  jmp alltraps
+801071a6:	e9 e6 f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071ab <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+801071ab:	6a 00                	push   $0x0
+  pushl $47
+801071ad:	6a 2f                	push   $0x2f
+  jmp alltraps
+801071af:	e9 dd f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071b4 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+801071b4:	6a 00                	push   $0x0
+  pushl $48
+801071b6:	6a 30                	push   $0x30
+  jmp alltraps
+801071b8:	e9 d4 f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071bd <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+801071bd:	6a 00                	push   $0x0
+  pushl $49
+801071bf:	6a 31                	push   $0x31
+  jmp alltraps
+801071c1:	e9 cb f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071c6 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+801071c6:	6a 00                	push   $0x0
+  pushl $50
+801071c8:	6a 32                	push   $0x32
+  jmp alltraps
+801071ca:	e9 c2 f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071cf <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+801071cf:	6a 00                	push   $0x0
+  pushl $51
+801071d1:	6a 33                	push   $0x33
+  jmp alltraps
+801071d3:	e9 b9 f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071d8 <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+801071d8:	6a 00                	push   $0x0
+  pushl $52
+801071da:	6a 34                	push   $0x34
+  jmp alltraps
+801071dc:	e9 b0 f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071e1 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+801071e1:	6a 00                	push   $0x0
+  pushl $53
+801071e3:	6a 35                	push   $0x35
+  jmp alltraps
+801071e5:	e9 a7 f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071ea <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+801071ea:	6a 00                	push   $0x0
+  pushl $54
+801071ec:	6a 36                	push   $0x36
+  jmp alltraps
+801071ee:	e9 9e f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071f3 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+801071f3:	6a 00                	push   $0x0
+  pushl $55
+801071f5:	6a 37                	push   $0x37
+  jmp alltraps
+801071f7:	e9 95 f8 ff ff       	jmp    80106a91 <alltraps>
+
+801071fc <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+801071fc:	6a 00                	push   $0x0
+  pushl $56
+801071fe:	6a 38                	push   $0x38
+  jmp alltraps
+80107200:	e9 8c f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107205 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+80107205:	6a 00                	push   $0x0
+  pushl $57
+80107207:	6a 39                	push   $0x39
+  jmp alltraps
+80107209:	e9 83 f8 ff ff       	jmp    80106a91 <alltraps>
+
+8010720e <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+8010720e:	6a 00                	push   $0x0
+  pushl $58
+80107210:	6a 3a                	push   $0x3a
+  jmp alltraps
+80107212:	e9 7a f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107217 <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+80107217:	6a 00                	push   $0x0
+  pushl $59
+80107219:	6a 3b                	push   $0x3b
+  jmp alltraps
+8010721b:	e9 71 f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107220 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+80107220:	6a 00                	push   $0x0
+  pushl $60
+80107222:	6a 3c                	push   $0x3c
+  jmp alltraps
+80107224:	e9 68 f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107229 <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+80107229:	6a 00                	push   $0x0
+  pushl $61
+8010722b:	6a 3d                	push   $0x3d
+  jmp alltraps
+8010722d:	e9 5f f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107232 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80107232:	6a 00                	push   $0x0
+  pushl $62
+80107234:	6a 3e                	push   $0x3e
+  jmp alltraps
+80107236:	e9 56 f8 ff ff       	jmp    80106a91 <alltraps>
+
+8010723b <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+8010723b:	6a 00                	push   $0x0
+  pushl $63
+8010723d:	6a 3f                	push   $0x3f
+  jmp alltraps
+8010723f:	e9 4d f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107244 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80107244:	6a 00                	push   $0x0
+  pushl $64
+80107246:	6a 40                	push   $0x40
+  jmp alltraps
+80107248:	e9 44 f8 ff ff       	jmp    80106a91 <alltraps>
+
+8010724d <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+8010724d:	6a 00                	push   $0x0
+  pushl $65
+8010724f:	6a 41                	push   $0x41
+  jmp alltraps
+80107251:	e9 3b f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107256 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80107256:	6a 00                	push   $0x0
+  pushl $66
+80107258:	6a 42                	push   $0x42
+  jmp alltraps
+8010725a:	e9 32 f8 ff ff       	jmp    80106a91 <alltraps>
+
+8010725f <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+8010725f:	6a 00                	push   $0x0
+  pushl $67
+80107261:	6a 43                	push   $0x43
+  jmp alltraps
+80107263:	e9 29 f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107268 <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+80107268:	6a 00                	push   $0x0
+  pushl $68
+8010726a:	6a 44                	push   $0x44
+  jmp alltraps
+8010726c:	e9 20 f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107271 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80107271:	6a 00                	push   $0x0
+  pushl $69
+80107273:	6a 45                	push   $0x45
+  jmp alltraps
+80107275:	e9 17 f8 ff ff       	jmp    80106a91 <alltraps>
+
+8010727a <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+8010727a:	6a 00                	push   $0x0
+  pushl $70
+8010727c:	6a 46                	push   $0x46
+  jmp alltraps
+8010727e:	e9 0e f8 ff ff       	jmp    80106a91 <alltraps>
+
+80107283 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80107283:	6a 00                	push   $0x0
+  pushl $71
+80107285:	6a 47                	push   $0x47
+  jmp alltraps
+80107287:	e9 05 f8 ff ff       	jmp    80106a91 <alltraps>
+
+8010728c <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+8010728c:	6a 00                	push   $0x0
+  pushl $72
+8010728e:	6a 48                	push   $0x48
+  jmp alltraps
+80107290:	e9 fc f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107295 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80107295:	6a 00                	push   $0x0
+  pushl $73
+80107297:	6a 49                	push   $0x49
+  jmp alltraps
+80107299:	e9 f3 f7 ff ff       	jmp    80106a91 <alltraps>
+
+8010729e <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+8010729e:	6a 00                	push   $0x0
+  pushl $74
+801072a0:	6a 4a                	push   $0x4a
+  jmp alltraps
+801072a2:	e9 ea f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072a7 <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+801072a7:	6a 00                	push   $0x0
+  pushl $75
+801072a9:	6a 4b                	push   $0x4b
+  jmp alltraps
+801072ab:	e9 e1 f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072b0 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+801072b0:	6a 00                	push   $0x0
+  pushl $76
+801072b2:	6a 4c                	push   $0x4c
+  jmp alltraps
+801072b4:	e9 d8 f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072b9 <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+801072b9:	6a 00                	push   $0x0
+  pushl $77
+801072bb:	6a 4d                	push   $0x4d
+  jmp alltraps
+801072bd:	e9 cf f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072c2 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+801072c2:	6a 00                	push   $0x0
+  pushl $78
+801072c4:	6a 4e                	push   $0x4e
+  jmp alltraps
+801072c6:	e9 c6 f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072cb <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+801072cb:	6a 00                	push   $0x0
+  pushl $79
+801072cd:	6a 4f                	push   $0x4f
+  jmp alltraps
+801072cf:	e9 bd f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072d4 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+801072d4:	6a 00                	push   $0x0
+  pushl $80
+801072d6:	6a 50                	push   $0x50
+  jmp alltraps
+801072d8:	e9 b4 f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072dd <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+801072dd:	6a 00                	push   $0x0
+  pushl $81
+801072df:	6a 51                	push   $0x51
+  jmp alltraps
+801072e1:	e9 ab f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072e6 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+801072e6:	6a 00                	push   $0x0
+  pushl $82
+801072e8:	6a 52                	push   $0x52
+  jmp alltraps
+801072ea:	e9 a2 f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072ef <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+801072ef:	6a 00                	push   $0x0
+  pushl $83
+801072f1:	6a 53                	push   $0x53
+  jmp alltraps
+801072f3:	e9 99 f7 ff ff       	jmp    80106a91 <alltraps>
+
+801072f8 <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+801072f8:	6a 00                	push   $0x0
+  pushl $84
+801072fa:	6a 54                	push   $0x54
+  jmp alltraps
+801072fc:	e9 90 f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107301 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+80107301:	6a 00                	push   $0x0
+  pushl $85
+80107303:	6a 55                	push   $0x55
+  jmp alltraps
+80107305:	e9 87 f7 ff ff       	jmp    80106a91 <alltraps>
+
+8010730a <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+8010730a:	6a 00                	push   $0x0
+  pushl $86
+8010730c:	6a 56                	push   $0x56
+  jmp alltraps
+8010730e:	e9 7e f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107313 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+80107313:	6a 00                	push   $0x0
+  pushl $87
+80107315:	6a 57                	push   $0x57
+  jmp alltraps
+80107317:	e9 75 f7 ff ff       	jmp    80106a91 <alltraps>
+
+8010731c <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+8010731c:	6a 00                	push   $0x0
+  pushl $88
+8010731e:	6a 58                	push   $0x58
+  jmp alltraps
+80107320:	e9 6c f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107325 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+80107325:	6a 00                	push   $0x0
+  pushl $89
+80107327:	6a 59                	push   $0x59
+  jmp alltraps
+80107329:	e9 63 f7 ff ff       	jmp    80106a91 <alltraps>
+
+8010732e <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+8010732e:	6a 00                	push   $0x0
+  pushl $90
+80107330:	6a 5a                	push   $0x5a
+  jmp alltraps
+80107332:	e9 5a f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107337 <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+80107337:	6a 00                	push   $0x0
+  pushl $91
+80107339:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010733b:	e9 51 f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107340 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80107340:	6a 00                	push   $0x0
+  pushl $92
+80107342:	6a 5c                	push   $0x5c
+  jmp alltraps
+80107344:	e9 48 f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107349 <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+80107349:	6a 00                	push   $0x0
+  pushl $93
+8010734b:	6a 5d                	push   $0x5d
+  jmp alltraps
+8010734d:	e9 3f f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107352 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80107352:	6a 00                	push   $0x0
+  pushl $94
+80107354:	6a 5e                	push   $0x5e
+  jmp alltraps
+80107356:	e9 36 f7 ff ff       	jmp    80106a91 <alltraps>
+
+8010735b <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010735b:	6a 00                	push   $0x0
+  pushl $95
+8010735d:	6a 5f                	push   $0x5f
+  jmp alltraps
+8010735f:	e9 2d f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107364 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80107364:	6a 00                	push   $0x0
+  pushl $96
+80107366:	6a 60                	push   $0x60
+  jmp alltraps
+80107368:	e9 24 f7 ff ff       	jmp    80106a91 <alltraps>
+
+8010736d <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+8010736d:	6a 00                	push   $0x0
+  pushl $97
+8010736f:	6a 61                	push   $0x61
+  jmp alltraps
+80107371:	e9 1b f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107376 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+80107376:	6a 00                	push   $0x0
+  pushl $98
+80107378:	6a 62                	push   $0x62
+  jmp alltraps
+8010737a:	e9 12 f7 ff ff       	jmp    80106a91 <alltraps>
+
+8010737f <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+8010737f:	6a 00                	push   $0x0
+  pushl $99
+80107381:	6a 63                	push   $0x63
+  jmp alltraps
+80107383:	e9 09 f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107388 <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+80107388:	6a 00                	push   $0x0
+  pushl $100
+8010738a:	6a 64                	push   $0x64
+  jmp alltraps
+8010738c:	e9 00 f7 ff ff       	jmp    80106a91 <alltraps>
+
+80107391 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80107391:	6a 00                	push   $0x0
+  pushl $101
+80107393:	6a 65                	push   $0x65
+  jmp alltraps
+80107395:	e9 f7 f6 ff ff       	jmp    80106a91 <alltraps>
+
+8010739a <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010739a:	6a 00                	push   $0x0
+  pushl $102
+8010739c:	6a 66                	push   $0x66
+  jmp alltraps
+8010739e:	e9 ee f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073a3 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+801073a3:	6a 00                	push   $0x0
+  pushl $103
+801073a5:	6a 67                	push   $0x67
+  jmp alltraps
+801073a7:	e9 e5 f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073ac <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+801073ac:	6a 00                	push   $0x0
+  pushl $104
+801073ae:	6a 68                	push   $0x68
+  jmp alltraps
+801073b0:	e9 dc f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073b5 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+801073b5:	6a 00                	push   $0x0
+  pushl $105
+801073b7:	6a 69                	push   $0x69
+  jmp alltraps
+801073b9:	e9 d3 f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073be <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+801073be:	6a 00                	push   $0x0
+  pushl $106
+801073c0:	6a 6a                	push   $0x6a
+  jmp alltraps
+801073c2:	e9 ca f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073c7 <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+801073c7:	6a 00                	push   $0x0
+  pushl $107
+801073c9:	6a 6b                	push   $0x6b
+  jmp alltraps
+801073cb:	e9 c1 f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073d0 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+801073d0:	6a 00                	push   $0x0
+  pushl $108
+801073d2:	6a 6c                	push   $0x6c
+  jmp alltraps
+801073d4:	e9 b8 f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073d9 <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+801073d9:	6a 00                	push   $0x0
+  pushl $109
+801073db:	6a 6d                	push   $0x6d
+  jmp alltraps
+801073dd:	e9 af f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073e2 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+801073e2:	6a 00                	push   $0x0
+  pushl $110
+801073e4:	6a 6e                	push   $0x6e
+  jmp alltraps
+801073e6:	e9 a6 f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073eb <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+801073eb:	6a 00                	push   $0x0
+  pushl $111
+801073ed:	6a 6f                	push   $0x6f
+  jmp alltraps
+801073ef:	e9 9d f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073f4 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+801073f4:	6a 00                	push   $0x0
+  pushl $112
+801073f6:	6a 70                	push   $0x70
+  jmp alltraps
+801073f8:	e9 94 f6 ff ff       	jmp    80106a91 <alltraps>
+
+801073fd <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+801073fd:	6a 00                	push   $0x0
+  pushl $113
+801073ff:	6a 71                	push   $0x71
+  jmp alltraps
+80107401:	e9 8b f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107406 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+80107406:	6a 00                	push   $0x0
+  pushl $114
+80107408:	6a 72                	push   $0x72
+  jmp alltraps
+8010740a:	e9 82 f6 ff ff       	jmp    80106a91 <alltraps>
+
+8010740f <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+8010740f:	6a 00                	push   $0x0
+  pushl $115
+80107411:	6a 73                	push   $0x73
+  jmp alltraps
+80107413:	e9 79 f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107418 <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+80107418:	6a 00                	push   $0x0
+  pushl $116
+8010741a:	6a 74                	push   $0x74
+  jmp alltraps
+8010741c:	e9 70 f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107421 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+80107421:	6a 00                	push   $0x0
+  pushl $117
+80107423:	6a 75                	push   $0x75
+  jmp alltraps
+80107425:	e9 67 f6 ff ff       	jmp    80106a91 <alltraps>
+
+8010742a <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010742a:	6a 00                	push   $0x0
+  pushl $118
+8010742c:	6a 76                	push   $0x76
+  jmp alltraps
+8010742e:	e9 5e f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107433 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+80107433:	6a 00                	push   $0x0
+  pushl $119
+80107435:	6a 77                	push   $0x77
+  jmp alltraps
+80107437:	e9 55 f6 ff ff       	jmp    80106a91 <alltraps>
+
+8010743c <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010743c:	6a 00                	push   $0x0
+  pushl $120
+8010743e:	6a 78                	push   $0x78
+  jmp alltraps
+80107440:	e9 4c f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107445 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+80107445:	6a 00                	push   $0x0
+  pushl $121
+80107447:	6a 79                	push   $0x79
+  jmp alltraps
+80107449:	e9 43 f6 ff ff       	jmp    80106a91 <alltraps>
+
+8010744e <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+8010744e:	6a 00                	push   $0x0
+  pushl $122
+80107450:	6a 7a                	push   $0x7a
+  jmp alltraps
+80107452:	e9 3a f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107457 <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+80107457:	6a 00                	push   $0x0
+  pushl $123
+80107459:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010745b:	e9 31 f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107460 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80107460:	6a 00                	push   $0x0
+  pushl $124
+80107462:	6a 7c                	push   $0x7c
+  jmp alltraps
+80107464:	e9 28 f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107469 <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+80107469:	6a 00                	push   $0x0
+  pushl $125
+8010746b:	6a 7d                	push   $0x7d
+  jmp alltraps
+8010746d:	e9 1f f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107472 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80107472:	6a 00                	push   $0x0
+  pushl $126
+80107474:	6a 7e                	push   $0x7e
+  jmp alltraps
+80107476:	e9 16 f6 ff ff       	jmp    80106a91 <alltraps>
+
+8010747b <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010747b:	6a 00                	push   $0x0
+  pushl $127
+8010747d:	6a 7f                	push   $0x7f
+  jmp alltraps
+8010747f:	e9 0d f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107484 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+80107484:	6a 00                	push   $0x0
+  pushl $128
+80107486:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010748b:	e9 01 f6 ff ff       	jmp    80106a91 <alltraps>
+
+80107490 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+80107490:	6a 00                	push   $0x0
+  pushl $129
+80107492:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+80107497:	e9 f5 f5 ff ff       	jmp    80106a91 <alltraps>
+
+8010749c <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010749c:	6a 00                	push   $0x0
+  pushl $130
+8010749e:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+801074a3:	e9 e9 f5 ff ff       	jmp    80106a91 <alltraps>
+
+801074a8 <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+801074a8:	6a 00                	push   $0x0
+  pushl $131
+801074aa:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+801074af:	e9 dd f5 ff ff       	jmp    80106a91 <alltraps>
+
+801074b4 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+801074b4:	6a 00                	push   $0x0
+  pushl $132
+801074b6:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+801074bb:	e9 d1 f5 ff ff       	jmp    80106a91 <alltraps>
+
+801074c0 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+801074c0:	6a 00                	push   $0x0
+  pushl $133
+801074c2:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+801074c7:	e9 c5 f5 ff ff       	jmp    80106a91 <alltraps>
+
+801074cc <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+801074cc:	6a 00                	push   $0x0
+  pushl $134
+801074ce:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+801074d3:	e9 b9 f5 ff ff       	jmp    80106a91 <alltraps>
+
+801074d8 <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+801074d8:	6a 00                	push   $0x0
+  pushl $135
+801074da:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+801074df:	e9 ad f5 ff ff       	jmp    80106a91 <alltraps>
+
+801074e4 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+801074e4:	6a 00                	push   $0x0
+  pushl $136
+801074e6:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+801074eb:	e9 a1 f5 ff ff       	jmp    80106a91 <alltraps>
+
+801074f0 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+801074f0:	6a 00                	push   $0x0
+  pushl $137
+801074f2:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+801074f7:	e9 95 f5 ff ff       	jmp    80106a91 <alltraps>
+
+801074fc <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+801074fc:	6a 00                	push   $0x0
+  pushl $138
+801074fe:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+80107503:	e9 89 f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107508 <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+80107508:	6a 00                	push   $0x0
+  pushl $139
+8010750a:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+8010750f:	e9 7d f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107514 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+80107514:	6a 00                	push   $0x0
+  pushl $140
+80107516:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010751b:	e9 71 f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107520 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+80107520:	6a 00                	push   $0x0
+  pushl $141
+80107522:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+80107527:	e9 65 f5 ff ff       	jmp    80106a91 <alltraps>
+
+8010752c <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010752c:	6a 00                	push   $0x0
+  pushl $142
+8010752e:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80107533:	e9 59 f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107538 <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+80107538:	6a 00                	push   $0x0
+  pushl $143
+8010753a:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+8010753f:	e9 4d f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107544 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80107544:	6a 00                	push   $0x0
+  pushl $144
+80107546:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010754b:	e9 41 f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107550 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80107550:	6a 00                	push   $0x0
+  pushl $145
+80107552:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+80107557:	e9 35 f5 ff ff       	jmp    80106a91 <alltraps>
+
+8010755c <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010755c:	6a 00                	push   $0x0
+  pushl $146
+8010755e:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80107563:	e9 29 f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107568 <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+80107568:	6a 00                	push   $0x0
+  pushl $147
+8010756a:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+8010756f:	e9 1d f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107574 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+80107574:	6a 00                	push   $0x0
+  pushl $148
+80107576:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010757b:	e9 11 f5 ff ff       	jmp    80106a91 <alltraps>
+
+80107580 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+80107580:	6a 00                	push   $0x0
+  pushl $149
+80107582:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+80107587:	e9 05 f5 ff ff       	jmp    80106a91 <alltraps>
+
+8010758c <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010758c:	6a 00                	push   $0x0
+  pushl $150
+8010758e:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80107593:	e9 f9 f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107598 <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+80107598:	6a 00                	push   $0x0
+  pushl $151
+8010759a:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+8010759f:	e9 ed f4 ff ff       	jmp    80106a91 <alltraps>
+
+801075a4 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+801075a4:	6a 00                	push   $0x0
+  pushl $152
+801075a6:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+801075ab:	e9 e1 f4 ff ff       	jmp    80106a91 <alltraps>
+
+801075b0 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+801075b0:	6a 00                	push   $0x0
+  pushl $153
+801075b2:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+801075b7:	e9 d5 f4 ff ff       	jmp    80106a91 <alltraps>
+
+801075bc <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+801075bc:	6a 00                	push   $0x0
+  pushl $154
+801075be:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+801075c3:	e9 c9 f4 ff ff       	jmp    80106a91 <alltraps>
+
+801075c8 <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+801075c8:	6a 00                	push   $0x0
+  pushl $155
+801075ca:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+801075cf:	e9 bd f4 ff ff       	jmp    80106a91 <alltraps>
+
+801075d4 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+801075d4:	6a 00                	push   $0x0
+  pushl $156
+801075d6:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+801075db:	e9 b1 f4 ff ff       	jmp    80106a91 <alltraps>
+
+801075e0 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+801075e0:	6a 00                	push   $0x0
+  pushl $157
+801075e2:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+801075e7:	e9 a5 f4 ff ff       	jmp    80106a91 <alltraps>
+
+801075ec <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+801075ec:	6a 00                	push   $0x0
+  pushl $158
+801075ee:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+801075f3:	e9 99 f4 ff ff       	jmp    80106a91 <alltraps>
+
+801075f8 <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+801075f8:	6a 00                	push   $0x0
+  pushl $159
+801075fa:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+801075ff:	e9 8d f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107604 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+80107604:	6a 00                	push   $0x0
+  pushl $160
+80107606:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010760b:	e9 81 f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107610 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+80107610:	6a 00                	push   $0x0
+  pushl $161
+80107612:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+80107617:	e9 75 f4 ff ff       	jmp    80106a91 <alltraps>
+
+8010761c <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+8010761c:	6a 00                	push   $0x0
+  pushl $162
+8010761e:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80107623:	e9 69 f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107628 <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+80107628:	6a 00                	push   $0x0
+  pushl $163
+8010762a:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+8010762f:	e9 5d f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107634 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80107634:	6a 00                	push   $0x0
+  pushl $164
+80107636:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010763b:	e9 51 f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107640 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80107640:	6a 00                	push   $0x0
+  pushl $165
+80107642:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+80107647:	e9 45 f4 ff ff       	jmp    80106a91 <alltraps>
+
+8010764c <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010764c:	6a 00                	push   $0x0
+  pushl $166
+8010764e:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80107653:	e9 39 f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107658 <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+80107658:	6a 00                	push   $0x0
+  pushl $167
+8010765a:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+8010765f:	e9 2d f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107664 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80107664:	6a 00                	push   $0x0
+  pushl $168
+80107666:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010766b:	e9 21 f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107670 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+80107670:	6a 00                	push   $0x0
+  pushl $169
+80107672:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+80107677:	e9 15 f4 ff ff       	jmp    80106a91 <alltraps>
+
+8010767c <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010767c:	6a 00                	push   $0x0
+  pushl $170
+8010767e:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80107683:	e9 09 f4 ff ff       	jmp    80106a91 <alltraps>
+
+80107688 <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+80107688:	6a 00                	push   $0x0
+  pushl $171
+8010768a:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+8010768f:	e9 fd f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107694 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80107694:	6a 00                	push   $0x0
+  pushl $172
+80107696:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010769b:	e9 f1 f3 ff ff       	jmp    80106a91 <alltraps>
+
+801076a0 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+801076a0:	6a 00                	push   $0x0
+  pushl $173
+801076a2:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+801076a7:	e9 e5 f3 ff ff       	jmp    80106a91 <alltraps>
+
+801076ac <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+801076ac:	6a 00                	push   $0x0
+  pushl $174
+801076ae:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+801076b3:	e9 d9 f3 ff ff       	jmp    80106a91 <alltraps>
+
+801076b8 <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+801076b8:	6a 00                	push   $0x0
+  pushl $175
+801076ba:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+801076bf:	e9 cd f3 ff ff       	jmp    80106a91 <alltraps>
+
+801076c4 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+801076c4:	6a 00                	push   $0x0
+  pushl $176
+801076c6:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+801076cb:	e9 c1 f3 ff ff       	jmp    80106a91 <alltraps>
+
+801076d0 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+801076d0:	6a 00                	push   $0x0
+  pushl $177
+801076d2:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+801076d7:	e9 b5 f3 ff ff       	jmp    80106a91 <alltraps>
+
+801076dc <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+801076dc:	6a 00                	push   $0x0
+  pushl $178
+801076de:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+801076e3:	e9 a9 f3 ff ff       	jmp    80106a91 <alltraps>
+
+801076e8 <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+801076e8:	6a 00                	push   $0x0
+  pushl $179
+801076ea:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+801076ef:	e9 9d f3 ff ff       	jmp    80106a91 <alltraps>
+
+801076f4 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+801076f4:	6a 00                	push   $0x0
+  pushl $180
+801076f6:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+801076fb:	e9 91 f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107700 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+80107700:	6a 00                	push   $0x0
+  pushl $181
+80107702:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+80107707:	e9 85 f3 ff ff       	jmp    80106a91 <alltraps>
+
+8010770c <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010770c:	6a 00                	push   $0x0
+  pushl $182
+8010770e:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+80107713:	e9 79 f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107718 <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+80107718:	6a 00                	push   $0x0
+  pushl $183
+8010771a:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+8010771f:	e9 6d f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107724 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80107724:	6a 00                	push   $0x0
+  pushl $184
+80107726:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010772b:	e9 61 f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107730 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+80107730:	6a 00                	push   $0x0
+  pushl $185
+80107732:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+80107737:	e9 55 f3 ff ff       	jmp    80106a91 <alltraps>
+
+8010773c <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010773c:	6a 00                	push   $0x0
+  pushl $186
+8010773e:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80107743:	e9 49 f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107748 <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+80107748:	6a 00                	push   $0x0
+  pushl $187
+8010774a:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010774f:	e9 3d f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107754 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80107754:	6a 00                	push   $0x0
+  pushl $188
+80107756:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010775b:	e9 31 f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107760 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+80107760:	6a 00                	push   $0x0
+  pushl $189
+80107762:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+80107767:	e9 25 f3 ff ff       	jmp    80106a91 <alltraps>
+
+8010776c <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010776c:	6a 00                	push   $0x0
+  pushl $190
+8010776e:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+80107773:	e9 19 f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107778 <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+80107778:	6a 00                	push   $0x0
+  pushl $191
+8010777a:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010777f:	e9 0d f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107784 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+80107784:	6a 00                	push   $0x0
+  pushl $192
+80107786:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010778b:	e9 01 f3 ff ff       	jmp    80106a91 <alltraps>
+
+80107790 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+80107790:	6a 00                	push   $0x0
+  pushl $193
+80107792:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+80107797:	e9 f5 f2 ff ff       	jmp    80106a91 <alltraps>
+
+8010779c <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010779c:	6a 00                	push   $0x0
+  pushl $194
+8010779e:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+801077a3:	e9 e9 f2 ff ff       	jmp    80106a91 <alltraps>
+
+801077a8 <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+801077a8:	6a 00                	push   $0x0
+  pushl $195
+801077aa:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+801077af:	e9 dd f2 ff ff       	jmp    80106a91 <alltraps>
+
+801077b4 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+801077b4:	6a 00                	push   $0x0
+  pushl $196
+801077b6:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+801077bb:	e9 d1 f2 ff ff       	jmp    80106a91 <alltraps>
+
+801077c0 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+801077c0:	6a 00                	push   $0x0
+  pushl $197
+801077c2:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+801077c7:	e9 c5 f2 ff ff       	jmp    80106a91 <alltraps>
+
+801077cc <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+801077cc:	6a 00                	push   $0x0
+  pushl $198
+801077ce:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+801077d3:	e9 b9 f2 ff ff       	jmp    80106a91 <alltraps>
+
+801077d8 <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+801077d8:	6a 00                	push   $0x0
+  pushl $199
+801077da:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+801077df:	e9 ad f2 ff ff       	jmp    80106a91 <alltraps>
+
+801077e4 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+801077e4:	6a 00                	push   $0x0
+  pushl $200
+801077e6:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+801077eb:	e9 a1 f2 ff ff       	jmp    80106a91 <alltraps>
+
+801077f0 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+801077f0:	6a 00                	push   $0x0
+  pushl $201
+801077f2:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+801077f7:	e9 95 f2 ff ff       	jmp    80106a91 <alltraps>
+
+801077fc <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+801077fc:	6a 00                	push   $0x0
+  pushl $202
+801077fe:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+80107803:	e9 89 f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107808 <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+80107808:	6a 00                	push   $0x0
+  pushl $203
+8010780a:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010780f:	e9 7d f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107814 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+80107814:	6a 00                	push   $0x0
+  pushl $204
+80107816:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010781b:	e9 71 f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107820 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+80107820:	6a 00                	push   $0x0
+  pushl $205
+80107822:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+80107827:	e9 65 f2 ff ff       	jmp    80106a91 <alltraps>
+
+8010782c <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010782c:	6a 00                	push   $0x0
+  pushl $206
+8010782e:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+80107833:	e9 59 f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107838 <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+80107838:	6a 00                	push   $0x0
+  pushl $207
+8010783a:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010783f:	e9 4d f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107844 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+80107844:	6a 00                	push   $0x0
+  pushl $208
+80107846:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010784b:	e9 41 f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107850 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80107850:	6a 00                	push   $0x0
+  pushl $209
+80107852:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+80107857:	e9 35 f2 ff ff       	jmp    80106a91 <alltraps>
+
+8010785c <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010785c:	6a 00                	push   $0x0
+  pushl $210
+8010785e:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80107863:	e9 29 f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107868 <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+80107868:	6a 00                	push   $0x0
+  pushl $211
+8010786a:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010786f:	e9 1d f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107874 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+80107874:	6a 00                	push   $0x0
+  pushl $212
+80107876:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010787b:	e9 11 f2 ff ff       	jmp    80106a91 <alltraps>
+
+80107880 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+80107880:	6a 00                	push   $0x0
+  pushl $213
+80107882:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+80107887:	e9 05 f2 ff ff       	jmp    80106a91 <alltraps>
+
+8010788c <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010788c:	6a 00                	push   $0x0
+  pushl $214
+8010788e:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+80107893:	e9 f9 f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107898 <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+80107898:	6a 00                	push   $0x0
+  pushl $215
+8010789a:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010789f:	e9 ed f1 ff ff       	jmp    80106a91 <alltraps>
+
+801078a4 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+801078a4:	6a 00                	push   $0x0
+  pushl $216
+801078a6:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+801078ab:	e9 e1 f1 ff ff       	jmp    80106a91 <alltraps>
+
+801078b0 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+801078b0:	6a 00                	push   $0x0
+  pushl $217
+801078b2:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+801078b7:	e9 d5 f1 ff ff       	jmp    80106a91 <alltraps>
+
+801078bc <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+801078bc:	6a 00                	push   $0x0
+  pushl $218
+801078be:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+801078c3:	e9 c9 f1 ff ff       	jmp    80106a91 <alltraps>
+
+801078c8 <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+801078c8:	6a 00                	push   $0x0
+  pushl $219
+801078ca:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+801078cf:	e9 bd f1 ff ff       	jmp    80106a91 <alltraps>
+
+801078d4 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+801078d4:	6a 00                	push   $0x0
+  pushl $220
+801078d6:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+801078db:	e9 b1 f1 ff ff       	jmp    80106a91 <alltraps>
+
+801078e0 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+801078e0:	6a 00                	push   $0x0
+  pushl $221
+801078e2:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+801078e7:	e9 a5 f1 ff ff       	jmp    80106a91 <alltraps>
+
+801078ec <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+801078ec:	6a 00                	push   $0x0
+  pushl $222
+801078ee:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+801078f3:	e9 99 f1 ff ff       	jmp    80106a91 <alltraps>
+
+801078f8 <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+801078f8:	6a 00                	push   $0x0
+  pushl $223
+801078fa:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+801078ff:	e9 8d f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107904 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+80107904:	6a 00                	push   $0x0
+  pushl $224
+80107906:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010790b:	e9 81 f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107910 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+80107910:	6a 00                	push   $0x0
+  pushl $225
+80107912:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+80107917:	e9 75 f1 ff ff       	jmp    80106a91 <alltraps>
+
+8010791c <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010791c:	6a 00                	push   $0x0
+  pushl $226
+8010791e:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+80107923:	e9 69 f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107928 <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+80107928:	6a 00                	push   $0x0
+  pushl $227
+8010792a:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010792f:	e9 5d f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107934 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+80107934:	6a 00                	push   $0x0
+  pushl $228
+80107936:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010793b:	e9 51 f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107940 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+80107940:	6a 00                	push   $0x0
+  pushl $229
+80107942:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+80107947:	e9 45 f1 ff ff       	jmp    80106a91 <alltraps>
+
+8010794c <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010794c:	6a 00                	push   $0x0
+  pushl $230
+8010794e:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80107953:	e9 39 f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107958 <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+80107958:	6a 00                	push   $0x0
+  pushl $231
+8010795a:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010795f:	e9 2d f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107964 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80107964:	6a 00                	push   $0x0
+  pushl $232
+80107966:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010796b:	e9 21 f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107970 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+80107970:	6a 00                	push   $0x0
+  pushl $233
+80107972:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+80107977:	e9 15 f1 ff ff       	jmp    80106a91 <alltraps>
+
+8010797c <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010797c:	6a 00                	push   $0x0
+  pushl $234
+8010797e:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+80107983:	e9 09 f1 ff ff       	jmp    80106a91 <alltraps>
+
+80107988 <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+80107988:	6a 00                	push   $0x0
+  pushl $235
+8010798a:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010798f:	e9 fd f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107994 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+80107994:	6a 00                	push   $0x0
+  pushl $236
+80107996:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010799b:	e9 f1 f0 ff ff       	jmp    80106a91 <alltraps>
+
+801079a0 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+801079a0:	6a 00                	push   $0x0
+  pushl $237
+801079a2:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+801079a7:	e9 e5 f0 ff ff       	jmp    80106a91 <alltraps>
+
+801079ac <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+801079ac:	6a 00                	push   $0x0
+  pushl $238
+801079ae:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+801079b3:	e9 d9 f0 ff ff       	jmp    80106a91 <alltraps>
+
+801079b8 <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+801079b8:	6a 00                	push   $0x0
+  pushl $239
+801079ba:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+801079bf:	e9 cd f0 ff ff       	jmp    80106a91 <alltraps>
+
+801079c4 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+801079c4:	6a 00                	push   $0x0
+  pushl $240
+801079c6:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+801079cb:	e9 c1 f0 ff ff       	jmp    80106a91 <alltraps>
+
+801079d0 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+801079d0:	6a 00                	push   $0x0
+  pushl $241
+801079d2:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+801079d7:	e9 b5 f0 ff ff       	jmp    80106a91 <alltraps>
+
+801079dc <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+801079dc:	6a 00                	push   $0x0
+  pushl $242
+801079de:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+801079e3:	e9 a9 f0 ff ff       	jmp    80106a91 <alltraps>
+
+801079e8 <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+801079e8:	6a 00                	push   $0x0
+  pushl $243
+801079ea:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+801079ef:	e9 9d f0 ff ff       	jmp    80106a91 <alltraps>
+
+801079f4 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+801079f4:	6a 00                	push   $0x0
+  pushl $244
+801079f6:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+801079fb:	e9 91 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a00 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+80107a00:	6a 00                	push   $0x0
+  pushl $245
+80107a02:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+80107a07:	e9 85 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a0c <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+80107a0c:	6a 00                	push   $0x0
+  pushl $246
+80107a0e:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+80107a13:	e9 79 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a18 <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+80107a18:	6a 00                	push   $0x0
+  pushl $247
+80107a1a:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+80107a1f:	e9 6d f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a24 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+80107a24:	6a 00                	push   $0x0
+  pushl $248
+80107a26:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+80107a2b:	e9 61 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a30 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+80107a30:	6a 00                	push   $0x0
+  pushl $249
+80107a32:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+80107a37:	e9 55 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a3c <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+80107a3c:	6a 00                	push   $0x0
+  pushl $250
+80107a3e:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+80107a43:	e9 49 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a48 <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+80107a48:	6a 00                	push   $0x0
+  pushl $251
+80107a4a:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+80107a4f:	e9 3d f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a54 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+80107a54:	6a 00                	push   $0x0
+  pushl $252
+80107a56:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+80107a5b:	e9 31 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a60 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+80107a60:	6a 00                	push   $0x0
+  pushl $253
+80107a62:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+80107a67:	e9 25 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a6c <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+80107a6c:	6a 00                	push   $0x0
+  pushl $254
+80107a6e:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+80107a73:	e9 19 f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a78 <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+80107a78:	6a 00                	push   $0x0
+  pushl $255
+80107a7a:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+80107a7f:	e9 0d f0 ff ff       	jmp    80106a91 <alltraps>
+
+80107a84 <walkpgdir>:
+// Return the address of the PTE in page table pgdir
+// that corresponds to virtual address va.  If alloc!=0,
+// create any required page table pages.
+static pte_t *
+walkpgdir(pde_t *pgdir, const void *va, int alloc)
+{
+80107a84:	55                   	push   %ebp
+80107a85:	89 e5                	mov    %esp,%ebp
+80107a87:	57                   	push   %edi
+80107a88:	56                   	push   %esi
+80107a89:	53                   	push   %ebx
+80107a8a:	83 ec 0c             	sub    $0xc,%esp
+80107a8d:	89 d3                	mov    %edx,%ebx
+  pde_t *pde;
+  pte_t *pgtab;
+
+  pde = &pgdir[PDX(va)];
+80107a8f:	c1 ea 16             	shr    $0x16,%edx
+80107a92:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+  if(*pde & PTE_P){
+80107a95:	8b 37                	mov    (%edi),%esi
+80107a97:	f7 c6 01 00 00 00    	test   $0x1,%esi
+80107a9d:	74 35                	je     80107ad4 <walkpgdir+0x50>
+
+#ifndef __ASSEMBLER__
+// Address in page table or page directory entry
+//   I changes these from macros into inline functions to make sure we
+//   consistently get an error if a pointer is erroneously passed to them.
+static inline uint PTE_ADDR(uint pte)  { return pte & ~0xFFF; }
+80107a9f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    if (a > KERNBASE)
+80107aa5:	81 fe 00 00 00 80    	cmp    $0x80000000,%esi
+80107aab:	77 1a                	ja     80107ac7 <walkpgdir+0x43>
+    return (char*)a + KERNBASE;
+80107aad:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+    // The permissions here are overly generous, but they can
+    // be further restricted by the permissions in the page table
+    // entries, if necessary.
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  }
+  return &pgtab[PTX(va)];
+80107ab3:	c1 eb 0c             	shr    $0xc,%ebx
+80107ab6:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+80107abc:	8d 04 9e             	lea    (%esi,%ebx,4),%eax
+}
+80107abf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107ac2:	5b                   	pop    %ebx
+80107ac3:	5e                   	pop    %esi
+80107ac4:	5f                   	pop    %edi
+80107ac5:	5d                   	pop    %ebp
+80107ac6:	c3                   	ret
+        panic("P2V on address > KERNBASE");
+80107ac7:	83 ec 0c             	sub    $0xc,%esp
+80107aca:	68 34 8b 10 80       	push   $0x80108b34
+80107acf:	e8 9a 88 ff ff       	call   8010036e <panic>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+80107ad4:	85 c9                	test   %ecx,%ecx
+80107ad6:	74 33                	je     80107b0b <walkpgdir+0x87>
+80107ad8:	e8 cb a5 ff ff       	call   801020a8 <kalloc>
+80107add:	89 c6                	mov    %eax,%esi
+80107adf:	85 c0                	test   %eax,%eax
+80107ae1:	74 28                	je     80107b0b <walkpgdir+0x87>
+    memset(pgtab, 0, PGSIZE);
+80107ae3:	83 ec 04             	sub    $0x4,%esp
+80107ae6:	68 00 10 00 00       	push   $0x1000
+80107aeb:	6a 00                	push   $0x0
+80107aed:	50                   	push   %eax
+80107aee:	e8 6e dc ff ff       	call   80105761 <memset>
+    if (a < (void*) KERNBASE)
+80107af3:	83 c4 10             	add    $0x10,%esp
+80107af6:	81 fe ff ff ff 7f    	cmp    $0x7fffffff,%esi
+80107afc:	76 14                	jbe    80107b12 <walkpgdir+0x8e>
+    return (uint)a - KERNBASE;
+80107afe:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80107b04:	83 c8 07             	or     $0x7,%eax
+80107b07:	89 07                	mov    %eax,(%edi)
+80107b09:	eb a8                	jmp    80107ab3 <walkpgdir+0x2f>
+      return 0;
+80107b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+80107b10:	eb ad                	jmp    80107abf <walkpgdir+0x3b>
+        panic("V2P on address < KERNBASE "
+80107b12:	83 ec 0c             	sub    $0xc,%esp
+80107b15:	68 08 88 10 80       	push   $0x80108808
+80107b1a:	e8 4f 88 ff ff       	call   8010036e <panic>
+
+80107b1f <mappages>:
+// Create PTEs for virtual addresses starting at va that refer to
+// physical addresses starting at pa. va and size might not
+// be page-aligned.
+static int
+mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
+{
+80107b1f:	55                   	push   %ebp
+80107b20:	89 e5                	mov    %esp,%ebp
+80107b22:	57                   	push   %edi
+80107b23:	56                   	push   %esi
+80107b24:	53                   	push   %ebx
+80107b25:	83 ec 1c             	sub    $0x1c,%esp
+80107b28:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80107b2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  char *a, *last;
+  pte_t *pte;
+
+  a = (char*)PGROUNDDOWN((uint)va);
+80107b2e:	89 d3                	mov    %edx,%ebx
+80107b30:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+80107b36:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+80107b3a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80107b3f:	89 c7                	mov    %eax,%edi
+  for(;;){
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+80107b41:	b9 01 00 00 00       	mov    $0x1,%ecx
+80107b46:	89 da                	mov    %ebx,%edx
+80107b48:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107b4b:	e8 34 ff ff ff       	call   80107a84 <walkpgdir>
+80107b50:	85 c0                	test   %eax,%eax
+80107b52:	74 2e                	je     80107b82 <mappages+0x63>
+      return -1;
+    if(*pte & PTE_P)
+80107b54:	f6 00 01             	testb  $0x1,(%eax)
+80107b57:	75 1c                	jne    80107b75 <mappages+0x56>
+      panic("remap");
+    *pte = pa | perm | PTE_P;
+80107b59:	89 f2                	mov    %esi,%edx
+80107b5b:	0b 55 0c             	or     0xc(%ebp),%edx
+80107b5e:	83 ca 01             	or     $0x1,%edx
+80107b61:	89 10                	mov    %edx,(%eax)
+    if(a == last)
+80107b63:	39 fb                	cmp    %edi,%ebx
+80107b65:	74 28                	je     80107b8f <mappages+0x70>
+      break;
+    a += PGSIZE;
+80107b67:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    pa += PGSIZE;
+80107b6d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+80107b73:	eb cc                	jmp    80107b41 <mappages+0x22>
+      panic("remap");
+80107b75:	83 ec 0c             	sub    $0xc,%esp
+80107b78:	68 c0 8f 10 80       	push   $0x80108fc0
+80107b7d:	e8 ec 87 ff ff       	call   8010036e <panic>
+      return -1;
+80107b82:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return 0;
+}
+80107b87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107b8a:	5b                   	pop    %ebx
+80107b8b:	5e                   	pop    %esi
+80107b8c:	5f                   	pop    %edi
+80107b8d:	5d                   	pop    %ebp
+80107b8e:	c3                   	ret
+  return 0;
+80107b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+80107b94:	eb f1                	jmp    80107b87 <mappages+0x68>
+
+80107b96 <seginit>:
+{
+80107b96:	55                   	push   %ebp
+80107b97:	89 e5                	mov    %esp,%ebp
+80107b99:	57                   	push   %edi
+80107b9a:	56                   	push   %esi
+80107b9b:	53                   	push   %ebx
+80107b9c:	83 ec 1c             	sub    $0x1c,%esp
+  c = &cpus[cpuid()];
+80107b9f:	e8 5f c1 ff ff       	call   80103d03 <cpuid>
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+80107ba4:	69 f8 d8 00 00 00    	imul   $0xd8,%eax,%edi
+80107baa:	66 c7 87 78 38 11 80 	movw   $0xffff,-0x7feec788(%edi)
+80107bb1:	ff ff 
+80107bb3:	66 c7 87 7a 38 11 80 	movw   $0x0,-0x7feec786(%edi)
+80107bba:	00 00 
+80107bbc:	c6 87 7c 38 11 80 00 	movb   $0x0,-0x7feec784(%edi)
+80107bc3:	0f b6 8f 7d 38 11 80 	movzbl -0x7feec783(%edi),%ecx
+80107bca:	83 e1 f0             	and    $0xfffffff0,%ecx
+80107bcd:	89 ce                	mov    %ecx,%esi
+80107bcf:	83 ce 0a             	or     $0xa,%esi
+80107bd2:	89 f2                	mov    %esi,%edx
+80107bd4:	88 97 7d 38 11 80    	mov    %dl,-0x7feec783(%edi)
+80107bda:	83 c9 1a             	or     $0x1a,%ecx
+80107bdd:	88 8f 7d 38 11 80    	mov    %cl,-0x7feec783(%edi)
+80107be3:	83 e1 9f             	and    $0xffffff9f,%ecx
+80107be6:	88 8f 7d 38 11 80    	mov    %cl,-0x7feec783(%edi)
+80107bec:	83 c9 80             	or     $0xffffff80,%ecx
+80107bef:	88 8f 7d 38 11 80    	mov    %cl,-0x7feec783(%edi)
+80107bf5:	0f b6 8f 7e 38 11 80 	movzbl -0x7feec782(%edi),%ecx
+80107bfc:	83 c9 0f             	or     $0xf,%ecx
+80107bff:	88 8f 7e 38 11 80    	mov    %cl,-0x7feec782(%edi)
+80107c05:	89 ce                	mov    %ecx,%esi
+80107c07:	83 e6 ef             	and    $0xffffffef,%esi
+80107c0a:	89 f2                	mov    %esi,%edx
+80107c0c:	88 97 7e 38 11 80    	mov    %dl,-0x7feec782(%edi)
+80107c12:	83 e1 cf             	and    $0xffffffcf,%ecx
+80107c15:	88 8f 7e 38 11 80    	mov    %cl,-0x7feec782(%edi)
+80107c1b:	89 ce                	mov    %ecx,%esi
+80107c1d:	83 ce 40             	or     $0x40,%esi
+80107c20:	89 f2                	mov    %esi,%edx
+80107c22:	88 97 7e 38 11 80    	mov    %dl,-0x7feec782(%edi)
+80107c28:	83 c9 c0             	or     $0xffffffc0,%ecx
+80107c2b:	88 8f 7e 38 11 80    	mov    %cl,-0x7feec782(%edi)
+80107c31:	c6 87 7f 38 11 80 00 	movb   $0x0,-0x7feec781(%edi)
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+80107c38:	66 c7 87 80 38 11 80 	movw   $0xffff,-0x7feec780(%edi)
+80107c3f:	ff ff 
+80107c41:	66 c7 87 82 38 11 80 	movw   $0x0,-0x7feec77e(%edi)
+80107c48:	00 00 
+80107c4a:	c6 87 84 38 11 80 00 	movb   $0x0,-0x7feec77c(%edi)
+80107c51:	0f b6 8f 85 38 11 80 	movzbl -0x7feec77b(%edi),%ecx
+80107c58:	83 e1 f0             	and    $0xfffffff0,%ecx
+80107c5b:	89 ce                	mov    %ecx,%esi
+80107c5d:	83 ce 02             	or     $0x2,%esi
+80107c60:	89 f2                	mov    %esi,%edx
+80107c62:	88 97 85 38 11 80    	mov    %dl,-0x7feec77b(%edi)
+80107c68:	83 c9 12             	or     $0x12,%ecx
+80107c6b:	88 8f 85 38 11 80    	mov    %cl,-0x7feec77b(%edi)
+80107c71:	83 e1 9f             	and    $0xffffff9f,%ecx
+80107c74:	88 8f 85 38 11 80    	mov    %cl,-0x7feec77b(%edi)
+80107c7a:	83 c9 80             	or     $0xffffff80,%ecx
+80107c7d:	88 8f 85 38 11 80    	mov    %cl,-0x7feec77b(%edi)
+80107c83:	0f b6 8f 86 38 11 80 	movzbl -0x7feec77a(%edi),%ecx
+80107c8a:	83 c9 0f             	or     $0xf,%ecx
+80107c8d:	88 8f 86 38 11 80    	mov    %cl,-0x7feec77a(%edi)
+80107c93:	89 ce                	mov    %ecx,%esi
+80107c95:	83 e6 ef             	and    $0xffffffef,%esi
+80107c98:	89 f2                	mov    %esi,%edx
+80107c9a:	88 97 86 38 11 80    	mov    %dl,-0x7feec77a(%edi)
+80107ca0:	83 e1 cf             	and    $0xffffffcf,%ecx
+80107ca3:	88 8f 86 38 11 80    	mov    %cl,-0x7feec77a(%edi)
+80107ca9:	89 ce                	mov    %ecx,%esi
+80107cab:	83 ce 40             	or     $0x40,%esi
+80107cae:	89 f2                	mov    %esi,%edx
+80107cb0:	88 97 86 38 11 80    	mov    %dl,-0x7feec77a(%edi)
+80107cb6:	83 c9 c0             	or     $0xffffffc0,%ecx
+80107cb9:	88 8f 86 38 11 80    	mov    %cl,-0x7feec77a(%edi)
+80107cbf:	c6 87 87 38 11 80 00 	movb   $0x0,-0x7feec779(%edi)
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+80107cc6:	66 c7 87 88 38 11 80 	movw   $0xffff,-0x7feec778(%edi)
+80107ccd:	ff ff 
+80107ccf:	66 c7 87 8a 38 11 80 	movw   $0x0,-0x7feec776(%edi)
+80107cd6:	00 00 
+80107cd8:	c6 87 8c 38 11 80 00 	movb   $0x0,-0x7feec774(%edi)
+80107cdf:	0f b6 9f 8d 38 11 80 	movzbl -0x7feec773(%edi),%ebx
+80107ce6:	83 e3 f0             	and    $0xfffffff0,%ebx
+80107ce9:	89 de                	mov    %ebx,%esi
+80107ceb:	83 ce 0a             	or     $0xa,%esi
+80107cee:	89 f2                	mov    %esi,%edx
+80107cf0:	88 97 8d 38 11 80    	mov    %dl,-0x7feec773(%edi)
+80107cf6:	89 de                	mov    %ebx,%esi
+80107cf8:	83 ce 1a             	or     $0x1a,%esi
+80107cfb:	89 f2                	mov    %esi,%edx
+80107cfd:	88 97 8d 38 11 80    	mov    %dl,-0x7feec773(%edi)
+80107d03:	83 cb 7a             	or     $0x7a,%ebx
+80107d06:	88 9f 8d 38 11 80    	mov    %bl,-0x7feec773(%edi)
+80107d0c:	c6 87 8d 38 11 80 fa 	movb   $0xfa,-0x7feec773(%edi)
+80107d13:	0f b6 9f 8e 38 11 80 	movzbl -0x7feec772(%edi),%ebx
+80107d1a:	83 cb 0f             	or     $0xf,%ebx
+80107d1d:	88 9f 8e 38 11 80    	mov    %bl,-0x7feec772(%edi)
+80107d23:	89 de                	mov    %ebx,%esi
+80107d25:	83 e6 ef             	and    $0xffffffef,%esi
+80107d28:	89 f2                	mov    %esi,%edx
+80107d2a:	88 97 8e 38 11 80    	mov    %dl,-0x7feec772(%edi)
+80107d30:	83 e3 cf             	and    $0xffffffcf,%ebx
+80107d33:	88 9f 8e 38 11 80    	mov    %bl,-0x7feec772(%edi)
+80107d39:	89 de                	mov    %ebx,%esi
+80107d3b:	83 ce 40             	or     $0x40,%esi
+80107d3e:	89 f2                	mov    %esi,%edx
+80107d40:	88 97 8e 38 11 80    	mov    %dl,-0x7feec772(%edi)
+80107d46:	83 cb c0             	or     $0xffffffc0,%ebx
+80107d49:	88 9f 8e 38 11 80    	mov    %bl,-0x7feec772(%edi)
+80107d4f:	c6 87 8f 38 11 80 00 	movb   $0x0,-0x7feec771(%edi)
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+80107d56:	66 c7 87 90 38 11 80 	movw   $0xffff,-0x7feec770(%edi)
+80107d5d:	ff ff 
+80107d5f:	66 c7 87 92 38 11 80 	movw   $0x0,-0x7feec76e(%edi)
+80107d66:	00 00 
+80107d68:	c6 87 94 38 11 80 00 	movb   $0x0,-0x7feec76c(%edi)
+80107d6f:	0f b6 9f 95 38 11 80 	movzbl -0x7feec76b(%edi),%ebx
+80107d76:	83 e3 f0             	and    $0xfffffff0,%ebx
+80107d79:	89 de                	mov    %ebx,%esi
+80107d7b:	83 ce 02             	or     $0x2,%esi
+80107d7e:	89 f2                	mov    %esi,%edx
+80107d80:	88 97 95 38 11 80    	mov    %dl,-0x7feec76b(%edi)
+80107d86:	89 de                	mov    %ebx,%esi
+80107d88:	83 ce 12             	or     $0x12,%esi
+80107d8b:	89 f2                	mov    %esi,%edx
+80107d8d:	88 97 95 38 11 80    	mov    %dl,-0x7feec76b(%edi)
+80107d93:	83 cb 72             	or     $0x72,%ebx
+80107d96:	88 9f 95 38 11 80    	mov    %bl,-0x7feec76b(%edi)
+80107d9c:	c6 87 95 38 11 80 f2 	movb   $0xf2,-0x7feec76b(%edi)
+80107da3:	0f b6 9f 96 38 11 80 	movzbl -0x7feec76a(%edi),%ebx
+80107daa:	83 cb 0f             	or     $0xf,%ebx
+80107dad:	88 9f 96 38 11 80    	mov    %bl,-0x7feec76a(%edi)
+80107db3:	89 de                	mov    %ebx,%esi
+80107db5:	83 e6 ef             	and    $0xffffffef,%esi
+80107db8:	89 f2                	mov    %esi,%edx
+80107dba:	88 97 96 38 11 80    	mov    %dl,-0x7feec76a(%edi)
+80107dc0:	83 e3 cf             	and    $0xffffffcf,%ebx
+80107dc3:	88 9f 96 38 11 80    	mov    %bl,-0x7feec76a(%edi)
+80107dc9:	89 de                	mov    %ebx,%esi
+80107dcb:	83 ce 40             	or     $0x40,%esi
+80107dce:	89 f2                	mov    %esi,%edx
+80107dd0:	88 97 96 38 11 80    	mov    %dl,-0x7feec76a(%edi)
+80107dd6:	83 cb c0             	or     $0xffffffc0,%ebx
+80107dd9:	88 9f 96 38 11 80    	mov    %bl,-0x7feec76a(%edi)
+80107ddf:	c6 87 97 38 11 80 00 	movb   $0x0,-0x7feec769(%edi)
+  lgdt(c->gdt, sizeof(c->gdt));
+80107de6:	8d 97 70 38 11 80    	lea    -0x7feec790(%edi),%edx
+  pd[0] = size-1;
+80107dec:	66 c7 45 e2 2f 00    	movw   $0x2f,-0x1e(%ebp)
+  pd[1] = (uint)p;
+80107df2:	66 89 55 e4          	mov    %dx,-0x1c(%ebp)
+  pd[2] = (uint)p >> 16;
+80107df6:	c1 ea 10             	shr    $0x10,%edx
+80107df9:	66 89 55 e6          	mov    %dx,-0x1a(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+80107dfd:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+80107e00:	0f 01 10             	lgdtl  (%eax)
+}
+80107e03:	83 c4 1c             	add    $0x1c,%esp
+80107e06:	5b                   	pop    %ebx
+80107e07:	5e                   	pop    %esi
+80107e08:	5f                   	pop    %edi
+80107e09:	5d                   	pop    %ebp
+80107e0a:	c3                   	ret
+
+80107e0b <switchkvm>:
+// Switch h/w page table register to the kernel-only page table,
+// for when no process is running.
+void
+switchkvm(void)
+{
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+80107e0b:	a1 f0 20 15 80       	mov    0x801520f0,%eax
+    if (a < (void*) KERNBASE)
+80107e10:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80107e15:	76 09                	jbe    80107e20 <switchkvm+0x15>
+    return (uint)a - KERNBASE;
+80107e17:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+80107e1c:	0f 22 d8             	mov    %eax,%cr3
+80107e1f:	c3                   	ret
+{
+80107e20:	55                   	push   %ebp
+80107e21:	89 e5                	mov    %esp,%ebp
+80107e23:	83 ec 14             	sub    $0x14,%esp
+        panic("V2P on address < KERNBASE "
+80107e26:	68 08 88 10 80       	push   $0x80108808
+80107e2b:	e8 3e 85 ff ff       	call   8010036e <panic>
+
+80107e30 <switchuvm>:
+}
+
+// Switch TSS and h/w page table to correspond to process p.
+void
+switchuvm(struct proc *p)
+{
+80107e30:	55                   	push   %ebp
+80107e31:	89 e5                	mov    %esp,%ebp
+80107e33:	57                   	push   %edi
+80107e34:	56                   	push   %esi
+80107e35:	53                   	push   %ebx
+80107e36:	83 ec 1c             	sub    $0x1c,%esp
+80107e39:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+80107e3c:	85 f6                	test   %esi,%esi
+80107e3e:	0f 84 2c 01 00 00    	je     80107f70 <switchuvm+0x140>
+    panic("switchuvm: no process");
+  if(p->kstack == 0)
+80107e44:	83 7e 08 00          	cmpl   $0x0,0x8(%esi)
+80107e48:	0f 84 2f 01 00 00    	je     80107f7d <switchuvm+0x14d>
+    panic("switchuvm: no kstack");
+  if(p->pgdir == 0)
+80107e4e:	83 7e 04 00          	cmpl   $0x0,0x4(%esi)
+80107e52:	0f 84 32 01 00 00    	je     80107f8a <switchuvm+0x15a>
+    panic("switchuvm: no pgdir");
+
+  pushcli();
+80107e58:	e8 75 d7 ff ff       	call   801055d2 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+80107e5d:	e8 a1 bd ff ff       	call   80103c03 <mycpu>
+80107e62:	89 c3                	mov    %eax,%ebx
+80107e64:	e8 9a bd ff ff       	call   80103c03 <mycpu>
+80107e69:	8d 78 08             	lea    0x8(%eax),%edi
+80107e6c:	e8 92 bd ff ff       	call   80103c03 <mycpu>
+80107e71:	83 c0 08             	add    $0x8,%eax
+80107e74:	c1 e8 10             	shr    $0x10,%eax
+80107e77:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80107e7a:	e8 84 bd ff ff       	call   80103c03 <mycpu>
+80107e7f:	83 c0 08             	add    $0x8,%eax
+80107e82:	c1 e8 18             	shr    $0x18,%eax
+80107e85:	66 c7 83 98 00 00 00 	movw   $0x67,0x98(%ebx)
+80107e8c:	67 00 
+80107e8e:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+80107e95:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+80107e99:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+80107e9f:	0f b6 93 9d 00 00 00 	movzbl 0x9d(%ebx),%edx
+80107ea6:	83 e2 f0             	and    $0xfffffff0,%edx
+80107ea9:	89 d1                	mov    %edx,%ecx
+80107eab:	83 c9 09             	or     $0x9,%ecx
+80107eae:	88 8b 9d 00 00 00    	mov    %cl,0x9d(%ebx)
+80107eb4:	83 ca 19             	or     $0x19,%edx
+80107eb7:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+80107ebd:	83 e2 9f             	and    $0xffffff9f,%edx
+80107ec0:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+80107ec6:	83 ca 80             	or     $0xffffff80,%edx
+80107ec9:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+80107ecf:	0f b6 93 9e 00 00 00 	movzbl 0x9e(%ebx),%edx
+80107ed6:	89 d1                	mov    %edx,%ecx
+80107ed8:	83 e1 f0             	and    $0xfffffff0,%ecx
+80107edb:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+80107ee1:	89 d1                	mov    %edx,%ecx
+80107ee3:	83 e1 e0             	and    $0xffffffe0,%ecx
+80107ee6:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+80107eec:	83 e2 c0             	and    $0xffffffc0,%edx
+80107eef:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+80107ef5:	83 ca 40             	or     $0x40,%edx
+80107ef8:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+80107efe:	83 e2 7f             	and    $0x7f,%edx
+80107f01:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+80107f07:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+                                sizeof(mycpu()->ts)-1, 0);
+  mycpu()->gdt[SEG_TSS].s = 0;
+80107f0d:	e8 f1 bc ff ff       	call   80103c03 <mycpu>
+80107f12:	0f b6 90 9d 00 00 00 	movzbl 0x9d(%eax),%edx
+80107f19:	83 e2 ef             	and    $0xffffffef,%edx
+80107f1c:	88 90 9d 00 00 00    	mov    %dl,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+80107f22:	e8 dc bc ff ff       	call   80103c03 <mycpu>
+80107f27:	66 c7 40 10 10 00    	movw   $0x10,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+80107f2d:	8b 5e 08             	mov    0x8(%esi),%ebx
+80107f30:	e8 ce bc ff ff       	call   80103c03 <mycpu>
+80107f35:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80107f3b:	89 58 0c             	mov    %ebx,0xc(%eax)
+  // setting IOPL=0 in eflags *and* iomb beyond the tss segment limit
+  // forbids I/O instructions (e.g., inb and outb) from user space
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+80107f3e:	e8 c0 bc ff ff       	call   80103c03 <mycpu>
+80107f43:	66 c7 40 6e ff ff    	movw   $0xffff,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+80107f49:	b8 28 00 00 00       	mov    $0x28,%eax
+80107f4e:	0f 00 d8             	ltr    %ax
+  ltr(SEG_TSS << 3);
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+80107f51:	8b 46 04             	mov    0x4(%esi),%eax
+    if (a < (void*) KERNBASE)
+80107f54:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80107f59:	76 3c                	jbe    80107f97 <switchuvm+0x167>
+    return (uint)a - KERNBASE;
+80107f5b:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+80107f60:	0f 22 d8             	mov    %eax,%cr3
+  popcli();
+80107f63:	e8 ae d6 ff ff       	call   80105616 <popcli>
+}
+80107f68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107f6b:	5b                   	pop    %ebx
+80107f6c:	5e                   	pop    %esi
+80107f6d:	5f                   	pop    %edi
+80107f6e:	5d                   	pop    %ebp
+80107f6f:	c3                   	ret
+    panic("switchuvm: no process");
+80107f70:	83 ec 0c             	sub    $0xc,%esp
+80107f73:	68 c6 8f 10 80       	push   $0x80108fc6
+80107f78:	e8 f1 83 ff ff       	call   8010036e <panic>
+    panic("switchuvm: no kstack");
+80107f7d:	83 ec 0c             	sub    $0xc,%esp
+80107f80:	68 dc 8f 10 80       	push   $0x80108fdc
+80107f85:	e8 e4 83 ff ff       	call   8010036e <panic>
+    panic("switchuvm: no pgdir");
+80107f8a:	83 ec 0c             	sub    $0xc,%esp
+80107f8d:	68 f1 8f 10 80       	push   $0x80108ff1
+80107f92:	e8 d7 83 ff ff       	call   8010036e <panic>
+        panic("V2P on address < KERNBASE "
+80107f97:	83 ec 0c             	sub    $0xc,%esp
+80107f9a:	68 08 88 10 80       	push   $0x80108808
+80107f9f:	e8 ca 83 ff ff       	call   8010036e <panic>
+
+80107fa4 <inituvm>:
+
+// Load the initcode into address 0 of pgdir.
+// sz must be less than a page.
+void
+inituvm(pde_t *pgdir, char *init, uint sz)
+{
+80107fa4:	55                   	push   %ebp
+80107fa5:	89 e5                	mov    %esp,%ebp
+80107fa7:	56                   	push   %esi
+80107fa8:	53                   	push   %ebx
+80107fa9:	8b 75 10             	mov    0x10(%ebp),%esi
+  char *mem;
+
+  if(sz >= PGSIZE)
+80107fac:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+80107fb2:	77 57                	ja     8010800b <inituvm+0x67>
+    panic("inituvm: more than a page");
+  mem = kalloc();
+80107fb4:	e8 ef a0 ff ff       	call   801020a8 <kalloc>
+80107fb9:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+80107fbb:	83 ec 04             	sub    $0x4,%esp
+80107fbe:	68 00 10 00 00       	push   $0x1000
+80107fc3:	6a 00                	push   $0x0
+80107fc5:	50                   	push   %eax
+80107fc6:	e8 96 d7 ff ff       	call   80105761 <memset>
+    if (a < (void*) KERNBASE)
+80107fcb:	83 c4 10             	add    $0x10,%esp
+80107fce:	81 fb ff ff ff 7f    	cmp    $0x7fffffff,%ebx
+80107fd4:	76 42                	jbe    80108018 <inituvm+0x74>
+    return (uint)a - KERNBASE;
+80107fd6:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+80107fdc:	83 ec 08             	sub    $0x8,%esp
+80107fdf:	6a 06                	push   $0x6
+80107fe1:	50                   	push   %eax
+80107fe2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80107fe7:	ba 00 00 00 00       	mov    $0x0,%edx
+80107fec:	8b 45 08             	mov    0x8(%ebp),%eax
+80107fef:	e8 2b fb ff ff       	call   80107b1f <mappages>
+  memmove(mem, init, sz);
+80107ff4:	83 c4 0c             	add    $0xc,%esp
+80107ff7:	56                   	push   %esi
+80107ff8:	ff 75 0c             	push   0xc(%ebp)
+80107ffb:	53                   	push   %ebx
+80107ffc:	e8 d8 d7 ff ff       	call   801057d9 <memmove>
+}
+80108001:	83 c4 10             	add    $0x10,%esp
+80108004:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108007:	5b                   	pop    %ebx
+80108008:	5e                   	pop    %esi
+80108009:	5d                   	pop    %ebp
+8010800a:	c3                   	ret
+    panic("inituvm: more than a page");
+8010800b:	83 ec 0c             	sub    $0xc,%esp
+8010800e:	68 05 90 10 80       	push   $0x80109005
+80108013:	e8 56 83 ff ff       	call   8010036e <panic>
+        panic("V2P on address < KERNBASE "
+80108018:	83 ec 0c             	sub    $0xc,%esp
+8010801b:	68 08 88 10 80       	push   $0x80108808
+80108020:	e8 49 83 ff ff       	call   8010036e <panic>
+
+80108025 <loaduvm>:
+
+// Load a program segment into pgdir.  addr must be page-aligned
+// and the pages from addr to addr+sz must already be mapped.
+int
+loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
+{
+80108025:	55                   	push   %ebp
+80108026:	89 e5                	mov    %esp,%ebp
+80108028:	57                   	push   %edi
+80108029:	56                   	push   %esi
+8010802a:	53                   	push   %ebx
+8010802b:	83 ec 0c             	sub    $0xc,%esp
+8010802e:	8b 7d 18             	mov    0x18(%ebp),%edi
+  uint i, pa, n;
+  pte_t *pte;
+
+  if((uint) addr % PGSIZE != 0)
+80108031:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80108034:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+8010803a:	74 43                	je     8010807f <loaduvm+0x5a>
+    panic("loaduvm: addr must be page aligned");
+8010803c:	83 ec 0c             	sub    $0xc,%esp
+8010803f:	68 c0 90 10 80       	push   $0x801090c0
+80108044:	e8 25 83 ff ff       	call   8010036e <panic>
+  for(i = 0; i < sz; i += PGSIZE){
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+      panic("loaduvm: address should exist");
+80108049:	83 ec 0c             	sub    $0xc,%esp
+8010804c:	68 1f 90 10 80       	push   $0x8010901f
+80108051:	e8 18 83 ff ff       	call   8010036e <panic>
+    pa = PTE_ADDR(*pte);
+    if(sz - i < PGSIZE)
+      n = sz - i;
+    else
+      n = PGSIZE;
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+80108056:	89 da                	mov    %ebx,%edx
+80108058:	03 55 14             	add    0x14(%ebp),%edx
+    if (a > KERNBASE)
+8010805b:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+80108060:	77 51                	ja     801080b3 <loaduvm+0x8e>
+    return (char*)a + KERNBASE;
+80108062:	05 00 00 00 80       	add    $0x80000000,%eax
+80108067:	56                   	push   %esi
+80108068:	52                   	push   %edx
+80108069:	50                   	push   %eax
+8010806a:	ff 75 10             	push   0x10(%ebp)
+8010806d:	e8 cb 96 ff ff       	call   8010173d <readi>
+80108072:	83 c4 10             	add    $0x10,%esp
+80108075:	39 f0                	cmp    %esi,%eax
+80108077:	75 54                	jne    801080cd <loaduvm+0xa8>
+  for(i = 0; i < sz; i += PGSIZE){
+80108079:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010807f:	39 fb                	cmp    %edi,%ebx
+80108081:	73 3d                	jae    801080c0 <loaduvm+0x9b>
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+80108083:	89 da                	mov    %ebx,%edx
+80108085:	03 55 0c             	add    0xc(%ebp),%edx
+80108088:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010808d:	8b 45 08             	mov    0x8(%ebp),%eax
+80108090:	e8 ef f9 ff ff       	call   80107a84 <walkpgdir>
+80108095:	85 c0                	test   %eax,%eax
+80108097:	74 b0                	je     80108049 <loaduvm+0x24>
+    pa = PTE_ADDR(*pte);
+80108099:	8b 00                	mov    (%eax),%eax
+8010809b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(sz - i < PGSIZE)
+801080a0:	89 fe                	mov    %edi,%esi
+801080a2:	29 de                	sub    %ebx,%esi
+801080a4:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+801080aa:	76 aa                	jbe    80108056 <loaduvm+0x31>
+      n = PGSIZE;
+801080ac:	be 00 10 00 00       	mov    $0x1000,%esi
+801080b1:	eb a3                	jmp    80108056 <loaduvm+0x31>
+        panic("P2V on address > KERNBASE");
+801080b3:	83 ec 0c             	sub    $0xc,%esp
+801080b6:	68 34 8b 10 80       	push   $0x80108b34
+801080bb:	e8 ae 82 ff ff       	call   8010036e <panic>
+      return -1;
+  }
+  return 0;
+801080c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801080c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801080c8:	5b                   	pop    %ebx
+801080c9:	5e                   	pop    %esi
+801080ca:	5f                   	pop    %edi
+801080cb:	5d                   	pop    %ebp
+801080cc:	c3                   	ret
+      return -1;
+801080cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801080d2:	eb f1                	jmp    801080c5 <loaduvm+0xa0>
+
+801080d4 <deallocuvm>:
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+801080d4:	55                   	push   %ebp
+801080d5:	89 e5                	mov    %esp,%ebp
+801080d7:	57                   	push   %edi
+801080d8:	56                   	push   %esi
+801080d9:	53                   	push   %ebx
+801080da:	83 ec 0c             	sub    $0xc,%esp
+801080dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  pte_t *pte;
+  uint a, pa;
+
+  if(newsz >= oldsz)
+801080e0:	39 7d 10             	cmp    %edi,0x10(%ebp)
+801080e3:	73 11                	jae    801080f6 <deallocuvm+0x22>
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+801080e5:	8b 45 10             	mov    0x10(%ebp),%eax
+801080e8:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+801080ee:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+801080f4:	eb 19                	jmp    8010810f <deallocuvm+0x3b>
+    return oldsz;
+801080f6:	89 f8                	mov    %edi,%eax
+801080f8:	eb 78                	jmp    80108172 <deallocuvm+0x9e>
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+801080fa:	c1 eb 16             	shr    $0x16,%ebx
+801080fd:	83 c3 01             	add    $0x1,%ebx
+80108100:	c1 e3 16             	shl    $0x16,%ebx
+80108103:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+80108109:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010810f:	39 fb                	cmp    %edi,%ebx
+80108111:	73 5c                	jae    8010816f <deallocuvm+0x9b>
+    pte = walkpgdir(pgdir, (char*)a, 0);
+80108113:	b9 00 00 00 00       	mov    $0x0,%ecx
+80108118:	89 da                	mov    %ebx,%edx
+8010811a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010811d:	e8 62 f9 ff ff       	call   80107a84 <walkpgdir>
+80108122:	89 c6                	mov    %eax,%esi
+    if(!pte)
+80108124:	85 c0                	test   %eax,%eax
+80108126:	74 d2                	je     801080fa <deallocuvm+0x26>
+    else if((*pte & PTE_P) != 0){
+80108128:	8b 00                	mov    (%eax),%eax
+8010812a:	a8 01                	test   $0x1,%al
+8010812c:	74 db                	je     80108109 <deallocuvm+0x35>
+      pa = PTE_ADDR(*pte);
+      if(pa == 0)
+8010812e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80108133:	74 20                	je     80108155 <deallocuvm+0x81>
+    if (a > KERNBASE)
+80108135:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+8010813a:	77 26                	ja     80108162 <deallocuvm+0x8e>
+    return (char*)a + KERNBASE;
+8010813c:	05 00 00 00 80       	add    $0x80000000,%eax
+        panic("kfree");
+      char *v = P2V(pa);
+      kfree(v);
+80108141:	83 ec 0c             	sub    $0xc,%esp
+80108144:	50                   	push   %eax
+80108145:	e8 21 9e ff ff       	call   80101f6b <kfree>
+      *pte = 0;
+8010814a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80108150:	83 c4 10             	add    $0x10,%esp
+80108153:	eb b4                	jmp    80108109 <deallocuvm+0x35>
+        panic("kfree");
+80108155:	83 ec 0c             	sub    $0xc,%esp
+80108158:	68 96 88 10 80       	push   $0x80108896
+8010815d:	e8 0c 82 ff ff       	call   8010036e <panic>
+        panic("P2V on address > KERNBASE");
+80108162:	83 ec 0c             	sub    $0xc,%esp
+80108165:	68 34 8b 10 80       	push   $0x80108b34
+8010816a:	e8 ff 81 ff ff       	call   8010036e <panic>
+    }
+  }
+  return newsz;
+8010816f:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+80108172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108175:	5b                   	pop    %ebx
+80108176:	5e                   	pop    %esi
+80108177:	5f                   	pop    %edi
+80108178:	5d                   	pop    %ebp
+80108179:	c3                   	ret
+
+8010817a <allocuvm>:
+{
+8010817a:	55                   	push   %ebp
+8010817b:	89 e5                	mov    %esp,%ebp
+8010817d:	57                   	push   %edi
+8010817e:	56                   	push   %esi
+8010817f:	53                   	push   %ebx
+80108180:	83 ec 1c             	sub    $0x1c,%esp
+80108183:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(newsz >= KERNBASE)
+80108186:	85 ff                	test   %edi,%edi
+80108188:	0f 88 da 00 00 00    	js     80108268 <allocuvm+0xee>
+  if(newsz < oldsz)
+8010818e:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+80108191:	72 6a                	jb     801081fd <allocuvm+0x83>
+  a = PGROUNDUP(oldsz);
+80108193:	8b 45 0c             	mov    0xc(%ebp),%eax
+80108196:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+8010819c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  for(; a < newsz; a += PGSIZE){
+801081a2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801081a5:	39 fe                	cmp    %edi,%esi
+801081a7:	0f 83 b6 00 00 00    	jae    80108263 <allocuvm+0xe9>
+    mem = kalloc();
+801081ad:	e8 f6 9e ff ff       	call   801020a8 <kalloc>
+801081b2:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+801081b4:	85 c0                	test   %eax,%eax
+801081b6:	74 4a                	je     80108202 <allocuvm+0x88>
+    memset(mem, 0, PGSIZE);
+801081b8:	83 ec 04             	sub    $0x4,%esp
+801081bb:	68 00 10 00 00       	push   $0x1000
+801081c0:	6a 00                	push   $0x0
+801081c2:	50                   	push   %eax
+801081c3:	e8 99 d5 ff ff       	call   80105761 <memset>
+    if (a < (void*) KERNBASE)
+801081c8:	83 c4 10             	add    $0x10,%esp
+801081cb:	81 fb ff ff ff 7f    	cmp    $0x7fffffff,%ebx
+801081d1:	76 55                	jbe    80108228 <allocuvm+0xae>
+    return (uint)a - KERNBASE;
+801081d3:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+801081d9:	83 ec 08             	sub    $0x8,%esp
+801081dc:	6a 06                	push   $0x6
+801081de:	50                   	push   %eax
+801081df:	b9 00 10 00 00       	mov    $0x1000,%ecx
+801081e4:	89 f2                	mov    %esi,%edx
+801081e6:	8b 45 08             	mov    0x8(%ebp),%eax
+801081e9:	e8 31 f9 ff ff       	call   80107b1f <mappages>
+801081ee:	83 c4 10             	add    $0x10,%esp
+801081f1:	85 c0                	test   %eax,%eax
+801081f3:	78 40                	js     80108235 <allocuvm+0xbb>
+  for(; a < newsz; a += PGSIZE){
+801081f5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+801081fb:	eb a8                	jmp    801081a5 <allocuvm+0x2b>
+    return oldsz;
+801081fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+80108200:	eb 6b                	jmp    8010826d <allocuvm+0xf3>
+      cprintf("allocuvm out of memory\n");
+80108202:	83 ec 0c             	sub    $0xc,%esp
+80108205:	68 3d 90 10 80       	push   $0x8010903d
+8010820a:	e8 20 84 ff ff       	call   8010062f <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010820f:	83 c4 0c             	add    $0xc,%esp
+80108212:	ff 75 0c             	push   0xc(%ebp)
+80108215:	57                   	push   %edi
+80108216:	ff 75 08             	push   0x8(%ebp)
+80108219:	e8 b6 fe ff ff       	call   801080d4 <deallocuvm>
+      return 0;
+8010821e:	83 c4 10             	add    $0x10,%esp
+80108221:	ba 00 00 00 00       	mov    $0x0,%edx
+80108226:	eb 45                	jmp    8010826d <allocuvm+0xf3>
+        panic("V2P on address < KERNBASE "
+80108228:	83 ec 0c             	sub    $0xc,%esp
+8010822b:	68 08 88 10 80       	push   $0x80108808
+80108230:	e8 39 81 ff ff       	call   8010036e <panic>
+      cprintf("allocuvm out of memory (2)\n");
+80108235:	83 ec 0c             	sub    $0xc,%esp
+80108238:	68 55 90 10 80       	push   $0x80109055
+8010823d:	e8 ed 83 ff ff       	call   8010062f <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+80108242:	83 c4 0c             	add    $0xc,%esp
+80108245:	ff 75 0c             	push   0xc(%ebp)
+80108248:	57                   	push   %edi
+80108249:	ff 75 08             	push   0x8(%ebp)
+8010824c:	e8 83 fe ff ff       	call   801080d4 <deallocuvm>
+      kfree(mem);
+80108251:	89 1c 24             	mov    %ebx,(%esp)
+80108254:	e8 12 9d ff ff       	call   80101f6b <kfree>
+      return 0;
+80108259:	83 c4 10             	add    $0x10,%esp
+8010825c:	ba 00 00 00 00       	mov    $0x0,%edx
+80108261:	eb 0a                	jmp    8010826d <allocuvm+0xf3>
+80108263:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80108266:	eb 05                	jmp    8010826d <allocuvm+0xf3>
+    return 0;
+80108268:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+8010826d:	89 d0                	mov    %edx,%eax
+8010826f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108272:	5b                   	pop    %ebx
+80108273:	5e                   	pop    %esi
+80108274:	5f                   	pop    %edi
+80108275:	5d                   	pop    %ebp
+80108276:	c3                   	ret
+
+80108277 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+80108277:	55                   	push   %ebp
+80108278:	89 e5                	mov    %esp,%ebp
+8010827a:	56                   	push   %esi
+8010827b:	53                   	push   %ebx
+8010827c:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+8010827f:	85 f6                	test   %esi,%esi
+80108281:	74 1a                	je     8010829d <freevm+0x26>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+80108283:	83 ec 04             	sub    $0x4,%esp
+80108286:	6a 00                	push   $0x0
+80108288:	68 00 00 00 80       	push   $0x80000000
+8010828d:	56                   	push   %esi
+8010828e:	e8 41 fe ff ff       	call   801080d4 <deallocuvm>
+  for(i = 0; i < NPDENTRIES; i++){
+80108293:	83 c4 10             	add    $0x10,%esp
+80108296:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010829b:	eb 21                	jmp    801082be <freevm+0x47>
+    panic("freevm: no pgdir");
+8010829d:	83 ec 0c             	sub    $0xc,%esp
+801082a0:	68 71 90 10 80       	push   $0x80109071
+801082a5:	e8 c4 80 ff ff       	call   8010036e <panic>
+    return (char*)a + KERNBASE;
+801082aa:	05 00 00 00 80       	add    $0x80000000,%eax
+    if(pgdir[i] & PTE_P){
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+      kfree(v);
+801082af:	83 ec 0c             	sub    $0xc,%esp
+801082b2:	50                   	push   %eax
+801082b3:	e8 b3 9c ff ff       	call   80101f6b <kfree>
+801082b8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+801082bb:	83 c3 01             	add    $0x1,%ebx
+801082be:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+801082c4:	77 20                	ja     801082e6 <freevm+0x6f>
+    if(pgdir[i] & PTE_P){
+801082c6:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+801082c9:	a8 01                	test   $0x1,%al
+801082cb:	74 ee                	je     801082bb <freevm+0x44>
+801082cd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if (a > KERNBASE)
+801082d2:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+801082d7:	76 d1                	jbe    801082aa <freevm+0x33>
+        panic("P2V on address > KERNBASE");
+801082d9:	83 ec 0c             	sub    $0xc,%esp
+801082dc:	68 34 8b 10 80       	push   $0x80108b34
+801082e1:	e8 88 80 ff ff       	call   8010036e <panic>
+    }
+  }
+  kfree((char*)pgdir);
+801082e6:	83 ec 0c             	sub    $0xc,%esp
+801082e9:	56                   	push   %esi
+801082ea:	e8 7c 9c ff ff       	call   80101f6b <kfree>
+}
+801082ef:	83 c4 10             	add    $0x10,%esp
+801082f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801082f5:	5b                   	pop    %ebx
+801082f6:	5e                   	pop    %esi
+801082f7:	5d                   	pop    %ebp
+801082f8:	c3                   	ret
+
+801082f9 <setupkvm>:
+{
+801082f9:	55                   	push   %ebp
+801082fa:	89 e5                	mov    %esp,%ebp
+801082fc:	56                   	push   %esi
+801082fd:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+801082fe:	e8 a5 9d ff ff       	call   801020a8 <kalloc>
+80108303:	89 c6                	mov    %eax,%esi
+80108305:	85 c0                	test   %eax,%eax
+80108307:	74 55                	je     8010835e <setupkvm+0x65>
+  memset(pgdir, 0, PGSIZE);
+80108309:	83 ec 04             	sub    $0x4,%esp
+8010830c:	68 00 10 00 00       	push   $0x1000
+80108311:	6a 00                	push   $0x0
+80108313:	50                   	push   %eax
+80108314:	e8 48 d4 ff ff       	call   80105761 <memset>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+80108319:	83 c4 10             	add    $0x10,%esp
+8010831c:	bb 80 c4 10 80       	mov    $0x8010c480,%ebx
+80108321:	81 fb c0 c4 10 80    	cmp    $0x8010c4c0,%ebx
+80108327:	73 35                	jae    8010835e <setupkvm+0x65>
+                (uint)k->phys_start, k->perm) < 0) {
+80108329:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010832c:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010832f:	29 c1                	sub    %eax,%ecx
+80108331:	8b 13                	mov    (%ebx),%edx
+80108333:	83 ec 08             	sub    $0x8,%esp
+80108336:	ff 73 0c             	push   0xc(%ebx)
+80108339:	50                   	push   %eax
+8010833a:	89 f0                	mov    %esi,%eax
+8010833c:	e8 de f7 ff ff       	call   80107b1f <mappages>
+80108341:	83 c4 10             	add    $0x10,%esp
+80108344:	85 c0                	test   %eax,%eax
+80108346:	78 05                	js     8010834d <setupkvm+0x54>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+80108348:	83 c3 10             	add    $0x10,%ebx
+8010834b:	eb d4                	jmp    80108321 <setupkvm+0x28>
+      freevm(pgdir);
+8010834d:	83 ec 0c             	sub    $0xc,%esp
+80108350:	56                   	push   %esi
+80108351:	e8 21 ff ff ff       	call   80108277 <freevm>
+      return 0;
+80108356:	83 c4 10             	add    $0x10,%esp
+80108359:	be 00 00 00 00       	mov    $0x0,%esi
+}
+8010835e:	89 f0                	mov    %esi,%eax
+80108360:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108363:	5b                   	pop    %ebx
+80108364:	5e                   	pop    %esi
+80108365:	5d                   	pop    %ebp
+80108366:	c3                   	ret
+
+80108367 <kvmalloc>:
+{
+80108367:	55                   	push   %ebp
+80108368:	89 e5                	mov    %esp,%ebp
+8010836a:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010836d:	e8 87 ff ff ff       	call   801082f9 <setupkvm>
+80108372:	a3 f0 20 15 80       	mov    %eax,0x801520f0
+  switchkvm();
+80108377:	e8 8f fa ff ff       	call   80107e0b <switchkvm>
+}
+8010837c:	c9                   	leave
+8010837d:	c3                   	ret
+
+8010837e <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010837e:	55                   	push   %ebp
+8010837f:	89 e5                	mov    %esp,%ebp
+80108381:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+80108384:	b9 00 00 00 00       	mov    $0x0,%ecx
+80108389:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010838c:	8b 45 08             	mov    0x8(%ebp),%eax
+8010838f:	e8 f0 f6 ff ff       	call   80107a84 <walkpgdir>
+  if(pte == 0)
+80108394:	85 c0                	test   %eax,%eax
+80108396:	74 09                	je     801083a1 <clearpteu+0x23>
+    panic("clearpteu");
+  *pte &= ~PTE_U;
+80108398:	8b 10                	mov    (%eax),%edx
+8010839a:	83 e2 fb             	and    $0xfffffffb,%edx
+8010839d:	89 10                	mov    %edx,(%eax)
+}
+8010839f:	c9                   	leave
+801083a0:	c3                   	ret
+    panic("clearpteu");
+801083a1:	83 ec 0c             	sub    $0xc,%esp
+801083a4:	68 82 90 10 80       	push   $0x80109082
+801083a9:	e8 c0 7f ff ff       	call   8010036e <panic>
+
+801083ae <copyuvm>:
+
+// Given a parent process's page table, create a copy
+// of it for a child.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+801083ae:	55                   	push   %ebp
+801083af:	89 e5                	mov    %esp,%ebp
+801083b1:	57                   	push   %edi
+801083b2:	56                   	push   %esi
+801083b3:	53                   	push   %ebx
+801083b4:	83 ec 1c             	sub    $0x1c,%esp
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+  char *mem;
+
+  if((d = setupkvm()) == 0)
+801083b7:	e8 3d ff ff ff       	call   801082f9 <setupkvm>
+801083bc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801083bf:	85 c0                	test   %eax,%eax
+801083c1:	0f 84 f2 00 00 00    	je     801084b9 <copyuvm+0x10b>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+801083c7:	bf 00 00 00 00       	mov    $0x0,%edi
+801083cc:	eb 3a                	jmp    80108408 <copyuvm+0x5a>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+      panic("copyuvm: pte should exist");
+801083ce:	83 ec 0c             	sub    $0xc,%esp
+801083d1:	68 8c 90 10 80       	push   $0x8010908c
+801083d6:	e8 93 7f ff ff       	call   8010036e <panic>
+    if(!(*pte & PTE_P))
+      panic("copyuvm: page not present");
+801083db:	83 ec 0c             	sub    $0xc,%esp
+801083de:	68 a6 90 10 80       	push   $0x801090a6
+801083e3:	e8 86 7f ff ff       	call   8010036e <panic>
+801083e8:	83 ec 0c             	sub    $0xc,%esp
+801083eb:	68 34 8b 10 80       	push   $0x80108b34
+801083f0:	e8 79 7f ff ff       	call   8010036e <panic>
+        panic("V2P on address < KERNBASE "
+801083f5:	83 ec 0c             	sub    $0xc,%esp
+801083f8:	68 08 88 10 80       	push   $0x80108808
+801083fd:	e8 6c 7f ff ff       	call   8010036e <panic>
+  for(i = 0; i < sz; i += PGSIZE){
+80108402:	81 c7 00 10 00 00    	add    $0x1000,%edi
+80108408:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010840b:	0f 83 a8 00 00 00    	jae    801084b9 <copyuvm+0x10b>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+80108411:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80108414:	b9 00 00 00 00       	mov    $0x0,%ecx
+80108419:	89 fa                	mov    %edi,%edx
+8010841b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010841e:	e8 61 f6 ff ff       	call   80107a84 <walkpgdir>
+80108423:	85 c0                	test   %eax,%eax
+80108425:	74 a7                	je     801083ce <copyuvm+0x20>
+    if(!(*pte & PTE_P))
+80108427:	8b 00                	mov    (%eax),%eax
+80108429:	a8 01                	test   $0x1,%al
+8010842b:	74 ae                	je     801083db <copyuvm+0x2d>
+8010842d:	89 c6                	mov    %eax,%esi
+8010842f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+static inline uint PTE_FLAGS(uint pte) { return pte & 0xFFF; }
+80108435:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010843a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    pa = PTE_ADDR(*pte);
+    flags = PTE_FLAGS(*pte);
+    if((mem = kalloc()) == 0)
+8010843d:	e8 66 9c ff ff       	call   801020a8 <kalloc>
+80108442:	89 c3                	mov    %eax,%ebx
+80108444:	85 c0                	test   %eax,%eax
+80108446:	74 5c                	je     801084a4 <copyuvm+0xf6>
+    if (a > KERNBASE)
+80108448:	81 fe 00 00 00 80    	cmp    $0x80000000,%esi
+8010844e:	77 98                	ja     801083e8 <copyuvm+0x3a>
+    return (char*)a + KERNBASE;
+80108450:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+      goto bad;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+80108456:	83 ec 04             	sub    $0x4,%esp
+80108459:	68 00 10 00 00       	push   $0x1000
+8010845e:	56                   	push   %esi
+8010845f:	50                   	push   %eax
+80108460:	e8 74 d3 ff ff       	call   801057d9 <memmove>
+    if (a < (void*) KERNBASE)
+80108465:	83 c4 10             	add    $0x10,%esp
+80108468:	81 fb ff ff ff 7f    	cmp    $0x7fffffff,%ebx
+8010846e:	76 85                	jbe    801083f5 <copyuvm+0x47>
+    return (uint)a - KERNBASE;
+80108470:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
+80108476:	83 ec 08             	sub    $0x8,%esp
+80108479:	ff 75 e0             	push   -0x20(%ebp)
+8010847c:	50                   	push   %eax
+8010847d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80108482:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80108485:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80108488:	e8 92 f6 ff ff       	call   80107b1f <mappages>
+8010848d:	83 c4 10             	add    $0x10,%esp
+80108490:	85 c0                	test   %eax,%eax
+80108492:	0f 89 6a ff ff ff    	jns    80108402 <copyuvm+0x54>
+      kfree(mem);
+80108498:	83 ec 0c             	sub    $0xc,%esp
+8010849b:	53                   	push   %ebx
+8010849c:	e8 ca 9a ff ff       	call   80101f6b <kfree>
+      goto bad;
+801084a1:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  return d;
+
+bad:
+  freevm(d);
+801084a4:	83 ec 0c             	sub    $0xc,%esp
+801084a7:	ff 75 dc             	push   -0x24(%ebp)
+801084aa:	e8 c8 fd ff ff       	call   80108277 <freevm>
+  return 0;
+801084af:	83 c4 10             	add    $0x10,%esp
+801084b2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+}
+801084b9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801084bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801084bf:	5b                   	pop    %ebx
+801084c0:	5e                   	pop    %esi
+801084c1:	5f                   	pop    %edi
+801084c2:	5d                   	pop    %ebp
+801084c3:	c3                   	ret
+
+801084c4 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+801084c4:	55                   	push   %ebp
+801084c5:	89 e5                	mov    %esp,%ebp
+801084c7:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+801084ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+801084cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+801084d2:	8b 45 08             	mov    0x8(%ebp),%eax
+801084d5:	e8 aa f5 ff ff       	call   80107a84 <walkpgdir>
+  if((*pte & PTE_P) == 0)
+801084da:	8b 00                	mov    (%eax),%eax
+801084dc:	a8 01                	test   $0x1,%al
+801084de:	74 24                	je     80108504 <uva2ka+0x40>
+    return 0;
+  if((*pte & PTE_U) == 0)
+801084e0:	a8 04                	test   $0x4,%al
+801084e2:	74 27                	je     8010850b <uva2ka+0x47>
+static inline uint PTE_ADDR(uint pte)  { return pte & ~0xFFF; }
+801084e4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if (a > KERNBASE)
+801084e9:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+801084ee:	77 07                	ja     801084f7 <uva2ka+0x33>
+    return (char*)a + KERNBASE;
+801084f0:	05 00 00 00 80       	add    $0x80000000,%eax
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+}
+801084f5:	c9                   	leave
+801084f6:	c3                   	ret
+        panic("P2V on address > KERNBASE");
+801084f7:	83 ec 0c             	sub    $0xc,%esp
+801084fa:	68 34 8b 10 80       	push   $0x80108b34
+801084ff:	e8 6a 7e ff ff       	call   8010036e <panic>
+    return 0;
+80108504:	b8 00 00 00 00       	mov    $0x0,%eax
+80108509:	eb ea                	jmp    801084f5 <uva2ka+0x31>
+    return 0;
+8010850b:	b8 00 00 00 00       	mov    $0x0,%eax
+80108510:	eb e3                	jmp    801084f5 <uva2ka+0x31>
+
+80108512 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+80108512:	55                   	push   %ebp
+80108513:	89 e5                	mov    %esp,%ebp
+80108515:	57                   	push   %edi
+80108516:	56                   	push   %esi
+80108517:	53                   	push   %ebx
+80108518:	83 ec 0c             	sub    $0xc,%esp
+8010851b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *buf, *pa0;
+  uint n, va0;
+
+  buf = (char*)p;
+  while(len > 0){
+8010851e:	eb 20                	jmp    80108540 <copyout+0x2e>
+    if(pa0 == 0)
+      return -1;
+    n = PGSIZE - (va - va0);
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+80108520:	29 fe                	sub    %edi,%esi
+80108522:	01 f0                	add    %esi,%eax
+80108524:	83 ec 04             	sub    $0x4,%esp
+80108527:	53                   	push   %ebx
+80108528:	ff 75 10             	push   0x10(%ebp)
+8010852b:	50                   	push   %eax
+8010852c:	e8 a8 d2 ff ff       	call   801057d9 <memmove>
+    len -= n;
+80108531:	29 5d 14             	sub    %ebx,0x14(%ebp)
+    buf += n;
+80108534:	01 5d 10             	add    %ebx,0x10(%ebp)
+    va = va0 + PGSIZE;
+80108537:	8d b7 00 10 00 00    	lea    0x1000(%edi),%esi
+8010853d:	83 c4 10             	add    $0x10,%esp
+  while(len > 0){
+80108540:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+80108544:	74 2f                	je     80108575 <copyout+0x63>
+    va0 = (uint)PGROUNDDOWN(va);
+80108546:	89 f7                	mov    %esi,%edi
+80108548:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+    pa0 = uva2ka(pgdir, (char*)va0);
+8010854e:	83 ec 08             	sub    $0x8,%esp
+80108551:	57                   	push   %edi
+80108552:	ff 75 08             	push   0x8(%ebp)
+80108555:	e8 6a ff ff ff       	call   801084c4 <uva2ka>
+    if(pa0 == 0)
+8010855a:	83 c4 10             	add    $0x10,%esp
+8010855d:	85 c0                	test   %eax,%eax
+8010855f:	74 21                	je     80108582 <copyout+0x70>
+    n = PGSIZE - (va - va0);
+80108561:	89 fb                	mov    %edi,%ebx
+80108563:	29 f3                	sub    %esi,%ebx
+80108565:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    if(n > len)
+8010856b:	39 5d 14             	cmp    %ebx,0x14(%ebp)
+8010856e:	73 b0                	jae    80108520 <copyout+0xe>
+      n = len;
+80108570:	8b 5d 14             	mov    0x14(%ebp),%ebx
+80108573:	eb ab                	jmp    80108520 <copyout+0xe>
+  }
+  return 0;
+80108575:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010857a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010857d:	5b                   	pop    %ebx
+8010857e:	5e                   	pop    %esi
+8010857f:	5f                   	pop    %edi
+80108580:	5d                   	pop    %ebp
+80108581:	c3                   	ret
+      return -1;
+80108582:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108587:	eb f1                	jmp    8010857a <copyout+0x68>
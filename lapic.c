@@ -43,6 +43,8 @@
 
 volatile uint *lapic;  // Initialized in mp.c
 
+#define TICK    10000000     // Timer counts per tick
+
 //PAGEBREAK!
 static void
 lapicw(int index, int value)
@@ -66,7 +68,7 @@ lapicinit(void)
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, TICK);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -97,6 +99,17 @@ lapicinit(void)
   lapicw(TPR, 0);
 }
 
+// Reprogram this CPU's timer to interrupt once, n ticks from now,
+// or not at all if n is 0, instead of periodically.
+void
+lapiconeshot(uint n)
+{
+  if(!lapic)
+    return;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, n * TICK);
+}
+
 int
 lapicid(void)
 {
@@ -120,6 +133,16 @@ microdelay(int us)
 {
 }
 
+// Send a fixed interrupt with the given vector to another CPU.
+void
+lapicsendipi(uchar apicid, int vector)
+{
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 #define CMOS_PORT    0x70
 #define CMOS_RETURN  0x71
 
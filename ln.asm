@@ -0,0 +1,539 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  12:	83 39 03             	cmpl   $0x3,(%ecx)
+  15:	74 14                	je     2b <main+0x2b>
+    printf(2, "Usage: ln old new\n");
+  17:	83 ec 08             	sub    $0x8,%esp
+  1a:	68 80 03 00 00       	push   $0x380
+  1f:	6a 02                	push   $0x2
+  21:	e8 f3 01 00 00       	call   219 <printf>
+    exit();
+  26:	e8 39 00 00 00       	call   64 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2b:	83 ec 08             	sub    $0x8,%esp
+  2e:	ff 73 08             	push   0x8(%ebx)
+  31:	ff 73 04             	push   0x4(%ebx)
+  34:	e8 8b 00 00 00       	call   c4 <link>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	85 c0                	test   %eax,%eax
+  3e:	78 05                	js     45 <main+0x45>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  40:	e8 1f 00 00 00       	call   64 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  45:	ff 73 08             	push   0x8(%ebx)
+  48:	ff 73 04             	push   0x4(%ebx)
+  4b:	68 93 03 00 00       	push   $0x393
+  50:	6a 02                	push   $0x2
+  52:	e8 c2 01 00 00       	call   219 <printf>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	eb e4                	jmp    40 <main+0x40>
+
+0000005c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  61:	cd 40                	int    $0x40
+  63:	c3                   	ret
+
+00000064 <exit>:
+SYSCALL(exit)
+  64:	b8 02 00 00 00       	mov    $0x2,%eax
+  69:	cd 40                	int    $0x40
+  6b:	c3                   	ret
+
+0000006c <wait>:
+SYSCALL(wait)
+  6c:	b8 03 00 00 00       	mov    $0x3,%eax
+  71:	cd 40                	int    $0x40
+  73:	c3                   	ret
+
+00000074 <pipe>:
+SYSCALL(pipe)
+  74:	b8 04 00 00 00       	mov    $0x4,%eax
+  79:	cd 40                	int    $0x40
+  7b:	c3                   	ret
+
+0000007c <read>:
+SYSCALL(read)
+  7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  81:	cd 40                	int    $0x40
+  83:	c3                   	ret
+
+00000084 <write>:
+SYSCALL(write)
+  84:	b8 10 00 00 00       	mov    $0x10,%eax
+  89:	cd 40                	int    $0x40
+  8b:	c3                   	ret
+
+0000008c <close>:
+SYSCALL(close)
+  8c:	b8 15 00 00 00       	mov    $0x15,%eax
+  91:	cd 40                	int    $0x40
+  93:	c3                   	ret
+
+00000094 <kill>:
+SYSCALL(kill)
+  94:	b8 06 00 00 00       	mov    $0x6,%eax
+  99:	cd 40                	int    $0x40
+  9b:	c3                   	ret
+
+0000009c <exec>:
+SYSCALL(exec)
+  9c:	b8 07 00 00 00       	mov    $0x7,%eax
+  a1:	cd 40                	int    $0x40
+  a3:	c3                   	ret
+
+000000a4 <open>:
+SYSCALL(open)
+  a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  a9:	cd 40                	int    $0x40
+  ab:	c3                   	ret
+
+000000ac <mknod>:
+SYSCALL(mknod)
+  ac:	b8 11 00 00 00       	mov    $0x11,%eax
+  b1:	cd 40                	int    $0x40
+  b3:	c3                   	ret
+
+000000b4 <unlink>:
+SYSCALL(unlink)
+  b4:	b8 12 00 00 00       	mov    $0x12,%eax
+  b9:	cd 40                	int    $0x40
+  bb:	c3                   	ret
+
+000000bc <fstat>:
+SYSCALL(fstat)
+  bc:	b8 08 00 00 00       	mov    $0x8,%eax
+  c1:	cd 40                	int    $0x40
+  c3:	c3                   	ret
+
+000000c4 <link>:
+SYSCALL(link)
+  c4:	b8 13 00 00 00       	mov    $0x13,%eax
+  c9:	cd 40                	int    $0x40
+  cb:	c3                   	ret
+
+000000cc <mkdir>:
+SYSCALL(mkdir)
+  cc:	b8 14 00 00 00       	mov    $0x14,%eax
+  d1:	cd 40                	int    $0x40
+  d3:	c3                   	ret
+
+000000d4 <chdir>:
+SYSCALL(chdir)
+  d4:	b8 09 00 00 00       	mov    $0x9,%eax
+  d9:	cd 40                	int    $0x40
+  db:	c3                   	ret
+
+000000dc <dup>:
+SYSCALL(dup)
+  dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  e1:	cd 40                	int    $0x40
+  e3:	c3                   	ret
+
+000000e4 <getpid>:
+SYSCALL(getpid)
+  e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  e9:	cd 40                	int    $0x40
+  eb:	c3                   	ret
+
+000000ec <sbrk>:
+SYSCALL(sbrk)
+  ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+  f1:	cd 40                	int    $0x40
+  f3:	c3                   	ret
+
+000000f4 <sleep>:
+SYSCALL(sleep)
+  f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  f9:	cd 40                	int    $0x40
+  fb:	c3                   	ret
+
+000000fc <uptime>:
+SYSCALL(uptime)
+  fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 101:	cd 40                	int    $0x40
+ 103:	c3                   	ret
+
+00000104 <yield>:
+SYSCALL(yield)
+ 104:	b8 16 00 00 00       	mov    $0x16,%eax
+ 109:	cd 40                	int    $0x40
+ 10b:	c3                   	ret
+
+0000010c <shutdown>:
+SYSCALL(shutdown)
+ 10c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 111:	cd 40                	int    $0x40
+ 113:	c3                   	ret
+
+00000114 <nicefork>:
+SYSCALL(nicefork)
+ 114:	b8 18 00 00 00       	mov    $0x18,%eax
+ 119:	cd 40                	int    $0x40
+ 11b:	c3                   	ret
+
+0000011c <schedlog>:
+SYSCALL(schedlog)
+ 11c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 121:	cd 40                	int    $0x40
+ 123:	c3                   	ret
+
+00000124 <schedlogread>:
+SYSCALL(schedlogread)
+ 124:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 129:	cd 40                	int    $0x40
+ 12b:	c3                   	ret
+
+0000012c <tracectl>:
+SYSCALL(tracectl)
+ 12c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 131:	cd 40                	int    $0x40
+ 133:	c3                   	ret
+
+00000134 <getcpustat>:
+SYSCALL(getcpustat)
+ 134:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 139:	cd 40                	int    $0x40
+ 13b:	c3                   	ret
+
+0000013c <setpolicy>:
+SYSCALL(setpolicy)
+ 13c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 141:	cd 40                	int    $0x40
+ 143:	c3                   	ret
+
+00000144 <affinity>:
+SYSCALL(affinity)
+ 144:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 149:	cd 40                	int    $0x40
+ 14b:	c3                   	ret
+
+0000014c <setnice>:
+SYSCALL(setnice)
+ 14c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 151:	cd 40                	int    $0x40
+ 153:	c3                   	ret
+
+00000154 <getnice>:
+SYSCALL(getnice)
+ 154:	b8 20 00 00 00       	mov    $0x20,%eax
+ 159:	cd 40                	int    $0x40
+ 15b:	c3                   	ret
+
+0000015c <setclass>:
+SYSCALL(setclass)
+ 15c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 161:	cd 40                	int    $0x40
+ 163:	c3                   	ret
+
+00000164 <isocpu>:
+SYSCALL(isocpu)
+ 164:	b8 22 00 00 00       	mov    $0x22,%eax
+ 169:	cd 40                	int    $0x40
+ 16b:	c3                   	ret
+
+0000016c <getschedstats>:
+SYSCALL(getschedstats)
+ 16c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 171:	cd 40                	int    $0x40
+ 173:	c3                   	ret
+
+00000174 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+ 177:	83 ec 1c             	sub    $0x1c,%esp
+ 17a:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 17d:	6a 01                	push   $0x1
+ 17f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 182:	52                   	push   %edx
+ 183:	50                   	push   %eax
+ 184:	e8 fb fe ff ff       	call   84 <write>
+}
+ 189:	83 c4 10             	add    $0x10,%esp
+ 18c:	c9                   	leave
+ 18d:	c3                   	ret
+
+0000018e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 18e:	55                   	push   %ebp
+ 18f:	89 e5                	mov    %esp,%ebp
+ 191:	57                   	push   %edi
+ 192:	56                   	push   %esi
+ 193:	53                   	push   %ebx
+ 194:	83 ec 2c             	sub    $0x2c,%esp
+ 197:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 19a:	89 d0                	mov    %edx,%eax
+ 19c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 19e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 1a2:	0f 95 c1             	setne  %cl
+ 1a5:	c1 ea 1f             	shr    $0x1f,%edx
+ 1a8:	84 d1                	test   %dl,%cl
+ 1aa:	74 44                	je     1f0 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 1ac:	f7 d8                	neg    %eax
+ 1ae:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 1b0:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 1b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 1bc:	89 c8                	mov    %ecx,%eax
+ 1be:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1c3:	f7 f6                	div    %esi
+ 1c5:	89 df                	mov    %ebx,%edi
+ 1c7:	83 c3 01             	add    $0x1,%ebx
+ 1ca:	0f b6 92 08 04 00 00 	movzbl 0x408(%edx),%edx
+ 1d1:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 1d5:	89 ca                	mov    %ecx,%edx
+ 1d7:	89 c1                	mov    %eax,%ecx
+ 1d9:	39 f2                	cmp    %esi,%edx
+ 1db:	73 df                	jae    1bc <printint+0x2e>
+  if(neg)
+ 1dd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 1e1:	74 31                	je     214 <printint+0x86>
+    buf[i++] = '-';
+ 1e3:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 1e8:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 1eb:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1ee:	eb 17                	jmp    207 <printint+0x79>
+    x = xx;
+ 1f0:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 1f2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 1f9:	eb bc                	jmp    1b7 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 1fb:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 200:	89 f0                	mov    %esi,%eax
+ 202:	e8 6d ff ff ff       	call   174 <putc>
+  while(--i >= 0)
+ 207:	83 eb 01             	sub    $0x1,%ebx
+ 20a:	79 ef                	jns    1fb <printint+0x6d>
+}
+ 20c:	83 c4 2c             	add    $0x2c,%esp
+ 20f:	5b                   	pop    %ebx
+ 210:	5e                   	pop    %esi
+ 211:	5f                   	pop    %edi
+ 212:	5d                   	pop    %ebp
+ 213:	c3                   	ret
+ 214:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 217:	eb ee                	jmp    207 <printint+0x79>
+
+00000219 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 219:	55                   	push   %ebp
+ 21a:	89 e5                	mov    %esp,%ebp
+ 21c:	57                   	push   %edi
+ 21d:	56                   	push   %esi
+ 21e:	53                   	push   %ebx
+ 21f:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 222:	8d 45 10             	lea    0x10(%ebp),%eax
+ 225:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 228:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 22d:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 232:	eb 14                	jmp    248 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 234:	89 fa                	mov    %edi,%edx
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	e8 36 ff ff ff       	call   174 <putc>
+ 23e:	eb 05                	jmp    245 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 240:	83 fe 25             	cmp    $0x25,%esi
+ 243:	74 25                	je     26a <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 245:	83 c3 01             	add    $0x1,%ebx
+ 248:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24b:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 24f:	84 c0                	test   %al,%al
+ 251:	0f 84 20 01 00 00    	je     377 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 257:	0f be f8             	movsbl %al,%edi
+ 25a:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 25d:	85 f6                	test   %esi,%esi
+ 25f:	75 df                	jne    240 <printf+0x27>
+      if(c == '%'){
+ 261:	83 f8 25             	cmp    $0x25,%eax
+ 264:	75 ce                	jne    234 <printf+0x1b>
+        state = '%';
+ 266:	89 c6                	mov    %eax,%esi
+ 268:	eb db                	jmp    245 <printf+0x2c>
+      if(c == 'd'){
+ 26a:	83 f8 25             	cmp    $0x25,%eax
+ 26d:	0f 84 cf 00 00 00    	je     342 <printf+0x129>
+ 273:	0f 8c dd 00 00 00    	jl     356 <printf+0x13d>
+ 279:	83 f8 78             	cmp    $0x78,%eax
+ 27c:	0f 8f d4 00 00 00    	jg     356 <printf+0x13d>
+ 282:	83 f8 63             	cmp    $0x63,%eax
+ 285:	0f 8c cb 00 00 00    	jl     356 <printf+0x13d>
+ 28b:	83 e8 63             	sub    $0x63,%eax
+ 28e:	83 f8 15             	cmp    $0x15,%eax
+ 291:	0f 87 bf 00 00 00    	ja     356 <printf+0x13d>
+ 297:	ff 24 85 b0 03 00 00 	jmp    *0x3b0(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 29e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2a1:	8b 17                	mov    (%edi),%edx
+ 2a3:	83 ec 0c             	sub    $0xc,%esp
+ 2a6:	6a 01                	push   $0x1
+ 2a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 2ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b0:	e8 d9 fe ff ff       	call   18e <printint>
+        ap++;
+ 2b5:	83 c7 04             	add    $0x4,%edi
+ 2b8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2bb:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 2be:	be 00 00 00 00       	mov    $0x0,%esi
+ 2c3:	eb 80                	jmp    245 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 2c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2c8:	8b 17                	mov    (%edi),%edx
+ 2ca:	83 ec 0c             	sub    $0xc,%esp
+ 2cd:	6a 00                	push   $0x0
+ 2cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d7:	e8 b2 fe ff ff       	call   18e <printint>
+        ap++;
+ 2dc:	83 c7 04             	add    $0x4,%edi
+ 2df:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2e2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2e5:	be 00 00 00 00       	mov    $0x0,%esi
+ 2ea:	e9 56 ff ff ff       	jmp    245 <printf+0x2c>
+        s = (char*)*ap;
+ 2ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2f2:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 2f4:	83 c0 04             	add    $0x4,%eax
+ 2f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 2fa:	85 f6                	test   %esi,%esi
+ 2fc:	75 15                	jne    313 <printf+0xfa>
+          s = "(null)";
+ 2fe:	be a7 03 00 00       	mov    $0x3a7,%esi
+ 303:	eb 0e                	jmp    313 <printf+0xfa>
+          putc(fd, *s);
+ 305:	0f be d2             	movsbl %dl,%edx
+ 308:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30b:	e8 64 fe ff ff       	call   174 <putc>
+          s++;
+ 310:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 313:	0f b6 16             	movzbl (%esi),%edx
+ 316:	84 d2                	test   %dl,%dl
+ 318:	75 eb                	jne    305 <printf+0xec>
+      state = 0;
+ 31a:	be 00 00 00 00       	mov    $0x0,%esi
+ 31f:	e9 21 ff ff ff       	jmp    245 <printf+0x2c>
+        putc(fd, *ap);
+ 324:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 327:	0f be 17             	movsbl (%edi),%edx
+ 32a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32d:	e8 42 fe ff ff       	call   174 <putc>
+        ap++;
+ 332:	83 c7 04             	add    $0x4,%edi
+ 335:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 338:	be 00 00 00 00       	mov    $0x0,%esi
+ 33d:	e9 03 ff ff ff       	jmp    245 <printf+0x2c>
+        putc(fd, c);
+ 342:	89 fa                	mov    %edi,%edx
+ 344:	8b 45 08             	mov    0x8(%ebp),%eax
+ 347:	e8 28 fe ff ff       	call   174 <putc>
+      state = 0;
+ 34c:	be 00 00 00 00       	mov    $0x0,%esi
+ 351:	e9 ef fe ff ff       	jmp    245 <printf+0x2c>
+        putc(fd, '%');
+ 356:	ba 25 00 00 00       	mov    $0x25,%edx
+ 35b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35e:	e8 11 fe ff ff       	call   174 <putc>
+        putc(fd, c);
+ 363:	89 fa                	mov    %edi,%edx
+ 365:	8b 45 08             	mov    0x8(%ebp),%eax
+ 368:	e8 07 fe ff ff       	call   174 <putc>
+      state = 0;
+ 36d:	be 00 00 00 00       	mov    $0x0,%esi
+ 372:	e9 ce fe ff ff       	jmp    245 <printf+0x2c>
+    }
+  }
+}
+ 377:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37a:	5b                   	pop    %ebx
+ 37b:	5e                   	pop    %esi
+ 37c:	5f                   	pop    %edi
+ 37d:	5d                   	pop    %ebp
+ 37e:	c3                   	ret
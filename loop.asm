@@ -0,0 +1,239 @@
+
+_loop:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+int main() {
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+int dummy = 0;
+for (unsigned int i = 0; i < 4e9; i++) {
+   6:	b8 00 00 00 00       	mov    $0x0,%eax
+   b:	eb 03                	jmp    10 <main+0x10>
+   d:	83 c0 01             	add    $0x1,%eax
+  10:	3d ff 27 6b ee       	cmp    $0xee6b27ff,%eax
+  15:	76 f6                	jbe    d <main+0xd>
+dummy += i;
+}
+exit();
+  17:	e8 08 00 00 00       	call   24 <exit>
+
+0000001c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  21:	cd 40                	int    $0x40
+  23:	c3                   	ret
+
+00000024 <exit>:
+SYSCALL(exit)
+  24:	b8 02 00 00 00       	mov    $0x2,%eax
+  29:	cd 40                	int    $0x40
+  2b:	c3                   	ret
+
+0000002c <wait>:
+SYSCALL(wait)
+  2c:	b8 03 00 00 00       	mov    $0x3,%eax
+  31:	cd 40                	int    $0x40
+  33:	c3                   	ret
+
+00000034 <pipe>:
+SYSCALL(pipe)
+  34:	b8 04 00 00 00       	mov    $0x4,%eax
+  39:	cd 40                	int    $0x40
+  3b:	c3                   	ret
+
+0000003c <read>:
+SYSCALL(read)
+  3c:	b8 05 00 00 00       	mov    $0x5,%eax
+  41:	cd 40                	int    $0x40
+  43:	c3                   	ret
+
+00000044 <write>:
+SYSCALL(write)
+  44:	b8 10 00 00 00       	mov    $0x10,%eax
+  49:	cd 40                	int    $0x40
+  4b:	c3                   	ret
+
+0000004c <close>:
+SYSCALL(close)
+  4c:	b8 15 00 00 00       	mov    $0x15,%eax
+  51:	cd 40                	int    $0x40
+  53:	c3                   	ret
+
+00000054 <kill>:
+SYSCALL(kill)
+  54:	b8 06 00 00 00       	mov    $0x6,%eax
+  59:	cd 40                	int    $0x40
+  5b:	c3                   	ret
+
+0000005c <exec>:
+SYSCALL(exec)
+  5c:	b8 07 00 00 00       	mov    $0x7,%eax
+  61:	cd 40                	int    $0x40
+  63:	c3                   	ret
+
+00000064 <open>:
+SYSCALL(open)
+  64:	b8 0f 00 00 00       	mov    $0xf,%eax
+  69:	cd 40                	int    $0x40
+  6b:	c3                   	ret
+
+0000006c <mknod>:
+SYSCALL(mknod)
+  6c:	b8 11 00 00 00       	mov    $0x11,%eax
+  71:	cd 40                	int    $0x40
+  73:	c3                   	ret
+
+00000074 <unlink>:
+SYSCALL(unlink)
+  74:	b8 12 00 00 00       	mov    $0x12,%eax
+  79:	cd 40                	int    $0x40
+  7b:	c3                   	ret
+
+0000007c <fstat>:
+SYSCALL(fstat)
+  7c:	b8 08 00 00 00       	mov    $0x8,%eax
+  81:	cd 40                	int    $0x40
+  83:	c3                   	ret
+
+00000084 <link>:
+SYSCALL(link)
+  84:	b8 13 00 00 00       	mov    $0x13,%eax
+  89:	cd 40                	int    $0x40
+  8b:	c3                   	ret
+
+0000008c <mkdir>:
+SYSCALL(mkdir)
+  8c:	b8 14 00 00 00       	mov    $0x14,%eax
+  91:	cd 40                	int    $0x40
+  93:	c3                   	ret
+
+00000094 <chdir>:
+SYSCALL(chdir)
+  94:	b8 09 00 00 00       	mov    $0x9,%eax
+  99:	cd 40                	int    $0x40
+  9b:	c3                   	ret
+
+0000009c <dup>:
+SYSCALL(dup)
+  9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  a1:	cd 40                	int    $0x40
+  a3:	c3                   	ret
+
+000000a4 <getpid>:
+SYSCALL(getpid)
+  a4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  a9:	cd 40                	int    $0x40
+  ab:	c3                   	ret
+
+000000ac <sbrk>:
+SYSCALL(sbrk)
+  ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+  b1:	cd 40                	int    $0x40
+  b3:	c3                   	ret
+
+000000b4 <sleep>:
+SYSCALL(sleep)
+  b4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  b9:	cd 40                	int    $0x40
+  bb:	c3                   	ret
+
+000000bc <uptime>:
+SYSCALL(uptime)
+  bc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  c1:	cd 40                	int    $0x40
+  c3:	c3                   	ret
+
+000000c4 <yield>:
+SYSCALL(yield)
+  c4:	b8 16 00 00 00       	mov    $0x16,%eax
+  c9:	cd 40                	int    $0x40
+  cb:	c3                   	ret
+
+000000cc <shutdown>:
+SYSCALL(shutdown)
+  cc:	b8 17 00 00 00       	mov    $0x17,%eax
+  d1:	cd 40                	int    $0x40
+  d3:	c3                   	ret
+
+000000d4 <nicefork>:
+SYSCALL(nicefork)
+  d4:	b8 18 00 00 00       	mov    $0x18,%eax
+  d9:	cd 40                	int    $0x40
+  db:	c3                   	ret
+
+000000dc <schedlog>:
+SYSCALL(schedlog)
+  dc:	b8 19 00 00 00       	mov    $0x19,%eax
+  e1:	cd 40                	int    $0x40
+  e3:	c3                   	ret
+
+000000e4 <schedlogread>:
+SYSCALL(schedlogread)
+  e4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  e9:	cd 40                	int    $0x40
+  eb:	c3                   	ret
+
+000000ec <tracectl>:
+SYSCALL(tracectl)
+  ec:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  f1:	cd 40                	int    $0x40
+  f3:	c3                   	ret
+
+000000f4 <getcpustat>:
+SYSCALL(getcpustat)
+  f4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  f9:	cd 40                	int    $0x40
+  fb:	c3                   	ret
+
+000000fc <setpolicy>:
+SYSCALL(setpolicy)
+  fc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 101:	cd 40                	int    $0x40
+ 103:	c3                   	ret
+
+00000104 <affinity>:
+SYSCALL(affinity)
+ 104:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 109:	cd 40                	int    $0x40
+ 10b:	c3                   	ret
+
+0000010c <setnice>:
+SYSCALL(setnice)
+ 10c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 111:	cd 40                	int    $0x40
+ 113:	c3                   	ret
+
+00000114 <getnice>:
+SYSCALL(getnice)
+ 114:	b8 20 00 00 00       	mov    $0x20,%eax
+ 119:	cd 40                	int    $0x40
+ 11b:	c3                   	ret
+
+0000011c <setclass>:
+SYSCALL(setclass)
+ 11c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 121:	cd 40                	int    $0x40
+ 123:	c3                   	ret
+
+00000124 <isocpu>:
+SYSCALL(isocpu)
+ 124:	b8 22 00 00 00       	mov    $0x22,%eax
+ 129:	cd 40                	int    $0x40
+ 12b:	c3                   	ret
+
+0000012c <getschedstats>:
+SYSCALL(getschedstats)
+ 12c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 131:	cd 40                	int    $0x40
+ 133:	c3                   	ret
@@ -1,4 +1,6 @@
+#ifndef NPROC
 #define NPROC        64  // maximum number of processes
+#endif
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
@@ -11,4 +13,6 @@
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
 #define FSSIZE       2000 // size of file system in blocks
+#define NSCHEDLOG    1024 // scheduler trace events kept per CPU
+#define NWAITQ       64  // wait channel hash buckets (a power of two)
 #include "bfs.h"
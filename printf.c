@@ -35,7 +35,25 @@ printint(int fd, int xx, int base, int sgn)
     putc(fd, buf[i]);
 }
 
-// Print to the given fd. Only understands %d, %x, %p, %s.
+static void
+printlong(int fd, uint64 x)
+{
+  char buf[20];
+  uint digit;
+  int i;
+
+  i = 0;
+  do{
+    x = divmod64(x, 10, &digit);
+    buf[i++] = '0' + digit;
+  }while(x != 0);
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+}
+
+// Print to the given fd. Only understands %d, %x, %p, %s,
+// and %l for an unsigned 64-bit decimal.
 void
 printf(int fd, const char *fmt, ...)
 {
@@ -57,6 +75,9 @@ printf(int fd, const char *fmt, ...)
       if(c == 'd'){
         printint(fd, *ap, 10, 1);
         ap++;
+      } else if(c == 'l'){
+        printlong(fd, ap[0] | (uint64)ap[1] << 32);
+        ap += 2;
       } else if(c == 'x' || c == 'p'){
         printint(fd, *ap, 16, 0);
         ap++;
@@ -5,227 +5,649 @@
 #include "mmu.h"
 #include "x86.h"
 #include "proc.h"
+#include "traps.h"
 #include "spinlock.h"
 #include "skiplist.h"
 #include "bfs.h"
+#include "sched.h"
+#include "trace.h"
 
-// Skiplist Start
 #define NULL 0
-#define SKIPLIST_LEVELS 4
 
-int seed = 1234567; 
 
+struct {
+  struct spinlock lock;
+  struct proc proc[NPROC];
+  struct proc *waitq[NWAITQ];  // SLEEPING processes, hashed by chan
+} ptable;
 
-struct skiplist * init_skiplist() {
-  struct skiplist * skiplist = (struct skiplist *) kalloc();
-  skiplist->levels = SKIPLIST_LEVELS;
-  skiplist->headers = (struct node **) kalloc(); // allocate N header;
+// One runqueue per CPU; cpus[i].runqueue points at runqueues[i].
+// Each skip list is protected by its own lock, not by ptable.lock,
+// so dispatching only contends with enqueue and dequeue.
+//
+// Lock order: ptable.lock before a runqueue lock.  Code holding a
+// runqueue lock must not acquire ptable.lock, and at most one
+// runqueue lock is held at a time.
+struct skiplist runqueues[NCPU];
 
-  // Initialize header nodes
-  for (int i = 0; i < SKIPLIST_LEVELS; i++) {
-    skiplist->headers[i] = (struct node *) kalloc();
-    skiplist->headers[i]->pid = -1;
-    skiplist->headers[i]->virtual_deadline = -1;
-    skiplist->headers[i]->next = NULL;
-    skiplist->headers[i]->prev = NULL;
-    if (i > 0) {
-      skiplist->headers[i]->forward = skiplist->headers[i-1];
-    }
-  }
+// SCHED_ISO processes wait on a single runqueue shared by all
+// CPUs, so whichever CPU comes free first runs them.  Same
+// locking rules as a per-CPU runqueue.
+struct skiplist iso_rq;
 
-  return skiplist;
-}
+// SCHED_IDLEPRIO processes wait on another shared runqueue, which
+// is only looked at when all the others are empty.
+struct skiplist idleprio_rq;
 
+static struct sched_policy bfs_policy, rr_policy;
 
+// Indexed by SCHEDPOL_*.
+static struct sched_policy *policies[] = {
+[SCHEDPOL_BFS]  &bfs_policy,
+[SCHEDPOL_RR]   &rr_policy,
+};
 
-struct node * insert_to_level(int pid, int virtual_deadline, struct node * prev_node, struct node * forward) {
-  struct node * new_node = (struct node *) kalloc();
-  new_node->pid = pid;
-  new_node->virtual_deadline = virtual_deadline;
+// The active policy.  Changed only by setpolicy(), holding ptable.lock.
+static struct sched_policy *policy = &bfs_policy;
+
+static struct proc *initproc;
 
-  struct node * next_node = prev_node->next;
+int nextpid = 1;
+extern void forkret(void);
+extern void trapret(void);
 
-  prev_node->next = new_node;
+static void wakeup1(void *chan);
 
-  new_node->prev = prev_node;
-  new_node->next = next_node;
-  new_node->forward = forward;
+// Wake a halted CPU to run work just queued on CPU target's
+// runqueue: target itself if it is idle, otherwise any idle
+// CPU, which will steal the work.  Must be called with
+// interrupts disabled, after the work is visible.
+static void
+kick_idle_cpu(int target)
+{
+  int i, self = cpuid();
 
-  if (next_node != NULL) {
-    next_node->prev = new_node;
+  if(cpus[target].idle){
+    if(target != self)
+      lapicsendipi(cpus[target].apicid, T_IRQ0 + IRQ_RESCHED);
+    return;
+  }
+  for(i = 0; i < ncpu; i++){
+    if(i != self && cpus[i].idle){
+      lapicsendipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+      return;
+    }
   }
+}
 
-  return new_node;
+// Queue p on runqueue rq.  Its key, p->virtual_deadline, must
+// already be set.
+static void
+rq_insert_on(struct skiplist *rq, struct proc *p)
+{
+  acquire(&rq->lock);
+  insert_node(rq, p);
+  release(&rq->lock);
 }
 
-unsigned int random(int max) {
-  seed ^= seed << 17;
-  seed ^= seed >> 7;
-  seed ^= seed << 5;
-  return seed % max;
+// Queue p on the runqueue of the CPU it last ran on, which is
+// the most likely to still have its working set cached.
+static void
+rq_insert(struct proc *p)
+{
+  rq_insert_on(cpus[p->cpu].runqueue, p);
 }
 
-int randomize_max_level(int skiplist_max_level) {
-  int insertion_max_level = 0;
-  while (insertion_max_level <= skiplist_max_level) {
-    int x = random(4);
-    if (x == 0) {
-      insertion_max_level++;
-    } else {
-      break;
-    }
+// Take p off its runqueue.  Returns 0 if it was not queued,
+// for instance because a CPU has just dequeued it to run.
+static int
+rq_remove(struct proc *p)
+{
+  struct skiplist *rq = p->runqueue;
+
+  if(rq == NULL)
+    return 0;
+  acquire(&rq->lock);
+  if(p->runqueue != rq){
+    release(&rq->lock);
+    return 0;
   }
-  return insertion_max_level;
+  delete_node(rq, p);
+  release(&rq->lock);
+  return 1;
 }
 
-void print_skiplist(struct skiplist * skiplist) {
-  int current_level = skiplist->levels - 1;
+// Queue p under the active policy and wake a CPU to run it.
+// Caller must hold ptable.lock, since p->state is RUNNABLE.
+static void
+enqueue_process(struct proc *p)
+{
+  policy->enqueue(p);
+  // Releasing the runqueue lock has ordered the insert
+  // before kick_idle_cpu() reads the idle flags.
+  kick_idle_cpu(p->cpu);
+}
 
-  while (current_level >= 0) {
-    struct node * current_node = skiplist->headers[current_level];
-    cprintf("level %d: ", current_level);
-    while (current_node != NULL) {
-      cprintf("%d(pid:%d) -> ", current_node->virtual_deadline, current_node->pid);
-      current_node = current_node->next;
-    }
-    cprintf("\n");
-    current_level--;
-  }
+// Dynamic ticks.  With TICKLESS defined, only CPU 0 keeps the
+// periodic timer interrupt, which advances ticks and wakes sleep()ers.
+// Every other CPU arms a one-shot timer for the whole quantum when it
+// dispatches a process and stops its timer when it goes idle, relying
+// on kick_idle_cpu()'s IPI to wake it for new work.
+#ifdef TICKLESS
+static void
+arm_timer(struct cpu *c, int n)
+{
+  if(c != &cpus[0])
+    lapiconeshot(n);
+}
+#else
+#define arm_timer(c, n) do { } while(0)
+#endif
+
+// p has just woken up.  If the policy names a CPU whose process
+// should give way to it, make that CPU reschedule now rather than
+// at the end of its quantum.
+// Caller must hold ptable.lock, so no CPU's c->proc can change
+// meanwhile.
+static void
+preempt_for(struct proc *p)
+{
+  struct cpu *c;
 
+  if(policy->preempt == 0 || (c = policy->preempt(p)) == NULL)
+    return;
+  c->resched = 1;
+  if(c != mycpu())
+    lapicsendipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
 }
 
-void insert_node(struct skiplist * skiplist, struct proc * p) {
+// Give up the CPU if preempt_for() asked this one to reschedule.
+// Called on the way out of trap().
+void
+checkresched(void)
+{
+  struct cpu *c;
+  int resched;
 
-  p->max_level = randomize_max_level(skiplist->levels - 1); // TO DO: randomize
+  pushcli();
+  c = mycpu();
+  resched = c->resched;
+  c->resched = 0;
+  popcli();
+  if(resched && myproc() && myproc()->state == RUNNING)
+    yield();
+}
 
-  struct node * prev_nodes[p->max_level + 1];
+// Add cycles to a time kept as whole ticks plus the cycles
+// towards the next one.  Subtracting a tick at a time avoids
+// 64-bit division, which the kernel does not have.
+static void
+addtime(uint *ticks, uint *rem, uint64 cycles)
+{
+  cycles += *rem;
+  while(cycles >= tsc_per_tick){
+    cycles -= tsc_per_tick;
+    (*ticks)++;
+  }
+  *rem = cycles;
+}
 
-  int current_level = skiplist->levels - 1;
+// Nothing to run: halt CPU c until an interrupt arrives, unless
+// a runqueue got work since we looked.  Setting c->idle before
+// the final check pairs with kick_idle_cpu() reading it after an
+// insert, so either we see the work or the enqueuer sees us idle
+// and sends an IPI.  The timer interrupt also ends the halt.
+// The time halted is measured with the TSC rather than by counting
+// timer interrupts, which a TICKLESS CPU does not take while idle.
+static void
+idle(struct cpu *c)
+{
+  uint64 start;
+  int i;
 
-  struct node * current_node = skiplist->headers[current_level];
+  cli();
+  xchg(&c->idle, 1);
+  for(i = 0; i < ncpu; i++)
+    if(cpus[i].runqueue->size > 0)
+      break;
+  if(i == ncpu && iso_rq.size == 0 && idleprio_rq.size == 0){
+    arm_timer(c, 0);
+    start = rdtsc();
+    stihlt();
+    addtime(&c->idle_ticks, &c->idle_cycles, rdtsc() - start);
+  }
+  c->idle = 0;
+}
 
-  // Find previous nodes to insert per level
-  while (current_level >= 0) {
-    // Find previous node in a level
-    while (current_node->next != NULL && p->virtual_deadline >= current_node->next->virtual_deadline) {
-      current_node = current_node->next;
-    }
+// Pick a CPU for a new process: the one with the shortest
+// runqueue, preferring the caller's own CPU on ties.
+// Queue sizes are read without their locks; this is only a hint.
+static int
+select_cpu(void)
+{
+  int i, best = cpuid();
 
-    // Store previous node if within max level
-    if (p->max_level >= current_level) {
-      prev_nodes[current_level] = current_node;
-    }
+  for(i = 0; i < ncpu; i++)
+    if(cpus[i].runqueue->size < cpus[best].runqueue->size)
+      best = i;
+  return best;
+}
 
-    // Set current node to next level
-    current_node = current_node->forward;
+// Dequeue the next process for CPU c to run, or return 0, from
+// the runqueue bfs_select_rq() chooses within slack.
+//
+// The queue is chosen from the unlocked size and min_deadline hints
+// and then only that queue's lock is taken, so CPUs do not serialize
+// on each other's runqueues.  Must not be called holding ptable.lock.
+static struct proc*
+rq_pop(struct cpu *c, int slack)
+{
+  struct skiplist *best;
+  struct proc *p;
 
-    current_level--;
-  }
+  best = bfs_select_rq(runqueues, ncpu, c - cpus, slack);
+  if(best == NULL)
+    return NULL;
 
-  // Insert new nodes given previous nodees per level
-  current_level = 0;
-  struct node * forward = NULL;
-  while (current_level <= p->max_level) {
+  acquire(&best->lock);
+  p = pop_min(best);
+  release(&best->lock);
+  return p;
+}
 
-    forward = insert_to_level(p->pid, p->virtual_deadline, prev_nodes[current_level], forward);
+// BFS: earliest virtual deadline first.  A CPU keeps to the tasks
+// on its own runqueue, which last ran there and may still have warm
+// caches and TLB, unless a remote deadline is earlier by more than
+// the affinity window.
+//
+// The quantum is a budget of TSC cycles, charged for the time
+// actually run, so a process is not billed for a tick it slept
+// through or let off for one it ran most of.  It expires at the
+// timer tick nearest to the budget running out.  What is left of
+// it, and the deadline, survive sleeping: a process that sleeps
+// often does not get a fresh quantum every time it wakes up.
+
+// Start with an empty quantum; the first dispatch fills it.
+static void
+bfs_fork(struct proc *p)
+{
+  p->slice = 0;
+  p->ticks_left = 0;
+  p->virtual_deadline = compute_virtual_deadline(p->nice_value);
+}
 
-    current_level++;
+// The class p is scheduled in.  A SCHED_IDLEPRIO process holding
+// a sleeplock runs as SCHED_NORMAL until it lets go of it, so that
+// normal processes waiting for the lock are not held up behind
+// every other runnable process.
+static int
+bfs_class(struct proc *p)
+{
+  if(p->sched_class == SCHED_IDLEPRIO && p->nsleeplocks > 0)
+    return SCHED_NORMAL;
+  return p->sched_class;
+}
+
+static void
+bfs_enqueue(struct proc *p)
+{
+  bfs_renew_deadline(p);
+  switch(bfs_class(p)){
+  case SCHED_ISO:
+    rq_insert_on(&iso_rq, p);
+    break;
+  case SCHED_IDLEPRIO:
+    rq_insert_on(&idleprio_rq, p);
+    break;
+  default:
+    rq_insert(p);
   }
-  cprintf("inserted|[%d]%d\n", p->pid, p->max_level);
 }
 
-void delete_from_levels(struct node * node) {
-  struct node * current_node = node;
+static int affinity_window = BFS_AFFINITY_WINDOW;   // in ticks
+
+// SCHED_ISO processes run before all others, in deadline order
+// among themselves, as long as together they have used no more
+// than iso_cpu percent of all CPUs over the last 2^BFS_ISO_SHIFT
+// ticks or so.  Past that they are throttled: they compete on
+// deadline like normal processes until their use has fallen back
+// below 90% of the cap.
+//
+// The use is a decaying sum kept by isotick() on CPU 0: every
+// tick it loses 1/2^BFS_ISO_SHIFT of itself and gains 128 for each
+// CPU running a SCHED_ISO process, so it settles at 128 << BFS_ISO_SHIFT
+// times the average number of such CPUs.
+static int iso_cpu = BFS_ISO_CPU;       // percent of all CPUs
+static uint iso_load;
+static volatile int iso_throttled;
+
+// Dequeue a SCHED_ISO process for CPU c, if one should run now.
+static struct proc*
+iso_pop(struct cpu *c)
+{
+  struct proc *p;
 
-  while (current_node != NULL) {
-    struct node * next_to_delete = current_node->forward;
-    struct node * next = current_node->next;
-    struct node * prev = current_node->prev;
+  if(iso_rq.size == 0)
+    return NULL;
+  if(iso_throttled && c->runqueue->size > 0 &&
+     c->runqueue->min_deadline <= iso_rq.min_deadline)
+    return NULL;
+  acquire(&iso_rq.lock);
+  p = pop_min(&iso_rq);
+  release(&iso_rq.lock);
+  return p;
+}
 
-    prev->next = next;
-    if (next != NULL) {
-      next->prev = prev;
-    }
+// Update the SCHED_ISO CPU use.  Called by CPU 0 on every tick.
+// Other CPUs' running processes are read without locks; a sample
+// that is a tick out of date makes no difference to the average.
+void
+isotick(void)
+{
+  struct proc *p;
+  uint full;
+  int i;
+
+  iso_load -= iso_load >> BFS_ISO_SHIFT;
+  for(i = 0; i < ncpu; i++)
+    if((p = cpus[i].proc) != NULL && p->sched_class == SCHED_ISO)
+      iso_load += 128;
 
-    kfree((char*)current_node);
+  full = (128 * ncpu) << BFS_ISO_SHIFT;
+  if(iso_load * 100 > iso_cpu * full)
+    iso_throttled = 1;
+  else if(iso_load * 1000 < iso_cpu * 9 * full)
+    iso_throttled = 0;
+}
 
-    current_node = next_to_delete;
+// Set the SCHED_ISO CPU cap to percent.
+// Returns the previous cap, or -1 if percent is not 0-100.
+int
+isocpu(int percent)
+{
+  int old = iso_cpu;
+
+  if(percent < 0 || percent > 100)
+    return -1;
+  iso_cpu = percent;
+  return old;
+}
+
+static struct proc*
+bfs_pick_next(struct cpu *c)
+{
+  struct proc *p;
+
+  if((p = iso_pop(c)) == NULL && (p = rq_pop(c, affinity_window)) == NULL &&
+     idleprio_rq.size > 0){
+    acquire(&idleprio_rq.lock);
+    p = pop_min(&idleprio_rq);
+    release(&idleprio_rq.lock);
   }
+
+  if(p != NULL)
+    bfs_refill(p, tsc_per_tick);
+  return p;
 }
 
-void delete_node(struct skiplist * skiplist, struct proc * p) {
+// A new nice value takes effect at once, with a new deadline.
+static void
+bfs_renice(struct proc *p)
+{
+  p->virtual_deadline = compute_virtual_deadline(p->nice_value);
+}
 
+// Should woken process p take the CPU from running?  Anything but
+// SCHED_IDLEPRIO takes it from SCHED_IDLEPRIO, and a SCHED_IDLEPRIO
+// process only preempts another one.  Under its cap SCHED_ISO goes
+// before normal processes, and never gives way to one, which would
+// only be switched straight back out for it.  Otherwise the earlier
+// deadline wins.
+static int
+bfs_preempts(struct proc *p, struct proc *running)
+{
+  int class = bfs_class(p), rclass = bfs_class(running);
+
+  if(rclass == SCHED_IDLEPRIO && class != SCHED_IDLEPRIO)
+    return 1;
+  if(!iso_throttled){
+    if(class == SCHED_ISO && rclass != SCHED_ISO)
+      return 1;
+    if(rclass == SCHED_ISO && class != SCHED_ISO)
+      return 0;
+  }
+  if(class == SCHED_IDLEPRIO && rclass != SCHED_IDLEPRIO)
+    return 0;
+  return p->virtual_deadline < running->virtual_deadline;
+}
 
-  // Start at header of top level
-  int current_level = skiplist->levels - 1;
-  struct node * current_node = skiplist->headers[skiplist->levels - 1];
+// The CPU woken process p should preempt, if any.  Normally that
+// is p's own CPU, the one that will pick p from its runqueue, or
+// failing that a CPU running SCHED_IDLEPRIO, which will steal p or
+// other normal work, or else the CPU running the latest deadline,
+// if p is early enough for that CPU to steal it, as rq_pop() would
+// once it looks.  But SCHED_ISO processes wait on the shared
+// iso_rq, so under its cap one takes any CPU not already running
+// SCHED_ISO, preferring one running SCHED_IDLEPRIO, then p's own.
+// Nothing is preempted while a CPU is idle or between processes:
+// it is about to pick p up anyway.
+static struct cpu*
+bfs_preempt(struct proc *p)
+{
+  struct cpu *c, *best;
+  struct proc *r;
+  uint64 latest;
+  int i;
 
-  while (current_level >= 0) {
-    while (current_node->virtual_deadline < p->virtual_deadline && current_node->pid != p->pid) { 
-      if (current_node->virtual_deadline > p->virtual_deadline  || current_node->next == NULL) {
-        break;
-      }
-      current_node = current_node->next;
+  if(bfs_class(p) == SCHED_ISO && !iso_throttled){
+    best = NULL;
+    for(i = 0; i < ncpu; i++){
+      c = &cpus[i];
+      if(c->idle || c->proc == NULL)
+        return NULL;
+      if(!bfs_preempts(p, c->proc))
+        continue;
+      if(bfs_class(c->proc) == SCHED_IDLEPRIO)
+        return c;
+      if(best == NULL || i == p->cpu)
+        best = c;
     }
+    return best;
+  }
 
-    if (current_node->pid == p->pid && current_node->virtual_deadline == p->virtual_deadline) {
-      // Case where node to delete is already found
-      break;
-    } else {
-      while (current_node->virtual_deadline >= p->virtual_deadline) {
-        current_node = current_node->prev;
-      }
-      current_node = current_node->forward;
-      current_level--;
+  c = &cpus[p->cpu];
+  if(c->idle || c->proc == NULL)
+    return NULL;
+  if(bfs_preempts(p, c->proc))
+    return c;
+  if(bfs_class(p) == SCHED_IDLEPRIO)
+    return NULL;
+  best = NULL;
+  for(i = 0; i < ncpu; i++){
+    c = &cpus[i];
+    if(c->idle || (r = c->proc) == NULL || !bfs_preempts(p, r))
+      continue;
+    if(bfs_class(r) == SCHED_IDLEPRIO)
+      return c;
+    if(best == NULL || r->virtual_deadline > latest){
+      best = c;
+      latest = r->virtual_deadline;
     }
   }
-  if (current_level >= 0) {
-    delete_from_levels(current_node);
-    cprintf("removed|[%d]%d\n", p->pid, current_level);
-  }
-  p->max_level = -1;
+  if(best != NULL && bfs_steals(p->virtual_deadline, latest, affinity_window))
+    return best;
+  return NULL;
 }
 
-int get_minimum(struct skiplist * skiplist) {
-  if (skiplist->headers[0]->next != NULL) {
-    return skiplist->headers[0]->next->pid;
-  }
-  return -69;
+// Is there SCHED_ISO or normal work waiting for a CPU?
+static int
+bfs_work_queued(void)
+{
+  int i;
 
+  if(iso_rq.size > 0)
+    return 1;
+  for(i = 0; i < ncpu; i++)
+    if(cpus[i].runqueue->size > 0)
+      return 1;
+  return 0;
 }
 
+static int
+bfs_tick(struct proc *p, uint64 cycles)
+{
+  if(cycles + tsc_per_tick/2 >= p->slice){
+    p->slice = 0;
+    p->ticks_left = 0;
+    return 1;
+  }
+  p->slice -= cycles;
+  // ticks_left is the slice rounded to whole ticks.  Recount it
+  // from its old value, as addtime() does, rather than divide; it
+  // moves by about one tick per call.
+  while(p->ticks_left > 0 &&
+        (uint64)p->ticks_left * tsc_per_tick > p->slice + tsc_per_tick/2)
+    p->ticks_left--;
+  while((uint64)(p->ticks_left + 1) * tsc_per_tick <= p->slice + tsc_per_tick/2)
+    p->ticks_left++;
+  // SCHED_IDLEPRIO keeps the rest of its quantum, but only gets
+  // to use it while nothing else wants the CPU.
+  if(bfs_class(p) == SCHED_IDLEPRIO && bfs_work_queued())
+    return 1;
+  return 0;
+}
 
-// Skiplist End
+static struct sched_policy bfs_policy = {
+  .name = "bfs",
+  .fork = bfs_fork,
+  .enqueue = bfs_enqueue,
+  .dequeue = rq_remove,
+  .pick_next = bfs_pick_next,
+  .tick = bfs_tick,
+  .preempt = bfs_preempt,
+  .renice = bfs_renice,
+};
 
+// Round robin, as in stock xv6: every process runs for one tick in
+// turn, ignoring nice values.  The runqueue key is the order of
+// enqueueing, and CPUs steal any earlier remote head, so the
+// runqueues together form a single FIFO.
 
-struct {
-  struct spinlock lock;
-  struct proc proc[NPROC];
-} ptable;
+static uint64 rr_clock;   // protected by ptable.lock
 
-struct skiplist * skiplist;
+static void
+rr_fork(struct proc *p)
+{
+}
 
-static struct proc *initproc;
+static void
+rr_enqueue(struct proc *p)
+{
+  p->virtual_deadline = rr_clock++;
+  rq_insert(p);
+}
 
-int nextpid = 1;
-extern void forkret(void);
-extern void trapret(void);
+static struct proc*
+rr_pick_next(struct cpu *c)
+{
+  struct proc *p = rq_pop(c, 0);
 
-static void wakeup1(void *chan);
+  if(p != NULL)
+    p->ticks_left = 1;
+  return p;
+}
 
+static int
+rr_tick(struct proc *p, uint64 cycles)
+{
+  p->ticks_left = 0;
+  return 1;
+}
 
+static struct sched_policy rr_policy = {
+  .name = "rr",
+  .fork = rr_fork,
+  .enqueue = rr_enqueue,
+  .dequeue = rq_remove,
+  .pick_next = rr_pick_next,
+  .tick = rr_tick,
+};
+
+// Add the TSC cycles p has run since it was last charged to
+// p->runtime, and return them.
+static uint64
+charge(struct proc *p)
+{
+  uint64 now = rdtsc();
+  uint64 cycles = now - p->stamp;
+
+  p->runtime += cycles;
+  p->stamp = now;
+  if(p->sched_class == SCHED_ISO)
+    addtime(&mycpu()->iso_ticks, &mycpu()->iso_cycles, cycles);
+  return cycles;
+}
+
+// Timer interrupt on the CPU running p.  Returns 1 if p should
+// give up the CPU.
+int
+schedtick(struct proc *p)
+{
+  if(policy->tick(p, charge(p)))
+    return 1;
+#ifdef TICKLESS
+  // The one-shot timer armed at dispatch has run out early,
+  // measured in cycles: wait for the rest of the quantum.
+  arm_timer(mycpu(), p->ticks_left > 0 ? p->ticks_left : 1);
+#endif
+  return 0;
+}
+
+// Set the BFS affinity window to window ticks.
+// Returns the previous window, or -1 if window is negative.
+int
+affinity(int window)
+{
+  int old = affinity_window;
 
-int compute_virtual_deadline(int nice_value) {
-  int priority_ratio = nice_value - BFS_NICE_FIRST_LEVEL + 1;
-  return ticks + (BFS_DEFAULT_QUANTUM * priority_ratio);
+  if(window < 0)
+    return -1;
+  affinity_window = window;
+  return old;
 }
 
-int schedlog_active = 0;
-int schedlog_lasttick = 0;
+// Make policy n (SCHEDPOL_*) the active one, re-keying every
+// process and moving the queued ones to its order.  Meant for
+// switching policies between benchmark runs on an otherwise
+// quiescent system.  Returns the previous policy, or -1 if n is
+// not a policy.
+int
+setpolicy(int n)
+{
+  struct sched_policy *oldpolicy;
+  struct proc *p;
+  int old, queued;
 
-void schedlog(int n) {
-  schedlog_active = 1;
-  schedlog_lasttick = ticks + n;
+  if(n < 0 || n >= NELEM(policies))
+    return -1;
+
+  acquire(&ptable.lock);
+  for(old = 0; policies[old] != policy; old++)
+    ;
+  if(n != old){
+    oldpolicy = policy;
+    policy = policies[n];
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      if(p->state == UNUSED)
+        continue;
+      queued = p->state == RUNNABLE && oldpolicy->dequeue(p);
+      policy->fork(p);
+      if(queued)
+        enqueue_process(p);
+    }
+  }
+  release(&ptable.lock);
+  return old;
 }
 
 
@@ -234,8 +656,15 @@ pinit(void)
 {
   initlock(&ptable.lock, "ptable");
 
-  // Initialize Skip List
-  skiplist = init_skiplist();
+  // Initialize the per-CPU skip lists
+  for(int i = 0; i < NCPU; i++){
+    init_skiplist(&runqueues[i]);
+    cpus[i].runqueue = &runqueues[i];
+  }
+  init_skiplist(&iso_rq);
+  init_skiplist(&idleprio_rq);
+
+  schedloginit();
 }
 
 // Must be called with interrupts disabled
@@ -299,6 +728,12 @@ allocproc(void)
 
 found:
   p->state = EMBRYO;
+  p->runtime = 0;
+  p->wait_time = 0;
+  p->max_wait = 0;
+  p->dispatches = 0;
+  p->nvcsw = 0;
+  p->nivcsw = 0;
   p->pid = nextpid++;
 
 
@@ -364,13 +799,15 @@ userinit(void)
   acquire(&ptable.lock);
 
   p->state = RUNNABLE;
+  p->stamp = rdtsc();
 
-  release(&ptable.lock);
-
-  // Skip List
   p->nice_value = 0;
-  p->virtual_deadline = compute_virtual_deadline(0);
-  insert_node(skiplist, p);
+  p->sched_class = SCHED_NORMAL;
+  p->cpu = cpuid();
+  policy->fork(p);
+  enqueue_process(p);
+
+  release(&ptable.lock);
 }
 
 // Grow current process's memory by n bytes.
@@ -397,8 +834,8 @@ growproc(int n)
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
-
-
+// Returns -1 if nice_value is out of range or no process
+// could be created.
 int
 nicefork(int nice_value)
 {
@@ -406,6 +843,9 @@ nicefork(int nice_value)
   struct proc *np;
   struct proc *curproc = myproc();
 
+  if(nice_value < BFS_NICE_FIRST_LEVEL || nice_value > BFS_NICE_LAST_LEVEL)
+    return -1;
+
   // Allocate process.
   if((np = allocproc()) == 0){
     return -1;
@@ -438,13 +878,17 @@ nicefork(int nice_value)
   acquire(&ptable.lock);
 
   np->state = RUNNABLE;
+  np->stamp = rdtsc();
 
-  release(&ptable.lock);
-
-  // Skip List
   np->nice_value = nice_value;
-  np->virtual_deadline = compute_virtual_deadline(nice_value);
-  insert_node(skiplist, np);
+  np->sched_class = curproc->sched_class;
+  np->cpu = select_cpu();
+  policy->fork(np);
+  enqueue_process(np);
+  schedlog_event(SCHEDLOG_FORK, np);
+  preempt_for(np);
+
+  release(&ptable.lock);
 
   return pid;
 }
@@ -556,6 +1000,7 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  uint64 now, wait;
   c->proc = 0;
 
 
@@ -563,69 +1008,68 @@ scheduler(void)
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-
-    int next_process_pid = get_minimum(skiplist);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if (p->pid != next_process_pid) {
-        continue;
-      }
-
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-      p->ticks_left = BFS_DEFAULT_QUANTUM;
-      delete_node(skiplist, p);
-
-      // Schedlog
-      if (schedlog_active) {
-        if (ticks > schedlog_lasttick) {
-          schedlog_active = 0;
-        } else {
-          cprintf("%d|", ticks);
-          struct proc *pp;
-          int highest_idx = -1;
-          for (int k = 0; k < NPROC; k++) {
-            pp = &ptable.proc[k];
-            if (pp->state != UNUSED) {
-              highest_idx = k;
-            }
-          }
-          for (int k = 0; k <= highest_idx; k++) {
-            pp = &ptable.proc[k];
-            if (pp->state == UNUSED) cprintf("[-]---:0:-(-)(-)(-)");
-            else cprintf("[%d]%s:%d:%d(%d)(%d)(%d)", pp->pid, pp->name, pp->state, pp->nice_value, pp->max_level, pp->virtual_deadline, pp->ticks_left);
-            if (k <= highest_idx - 1) {
-              cprintf(",");
-            }
-          }
-          cprintf("\n");
-        }
-      }
+    // Take the next process off the runqueues, as the policy
+    // orders them.  Only runqueue locks are needed for this; once
+    // dequeued, p cannot be picked by another CPU and stays
+    // RUNNABLE until we mark it RUNNING under ptable.lock.
+    p = policy->pick_next(c);
+    if(p == NULL){
+      idle(c);
+      continue;
+    }
 
-      //cprintf("Context switching from scheduler to %s [scheduler]\n", p->name);
-      swtch(&(c->scheduler), p->context);
-      //cprintf("Context switch to scheduler complete [scheduler]\n");
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      
-      if (p->state == RUNNABLE) {
-        if (p->ticks_left == 0) {
-          p->virtual_deadline = compute_virtual_deadline(p->nice_value);
-        }
-        insert_node(skiplist, p);
-      } 
+    acquire(&ptable.lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler: queued proc not runnable");
+
+    // Switch to chosen process.  It is the process's job
+    // to release ptable.lock and then reacquire it
+    // before jumping back to us.
+    c->proc = p;
+    switchuvm(p);
+    p->state = RUNNING;
+    if(p->cpu != c - cpus)
+      c->migrations++;
+    p->cpu = c - cpus;
+    c->dispatches++;
+    c->resched = 0;
+    arm_timer(c, p->ticks_left);
+    // p->stamp may come from another CPU's TSC, which can be
+    // a little ahead of ours.
+    now = rdtsc();
+    wait = now > p->stamp ? now - p->stamp : 0;
+    p->wait_time += wait;
+    if(wait > p->max_wait)
+      p->max_wait = wait;
+    p->dispatches++;
+    p->stamp = now;
+
+    schedlog_event(SCHEDLOG_RUN, p);
+
+    //cprintf("Context switching from scheduler to %s [scheduler]\n", p->name);
+    swtch(&(c->scheduler), p->context);
+    //cprintf("Context switch to scheduler complete [scheduler]\n");
+    switchkvm();
+    // Charging also sets p->stamp to when a runnable p is
+    // switched out, which starts its wait.
+    policy->tick(p, charge(p));
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    
+    if (p->state == RUNNABLE) {
+      p->nivcsw++;
+      enqueue_process(p);
+      schedlog_event(SCHEDLOG_PREEMPT, p);
+    } else if (p->state == SLEEPING) {
+      p->nvcsw++;
+      schedlog_event(SCHEDLOG_SLEEP, p);
+    } else if (p->state == ZOMBIE) {
+      schedlog_event(SCHEDLOG_EXIT, p);
+    }
 
 
-      c->proc = 0;
-    }
+    c->proc = 0;
     release(&ptable.lock);
 
   }
@@ -690,6 +1134,18 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// The wait queue for sleepers on chan.  Channels are addresses
+// of kernel objects, so the low bits carry little information.
+static struct proc**
+waitq(void *chan)
+{
+  uint h = (uint)chan;
+
+  h ^= h >> 6;
+  h ^= h >> 12;
+  return &ptable.waitq[h & (NWAITQ - 1)];
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
@@ -716,6 +1172,11 @@ sleep(void *chan, struct spinlock *lk)
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  p->waitprev = waitq(chan);
+  p->waitnext = *p->waitprev;
+  if(p->waitnext)
+    p->waitnext->waitprev = &p->waitnext;
+  *p->waitprev = p;
 
   sched();
 
@@ -729,19 +1190,36 @@ sleep(void *chan, struct spinlock *lk)
   }
 }
 
+// Make sleeping process p runnable, preempting a running
+// process for it if the policy says so.
+// The ptable lock must be held.
+static void
+wakeup_process(struct proc *p)
+{
+  *p->waitprev = p->waitnext;
+  if(p->waitnext)
+    p->waitnext->waitprev = p->waitprev;
+  p->waitnext = 0;
+  p->waitprev = 0;
+  p->state = RUNNABLE;
+  p->stamp = rdtsc();
+  enqueue_process(p);
+  schedlog_event(SCHEDLOG_WAKEUP, p);
+  preempt_for(p);
+}
+
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
 // The ptable lock must be held.
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
+  struct proc *p, *next;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    if(p->state == SLEEPING && p->chan == chan) {
-      p->state = RUNNABLE;
-      insert_node(skiplist, p);
-    }
+  for(p = *waitq(chan); p; p = next){
+    next = p->waitnext;
+    if(p->chan == chan)
+      wakeup_process(p);
   }
 }
 
@@ -767,11 +1245,118 @@ kill(int pid)
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
-      if(p->state == SLEEPING) {
-        p->state = RUNNABLE;
-        insert_node(skiplist, p);
+      if(p->state == SLEEPING)
+        wakeup_process(p);
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Set the nice value of process pid.  If it is queued, it is
+// moved to its new place in the runqueue straight away, and may
+// preempt the process running on its CPU.
+// Returns -1 if there is no such process or value is out of range.
+int
+setnice(int pid, int value)
+{
+  struct proc *p;
+  int queued;
+
+  if(value < BFS_NICE_FIRST_LEVEL || value > BFS_NICE_LAST_LEVEL)
+    return -1;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      p->nice_value = value;
+      if(policy->renice){
+        queued = p->state == RUNNABLE && policy->dequeue(p);
+        policy->renice(p);
+        if(queued){
+          enqueue_process(p);
+          preempt_for(p);
+        }
+      }
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Move process pid to scheduling class class (SCHED_*).  If it
+// is queued, it moves to the class's runqueue straight away.
+// Returns its previous class, or -1 if there is no such process
+// or class.
+int
+setclass(int pid, int class)
+{
+  struct proc *p;
+  int old, queued;
+
+  if(class != SCHED_NORMAL && class != SCHED_ISO && class != SCHED_IDLEPRIO)
+    return -1;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      old = p->sched_class;
+      queued = p->state == RUNNABLE && policy->dequeue(p);
+      p->sched_class = class;
+      if(queued){
+        enqueue_process(p);
+        preempt_for(p);
       }
       release(&ptable.lock);
+      return old;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Return the nice value of process pid, or NICE_NOPROC if there
+// is no such process.
+int
+getnice(int pid)
+{
+  struct proc *p;
+  int nice;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      nice = p->nice_value;
+      release(&ptable.lock);
+      return nice;
+    }
+  }
+  release(&ptable.lock);
+  return NICE_NOPROC;
+}
+
+// Copy the scheduling statistics of process pid into st.
+// Returns -1 if there is no such process.
+int
+getschedstats(int pid, struct schedstat *st)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      st->runtime = p->runtime;
+      st->wait_time = p->wait_time;
+      st->max_wait = p->max_wait;
+      st->dispatches = p->dispatches;
+      st->nvcsw = p->nvcsw;
+      st->nivcsw = p->nivcsw;
+      st->tsc_per_tick = tsc_per_tick;
+      release(&ptable.lock);
       return 0;
     }
   }
@@ -779,6 +1364,21 @@ kill(int pid)
   return -1;
 }
 
+// Copy CPU n's scheduler statistics into st.
+// Returns -1 if there is no such CPU.
+int
+getcpustat(int n, struct cpustat *st)
+{
+  if(n < 0 || n >= ncpu)
+    return -1;
+  st->ticks = cpus[n].ticks;
+  st->idle_ticks = cpus[n].idle_ticks;
+  st->dispatches = cpus[n].dispatches;
+  st->migrations = cpus[n].migrations;
+  st->iso_ticks = cpus[n].iso_ticks;
+  return 0;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
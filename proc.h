@@ -8,6 +8,16 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  struct skiplist *runqueue;   // This CPU's BFS runqueue
+  volatile uint idle;          // Halted waiting for runqueue work?
+  volatile int resched;        // Should its process give up the CPU?
+  uint ticks;                  // Timer interrupts taken
+  uint idle_ticks;             // Time halted in idle(), in ticks
+  uint idle_cycles;            // ...plus TSC cycles toward the next
+  uint dispatches;             // Processes dispatched
+  uint migrations;             // ...that last ran on another CPU
+  uint iso_ticks;              // Time running SCHED_ISO, in ticks
+  uint iso_cycles;             // ...plus TSC cycles toward the next
 };
 
 extern struct cpu cpus[NCPU];
@@ -32,6 +42,17 @@ struct context {
   uint eip;
 };
 
+// One level of a process's link in the BFS skip list.
+// Every process carries SKIPLIST_LEVELS of these, so
+// queueing a process never allocates memory.
+struct node {
+  struct proc * proc;          // Owning process, NULL in headers
+  uint64 virtual_deadline;
+  struct node * prev;
+  struct node * next;
+  struct node * forward;       // Same process, one level down
+};
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
@@ -45,14 +66,46 @@ struct proc {
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *waitnext;       // Next sleeper in chan's wait queue
+  struct proc **waitprev;      // Link pointing at this one, or 0
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
-  int ticks_left;
+  int ticks_left;              // Whole ticks left in the current quantum
+  uint64 slice;                // TSC cycles left in the current quantum (BFS)
+  uint64 runtime;              // TSC cycles spent running
+  uint64 stamp;                // TSC when runtime was last charged, or
+                               // while RUNNABLE, when it became so
+  uint64 wait_time;            // TSC cycles spent RUNNABLE
+  uint64 max_wait;             // ...at most in one go
+  uint dispatches;             // Times dispatched
+  uint nvcsw;                  // Switched out SLEEPING
+  uint nivcsw;                 // Switched out RUNNABLE
   int nice_value;
-  int virtual_deadline;
+  int sched_class;             // SCHED_* (see sched.h)
+  int nsleeplocks;             // Sleeplocks held
+  uint64 virtual_deadline;
   int max_level;
+  struct node nodes[SKIPLIST_LEVELS]; // Skip list links, one per level
+  struct skiplist *runqueue;   // Skip list this process is queued on, or 0
+  int cpu;                     // Index in cpus[] of the CPU it last ran on
+};
+
+// A scheduling policy.  The active one (see setpolicy() in proc.c)
+// decides how processes are ordered on the per-CPU runqueues, which
+// one a CPU runs next, and for how long.  All hooks but pick_next
+// and tick are called holding ptable.lock.
+struct sched_policy {
+  char *name;
+  void (*fork)(struct proc*);          // Set up a new or re-homed process
+  void (*enqueue)(struct proc*);       // Queue a RUNNABLE process
+  int (*dequeue)(struct proc*);        // Unqueue it; 0 if it was not queued
+  struct proc *(*pick_next)(struct cpu*); // Dequeue the next to run, or 0
+  int (*tick)(struct proc*, uint64);   // Charge CPU cycles; 1 to preempt
+  struct cpu *(*preempt)(struct proc*); // CPU a waking process should
+                                       // preempt, or 0 (may be 0)
+  void (*renice)(struct proc*);        // Nice value changed (may be 0)
 };
 
 // Process memory is laid out contiguously, low addresses first:
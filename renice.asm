@@ -0,0 +1,927 @@
+
+_renice:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <atoisigned>:
+#include "sched.h"
+
+// atoi() with an optional minus sign.
+static int
+atoisigned(char *s)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  if(*s == '-')
+   6:	80 38 2d             	cmpb   $0x2d,(%eax)
+   9:	74 0e                	je     19 <atoisigned+0x19>
+    return -atoi(s + 1);
+  return atoi(s);
+   b:	83 ec 0c             	sub    $0xc,%esp
+   e:	50                   	push   %eax
+   f:	e8 0b 02 00 00       	call   21f <atoi>
+  14:	83 c4 10             	add    $0x10,%esp
+}
+  17:	c9                   	leave
+  18:	c3                   	ret
+    return -atoi(s + 1);
+  19:	83 c0 01             	add    $0x1,%eax
+  1c:	83 ec 0c             	sub    $0xc,%esp
+  1f:	50                   	push   %eax
+  20:	e8 fa 01 00 00       	call   21f <atoi>
+  25:	f7 d8                	neg    %eax
+  27:	83 c4 10             	add    $0x10,%esp
+  2a:	eb eb                	jmp    17 <atoisigned+0x17>
+
+0000002c <main>:
+
+int
+main(int argc, char *argv[])
+{
+  2c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  30:	83 e4 f0             	and    $0xfffffff0,%esp
+  33:	ff 71 fc             	push   -0x4(%ecx)
+  36:	55                   	push   %ebp
+  37:	89 e5                	mov    %esp,%ebp
+  39:	57                   	push   %edi
+  3a:	56                   	push   %esi
+  3b:	53                   	push   %ebx
+  3c:	51                   	push   %ecx
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	8b 19                	mov    (%ecx),%ebx
+  42:	8b 71 04             	mov    0x4(%ecx),%esi
+  int pid, nice;
+
+  if(argc != 2 && argc != 3){
+  45:	8d 43 fe             	lea    -0x2(%ebx),%eax
+  48:	83 f8 01             	cmp    $0x1,%eax
+  4b:	76 14                	jbe    61 <main+0x35>
+    printf(2, "usage: renice pid [value]\n");
+  4d:	83 ec 08             	sub    $0x8,%esp
+  50:	68 a0 05 00 00       	push   $0x5a0
+  55:	6a 02                	push   $0x2
+  57:	e8 dc 03 00 00       	call   438 <printf>
+    exit();
+  5c:	e8 22 02 00 00       	call   283 <exit>
+  }
+  pid = atoi(argv[1]);
+  61:	83 ec 0c             	sub    $0xc,%esp
+  64:	ff 76 04             	push   0x4(%esi)
+  67:	e8 b3 01 00 00       	call   21f <atoi>
+  6c:	89 c7                	mov    %eax,%edi
+  if(argc == 2){
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	83 fb 02             	cmp    $0x2,%ebx
+  74:	74 1e                	je     94 <main+0x68>
+    if((nice = getnice(pid)) == NICE_NOPROC)
+      printf(2, "renice: no process %d\n", pid);
+    else
+      printf(1, "%d\n", nice);
+  } else if(setnice(pid, atoisigned(argv[2])) < 0)
+  76:	8b 46 08             	mov    0x8(%esi),%eax
+  79:	e8 82 ff ff ff       	call   0 <atoisigned>
+  7e:	83 ec 08             	sub    $0x8,%esp
+  81:	50                   	push   %eax
+  82:	57                   	push   %edi
+  83:	e8 e3 02 00 00       	call   36b <setnice>
+  88:	83 c4 10             	add    $0x10,%esp
+  8b:	85 c0                	test   %eax,%eax
+  8d:	78 40                	js     cf <main+0xa3>
+    printf(2, "renice: cannot set nice value of %d to %s\n", pid, argv[2]);
+  exit();
+  8f:	e8 ef 01 00 00       	call   283 <exit>
+    if((nice = getnice(pid)) == NICE_NOPROC)
+  94:	83 ec 0c             	sub    $0xc,%esp
+  97:	50                   	push   %eax
+  98:	e8 d6 02 00 00       	call   373 <getnice>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	83 f8 64             	cmp    $0x64,%eax
+  a3:	74 15                	je     ba <main+0x8e>
+      printf(1, "%d\n", nice);
+  a5:	83 ec 04             	sub    $0x4,%esp
+  a8:	50                   	push   %eax
+  a9:	68 ce 05 00 00       	push   $0x5ce
+  ae:	6a 01                	push   $0x1
+  b0:	e8 83 03 00 00       	call   438 <printf>
+  b5:	83 c4 10             	add    $0x10,%esp
+  b8:	eb d5                	jmp    8f <main+0x63>
+      printf(2, "renice: no process %d\n", pid);
+  ba:	83 ec 04             	sub    $0x4,%esp
+  bd:	57                   	push   %edi
+  be:	68 bb 05 00 00       	push   $0x5bb
+  c3:	6a 02                	push   $0x2
+  c5:	e8 6e 03 00 00       	call   438 <printf>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	eb c0                	jmp    8f <main+0x63>
+    printf(2, "renice: cannot set nice value of %d to %s\n", pid, argv[2]);
+  cf:	ff 76 08             	push   0x8(%esi)
+  d2:	57                   	push   %edi
+  d3:	68 d4 05 00 00       	push   $0x5d4
+  d8:	6a 02                	push   $0x2
+  da:	e8 59 03 00 00       	call   438 <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	eb ab                	jmp    8f <main+0x63>
+
+000000e4 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  e4:	55                   	push   %ebp
+  e5:	89 e5                	mov    %esp,%ebp
+  e7:	56                   	push   %esi
+  e8:	53                   	push   %ebx
+  e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  ef:	89 f0                	mov    %esi,%eax
+  f1:	89 d1                	mov    %edx,%ecx
+  f3:	83 c2 01             	add    $0x1,%edx
+  f6:	89 c3                	mov    %eax,%ebx
+  f8:	83 c0 01             	add    $0x1,%eax
+  fb:	0f b6 09             	movzbl (%ecx),%ecx
+  fe:	88 0b                	mov    %cl,(%ebx)
+ 100:	84 c9                	test   %cl,%cl
+ 102:	75 ed                	jne    f1 <strcpy+0xd>
+    ;
+  return os;
+}
+ 104:	89 f0                	mov    %esi,%eax
+ 106:	5b                   	pop    %ebx
+ 107:	5e                   	pop    %esi
+ 108:	5d                   	pop    %ebp
+ 109:	c3                   	ret
+
+0000010a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 10a:	55                   	push   %ebp
+ 10b:	89 e5                	mov    %esp,%ebp
+ 10d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 110:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 113:	eb 06                	jmp    11b <strcmp+0x11>
+    p++, q++;
+ 115:	83 c1 01             	add    $0x1,%ecx
+ 118:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 11b:	0f b6 01             	movzbl (%ecx),%eax
+ 11e:	84 c0                	test   %al,%al
+ 120:	74 04                	je     126 <strcmp+0x1c>
+ 122:	3a 02                	cmp    (%edx),%al
+ 124:	74 ef                	je     115 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 126:	0f b6 c0             	movzbl %al,%eax
+ 129:	0f b6 12             	movzbl (%edx),%edx
+ 12c:	29 d0                	sub    %edx,%eax
+}
+ 12e:	5d                   	pop    %ebp
+ 12f:	c3                   	ret
+
+00000130 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 136:	b8 00 00 00 00       	mov    $0x0,%eax
+ 13b:	eb 03                	jmp    140 <strlen+0x10>
+ 13d:	83 c0 01             	add    $0x1,%eax
+ 140:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 144:	75 f7                	jne    13d <strlen+0xd>
+    ;
+  return n;
+}
+ 146:	5d                   	pop    %ebp
+ 147:	c3                   	ret
+
+00000148 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	57                   	push   %edi
+ 14c:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 14f:	89 d7                	mov    %edx,%edi
+ 151:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 154:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 157:	fc                   	cld
+ 158:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 15a:	89 d0                	mov    %edx,%eax
+ 15c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 15f:	c9                   	leave
+ 160:	c3                   	ret
+
+00000161 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 161:	55                   	push   %ebp
+ 162:	89 e5                	mov    %esp,%ebp
+ 164:	8b 45 08             	mov    0x8(%ebp),%eax
+ 167:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16b:	eb 03                	jmp    170 <strchr+0xf>
+ 16d:	83 c0 01             	add    $0x1,%eax
+ 170:	0f b6 10             	movzbl (%eax),%edx
+ 173:	84 d2                	test   %dl,%dl
+ 175:	74 06                	je     17d <strchr+0x1c>
+    if(*s == c)
+ 177:	38 ca                	cmp    %cl,%dl
+ 179:	75 f2                	jne    16d <strchr+0xc>
+ 17b:	eb 05                	jmp    182 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 17d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+
+00000184 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 184:	55                   	push   %ebp
+ 185:	89 e5                	mov    %esp,%ebp
+ 187:	57                   	push   %edi
+ 188:	56                   	push   %esi
+ 189:	53                   	push   %ebx
+ 18a:	83 ec 1c             	sub    $0x1c,%esp
+ 18d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 190:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 195:	89 de                	mov    %ebx,%esi
+ 197:	83 c3 01             	add    $0x1,%ebx
+ 19a:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 19d:	7d 2e                	jge    1cd <gets+0x49>
+    cc = read(0, &c, 1);
+ 19f:	83 ec 04             	sub    $0x4,%esp
+ 1a2:	6a 01                	push   $0x1
+ 1a4:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1a7:	50                   	push   %eax
+ 1a8:	6a 00                	push   $0x0
+ 1aa:	e8 ec 00 00 00       	call   29b <read>
+    if(cc < 1)
+ 1af:	83 c4 10             	add    $0x10,%esp
+ 1b2:	85 c0                	test   %eax,%eax
+ 1b4:	7e 17                	jle    1cd <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1b6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1ba:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1bd:	3c 0a                	cmp    $0xa,%al
+ 1bf:	0f 94 c2             	sete   %dl
+ 1c2:	3c 0d                	cmp    $0xd,%al
+ 1c4:	0f 94 c0             	sete   %al
+ 1c7:	08 c2                	or     %al,%dl
+ 1c9:	74 ca                	je     195 <gets+0x11>
+    buf[i++] = c;
+ 1cb:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1cd:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1d1:	89 f8                	mov    %edi,%eax
+ 1d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1d6:	5b                   	pop    %ebx
+ 1d7:	5e                   	pop    %esi
+ 1d8:	5f                   	pop    %edi
+ 1d9:	5d                   	pop    %ebp
+ 1da:	c3                   	ret
+
+000001db <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1db:	55                   	push   %ebp
+ 1dc:	89 e5                	mov    %esp,%ebp
+ 1de:	56                   	push   %esi
+ 1df:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e0:	83 ec 08             	sub    $0x8,%esp
+ 1e3:	6a 00                	push   $0x0
+ 1e5:	ff 75 08             	push   0x8(%ebp)
+ 1e8:	e8 d6 00 00 00       	call   2c3 <open>
+  if(fd < 0)
+ 1ed:	83 c4 10             	add    $0x10,%esp
+ 1f0:	85 c0                	test   %eax,%eax
+ 1f2:	78 24                	js     218 <stat+0x3d>
+ 1f4:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1f6:	83 ec 08             	sub    $0x8,%esp
+ 1f9:	ff 75 0c             	push   0xc(%ebp)
+ 1fc:	50                   	push   %eax
+ 1fd:	e8 d9 00 00 00       	call   2db <fstat>
+ 202:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 204:	89 1c 24             	mov    %ebx,(%esp)
+ 207:	e8 9f 00 00 00       	call   2ab <close>
+  return r;
+ 20c:	83 c4 10             	add    $0x10,%esp
+}
+ 20f:	89 f0                	mov    %esi,%eax
+ 211:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 214:	5b                   	pop    %ebx
+ 215:	5e                   	pop    %esi
+ 216:	5d                   	pop    %ebp
+ 217:	c3                   	ret
+    return -1;
+ 218:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 21d:	eb f0                	jmp    20f <stat+0x34>
+
+0000021f <atoi>:
+
+int
+atoi(const char *s)
+{
+ 21f:	55                   	push   %ebp
+ 220:	89 e5                	mov    %esp,%ebp
+ 222:	53                   	push   %ebx
+ 223:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 226:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 22b:	eb 10                	jmp    23d <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 22d:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 230:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 233:	83 c1 01             	add    $0x1,%ecx
+ 236:	0f be c0             	movsbl %al,%eax
+ 239:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 23d:	0f b6 01             	movzbl (%ecx),%eax
+ 240:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 243:	80 fb 09             	cmp    $0x9,%bl
+ 246:	76 e5                	jbe    22d <atoi+0xe>
+  return n;
+}
+ 248:	89 d0                	mov    %edx,%eax
+ 24a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24d:	c9                   	leave
+ 24e:	c3                   	ret
+
+0000024f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 24f:	55                   	push   %ebp
+ 250:	89 e5                	mov    %esp,%ebp
+ 252:	56                   	push   %esi
+ 253:	53                   	push   %ebx
+ 254:	8b 75 08             	mov    0x8(%ebp),%esi
+ 257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 25a:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 25d:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 25f:	eb 0d                	jmp    26e <memmove+0x1f>
+    *dst++ = *src++;
+ 261:	0f b6 01             	movzbl (%ecx),%eax
+ 264:	88 02                	mov    %al,(%edx)
+ 266:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 269:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 26c:	89 d8                	mov    %ebx,%eax
+ 26e:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 271:	85 c0                	test   %eax,%eax
+ 273:	7f ec                	jg     261 <memmove+0x12>
+  return vdst;
+}
+ 275:	89 f0                	mov    %esi,%eax
+ 277:	5b                   	pop    %ebx
+ 278:	5e                   	pop    %esi
+ 279:	5d                   	pop    %ebp
+ 27a:	c3                   	ret
+
+0000027b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 27b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <exit>:
+SYSCALL(exit)
+ 283:	b8 02 00 00 00       	mov    $0x2,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <wait>:
+SYSCALL(wait)
+ 28b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <pipe>:
+SYSCALL(pipe)
+ 293:	b8 04 00 00 00       	mov    $0x4,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <read>:
+SYSCALL(read)
+ 29b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <write>:
+SYSCALL(write)
+ 2a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <close>:
+SYSCALL(close)
+ 2ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <kill>:
+SYSCALL(kill)
+ 2b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <exec>:
+SYSCALL(exec)
+ 2bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <open>:
+SYSCALL(open)
+ 2c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <mknod>:
+SYSCALL(mknod)
+ 2cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <unlink>:
+SYSCALL(unlink)
+ 2d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <fstat>:
+SYSCALL(fstat)
+ 2db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <link>:
+SYSCALL(link)
+ 2e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <mkdir>:
+SYSCALL(mkdir)
+ 2eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <chdir>:
+SYSCALL(chdir)
+ 2f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <dup>:
+SYSCALL(dup)
+ 2fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <getpid>:
+SYSCALL(getpid)
+ 303:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <sbrk>:
+SYSCALL(sbrk)
+ 30b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <sleep>:
+SYSCALL(sleep)
+ 313:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <uptime>:
+SYSCALL(uptime)
+ 31b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <yield>:
+SYSCALL(yield)
+ 323:	b8 16 00 00 00       	mov    $0x16,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <shutdown>:
+SYSCALL(shutdown)
+ 32b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <nicefork>:
+SYSCALL(nicefork)
+ 333:	b8 18 00 00 00       	mov    $0x18,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <schedlog>:
+SYSCALL(schedlog)
+ 33b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <schedlogread>:
+SYSCALL(schedlogread)
+ 343:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <tracectl>:
+SYSCALL(tracectl)
+ 34b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <getcpustat>:
+SYSCALL(getcpustat)
+ 353:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <setpolicy>:
+SYSCALL(setpolicy)
+ 35b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <affinity>:
+SYSCALL(affinity)
+ 363:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <setnice>:
+SYSCALL(setnice)
+ 36b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <getnice>:
+SYSCALL(getnice)
+ 373:	b8 20 00 00 00       	mov    $0x20,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <setclass>:
+SYSCALL(setclass)
+ 37b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <isocpu>:
+SYSCALL(isocpu)
+ 383:	b8 22 00 00 00       	mov    $0x22,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <getschedstats>:
+SYSCALL(getschedstats)
+ 38b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 393:	55                   	push   %ebp
+ 394:	89 e5                	mov    %esp,%ebp
+ 396:	83 ec 1c             	sub    $0x1c,%esp
+ 399:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 39c:	6a 01                	push   $0x1
+ 39e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3a1:	52                   	push   %edx
+ 3a2:	50                   	push   %eax
+ 3a3:	e8 fb fe ff ff       	call   2a3 <write>
+}
+ 3a8:	83 c4 10             	add    $0x10,%esp
+ 3ab:	c9                   	leave
+ 3ac:	c3                   	ret
+
+000003ad <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3ad:	55                   	push   %ebp
+ 3ae:	89 e5                	mov    %esp,%ebp
+ 3b0:	57                   	push   %edi
+ 3b1:	56                   	push   %esi
+ 3b2:	53                   	push   %ebx
+ 3b3:	83 ec 2c             	sub    $0x2c,%esp
+ 3b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3b9:	89 d0                	mov    %edx,%eax
+ 3bb:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3bd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3c1:	0f 95 c1             	setne  %cl
+ 3c4:	c1 ea 1f             	shr    $0x1f,%edx
+ 3c7:	84 d1                	test   %dl,%cl
+ 3c9:	74 44                	je     40f <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3cb:	f7 d8                	neg    %eax
+ 3cd:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3cf:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3db:	89 c8                	mov    %ecx,%eax
+ 3dd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3e2:	f7 f6                	div    %esi
+ 3e4:	89 df                	mov    %ebx,%edi
+ 3e6:	83 c3 01             	add    $0x1,%ebx
+ 3e9:	0f b6 92 60 06 00 00 	movzbl 0x660(%edx),%edx
+ 3f0:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 3f4:	89 ca                	mov    %ecx,%edx
+ 3f6:	89 c1                	mov    %eax,%ecx
+ 3f8:	39 f2                	cmp    %esi,%edx
+ 3fa:	73 df                	jae    3db <printint+0x2e>
+  if(neg)
+ 3fc:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 400:	74 31                	je     433 <printint+0x86>
+    buf[i++] = '-';
+ 402:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 407:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 40a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 40d:	eb 17                	jmp    426 <printint+0x79>
+    x = xx;
+ 40f:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 411:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 418:	eb bc                	jmp    3d6 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 41a:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 41f:	89 f0                	mov    %esi,%eax
+ 421:	e8 6d ff ff ff       	call   393 <putc>
+  while(--i >= 0)
+ 426:	83 eb 01             	sub    $0x1,%ebx
+ 429:	79 ef                	jns    41a <printint+0x6d>
+}
+ 42b:	83 c4 2c             	add    $0x2c,%esp
+ 42e:	5b                   	pop    %ebx
+ 42f:	5e                   	pop    %esi
+ 430:	5f                   	pop    %edi
+ 431:	5d                   	pop    %ebp
+ 432:	c3                   	ret
+ 433:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 436:	eb ee                	jmp    426 <printint+0x79>
+
+00000438 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 438:	55                   	push   %ebp
+ 439:	89 e5                	mov    %esp,%ebp
+ 43b:	57                   	push   %edi
+ 43c:	56                   	push   %esi
+ 43d:	53                   	push   %ebx
+ 43e:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 441:	8d 45 10             	lea    0x10(%ebp),%eax
+ 444:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 447:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 44c:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 451:	eb 14                	jmp    467 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 453:	89 fa                	mov    %edi,%edx
+ 455:	8b 45 08             	mov    0x8(%ebp),%eax
+ 458:	e8 36 ff ff ff       	call   393 <putc>
+ 45d:	eb 05                	jmp    464 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 45f:	83 fe 25             	cmp    $0x25,%esi
+ 462:	74 25                	je     489 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 464:	83 c3 01             	add    $0x1,%ebx
+ 467:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46a:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 46e:	84 c0                	test   %al,%al
+ 470:	0f 84 20 01 00 00    	je     596 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 476:	0f be f8             	movsbl %al,%edi
+ 479:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 47c:	85 f6                	test   %esi,%esi
+ 47e:	75 df                	jne    45f <printf+0x27>
+      if(c == '%'){
+ 480:	83 f8 25             	cmp    $0x25,%eax
+ 483:	75 ce                	jne    453 <printf+0x1b>
+        state = '%';
+ 485:	89 c6                	mov    %eax,%esi
+ 487:	eb db                	jmp    464 <printf+0x2c>
+      if(c == 'd'){
+ 489:	83 f8 25             	cmp    $0x25,%eax
+ 48c:	0f 84 cf 00 00 00    	je     561 <printf+0x129>
+ 492:	0f 8c dd 00 00 00    	jl     575 <printf+0x13d>
+ 498:	83 f8 78             	cmp    $0x78,%eax
+ 49b:	0f 8f d4 00 00 00    	jg     575 <printf+0x13d>
+ 4a1:	83 f8 63             	cmp    $0x63,%eax
+ 4a4:	0f 8c cb 00 00 00    	jl     575 <printf+0x13d>
+ 4aa:	83 e8 63             	sub    $0x63,%eax
+ 4ad:	83 f8 15             	cmp    $0x15,%eax
+ 4b0:	0f 87 bf 00 00 00    	ja     575 <printf+0x13d>
+ 4b6:	ff 24 85 08 06 00 00 	jmp    *0x608(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4c0:	8b 17                	mov    (%edi),%edx
+ 4c2:	83 ec 0c             	sub    $0xc,%esp
+ 4c5:	6a 01                	push   $0x1
+ 4c7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cf:	e8 d9 fe ff ff       	call   3ad <printint>
+        ap++;
+ 4d4:	83 c7 04             	add    $0x4,%edi
+ 4d7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4da:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4dd:	be 00 00 00 00       	mov    $0x0,%esi
+ 4e2:	eb 80                	jmp    464 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 4e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4e7:	8b 17                	mov    (%edi),%edx
+ 4e9:	83 ec 0c             	sub    $0xc,%esp
+ 4ec:	6a 00                	push   $0x0
+ 4ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 4f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f6:	e8 b2 fe ff ff       	call   3ad <printint>
+        ap++;
+ 4fb:	83 c7 04             	add    $0x4,%edi
+ 4fe:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 501:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 504:	be 00 00 00 00       	mov    $0x0,%esi
+ 509:	e9 56 ff ff ff       	jmp    464 <printf+0x2c>
+        s = (char*)*ap;
+ 50e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 511:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 513:	83 c0 04             	add    $0x4,%eax
+ 516:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 519:	85 f6                	test   %esi,%esi
+ 51b:	75 15                	jne    532 <printf+0xfa>
+          s = "(null)";
+ 51d:	be ff 05 00 00       	mov    $0x5ff,%esi
+ 522:	eb 0e                	jmp    532 <printf+0xfa>
+          putc(fd, *s);
+ 524:	0f be d2             	movsbl %dl,%edx
+ 527:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52a:	e8 64 fe ff ff       	call   393 <putc>
+          s++;
+ 52f:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 532:	0f b6 16             	movzbl (%esi),%edx
+ 535:	84 d2                	test   %dl,%dl
+ 537:	75 eb                	jne    524 <printf+0xec>
+      state = 0;
+ 539:	be 00 00 00 00       	mov    $0x0,%esi
+ 53e:	e9 21 ff ff ff       	jmp    464 <printf+0x2c>
+        putc(fd, *ap);
+ 543:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 546:	0f be 17             	movsbl (%edi),%edx
+ 549:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54c:	e8 42 fe ff ff       	call   393 <putc>
+        ap++;
+ 551:	83 c7 04             	add    $0x4,%edi
+ 554:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 557:	be 00 00 00 00       	mov    $0x0,%esi
+ 55c:	e9 03 ff ff ff       	jmp    464 <printf+0x2c>
+        putc(fd, c);
+ 561:	89 fa                	mov    %edi,%edx
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	e8 28 fe ff ff       	call   393 <putc>
+      state = 0;
+ 56b:	be 00 00 00 00       	mov    $0x0,%esi
+ 570:	e9 ef fe ff ff       	jmp    464 <printf+0x2c>
+        putc(fd, '%');
+ 575:	ba 25 00 00 00       	mov    $0x25,%edx
+ 57a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57d:	e8 11 fe ff ff       	call   393 <putc>
+        putc(fd, c);
+ 582:	89 fa                	mov    %edi,%edx
+ 584:	8b 45 08             	mov    0x8(%ebp),%eax
+ 587:	e8 07 fe ff ff       	call   393 <putc>
+      state = 0;
+ 58c:	be 00 00 00 00       	mov    $0x0,%esi
+ 591:	e9 ce fe ff ff       	jmp    464 <printf+0x2c>
+    }
+  }
+}
+ 596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 599:	5b                   	pop    %ebx
+ 59a:	5e                   	pop    %esi
+ 59b:	5f                   	pop    %edi
+ 59c:	5d                   	pop    %ebp
+ 59d:	c3                   	ret
@@ -0,0 +1,38 @@
+// Print or change the nice value of a process:
+//
+//   renice pid          print its nice value
+//   renice pid value    set it; a queued process moves at once
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sched.h"
+
+// atoi() with an optional minus sign.
+static int
+atoisigned(char *s)
+{
+  if(*s == '-')
+    return -atoi(s + 1);
+  return atoi(s);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid, nice;
+
+  if(argc != 2 && argc != 3){
+    printf(2, "usage: renice pid [value]\n");
+    exit();
+  }
+  pid = atoi(argv[1]);
+  if(argc == 2){
+    if((nice = getnice(pid)) == NICE_NOPROC)
+      printf(2, "renice: no process %d\n", pid);
+    else
+      printf(1, "%d\n", nice);
+  } else if(setnice(pid, atoisigned(argv[2])) < 0)
+    printf(2, "renice: cannot set nice value of %d to %s\n", pid, argv[2]);
+  exit();
+}
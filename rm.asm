@@ -0,0 +1,559 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 41 04             	mov    0x4(%ecx),%eax
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int i;
+
+  if(argc < 2){
+  1c:	83 ff 01             	cmp    $0x1,%edi
+  1f:	7e 07                	jle    28 <main+0x28>
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  21:	bb 01 00 00 00       	mov    $0x1,%ebx
+  26:	eb 17                	jmp    3f <main+0x3f>
+    printf(2, "Usage: rm files...\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 98 03 00 00       	push   $0x398
+  30:	6a 02                	push   $0x2
+  32:	e8 f9 01 00 00       	call   230 <printf>
+    exit();
+  37:	e8 3f 00 00 00       	call   7b <exit>
+  for(i = 1; i < argc; i++){
+  3c:	83 c3 01             	add    $0x1,%ebx
+  3f:	39 fb                	cmp    %edi,%ebx
+  41:	7d 2b                	jge    6e <main+0x6e>
+    if(unlink(argv[i]) < 0){
+  43:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  46:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+  49:	83 ec 0c             	sub    $0xc,%esp
+  4c:	ff 36                	push   (%esi)
+  4e:	e8 78 00 00 00       	call   cb <unlink>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 e2                	jns    3c <main+0x3c>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  5a:	83 ec 04             	sub    $0x4,%esp
+  5d:	ff 36                	push   (%esi)
+  5f:	68 ac 03 00 00       	push   $0x3ac
+  64:	6a 02                	push   $0x2
+  66:	e8 c5 01 00 00       	call   230 <printf>
+      break;
+  6b:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  6e:	e8 08 00 00 00       	call   7b <exit>
+
+00000073 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  73:	b8 01 00 00 00       	mov    $0x1,%eax
+  78:	cd 40                	int    $0x40
+  7a:	c3                   	ret
+
+0000007b <exit>:
+SYSCALL(exit)
+  7b:	b8 02 00 00 00       	mov    $0x2,%eax
+  80:	cd 40                	int    $0x40
+  82:	c3                   	ret
+
+00000083 <wait>:
+SYSCALL(wait)
+  83:	b8 03 00 00 00       	mov    $0x3,%eax
+  88:	cd 40                	int    $0x40
+  8a:	c3                   	ret
+
+0000008b <pipe>:
+SYSCALL(pipe)
+  8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  90:	cd 40                	int    $0x40
+  92:	c3                   	ret
+
+00000093 <read>:
+SYSCALL(read)
+  93:	b8 05 00 00 00       	mov    $0x5,%eax
+  98:	cd 40                	int    $0x40
+  9a:	c3                   	ret
+
+0000009b <write>:
+SYSCALL(write)
+  9b:	b8 10 00 00 00       	mov    $0x10,%eax
+  a0:	cd 40                	int    $0x40
+  a2:	c3                   	ret
+
+000000a3 <close>:
+SYSCALL(close)
+  a3:	b8 15 00 00 00       	mov    $0x15,%eax
+  a8:	cd 40                	int    $0x40
+  aa:	c3                   	ret
+
+000000ab <kill>:
+SYSCALL(kill)
+  ab:	b8 06 00 00 00       	mov    $0x6,%eax
+  b0:	cd 40                	int    $0x40
+  b2:	c3                   	ret
+
+000000b3 <exec>:
+SYSCALL(exec)
+  b3:	b8 07 00 00 00       	mov    $0x7,%eax
+  b8:	cd 40                	int    $0x40
+  ba:	c3                   	ret
+
+000000bb <open>:
+SYSCALL(open)
+  bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  c0:	cd 40                	int    $0x40
+  c2:	c3                   	ret
+
+000000c3 <mknod>:
+SYSCALL(mknod)
+  c3:	b8 11 00 00 00       	mov    $0x11,%eax
+  c8:	cd 40                	int    $0x40
+  ca:	c3                   	ret
+
+000000cb <unlink>:
+SYSCALL(unlink)
+  cb:	b8 12 00 00 00       	mov    $0x12,%eax
+  d0:	cd 40                	int    $0x40
+  d2:	c3                   	ret
+
+000000d3 <fstat>:
+SYSCALL(fstat)
+  d3:	b8 08 00 00 00       	mov    $0x8,%eax
+  d8:	cd 40                	int    $0x40
+  da:	c3                   	ret
+
+000000db <link>:
+SYSCALL(link)
+  db:	b8 13 00 00 00       	mov    $0x13,%eax
+  e0:	cd 40                	int    $0x40
+  e2:	c3                   	ret
+
+000000e3 <mkdir>:
+SYSCALL(mkdir)
+  e3:	b8 14 00 00 00       	mov    $0x14,%eax
+  e8:	cd 40                	int    $0x40
+  ea:	c3                   	ret
+
+000000eb <chdir>:
+SYSCALL(chdir)
+  eb:	b8 09 00 00 00       	mov    $0x9,%eax
+  f0:	cd 40                	int    $0x40
+  f2:	c3                   	ret
+
+000000f3 <dup>:
+SYSCALL(dup)
+  f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  f8:	cd 40                	int    $0x40
+  fa:	c3                   	ret
+
+000000fb <getpid>:
+SYSCALL(getpid)
+  fb:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 100:	cd 40                	int    $0x40
+ 102:	c3                   	ret
+
+00000103 <sbrk>:
+SYSCALL(sbrk)
+ 103:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 108:	cd 40                	int    $0x40
+ 10a:	c3                   	ret
+
+0000010b <sleep>:
+SYSCALL(sleep)
+ 10b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 110:	cd 40                	int    $0x40
+ 112:	c3                   	ret
+
+00000113 <uptime>:
+SYSCALL(uptime)
+ 113:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 118:	cd 40                	int    $0x40
+ 11a:	c3                   	ret
+
+0000011b <yield>:
+SYSCALL(yield)
+ 11b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 120:	cd 40                	int    $0x40
+ 122:	c3                   	ret
+
+00000123 <shutdown>:
+SYSCALL(shutdown)
+ 123:	b8 17 00 00 00       	mov    $0x17,%eax
+ 128:	cd 40                	int    $0x40
+ 12a:	c3                   	ret
+
+0000012b <nicefork>:
+SYSCALL(nicefork)
+ 12b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 130:	cd 40                	int    $0x40
+ 132:	c3                   	ret
+
+00000133 <schedlog>:
+SYSCALL(schedlog)
+ 133:	b8 19 00 00 00       	mov    $0x19,%eax
+ 138:	cd 40                	int    $0x40
+ 13a:	c3                   	ret
+
+0000013b <schedlogread>:
+SYSCALL(schedlogread)
+ 13b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 140:	cd 40                	int    $0x40
+ 142:	c3                   	ret
+
+00000143 <tracectl>:
+SYSCALL(tracectl)
+ 143:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 148:	cd 40                	int    $0x40
+ 14a:	c3                   	ret
+
+0000014b <getcpustat>:
+SYSCALL(getcpustat)
+ 14b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 150:	cd 40                	int    $0x40
+ 152:	c3                   	ret
+
+00000153 <setpolicy>:
+SYSCALL(setpolicy)
+ 153:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 158:	cd 40                	int    $0x40
+ 15a:	c3                   	ret
+
+0000015b <affinity>:
+SYSCALL(affinity)
+ 15b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 160:	cd 40                	int    $0x40
+ 162:	c3                   	ret
+
+00000163 <setnice>:
+SYSCALL(setnice)
+ 163:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 168:	cd 40                	int    $0x40
+ 16a:	c3                   	ret
+
+0000016b <getnice>:
+SYSCALL(getnice)
+ 16b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 170:	cd 40                	int    $0x40
+ 172:	c3                   	ret
+
+00000173 <setclass>:
+SYSCALL(setclass)
+ 173:	b8 21 00 00 00       	mov    $0x21,%eax
+ 178:	cd 40                	int    $0x40
+ 17a:	c3                   	ret
+
+0000017b <isocpu>:
+SYSCALL(isocpu)
+ 17b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 180:	cd 40                	int    $0x40
+ 182:	c3                   	ret
+
+00000183 <getschedstats>:
+SYSCALL(getschedstats)
+ 183:	b8 23 00 00 00       	mov    $0x23,%eax
+ 188:	cd 40                	int    $0x40
+ 18a:	c3                   	ret
+
+0000018b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 18b:	55                   	push   %ebp
+ 18c:	89 e5                	mov    %esp,%ebp
+ 18e:	83 ec 1c             	sub    $0x1c,%esp
+ 191:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 194:	6a 01                	push   $0x1
+ 196:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 199:	52                   	push   %edx
+ 19a:	50                   	push   %eax
+ 19b:	e8 fb fe ff ff       	call   9b <write>
+}
+ 1a0:	83 c4 10             	add    $0x10,%esp
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+
+000001a5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1a5:	55                   	push   %ebp
+ 1a6:	89 e5                	mov    %esp,%ebp
+ 1a8:	57                   	push   %edi
+ 1a9:	56                   	push   %esi
+ 1aa:	53                   	push   %ebx
+ 1ab:	83 ec 2c             	sub    $0x2c,%esp
+ 1ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 1b1:	89 d0                	mov    %edx,%eax
+ 1b3:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 1b5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 1b9:	0f 95 c1             	setne  %cl
+ 1bc:	c1 ea 1f             	shr    $0x1f,%edx
+ 1bf:	84 d1                	test   %dl,%cl
+ 1c1:	74 44                	je     207 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 1c3:	f7 d8                	neg    %eax
+ 1c5:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 1c7:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 1ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1da:	f7 f6                	div    %esi
+ 1dc:	89 df                	mov    %ebx,%edi
+ 1de:	83 c3 01             	add    $0x1,%ebx
+ 1e1:	0f b6 92 24 04 00 00 	movzbl 0x424(%edx),%edx
+ 1e8:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 1ec:	89 ca                	mov    %ecx,%edx
+ 1ee:	89 c1                	mov    %eax,%ecx
+ 1f0:	39 f2                	cmp    %esi,%edx
+ 1f2:	73 df                	jae    1d3 <printint+0x2e>
+  if(neg)
+ 1f4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 1f8:	74 31                	je     22b <printint+0x86>
+    buf[i++] = '-';
+ 1fa:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 1ff:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 202:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 205:	eb 17                	jmp    21e <printint+0x79>
+    x = xx;
+ 207:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 209:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 210:	eb bc                	jmp    1ce <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 212:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	e8 6d ff ff ff       	call   18b <putc>
+  while(--i >= 0)
+ 21e:	83 eb 01             	sub    $0x1,%ebx
+ 221:	79 ef                	jns    212 <printint+0x6d>
+}
+ 223:	83 c4 2c             	add    $0x2c,%esp
+ 226:	5b                   	pop    %ebx
+ 227:	5e                   	pop    %esi
+ 228:	5f                   	pop    %edi
+ 229:	5d                   	pop    %ebp
+ 22a:	c3                   	ret
+ 22b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 22e:	eb ee                	jmp    21e <printint+0x79>
+
+00000230 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+ 235:	53                   	push   %ebx
+ 236:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 239:	8d 45 10             	lea    0x10(%ebp),%eax
+ 23c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 23f:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 244:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 249:	eb 14                	jmp    25f <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 24b:	89 fa                	mov    %edi,%edx
+ 24d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 250:	e8 36 ff ff ff       	call   18b <putc>
+ 255:	eb 05                	jmp    25c <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 257:	83 fe 25             	cmp    $0x25,%esi
+ 25a:	74 25                	je     281 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 25c:	83 c3 01             	add    $0x1,%ebx
+ 25f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 262:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 266:	84 c0                	test   %al,%al
+ 268:	0f 84 20 01 00 00    	je     38e <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 26e:	0f be f8             	movsbl %al,%edi
+ 271:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 274:	85 f6                	test   %esi,%esi
+ 276:	75 df                	jne    257 <printf+0x27>
+      if(c == '%'){
+ 278:	83 f8 25             	cmp    $0x25,%eax
+ 27b:	75 ce                	jne    24b <printf+0x1b>
+        state = '%';
+ 27d:	89 c6                	mov    %eax,%esi
+ 27f:	eb db                	jmp    25c <printf+0x2c>
+      if(c == 'd'){
+ 281:	83 f8 25             	cmp    $0x25,%eax
+ 284:	0f 84 cf 00 00 00    	je     359 <printf+0x129>
+ 28a:	0f 8c dd 00 00 00    	jl     36d <printf+0x13d>
+ 290:	83 f8 78             	cmp    $0x78,%eax
+ 293:	0f 8f d4 00 00 00    	jg     36d <printf+0x13d>
+ 299:	83 f8 63             	cmp    $0x63,%eax
+ 29c:	0f 8c cb 00 00 00    	jl     36d <printf+0x13d>
+ 2a2:	83 e8 63             	sub    $0x63,%eax
+ 2a5:	83 f8 15             	cmp    $0x15,%eax
+ 2a8:	0f 87 bf 00 00 00    	ja     36d <printf+0x13d>
+ 2ae:	ff 24 85 cc 03 00 00 	jmp    *0x3cc(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 2b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2b8:	8b 17                	mov    (%edi),%edx
+ 2ba:	83 ec 0c             	sub    $0xc,%esp
+ 2bd:	6a 01                	push   $0x1
+ 2bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 2c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c7:	e8 d9 fe ff ff       	call   1a5 <printint>
+        ap++;
+ 2cc:	83 c7 04             	add    $0x4,%edi
+ 2cf:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2d2:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 2d5:	be 00 00 00 00       	mov    $0x0,%esi
+ 2da:	eb 80                	jmp    25c <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 2dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2df:	8b 17                	mov    (%edi),%edx
+ 2e1:	83 ec 0c             	sub    $0xc,%esp
+ 2e4:	6a 00                	push   $0x0
+ 2e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ee:	e8 b2 fe ff ff       	call   1a5 <printint>
+        ap++;
+ 2f3:	83 c7 04             	add    $0x4,%edi
+ 2f6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2f9:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2fc:	be 00 00 00 00       	mov    $0x0,%esi
+ 301:	e9 56 ff ff ff       	jmp    25c <printf+0x2c>
+        s = (char*)*ap;
+ 306:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 309:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 30b:	83 c0 04             	add    $0x4,%eax
+ 30e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 311:	85 f6                	test   %esi,%esi
+ 313:	75 15                	jne    32a <printf+0xfa>
+          s = "(null)";
+ 315:	be c5 03 00 00       	mov    $0x3c5,%esi
+ 31a:	eb 0e                	jmp    32a <printf+0xfa>
+          putc(fd, *s);
+ 31c:	0f be d2             	movsbl %dl,%edx
+ 31f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 322:	e8 64 fe ff ff       	call   18b <putc>
+          s++;
+ 327:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 32a:	0f b6 16             	movzbl (%esi),%edx
+ 32d:	84 d2                	test   %dl,%dl
+ 32f:	75 eb                	jne    31c <printf+0xec>
+      state = 0;
+ 331:	be 00 00 00 00       	mov    $0x0,%esi
+ 336:	e9 21 ff ff ff       	jmp    25c <printf+0x2c>
+        putc(fd, *ap);
+ 33b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 33e:	0f be 17             	movsbl (%edi),%edx
+ 341:	8b 45 08             	mov    0x8(%ebp),%eax
+ 344:	e8 42 fe ff ff       	call   18b <putc>
+        ap++;
+ 349:	83 c7 04             	add    $0x4,%edi
+ 34c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 34f:	be 00 00 00 00       	mov    $0x0,%esi
+ 354:	e9 03 ff ff ff       	jmp    25c <printf+0x2c>
+        putc(fd, c);
+ 359:	89 fa                	mov    %edi,%edx
+ 35b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35e:	e8 28 fe ff ff       	call   18b <putc>
+      state = 0;
+ 363:	be 00 00 00 00       	mov    $0x0,%esi
+ 368:	e9 ef fe ff ff       	jmp    25c <printf+0x2c>
+        putc(fd, '%');
+ 36d:	ba 25 00 00 00       	mov    $0x25,%edx
+ 372:	8b 45 08             	mov    0x8(%ebp),%eax
+ 375:	e8 11 fe ff ff       	call   18b <putc>
+        putc(fd, c);
+ 37a:	89 fa                	mov    %edi,%edx
+ 37c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37f:	e8 07 fe ff ff       	call   18b <putc>
+      state = 0;
+ 384:	be 00 00 00 00       	mov    $0x0,%esi
+ 389:	e9 ce fe ff ff       	jmp    25c <printf+0x2c>
+    }
+  }
+}
+ 38e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 391:	5b                   	pop    %ebx
+ 392:	5e                   	pop    %esi
+ 393:	5f                   	pop    %edi
+ 394:	5d                   	pop    %ebp
+ 395:	c3                   	ret
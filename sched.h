@@ -0,0 +1,55 @@
+// Scheduler interface shared by the kernel and user programs.
+
+// Per-CPU scheduler statistics, as returned by getcpustat().
+struct cpustat {
+  uint ticks;            // Timer interrupts taken
+  uint idle_ticks;       // Time halted with no work, in ticks
+  uint dispatches;       // Processes dispatched
+  uint migrations;       // ...that last ran on another CPU
+  uint iso_ticks;        // Time running SCHED_ISO, in ticks
+};
+
+// Scheduling statistics of one process, as returned by
+// getschedstats().  Times are in TSC cycles; tsc_per_tick
+// converts them to timer ticks.
+struct schedstat {
+  uint64 runtime;        // Time spent running
+  uint64 wait_time;      // Time spent RUNNABLE, waiting for a CPU
+  uint64 max_wait;       // Longest single wait
+  uint dispatches;       // Times dispatched on a CPU
+  uint nvcsw;            // Gave up the CPU to sleep
+  uint nivcsw;           // Gave up the CPU still runnable
+  uint tsc_per_tick;
+};
+
+// Scheduling policies, for setpolicy().
+#define SCHEDPOL_BFS      0   // Earliest virtual deadline first
+#define SCHEDPOL_RR       1   // Stock xv6 round robin, one tick each
+
+// What getnice() returns for a pid with no process.  Unlike -1,
+// it is not a valid nice value.
+#define NICE_NOPROC      100
+
+// Scheduling classes, for setclass().
+#define SCHED_NORMAL      0   // Ordered by virtual deadline
+#define SCHED_ISO         1   // Runs before SCHED_NORMAL, up to a CPU cap
+#define SCHED_IDLEPRIO    2   // Runs only when nothing else is runnable
+
+// Scheduler trace event types (see schedlog.c).
+#define SCHEDLOG_FORK     1   // New process queued
+#define SCHEDLOG_WAKEUP   2   // Sleeping process queued
+#define SCHEDLOG_RUN      3   // Process dispatched on a CPU
+#define SCHEDLOG_PREEMPT  4   // Gave up the CPU, still runnable
+#define SCHEDLOG_SLEEP    5   // Gave up the CPU to sleep
+#define SCHEDLOG_EXIT     6   // Gave up the CPU for good
+
+// One scheduler trace event, as returned by schedlogread().
+struct schedevent {
+  uint64 tick;           // Value of the 64-bit tick clock when it happened
+  uchar cpu;             // CPU that recorded it
+  uchar type;            // SCHEDLOG_*
+  short nice;            // Process nice value
+  int pid;               // Process ID
+  uint64 virtual_deadline; // Process virtual deadline
+  int ticks_left;        // Ticks left in its quantum
+};
@@ -0,0 +1,1332 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <spin>:
+}
+
+// A little CPU work for the benchmarks to do.
+static void
+spin(int n)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+  volatile int i;
+
+  for(i = 0; i < n; i++)
+   6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+   d:	eb 09                	jmp    18 <spin+0x18>
+   f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  12:	83 c2 01             	add    $0x1,%edx
+  15:	89 55 fc             	mov    %edx,-0x4(%ebp)
+  18:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1b:	39 c2                	cmp    %eax,%edx
+  1d:	7c f0                	jl     f <spin+0xf>
+    ;
+}
+  1f:	c9                   	leave
+  20:	c3                   	ret
+
+00000021 <ctxbench>:
+{
+  21:	55                   	push   %ebp
+  22:	89 e5                	mov    %esp,%ebp
+  24:	57                   	push   %edi
+  25:	56                   	push   %esi
+  26:	53                   	push   %ebx
+  27:	83 ec 1c             	sub    $0x1c,%esp
+  2a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  start = uptime();
+  2d:	e8 68 06 00 00       	call   69a <uptime>
+  32:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nproc; i++){
+  35:	be 00 00 00 00       	mov    $0x0,%esi
+  3a:	39 fe                	cmp    %edi,%esi
+  3c:	7d 22                	jge    60 <ctxbench+0x3f>
+    if(fork() == 0){
+  3e:	e8 b7 05 00 00       	call   5fa <fork>
+  43:	89 c3                	mov    %eax,%ebx
+  45:	85 c0                	test   %eax,%eax
+  47:	74 0d                	je     56 <ctxbench+0x35>
+  for(i = 0; i < nproc; i++){
+  49:	83 c6 01             	add    $0x1,%esi
+  4c:	eb ec                	jmp    3a <ctxbench+0x19>
+        yield();
+  4e:	e8 4f 06 00 00       	call   6a2 <yield>
+      for(j = 0; j < yields; j++)
+  53:	83 c3 01             	add    $0x1,%ebx
+  56:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+  59:	7c f3                	jl     4e <ctxbench+0x2d>
+      exit();
+  5b:	e8 a2 05 00 00       	call   602 <exit>
+  for(i = 0; i < nproc; i++)
+  60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  65:	39 fb                	cmp    %edi,%ebx
+  67:	7d 0a                	jge    73 <ctxbench+0x52>
+    wait();
+  69:	e8 9c 05 00 00       	call   60a <wait>
+  for(i = 0; i < nproc; i++)
+  6e:	83 c3 01             	add    $0x1,%ebx
+  71:	eb f2                	jmp    65 <ctxbench+0x44>
+  elapsed = uptime() - start;
+  73:	e8 22 06 00 00       	call   69a <uptime>
+  78:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  7b:	29 c8                	sub    %ecx,%eax
+  7d:	89 c3                	mov    %eax,%ebx
+  printf(1, "ctx: %d procs x %d yields in %d ticks", nproc, yields, elapsed);
+  7f:	83 ec 0c             	sub    $0xc,%esp
+  82:	50                   	push   %eax
+  83:	ff 75 0c             	push   0xc(%ebp)
+  86:	57                   	push   %edi
+  87:	68 20 09 00 00       	push   $0x920
+  8c:	6a 01                	push   $0x1
+  8e:	e8 24 07 00 00       	call   7b7 <printf>
+  if(elapsed > 0)
+  93:	83 c4 20             	add    $0x20,%esp
+  96:	85 db                	test   %ebx,%ebx
+  98:	7f 1a                	jg     b4 <ctxbench+0x93>
+  printf(1, "\n");
+  9a:	83 ec 08             	sub    $0x8,%esp
+  9d:	68 a3 0a 00 00       	push   $0xaa3
+  a2:	6a 01                	push   $0x1
+  a4:	e8 0e 07 00 00       	call   7b7 <printf>
+}
+  a9:	83 c4 10             	add    $0x10,%esp
+  ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  af:	5b                   	pop    %ebx
+  b0:	5e                   	pop    %esi
+  b1:	5f                   	pop    %edi
+  b2:	5d                   	pop    %ebp
+  b3:	c3                   	ret
+    printf(1, " (%d switches/tick)", nproc * yields / elapsed);
+  b4:	89 f8                	mov    %edi,%eax
+  b6:	0f af 45 0c          	imul   0xc(%ebp),%eax
+  ba:	83 ec 04             	sub    $0x4,%esp
+  bd:	99                   	cltd
+  be:	f7 fb                	idiv   %ebx
+  c0:	50                   	push   %eax
+  c1:	68 7e 0a 00 00       	push   $0xa7e
+  c6:	6a 01                	push   $0x1
+  c8:	e8 ea 06 00 00       	call   7b7 <printf>
+  cd:	83 c4 10             	add    $0x10,%esp
+  d0:	eb c8                	jmp    9a <ctxbench+0x79>
+
+000000d2 <forkbench>:
+{
+  d2:	55                   	push   %ebp
+  d3:	89 e5                	mov    %esp,%ebp
+  d5:	57                   	push   %edi
+  d6:	56                   	push   %esi
+  d7:	53                   	push   %ebx
+  d8:	83 ec 1c             	sub    $0x1c,%esp
+  db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  start = uptime();
+  de:	e8 b7 05 00 00       	call   69a <uptime>
+  e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < workers; i++){
+  e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  eb:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  ee:	7d 45                	jge    135 <forkbench+0x63>
+    if(fork() == 0){
+  f0:	e8 05 05 00 00       	call   5fa <fork>
+  f5:	89 c3                	mov    %eax,%ebx
+  f7:	85 c0                	test   %eax,%eax
+  f9:	74 21                	je     11c <forkbench+0x4a>
+  for(i = 0; i < workers; i++){
+  fb:	83 c7 01             	add    $0x1,%edi
+  fe:	eb eb                	jmp    eb <forkbench+0x19>
+          printf(1, "fork: fork failed\n");
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	68 92 0a 00 00       	push   $0xa92
+ 108:	6a 01                	push   $0x1
+ 10a:	e8 a8 06 00 00       	call   7b7 <printf>
+          break;
+ 10f:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 112:	e8 eb 04 00 00       	call   602 <exit>
+          exit();
+ 117:	e8 e6 04 00 00       	call   602 <exit>
+      for(j = 0; j < forks; j++){
+ 11c:	39 f3                	cmp    %esi,%ebx
+ 11e:	7d f2                	jge    112 <forkbench+0x40>
+        pid = fork();
+ 120:	e8 d5 04 00 00       	call   5fa <fork>
+        if(pid < 0){
+ 125:	85 c0                	test   %eax,%eax
+ 127:	78 d7                	js     100 <forkbench+0x2e>
+        if(pid == 0)
+ 129:	74 ec                	je     117 <forkbench+0x45>
+        wait();
+ 12b:	e8 da 04 00 00       	call   60a <wait>
+      for(j = 0; j < forks; j++){
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	eb e7                	jmp    11c <forkbench+0x4a>
+  for(i = 0; i < workers; i++)
+ 135:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 13a:	eb 08                	jmp    144 <forkbench+0x72>
+    wait();
+ 13c:	e8 c9 04 00 00       	call   60a <wait>
+  for(i = 0; i < workers; i++)
+ 141:	83 c3 01             	add    $0x1,%ebx
+ 144:	3b 5d 08             	cmp    0x8(%ebp),%ebx
+ 147:	7c f3                	jl     13c <forkbench+0x6a>
+  elapsed = uptime() - start;
+ 149:	e8 4c 05 00 00       	call   69a <uptime>
+ 14e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 151:	29 c8                	sub    %ecx,%eax
+ 153:	89 c3                	mov    %eax,%ebx
+  printf(1, "fork: %d workers x %d forks in %d ticks", workers, forks, elapsed);
+ 155:	83 ec 0c             	sub    $0xc,%esp
+ 158:	50                   	push   %eax
+ 159:	56                   	push   %esi
+ 15a:	ff 75 08             	push   0x8(%ebp)
+ 15d:	68 48 09 00 00       	push   $0x948
+ 162:	6a 01                	push   $0x1
+ 164:	e8 4e 06 00 00       	call   7b7 <printf>
+  if(elapsed > 0)
+ 169:	83 c4 20             	add    $0x20,%esp
+ 16c:	85 db                	test   %ebx,%ebx
+ 16e:	7f 1a                	jg     18a <forkbench+0xb8>
+  printf(1, "\n");
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	68 a3 0a 00 00       	push   $0xaa3
+ 178:	6a 01                	push   $0x1
+ 17a:	e8 38 06 00 00       	call   7b7 <printf>
+}
+ 17f:	83 c4 10             	add    $0x10,%esp
+ 182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 185:	5b                   	pop    %ebx
+ 186:	5e                   	pop    %esi
+ 187:	5f                   	pop    %edi
+ 188:	5d                   	pop    %ebp
+ 189:	c3                   	ret
+    printf(1, " (%d forks/tick)", workers * forks / elapsed);
+ 18a:	89 f0                	mov    %esi,%eax
+ 18c:	0f af 45 08          	imul   0x8(%ebp),%eax
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	99                   	cltd
+ 194:	f7 fb                	idiv   %ebx
+ 196:	50                   	push   %eax
+ 197:	68 a5 0a 00 00       	push   $0xaa5
+ 19c:	6a 01                	push   $0x1
+ 19e:	e8 14 06 00 00       	call   7b7 <printf>
+ 1a3:	83 c4 10             	add    $0x10,%esp
+ 1a6:	eb c8                	jmp    170 <forkbench+0x9e>
+
+000001a8 <iobench>:
+
+void
+iobench(int hogs, int sleepers, int duration)
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+ 1ab:	57                   	push   %edi
+ 1ac:	56                   	push   %esi
+ 1ad:	53                   	push   %ebx
+ 1ae:	83 ec 1c             	sub    $0x1c,%esp
+ 1b1:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1b4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i, end, t, late, wakeups, total, max, work;
+
+  end = uptime() + duration;
+ 1b7:	e8 de 04 00 00       	call   69a <uptime>
+ 1bc:	03 45 10             	add    0x10(%ebp),%eax
+ 1bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < hogs; i++){
+ 1c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1c7:	39 f3                	cmp    %esi,%ebx
+ 1c9:	7d 43                	jge    20e <iobench+0x66>
+    if(fork() == 0){
+ 1cb:	e8 2a 04 00 00       	call   5fa <fork>
+ 1d0:	85 c0                	test   %eax,%eax
+ 1d2:	74 05                	je     1d9 <iobench+0x31>
+  for(i = 0; i < hogs; i++){
+ 1d4:	83 c3 01             	add    $0x1,%ebx
+ 1d7:	eb ee                	jmp    1c7 <iobench+0x1f>
+ 1d9:	89 c3                	mov    %eax,%ebx
+ 1db:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 1de:	eb 0d                	jmp    1ed <iobench+0x45>
+      for(work = 0; uptime() < end; work++)
+        spin(10000);
+ 1e0:	b8 10 27 00 00       	mov    $0x2710,%eax
+ 1e5:	e8 16 fe ff ff       	call   0 <spin>
+      for(work = 0; uptime() < end; work++)
+ 1ea:	83 c3 01             	add    $0x1,%ebx
+ 1ed:	e8 a8 04 00 00       	call   69a <uptime>
+ 1f2:	39 f0                	cmp    %esi,%eax
+ 1f4:	7c ea                	jl     1e0 <iobench+0x38>
+      printf(1, "io: hog %d did %d units of work\n", getpid(), work);
+ 1f6:	e8 87 04 00 00       	call   682 <getpid>
+ 1fb:	53                   	push   %ebx
+ 1fc:	50                   	push   %eax
+ 1fd:	68 70 09 00 00       	push   $0x970
+ 202:	6a 01                	push   $0x1
+ 204:	e8 ae 05 00 00       	call   7b7 <printf>
+      exit();
+ 209:	e8 f4 03 00 00       	call   602 <exit>
+    }
+  }
+  for(i = 0; i < sleepers; i++){
+ 20e:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 213:	39 fb                	cmp    %edi,%ebx
+ 215:	0f 8d 81 00 00 00    	jge    29c <iobench+0xf4>
+    if(fork() == 0){
+ 21b:	e8 da 03 00 00       	call   5fa <fork>
+ 220:	85 c0                	test   %eax,%eax
+ 222:	74 4a                	je     26e <iobench+0xc6>
+  for(i = 0; i < sleepers; i++){
+ 224:	83 c3 01             	add    $0x1,%ebx
+ 227:	eb ea                	jmp    213 <iobench+0x6b>
+      while((t = uptime()) < end){
+        sleep(1);
+        // sleep(1) returns at tick t+1 at the earliest.
+        late = uptime() - t - 1;
+        if(late < 0)
+          late = 0;
+ 229:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 22c:	eb 2f                	jmp    25d <iobench+0xb5>
+        wakeups++;
+        total += late;
+        if(late > max)
+          max = late;
+        spin(1000);
+ 22e:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+ 233:	e8 c8 fd ff ff       	call   0 <spin>
+      while((t = uptime()) < end){
+ 238:	e8 5d 04 00 00       	call   69a <uptime>
+ 23d:	89 c3                	mov    %eax,%ebx
+ 23f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+ 242:	7e 36                	jle    27a <iobench+0xd2>
+        sleep(1);
+ 244:	83 ec 0c             	sub    $0xc,%esp
+ 247:	6a 01                	push   $0x1
+ 249:	e8 44 04 00 00       	call   692 <sleep>
+        late = uptime() - t - 1;
+ 24e:	e8 47 04 00 00       	call   69a <uptime>
+ 253:	29 d8                	sub    %ebx,%eax
+        if(late < 0)
+ 255:	83 c4 10             	add    $0x10,%esp
+ 258:	83 e8 01             	sub    $0x1,%eax
+ 25b:	78 cc                	js     229 <iobench+0x81>
+        wakeups++;
+ 25d:	83 c7 01             	add    $0x1,%edi
+        total += late;
+ 260:	01 c6                	add    %eax,%esi
+        if(late > max)
+ 262:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 265:	39 d0                	cmp    %edx,%eax
+ 267:	7e c5                	jle    22e <iobench+0x86>
+          max = late;
+ 269:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 26c:	eb c0                	jmp    22e <iobench+0x86>
+      wakeups = total = max = 0;
+ 26e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 271:	89 c6                	mov    %eax,%esi
+ 273:	89 c7                	mov    %eax,%edi
+ 275:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 278:	eb be                	jmp    238 <iobench+0x90>
+      }
+      printf(1, "io: sleeper %d woke %d times, %d ticks late in total, "
+ 27a:	e8 03 04 00 00       	call   682 <getpid>
+ 27f:	83 ec 08             	sub    $0x8,%esp
+ 282:	ff 75 e0             	push   -0x20(%ebp)
+ 285:	56                   	push   %esi
+ 286:	57                   	push   %edi
+ 287:	50                   	push   %eax
+ 288:	68 94 09 00 00       	push   $0x994
+ 28d:	6a 01                	push   $0x1
+ 28f:	e8 23 05 00 00       	call   7b7 <printf>
+             "%d at most\n", getpid(), wakeups, total, max);
+      exit();
+ 294:	83 c4 20             	add    $0x20,%esp
+ 297:	e8 66 03 00 00       	call   602 <exit>
+    }
+  }
+  for(i = 0; i < hogs + sleepers; i++)
+ 29c:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2a1:	eb 08                	jmp    2ab <iobench+0x103>
+    wait();
+ 2a3:	e8 62 03 00 00       	call   60a <wait>
+  for(i = 0; i < hogs + sleepers; i++)
+ 2a8:	83 c3 01             	add    $0x1,%ebx
+ 2ab:	8d 04 3e             	lea    (%esi,%edi,1),%eax
+ 2ae:	39 d8                	cmp    %ebx,%eax
+ 2b0:	7f f1                	jg     2a3 <iobench+0xfb>
+}
+ 2b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2b5:	5b                   	pop    %ebx
+ 2b6:	5e                   	pop    %esi
+ 2b7:	5f                   	pop    %edi
+ 2b8:	5d                   	pop    %ebp
+ 2b9:	c3                   	ret
+
+000002ba <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 2ba:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 2be:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2c1:	ff 71 fc             	push   -0x4(%ecx)
+ 2c4:	55                   	push   %ebp
+ 2c5:	89 e5                	mov    %esp,%ebp
+ 2c7:	57                   	push   %edi
+ 2c8:	56                   	push   %esi
+ 2c9:	53                   	push   %ebx
+ 2ca:	51                   	push   %ecx
+ 2cb:	83 ec 18             	sub    $0x18,%esp
+ 2ce:	8b 19                	mov    (%ecx),%ebx
+ 2d0:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc < 2){
+ 2d3:	83 fb 01             	cmp    $0x1,%ebx
+ 2d6:	7e 3d                	jle    315 <main+0x5b>
+    printf(2, "       schedbench fork [workers] [forks]\n");
+    printf(2, "       schedbench io [hogs] [sleepers] [ticks]\n");
+    exit();
+  }
+
+  if(strcmp(argv[1], "ctx") == 0){
+ 2d8:	83 ec 08             	sub    $0x8,%esp
+ 2db:	68 b6 0a 00 00       	push   $0xab6
+ 2e0:	ff 76 04             	push   0x4(%esi)
+ 2e3:	e8 a1 01 00 00       	call   489 <strcmp>
+ 2e8:	83 c4 10             	add    $0x10,%esp
+ 2eb:	85 c0                	test   %eax,%eax
+ 2ed:	75 7a                	jne    369 <main+0xaf>
+    ctxbench(argc > 2 ? atoi(argv[2]) : 4, argc > 3 ? atoi(argv[3]) : 1000);
+ 2ef:	83 fb 03             	cmp    $0x3,%ebx
+ 2f2:	7f 53                	jg     347 <main+0x8d>
+ 2f4:	bf e8 03 00 00       	mov    $0x3e8,%edi
+ 2f9:	83 fb 02             	cmp    $0x2,%ebx
+ 2fc:	7f 5b                	jg     359 <main+0x9f>
+ 2fe:	b8 04 00 00 00       	mov    $0x4,%eax
+ 303:	83 ec 08             	sub    $0x8,%esp
+ 306:	57                   	push   %edi
+ 307:	50                   	push   %eax
+ 308:	e8 14 fd ff ff       	call   21 <ctxbench>
+ 30d:	83 c4 10             	add    $0x10,%esp
+    iobench(argc > 2 ? atoi(argv[2]) : 3, argc > 3 ? atoi(argv[3]) : 3,
+            argc > 4 ? atoi(argv[4]) : 1000);
+  } else {
+    printf(2, "schedbench: unknown benchmark %s\n", argv[1]);
+  }
+  exit();
+ 310:	e8 ed 02 00 00       	call   602 <exit>
+    printf(2, "usage: schedbench ctx [nproc] [yields]\n");
+ 315:	83 ec 08             	sub    $0x8,%esp
+ 318:	68 d8 09 00 00       	push   $0x9d8
+ 31d:	6a 02                	push   $0x2
+ 31f:	e8 93 04 00 00       	call   7b7 <printf>
+    printf(2, "       schedbench fork [workers] [forks]\n");
+ 324:	83 c4 08             	add    $0x8,%esp
+ 327:	68 00 0a 00 00       	push   $0xa00
+ 32c:	6a 02                	push   $0x2
+ 32e:	e8 84 04 00 00       	call   7b7 <printf>
+    printf(2, "       schedbench io [hogs] [sleepers] [ticks]\n");
+ 333:	83 c4 08             	add    $0x8,%esp
+ 336:	68 2c 0a 00 00       	push   $0xa2c
+ 33b:	6a 02                	push   $0x2
+ 33d:	e8 75 04 00 00       	call   7b7 <printf>
+    exit();
+ 342:	e8 bb 02 00 00       	call   602 <exit>
+    ctxbench(argc > 2 ? atoi(argv[2]) : 4, argc > 3 ? atoi(argv[3]) : 1000);
+ 347:	83 ec 0c             	sub    $0xc,%esp
+ 34a:	ff 76 0c             	push   0xc(%esi)
+ 34d:	e8 4c 02 00 00       	call   59e <atoi>
+ 352:	89 c7                	mov    %eax,%edi
+ 354:	83 c4 10             	add    $0x10,%esp
+ 357:	eb a0                	jmp    2f9 <main+0x3f>
+ 359:	83 ec 0c             	sub    $0xc,%esp
+ 35c:	ff 76 08             	push   0x8(%esi)
+ 35f:	e8 3a 02 00 00       	call   59e <atoi>
+ 364:	83 c4 10             	add    $0x10,%esp
+ 367:	eb 9a                	jmp    303 <main+0x49>
+  } else if(strcmp(argv[1], "fork") == 0){
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	68 ba 0a 00 00       	push   $0xaba
+ 371:	ff 76 04             	push   0x4(%esi)
+ 374:	e8 10 01 00 00       	call   489 <strcmp>
+ 379:	83 c4 10             	add    $0x10,%esp
+ 37c:	85 c0                	test   %eax,%eax
+ 37e:	75 48                	jne    3c8 <main+0x10e>
+    forkbench(argc > 2 ? atoi(argv[2]) : 4, argc > 3 ? atoi(argv[3]) : 200);
+ 380:	83 fb 03             	cmp    $0x3,%ebx
+ 383:	7f 21                	jg     3a6 <main+0xec>
+ 385:	bf c8 00 00 00       	mov    $0xc8,%edi
+ 38a:	83 fb 02             	cmp    $0x2,%ebx
+ 38d:	7f 29                	jg     3b8 <main+0xfe>
+ 38f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 394:	83 ec 08             	sub    $0x8,%esp
+ 397:	57                   	push   %edi
+ 398:	50                   	push   %eax
+ 399:	e8 34 fd ff ff       	call   d2 <forkbench>
+ 39e:	83 c4 10             	add    $0x10,%esp
+ 3a1:	e9 6a ff ff ff       	jmp    310 <main+0x56>
+ 3a6:	83 ec 0c             	sub    $0xc,%esp
+ 3a9:	ff 76 0c             	push   0xc(%esi)
+ 3ac:	e8 ed 01 00 00       	call   59e <atoi>
+ 3b1:	89 c7                	mov    %eax,%edi
+ 3b3:	83 c4 10             	add    $0x10,%esp
+ 3b6:	eb d2                	jmp    38a <main+0xd0>
+ 3b8:	83 ec 0c             	sub    $0xc,%esp
+ 3bb:	ff 76 08             	push   0x8(%esi)
+ 3be:	e8 db 01 00 00       	call   59e <atoi>
+ 3c3:	83 c4 10             	add    $0x10,%esp
+ 3c6:	eb cc                	jmp    394 <main+0xda>
+  } else if(strcmp(argv[1], "io") == 0){
+ 3c8:	83 ec 08             	sub    $0x8,%esp
+ 3cb:	68 bf 0a 00 00       	push   $0xabf
+ 3d0:	ff 76 04             	push   0x4(%esi)
+ 3d3:	e8 b1 00 00 00       	call   489 <strcmp>
+ 3d8:	83 c4 10             	add    $0x10,%esp
+ 3db:	85 c0                	test   %eax,%eax
+ 3dd:	75 6a                	jne    449 <main+0x18f>
+    iobench(argc > 2 ? atoi(argv[2]) : 3, argc > 3 ? atoi(argv[3]) : 3,
+ 3df:	83 fb 04             	cmp    $0x4,%ebx
+ 3e2:	7f 30                	jg     414 <main+0x15a>
+ 3e4:	bf e8 03 00 00       	mov    $0x3e8,%edi
+ 3e9:	83 fb 03             	cmp    $0x3,%ebx
+ 3ec:	7f 38                	jg     426 <main+0x16c>
+ 3ee:	c7 45 e4 03 00 00 00 	movl   $0x3,-0x1c(%ebp)
+ 3f5:	83 fb 02             	cmp    $0x2,%ebx
+ 3f8:	7f 3f                	jg     439 <main+0x17f>
+ 3fa:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3ff:	83 ec 04             	sub    $0x4,%esp
+ 402:	57                   	push   %edi
+ 403:	ff 75 e4             	push   -0x1c(%ebp)
+ 406:	50                   	push   %eax
+ 407:	e8 9c fd ff ff       	call   1a8 <iobench>
+ 40c:	83 c4 10             	add    $0x10,%esp
+ 40f:	e9 fc fe ff ff       	jmp    310 <main+0x56>
+            argc > 4 ? atoi(argv[4]) : 1000);
+ 414:	83 ec 0c             	sub    $0xc,%esp
+ 417:	ff 76 10             	push   0x10(%esi)
+ 41a:	e8 7f 01 00 00       	call   59e <atoi>
+ 41f:	89 c7                	mov    %eax,%edi
+ 421:	83 c4 10             	add    $0x10,%esp
+ 424:	eb c3                	jmp    3e9 <main+0x12f>
+    iobench(argc > 2 ? atoi(argv[2]) : 3, argc > 3 ? atoi(argv[3]) : 3,
+ 426:	83 ec 0c             	sub    $0xc,%esp
+ 429:	ff 76 0c             	push   0xc(%esi)
+ 42c:	e8 6d 01 00 00       	call   59e <atoi>
+ 431:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 434:	83 c4 10             	add    $0x10,%esp
+ 437:	eb bc                	jmp    3f5 <main+0x13b>
+ 439:	83 ec 0c             	sub    $0xc,%esp
+ 43c:	ff 76 08             	push   0x8(%esi)
+ 43f:	e8 5a 01 00 00       	call   59e <atoi>
+ 444:	83 c4 10             	add    $0x10,%esp
+ 447:	eb b6                	jmp    3ff <main+0x145>
+    printf(2, "schedbench: unknown benchmark %s\n", argv[1]);
+ 449:	83 ec 04             	sub    $0x4,%esp
+ 44c:	ff 76 04             	push   0x4(%esi)
+ 44f:	68 5c 0a 00 00       	push   $0xa5c
+ 454:	6a 02                	push   $0x2
+ 456:	e8 5c 03 00 00       	call   7b7 <printf>
+ 45b:	83 c4 10             	add    $0x10,%esp
+ 45e:	e9 ad fe ff ff       	jmp    310 <main+0x56>
+
+00000463 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 463:	55                   	push   %ebp
+ 464:	89 e5                	mov    %esp,%ebp
+ 466:	56                   	push   %esi
+ 467:	53                   	push   %ebx
+ 468:	8b 75 08             	mov    0x8(%ebp),%esi
+ 46b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 46e:	89 f0                	mov    %esi,%eax
+ 470:	89 d1                	mov    %edx,%ecx
+ 472:	83 c2 01             	add    $0x1,%edx
+ 475:	89 c3                	mov    %eax,%ebx
+ 477:	83 c0 01             	add    $0x1,%eax
+ 47a:	0f b6 09             	movzbl (%ecx),%ecx
+ 47d:	88 0b                	mov    %cl,(%ebx)
+ 47f:	84 c9                	test   %cl,%cl
+ 481:	75 ed                	jne    470 <strcpy+0xd>
+    ;
+  return os;
+}
+ 483:	89 f0                	mov    %esi,%eax
+ 485:	5b                   	pop    %ebx
+ 486:	5e                   	pop    %esi
+ 487:	5d                   	pop    %ebp
+ 488:	c3                   	ret
+
+00000489 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 489:	55                   	push   %ebp
+ 48a:	89 e5                	mov    %esp,%ebp
+ 48c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 48f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 492:	eb 06                	jmp    49a <strcmp+0x11>
+    p++, q++;
+ 494:	83 c1 01             	add    $0x1,%ecx
+ 497:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 49a:	0f b6 01             	movzbl (%ecx),%eax
+ 49d:	84 c0                	test   %al,%al
+ 49f:	74 04                	je     4a5 <strcmp+0x1c>
+ 4a1:	3a 02                	cmp    (%edx),%al
+ 4a3:	74 ef                	je     494 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 4a5:	0f b6 c0             	movzbl %al,%eax
+ 4a8:	0f b6 12             	movzbl (%edx),%edx
+ 4ab:	29 d0                	sub    %edx,%eax
+}
+ 4ad:	5d                   	pop    %ebp
+ 4ae:	c3                   	ret
+
+000004af <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 4af:	55                   	push   %ebp
+ 4b0:	89 e5                	mov    %esp,%ebp
+ 4b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4b5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4ba:	eb 03                	jmp    4bf <strlen+0x10>
+ 4bc:	83 c0 01             	add    $0x1,%eax
+ 4bf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4c3:	75 f7                	jne    4bc <strlen+0xd>
+    ;
+  return n;
+}
+ 4c5:	5d                   	pop    %ebp
+ 4c6:	c3                   	ret
+
+000004c7 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4c7:	55                   	push   %ebp
+ 4c8:	89 e5                	mov    %esp,%ebp
+ 4ca:	57                   	push   %edi
+ 4cb:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4ce:	89 d7                	mov    %edx,%edi
+ 4d0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d6:	fc                   	cld
+ 4d7:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4d9:	89 d0                	mov    %edx,%eax
+ 4db:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4de:	c9                   	leave
+ 4df:	c3                   	ret
+
+000004e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4ea:	eb 03                	jmp    4ef <strchr+0xf>
+ 4ec:	83 c0 01             	add    $0x1,%eax
+ 4ef:	0f b6 10             	movzbl (%eax),%edx
+ 4f2:	84 d2                	test   %dl,%dl
+ 4f4:	74 06                	je     4fc <strchr+0x1c>
+    if(*s == c)
+ 4f6:	38 ca                	cmp    %cl,%dl
+ 4f8:	75 f2                	jne    4ec <strchr+0xc>
+ 4fa:	eb 05                	jmp    501 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 4fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 501:	5d                   	pop    %ebp
+ 502:	c3                   	ret
+
+00000503 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 503:	55                   	push   %ebp
+ 504:	89 e5                	mov    %esp,%ebp
+ 506:	57                   	push   %edi
+ 507:	56                   	push   %esi
+ 508:	53                   	push   %ebx
+ 509:	83 ec 1c             	sub    $0x1c,%esp
+ 50c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 50f:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 514:	89 de                	mov    %ebx,%esi
+ 516:	83 c3 01             	add    $0x1,%ebx
+ 519:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 51c:	7d 2e                	jge    54c <gets+0x49>
+    cc = read(0, &c, 1);
+ 51e:	83 ec 04             	sub    $0x4,%esp
+ 521:	6a 01                	push   $0x1
+ 523:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 526:	50                   	push   %eax
+ 527:	6a 00                	push   $0x0
+ 529:	e8 ec 00 00 00       	call   61a <read>
+    if(cc < 1)
+ 52e:	83 c4 10             	add    $0x10,%esp
+ 531:	85 c0                	test   %eax,%eax
+ 533:	7e 17                	jle    54c <gets+0x49>
+      break;
+    buf[i++] = c;
+ 535:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 539:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 53c:	3c 0a                	cmp    $0xa,%al
+ 53e:	0f 94 c2             	sete   %dl
+ 541:	3c 0d                	cmp    $0xd,%al
+ 543:	0f 94 c0             	sete   %al
+ 546:	08 c2                	or     %al,%dl
+ 548:	74 ca                	je     514 <gets+0x11>
+    buf[i++] = c;
+ 54a:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 54c:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 550:	89 f8                	mov    %edi,%eax
+ 552:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 555:	5b                   	pop    %ebx
+ 556:	5e                   	pop    %esi
+ 557:	5f                   	pop    %edi
+ 558:	5d                   	pop    %ebp
+ 559:	c3                   	ret
+
+0000055a <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 55a:	55                   	push   %ebp
+ 55b:	89 e5                	mov    %esp,%ebp
+ 55d:	56                   	push   %esi
+ 55e:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 55f:	83 ec 08             	sub    $0x8,%esp
+ 562:	6a 00                	push   $0x0
+ 564:	ff 75 08             	push   0x8(%ebp)
+ 567:	e8 d6 00 00 00       	call   642 <open>
+  if(fd < 0)
+ 56c:	83 c4 10             	add    $0x10,%esp
+ 56f:	85 c0                	test   %eax,%eax
+ 571:	78 24                	js     597 <stat+0x3d>
+ 573:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 575:	83 ec 08             	sub    $0x8,%esp
+ 578:	ff 75 0c             	push   0xc(%ebp)
+ 57b:	50                   	push   %eax
+ 57c:	e8 d9 00 00 00       	call   65a <fstat>
+ 581:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 583:	89 1c 24             	mov    %ebx,(%esp)
+ 586:	e8 9f 00 00 00       	call   62a <close>
+  return r;
+ 58b:	83 c4 10             	add    $0x10,%esp
+}
+ 58e:	89 f0                	mov    %esi,%eax
+ 590:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 593:	5b                   	pop    %ebx
+ 594:	5e                   	pop    %esi
+ 595:	5d                   	pop    %ebp
+ 596:	c3                   	ret
+    return -1;
+ 597:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 59c:	eb f0                	jmp    58e <stat+0x34>
+
+0000059e <atoi>:
+
+int
+atoi(const char *s)
+{
+ 59e:	55                   	push   %ebp
+ 59f:	89 e5                	mov    %esp,%ebp
+ 5a1:	53                   	push   %ebx
+ 5a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 5a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 5aa:	eb 10                	jmp    5bc <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 5ac:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 5af:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 5b2:	83 c1 01             	add    $0x1,%ecx
+ 5b5:	0f be c0             	movsbl %al,%eax
+ 5b8:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 5bc:	0f b6 01             	movzbl (%ecx),%eax
+ 5bf:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5c2:	80 fb 09             	cmp    $0x9,%bl
+ 5c5:	76 e5                	jbe    5ac <atoi+0xe>
+  return n;
+}
+ 5c7:	89 d0                	mov    %edx,%eax
+ 5c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5cc:	c9                   	leave
+ 5cd:	c3                   	ret
+
+000005ce <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5ce:	55                   	push   %ebp
+ 5cf:	89 e5                	mov    %esp,%ebp
+ 5d1:	56                   	push   %esi
+ 5d2:	53                   	push   %ebx
+ 5d3:	8b 75 08             	mov    0x8(%ebp),%esi
+ 5d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 5d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 5dc:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 5de:	eb 0d                	jmp    5ed <memmove+0x1f>
+    *dst++ = *src++;
+ 5e0:	0f b6 01             	movzbl (%ecx),%eax
+ 5e3:	88 02                	mov    %al,(%edx)
+ 5e5:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 5e8:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 5eb:	89 d8                	mov    %ebx,%eax
+ 5ed:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 5f0:	85 c0                	test   %eax,%eax
+ 5f2:	7f ec                	jg     5e0 <memmove+0x12>
+  return vdst;
+}
+ 5f4:	89 f0                	mov    %esi,%eax
+ 5f6:	5b                   	pop    %ebx
+ 5f7:	5e                   	pop    %esi
+ 5f8:	5d                   	pop    %ebp
+ 5f9:	c3                   	ret
+
+000005fa <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5fa:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ff:	cd 40                	int    $0x40
+ 601:	c3                   	ret
+
+00000602 <exit>:
+SYSCALL(exit)
+ 602:	b8 02 00 00 00       	mov    $0x2,%eax
+ 607:	cd 40                	int    $0x40
+ 609:	c3                   	ret
+
+0000060a <wait>:
+SYSCALL(wait)
+ 60a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 60f:	cd 40                	int    $0x40
+ 611:	c3                   	ret
+
+00000612 <pipe>:
+SYSCALL(pipe)
+ 612:	b8 04 00 00 00       	mov    $0x4,%eax
+ 617:	cd 40                	int    $0x40
+ 619:	c3                   	ret
+
+0000061a <read>:
+SYSCALL(read)
+ 61a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 61f:	cd 40                	int    $0x40
+ 621:	c3                   	ret
+
+00000622 <write>:
+SYSCALL(write)
+ 622:	b8 10 00 00 00       	mov    $0x10,%eax
+ 627:	cd 40                	int    $0x40
+ 629:	c3                   	ret
+
+0000062a <close>:
+SYSCALL(close)
+ 62a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 62f:	cd 40                	int    $0x40
+ 631:	c3                   	ret
+
+00000632 <kill>:
+SYSCALL(kill)
+ 632:	b8 06 00 00 00       	mov    $0x6,%eax
+ 637:	cd 40                	int    $0x40
+ 639:	c3                   	ret
+
+0000063a <exec>:
+SYSCALL(exec)
+ 63a:	b8 07 00 00 00       	mov    $0x7,%eax
+ 63f:	cd 40                	int    $0x40
+ 641:	c3                   	ret
+
+00000642 <open>:
+SYSCALL(open)
+ 642:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 647:	cd 40                	int    $0x40
+ 649:	c3                   	ret
+
+0000064a <mknod>:
+SYSCALL(mknod)
+ 64a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 64f:	cd 40                	int    $0x40
+ 651:	c3                   	ret
+
+00000652 <unlink>:
+SYSCALL(unlink)
+ 652:	b8 12 00 00 00       	mov    $0x12,%eax
+ 657:	cd 40                	int    $0x40
+ 659:	c3                   	ret
+
+0000065a <fstat>:
+SYSCALL(fstat)
+ 65a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 65f:	cd 40                	int    $0x40
+ 661:	c3                   	ret
+
+00000662 <link>:
+SYSCALL(link)
+ 662:	b8 13 00 00 00       	mov    $0x13,%eax
+ 667:	cd 40                	int    $0x40
+ 669:	c3                   	ret
+
+0000066a <mkdir>:
+SYSCALL(mkdir)
+ 66a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 66f:	cd 40                	int    $0x40
+ 671:	c3                   	ret
+
+00000672 <chdir>:
+SYSCALL(chdir)
+ 672:	b8 09 00 00 00       	mov    $0x9,%eax
+ 677:	cd 40                	int    $0x40
+ 679:	c3                   	ret
+
+0000067a <dup>:
+SYSCALL(dup)
+ 67a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 67f:	cd 40                	int    $0x40
+ 681:	c3                   	ret
+
+00000682 <getpid>:
+SYSCALL(getpid)
+ 682:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 687:	cd 40                	int    $0x40
+ 689:	c3                   	ret
+
+0000068a <sbrk>:
+SYSCALL(sbrk)
+ 68a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 68f:	cd 40                	int    $0x40
+ 691:	c3                   	ret
+
+00000692 <sleep>:
+SYSCALL(sleep)
+ 692:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 697:	cd 40                	int    $0x40
+ 699:	c3                   	ret
+
+0000069a <uptime>:
+SYSCALL(uptime)
+ 69a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 69f:	cd 40                	int    $0x40
+ 6a1:	c3                   	ret
+
+000006a2 <yield>:
+SYSCALL(yield)
+ 6a2:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6a7:	cd 40                	int    $0x40
+ 6a9:	c3                   	ret
+
+000006aa <shutdown>:
+SYSCALL(shutdown)
+ 6aa:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6af:	cd 40                	int    $0x40
+ 6b1:	c3                   	ret
+
+000006b2 <nicefork>:
+SYSCALL(nicefork)
+ 6b2:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6b7:	cd 40                	int    $0x40
+ 6b9:	c3                   	ret
+
+000006ba <schedlog>:
+SYSCALL(schedlog)
+ 6ba:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6bf:	cd 40                	int    $0x40
+ 6c1:	c3                   	ret
+
+000006c2 <schedlogread>:
+SYSCALL(schedlogread)
+ 6c2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c7:	cd 40                	int    $0x40
+ 6c9:	c3                   	ret
+
+000006ca <tracectl>:
+SYSCALL(tracectl)
+ 6ca:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6cf:	cd 40                	int    $0x40
+ 6d1:	c3                   	ret
+
+000006d2 <getcpustat>:
+SYSCALL(getcpustat)
+ 6d2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6d7:	cd 40                	int    $0x40
+ 6d9:	c3                   	ret
+
+000006da <setpolicy>:
+SYSCALL(setpolicy)
+ 6da:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6df:	cd 40                	int    $0x40
+ 6e1:	c3                   	ret
+
+000006e2 <affinity>:
+SYSCALL(affinity)
+ 6e2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6e7:	cd 40                	int    $0x40
+ 6e9:	c3                   	ret
+
+000006ea <setnice>:
+SYSCALL(setnice)
+ 6ea:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6ef:	cd 40                	int    $0x40
+ 6f1:	c3                   	ret
+
+000006f2 <getnice>:
+SYSCALL(getnice)
+ 6f2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6f7:	cd 40                	int    $0x40
+ 6f9:	c3                   	ret
+
+000006fa <setclass>:
+SYSCALL(setclass)
+ 6fa:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6ff:	cd 40                	int    $0x40
+ 701:	c3                   	ret
+
+00000702 <isocpu>:
+SYSCALL(isocpu)
+ 702:	b8 22 00 00 00       	mov    $0x22,%eax
+ 707:	cd 40                	int    $0x40
+ 709:	c3                   	ret
+
+0000070a <getschedstats>:
+SYSCALL(getschedstats)
+ 70a:	b8 23 00 00 00       	mov    $0x23,%eax
+ 70f:	cd 40                	int    $0x40
+ 711:	c3                   	ret
+
+00000712 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 712:	55                   	push   %ebp
+ 713:	89 e5                	mov    %esp,%ebp
+ 715:	83 ec 1c             	sub    $0x1c,%esp
+ 718:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 71b:	6a 01                	push   $0x1
+ 71d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 720:	52                   	push   %edx
+ 721:	50                   	push   %eax
+ 722:	e8 fb fe ff ff       	call   622 <write>
+}
+ 727:	83 c4 10             	add    $0x10,%esp
+ 72a:	c9                   	leave
+ 72b:	c3                   	ret
+
+0000072c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 72c:	55                   	push   %ebp
+ 72d:	89 e5                	mov    %esp,%ebp
+ 72f:	57                   	push   %edi
+ 730:	56                   	push   %esi
+ 731:	53                   	push   %ebx
+ 732:	83 ec 2c             	sub    $0x2c,%esp
+ 735:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 738:	89 d0                	mov    %edx,%eax
+ 73a:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 73c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 740:	0f 95 c1             	setne  %cl
+ 743:	c1 ea 1f             	shr    $0x1f,%edx
+ 746:	84 d1                	test   %dl,%cl
+ 748:	74 44                	je     78e <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 74a:	f7 d8                	neg    %eax
+ 74c:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 74e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 755:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 75a:	89 c8                	mov    %ecx,%eax
+ 75c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 761:	f7 f6                	div    %esi
+ 763:	89 df                	mov    %ebx,%edi
+ 765:	83 c3 01             	add    $0x1,%ebx
+ 768:	0f b6 92 24 0b 00 00 	movzbl 0xb24(%edx),%edx
+ 76f:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 773:	89 ca                	mov    %ecx,%edx
+ 775:	89 c1                	mov    %eax,%ecx
+ 777:	39 f2                	cmp    %esi,%edx
+ 779:	73 df                	jae    75a <printint+0x2e>
+  if(neg)
+ 77b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 77f:	74 31                	je     7b2 <printint+0x86>
+    buf[i++] = '-';
+ 781:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 786:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 789:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 78c:	eb 17                	jmp    7a5 <printint+0x79>
+    x = xx;
+ 78e:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 790:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 797:	eb bc                	jmp    755 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 799:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 79e:	89 f0                	mov    %esi,%eax
+ 7a0:	e8 6d ff ff ff       	call   712 <putc>
+  while(--i >= 0)
+ 7a5:	83 eb 01             	sub    $0x1,%ebx
+ 7a8:	79 ef                	jns    799 <printint+0x6d>
+}
+ 7aa:	83 c4 2c             	add    $0x2c,%esp
+ 7ad:	5b                   	pop    %ebx
+ 7ae:	5e                   	pop    %esi
+ 7af:	5f                   	pop    %edi
+ 7b0:	5d                   	pop    %ebp
+ 7b1:	c3                   	ret
+ 7b2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 7b5:	eb ee                	jmp    7a5 <printint+0x79>
+
+000007b7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7b7:	55                   	push   %ebp
+ 7b8:	89 e5                	mov    %esp,%ebp
+ 7ba:	57                   	push   %edi
+ 7bb:	56                   	push   %esi
+ 7bc:	53                   	push   %ebx
+ 7bd:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 7c0:	8d 45 10             	lea    0x10(%ebp),%eax
+ 7c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 7c6:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 7cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 7d0:	eb 14                	jmp    7e6 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 7d2:	89 fa                	mov    %edi,%edx
+ 7d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d7:	e8 36 ff ff ff       	call   712 <putc>
+ 7dc:	eb 05                	jmp    7e3 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 7de:	83 fe 25             	cmp    $0x25,%esi
+ 7e1:	74 25                	je     808 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 7e3:	83 c3 01             	add    $0x1,%ebx
+ 7e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7e9:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 7ed:	84 c0                	test   %al,%al
+ 7ef:	0f 84 20 01 00 00    	je     915 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 7f5:	0f be f8             	movsbl %al,%edi
+ 7f8:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 7fb:	85 f6                	test   %esi,%esi
+ 7fd:	75 df                	jne    7de <printf+0x27>
+      if(c == '%'){
+ 7ff:	83 f8 25             	cmp    $0x25,%eax
+ 802:	75 ce                	jne    7d2 <printf+0x1b>
+        state = '%';
+ 804:	89 c6                	mov    %eax,%esi
+ 806:	eb db                	jmp    7e3 <printf+0x2c>
+      if(c == 'd'){
+ 808:	83 f8 25             	cmp    $0x25,%eax
+ 80b:	0f 84 cf 00 00 00    	je     8e0 <printf+0x129>
+ 811:	0f 8c dd 00 00 00    	jl     8f4 <printf+0x13d>
+ 817:	83 f8 78             	cmp    $0x78,%eax
+ 81a:	0f 8f d4 00 00 00    	jg     8f4 <printf+0x13d>
+ 820:	83 f8 63             	cmp    $0x63,%eax
+ 823:	0f 8c cb 00 00 00    	jl     8f4 <printf+0x13d>
+ 829:	83 e8 63             	sub    $0x63,%eax
+ 82c:	83 f8 15             	cmp    $0x15,%eax
+ 82f:	0f 87 bf 00 00 00    	ja     8f4 <printf+0x13d>
+ 835:	ff 24 85 cc 0a 00 00 	jmp    *0xacc(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 83c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 83f:	8b 17                	mov    (%edi),%edx
+ 841:	83 ec 0c             	sub    $0xc,%esp
+ 844:	6a 01                	push   $0x1
+ 846:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 84b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84e:	e8 d9 fe ff ff       	call   72c <printint>
+        ap++;
+ 853:	83 c7 04             	add    $0x4,%edi
+ 856:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 859:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 85c:	be 00 00 00 00       	mov    $0x0,%esi
+ 861:	eb 80                	jmp    7e3 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 863:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 866:	8b 17                	mov    (%edi),%edx
+ 868:	83 ec 0c             	sub    $0xc,%esp
+ 86b:	6a 00                	push   $0x0
+ 86d:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 872:	8b 45 08             	mov    0x8(%ebp),%eax
+ 875:	e8 b2 fe ff ff       	call   72c <printint>
+        ap++;
+ 87a:	83 c7 04             	add    $0x4,%edi
+ 87d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 880:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 883:	be 00 00 00 00       	mov    $0x0,%esi
+ 888:	e9 56 ff ff ff       	jmp    7e3 <printf+0x2c>
+        s = (char*)*ap;
+ 88d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 890:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 892:	83 c0 04             	add    $0x4,%eax
+ 895:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 898:	85 f6                	test   %esi,%esi
+ 89a:	75 15                	jne    8b1 <printf+0xfa>
+          s = "(null)";
+ 89c:	be c2 0a 00 00       	mov    $0xac2,%esi
+ 8a1:	eb 0e                	jmp    8b1 <printf+0xfa>
+          putc(fd, *s);
+ 8a3:	0f be d2             	movsbl %dl,%edx
+ 8a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a9:	e8 64 fe ff ff       	call   712 <putc>
+          s++;
+ 8ae:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 8b1:	0f b6 16             	movzbl (%esi),%edx
+ 8b4:	84 d2                	test   %dl,%dl
+ 8b6:	75 eb                	jne    8a3 <printf+0xec>
+      state = 0;
+ 8b8:	be 00 00 00 00       	mov    $0x0,%esi
+ 8bd:	e9 21 ff ff ff       	jmp    7e3 <printf+0x2c>
+        putc(fd, *ap);
+ 8c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 8c5:	0f be 17             	movsbl (%edi),%edx
+ 8c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8cb:	e8 42 fe ff ff       	call   712 <putc>
+        ap++;
+ 8d0:	83 c7 04             	add    $0x4,%edi
+ 8d3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 8d6:	be 00 00 00 00       	mov    $0x0,%esi
+ 8db:	e9 03 ff ff ff       	jmp    7e3 <printf+0x2c>
+        putc(fd, c);
+ 8e0:	89 fa                	mov    %edi,%edx
+ 8e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8e5:	e8 28 fe ff ff       	call   712 <putc>
+      state = 0;
+ 8ea:	be 00 00 00 00       	mov    $0x0,%esi
+ 8ef:	e9 ef fe ff ff       	jmp    7e3 <printf+0x2c>
+        putc(fd, '%');
+ 8f4:	ba 25 00 00 00       	mov    $0x25,%edx
+ 8f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8fc:	e8 11 fe ff ff       	call   712 <putc>
+        putc(fd, c);
+ 901:	89 fa                	mov    %edi,%edx
+ 903:	8b 45 08             	mov    0x8(%ebp),%eax
+ 906:	e8 07 fe ff ff       	call   712 <putc>
+      state = 0;
+ 90b:	be 00 00 00 00       	mov    $0x0,%esi
+ 910:	e9 ce fe ff ff       	jmp    7e3 <printf+0x2c>
+    }
+  }
+}
+ 915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 918:	5b                   	pop    %ebx
+ 919:	5e                   	pop    %esi
+ 91a:	5f                   	pop    %edi
+ 91b:	5d                   	pop    %ebp
+ 91c:	c3                   	ret
@@ -0,0 +1,148 @@
+// Scheduler micro-benchmarks.
+//
+//   schedbench ctx [nproc] [yields]
+//     nproc processes each yield() the CPU the given number of
+//     times; every yield is a dequeue plus a re-enqueue on the
+//     runqueue, so this measures the cost of a context switch.
+//
+//   schedbench fork [workers] [forks]
+//     workers processes each fork, exit and reap the given number
+//     of children.  Run under make qemu CPUS=1, 2, 4 and 8 to see
+//     how fork/exit throughput scales with the per-CPU runqueues.
+//
+//   schedbench io [hogs] [sleepers] [ticks]
+//     hogs CPU-bound processes spin while sleepers I/O-bound ones
+//     sleep for a tick and then run briefly, over and over, for the
+//     given number of ticks.  Each sleeper reports how many ticks
+//     late it got the CPU back (its wakeup latency) and each hog
+//     how much work it got done, showing both interactive latency
+//     and whether the hogs still share the CPU fairly.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+void
+ctxbench(int nproc, int yields)
+{
+  int i, j, start, elapsed;
+
+  start = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      for(j = 0; j < yields; j++)
+        yield();
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  elapsed = uptime() - start;
+
+  printf(1, "ctx: %d procs x %d yields in %d ticks", nproc, yields, elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d switches/tick)", nproc * yields / elapsed);
+  printf(1, "\n");
+}
+
+void
+forkbench(int workers, int forks)
+{
+  int i, j, pid, start, elapsed;
+
+  start = uptime();
+  for(i = 0; i < workers; i++){
+    if(fork() == 0){
+      for(j = 0; j < forks; j++){
+        pid = fork();
+        if(pid < 0){
+          printf(1, "fork: fork failed\n");
+          break;
+        }
+        if(pid == 0)
+          exit();
+        wait();
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < workers; i++)
+    wait();
+  elapsed = uptime() - start;
+
+  printf(1, "fork: %d workers x %d forks in %d ticks", workers, forks, elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d forks/tick)", workers * forks / elapsed);
+  printf(1, "\n");
+}
+
+// A little CPU work for the benchmarks to do.
+static void
+spin(int n)
+{
+  volatile int i;
+
+  for(i = 0; i < n; i++)
+    ;
+}
+
+void
+iobench(int hogs, int sleepers, int duration)
+{
+  int i, end, t, late, wakeups, total, max, work;
+
+  end = uptime() + duration;
+  for(i = 0; i < hogs; i++){
+    if(fork() == 0){
+      for(work = 0; uptime() < end; work++)
+        spin(10000);
+      printf(1, "io: hog %d did %d units of work\n", getpid(), work);
+      exit();
+    }
+  }
+  for(i = 0; i < sleepers; i++){
+    if(fork() == 0){
+      wakeups = total = max = 0;
+      while((t = uptime()) < end){
+        sleep(1);
+        // sleep(1) returns at tick t+1 at the earliest.
+        late = uptime() - t - 1;
+        if(late < 0)
+          late = 0;
+        wakeups++;
+        total += late;
+        if(late > max)
+          max = late;
+        spin(1000);
+      }
+      printf(1, "io: sleeper %d woke %d times, %d ticks late in total, "
+             "%d at most\n", getpid(), wakeups, total, max);
+      exit();
+    }
+  }
+  for(i = 0; i < hogs + sleepers; i++)
+    wait();
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc < 2){
+    printf(2, "usage: schedbench ctx [nproc] [yields]\n");
+    printf(2, "       schedbench fork [workers] [forks]\n");
+    printf(2, "       schedbench io [hogs] [sleepers] [ticks]\n");
+    exit();
+  }
+
+  if(strcmp(argv[1], "ctx") == 0){
+    ctxbench(argc > 2 ? atoi(argv[2]) : 4, argc > 3 ? atoi(argv[3]) : 1000);
+  } else if(strcmp(argv[1], "fork") == 0){
+    forkbench(argc > 2 ? atoi(argv[2]) : 4, argc > 3 ? atoi(argv[3]) : 200);
+  } else if(strcmp(argv[1], "io") == 0){
+    iobench(argc > 2 ? atoi(argv[2]) : 3, argc > 3 ? atoi(argv[3]) : 3,
+            argc > 4 ? atoi(argv[4]) : 1000);
+  } else {
+    printf(2, "schedbench: unknown benchmark %s\n", argv[1]);
+  }
+  exit();
+}
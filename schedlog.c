@@ -0,0 +1,111 @@
+// Scheduler trace.
+//
+// While schedlog(n) is active the scheduler records a fixed-size
+// binary event per scheduling decision into a ring owned by the
+// current CPU.  Recording costs a few stores under an uncontended
+// per-CPU lock, so tracing does not perturb the schedule it is
+// measuring the way printing to the console did.  User programs
+// drain the rings with the schedlogread system call and format
+// the events themselves.
+//
+// When a ring is full the oldest event is overwritten.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sched.h"
+
+struct {
+  struct spinlock lock;
+  uint head;                   // next event to read
+  uint tail;                   // next slot to write
+  struct schedevent ev[NSCHEDLOG];
+} schedlogs[NCPU];
+
+int schedlog_active = 0;
+uint64 schedlog_lasttick = 0;
+
+void
+schedloginit(void)
+{
+  int i;
+
+  for(i = 0; i < NCPU; i++)
+    initlock(&schedlogs[i].lock, "schedlog");
+}
+
+// Trace scheduler events for the next n ticks.
+void
+schedlog(int n)
+{
+  schedlog_lasttick = readticks64() + n;
+  schedlog_active = 1;
+}
+
+// Record an event of the given type for p on this CPU's ring.
+void
+schedlog_event(int type, struct proc *p)
+{
+  struct schedevent *e;
+  uint64 now;
+  int id;
+
+  if(!schedlog_active)
+    return;
+  now = readticks64();
+  if(now > schedlog_lasttick){
+    schedlog_active = 0;
+    return;
+  }
+
+  pushcli();
+  id = cpuid();
+  acquire(&schedlogs[id].lock);
+  if(schedlogs[id].tail - schedlogs[id].head == NSCHEDLOG)
+    schedlogs[id].head++;
+  e = &schedlogs[id].ev[schedlogs[id].tail++ % NSCHEDLOG];
+  e->tick = now;
+  e->cpu = id;
+  e->type = type;
+  e->nice = p->nice_value;
+  e->pid = p->pid;
+  e->virtual_deadline = p->virtual_deadline;
+  e->ticks_left = p->ticks_left;
+  release(&schedlogs[id].lock);
+  popcli();
+}
+
+// Move up to n of the oldest recorded events into buf, merging the
+// per-CPU rings by tick.  Returns the number of events copied.
+int
+schedlogread(struct schedevent *buf, int n)
+{
+  int i, best, copied;
+
+  for(i = 0; i < ncpu; i++)
+    acquire(&schedlogs[i].lock);
+
+  for(copied = 0; copied < n; copied++){
+    best = -1;
+    for(i = 0; i < ncpu; i++){
+      if(schedlogs[i].head == schedlogs[i].tail)
+        continue;
+      if(best < 0 ||
+         schedlogs[i].ev[schedlogs[i].head % NSCHEDLOG].tick <
+         schedlogs[best].ev[schedlogs[best].head % NSCHEDLOG].tick)
+        best = i;
+    }
+    if(best < 0)
+      break;
+    buf[copied] = schedlogs[best].ev[schedlogs[best].head++ % NSCHEDLOG];
+  }
+
+  for(i = ncpu - 1; i >= 0; i--)
+    release(&schedlogs[i].lock);
+  return copied;
+}
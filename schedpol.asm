@@ -0,0 +1,920 @@
+
+_schedpol:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+[SCHEDPOL_RR]   "rr",
+};
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i, old;
+
+  for(i = 0; i < sizeof(policies)/sizeof(policies[0]); i++)
+  19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  1e:	eb 03                	jmp    23 <main+0x23>
+  20:	83 c3 01             	add    $0x1,%ebx
+  23:	83 fb 01             	cmp    $0x1,%ebx
+  26:	77 1e                	ja     46 <main+0x46>
+    if(argc >= 2 && strcmp(argv[1], policies[i]) == 0)
+  28:	83 fe 01             	cmp    $0x1,%esi
+  2b:	7e f3                	jle    20 <main+0x20>
+  2d:	83 ec 08             	sub    $0x8,%esp
+  30:	ff 34 9d 24 06 00 00 	push   0x624(,%ebx,4)
+  37:	ff 77 04             	push   0x4(%edi)
+  3a:	e8 e1 00 00 00       	call   120 <strcmp>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	85 c0                	test   %eax,%eax
+  44:	75 da                	jne    20 <main+0x20>
+      break;
+  if(i == sizeof(policies)/sizeof(policies[0]) || argc > 3 ||
+  46:	83 fb 02             	cmp    $0x2,%ebx
+  49:	0f 94 c0             	sete   %al
+  4c:	83 fe 03             	cmp    $0x3,%esi
+  4f:	0f 9f c2             	setg   %dl
+  52:	08 d0                	or     %dl,%al
+  54:	75 0f                	jne    65 <main+0x65>
+     (argc == 3 && i != SCHEDPOL_BFS)){
+  56:	83 fe 03             	cmp    $0x3,%esi
+  59:	0f 94 c2             	sete   %dl
+  5c:	85 db                	test   %ebx,%ebx
+  5e:	0f 95 c0             	setne  %al
+  if(i == sizeof(policies)/sizeof(policies[0]) || argc > 3 ||
+  61:	84 c2                	test   %al,%dl
+  63:	74 14                	je     79 <main+0x79>
+    printf(2, "usage: schedpol bfs [window] | rr\n");
+  65:	83 ec 08             	sub    $0x8,%esp
+  68:	68 b4 05 00 00       	push   $0x5b4
+  6d:	6a 02                	push   $0x2
+  6f:	e8 da 03 00 00       	call   44e <printf>
+    exit();
+  74:	e8 20 02 00 00       	call   299 <exit>
+  }
+  if((old = setpolicy(i)) < 0){
+  79:	83 ec 0c             	sub    $0xc,%esp
+  7c:	53                   	push   %ebx
+  7d:	e8 ef 02 00 00       	call   371 <setpolicy>
+  82:	83 c4 10             	add    $0x10,%esp
+  85:	85 c0                	test   %eax,%eax
+  87:	78 27                	js     b0 <main+0xb0>
+    printf(2, "schedpol: cannot switch to %s\n", argv[1]);
+    exit();
+  }
+  printf(1, "%s -> %s\n", policies[old], policies[i]);
+  89:	ff 34 9d 24 06 00 00 	push   0x624(,%ebx,4)
+  90:	ff 34 85 24 06 00 00 	push   0x624(,%eax,4)
+  97:	68 f7 05 00 00       	push   $0x5f7
+  9c:	6a 01                	push   $0x1
+  9e:	e8 ab 03 00 00       	call   44e <printf>
+  if(argc == 3){
+  a3:	83 c4 10             	add    $0x10,%esp
+  a6:	83 fe 03             	cmp    $0x3,%esi
+  a9:	74 1c                	je     c7 <main+0xc7>
+    old = affinity(atoi(argv[2]));
+    printf(1, "affinity window %d -> %d\n", old, atoi(argv[2]));
+  }
+  exit();
+  ab:	e8 e9 01 00 00       	call   299 <exit>
+    printf(2, "schedpol: cannot switch to %s\n", argv[1]);
+  b0:	83 ec 04             	sub    $0x4,%esp
+  b3:	ff 77 04             	push   0x4(%edi)
+  b6:	68 d8 05 00 00       	push   $0x5d8
+  bb:	6a 02                	push   $0x2
+  bd:	e8 8c 03 00 00       	call   44e <printf>
+    exit();
+  c2:	e8 d2 01 00 00       	call   299 <exit>
+    old = affinity(atoi(argv[2]));
+  c7:	83 ec 0c             	sub    $0xc,%esp
+  ca:	ff 77 08             	push   0x8(%edi)
+  cd:	e8 63 01 00 00       	call   235 <atoi>
+  d2:	89 04 24             	mov    %eax,(%esp)
+  d5:	e8 9f 02 00 00       	call   379 <affinity>
+  da:	89 c3                	mov    %eax,%ebx
+    printf(1, "affinity window %d -> %d\n", old, atoi(argv[2]));
+  dc:	83 c4 04             	add    $0x4,%esp
+  df:	ff 77 08             	push   0x8(%edi)
+  e2:	e8 4e 01 00 00       	call   235 <atoi>
+  e7:	50                   	push   %eax
+  e8:	53                   	push   %ebx
+  e9:	68 01 06 00 00       	push   $0x601
+  ee:	6a 01                	push   $0x1
+  f0:	e8 59 03 00 00       	call   44e <printf>
+  f5:	83 c4 20             	add    $0x20,%esp
+  f8:	eb b1                	jmp    ab <main+0xab>
+
+000000fa <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	56                   	push   %esi
+  fe:	53                   	push   %ebx
+  ff:	8b 75 08             	mov    0x8(%ebp),%esi
+ 102:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 105:	89 f0                	mov    %esi,%eax
+ 107:	89 d1                	mov    %edx,%ecx
+ 109:	83 c2 01             	add    $0x1,%edx
+ 10c:	89 c3                	mov    %eax,%ebx
+ 10e:	83 c0 01             	add    $0x1,%eax
+ 111:	0f b6 09             	movzbl (%ecx),%ecx
+ 114:	88 0b                	mov    %cl,(%ebx)
+ 116:	84 c9                	test   %cl,%cl
+ 118:	75 ed                	jne    107 <strcpy+0xd>
+    ;
+  return os;
+}
+ 11a:	89 f0                	mov    %esi,%eax
+ 11c:	5b                   	pop    %ebx
+ 11d:	5e                   	pop    %esi
+ 11e:	5d                   	pop    %ebp
+ 11f:	c3                   	ret
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 126:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 129:	eb 06                	jmp    131 <strcmp+0x11>
+    p++, q++;
+ 12b:	83 c1 01             	add    $0x1,%ecx
+ 12e:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 131:	0f b6 01             	movzbl (%ecx),%eax
+ 134:	84 c0                	test   %al,%al
+ 136:	74 04                	je     13c <strcmp+0x1c>
+ 138:	3a 02                	cmp    (%edx),%al
+ 13a:	74 ef                	je     12b <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 13c:	0f b6 c0             	movzbl %al,%eax
+ 13f:	0f b6 12             	movzbl (%edx),%edx
+ 142:	29 d0                	sub    %edx,%eax
+}
+ 144:	5d                   	pop    %ebp
+ 145:	c3                   	ret
+
+00000146 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 146:	55                   	push   %ebp
+ 147:	89 e5                	mov    %esp,%ebp
+ 149:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 14c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 151:	eb 03                	jmp    156 <strlen+0x10>
+ 153:	83 c0 01             	add    $0x1,%eax
+ 156:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 15a:	75 f7                	jne    153 <strlen+0xd>
+    ;
+  return n;
+}
+ 15c:	5d                   	pop    %ebp
+ 15d:	c3                   	ret
+
+0000015e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 15e:	55                   	push   %ebp
+ 15f:	89 e5                	mov    %esp,%ebp
+ 161:	57                   	push   %edi
+ 162:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 165:	89 d7                	mov    %edx,%edi
+ 167:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 16a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16d:	fc                   	cld
+ 16e:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 170:	89 d0                	mov    %edx,%eax
+ 172:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 175:	c9                   	leave
+ 176:	c3                   	ret
+
+00000177 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 177:	55                   	push   %ebp
+ 178:	89 e5                	mov    %esp,%ebp
+ 17a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 181:	eb 03                	jmp    186 <strchr+0xf>
+ 183:	83 c0 01             	add    $0x1,%eax
+ 186:	0f b6 10             	movzbl (%eax),%edx
+ 189:	84 d2                	test   %dl,%dl
+ 18b:	74 06                	je     193 <strchr+0x1c>
+    if(*s == c)
+ 18d:	38 ca                	cmp    %cl,%dl
+ 18f:	75 f2                	jne    183 <strchr+0xc>
+ 191:	eb 05                	jmp    198 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 193:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 198:	5d                   	pop    %ebp
+ 199:	c3                   	ret
+
+0000019a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 19a:	55                   	push   %ebp
+ 19b:	89 e5                	mov    %esp,%ebp
+ 19d:	57                   	push   %edi
+ 19e:	56                   	push   %esi
+ 19f:	53                   	push   %ebx
+ 1a0:	83 ec 1c             	sub    $0x1c,%esp
+ 1a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1ab:	89 de                	mov    %ebx,%esi
+ 1ad:	83 c3 01             	add    $0x1,%ebx
+ 1b0:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1b3:	7d 2e                	jge    1e3 <gets+0x49>
+    cc = read(0, &c, 1);
+ 1b5:	83 ec 04             	sub    $0x4,%esp
+ 1b8:	6a 01                	push   $0x1
+ 1ba:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1bd:	50                   	push   %eax
+ 1be:	6a 00                	push   $0x0
+ 1c0:	e8 ec 00 00 00       	call   2b1 <read>
+    if(cc < 1)
+ 1c5:	83 c4 10             	add    $0x10,%esp
+ 1c8:	85 c0                	test   %eax,%eax
+ 1ca:	7e 17                	jle    1e3 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1cc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1d0:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1d3:	3c 0a                	cmp    $0xa,%al
+ 1d5:	0f 94 c2             	sete   %dl
+ 1d8:	3c 0d                	cmp    $0xd,%al
+ 1da:	0f 94 c0             	sete   %al
+ 1dd:	08 c2                	or     %al,%dl
+ 1df:	74 ca                	je     1ab <gets+0x11>
+    buf[i++] = c;
+ 1e1:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1e7:	89 f8                	mov    %edi,%eax
+ 1e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ec:	5b                   	pop    %ebx
+ 1ed:	5e                   	pop    %esi
+ 1ee:	5f                   	pop    %edi
+ 1ef:	5d                   	pop    %ebp
+ 1f0:	c3                   	ret
+
+000001f1 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	56                   	push   %esi
+ 1f5:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f6:	83 ec 08             	sub    $0x8,%esp
+ 1f9:	6a 00                	push   $0x0
+ 1fb:	ff 75 08             	push   0x8(%ebp)
+ 1fe:	e8 d6 00 00 00       	call   2d9 <open>
+  if(fd < 0)
+ 203:	83 c4 10             	add    $0x10,%esp
+ 206:	85 c0                	test   %eax,%eax
+ 208:	78 24                	js     22e <stat+0x3d>
+ 20a:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 20c:	83 ec 08             	sub    $0x8,%esp
+ 20f:	ff 75 0c             	push   0xc(%ebp)
+ 212:	50                   	push   %eax
+ 213:	e8 d9 00 00 00       	call   2f1 <fstat>
+ 218:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21a:	89 1c 24             	mov    %ebx,(%esp)
+ 21d:	e8 9f 00 00 00       	call   2c1 <close>
+  return r;
+ 222:	83 c4 10             	add    $0x10,%esp
+}
+ 225:	89 f0                	mov    %esi,%eax
+ 227:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 22a:	5b                   	pop    %ebx
+ 22b:	5e                   	pop    %esi
+ 22c:	5d                   	pop    %ebp
+ 22d:	c3                   	ret
+    return -1;
+ 22e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 233:	eb f0                	jmp    225 <stat+0x34>
+
+00000235 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 235:	55                   	push   %ebp
+ 236:	89 e5                	mov    %esp,%ebp
+ 238:	53                   	push   %ebx
+ 239:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 23c:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 241:	eb 10                	jmp    253 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 243:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 246:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 249:	83 c1 01             	add    $0x1,%ecx
+ 24c:	0f be c0             	movsbl %al,%eax
+ 24f:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 253:	0f b6 01             	movzbl (%ecx),%eax
+ 256:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 259:	80 fb 09             	cmp    $0x9,%bl
+ 25c:	76 e5                	jbe    243 <atoi+0xe>
+  return n;
+}
+ 25e:	89 d0                	mov    %edx,%eax
+ 260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 263:	c9                   	leave
+ 264:	c3                   	ret
+
+00000265 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 265:	55                   	push   %ebp
+ 266:	89 e5                	mov    %esp,%ebp
+ 268:	56                   	push   %esi
+ 269:	53                   	push   %ebx
+ 26a:	8b 75 08             	mov    0x8(%ebp),%esi
+ 26d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 270:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 273:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 275:	eb 0d                	jmp    284 <memmove+0x1f>
+    *dst++ = *src++;
+ 277:	0f b6 01             	movzbl (%ecx),%eax
+ 27a:	88 02                	mov    %al,(%edx)
+ 27c:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 27f:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 282:	89 d8                	mov    %ebx,%eax
+ 284:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 287:	85 c0                	test   %eax,%eax
+ 289:	7f ec                	jg     277 <memmove+0x12>
+  return vdst;
+}
+ 28b:	89 f0                	mov    %esi,%eax
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5d                   	pop    %ebp
+ 290:	c3                   	ret
+
+00000291 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 291:	b8 01 00 00 00       	mov    $0x1,%eax
+ 296:	cd 40                	int    $0x40
+ 298:	c3                   	ret
+
+00000299 <exit>:
+SYSCALL(exit)
+ 299:	b8 02 00 00 00       	mov    $0x2,%eax
+ 29e:	cd 40                	int    $0x40
+ 2a0:	c3                   	ret
+
+000002a1 <wait>:
+SYSCALL(wait)
+ 2a1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2a6:	cd 40                	int    $0x40
+ 2a8:	c3                   	ret
+
+000002a9 <pipe>:
+SYSCALL(pipe)
+ 2a9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2ae:	cd 40                	int    $0x40
+ 2b0:	c3                   	ret
+
+000002b1 <read>:
+SYSCALL(read)
+ 2b1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2b6:	cd 40                	int    $0x40
+ 2b8:	c3                   	ret
+
+000002b9 <write>:
+SYSCALL(write)
+ 2b9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2be:	cd 40                	int    $0x40
+ 2c0:	c3                   	ret
+
+000002c1 <close>:
+SYSCALL(close)
+ 2c1:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2c6:	cd 40                	int    $0x40
+ 2c8:	c3                   	ret
+
+000002c9 <kill>:
+SYSCALL(kill)
+ 2c9:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2ce:	cd 40                	int    $0x40
+ 2d0:	c3                   	ret
+
+000002d1 <exec>:
+SYSCALL(exec)
+ 2d1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2d6:	cd 40                	int    $0x40
+ 2d8:	c3                   	ret
+
+000002d9 <open>:
+SYSCALL(open)
+ 2d9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2de:	cd 40                	int    $0x40
+ 2e0:	c3                   	ret
+
+000002e1 <mknod>:
+SYSCALL(mknod)
+ 2e1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2e6:	cd 40                	int    $0x40
+ 2e8:	c3                   	ret
+
+000002e9 <unlink>:
+SYSCALL(unlink)
+ 2e9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <fstat>:
+SYSCALL(fstat)
+ 2f1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <link>:
+SYSCALL(link)
+ 2f9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <mkdir>:
+SYSCALL(mkdir)
+ 301:	b8 14 00 00 00       	mov    $0x14,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <chdir>:
+SYSCALL(chdir)
+ 309:	b8 09 00 00 00       	mov    $0x9,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <dup>:
+SYSCALL(dup)
+ 311:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <getpid>:
+SYSCALL(getpid)
+ 319:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <sbrk>:
+SYSCALL(sbrk)
+ 321:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <sleep>:
+SYSCALL(sleep)
+ 329:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <uptime>:
+SYSCALL(uptime)
+ 331:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <yield>:
+SYSCALL(yield)
+ 339:	b8 16 00 00 00       	mov    $0x16,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <shutdown>:
+SYSCALL(shutdown)
+ 341:	b8 17 00 00 00       	mov    $0x17,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <nicefork>:
+SYSCALL(nicefork)
+ 349:	b8 18 00 00 00       	mov    $0x18,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <schedlog>:
+SYSCALL(schedlog)
+ 351:	b8 19 00 00 00       	mov    $0x19,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <schedlogread>:
+SYSCALL(schedlogread)
+ 359:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <tracectl>:
+SYSCALL(tracectl)
+ 361:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <getcpustat>:
+SYSCALL(getcpustat)
+ 369:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <setpolicy>:
+SYSCALL(setpolicy)
+ 371:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <affinity>:
+SYSCALL(affinity)
+ 379:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <setnice>:
+SYSCALL(setnice)
+ 381:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <getnice>:
+SYSCALL(getnice)
+ 389:	b8 20 00 00 00       	mov    $0x20,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <setclass>:
+SYSCALL(setclass)
+ 391:	b8 21 00 00 00       	mov    $0x21,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <isocpu>:
+SYSCALL(isocpu)
+ 399:	b8 22 00 00 00       	mov    $0x22,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <getschedstats>:
+SYSCALL(getschedstats)
+ 3a1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3a9:	55                   	push   %ebp
+ 3aa:	89 e5                	mov    %esp,%ebp
+ 3ac:	83 ec 1c             	sub    $0x1c,%esp
+ 3af:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3b2:	6a 01                	push   $0x1
+ 3b4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3b7:	52                   	push   %edx
+ 3b8:	50                   	push   %eax
+ 3b9:	e8 fb fe ff ff       	call   2b9 <write>
+}
+ 3be:	83 c4 10             	add    $0x10,%esp
+ 3c1:	c9                   	leave
+ 3c2:	c3                   	ret
+
+000003c3 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c3:	55                   	push   %ebp
+ 3c4:	89 e5                	mov    %esp,%ebp
+ 3c6:	57                   	push   %edi
+ 3c7:	56                   	push   %esi
+ 3c8:	53                   	push   %ebx
+ 3c9:	83 ec 2c             	sub    $0x2c,%esp
+ 3cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3cf:	89 d0                	mov    %edx,%eax
+ 3d1:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3d3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3d7:	0f 95 c1             	setne  %cl
+ 3da:	c1 ea 1f             	shr    $0x1f,%edx
+ 3dd:	84 d1                	test   %dl,%cl
+ 3df:	74 44                	je     425 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3e1:	f7 d8                	neg    %eax
+ 3e3:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3e5:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3f1:	89 c8                	mov    %ecx,%eax
+ 3f3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3f8:	f7 f6                	div    %esi
+ 3fa:	89 df                	mov    %ebx,%edi
+ 3fc:	83 c3 01             	add    $0x1,%ebx
+ 3ff:	0f b6 92 8c 06 00 00 	movzbl 0x68c(%edx),%edx
+ 406:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 40a:	89 ca                	mov    %ecx,%edx
+ 40c:	89 c1                	mov    %eax,%ecx
+ 40e:	39 f2                	cmp    %esi,%edx
+ 410:	73 df                	jae    3f1 <printint+0x2e>
+  if(neg)
+ 412:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 416:	74 31                	je     449 <printint+0x86>
+    buf[i++] = '-';
+ 418:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 41d:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 420:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 423:	eb 17                	jmp    43c <printint+0x79>
+    x = xx;
+ 425:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 427:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 42e:	eb bc                	jmp    3ec <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 430:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 435:	89 f0                	mov    %esi,%eax
+ 437:	e8 6d ff ff ff       	call   3a9 <putc>
+  while(--i >= 0)
+ 43c:	83 eb 01             	sub    $0x1,%ebx
+ 43f:	79 ef                	jns    430 <printint+0x6d>
+}
+ 441:	83 c4 2c             	add    $0x2c,%esp
+ 444:	5b                   	pop    %ebx
+ 445:	5e                   	pop    %esi
+ 446:	5f                   	pop    %edi
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 44c:	eb ee                	jmp    43c <printint+0x79>
+
+0000044e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 44e:	55                   	push   %ebp
+ 44f:	89 e5                	mov    %esp,%ebp
+ 451:	57                   	push   %edi
+ 452:	56                   	push   %esi
+ 453:	53                   	push   %ebx
+ 454:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 457:	8d 45 10             	lea    0x10(%ebp),%eax
+ 45a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 45d:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 462:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 467:	eb 14                	jmp    47d <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 469:	89 fa                	mov    %edi,%edx
+ 46b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46e:	e8 36 ff ff ff       	call   3a9 <putc>
+ 473:	eb 05                	jmp    47a <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 475:	83 fe 25             	cmp    $0x25,%esi
+ 478:	74 25                	je     49f <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 47a:	83 c3 01             	add    $0x1,%ebx
+ 47d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 480:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 484:	84 c0                	test   %al,%al
+ 486:	0f 84 20 01 00 00    	je     5ac <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 48c:	0f be f8             	movsbl %al,%edi
+ 48f:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 492:	85 f6                	test   %esi,%esi
+ 494:	75 df                	jne    475 <printf+0x27>
+      if(c == '%'){
+ 496:	83 f8 25             	cmp    $0x25,%eax
+ 499:	75 ce                	jne    469 <printf+0x1b>
+        state = '%';
+ 49b:	89 c6                	mov    %eax,%esi
+ 49d:	eb db                	jmp    47a <printf+0x2c>
+      if(c == 'd'){
+ 49f:	83 f8 25             	cmp    $0x25,%eax
+ 4a2:	0f 84 cf 00 00 00    	je     577 <printf+0x129>
+ 4a8:	0f 8c dd 00 00 00    	jl     58b <printf+0x13d>
+ 4ae:	83 f8 78             	cmp    $0x78,%eax
+ 4b1:	0f 8f d4 00 00 00    	jg     58b <printf+0x13d>
+ 4b7:	83 f8 63             	cmp    $0x63,%eax
+ 4ba:	0f 8c cb 00 00 00    	jl     58b <printf+0x13d>
+ 4c0:	83 e8 63             	sub    $0x63,%eax
+ 4c3:	83 f8 15             	cmp    $0x15,%eax
+ 4c6:	0f 87 bf 00 00 00    	ja     58b <printf+0x13d>
+ 4cc:	ff 24 85 34 06 00 00 	jmp    *0x634(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4d6:	8b 17                	mov    (%edi),%edx
+ 4d8:	83 ec 0c             	sub    $0xc,%esp
+ 4db:	6a 01                	push   $0x1
+ 4dd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e5:	e8 d9 fe ff ff       	call   3c3 <printint>
+        ap++;
+ 4ea:	83 c7 04             	add    $0x4,%edi
+ 4ed:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4f0:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4f3:	be 00 00 00 00       	mov    $0x0,%esi
+ 4f8:	eb 80                	jmp    47a <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 4fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4fd:	8b 17                	mov    (%edi),%edx
+ 4ff:	83 ec 0c             	sub    $0xc,%esp
+ 502:	6a 00                	push   $0x0
+ 504:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 509:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50c:	e8 b2 fe ff ff       	call   3c3 <printint>
+        ap++;
+ 511:	83 c7 04             	add    $0x4,%edi
+ 514:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 517:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 51a:	be 00 00 00 00       	mov    $0x0,%esi
+ 51f:	e9 56 ff ff ff       	jmp    47a <printf+0x2c>
+        s = (char*)*ap;
+ 524:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 527:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 529:	83 c0 04             	add    $0x4,%eax
+ 52c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 52f:	85 f6                	test   %esi,%esi
+ 531:	75 15                	jne    548 <printf+0xfa>
+          s = "(null)";
+ 533:	be 2c 06 00 00       	mov    $0x62c,%esi
+ 538:	eb 0e                	jmp    548 <printf+0xfa>
+          putc(fd, *s);
+ 53a:	0f be d2             	movsbl %dl,%edx
+ 53d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 540:	e8 64 fe ff ff       	call   3a9 <putc>
+          s++;
+ 545:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 548:	0f b6 16             	movzbl (%esi),%edx
+ 54b:	84 d2                	test   %dl,%dl
+ 54d:	75 eb                	jne    53a <printf+0xec>
+      state = 0;
+ 54f:	be 00 00 00 00       	mov    $0x0,%esi
+ 554:	e9 21 ff ff ff       	jmp    47a <printf+0x2c>
+        putc(fd, *ap);
+ 559:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 55c:	0f be 17             	movsbl (%edi),%edx
+ 55f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 562:	e8 42 fe ff ff       	call   3a9 <putc>
+        ap++;
+ 567:	83 c7 04             	add    $0x4,%edi
+ 56a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 56d:	be 00 00 00 00       	mov    $0x0,%esi
+ 572:	e9 03 ff ff ff       	jmp    47a <printf+0x2c>
+        putc(fd, c);
+ 577:	89 fa                	mov    %edi,%edx
+ 579:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57c:	e8 28 fe ff ff       	call   3a9 <putc>
+      state = 0;
+ 581:	be 00 00 00 00       	mov    $0x0,%esi
+ 586:	e9 ef fe ff ff       	jmp    47a <printf+0x2c>
+        putc(fd, '%');
+ 58b:	ba 25 00 00 00       	mov    $0x25,%edx
+ 590:	8b 45 08             	mov    0x8(%ebp),%eax
+ 593:	e8 11 fe ff ff       	call   3a9 <putc>
+        putc(fd, c);
+ 598:	89 fa                	mov    %edi,%edx
+ 59a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59d:	e8 07 fe ff ff       	call   3a9 <putc>
+      state = 0;
+ 5a2:	be 00 00 00 00       	mov    $0x0,%esi
+ 5a7:	e9 ce fe ff ff       	jmp    47a <printf+0x2c>
+    }
+  }
+}
+ 5ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5af:	5b                   	pop    %ebx
+ 5b0:	5e                   	pop    %esi
+ 5b1:	5f                   	pop    %edi
+ 5b2:	5d                   	pop    %ebp
+ 5b3:	c3                   	ret
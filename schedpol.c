@@ -0,0 +1,42 @@
+// Switch the scheduling policy, e.g. to compare one workload
+// under both:
+//
+//   schedpol rr; schedbench ctx; schedpol bfs; schedbench ctx
+//
+// For bfs, an optional second argument sets the affinity window
+// in ticks (see affinity()); 0 means strict deadline order.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sched.h"
+
+static char *policies[] = {
+[SCHEDPOL_BFS]  "bfs",
+[SCHEDPOL_RR]   "rr",
+};
+
+int
+main(int argc, char *argv[])
+{
+  int i, old;
+
+  for(i = 0; i < sizeof(policies)/sizeof(policies[0]); i++)
+    if(argc >= 2 && strcmp(argv[1], policies[i]) == 0)
+      break;
+  if(i == sizeof(policies)/sizeof(policies[0]) || argc > 3 ||
+     (argc == 3 && i != SCHEDPOL_BFS)){
+    printf(2, "usage: schedpol bfs [window] | rr\n");
+    exit();
+  }
+  if((old = setpolicy(i)) < 0){
+    printf(2, "schedpol: cannot switch to %s\n", argv[1]);
+    exit();
+  }
+  printf(1, "%s -> %s\n", policies[old], policies[i]);
+  if(argc == 3){
+    old = affinity(atoi(argv[2]));
+    printf(1, "affinity window %d -> %d\n", old, atoi(argv[2]));
+  }
+  exit();
+}
@@ -0,0 +1,335 @@
+// Deterministic host-side BFS scheduler simulator.
+//
+//   make schedsim && ./schedsim [-c ncpu] [-t ticks] [-w window] [workload]
+//
+// Replays a workload through the kernel's own BFS rules (bfs.c) and
+// runqueue (skiplist.c) one timer tick at a time, and reports each
+// process's CPU share, wait latency percentiles, context switches and
+// migrations.  The dispatch loop mirrors scheduler() in proc.c:
+// per-CPU runqueues chosen between by bfs_select_rq() within the
+// affinity window (-w, default BFS_AFFINITY_WINDOW), and a quantum of
+// BFS_DEFAULT_QUANTUM ticks that is refilled, with a new deadline,
+// only when it runs out.  A tick is one cycle of the simulated TSC.  A process that sleeps keeps what is left
+// of its quantum and its deadline, and on waking up preempts the
+// process running on its CPU if that one's deadline is later, or
+// else the latest running deadline if it is more than the affinity
+// window later.
+//
+// A workload file describes one process per line:
+//
+//   name nice burst sleep count
+//
+// The process runs for burst ticks, then sleeps for sleep ticks, count
+// times over (0 means until the simulation ends).  Blank lines and
+// lines starting with # are ignored.  Without a file, the workload of
+// test.c is used: three CPU-bound loops at nice -5, 0 and 5.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "types.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "skiplist.h"
+
+#define MAXSIMPROC 4096
+
+// Kernel interfaces used by skiplist.c and bfs.c.
+void cprintf(char *fmt, ...) { }
+void initlock(struct spinlock *lk, char *name) { }
+uint ticks;
+uint64 readticks64(void) { return ticks; }
+void bfs_refill(struct proc*, uint);
+void bfs_renew_deadline(struct proc*);
+struct skiplist *bfs_select_rq(struct skiplist*, int, int, int);
+int bfs_steals(uint64, uint64, int);
+
+struct simproc {
+  struct proc p;
+  int burst;            // CPU ticks per burst
+  int sleep;            // ticks asleep between bursts
+  int count;            // bursts to run, 0 for unlimited
+  int left;             // ticks left in the current burst
+  int bursts;           // bursts completed
+  int wake;             // tick to wake up at while SLEEPING
+  int since;            // tick it last became RUNNABLE
+  int runtime;          // ticks spent running
+  int dispatches;
+  int nvcsw;            // voluntary context switches (sleep, exit)
+  int nivcsw;           // involuntary context switches (quantum expiry)
+  int migrations;       // dispatches on a CPU other than the last one
+  int *lat;             // wait latency samples, in ticks
+  int nlat;
+  int caplat;
+};
+
+struct simproc procs[MAXSIMPROC];
+int nprocs;
+
+struct skiplist runqueues[NCPU];
+struct simproc *running[NCPU];
+int idle[NCPU];
+int ncpu = 1;
+int window = BFS_AFFINITY_WINDOW;
+
+// Same as bfs_enqueue() in proc.c.
+static void
+enqueue(struct simproc *sp)
+{
+  bfs_renew_deadline(&sp->p);
+  sp->p.state = RUNNABLE;
+  sp->since = ticks;
+  insert_node(&runqueues[sp->p.cpu], &sp->p);
+}
+
+// Same as rq_pop() in proc.c.
+static struct simproc*
+dequeue(int c)
+{
+  struct skiplist *best;
+  struct proc *p;
+
+  best = bfs_select_rq(runqueues, ncpu, c, window);
+  if(best == 0 || (p = pop_min(best)) == 0)
+    return 0;
+  return (struct simproc*)p;
+}
+
+// Same as bfs_preempt() and preempt_for() in proc.c, for the
+// normal class.
+static void
+preempt_for(struct simproc *sp)
+{
+  int i, c = sp->p.cpu;
+  struct simproc *r = running[c];
+
+  if(r == 0)
+    return;
+  if(sp->p.virtual_deadline >= r->p.virtual_deadline){
+    r = 0;
+    for(i = 0; i < ncpu; i++)
+      if(running[i] != 0 && sp->p.virtual_deadline < running[i]->p.virtual_deadline &&
+         (r == 0 || running[i]->p.virtual_deadline > r->p.virtual_deadline)){
+        r = running[i];
+        c = i;
+      }
+    if(r == 0 || !bfs_steals(sp->p.virtual_deadline, r->p.virtual_deadline, window))
+      return;
+  }
+  r->nivcsw++;
+  running[c] = 0;
+  enqueue(r);
+}
+
+static void
+addlatency(struct simproc *sp, int t)
+{
+  if(sp->nlat == sp->caplat){
+    sp->caplat = sp->caplat ? 2 * sp->caplat : 64;
+    sp->lat = realloc(sp->lat, sp->caplat * sizeof(int));
+    if(sp->lat == 0){
+      fprintf(stderr, "schedsim: out of memory\n");
+      exit(1);
+    }
+  }
+  sp->lat[sp->nlat++] = t;
+}
+
+static int
+cmpint(const void *a, const void *b)
+{
+  return *(const int*)a - *(const int*)b;
+}
+
+static int
+percentile(struct simproc *sp, int pct)
+{
+  if(sp->nlat == 0)
+    return 0;
+  return sp->lat[(sp->nlat - 1) * pct / 100];
+}
+
+static void
+addproc(char *name, int nice, int burst, int sleep, int count)
+{
+  struct simproc *sp;
+
+  if(nprocs == MAXSIMPROC){
+    fprintf(stderr, "schedsim: more than %d processes\n", MAXSIMPROC);
+    exit(1);
+  }
+  if(nice < BFS_NICE_FIRST_LEVEL || nice > BFS_NICE_LAST_LEVEL || burst <= 0 ||
+     sleep < 0 || count < 0){
+    fprintf(stderr, "schedsim: bad workload entry for %s\n", name);
+    exit(1);
+  }
+  sp = &procs[nprocs++];
+  sp->p.pid = nprocs;
+  strncpy(sp->p.name, name, sizeof(sp->p.name) - 1);
+  sp->p.nice_value = nice;
+  sp->burst = burst;
+  sp->sleep = sleep;
+  sp->count = count;
+  sp->left = burst;
+}
+
+static void
+readworkload(FILE *f)
+{
+  char line[256], name[16];
+  int nice, burst, sleep, count;
+
+  while(fgets(line, sizeof(line), f)){
+    if(line[strspn(line, " \t\r\n")] == 0 || line[strspn(line, " \t")] == '#')
+      continue;
+    if(sscanf(line, "%15s %d %d %d %d", name, &nice, &burst, &sleep, &count) != 5){
+      fprintf(stderr, "schedsim: bad workload line: %s", line);
+      exit(1);
+    }
+    addproc(name, nice, burst, sleep, count);
+  }
+}
+
+// Run one tick of process sp on CPU c, then switch it out if
+// its burst or its quantum is over.
+static void
+tick(int c, struct simproc *sp)
+{
+  sp->runtime++;
+  sp->p.slice--;
+  sp->p.ticks_left--;
+  if(--sp->left == 0){
+    sp->bursts++;
+    sp->nvcsw++;
+    running[c] = 0;
+    sp->left = sp->burst;
+    if(sp->count && sp->bursts == sp->count){
+      sp->p.state = ZOMBIE;
+    } else {
+      sp->p.state = SLEEPING;
+      sp->wake = ticks + sp->sleep;
+    }
+  } else if(sp->p.slice == 0){
+    sp->nivcsw++;
+    running[c] = 0;
+    enqueue(sp);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, c, maxticks, live, total;
+  struct simproc *sp;
+  FILE *f;
+  double start;
+  struct timespec ts;
+
+  maxticks = 10000;
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    if(strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+      ncpu = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+      maxticks = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+      window = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "usage: schedsim [-c ncpu] [-t ticks] [-w window] [workload]\n");
+      return 1;
+    }
+  }
+  if(ncpu < 1 || ncpu > NCPU){
+    fprintf(stderr, "schedsim: ncpu must be between 1 and %d\n", NCPU);
+    return 1;
+  }
+  if(i < argc){
+    if((f = fopen(argv[i], "r")) == 0){
+      perror(argv[i]);
+      return 1;
+    }
+    readworkload(f);
+    fclose(f);
+  } else {
+    addproc("loop", -5, 400000, 0, 1);
+    addproc("loop", 0, 400000, 0, 1);
+    addproc("loop", 5, 400000, 0, 1);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  start = ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+
+  for(c = 0; c < NCPU; c++)
+    init_skiplist(&runqueues[c]);
+
+  // Fork everything at tick 0 onto the shortest runqueue, as nicefork() does.
+  for(i = 0; i < nprocs; i++){
+    sp = &procs[i];
+    sp->p.cpu = 0;
+    for(c = 0; c < ncpu; c++)
+      if(runqueues[c].size < runqueues[sp->p.cpu].size)
+        sp->p.cpu = c;
+    enqueue(sp);
+  }
+
+  live = nprocs;
+  for(ticks = 0; ticks < maxticks && live > 0; ){
+    for(i = 0; i < nprocs; i++)
+      if(procs[i].p.state == SLEEPING && procs[i].wake <= ticks){
+        enqueue(&procs[i]);
+        preempt_for(&procs[i]);
+      }
+
+    for(c = 0; c < ncpu; c++){
+      if(running[c] == 0 && (sp = dequeue(c)) != 0){
+        running[c] = sp;
+        sp->p.state = RUNNING;
+        bfs_refill(&sp->p, 1);
+        if(sp->p.cpu != c)
+          sp->migrations++;
+        sp->p.cpu = c;
+        sp->dispatches++;
+        addlatency(sp, ticks - sp->since);
+      }
+    }
+
+    ticks++;
+    for(c = 0; c < ncpu; c++){
+      if((sp = running[c]) == 0){
+        idle[c]++;
+        continue;
+      }
+      tick(c, sp);
+      if(sp->p.state == ZOMBIE)
+        live--;
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  total = 0;
+  for(i = 0; i < nprocs; i++)
+    total += procs[i].runtime;
+
+  printf("%d ticks on %d CPU(s), %d processes, simulated in %.1f ms\n",
+         ticks, ncpu, nprocs, ts.tv_sec * 1e3 + ts.tv_nsec / 1e6 - start);
+  printf("%4s %-15s %5s %8s %6s %6s %6s %6s %6s  %6s %6s %6s %6s\n",
+         "pid", "name", "nice", "runtime", "cpu%", "runs", "vcsw", "ivcsw",
+         "migr", "p50", "p90", "p99", "max");
+  for(i = 0; i < nprocs; i++){
+    sp = &procs[i];
+    qsort(sp->lat, sp->nlat, sizeof(int), cmpint);
+    printf("%4d %-15s %5d %8d %6.2f %6d %6d %6d %6d  %6d %6d %6d %6d\n",
+           sp->p.pid, sp->p.name, sp->p.nice_value, sp->runtime,
+           total ? 100.0 * sp->runtime / total : 0.0,
+           sp->dispatches, sp->nvcsw, sp->nivcsw, sp->migrations,
+           percentile(sp, 50), percentile(sp, 90), percentile(sp, 99),
+           percentile(sp, 100));
+  }
+  for(c = 0; c < ncpu; c++)
+    printf("cpu%d: idle %d ticks\n", c, idle[c]);
+  return 0;
+}
@@ -0,0 +1,1045 @@
+
+_schedstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <div64>:
+
+// x / d.  User programs have no 64-bit division, so divide
+// one bit at a time.
+static uint
+div64(uint64 x, uint d)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 24             	sub    $0x24,%esp
+   9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+   c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+   f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  uint64 r;
+  uint q;
+  int i;
+
+  r = q = 0;
+  for(i = 63; i >= 0; i--){
+  12:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  r = q = 0;
+  17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  21:	ba 00 00 00 00       	mov    $0x0,%edx
+  for(i = 63; i >= 0; i--){
+  26:	eb 03                	jmp    2b <div64+0x2b>
+  28:	83 e9 01             	sub    $0x1,%ecx
+  2b:	85 c9                	test   %ecx,%ecx
+  2d:	78 52                	js     81 <div64+0x81>
+    r = (r << 1) | ((x >> i) & 1);
+  2f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  33:	01 c0                	add    %eax,%eax
+  35:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  38:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  3b:	0f ad fe             	shrd   %cl,%edi,%esi
+  3e:	d3 ef                	shr    %cl,%edi
+  40:	f6 c1 20             	test   $0x20,%cl
+  43:	74 04                	je     49 <div64+0x49>
+  45:	89 fe                	mov    %edi,%esi
+  47:	31 ff                	xor    %edi,%edi
+  49:	89 f7                	mov    %esi,%edi
+  4b:	83 e7 01             	and    $0x1,%edi
+  4e:	89 7d e8             	mov    %edi,-0x18(%ebp)
+  51:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  58:	0b 45 e8             	or     -0x18(%ebp),%eax
+  5b:	0b 55 ec             	or     -0x14(%ebp),%edx
+    q <<= 1;
+  5e:	01 db                	add    %ebx,%ebx
+    if(r >= d){
+  60:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  63:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  66:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  6d:	39 f8                	cmp    %edi,%eax
+  6f:	89 d6                	mov    %edx,%esi
+  71:	1b 75 e4             	sbb    -0x1c(%ebp),%esi
+  74:	72 b2                	jb     28 <div64+0x28>
+      r -= d;
+  76:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  79:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+      q |= 1;
+  7c:	83 cb 01             	or     $0x1,%ebx
+  7f:	eb a7                	jmp    28 <div64+0x28>
+    }
+  }
+  return q;
+}
+  81:	89 d8                	mov    %ebx,%eax
+  83:	83 c4 24             	add    $0x24,%esp
+  86:	5b                   	pop    %ebx
+  87:	5e                   	pop    %esi
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <printticks>:
+
+// Print cycles as ticks with two decimals.
+static void
+printticks(uint64 cycles, uint tsc_per_tick)
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	56                   	push   %esi
+  8f:	53                   	push   %ebx
+  uint t = tsc_per_tick ? div64(cycles * 100, tsc_per_tick) : 0;
+  90:	85 c9                	test   %ecx,%ecx
+  92:	74 13                	je     a7 <printticks+0x1c>
+  94:	6b da 64             	imul   $0x64,%edx,%ebx
+  97:	ba 64 00 00 00       	mov    $0x64,%edx
+  9c:	f7 e2                	mul    %edx
+  9e:	01 da                	add    %ebx,%edx
+  a0:	e8 5b ff ff ff       	call   0 <div64>
+  a5:	89 c1                	mov    %eax,%ecx
+
+  printf(1, "  %d.%d%d", t / 100, t / 10 % 10, t % 10);
+  a7:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  ac:	89 c8                	mov    %ecx,%eax
+  ae:	f7 e6                	mul    %esi
+  b0:	89 d3                	mov    %edx,%ebx
+  b2:	c1 eb 03             	shr    $0x3,%ebx
+  b5:	83 ec 0c             	sub    $0xc,%esp
+  b8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  bb:	01 c0                	add    %eax,%eax
+  bd:	89 ca                	mov    %ecx,%edx
+  bf:	29 c2                	sub    %eax,%edx
+  c1:	52                   	push   %edx
+  c2:	89 d8                	mov    %ebx,%eax
+  c4:	f7 e6                	mul    %esi
+  c6:	c1 ea 03             	shr    $0x3,%edx
+  c9:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  cc:	01 c0                	add    %eax,%eax
+  ce:	29 c3                	sub    %eax,%ebx
+  d0:	53                   	push   %ebx
+  d1:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+  d6:	89 c8                	mov    %ecx,%eax
+  d8:	f7 e2                	mul    %edx
+  da:	c1 ea 05             	shr    $0x5,%edx
+  dd:	52                   	push   %edx
+  de:	68 9c 06 00 00       	push   $0x69c
+  e3:	6a 01                	push   $0x1
+  e5:	e8 4b 04 00 00       	call   535 <printf>
+}
+  ea:	83 c4 20             	add    $0x20,%esp
+  ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  f0:	5b                   	pop    %ebx
+  f1:	5e                   	pop    %esi
+  f2:	5d                   	pop    %ebp
+  f3:	c3                   	ret
+
+000000f4 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  f4:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f8:	83 e4 f0             	and    $0xfffffff0,%esp
+  fb:	ff 71 fc             	push   -0x4(%ecx)
+  fe:	55                   	push   %ebp
+  ff:	89 e5                	mov    %esp,%ebp
+ 101:	57                   	push   %edi
+ 102:	56                   	push   %esi
+ 103:	53                   	push   %ebx
+ 104:	51                   	push   %ecx
+ 105:	83 ec 48             	sub    $0x48,%esp
+ 108:	8b 39                	mov    (%ecx),%edi
+ 10a:	8b 41 04             	mov    0x4(%ecx),%eax
+ 10d:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct schedstat st;
+  int i;
+
+  if(argc < 2){
+ 110:	83 ff 01             	cmp    $0x1,%edi
+ 113:	7e 19                	jle    12e <main+0x3a>
+    printf(2, "usage: schedstat pid ...\n");
+    exit();
+  }
+  printf(1, "pid  runtime  wait  maxwait  runs  vcsw  ivcsw\n");
+ 115:	83 ec 08             	sub    $0x8,%esp
+ 118:	68 ec 06 00 00       	push   $0x6ec
+ 11d:	6a 01                	push   $0x1
+ 11f:	e8 11 04 00 00       	call   535 <printf>
+  for(i = 1; i < argc; i++){
+ 124:	83 c4 10             	add    $0x10,%esp
+ 127:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 12c:	eb 2b                	jmp    159 <main+0x65>
+    printf(2, "usage: schedstat pid ...\n");
+ 12e:	83 ec 08             	sub    $0x8,%esp
+ 131:	68 a6 06 00 00       	push   $0x6a6
+ 136:	6a 02                	push   $0x2
+ 138:	e8 f8 03 00 00       	call   535 <printf>
+    exit();
+ 13d:	e8 3e 02 00 00       	call   380 <exit>
+    if(getschedstats(atoi(argv[i]), &st) < 0){
+      printf(2, "schedstat: no process %s\n", argv[i]);
+ 142:	83 ec 04             	sub    $0x4,%esp
+ 145:	ff 36                	push   (%esi)
+ 147:	68 c0 06 00 00       	push   $0x6c0
+ 14c:	6a 02                	push   $0x2
+ 14e:	e8 e2 03 00 00       	call   535 <printf>
+      continue;
+ 153:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 156:	83 c3 01             	add    $0x1,%ebx
+ 159:	39 fb                	cmp    %edi,%ebx
+ 15b:	7d 7f                	jge    1dc <main+0xe8>
+    if(getschedstats(atoi(argv[i]), &st) < 0){
+ 15d:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 160:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+ 163:	83 ec 0c             	sub    $0xc,%esp
+ 166:	ff 36                	push   (%esi)
+ 168:	e8 af 01 00 00       	call   31c <atoi>
+ 16d:	83 c4 08             	add    $0x8,%esp
+ 170:	8d 55 c0             	lea    -0x40(%ebp),%edx
+ 173:	52                   	push   %edx
+ 174:	50                   	push   %eax
+ 175:	e8 0e 03 00 00       	call   488 <getschedstats>
+ 17a:	83 c4 10             	add    $0x10,%esp
+ 17d:	85 c0                	test   %eax,%eax
+ 17f:	78 c1                	js     142 <main+0x4e>
+    }
+    printf(1, "%s", argv[i]);
+ 181:	83 ec 04             	sub    $0x4,%esp
+ 184:	ff 36                	push   (%esi)
+ 186:	68 da 06 00 00       	push   $0x6da
+ 18b:	6a 01                	push   $0x1
+ 18d:	e8 a3 03 00 00       	call   535 <printf>
+    printticks(st.runtime, st.tsc_per_tick);
+ 192:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 195:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 198:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 19b:	e8 eb fe ff ff       	call   8b <printticks>
+    printticks(st.wait_time, st.tsc_per_tick);
+ 1a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 1a3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 1a6:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 1a9:	e8 dd fe ff ff       	call   8b <printticks>
+    printticks(st.max_wait, st.tsc_per_tick);
+ 1ae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 1b1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 1b4:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 1b7:	e8 cf fe ff ff       	call   8b <printticks>
+    printf(1, "  %d  %d  %d\n", st.dispatches, st.nvcsw, st.nivcsw);
+ 1bc:	83 c4 04             	add    $0x4,%esp
+ 1bf:	ff 75 e0             	push   -0x20(%ebp)
+ 1c2:	ff 75 dc             	push   -0x24(%ebp)
+ 1c5:	ff 75 d8             	push   -0x28(%ebp)
+ 1c8:	68 dd 06 00 00       	push   $0x6dd
+ 1cd:	6a 01                	push   $0x1
+ 1cf:	e8 61 03 00 00       	call   535 <printf>
+ 1d4:	83 c4 20             	add    $0x20,%esp
+ 1d7:	e9 7a ff ff ff       	jmp    156 <main+0x62>
+  }
+  exit();
+ 1dc:	e8 9f 01 00 00       	call   380 <exit>
+
+000001e1 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	56                   	push   %esi
+ 1e5:	53                   	push   %ebx
+ 1e6:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1ec:	89 f0                	mov    %esi,%eax
+ 1ee:	89 d1                	mov    %edx,%ecx
+ 1f0:	83 c2 01             	add    $0x1,%edx
+ 1f3:	89 c3                	mov    %eax,%ebx
+ 1f5:	83 c0 01             	add    $0x1,%eax
+ 1f8:	0f b6 09             	movzbl (%ecx),%ecx
+ 1fb:	88 0b                	mov    %cl,(%ebx)
+ 1fd:	84 c9                	test   %cl,%cl
+ 1ff:	75 ed                	jne    1ee <strcpy+0xd>
+    ;
+  return os;
+}
+ 201:	89 f0                	mov    %esi,%eax
+ 203:	5b                   	pop    %ebx
+ 204:	5e                   	pop    %esi
+ 205:	5d                   	pop    %ebp
+ 206:	c3                   	ret
+
+00000207 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 207:	55                   	push   %ebp
+ 208:	89 e5                	mov    %esp,%ebp
+ 20a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 20d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 210:	eb 06                	jmp    218 <strcmp+0x11>
+    p++, q++;
+ 212:	83 c1 01             	add    $0x1,%ecx
+ 215:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 218:	0f b6 01             	movzbl (%ecx),%eax
+ 21b:	84 c0                	test   %al,%al
+ 21d:	74 04                	je     223 <strcmp+0x1c>
+ 21f:	3a 02                	cmp    (%edx),%al
+ 221:	74 ef                	je     212 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 223:	0f b6 c0             	movzbl %al,%eax
+ 226:	0f b6 12             	movzbl (%edx),%edx
+ 229:	29 d0                	sub    %edx,%eax
+}
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+
+0000022d <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 22d:	55                   	push   %ebp
+ 22e:	89 e5                	mov    %esp,%ebp
+ 230:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 233:	b8 00 00 00 00       	mov    $0x0,%eax
+ 238:	eb 03                	jmp    23d <strlen+0x10>
+ 23a:	83 c0 01             	add    $0x1,%eax
+ 23d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 241:	75 f7                	jne    23a <strlen+0xd>
+    ;
+  return n;
+}
+ 243:	5d                   	pop    %ebp
+ 244:	c3                   	ret
+
+00000245 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 245:	55                   	push   %ebp
+ 246:	89 e5                	mov    %esp,%ebp
+ 248:	57                   	push   %edi
+ 249:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 24c:	89 d7                	mov    %edx,%edi
+ 24e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 251:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 254:	fc                   	cld
+ 255:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 257:	89 d0                	mov    %edx,%eax
+ 259:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 25c:	c9                   	leave
+ 25d:	c3                   	ret
+
+0000025e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 25e:	55                   	push   %ebp
+ 25f:	89 e5                	mov    %esp,%ebp
+ 261:	8b 45 08             	mov    0x8(%ebp),%eax
+ 264:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 268:	eb 03                	jmp    26d <strchr+0xf>
+ 26a:	83 c0 01             	add    $0x1,%eax
+ 26d:	0f b6 10             	movzbl (%eax),%edx
+ 270:	84 d2                	test   %dl,%dl
+ 272:	74 06                	je     27a <strchr+0x1c>
+    if(*s == c)
+ 274:	38 ca                	cmp    %cl,%dl
+ 276:	75 f2                	jne    26a <strchr+0xc>
+ 278:	eb 05                	jmp    27f <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 27a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 27f:	5d                   	pop    %ebp
+ 280:	c3                   	ret
+
+00000281 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 281:	55                   	push   %ebp
+ 282:	89 e5                	mov    %esp,%ebp
+ 284:	57                   	push   %edi
+ 285:	56                   	push   %esi
+ 286:	53                   	push   %ebx
+ 287:	83 ec 1c             	sub    $0x1c,%esp
+ 28a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 28d:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 292:	89 de                	mov    %ebx,%esi
+ 294:	83 c3 01             	add    $0x1,%ebx
+ 297:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 29a:	7d 2e                	jge    2ca <gets+0x49>
+    cc = read(0, &c, 1);
+ 29c:	83 ec 04             	sub    $0x4,%esp
+ 29f:	6a 01                	push   $0x1
+ 2a1:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 2a4:	50                   	push   %eax
+ 2a5:	6a 00                	push   $0x0
+ 2a7:	e8 ec 00 00 00       	call   398 <read>
+    if(cc < 1)
+ 2ac:	83 c4 10             	add    $0x10,%esp
+ 2af:	85 c0                	test   %eax,%eax
+ 2b1:	7e 17                	jle    2ca <gets+0x49>
+      break;
+    buf[i++] = c;
+ 2b3:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2b7:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 2ba:	3c 0a                	cmp    $0xa,%al
+ 2bc:	0f 94 c2             	sete   %dl
+ 2bf:	3c 0d                	cmp    $0xd,%al
+ 2c1:	0f 94 c0             	sete   %al
+ 2c4:	08 c2                	or     %al,%dl
+ 2c6:	74 ca                	je     292 <gets+0x11>
+    buf[i++] = c;
+ 2c8:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 2ca:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 2ce:	89 f8                	mov    %edi,%eax
+ 2d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d3:	5b                   	pop    %ebx
+ 2d4:	5e                   	pop    %esi
+ 2d5:	5f                   	pop    %edi
+ 2d6:	5d                   	pop    %ebp
+ 2d7:	c3                   	ret
+
+000002d8 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2d8:	55                   	push   %ebp
+ 2d9:	89 e5                	mov    %esp,%ebp
+ 2db:	56                   	push   %esi
+ 2dc:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2dd:	83 ec 08             	sub    $0x8,%esp
+ 2e0:	6a 00                	push   $0x0
+ 2e2:	ff 75 08             	push   0x8(%ebp)
+ 2e5:	e8 d6 00 00 00       	call   3c0 <open>
+  if(fd < 0)
+ 2ea:	83 c4 10             	add    $0x10,%esp
+ 2ed:	85 c0                	test   %eax,%eax
+ 2ef:	78 24                	js     315 <stat+0x3d>
+ 2f1:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 2f3:	83 ec 08             	sub    $0x8,%esp
+ 2f6:	ff 75 0c             	push   0xc(%ebp)
+ 2f9:	50                   	push   %eax
+ 2fa:	e8 d9 00 00 00       	call   3d8 <fstat>
+ 2ff:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 301:	89 1c 24             	mov    %ebx,(%esp)
+ 304:	e8 9f 00 00 00       	call   3a8 <close>
+  return r;
+ 309:	83 c4 10             	add    $0x10,%esp
+}
+ 30c:	89 f0                	mov    %esi,%eax
+ 30e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 311:	5b                   	pop    %ebx
+ 312:	5e                   	pop    %esi
+ 313:	5d                   	pop    %ebp
+ 314:	c3                   	ret
+    return -1;
+ 315:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 31a:	eb f0                	jmp    30c <stat+0x34>
+
+0000031c <atoi>:
+
+int
+atoi(const char *s)
+{
+ 31c:	55                   	push   %ebp
+ 31d:	89 e5                	mov    %esp,%ebp
+ 31f:	53                   	push   %ebx
+ 320:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 323:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 328:	eb 10                	jmp    33a <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 32a:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 32d:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 330:	83 c1 01             	add    $0x1,%ecx
+ 333:	0f be c0             	movsbl %al,%eax
+ 336:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 33a:	0f b6 01             	movzbl (%ecx),%eax
+ 33d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 e5                	jbe    32a <atoi+0xe>
+  return n;
+}
+ 345:	89 d0                	mov    %edx,%eax
+ 347:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+
+0000034c <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 34c:	55                   	push   %ebp
+ 34d:	89 e5                	mov    %esp,%ebp
+ 34f:	56                   	push   %esi
+ 350:	53                   	push   %ebx
+ 351:	8b 75 08             	mov    0x8(%ebp),%esi
+ 354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 357:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 35a:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 35c:	eb 0d                	jmp    36b <memmove+0x1f>
+    *dst++ = *src++;
+ 35e:	0f b6 01             	movzbl (%ecx),%eax
+ 361:	88 02                	mov    %al,(%edx)
+ 363:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 366:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 369:	89 d8                	mov    %ebx,%eax
+ 36b:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 36e:	85 c0                	test   %eax,%eax
+ 370:	7f ec                	jg     35e <memmove+0x12>
+  return vdst;
+}
+ 372:	89 f0                	mov    %esi,%eax
+ 374:	5b                   	pop    %ebx
+ 375:	5e                   	pop    %esi
+ 376:	5d                   	pop    %ebp
+ 377:	c3                   	ret
+
+00000378 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 378:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <exit>:
+SYSCALL(exit)
+ 380:	b8 02 00 00 00       	mov    $0x2,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <wait>:
+SYSCALL(wait)
+ 388:	b8 03 00 00 00       	mov    $0x3,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <pipe>:
+SYSCALL(pipe)
+ 390:	b8 04 00 00 00       	mov    $0x4,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <read>:
+SYSCALL(read)
+ 398:	b8 05 00 00 00       	mov    $0x5,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <write>:
+SYSCALL(write)
+ 3a0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <close>:
+SYSCALL(close)
+ 3a8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <kill>:
+SYSCALL(kill)
+ 3b0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <exec>:
+SYSCALL(exec)
+ 3b8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <open>:
+SYSCALL(open)
+ 3c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <mknod>:
+SYSCALL(mknod)
+ 3c8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <unlink>:
+SYSCALL(unlink)
+ 3d0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <fstat>:
+SYSCALL(fstat)
+ 3d8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <link>:
+SYSCALL(link)
+ 3e0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <mkdir>:
+SYSCALL(mkdir)
+ 3e8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <chdir>:
+SYSCALL(chdir)
+ 3f0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <dup>:
+SYSCALL(dup)
+ 3f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <getpid>:
+SYSCALL(getpid)
+ 400:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <sbrk>:
+SYSCALL(sbrk)
+ 408:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <sleep>:
+SYSCALL(sleep)
+ 410:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <uptime>:
+SYSCALL(uptime)
+ 418:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <yield>:
+SYSCALL(yield)
+ 420:	b8 16 00 00 00       	mov    $0x16,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <shutdown>:
+SYSCALL(shutdown)
+ 428:	b8 17 00 00 00       	mov    $0x17,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <nicefork>:
+SYSCALL(nicefork)
+ 430:	b8 18 00 00 00       	mov    $0x18,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <schedlog>:
+SYSCALL(schedlog)
+ 438:	b8 19 00 00 00       	mov    $0x19,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <schedlogread>:
+SYSCALL(schedlogread)
+ 440:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <tracectl>:
+SYSCALL(tracectl)
+ 448:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <getcpustat>:
+SYSCALL(getcpustat)
+ 450:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <setpolicy>:
+SYSCALL(setpolicy)
+ 458:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <affinity>:
+SYSCALL(affinity)
+ 460:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <setnice>:
+SYSCALL(setnice)
+ 468:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <getnice>:
+SYSCALL(getnice)
+ 470:	b8 20 00 00 00       	mov    $0x20,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <setclass>:
+SYSCALL(setclass)
+ 478:	b8 21 00 00 00       	mov    $0x21,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <isocpu>:
+SYSCALL(isocpu)
+ 480:	b8 22 00 00 00       	mov    $0x22,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <getschedstats>:
+SYSCALL(getschedstats)
+ 488:	b8 23 00 00 00       	mov    $0x23,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	83 ec 1c             	sub    $0x1c,%esp
+ 496:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 499:	6a 01                	push   $0x1
+ 49b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 49e:	52                   	push   %edx
+ 49f:	50                   	push   %eax
+ 4a0:	e8 fb fe ff ff       	call   3a0 <write>
+}
+ 4a5:	83 c4 10             	add    $0x10,%esp
+ 4a8:	c9                   	leave
+ 4a9:	c3                   	ret
+
+000004aa <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4aa:	55                   	push   %ebp
+ 4ab:	89 e5                	mov    %esp,%ebp
+ 4ad:	57                   	push   %edi
+ 4ae:	56                   	push   %esi
+ 4af:	53                   	push   %ebx
+ 4b0:	83 ec 2c             	sub    $0x2c,%esp
+ 4b3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4ba:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4be:	0f 95 c1             	setne  %cl
+ 4c1:	c1 ea 1f             	shr    $0x1f,%edx
+ 4c4:	84 d1                	test   %dl,%cl
+ 4c6:	74 44                	je     50c <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 4c8:	f7 d8                	neg    %eax
+ 4ca:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 4cc:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4d8:	89 c8                	mov    %ecx,%eax
+ 4da:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4df:	f7 f6                	div    %esi
+ 4e1:	89 df                	mov    %ebx,%edi
+ 4e3:	83 c3 01             	add    $0x1,%ebx
+ 4e6:	0f b6 92 7c 07 00 00 	movzbl 0x77c(%edx),%edx
+ 4ed:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 4f1:	89 ca                	mov    %ecx,%edx
+ 4f3:	89 c1                	mov    %eax,%ecx
+ 4f5:	39 f2                	cmp    %esi,%edx
+ 4f7:	73 df                	jae    4d8 <printint+0x2e>
+  if(neg)
+ 4f9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 4fd:	74 31                	je     530 <printint+0x86>
+    buf[i++] = '-';
+ 4ff:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 504:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 507:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 50a:	eb 17                	jmp    523 <printint+0x79>
+    x = xx;
+ 50c:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 50e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 515:	eb bc                	jmp    4d3 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 517:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 51c:	89 f0                	mov    %esi,%eax
+ 51e:	e8 6d ff ff ff       	call   490 <putc>
+  while(--i >= 0)
+ 523:	83 eb 01             	sub    $0x1,%ebx
+ 526:	79 ef                	jns    517 <printint+0x6d>
+}
+ 528:	83 c4 2c             	add    $0x2c,%esp
+ 52b:	5b                   	pop    %ebx
+ 52c:	5e                   	pop    %esi
+ 52d:	5f                   	pop    %edi
+ 52e:	5d                   	pop    %ebp
+ 52f:	c3                   	ret
+ 530:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 533:	eb ee                	jmp    523 <printint+0x79>
+
+00000535 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 535:	55                   	push   %ebp
+ 536:	89 e5                	mov    %esp,%ebp
+ 538:	57                   	push   %edi
+ 539:	56                   	push   %esi
+ 53a:	53                   	push   %ebx
+ 53b:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 53e:	8d 45 10             	lea    0x10(%ebp),%eax
+ 541:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 544:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 549:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 54e:	eb 14                	jmp    564 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 550:	89 fa                	mov    %edi,%edx
+ 552:	8b 45 08             	mov    0x8(%ebp),%eax
+ 555:	e8 36 ff ff ff       	call   490 <putc>
+ 55a:	eb 05                	jmp    561 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 55c:	83 fe 25             	cmp    $0x25,%esi
+ 55f:	74 25                	je     586 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 561:	83 c3 01             	add    $0x1,%ebx
+ 564:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 567:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 56b:	84 c0                	test   %al,%al
+ 56d:	0f 84 20 01 00 00    	je     693 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 573:	0f be f8             	movsbl %al,%edi
+ 576:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 579:	85 f6                	test   %esi,%esi
+ 57b:	75 df                	jne    55c <printf+0x27>
+      if(c == '%'){
+ 57d:	83 f8 25             	cmp    $0x25,%eax
+ 580:	75 ce                	jne    550 <printf+0x1b>
+        state = '%';
+ 582:	89 c6                	mov    %eax,%esi
+ 584:	eb db                	jmp    561 <printf+0x2c>
+      if(c == 'd'){
+ 586:	83 f8 25             	cmp    $0x25,%eax
+ 589:	0f 84 cf 00 00 00    	je     65e <printf+0x129>
+ 58f:	0f 8c dd 00 00 00    	jl     672 <printf+0x13d>
+ 595:	83 f8 78             	cmp    $0x78,%eax
+ 598:	0f 8f d4 00 00 00    	jg     672 <printf+0x13d>
+ 59e:	83 f8 63             	cmp    $0x63,%eax
+ 5a1:	0f 8c cb 00 00 00    	jl     672 <printf+0x13d>
+ 5a7:	83 e8 63             	sub    $0x63,%eax
+ 5aa:	83 f8 15             	cmp    $0x15,%eax
+ 5ad:	0f 87 bf 00 00 00    	ja     672 <printf+0x13d>
+ 5b3:	ff 24 85 24 07 00 00 	jmp    *0x724(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 5ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5bd:	8b 17                	mov    (%edi),%edx
+ 5bf:	83 ec 0c             	sub    $0xc,%esp
+ 5c2:	6a 01                	push   $0x1
+ 5c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cc:	e8 d9 fe ff ff       	call   4aa <printint>
+        ap++;
+ 5d1:	83 c7 04             	add    $0x4,%edi
+ 5d4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5d7:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5da:	be 00 00 00 00       	mov    $0x0,%esi
+ 5df:	eb 80                	jmp    561 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 5e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5e4:	8b 17                	mov    (%edi),%edx
+ 5e6:	83 ec 0c             	sub    $0xc,%esp
+ 5e9:	6a 00                	push   $0x0
+ 5eb:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f3:	e8 b2 fe ff ff       	call   4aa <printint>
+        ap++;
+ 5f8:	83 c7 04             	add    $0x4,%edi
+ 5fb:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5fe:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 601:	be 00 00 00 00       	mov    $0x0,%esi
+ 606:	e9 56 ff ff ff       	jmp    561 <printf+0x2c>
+        s = (char*)*ap;
+ 60b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 60e:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 610:	83 c0 04             	add    $0x4,%eax
+ 613:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 616:	85 f6                	test   %esi,%esi
+ 618:	75 15                	jne    62f <printf+0xfa>
+          s = "(null)";
+ 61a:	be 1c 07 00 00       	mov    $0x71c,%esi
+ 61f:	eb 0e                	jmp    62f <printf+0xfa>
+          putc(fd, *s);
+ 621:	0f be d2             	movsbl %dl,%edx
+ 624:	8b 45 08             	mov    0x8(%ebp),%eax
+ 627:	e8 64 fe ff ff       	call   490 <putc>
+          s++;
+ 62c:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 62f:	0f b6 16             	movzbl (%esi),%edx
+ 632:	84 d2                	test   %dl,%dl
+ 634:	75 eb                	jne    621 <printf+0xec>
+      state = 0;
+ 636:	be 00 00 00 00       	mov    $0x0,%esi
+ 63b:	e9 21 ff ff ff       	jmp    561 <printf+0x2c>
+        putc(fd, *ap);
+ 640:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 643:	0f be 17             	movsbl (%edi),%edx
+ 646:	8b 45 08             	mov    0x8(%ebp),%eax
+ 649:	e8 42 fe ff ff       	call   490 <putc>
+        ap++;
+ 64e:	83 c7 04             	add    $0x4,%edi
+ 651:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 654:	be 00 00 00 00       	mov    $0x0,%esi
+ 659:	e9 03 ff ff ff       	jmp    561 <printf+0x2c>
+        putc(fd, c);
+ 65e:	89 fa                	mov    %edi,%edx
+ 660:	8b 45 08             	mov    0x8(%ebp),%eax
+ 663:	e8 28 fe ff ff       	call   490 <putc>
+      state = 0;
+ 668:	be 00 00 00 00       	mov    $0x0,%esi
+ 66d:	e9 ef fe ff ff       	jmp    561 <printf+0x2c>
+        putc(fd, '%');
+ 672:	ba 25 00 00 00       	mov    $0x25,%edx
+ 677:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67a:	e8 11 fe ff ff       	call   490 <putc>
+        putc(fd, c);
+ 67f:	89 fa                	mov    %edi,%edx
+ 681:	8b 45 08             	mov    0x8(%ebp),%eax
+ 684:	e8 07 fe ff ff       	call   490 <putc>
+      state = 0;
+ 689:	be 00 00 00 00       	mov    $0x0,%esi
+ 68e:	e9 ce fe ff ff       	jmp    561 <printf+0x2c>
+    }
+  }
+}
+ 693:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 696:	5b                   	pop    %ebx
+ 697:	5e                   	pop    %esi
+ 698:	5f                   	pop    %edi
+ 699:	5d                   	pop    %ebp
+ 69a:	c3                   	ret
@@ -0,0 +1,48 @@
+// Print the scheduling statistics of processes (see getschedstats()):
+//
+//   schedstat pid ...
+//
+// Times are in timer ticks, to two decimal places: time running,
+// time runnable but waiting for a CPU, and the longest such wait.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sched.h"
+
+// Print cycles as ticks with two decimals.
+static void
+printticks(uint64 cycles, uint tsc_per_tick)
+{
+  uint64 t;
+  uint rem;
+
+  t = tsc_per_tick ? divmod64(cycles * 100, tsc_per_tick, &rem) : 0;
+  t = divmod64(t, 100, &rem);
+  printf(1, "  %l.%d%d", t, rem / 10, rem % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct schedstat st;
+  int i;
+
+  if(argc < 2){
+    printf(2, "usage: schedstat pid ...\n");
+    exit();
+  }
+  printf(1, "pid  runtime  wait  maxwait  runs  vcsw  ivcsw\n");
+  for(i = 1; i < argc; i++){
+    if(getschedstats(atoi(argv[i]), &st) < 0){
+      printf(2, "schedstat: no process %s\n", argv[i]);
+      continue;
+    }
+    printf(1, "%s", argv[i]);
+    printticks(st.runtime, st.tsc_per_tick);
+    printticks(st.wait_time, st.tsc_per_tick);
+    printticks(st.max_wait, st.tsc_per_tick);
+    printf(1, "  %d  %d  %d\n", st.dispatches, st.nvcsw, st.nivcsw);
+  }
+  exit();
+}
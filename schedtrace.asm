@@ -0,0 +1,658 @@
+
+_schedtrace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printu64>:
+
+// Print x in decimal.  printf has no 64-bit conversions, and user
+// programs have no 64-bit division, so subtract powers of ten.
+static void
+printu64(uint64 x)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+   c:	89 c6                	mov    %eax,%esi
+   e:	89 d7                	mov    %edx,%edi
+  uint64 pow[20];
+  int n, digit;
+
+  pow[0] = 1;
+  10:	c7 85 48 ff ff ff 01 	movl   $0x1,-0xb8(%ebp)
+  17:	00 00 00 
+  1a:	c7 85 4c ff ff ff 00 	movl   $0x0,-0xb4(%ebp)
+  21:	00 00 00 
+  for(n = 1; n < 20 && pow[n-1] * 10 <= x; n++)
+  24:	bb 01 00 00 00       	mov    $0x1,%ebx
+  29:	eb 11                	jmp    3c <printu64+0x3c>
+    pow[n] = pow[n-1] * 10;
+  2b:	89 84 dd 48 ff ff ff 	mov    %eax,-0xb8(%ebp,%ebx,8)
+  32:	89 94 dd 4c ff ff ff 	mov    %edx,-0xb4(%ebp,%ebx,8)
+  for(n = 1; n < 20 && pow[n-1] * 10 <= x; n++)
+  39:	83 c3 01             	add    $0x1,%ebx
+  3c:	83 fb 13             	cmp    $0x13,%ebx
+  3f:	7f 5a                	jg     9b <printu64+0x9b>
+  41:	6b 8c dd 44 ff ff ff 	imul   $0xa,-0xbc(%ebp,%ebx,8),%ecx
+  48:	0a 
+  49:	b8 0a 00 00 00       	mov    $0xa,%eax
+  4e:	f7 a4 dd 40 ff ff ff 	mull   -0xc0(%ebp,%ebx,8)
+  55:	01 ca                	add    %ecx,%edx
+  57:	39 c6                	cmp    %eax,%esi
+  59:	89 f9                	mov    %edi,%ecx
+  5b:	19 d1                	sbb    %edx,%ecx
+  5d:	73 cc                	jae    2b <printu64+0x2b>
+  5f:	eb 3a                	jmp    9b <printu64+0x9b>
+  while(--n >= 0){
+    for(digit = 0; x >= pow[n]; digit++)
+      x -= pow[n];
+  61:	29 c6                	sub    %eax,%esi
+  63:	19 d7                	sbb    %edx,%edi
+    for(digit = 0; x >= pow[n]; digit++)
+  65:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%ebp)
+  6c:	8b 84 dd 48 ff ff ff 	mov    -0xb8(%ebp,%ebx,8),%eax
+  73:	8b 94 dd 4c ff ff ff 	mov    -0xb4(%ebp,%ebx,8),%edx
+  7a:	39 c6                	cmp    %eax,%esi
+  7c:	89 f9                	mov    %edi,%ecx
+  7e:	19 d1                	sbb    %edx,%ecx
+  80:	73 df                	jae    61 <printu64+0x61>
+    printf(1, "%d", digit);
+  82:	8b 8d 44 ff ff ff    	mov    -0xbc(%ebp),%ecx
+  88:	83 ec 04             	sub    $0x4,%esp
+  8b:	51                   	push   %ecx
+  8c:	68 ac 04 00 00       	push   $0x4ac
+  91:	6a 01                	push   $0x1
+  93:	e8 ae 02 00 00       	call   346 <printf>
+  98:	83 c4 10             	add    $0x10,%esp
+  while(--n >= 0){
+  9b:	83 eb 01             	sub    $0x1,%ebx
+  9e:	78 0d                	js     ad <printu64+0xad>
+    for(digit = 0; x >= pow[n]; digit++)
+  a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  a5:	89 8d 44 ff ff ff    	mov    %ecx,-0xbc(%ebp)
+  ab:	eb bf                	jmp    6c <printu64+0x6c>
+  }
+}
+  ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  b0:	5b                   	pop    %ebx
+  b1:	5e                   	pop    %esi
+  b2:	5f                   	pop    %edi
+  b3:	5d                   	pop    %ebp
+  b4:	c3                   	ret
+
+000000b5 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  b5:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  b9:	83 e4 f0             	and    $0xfffffff0,%esp
+  bc:	ff 71 fc             	push   -0x4(%ecx)
+  bf:	55                   	push   %ebp
+  c0:	89 e5                	mov    %esp,%ebp
+  c2:	57                   	push   %edi
+  c3:	56                   	push   %esi
+  c4:	53                   	push   %ebx
+  c5:	51                   	push   %ecx
+  c6:	83 ec 18             	sub    $0x18,%esp
+  int i, n;
+  char *event;
+
+  while((n = schedlogread(buf, NEVENT)) > 0){
+  c9:	83 ec 08             	sub    $0x8,%esp
+  cc:	6a 40                	push   $0x40
+  ce:	68 80 05 00 00       	push   $0x580
+  d3:	e8 79 01 00 00       	call   251 <schedlogread>
+  d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  db:	83 c4 10             	add    $0x10,%esp
+  de:	85 c0                	test   %eax,%eax
+  e0:	0f 8e 9e 00 00 00    	jle    184 <main+0xcf>
+    for(i = 0; i < n; i++){
+  e6:	be 00 00 00 00       	mov    $0x0,%esi
+  eb:	eb 62                	jmp    14f <main+0x9a>
+      event = "???";
+  ed:	bf af 04 00 00       	mov    $0x4af,%edi
+      if(buf[i].type < sizeof(events)/sizeof(events[0]) && events[buf[i].type])
+        event = events[buf[i].type];
+      printu64(buf[i].tick);
+  f2:	6b c6 1c             	imul   $0x1c,%esi,%eax
+  f5:	8d 98 80 05 00 00    	lea    0x580(%eax),%ebx
+  fb:	8b 90 84 05 00 00    	mov    0x584(%eax),%edx
+ 101:	8b 80 80 05 00 00    	mov    0x580(%eax),%eax
+ 107:	e8 f4 fe ff ff       	call   0 <printu64>
+      printf(1, "|%d|%s|[%d]%d(", buf[i].cpu, event, buf[i].pid, buf[i].nice);
+ 10c:	83 ec 08             	sub    $0x8,%esp
+ 10f:	0f bf 43 0a          	movswl 0xa(%ebx),%eax
+ 113:	50                   	push   %eax
+ 114:	ff 73 0c             	push   0xc(%ebx)
+ 117:	57                   	push   %edi
+ 118:	0f b6 43 08          	movzbl 0x8(%ebx),%eax
+ 11c:	50                   	push   %eax
+ 11d:	68 b3 04 00 00       	push   $0x4b3
+ 122:	6a 01                	push   $0x1
+ 124:	e8 1d 02 00 00       	call   346 <printf>
+      printu64(buf[i].virtual_deadline);
+ 129:	83 c4 20             	add    $0x20,%esp
+ 12c:	8b 43 10             	mov    0x10(%ebx),%eax
+ 12f:	8b 53 14             	mov    0x14(%ebx),%edx
+ 132:	e8 c9 fe ff ff       	call   0 <printu64>
+      printf(1, ")(%d)\n", buf[i].ticks_left);
+ 137:	83 ec 04             	sub    $0x4,%esp
+ 13a:	ff 73 18             	push   0x18(%ebx)
+ 13d:	68 c2 04 00 00       	push   $0x4c2
+ 142:	6a 01                	push   $0x1
+ 144:	e8 fd 01 00 00       	call   346 <printf>
+    for(i = 0; i < n; i++){
+ 149:	83 c6 01             	add    $0x1,%esi
+ 14c:	83 c4 10             	add    $0x10,%esp
+ 14f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 152:	39 c6                	cmp    %eax,%esi
+ 154:	0f 8d 6f ff ff ff    	jge    c9 <main+0x14>
+      if(buf[i].type < sizeof(events)/sizeof(events[0]) && events[buf[i].type])
+ 15a:	6b c6 1c             	imul   $0x1c,%esi,%eax
+ 15d:	0f b6 80 89 05 00 00 	movzbl 0x589(%eax),%eax
+ 164:	3c 06                	cmp    $0x6,%al
+ 166:	77 85                	ja     ed <main+0x38>
+ 168:	0f b6 c0             	movzbl %al,%eax
+ 16b:	8b 3c 85 ec 04 00 00 	mov    0x4ec(,%eax,4),%edi
+ 172:	85 ff                	test   %edi,%edi
+ 174:	0f 85 78 ff ff ff    	jne    f2 <main+0x3d>
+      event = "???";
+ 17a:	bf af 04 00 00       	mov    $0x4af,%edi
+ 17f:	e9 6e ff ff ff       	jmp    f2 <main+0x3d>
+    }
+  }
+  exit();
+ 184:	e8 08 00 00 00       	call   191 <exit>
+
+00000189 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 189:	b8 01 00 00 00       	mov    $0x1,%eax
+ 18e:	cd 40                	int    $0x40
+ 190:	c3                   	ret
+
+00000191 <exit>:
+SYSCALL(exit)
+ 191:	b8 02 00 00 00       	mov    $0x2,%eax
+ 196:	cd 40                	int    $0x40
+ 198:	c3                   	ret
+
+00000199 <wait>:
+SYSCALL(wait)
+ 199:	b8 03 00 00 00       	mov    $0x3,%eax
+ 19e:	cd 40                	int    $0x40
+ 1a0:	c3                   	ret
+
+000001a1 <pipe>:
+SYSCALL(pipe)
+ 1a1:	b8 04 00 00 00       	mov    $0x4,%eax
+ 1a6:	cd 40                	int    $0x40
+ 1a8:	c3                   	ret
+
+000001a9 <read>:
+SYSCALL(read)
+ 1a9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 1ae:	cd 40                	int    $0x40
+ 1b0:	c3                   	ret
+
+000001b1 <write>:
+SYSCALL(write)
+ 1b1:	b8 10 00 00 00       	mov    $0x10,%eax
+ 1b6:	cd 40                	int    $0x40
+ 1b8:	c3                   	ret
+
+000001b9 <close>:
+SYSCALL(close)
+ 1b9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 1be:	cd 40                	int    $0x40
+ 1c0:	c3                   	ret
+
+000001c1 <kill>:
+SYSCALL(kill)
+ 1c1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 1c6:	cd 40                	int    $0x40
+ 1c8:	c3                   	ret
+
+000001c9 <exec>:
+SYSCALL(exec)
+ 1c9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 1ce:	cd 40                	int    $0x40
+ 1d0:	c3                   	ret
+
+000001d1 <open>:
+SYSCALL(open)
+ 1d1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 1d6:	cd 40                	int    $0x40
+ 1d8:	c3                   	ret
+
+000001d9 <mknod>:
+SYSCALL(mknod)
+ 1d9:	b8 11 00 00 00       	mov    $0x11,%eax
+ 1de:	cd 40                	int    $0x40
+ 1e0:	c3                   	ret
+
+000001e1 <unlink>:
+SYSCALL(unlink)
+ 1e1:	b8 12 00 00 00       	mov    $0x12,%eax
+ 1e6:	cd 40                	int    $0x40
+ 1e8:	c3                   	ret
+
+000001e9 <fstat>:
+SYSCALL(fstat)
+ 1e9:	b8 08 00 00 00       	mov    $0x8,%eax
+ 1ee:	cd 40                	int    $0x40
+ 1f0:	c3                   	ret
+
+000001f1 <link>:
+SYSCALL(link)
+ 1f1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 1f6:	cd 40                	int    $0x40
+ 1f8:	c3                   	ret
+
+000001f9 <mkdir>:
+SYSCALL(mkdir)
+ 1f9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 1fe:	cd 40                	int    $0x40
+ 200:	c3                   	ret
+
+00000201 <chdir>:
+SYSCALL(chdir)
+ 201:	b8 09 00 00 00       	mov    $0x9,%eax
+ 206:	cd 40                	int    $0x40
+ 208:	c3                   	ret
+
+00000209 <dup>:
+SYSCALL(dup)
+ 209:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 20e:	cd 40                	int    $0x40
+ 210:	c3                   	ret
+
+00000211 <getpid>:
+SYSCALL(getpid)
+ 211:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 216:	cd 40                	int    $0x40
+ 218:	c3                   	ret
+
+00000219 <sbrk>:
+SYSCALL(sbrk)
+ 219:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 21e:	cd 40                	int    $0x40
+ 220:	c3                   	ret
+
+00000221 <sleep>:
+SYSCALL(sleep)
+ 221:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 226:	cd 40                	int    $0x40
+ 228:	c3                   	ret
+
+00000229 <uptime>:
+SYSCALL(uptime)
+ 229:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 22e:	cd 40                	int    $0x40
+ 230:	c3                   	ret
+
+00000231 <yield>:
+SYSCALL(yield)
+ 231:	b8 16 00 00 00       	mov    $0x16,%eax
+ 236:	cd 40                	int    $0x40
+ 238:	c3                   	ret
+
+00000239 <shutdown>:
+SYSCALL(shutdown)
+ 239:	b8 17 00 00 00       	mov    $0x17,%eax
+ 23e:	cd 40                	int    $0x40
+ 240:	c3                   	ret
+
+00000241 <nicefork>:
+SYSCALL(nicefork)
+ 241:	b8 18 00 00 00       	mov    $0x18,%eax
+ 246:	cd 40                	int    $0x40
+ 248:	c3                   	ret
+
+00000249 <schedlog>:
+SYSCALL(schedlog)
+ 249:	b8 19 00 00 00       	mov    $0x19,%eax
+ 24e:	cd 40                	int    $0x40
+ 250:	c3                   	ret
+
+00000251 <schedlogread>:
+SYSCALL(schedlogread)
+ 251:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 256:	cd 40                	int    $0x40
+ 258:	c3                   	ret
+
+00000259 <tracectl>:
+SYSCALL(tracectl)
+ 259:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 25e:	cd 40                	int    $0x40
+ 260:	c3                   	ret
+
+00000261 <getcpustat>:
+SYSCALL(getcpustat)
+ 261:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 266:	cd 40                	int    $0x40
+ 268:	c3                   	ret
+
+00000269 <setpolicy>:
+SYSCALL(setpolicy)
+ 269:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 26e:	cd 40                	int    $0x40
+ 270:	c3                   	ret
+
+00000271 <affinity>:
+SYSCALL(affinity)
+ 271:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 276:	cd 40                	int    $0x40
+ 278:	c3                   	ret
+
+00000279 <setnice>:
+SYSCALL(setnice)
+ 279:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 27e:	cd 40                	int    $0x40
+ 280:	c3                   	ret
+
+00000281 <getnice>:
+SYSCALL(getnice)
+ 281:	b8 20 00 00 00       	mov    $0x20,%eax
+ 286:	cd 40                	int    $0x40
+ 288:	c3                   	ret
+
+00000289 <setclass>:
+SYSCALL(setclass)
+ 289:	b8 21 00 00 00       	mov    $0x21,%eax
+ 28e:	cd 40                	int    $0x40
+ 290:	c3                   	ret
+
+00000291 <isocpu>:
+SYSCALL(isocpu)
+ 291:	b8 22 00 00 00       	mov    $0x22,%eax
+ 296:	cd 40                	int    $0x40
+ 298:	c3                   	ret
+
+00000299 <getschedstats>:
+SYSCALL(getschedstats)
+ 299:	b8 23 00 00 00       	mov    $0x23,%eax
+ 29e:	cd 40                	int    $0x40
+ 2a0:	c3                   	ret
+
+000002a1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 2a1:	55                   	push   %ebp
+ 2a2:	89 e5                	mov    %esp,%ebp
+ 2a4:	83 ec 1c             	sub    $0x1c,%esp
+ 2a7:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 2aa:	6a 01                	push   $0x1
+ 2ac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 2af:	52                   	push   %edx
+ 2b0:	50                   	push   %eax
+ 2b1:	e8 fb fe ff ff       	call   1b1 <write>
+}
+ 2b6:	83 c4 10             	add    $0x10,%esp
+ 2b9:	c9                   	leave
+ 2ba:	c3                   	ret
+
+000002bb <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 2bb:	55                   	push   %ebp
+ 2bc:	89 e5                	mov    %esp,%ebp
+ 2be:	57                   	push   %edi
+ 2bf:	56                   	push   %esi
+ 2c0:	53                   	push   %ebx
+ 2c1:	83 ec 2c             	sub    $0x2c,%esp
+ 2c4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2c7:	89 d0                	mov    %edx,%eax
+ 2c9:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 2cb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 2cf:	0f 95 c1             	setne  %cl
+ 2d2:	c1 ea 1f             	shr    $0x1f,%edx
+ 2d5:	84 d1                	test   %dl,%cl
+ 2d7:	74 44                	je     31d <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 2d9:	f7 d8                	neg    %eax
+ 2db:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 2dd:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 2e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 2e9:	89 c8                	mov    %ecx,%eax
+ 2eb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2f0:	f7 f6                	div    %esi
+ 2f2:	89 df                	mov    %ebx,%edi
+ 2f4:	83 c3 01             	add    $0x1,%ebx
+ 2f7:	0f b6 92 68 05 00 00 	movzbl 0x568(%edx),%edx
+ 2fe:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 302:	89 ca                	mov    %ecx,%edx
+ 304:	89 c1                	mov    %eax,%ecx
+ 306:	39 f2                	cmp    %esi,%edx
+ 308:	73 df                	jae    2e9 <printint+0x2e>
+  if(neg)
+ 30a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 30e:	74 31                	je     341 <printint+0x86>
+    buf[i++] = '-';
+ 310:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 315:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 318:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 31b:	eb 17                	jmp    334 <printint+0x79>
+    x = xx;
+ 31d:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 31f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 326:	eb bc                	jmp    2e4 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 328:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 32d:	89 f0                	mov    %esi,%eax
+ 32f:	e8 6d ff ff ff       	call   2a1 <putc>
+  while(--i >= 0)
+ 334:	83 eb 01             	sub    $0x1,%ebx
+ 337:	79 ef                	jns    328 <printint+0x6d>
+}
+ 339:	83 c4 2c             	add    $0x2c,%esp
+ 33c:	5b                   	pop    %ebx
+ 33d:	5e                   	pop    %esi
+ 33e:	5f                   	pop    %edi
+ 33f:	5d                   	pop    %ebp
+ 340:	c3                   	ret
+ 341:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 344:	eb ee                	jmp    334 <printint+0x79>
+
+00000346 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 346:	55                   	push   %ebp
+ 347:	89 e5                	mov    %esp,%ebp
+ 349:	57                   	push   %edi
+ 34a:	56                   	push   %esi
+ 34b:	53                   	push   %ebx
+ 34c:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 34f:	8d 45 10             	lea    0x10(%ebp),%eax
+ 352:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 355:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 35a:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 35f:	eb 14                	jmp    375 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 361:	89 fa                	mov    %edi,%edx
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	e8 36 ff ff ff       	call   2a1 <putc>
+ 36b:	eb 05                	jmp    372 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 36d:	83 fe 25             	cmp    $0x25,%esi
+ 370:	74 25                	je     397 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 372:	83 c3 01             	add    $0x1,%ebx
+ 375:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 378:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 37c:	84 c0                	test   %al,%al
+ 37e:	0f 84 20 01 00 00    	je     4a4 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 384:	0f be f8             	movsbl %al,%edi
+ 387:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 38a:	85 f6                	test   %esi,%esi
+ 38c:	75 df                	jne    36d <printf+0x27>
+      if(c == '%'){
+ 38e:	83 f8 25             	cmp    $0x25,%eax
+ 391:	75 ce                	jne    361 <printf+0x1b>
+        state = '%';
+ 393:	89 c6                	mov    %eax,%esi
+ 395:	eb db                	jmp    372 <printf+0x2c>
+      if(c == 'd'){
+ 397:	83 f8 25             	cmp    $0x25,%eax
+ 39a:	0f 84 cf 00 00 00    	je     46f <printf+0x129>
+ 3a0:	0f 8c dd 00 00 00    	jl     483 <printf+0x13d>
+ 3a6:	83 f8 78             	cmp    $0x78,%eax
+ 3a9:	0f 8f d4 00 00 00    	jg     483 <printf+0x13d>
+ 3af:	83 f8 63             	cmp    $0x63,%eax
+ 3b2:	0f 8c cb 00 00 00    	jl     483 <printf+0x13d>
+ 3b8:	83 e8 63             	sub    $0x63,%eax
+ 3bb:	83 f8 15             	cmp    $0x15,%eax
+ 3be:	0f 87 bf 00 00 00    	ja     483 <printf+0x13d>
+ 3c4:	ff 24 85 10 05 00 00 	jmp    *0x510(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 3cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 3ce:	8b 17                	mov    (%edi),%edx
+ 3d0:	83 ec 0c             	sub    $0xc,%esp
+ 3d3:	6a 01                	push   $0x1
+ 3d5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 3da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3dd:	e8 d9 fe ff ff       	call   2bb <printint>
+        ap++;
+ 3e2:	83 c7 04             	add    $0x4,%edi
+ 3e5:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 3e8:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 3eb:	be 00 00 00 00       	mov    $0x0,%esi
+ 3f0:	eb 80                	jmp    372 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 3f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 3f5:	8b 17                	mov    (%edi),%edx
+ 3f7:	83 ec 0c             	sub    $0xc,%esp
+ 3fa:	6a 00                	push   $0x0
+ 3fc:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 401:	8b 45 08             	mov    0x8(%ebp),%eax
+ 404:	e8 b2 fe ff ff       	call   2bb <printint>
+        ap++;
+ 409:	83 c7 04             	add    $0x4,%edi
+ 40c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 40f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 412:	be 00 00 00 00       	mov    $0x0,%esi
+ 417:	e9 56 ff ff ff       	jmp    372 <printf+0x2c>
+        s = (char*)*ap;
+ 41c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 41f:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 421:	83 c0 04             	add    $0x4,%eax
+ 424:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 427:	85 f6                	test   %esi,%esi
+ 429:	75 15                	jne    440 <printf+0xfa>
+          s = "(null)";
+ 42b:	be 08 05 00 00       	mov    $0x508,%esi
+ 430:	eb 0e                	jmp    440 <printf+0xfa>
+          putc(fd, *s);
+ 432:	0f be d2             	movsbl %dl,%edx
+ 435:	8b 45 08             	mov    0x8(%ebp),%eax
+ 438:	e8 64 fe ff ff       	call   2a1 <putc>
+          s++;
+ 43d:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 440:	0f b6 16             	movzbl (%esi),%edx
+ 443:	84 d2                	test   %dl,%dl
+ 445:	75 eb                	jne    432 <printf+0xec>
+      state = 0;
+ 447:	be 00 00 00 00       	mov    $0x0,%esi
+ 44c:	e9 21 ff ff ff       	jmp    372 <printf+0x2c>
+        putc(fd, *ap);
+ 451:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 454:	0f be 17             	movsbl (%edi),%edx
+ 457:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45a:	e8 42 fe ff ff       	call   2a1 <putc>
+        ap++;
+ 45f:	83 c7 04             	add    $0x4,%edi
+ 462:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 465:	be 00 00 00 00       	mov    $0x0,%esi
+ 46a:	e9 03 ff ff ff       	jmp    372 <printf+0x2c>
+        putc(fd, c);
+ 46f:	89 fa                	mov    %edi,%edx
+ 471:	8b 45 08             	mov    0x8(%ebp),%eax
+ 474:	e8 28 fe ff ff       	call   2a1 <putc>
+      state = 0;
+ 479:	be 00 00 00 00       	mov    $0x0,%esi
+ 47e:	e9 ef fe ff ff       	jmp    372 <printf+0x2c>
+        putc(fd, '%');
+ 483:	ba 25 00 00 00       	mov    $0x25,%edx
+ 488:	8b 45 08             	mov    0x8(%ebp),%eax
+ 48b:	e8 11 fe ff ff       	call   2a1 <putc>
+        putc(fd, c);
+ 490:	89 fa                	mov    %edi,%edx
+ 492:	8b 45 08             	mov    0x8(%ebp),%eax
+ 495:	e8 07 fe ff ff       	call   2a1 <putc>
+      state = 0;
+ 49a:	be 00 00 00 00       	mov    $0x0,%esi
+ 49f:	e9 ce fe ff ff       	jmp    372 <printf+0x2c>
+    }
+  }
+}
+ 4a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4a7:	5b                   	pop    %ebx
+ 4a8:	5e                   	pop    %esi
+ 4a9:	5f                   	pop    %edi
+ 4aa:	5d                   	pop    %ebp
+ 4ab:	c3                   	ret
@@ -0,0 +1,40 @@
+// Drain the kernel's scheduler trace (see schedlog(n)) and
+// print one line per event:
+//
+//   tick|cpu|event|[pid]nice(virtual deadline)(ticks left)
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sched.h"
+
+#define NEVENT 64
+
+static char *events[] = {
+[SCHEDLOG_FORK]     "fork",
+[SCHEDLOG_WAKEUP]   "wakeup",
+[SCHEDLOG_RUN]      "run",
+[SCHEDLOG_PREEMPT]  "preempt",
+[SCHEDLOG_SLEEP]    "sleep",
+[SCHEDLOG_EXIT]     "exit",
+};
+
+struct schedevent buf[NEVENT];
+
+int
+main(int argc, char *argv[])
+{
+  int i, n;
+  char *event;
+
+  while((n = schedlogread(buf, NEVENT)) > 0){
+    for(i = 0; i < n; i++){
+      event = "???";
+      if(buf[i].type < sizeof(events)/sizeof(events[0]) && events[buf[i].type])
+        event = events[buf[i].type];
+      printf(1, "%l|%d|%s|[%d]%d(%l)(%d)\n", buf[i].tick, buf[i].cpu, event,
+             buf[i].pid, buf[i].nice, buf[i].virtual_deadline, buf[i].ticks_left);
+    }
+  }
+  exit();
+}
@@ -1,38 +1,50 @@
-
-#include "bfs.h"
+// BFS runqueue: a skip list of processes ordered by virtual deadline.
+//
+// This file is linked into the kernel and, unchanged, into host
+// programs such as bench-runqueue (see bench_runqueue.c), so it must
+// only use the kernel interfaces those programs stub out: cprintf,
+// initlock and the TRACE tracepoints.
+//
+// The caller serializes access, normally by holding skiplist->lock.
+
+#include "types.h"
 #include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
 #include "skiplist.h"
+#include "trace.h"
 
 #define NULL 0
-#define SKIPLIST_LEVELS 4
 
-int seed = 1234567;
+// Number of skip lists initialized, to give each its own seed.
+static uint nskiplists;
 
-struct skiplist * init_skiplist() {
-  struct skiplist * skiplist = (struct skiplist *) malloc(sizeof(struct skiplist));
+void init_skiplist(struct skiplist * skiplist) {
+  initlock(&skiplist->lock, "runqueue");
   skiplist->levels = SKIPLIST_LEVELS;
-  skiplist->headers = (struct node **) malloc(sizeof(struct node *) * (SKIPLIST_LEVELS)); // allocate N header;
+  skiplist->size = 0;
+  skiplist->min_deadline = 0;
+  skiplist->seed = 2463534242U + 0x9E3779B9U * nskiplists++;
 
   // Initialize header nodes
   for (int i = 0; i < SKIPLIST_LEVELS; i++) {
-    skiplist->headers[i] = (struct node *) malloc(sizeof(struct node));
-    skiplist->headers[i]->pid = -1;
-    skiplist->headers[i]->virtual_deadline = -1;
-    skiplist->headers[i]->next = NULL;
-    skiplist->headers[i]->prev = NULL;
-    if (i > 0) {
-      skiplist->headers[i]->forward = skiplist->headers[i-1];
-    }
+    skiplist->headers[i].proc = NULL;
+    skiplist->headers[i].virtual_deadline = 0;
+    skiplist->headers[i].next = NULL;
+    skiplist->headers[i].prev = NULL;
+    skiplist->headers[i].forward = (i > 0) ? &skiplist->headers[i-1] : NULL;
+    skiplist->tails[i] = &skiplist->headers[i];
   }
-
-  return skiplist;
 }
 
 
 
-struct node * insert_to_level(int pid, int virtual_deadline, struct node * prev_node, struct node * forward) {
-  struct node * new_node = (struct node *) malloc(sizeof(struct node));
-  new_node->pid = pid;
+// Link a process's own node for one level in after prev_node.
+// Nodes live in struct proc, so nothing is allocated here.
+static void insert_to_level(struct node * new_node, struct proc * p, uint64 virtual_deadline, struct node * prev_node, struct node * forward) {
+  new_node->proc = p;
   new_node->virtual_deadline = virtual_deadline;
 
   struct node * next_node = prev_node->next;
@@ -46,49 +58,79 @@ struct node * insert_to_level(int pid, int virtual_deadline, struct node * prev_
   if (next_node != NULL) {
     next_node->prev = new_node;
   }
+}
 
-  return new_node;
+// xorshift32 on the skip list's own state.  The state lives in
+// the skip list, under its lock, rather than in one global that
+// every CPU's inserts would write.
+static uint random(struct skiplist * skiplist) {
+  uint x = skiplist->seed;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  skiplist->seed = x;
+  return x;
 }
 
-unsigned int random(int max) {
-  seed ^= seed << 17;
-  seed ^= seed >> 7;
-  seed ^= seed << 5;
-  return seed % max;
+// Draw a node's top level: level k with probability (3/4)(1/4)^k,
+// capped at the skip list's top level.  Each pair of trailing zero
+// bits in a uniform random word is a promotion with probability
+// exactly 1/4; xorshift32 never returns 0.
+static int randomize_max_level(struct skiplist * skiplist) {
+  int insertion_max_level = __builtin_ctz(random(skiplist)) / 2;
+
+  if (insertion_max_level > skiplist->levels - 1) {
+    insertion_max_level = skiplist->levels - 1;
+  }
+  return insertion_max_level;
 }
 
-int randomize_max_level(int skiplist_max_level) {
-  int insertion_max_level = 0;
-  while (insertion_max_level <= skiplist_max_level) {
-    int x = random(4);
-    if (x == 0) {
-      insertion_max_level++;
-    } else {
-      break;
+void print_skiplist(struct skiplist * skiplist) {
+  int current_level = skiplist->levels - 1;
+
+  while (current_level >= 0) {
+    struct node * current_node = &skiplist->headers[current_level];
+    cprintf("level %d: ", current_level);
+    while (current_node != NULL) {
+      cprintf("%d(pid:%d) -> ", (uint)current_node->virtual_deadline, current_node->proc ? current_node->proc->pid : -1);
+      current_node = current_node->next;
     }
+    cprintf("\n");
+    current_level--;
   }
-  return insertion_max_level;
+
 }
 
-void insert_node(struct skiplist * skiplist, int pid, int virtual_deadline) {
+void insert_node(struct skiplist * skiplist, struct proc * p) {
 
-  int insertion_max_level = randomize_max_level(skiplist->levels - 1); // TO DO: randomize
+  p->max_level = randomize_max_level(skiplist);
 
-  struct node * prev_nodes[insertion_max_level + 1];
+  struct node * prev_nodes[p->max_level + 1];
 
   int current_level = skiplist->levels - 1;
 
-  struct node * current_node = skiplist->headers[current_level];
-  
+  struct node * current_node = &skiplist->headers[current_level];
+
+  // Deadlines are ticks plus an offset, so a new one usually sorts
+  // after everything queued: append to each level without searching.
+  struct node * last = skiplist->tails[0];
+  if (last == &skiplist->headers[0] || p->virtual_deadline >= last->virtual_deadline) {
+    for (current_level = 0; current_level <= p->max_level; current_level++) {
+      prev_nodes[current_level] = skiplist->tails[current_level];
+    }
+    current_level = -1;
+  }
+
   // Find previous nodes to insert per level
   while (current_level >= 0) {
     // Find previous node in a level
-    while (!(current_node->next == NULL || virtual_deadline <= current_node->next->virtual_deadline)) { 
+    while (current_node->next != NULL && p->virtual_deadline >= current_node->next->virtual_deadline) {
       current_node = current_node->next;
     }
-    
+
     // Store previous node if within max level
-    if (insertion_max_level >= current_level) {
+    if (p->max_level >= current_level) {
       prev_nodes[current_level] = current_node;
     }
 
@@ -97,132 +139,73 @@ void insert_node(struct skiplist * skiplist, int pid, int virtual_deadline) {
 
     current_level--;
   }
-  
+
   // Insert new nodes given previous nodees per level
   current_level = 0;
   struct node * forward = NULL;
-  while (current_level <= insertion_max_level) {
-    
-    forward = insert_to_level(pid, virtual_deadline, prev_nodes[current_level], forward);
-
-    current_level++;
-  }
-  cprintf("inserted|[%d]%d\n", pid, insertion_max_level);
-}
-
-void delete_from_levels(struct node * node) {
-  struct node * current_node = node;
+  while (current_level <= p->max_level) {
 
-  while (current_node != NULL) {
-    struct node * next_to_delete = current_node->forward;
-    struct node * next = current_node->next;
-    struct node * prev = current_node->prev;
-
-    prev->next = next;
-    if (next != NULL) {
-      next->prev = prev;
+    insert_to_level(&p->nodes[current_level], p, p->virtual_deadline, prev_nodes[current_level], forward);
+    forward = &p->nodes[current_level];
+    if (forward->next == NULL) {
+      skiplist->tails[current_level] = forward;
     }
 
-    free(current_node);
-    
-    current_node = next_to_delete;
+    current_level++;
   }
+  p->runqueue = skiplist;
+  skiplist->size++;
+  skiplist->min_deadline = skiplist->headers[0].next->virtual_deadline;
+  TRACE(TRACE_RUNQUEUE, "inserted|[%d]%d\n", p->pid, p->max_level);
 }
 
-void delete_node(struct skiplist * skiplist, int pid, int virtual_deadline) {
-  
+// Unlink p's node from every level it occupies.  The nodes are
+// embedded in p, so no search is needed to find them.
+static void unlink_node(struct skiplist * skiplist, struct proc * p) {
+  for (int level = 0; level <= p->max_level; level++) {
+    struct node * node = &p->nodes[level];
 
-  // Start at header of top level
-  int current_level = skiplist->levels - 1;
-  struct node * current_node = skiplist->headers[skiplist->levels - 1];
-
-  while (current_level >= 0) {
-    while (current_node->virtual_deadline < virtual_deadline && current_node->pid != pid) { // TO DO: handle null case
-      if (current_node->virtual_deadline > virtual_deadline  || current_node->next == NULL) {
-        break;
-      }
-      current_node = current_node->next;
-    }
-
-    if (current_node->pid == pid && current_node->virtual_deadline == virtual_deadline) {
-      // Case where node to delete is already found
-      break;
+    node->prev->next = node->next;
+    if (node->next != NULL) {
+      node->next->prev = node->prev;
     } else {
-      while (current_node->virtual_deadline > virtual_deadline) {
-        current_node = current_node->prev;
-      }
-      current_node = current_node->forward;
-      current_level--;
+      skiplist->tails[level] = node->prev;
     }
   }
-
-  delete_from_levels(current_node);
-  cprintf("removed|[%d]%d\n", pid, current_level);
+  skiplist->size--;
+  if (skiplist->headers[0].next != NULL) {
+    skiplist->min_deadline = skiplist->headers[0].next->virtual_deadline;
+  }
+  TRACE(TRACE_RUNQUEUE, "removed|[%d]%d\n", p->pid, p->max_level);
+  p->max_level = -1;
+  p->runqueue = NULL;
 }
 
-int get_minimum(struct skiplist * skiplist) {
-  return skiplist->headers[0]->next->pid;
+void delete_node(struct skiplist * skiplist, struct proc * p) {
+  if (p->runqueue == skiplist) {
+    unlink_node(skiplist, p);
+  }
 }
 
-void print_skiplist(struct skiplist * skiplist) {
-  int current_level = skiplist->levels - 1;
-
-  while (current_level >= 0) {
-    struct node * current_node = skiplist->headers[current_level];
-    cprintf("level %d: ", current_level);
-    while (current_node != NULL) {
-      cprintf("%d(pid:%d) -> ", current_node->virtual_deadline, current_node->pid);
-      current_node = current_node->next;
-    }
-    cprintf("\n");
-    current_level--;
+// Return the process with the earliest virtual deadline,
+// or NULL if the skip list is empty.
+struct proc * get_minimum(struct skiplist * skiplist) {
+  if (skiplist->headers[0].next != NULL) {
+    return skiplist->headers[0].next->proc;
   }
-  
+  return NULL;
 }
 
-// int main() {
-//   // Initialize Skiplist
-//   struct skiplist * skiplist = init_skiplist();
-
-//   print_skiplist(skiplist);
-//   printf("\n");
-
-//   // Insert Nodes
-//   insert_node(skiplist, 3, 1000);
-//   print_skiplist(skiplist);
-//   printf("\n");
-
-//   insert_node(skiplist, 4, 1002);
-//   print_skiplist(skiplist);
-//   printf("\n");
-
-//   insert_node(skiplist, 5, 1001);
-//   print_skiplist(skiplist);
-//   printf("\n");
-
-//   insert_node(skiplist, 6, 100);
-//   print_skiplist(skiplist);
-//   printf("\n");
+// Remove and return the process with the earliest virtual deadline,
+// or NULL if the skip list is empty.  It is first on every level it
+// occupies, so this is O(1) in the size of the list.
+struct proc * pop_min(struct skiplist * skiplist) {
+  struct proc * p;
 
-//   insert_node(skiplist, 7, 1008);
-//   print_skiplist(skiplist);
-//   printf("\n");
-
-//   insert_node(skiplist, 8, 1007);
-//   print_skiplist(skiplist);
-//   printf("\n");
-
-
-
-//   // Delete Nodes
-//   delete_node(skiplist, 5, 1001);
-//   print_skiplist(skiplist);
-//   printf("\n");
-
-//   printf("minimum pid: %d\n", get_minimum(skiplist));
-//   printf("\n");
-
-//   delete_node(skiplist, 6, 100);
-//   print_skiplist(skiplist);
-//   printf("\n");
-// }
\ No newline at end of file
+  if (skiplist->headers[0].next == NULL) {
+    return NULL;
+  }
+  p = skiplist->headers[0].next->proc;
+  unlink_node(skiplist, p);
+  return p;
+}
\ No newline at end of file
@@ -1,18 +1,32 @@
-struct node {
-  int pid;
-  int virtual_deadline;
-  struct node * prev;
-  struct node * next;
-  struct node * forward;
-};
+// struct node is defined in proc.h: the per-level links are
+// embedded in struct proc rather than allocated.
 
+// A runqueue.  The kernel is built with one of two implementations
+// of this interface: the skip list in skiplist.c, or with
+// BUCKET_RUNQUEUE defined (make RUNQUEUE=buckets), the bitmap-indexed
+// deadline buckets in buckets.c.
 struct skiplist {
+  struct spinlock lock;        // Protects everything below
+  // size and min_deadline may be read without the lock as hints;
+  // an unlocked read of min_deadline can even be torn
+  volatile int size;           // Number of queued processes
+  volatile uint64 min_deadline; // Head's deadline when size > 0
+#ifdef BUCKET_RUNQUEUE
+  uint64 base;                 // Bucket number of the window's first bucket
+  uint bitmap[RUNQUEUE_BUCKETS / 32]; // Non-empty buckets
+  struct node buckets[RUNQUEUE_BUCKETS]; // List heads, prev is the tail
+  struct node overflow;        // Deadlines past the window
+#else
   int levels;
-  struct node ** headers;
+  uint seed;                   // Level randomization state
+  struct node headers[SKIPLIST_LEVELS];
+  struct node * tails[SKIPLIST_LEVELS]; // Last node per level, the header if empty
+#endif
 };
 
-struct skiplist * init_skiplist();
+void init_skiplist(struct skiplist * skiplist);
 void insert_node(struct skiplist * skiplist, struct proc * p);
 void delete_node(struct skiplist * skiplist, struct proc * p);
-int get_minimum(struct skiplist * skiplist);
+struct proc * get_minimum(struct skiplist * skiplist);
+struct proc * pop_min(struct skiplist * skiplist);
 void print_skiplist(struct skiplist * skiplist);
\ No newline at end of file
@@ -107,6 +107,16 @@ extern int sys_yield(void);
 extern int sys_shutdown(void);
 extern int sys_schedlog(void);
 extern int sys_nicefork(void);
+extern int sys_schedlogread(void);
+extern int sys_tracectl(void);
+extern int sys_getcpustat(void);
+extern int sys_setpolicy(void);
+extern int sys_affinity(void);
+extern int sys_setnice(void);
+extern int sys_getnice(void);
+extern int sys_setclass(void);
+extern int sys_isocpu(void);
+extern int sys_getschedstats(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -133,7 +143,17 @@ static int (*syscalls[])(void) = {
 [SYS_yield] sys_yield,
 [SYS_shutdown] sys_shutdown,
 [SYS_schedlog] sys_schedlog,
-[SYS_nicefork] sys_nicefork
+[SYS_nicefork] sys_nicefork,
+[SYS_schedlogread] sys_schedlogread,
+[SYS_tracectl] sys_tracectl,
+[SYS_getcpustat] sys_getcpustat,
+[SYS_setpolicy] sys_setpolicy,
+[SYS_affinity] sys_affinity,
+[SYS_setnice] sys_setnice,
+[SYS_getnice] sys_getnice,
+[SYS_setclass] sys_setclass,
+[SYS_isocpu] sys_isocpu,
+[SYS_getschedstats] sys_getschedstats,
 };
 
 void
@@ -23,4 +23,14 @@
 #define SYS_yield     22
 #define SYS_shutdown  23
 #define SYS_nicefork  24
-#define SYS_schedlog  25
\ No newline at end of file
+#define SYS_schedlog  25
+#define SYS_schedlogread 26
+#define SYS_tracectl 27
+#define SYS_getcpustat 28
+#define SYS_setpolicy 29
+#define SYS_affinity 30
+#define SYS_setnice 31
+#define SYS_getnice 32
+#define SYS_setclass 33
+#define SYS_isocpu 34
+#define SYS_getschedstats 35
@@ -6,6 +6,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "sched.h"
+#include "trace.h"
 
 int
 sys_fork(void)
@@ -113,6 +115,21 @@ int sys_schedlog(void) {
   return 0;
 }
 
+int sys_schedlogread(void)
+{
+  struct schedevent *buf;
+  int n;
+
+  if(argint(1, &n) < 0)
+    return -1;
+  if(n > NCPU*NSCHEDLOG)
+    n = NCPU*NSCHEDLOG;
+  if(argptr(0, (void*)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+
+  return schedlogread(buf, n);
+}
+
 int sys_nicefork(void)
 {
   int nice_value;
@@ -122,3 +139,103 @@ int sys_nicefork(void)
 
   return nicefork(nice_value);
 }
+
+// Set the enabled tracepoint categories (TRACE_* in trace.h)
+// and return the previous set, or -1 if tracepoints were
+// compiled out.
+int sys_tracectl(void)
+{
+  int mask;
+
+  if(argint(0, &mask) < 0)
+    return -1;
+#ifdef NOTRACE
+  return -1;
+#else
+  int old = trace_mask;
+  trace_mask = mask;
+  return old;
+#endif
+}
+
+int sys_getcpustat(void)
+{
+  int n;
+  struct cpustat *st;
+
+  if(argint(0, &n) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+
+  return getcpustat(n, st);
+}
+
+int sys_setpolicy(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+
+  return setpolicy(n);
+}
+
+int sys_affinity(void)
+{
+  int window;
+
+  if(argint(0, &window) < 0)
+    return -1;
+
+  return affinity(window);
+}
+
+int sys_setnice(void)
+{
+  int pid, value;
+
+  if(argint(0, &pid) < 0 || argint(1, &value) < 0)
+    return -1;
+
+  return setnice(pid, value);
+}
+
+int sys_getnice(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return NICE_NOPROC;
+
+  return getnice(pid);
+}
+
+int sys_setclass(void)
+{
+  int pid, class;
+
+  if(argint(0, &pid) < 0 || argint(1, &class) < 0)
+    return -1;
+
+  return setclass(pid, class);
+}
+
+int sys_isocpu(void)
+{
+  int percent;
+
+  if(argint(0, &percent) < 0)
+    return -1;
+
+  return isocpu(percent);
+}
+
+int sys_getschedstats(void)
+{
+  int pid;
+  struct schedstat *st;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+
+  return getschedstats(pid, st);
+}
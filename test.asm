@@ -0,0 +1,307 @@
+
+_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+int main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 2c             	sub    $0x2c,%esp
+  int nice_levels[3] = {-5, 0, 5};
+  12:	c7 45 ec fb ff ff ff 	movl   $0xfffffffb,-0x14(%ebp)
+  19:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  20:	c7 45 f4 05 00 00 00 	movl   $0x5,-0xc(%ebp)
+  schedlog(10000);
+  27:	68 10 27 00 00       	push   $0x2710
+  2c:	e8 63 01 00 00       	call   194 <schedlog>
+  for (int i = 0; i < 3; i++) {
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  39:	eb 03                	jmp    3e <main+0x3e>
+  3b:	83 c3 01             	add    $0x1,%ebx
+  3e:	83 fb 02             	cmp    $0x2,%ebx
+  41:	7f 37                	jg     7a <main+0x7a>
+    if (nicefork(nice_levels[i]) == 0) {
+  43:	83 ec 0c             	sub    $0xc,%esp
+  46:	ff 74 9d ec          	push   -0x14(%ebp,%ebx,4)
+  4a:	e8 3d 01 00 00       	call   18c <nicefork>
+  4f:	83 c4 10             	add    $0x10,%esp
+  52:	85 c0                	test   %eax,%eax
+  54:	75 e5                	jne    3b <main+0x3b>
+      char *argv[] = {"loop", 0};
+  56:	c7 45 e4 ec 01 00 00 	movl   $0x1ec,-0x1c(%ebp)
+  5d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      exec("loop", argv);
+  64:	83 ec 08             	sub    $0x8,%esp
+  67:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  6a:	50                   	push   %eax
+  6b:	68 ec 01 00 00       	push   $0x1ec
+  70:	e8 9f 00 00 00       	call   114 <exec>
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	eb c1                	jmp    3b <main+0x3b>
+    }
+  }
+  for (int i = 0; i < 3; i++) {
+  7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  7f:	eb 08                	jmp    89 <main+0x89>
+    wait();
+  81:	e8 5e 00 00 00       	call   e4 <wait>
+  for (int i = 0; i < 3; i++) {
+  86:	83 c3 01             	add    $0x1,%ebx
+  89:	83 fb 02             	cmp    $0x2,%ebx
+  8c:	7e f3                	jle    81 <main+0x81>
+  }
+  if (fork() == 0) {
+  8e:	e8 41 00 00 00       	call   d4 <fork>
+  93:	85 c0                	test   %eax,%eax
+  95:	74 19                	je     b0 <main+0xb0>
+    char *argv[] = {"schedtrace", 0};
+    exec("schedtrace", argv);
+  }
+  wait();
+  97:	e8 48 00 00 00       	call   e4 <wait>
+  shutdown();
+  9c:	e8 e3 00 00 00       	call   184 <shutdown>
+}
+  a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  a9:	59                   	pop    %ecx
+  aa:	5b                   	pop    %ebx
+  ab:	5d                   	pop    %ebp
+  ac:	8d 61 fc             	lea    -0x4(%ecx),%esp
+  af:	c3                   	ret
+    char *argv[] = {"schedtrace", 0};
+  b0:	c7 45 e4 f1 01 00 00 	movl   $0x1f1,-0x1c(%ebp)
+  b7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    exec("schedtrace", argv);
+  be:	83 ec 08             	sub    $0x8,%esp
+  c1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  c4:	50                   	push   %eax
+  c5:	68 f1 01 00 00       	push   $0x1f1
+  ca:	e8 45 00 00 00       	call   114 <exec>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	eb c3                	jmp    97 <main+0x97>
+
+000000d4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  d9:	cd 40                	int    $0x40
+  db:	c3                   	ret
+
+000000dc <exit>:
+SYSCALL(exit)
+  dc:	b8 02 00 00 00       	mov    $0x2,%eax
+  e1:	cd 40                	int    $0x40
+  e3:	c3                   	ret
+
+000000e4 <wait>:
+SYSCALL(wait)
+  e4:	b8 03 00 00 00       	mov    $0x3,%eax
+  e9:	cd 40                	int    $0x40
+  eb:	c3                   	ret
+
+000000ec <pipe>:
+SYSCALL(pipe)
+  ec:	b8 04 00 00 00       	mov    $0x4,%eax
+  f1:	cd 40                	int    $0x40
+  f3:	c3                   	ret
+
+000000f4 <read>:
+SYSCALL(read)
+  f4:	b8 05 00 00 00       	mov    $0x5,%eax
+  f9:	cd 40                	int    $0x40
+  fb:	c3                   	ret
+
+000000fc <write>:
+SYSCALL(write)
+  fc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 101:	cd 40                	int    $0x40
+ 103:	c3                   	ret
+
+00000104 <close>:
+SYSCALL(close)
+ 104:	b8 15 00 00 00       	mov    $0x15,%eax
+ 109:	cd 40                	int    $0x40
+ 10b:	c3                   	ret
+
+0000010c <kill>:
+SYSCALL(kill)
+ 10c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 111:	cd 40                	int    $0x40
+ 113:	c3                   	ret
+
+00000114 <exec>:
+SYSCALL(exec)
+ 114:	b8 07 00 00 00       	mov    $0x7,%eax
+ 119:	cd 40                	int    $0x40
+ 11b:	c3                   	ret
+
+0000011c <open>:
+SYSCALL(open)
+ 11c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 121:	cd 40                	int    $0x40
+ 123:	c3                   	ret
+
+00000124 <mknod>:
+SYSCALL(mknod)
+ 124:	b8 11 00 00 00       	mov    $0x11,%eax
+ 129:	cd 40                	int    $0x40
+ 12b:	c3                   	ret
+
+0000012c <unlink>:
+SYSCALL(unlink)
+ 12c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 131:	cd 40                	int    $0x40
+ 133:	c3                   	ret
+
+00000134 <fstat>:
+SYSCALL(fstat)
+ 134:	b8 08 00 00 00       	mov    $0x8,%eax
+ 139:	cd 40                	int    $0x40
+ 13b:	c3                   	ret
+
+0000013c <link>:
+SYSCALL(link)
+ 13c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 141:	cd 40                	int    $0x40
+ 143:	c3                   	ret
+
+00000144 <mkdir>:
+SYSCALL(mkdir)
+ 144:	b8 14 00 00 00       	mov    $0x14,%eax
+ 149:	cd 40                	int    $0x40
+ 14b:	c3                   	ret
+
+0000014c <chdir>:
+SYSCALL(chdir)
+ 14c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 151:	cd 40                	int    $0x40
+ 153:	c3                   	ret
+
+00000154 <dup>:
+SYSCALL(dup)
+ 154:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 159:	cd 40                	int    $0x40
+ 15b:	c3                   	ret
+
+0000015c <getpid>:
+SYSCALL(getpid)
+ 15c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 161:	cd 40                	int    $0x40
+ 163:	c3                   	ret
+
+00000164 <sbrk>:
+SYSCALL(sbrk)
+ 164:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 169:	cd 40                	int    $0x40
+ 16b:	c3                   	ret
+
+0000016c <sleep>:
+SYSCALL(sleep)
+ 16c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 171:	cd 40                	int    $0x40
+ 173:	c3                   	ret
+
+00000174 <uptime>:
+SYSCALL(uptime)
+ 174:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 179:	cd 40                	int    $0x40
+ 17b:	c3                   	ret
+
+0000017c <yield>:
+SYSCALL(yield)
+ 17c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 181:	cd 40                	int    $0x40
+ 183:	c3                   	ret
+
+00000184 <shutdown>:
+SYSCALL(shutdown)
+ 184:	b8 17 00 00 00       	mov    $0x17,%eax
+ 189:	cd 40                	int    $0x40
+ 18b:	c3                   	ret
+
+0000018c <nicefork>:
+SYSCALL(nicefork)
+ 18c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 191:	cd 40                	int    $0x40
+ 193:	c3                   	ret
+
+00000194 <schedlog>:
+SYSCALL(schedlog)
+ 194:	b8 19 00 00 00       	mov    $0x19,%eax
+ 199:	cd 40                	int    $0x40
+ 19b:	c3                   	ret
+
+0000019c <schedlogread>:
+SYSCALL(schedlogread)
+ 19c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1a1:	cd 40                	int    $0x40
+ 1a3:	c3                   	ret
+
+000001a4 <tracectl>:
+SYSCALL(tracectl)
+ 1a4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1a9:	cd 40                	int    $0x40
+ 1ab:	c3                   	ret
+
+000001ac <getcpustat>:
+SYSCALL(getcpustat)
+ 1ac:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1b1:	cd 40                	int    $0x40
+ 1b3:	c3                   	ret
+
+000001b4 <setpolicy>:
+SYSCALL(setpolicy)
+ 1b4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 1b9:	cd 40                	int    $0x40
+ 1bb:	c3                   	ret
+
+000001bc <affinity>:
+SYSCALL(affinity)
+ 1bc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 1c1:	cd 40                	int    $0x40
+ 1c3:	c3                   	ret
+
+000001c4 <setnice>:
+SYSCALL(setnice)
+ 1c4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 1c9:	cd 40                	int    $0x40
+ 1cb:	c3                   	ret
+
+000001cc <getnice>:
+SYSCALL(getnice)
+ 1cc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 1d1:	cd 40                	int    $0x40
+ 1d3:	c3                   	ret
+
+000001d4 <setclass>:
+SYSCALL(setclass)
+ 1d4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 1d9:	cd 40                	int    $0x40
+ 1db:	c3                   	ret
+
+000001dc <isocpu>:
+SYSCALL(isocpu)
+ 1dc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 1e1:	cd 40                	int    $0x40
+ 1e3:	c3                   	ret
+
+000001e4 <getschedstats>:
+SYSCALL(getschedstats)
+ 1e4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 1e9:	cd 40                	int    $0x40
+ 1eb:	c3                   	ret
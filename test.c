@@ -12,5 +12,10 @@ int main() {
   for (int i = 0; i < 3; i++) {
     wait();
   }
+  if (fork() == 0) {
+    char *argv[] = {"schedtrace", 0};
+    exec("schedtrace", argv);
+  }
+  wait();
   shutdown();
 }
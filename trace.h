@@ -0,0 +1,17 @@
+// Kernel tracepoints.
+//
+// TRACE(TRACE_RUNQUEUE, fmt, ...) prints with cprintf when the
+// TRACE_RUNQUEUE bit is set in trace_mask, which the tracectl
+// system call changes at run time.  A performance build (make
+// PERF=1 defines NOTRACE) compiles every tracepoint away, so hot
+// scheduler paths pay nothing for them.
+
+#define TRACE_RUNQUEUE  0x1   // skip list inserts and removals
+#define TRACE_DEFAULT   TRACE_RUNQUEUE
+
+#ifdef NOTRACE
+#define TRACE(cat, ...) do { if(0) cprintf(__VA_ARGS__); } while(0)
+#else
+extern uint trace_mask;
+#define TRACE(cat, ...) do { if(trace_mask & (cat)) cprintf(__VA_ARGS__); } while(0)
+#endif
@@ -13,6 +13,38 @@ struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
+volatile uint64 ticks64;        // ticks, but never wraps; see readticks64()
+static volatile uint ticks64seq;  // odd while ticks64 is being updated
+uint tsc_per_tick = 10000000;  // TSC cycles per tick, calibrated by CPU 0
+
+// Track the TSC cycles per timer tick as a moving average, so
+// runtime measured in cycles can be related to ticks.
+static void
+calibratetsc(void)
+{
+  static uint64 last;
+  uint64 now = rdtsc();
+  uint delta = now - last;
+
+  if(last != 0)
+    tsc_per_tick = tsc_per_tick - tsc_per_tick/4 + delta/4;
+  last = now;
+}
+
+// Read ticks64.  Loading it takes two 32-bit loads, so CPU 0 could
+// update it halfway through; the sequence count detects that.
+uint64
+readticks64(void)
+{
+  uint seq;
+  uint64 t;
+
+  do{
+    seq = ticks64seq;
+    t = ticks64;
+  } while((seq & 1) || seq != ticks64seq);
+  return t;
+}
 
 void
 tvinit(void)
@@ -43,17 +75,29 @@ trap(struct trapframe *tf)
     syscall();
     if(myproc()->killed)
       exit();
+    checkresched();
     return;
   }
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
     if(cpuid() == 0){
+      calibratetsc();
       acquire(&tickslock);
       ticks++;
+      ticks64seq++;
+      ticks64++;
+      ticks64seq++;
       wakeup(&ticks);
       release(&tickslock);
+      isotick();
     }
+    mycpu()->ticks++;
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_RESCHED:
+    // Sent by kick_idle_cpu() to wake this CPU from idle(), or by
+    // preempt_for() to make it reschedule (see checkresched()).
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -104,10 +148,11 @@ trap(struct trapframe *tf)
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
      tf->trapno == T_IRQ0+IRQ_TIMER)
-    if (--myproc()->ticks_left == 0) {
+    if(schedtick(myproc()))
       yield();
-    }
-    
+
+  // Or because a wakeup asked for this CPU.
+  checkresched();
 
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
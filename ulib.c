@@ -104,3 +104,25 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Return x / d and store x % d in *rem.  User programs are not
+// linked with libgcc, which the compiler calls for 64-bit
+// division, so divide one bit at a time.
+uint64
+divmod64(uint64 x, uint d, uint *rem)
+{
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+  for(i = 63; i >= 0; i--){
+    r = (r << 1) | ((x >> i) & 1);
+    q <<= 1;
+    if(r >= d){
+      r -= d;
+      q |= 1;
+    }
+  }
+  *rem = r;
+  return q;
+}
@@ -1,6 +1,9 @@
 #include "param.h"
 struct stat;
 struct rtcdate;
+struct cpustat;
+struct schedevent;
+struct schedstat;
 
 // system calls
 int fork(void);
@@ -28,6 +31,16 @@ int yield(void);
 int shutdown(void);
 int nicefork(int);
 int schedlog(int);
+int schedlogread(struct schedevent*, int);
+int tracectl(int);
+int getcpustat(int, struct cpustat*);
+int setpolicy(int);
+int affinity(int);
+int setnice(int, int);
+int getnice(int);
+int setclass(int, int);
+int isocpu(int);
+int getschedstats(int, struct schedstat*);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -42,3 +55,4 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+uint64 divmod64(uint64, uint, uint*);
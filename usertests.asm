@@ -0,0 +1,7158 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+       6:	68 14 3c 00 00       	push   $0x3c14
+       b:	ff 35 90 53 00 00    	push   0x5390
+      11:	e8 ba 38 00 00       	call   38d0 <printf>
+
+  if(mkdir("iputdir") < 0){
+      16:	c7 04 24 a7 3b 00 00 	movl   $0x3ba7,(%esp)
+      1d:	e8 61 37 00 00       	call   3783 <mkdir>
+      22:	83 c4 10             	add    $0x10,%esp
+      25:	85 c0                	test   %eax,%eax
+      27:	78 54                	js     7d <iputtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+  if(chdir("iputdir") < 0){
+      29:	83 ec 0c             	sub    $0xc,%esp
+      2c:	68 a7 3b 00 00       	push   $0x3ba7
+      31:	e8 55 37 00 00       	call   378b <chdir>
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	85 c0                	test   %eax,%eax
+      3b:	78 58                	js     95 <iputtest+0x95>
+    printf(stdout, "chdir iputdir failed\n");
+    exit();
+  }
+  if(unlink("../iputdir") < 0){
+      3d:	83 ec 0c             	sub    $0xc,%esp
+      40:	68 a4 3b 00 00       	push   $0x3ba4
+      45:	e8 21 37 00 00       	call   376b <unlink>
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	85 c0                	test   %eax,%eax
+      4f:	78 5c                	js     ad <iputtest+0xad>
+    printf(stdout, "unlink ../iputdir failed\n");
+    exit();
+  }
+  if(chdir("/") < 0){
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	68 c9 3b 00 00       	push   $0x3bc9
+      59:	e8 2d 37 00 00       	call   378b <chdir>
+      5e:	83 c4 10             	add    $0x10,%esp
+      61:	85 c0                	test   %eax,%eax
+      63:	78 60                	js     c5 <iputtest+0xc5>
+    printf(stdout, "chdir / failed\n");
+    exit();
+  }
+  printf(stdout, "iput test ok\n");
+      65:	83 ec 08             	sub    $0x8,%esp
+      68:	68 4c 3c 00 00       	push   $0x3c4c
+      6d:	ff 35 90 53 00 00    	push   0x5390
+      73:	e8 58 38 00 00       	call   38d0 <printf>
+}
+      78:	83 c4 10             	add    $0x10,%esp
+      7b:	c9                   	leave
+      7c:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+      7d:	83 ec 08             	sub    $0x8,%esp
+      80:	68 80 3b 00 00       	push   $0x3b80
+      85:	ff 35 90 53 00 00    	push   0x5390
+      8b:	e8 40 38 00 00       	call   38d0 <printf>
+    exit();
+      90:	e8 86 36 00 00       	call   371b <exit>
+    printf(stdout, "chdir iputdir failed\n");
+      95:	83 ec 08             	sub    $0x8,%esp
+      98:	68 8e 3b 00 00       	push   $0x3b8e
+      9d:	ff 35 90 53 00 00    	push   0x5390
+      a3:	e8 28 38 00 00       	call   38d0 <printf>
+    exit();
+      a8:	e8 6e 36 00 00       	call   371b <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	68 af 3b 00 00       	push   $0x3baf
+      b5:	ff 35 90 53 00 00    	push   0x5390
+      bb:	e8 10 38 00 00       	call   38d0 <printf>
+    exit();
+      c0:	e8 56 36 00 00       	call   371b <exit>
+    printf(stdout, "chdir / failed\n");
+      c5:	83 ec 08             	sub    $0x8,%esp
+      c8:	68 cb 3b 00 00       	push   $0x3bcb
+      cd:	ff 35 90 53 00 00    	push   0x5390
+      d3:	e8 f8 37 00 00       	call   38d0 <printf>
+    exit();
+      d8:	e8 3e 36 00 00       	call   371b <exit>
+
+000000dd <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      dd:	55                   	push   %ebp
+      de:	89 e5                	mov    %esp,%ebp
+      e0:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      e3:	68 db 3b 00 00       	push   $0x3bdb
+      e8:	ff 35 90 53 00 00    	push   0x5390
+      ee:	e8 dd 37 00 00       	call   38d0 <printf>
+
+  pid = fork();
+      f3:	e8 1b 36 00 00       	call   3713 <fork>
+  if(pid < 0){
+      f8:	83 c4 10             	add    $0x10,%esp
+      fb:	85 c0                	test   %eax,%eax
+      fd:	78 47                	js     146 <exitiputtest+0x69>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+      ff:	0f 85 a1 00 00 00    	jne    1a6 <exitiputtest+0xc9>
+    if(mkdir("iputdir") < 0){
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	68 a7 3b 00 00       	push   $0x3ba7
+     10d:	e8 71 36 00 00       	call   3783 <mkdir>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	78 45                	js     15e <exitiputtest+0x81>
+      printf(stdout, "mkdir failed\n");
+      exit();
+    }
+    if(chdir("iputdir") < 0){
+     119:	83 ec 0c             	sub    $0xc,%esp
+     11c:	68 a7 3b 00 00       	push   $0x3ba7
+     121:	e8 65 36 00 00       	call   378b <chdir>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	85 c0                	test   %eax,%eax
+     12b:	78 49                	js     176 <exitiputtest+0x99>
+      printf(stdout, "child chdir failed\n");
+      exit();
+    }
+    if(unlink("../iputdir") < 0){
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	68 a4 3b 00 00       	push   $0x3ba4
+     135:	e8 31 36 00 00       	call   376b <unlink>
+     13a:	83 c4 10             	add    $0x10,%esp
+     13d:	85 c0                	test   %eax,%eax
+     13f:	78 4d                	js     18e <exitiputtest+0xb1>
+      printf(stdout, "unlink ../iputdir failed\n");
+      exit();
+    }
+    exit();
+     141:	e8 d5 35 00 00       	call   371b <exit>
+    printf(stdout, "fork failed\n");
+     146:	83 ec 08             	sub    $0x8,%esp
+     149:	68 c1 4a 00 00       	push   $0x4ac1
+     14e:	ff 35 90 53 00 00    	push   0x5390
+     154:	e8 77 37 00 00       	call   38d0 <printf>
+    exit();
+     159:	e8 bd 35 00 00       	call   371b <exit>
+      printf(stdout, "mkdir failed\n");
+     15e:	83 ec 08             	sub    $0x8,%esp
+     161:	68 80 3b 00 00       	push   $0x3b80
+     166:	ff 35 90 53 00 00    	push   0x5390
+     16c:	e8 5f 37 00 00       	call   38d0 <printf>
+      exit();
+     171:	e8 a5 35 00 00       	call   371b <exit>
+      printf(stdout, "child chdir failed\n");
+     176:	83 ec 08             	sub    $0x8,%esp
+     179:	68 ea 3b 00 00       	push   $0x3bea
+     17e:	ff 35 90 53 00 00    	push   0x5390
+     184:	e8 47 37 00 00       	call   38d0 <printf>
+      exit();
+     189:	e8 8d 35 00 00       	call   371b <exit>
+      printf(stdout, "unlink ../iputdir failed\n");
+     18e:	83 ec 08             	sub    $0x8,%esp
+     191:	68 af 3b 00 00       	push   $0x3baf
+     196:	ff 35 90 53 00 00    	push   0x5390
+     19c:	e8 2f 37 00 00       	call   38d0 <printf>
+      exit();
+     1a1:	e8 75 35 00 00       	call   371b <exit>
+  }
+  wait();
+     1a6:	e8 78 35 00 00       	call   3723 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1ab:	83 ec 08             	sub    $0x8,%esp
+     1ae:	68 fe 3b 00 00       	push   $0x3bfe
+     1b3:	ff 35 90 53 00 00    	push   0x5390
+     1b9:	e8 12 37 00 00       	call   38d0 <printf>
+}
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	c9                   	leave
+     1c2:	c3                   	ret
+
+000001c3 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1c3:	55                   	push   %ebp
+     1c4:	89 e5                	mov    %esp,%ebp
+     1c6:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1c9:	68 10 3c 00 00       	push   $0x3c10
+     1ce:	ff 35 90 53 00 00    	push   0x5390
+     1d4:	e8 f7 36 00 00       	call   38d0 <printf>
+  if(mkdir("oidir") < 0){
+     1d9:	c7 04 24 1f 3c 00 00 	movl   $0x3c1f,(%esp)
+     1e0:	e8 9e 35 00 00       	call   3783 <mkdir>
+     1e5:	83 c4 10             	add    $0x10,%esp
+     1e8:	85 c0                	test   %eax,%eax
+     1ea:	78 39                	js     225 <openiputtest+0x62>
+    printf(stdout, "mkdir oidir failed\n");
+    exit();
+  }
+  pid = fork();
+     1ec:	e8 22 35 00 00       	call   3713 <fork>
+  if(pid < 0){
+     1f1:	85 c0                	test   %eax,%eax
+     1f3:	78 48                	js     23d <openiputtest+0x7a>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     1f5:	75 63                	jne    25a <openiputtest+0x97>
+    int fd = open("oidir", O_RDWR);
+     1f7:	83 ec 08             	sub    $0x8,%esp
+     1fa:	6a 02                	push   $0x2
+     1fc:	68 1f 3c 00 00       	push   $0x3c1f
+     201:	e8 55 35 00 00       	call   375b <open>
+    if(fd >= 0){
+     206:	83 c4 10             	add    $0x10,%esp
+     209:	85 c0                	test   %eax,%eax
+     20b:	78 48                	js     255 <openiputtest+0x92>
+      printf(stdout, "open directory for write succeeded\n");
+     20d:	83 ec 08             	sub    $0x8,%esp
+     210:	68 a4 4b 00 00       	push   $0x4ba4
+     215:	ff 35 90 53 00 00    	push   0x5390
+     21b:	e8 b0 36 00 00       	call   38d0 <printf>
+      exit();
+     220:	e8 f6 34 00 00       	call   371b <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 25 3c 00 00       	push   $0x3c25
+     22d:	ff 35 90 53 00 00    	push   0x5390
+     233:	e8 98 36 00 00       	call   38d0 <printf>
+    exit();
+     238:	e8 de 34 00 00       	call   371b <exit>
+    printf(stdout, "fork failed\n");
+     23d:	83 ec 08             	sub    $0x8,%esp
+     240:	68 c1 4a 00 00       	push   $0x4ac1
+     245:	ff 35 90 53 00 00    	push   0x5390
+     24b:	e8 80 36 00 00       	call   38d0 <printf>
+    exit();
+     250:	e8 c6 34 00 00       	call   371b <exit>
+    }
+    exit();
+     255:	e8 c1 34 00 00       	call   371b <exit>
+  }
+  sleep(1);
+     25a:	83 ec 0c             	sub    $0xc,%esp
+     25d:	6a 01                	push   $0x1
+     25f:	e8 47 35 00 00       	call   37ab <sleep>
+  if(unlink("oidir") != 0){
+     264:	c7 04 24 1f 3c 00 00 	movl   $0x3c1f,(%esp)
+     26b:	e8 fb 34 00 00       	call   376b <unlink>
+     270:	83 c4 10             	add    $0x10,%esp
+     273:	85 c0                	test   %eax,%eax
+     275:	75 1d                	jne    294 <openiputtest+0xd1>
+    printf(stdout, "unlink failed\n");
+    exit();
+  }
+  wait();
+     277:	e8 a7 34 00 00       	call   3723 <wait>
+  printf(stdout, "openiput test ok\n");
+     27c:	83 ec 08             	sub    $0x8,%esp
+     27f:	68 48 3c 00 00       	push   $0x3c48
+     284:	ff 35 90 53 00 00    	push   0x5390
+     28a:	e8 41 36 00 00       	call   38d0 <printf>
+}
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	c9                   	leave
+     293:	c3                   	ret
+    printf(stdout, "unlink failed\n");
+     294:	83 ec 08             	sub    $0x8,%esp
+     297:	68 39 3c 00 00       	push   $0x3c39
+     29c:	ff 35 90 53 00 00    	push   0x5390
+     2a2:	e8 29 36 00 00       	call   38d0 <printf>
+    exit();
+     2a7:	e8 6f 34 00 00       	call   371b <exit>
+
+000002ac <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ac:	55                   	push   %ebp
+     2ad:	89 e5                	mov    %esp,%ebp
+     2af:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     2b2:	68 5a 3c 00 00       	push   $0x3c5a
+     2b7:	ff 35 90 53 00 00    	push   0x5390
+     2bd:	e8 0e 36 00 00       	call   38d0 <printf>
+  fd = open("echo", 0);
+     2c2:	83 c4 08             	add    $0x8,%esp
+     2c5:	6a 00                	push   $0x0
+     2c7:	68 65 3c 00 00       	push   $0x3c65
+     2cc:	e8 8a 34 00 00       	call   375b <open>
+  if(fd < 0){
+     2d1:	83 c4 10             	add    $0x10,%esp
+     2d4:	85 c0                	test   %eax,%eax
+     2d6:	78 37                	js     30f <opentest+0x63>
+    printf(stdout, "open echo failed!\n");
+    exit();
+  }
+  close(fd);
+     2d8:	83 ec 0c             	sub    $0xc,%esp
+     2db:	50                   	push   %eax
+     2dc:	e8 62 34 00 00       	call   3743 <close>
+  fd = open("doesnotexist", 0);
+     2e1:	83 c4 08             	add    $0x8,%esp
+     2e4:	6a 00                	push   $0x0
+     2e6:	68 7d 3c 00 00       	push   $0x3c7d
+     2eb:	e8 6b 34 00 00       	call   375b <open>
+  if(fd >= 0){
+     2f0:	83 c4 10             	add    $0x10,%esp
+     2f3:	85 c0                	test   %eax,%eax
+     2f5:	79 30                	jns    327 <opentest+0x7b>
+    printf(stdout, "open doesnotexist succeeded!\n");
+    exit();
+  }
+  printf(stdout, "open test ok\n");
+     2f7:	83 ec 08             	sub    $0x8,%esp
+     2fa:	68 a8 3c 00 00       	push   $0x3ca8
+     2ff:	ff 35 90 53 00 00    	push   0x5390
+     305:	e8 c6 35 00 00       	call   38d0 <printf>
+}
+     30a:	83 c4 10             	add    $0x10,%esp
+     30d:	c9                   	leave
+     30e:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     30f:	83 ec 08             	sub    $0x8,%esp
+     312:	68 6a 3c 00 00       	push   $0x3c6a
+     317:	ff 35 90 53 00 00    	push   0x5390
+     31d:	e8 ae 35 00 00       	call   38d0 <printf>
+    exit();
+     322:	e8 f4 33 00 00       	call   371b <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     327:	83 ec 08             	sub    $0x8,%esp
+     32a:	68 8a 3c 00 00       	push   $0x3c8a
+     32f:	ff 35 90 53 00 00    	push   0x5390
+     335:	e8 96 35 00 00       	call   38d0 <printf>
+    exit();
+     33a:	e8 dc 33 00 00       	call   371b <exit>
+
+0000033f <writetest>:
+
+void
+writetest(void)
+{
+     33f:	55                   	push   %ebp
+     340:	89 e5                	mov    %esp,%ebp
+     342:	56                   	push   %esi
+     343:	53                   	push   %ebx
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     344:	83 ec 08             	sub    $0x8,%esp
+     347:	68 b6 3c 00 00       	push   $0x3cb6
+     34c:	ff 35 90 53 00 00    	push   0x5390
+     352:	e8 79 35 00 00       	call   38d0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     357:	83 c4 08             	add    $0x8,%esp
+     35a:	68 02 02 00 00       	push   $0x202
+     35f:	68 c7 3c 00 00       	push   $0x3cc7
+     364:	e8 f2 33 00 00       	call   375b <open>
+  if(fd >= 0){
+     369:	83 c4 10             	add    $0x10,%esp
+     36c:	85 c0                	test   %eax,%eax
+     36e:	78 57                	js     3c7 <writetest+0x88>
+     370:	89 c6                	mov    %eax,%esi
+    printf(stdout, "creat small succeeded; ok\n");
+     372:	83 ec 08             	sub    $0x8,%esp
+     375:	68 cd 3c 00 00       	push   $0x3ccd
+     37a:	ff 35 90 53 00 00    	push   0x5390
+     380:	e8 4b 35 00 00       	call   38d0 <printf>
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     385:	83 c4 10             	add    $0x10,%esp
+     388:	bb 00 00 00 00       	mov    $0x0,%ebx
+     38d:	83 fb 63             	cmp    $0x63,%ebx
+     390:	7f 7f                	jg     411 <writetest+0xd2>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     392:	83 ec 04             	sub    $0x4,%esp
+     395:	6a 0a                	push   $0xa
+     397:	68 04 3d 00 00       	push   $0x3d04
+     39c:	56                   	push   %esi
+     39d:	e8 99 33 00 00       	call   373b <write>
+     3a2:	83 c4 10             	add    $0x10,%esp
+     3a5:	83 f8 0a             	cmp    $0xa,%eax
+     3a8:	75 35                	jne    3df <writetest+0xa0>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+      exit();
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     3aa:	83 ec 04             	sub    $0x4,%esp
+     3ad:	6a 0a                	push   $0xa
+     3af:	68 0f 3d 00 00       	push   $0x3d0f
+     3b4:	56                   	push   %esi
+     3b5:	e8 81 33 00 00       	call   373b <write>
+     3ba:	83 c4 10             	add    $0x10,%esp
+     3bd:	83 f8 0a             	cmp    $0xa,%eax
+     3c0:	75 36                	jne    3f8 <writetest+0xb9>
+  for(i = 0; i < 100; i++){
+     3c2:	83 c3 01             	add    $0x1,%ebx
+     3c5:	eb c6                	jmp    38d <writetest+0x4e>
+    printf(stdout, "error: creat small failed!\n");
+     3c7:	83 ec 08             	sub    $0x8,%esp
+     3ca:	68 e8 3c 00 00       	push   $0x3ce8
+     3cf:	ff 35 90 53 00 00    	push   0x5390
+     3d5:	e8 f6 34 00 00       	call   38d0 <printf>
+    exit();
+     3da:	e8 3c 33 00 00       	call   371b <exit>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     3df:	83 ec 04             	sub    $0x4,%esp
+     3e2:	53                   	push   %ebx
+     3e3:	68 c8 4b 00 00       	push   $0x4bc8
+     3e8:	ff 35 90 53 00 00    	push   0x5390
+     3ee:	e8 dd 34 00 00       	call   38d0 <printf>
+      exit();
+     3f3:	e8 23 33 00 00       	call   371b <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     3f8:	83 ec 04             	sub    $0x4,%esp
+     3fb:	53                   	push   %ebx
+     3fc:	68 ec 4b 00 00       	push   $0x4bec
+     401:	ff 35 90 53 00 00    	push   0x5390
+     407:	e8 c4 34 00 00       	call   38d0 <printf>
+      exit();
+     40c:	e8 0a 33 00 00       	call   371b <exit>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     411:	83 ec 08             	sub    $0x8,%esp
+     414:	68 1a 3d 00 00       	push   $0x3d1a
+     419:	ff 35 90 53 00 00    	push   0x5390
+     41f:	e8 ac 34 00 00       	call   38d0 <printf>
+  close(fd);
+     424:	89 34 24             	mov    %esi,(%esp)
+     427:	e8 17 33 00 00       	call   3743 <close>
+  fd = open("small", O_RDONLY);
+     42c:	83 c4 08             	add    $0x8,%esp
+     42f:	6a 00                	push   $0x0
+     431:	68 c7 3c 00 00       	push   $0x3cc7
+     436:	e8 20 33 00 00       	call   375b <open>
+     43b:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     43d:	83 c4 10             	add    $0x10,%esp
+     440:	85 c0                	test   %eax,%eax
+     442:	78 7b                	js     4bf <writetest+0x180>
+    printf(stdout, "open small succeeded ok\n");
+     444:	83 ec 08             	sub    $0x8,%esp
+     447:	68 25 3d 00 00       	push   $0x3d25
+     44c:	ff 35 90 53 00 00    	push   0x5390
+     452:	e8 79 34 00 00       	call   38d0 <printf>
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     457:	83 c4 0c             	add    $0xc,%esp
+     45a:	68 d0 07 00 00       	push   $0x7d0
+     45f:	68 e0 7a 00 00       	push   $0x7ae0
+     464:	53                   	push   %ebx
+     465:	e8 c9 32 00 00       	call   3733 <read>
+  if(i == 2000){
+     46a:	83 c4 10             	add    $0x10,%esp
+     46d:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     472:	75 63                	jne    4d7 <writetest+0x198>
+    printf(stdout, "read succeeded ok\n");
+     474:	83 ec 08             	sub    $0x8,%esp
+     477:	68 59 3d 00 00       	push   $0x3d59
+     47c:	ff 35 90 53 00 00    	push   0x5390
+     482:	e8 49 34 00 00       	call   38d0 <printf>
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     487:	89 1c 24             	mov    %ebx,(%esp)
+     48a:	e8 b4 32 00 00       	call   3743 <close>
+
+  if(unlink("small") < 0){
+     48f:	c7 04 24 c7 3c 00 00 	movl   $0x3cc7,(%esp)
+     496:	e8 d0 32 00 00       	call   376b <unlink>
+     49b:	83 c4 10             	add    $0x10,%esp
+     49e:	85 c0                	test   %eax,%eax
+     4a0:	78 4d                	js     4ef <writetest+0x1b0>
+    printf(stdout, "unlink small failed\n");
+    exit();
+  }
+  printf(stdout, "small file test ok\n");
+     4a2:	83 ec 08             	sub    $0x8,%esp
+     4a5:	68 81 3d 00 00       	push   $0x3d81
+     4aa:	ff 35 90 53 00 00    	push   0x5390
+     4b0:	e8 1b 34 00 00       	call   38d0 <printf>
+}
+     4b5:	83 c4 10             	add    $0x10,%esp
+     4b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4bb:	5b                   	pop    %ebx
+     4bc:	5e                   	pop    %esi
+     4bd:	5d                   	pop    %ebp
+     4be:	c3                   	ret
+    printf(stdout, "error: open small failed!\n");
+     4bf:	83 ec 08             	sub    $0x8,%esp
+     4c2:	68 3e 3d 00 00       	push   $0x3d3e
+     4c7:	ff 35 90 53 00 00    	push   0x5390
+     4cd:	e8 fe 33 00 00       	call   38d0 <printf>
+    exit();
+     4d2:	e8 44 32 00 00       	call   371b <exit>
+    printf(stdout, "read failed\n");
+     4d7:	83 ec 08             	sub    $0x8,%esp
+     4da:	68 85 40 00 00       	push   $0x4085
+     4df:	ff 35 90 53 00 00    	push   0x5390
+     4e5:	e8 e6 33 00 00       	call   38d0 <printf>
+    exit();
+     4ea:	e8 2c 32 00 00       	call   371b <exit>
+    printf(stdout, "unlink small failed\n");
+     4ef:	83 ec 08             	sub    $0x8,%esp
+     4f2:	68 6c 3d 00 00       	push   $0x3d6c
+     4f7:	ff 35 90 53 00 00    	push   0x5390
+     4fd:	e8 ce 33 00 00       	call   38d0 <printf>
+    exit();
+     502:	e8 14 32 00 00       	call   371b <exit>
+
+00000507 <writetest1>:
+
+void
+writetest1(void)
+{
+     507:	55                   	push   %ebp
+     508:	89 e5                	mov    %esp,%ebp
+     50a:	56                   	push   %esi
+     50b:	53                   	push   %ebx
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     50c:	83 ec 08             	sub    $0x8,%esp
+     50f:	68 95 3d 00 00       	push   $0x3d95
+     514:	ff 35 90 53 00 00    	push   0x5390
+     51a:	e8 b1 33 00 00       	call   38d0 <printf>
+
+  fd = open("big", O_CREATE|O_RDWR);
+     51f:	83 c4 08             	add    $0x8,%esp
+     522:	68 02 02 00 00       	push   $0x202
+     527:	68 0f 3e 00 00       	push   $0x3e0f
+     52c:	e8 2a 32 00 00       	call   375b <open>
+  if(fd < 0){
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	85 c0                	test   %eax,%eax
+     536:	78 37                	js     56f <writetest1+0x68>
+     538:	89 c6                	mov    %eax,%esi
+    printf(stdout, "error: creat big failed!\n");
+    exit();
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     53a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     53f:	81 fb 8b 00 00 00    	cmp    $0x8b,%ebx
+     545:	77 59                	ja     5a0 <writetest1+0x99>
+    ((int*)buf)[0] = i;
+     547:	89 1d e0 7a 00 00    	mov    %ebx,0x7ae0
+    if(write(fd, buf, 512) != 512){
+     54d:	83 ec 04             	sub    $0x4,%esp
+     550:	68 00 02 00 00       	push   $0x200
+     555:	68 e0 7a 00 00       	push   $0x7ae0
+     55a:	56                   	push   %esi
+     55b:	e8 db 31 00 00       	call   373b <write>
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	3d 00 02 00 00       	cmp    $0x200,%eax
+     568:	75 1d                	jne    587 <writetest1+0x80>
+  for(i = 0; i < MAXFILE; i++){
+     56a:	83 c3 01             	add    $0x1,%ebx
+     56d:	eb d0                	jmp    53f <writetest1+0x38>
+    printf(stdout, "error: creat big failed!\n");
+     56f:	83 ec 08             	sub    $0x8,%esp
+     572:	68 a5 3d 00 00       	push   $0x3da5
+     577:	ff 35 90 53 00 00    	push   0x5390
+     57d:	e8 4e 33 00 00       	call   38d0 <printf>
+    exit();
+     582:	e8 94 31 00 00       	call   371b <exit>
+      printf(stdout, "error: write big file failed\n", i);
+     587:	83 ec 04             	sub    $0x4,%esp
+     58a:	53                   	push   %ebx
+     58b:	68 bf 3d 00 00       	push   $0x3dbf
+     590:	ff 35 90 53 00 00    	push   0x5390
+     596:	e8 35 33 00 00       	call   38d0 <printf>
+      exit();
+     59b:	e8 7b 31 00 00       	call   371b <exit>
+    }
+  }
+
+  close(fd);
+     5a0:	83 ec 0c             	sub    $0xc,%esp
+     5a3:	56                   	push   %esi
+     5a4:	e8 9a 31 00 00       	call   3743 <close>
+
+  fd = open("big", O_RDONLY);
+     5a9:	83 c4 08             	add    $0x8,%esp
+     5ac:	6a 00                	push   $0x0
+     5ae:	68 0f 3e 00 00       	push   $0x3e0f
+     5b3:	e8 a3 31 00 00       	call   375b <open>
+     5b8:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     5ba:	83 c4 10             	add    $0x10,%esp
+     5bd:	85 c0                	test   %eax,%eax
+     5bf:	78 3c                	js     5fd <writetest1+0xf6>
+    printf(stdout, "error: open big failed!\n");
+    exit();
+  }
+
+  n = 0;
+     5c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(;;){
+    i = read(fd, buf, 512);
+     5c6:	83 ec 04             	sub    $0x4,%esp
+     5c9:	68 00 02 00 00       	push   $0x200
+     5ce:	68 e0 7a 00 00       	push   $0x7ae0
+     5d3:	56                   	push   %esi
+     5d4:	e8 5a 31 00 00       	call   3733 <read>
+    if(i == 0){
+     5d9:	83 c4 10             	add    $0x10,%esp
+     5dc:	85 c0                	test   %eax,%eax
+     5de:	74 35                	je     615 <writetest1+0x10e>
+      if(n == MAXFILE - 1){
+        printf(stdout, "read only %d blocks from big", n);
+        exit();
+      }
+      break;
+    } else if(i != 512){
+     5e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5e5:	0f 85 84 00 00 00    	jne    66f <writetest1+0x168>
+      printf(stdout, "read failed %d\n", i);
+      exit();
+    }
+    if(((int*)buf)[0] != n){
+     5eb:	a1 e0 7a 00 00       	mov    0x7ae0,%eax
+     5f0:	39 d8                	cmp    %ebx,%eax
+     5f2:	0f 85 90 00 00 00    	jne    688 <writetest1+0x181>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+      exit();
+    }
+    n++;
+     5f8:	83 c3 01             	add    $0x1,%ebx
+    i = read(fd, buf, 512);
+     5fb:	eb c9                	jmp    5c6 <writetest1+0xbf>
+    printf(stdout, "error: open big failed!\n");
+     5fd:	83 ec 08             	sub    $0x8,%esp
+     600:	68 dd 3d 00 00       	push   $0x3ddd
+     605:	ff 35 90 53 00 00    	push   0x5390
+     60b:	e8 c0 32 00 00       	call   38d0 <printf>
+    exit();
+     610:	e8 06 31 00 00       	call   371b <exit>
+      if(n == MAXFILE - 1){
+     615:	81 fb 8b 00 00 00    	cmp    $0x8b,%ebx
+     61b:	74 39                	je     656 <writetest1+0x14f>
+  }
+  close(fd);
+     61d:	83 ec 0c             	sub    $0xc,%esp
+     620:	56                   	push   %esi
+     621:	e8 1d 31 00 00       	call   3743 <close>
+  if(unlink("big") < 0){
+     626:	c7 04 24 0f 3e 00 00 	movl   $0x3e0f,(%esp)
+     62d:	e8 39 31 00 00       	call   376b <unlink>
+     632:	83 c4 10             	add    $0x10,%esp
+     635:	85 c0                	test   %eax,%eax
+     637:	78 66                	js     69f <writetest1+0x198>
+    printf(stdout, "unlink big failed\n");
+    exit();
+  }
+  printf(stdout, "big files ok\n");
+     639:	83 ec 08             	sub    $0x8,%esp
+     63c:	68 36 3e 00 00       	push   $0x3e36
+     641:	ff 35 90 53 00 00    	push   0x5390
+     647:	e8 84 32 00 00       	call   38d0 <printf>
+}
+     64c:	83 c4 10             	add    $0x10,%esp
+     64f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     652:	5b                   	pop    %ebx
+     653:	5e                   	pop    %esi
+     654:	5d                   	pop    %ebp
+     655:	c3                   	ret
+        printf(stdout, "read only %d blocks from big", n);
+     656:	83 ec 04             	sub    $0x4,%esp
+     659:	53                   	push   %ebx
+     65a:	68 f6 3d 00 00       	push   $0x3df6
+     65f:	ff 35 90 53 00 00    	push   0x5390
+     665:	e8 66 32 00 00       	call   38d0 <printf>
+        exit();
+     66a:	e8 ac 30 00 00       	call   371b <exit>
+      printf(stdout, "read failed %d\n", i);
+     66f:	83 ec 04             	sub    $0x4,%esp
+     672:	50                   	push   %eax
+     673:	68 13 3e 00 00       	push   $0x3e13
+     678:	ff 35 90 53 00 00    	push   0x5390
+     67e:	e8 4d 32 00 00       	call   38d0 <printf>
+      exit();
+     683:	e8 93 30 00 00       	call   371b <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     688:	50                   	push   %eax
+     689:	53                   	push   %ebx
+     68a:	68 10 4c 00 00       	push   $0x4c10
+     68f:	ff 35 90 53 00 00    	push   0x5390
+     695:	e8 36 32 00 00       	call   38d0 <printf>
+      exit();
+     69a:	e8 7c 30 00 00       	call   371b <exit>
+    printf(stdout, "unlink big failed\n");
+     69f:	83 ec 08             	sub    $0x8,%esp
+     6a2:	68 23 3e 00 00       	push   $0x3e23
+     6a7:	ff 35 90 53 00 00    	push   0x5390
+     6ad:	e8 1e 32 00 00       	call   38d0 <printf>
+    exit();
+     6b2:	e8 64 30 00 00       	call   371b <exit>
+
+000006b7 <createtest>:
+
+void
+createtest(void)
+{
+     6b7:	55                   	push   %ebp
+     6b8:	89 e5                	mov    %esp,%ebp
+     6ba:	53                   	push   %ebx
+     6bb:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     6be:	68 30 4c 00 00       	push   $0x4c30
+     6c3:	ff 35 90 53 00 00    	push   0x5390
+     6c9:	e8 02 32 00 00       	call   38d0 <printf>
+
+  name[0] = 'a';
+     6ce:	c6 05 d0 7a 00 00 61 	movb   $0x61,0x7ad0
+  name[2] = '\0';
+     6d5:	c6 05 d2 7a 00 00 00 	movb   $0x0,0x7ad2
+  for(i = 0; i < 52; i++){
+     6dc:	83 c4 10             	add    $0x10,%esp
+     6df:	bb 00 00 00 00       	mov    $0x0,%ebx
+     6e4:	eb 28                	jmp    70e <createtest+0x57>
+    name[1] = '0' + i;
+     6e6:	8d 43 30             	lea    0x30(%ebx),%eax
+     6e9:	a2 d1 7a 00 00       	mov    %al,0x7ad1
+    fd = open(name, O_CREATE|O_RDWR);
+     6ee:	83 ec 08             	sub    $0x8,%esp
+     6f1:	68 02 02 00 00       	push   $0x202
+     6f6:	68 d0 7a 00 00       	push   $0x7ad0
+     6fb:	e8 5b 30 00 00       	call   375b <open>
+    close(fd);
+     700:	89 04 24             	mov    %eax,(%esp)
+     703:	e8 3b 30 00 00       	call   3743 <close>
+  for(i = 0; i < 52; i++){
+     708:	83 c3 01             	add    $0x1,%ebx
+     70b:	83 c4 10             	add    $0x10,%esp
+     70e:	83 fb 33             	cmp    $0x33,%ebx
+     711:	7e d3                	jle    6e6 <createtest+0x2f>
+  }
+  name[0] = 'a';
+     713:	c6 05 d0 7a 00 00 61 	movb   $0x61,0x7ad0
+  name[2] = '\0';
+     71a:	c6 05 d2 7a 00 00 00 	movb   $0x0,0x7ad2
+  for(i = 0; i < 52; i++){
+     721:	bb 00 00 00 00       	mov    $0x0,%ebx
+     726:	eb 1b                	jmp    743 <createtest+0x8c>
+    name[1] = '0' + i;
+     728:	8d 43 30             	lea    0x30(%ebx),%eax
+     72b:	a2 d1 7a 00 00       	mov    %al,0x7ad1
+    unlink(name);
+     730:	83 ec 0c             	sub    $0xc,%esp
+     733:	68 d0 7a 00 00       	push   $0x7ad0
+     738:	e8 2e 30 00 00       	call   376b <unlink>
+  for(i = 0; i < 52; i++){
+     73d:	83 c3 01             	add    $0x1,%ebx
+     740:	83 c4 10             	add    $0x10,%esp
+     743:	83 fb 33             	cmp    $0x33,%ebx
+     746:	7e e0                	jle    728 <createtest+0x71>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     748:	83 ec 08             	sub    $0x8,%esp
+     74b:	68 58 4c 00 00       	push   $0x4c58
+     750:	ff 35 90 53 00 00    	push   0x5390
+     756:	e8 75 31 00 00       	call   38d0 <printf>
+}
+     75b:	83 c4 10             	add    $0x10,%esp
+     75e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     761:	c9                   	leave
+     762:	c3                   	ret
+
+00000763 <dirtest>:
+
+void dirtest(void)
+{
+     763:	55                   	push   %ebp
+     764:	89 e5                	mov    %esp,%ebp
+     766:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     769:	68 44 3e 00 00       	push   $0x3e44
+     76e:	ff 35 90 53 00 00    	push   0x5390
+     774:	e8 57 31 00 00       	call   38d0 <printf>
+
+  if(mkdir("dir0") < 0){
+     779:	c7 04 24 50 3e 00 00 	movl   $0x3e50,(%esp)
+     780:	e8 fe 2f 00 00       	call   3783 <mkdir>
+     785:	83 c4 10             	add    $0x10,%esp
+     788:	85 c0                	test   %eax,%eax
+     78a:	78 54                	js     7e0 <dirtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+
+  if(chdir("dir0") < 0){
+     78c:	83 ec 0c             	sub    $0xc,%esp
+     78f:	68 50 3e 00 00       	push   $0x3e50
+     794:	e8 f2 2f 00 00       	call   378b <chdir>
+     799:	83 c4 10             	add    $0x10,%esp
+     79c:	85 c0                	test   %eax,%eax
+     79e:	78 58                	js     7f8 <dirtest+0x95>
+    printf(stdout, "chdir dir0 failed\n");
+    exit();
+  }
+
+  if(chdir("..") < 0){
+     7a0:	83 ec 0c             	sub    $0xc,%esp
+     7a3:	68 f5 43 00 00       	push   $0x43f5
+     7a8:	e8 de 2f 00 00       	call   378b <chdir>
+     7ad:	83 c4 10             	add    $0x10,%esp
+     7b0:	85 c0                	test   %eax,%eax
+     7b2:	78 5c                	js     810 <dirtest+0xad>
+    printf(stdout, "chdir .. failed\n");
+    exit();
+  }
+
+  if(unlink("dir0") < 0){
+     7b4:	83 ec 0c             	sub    $0xc,%esp
+     7b7:	68 50 3e 00 00       	push   $0x3e50
+     7bc:	e8 aa 2f 00 00       	call   376b <unlink>
+     7c1:	83 c4 10             	add    $0x10,%esp
+     7c4:	85 c0                	test   %eax,%eax
+     7c6:	78 60                	js     828 <dirtest+0xc5>
+    printf(stdout, "unlink dir0 failed\n");
+    exit();
+  }
+  printf(stdout, "mkdir test ok\n");
+     7c8:	83 ec 08             	sub    $0x8,%esp
+     7cb:	68 8d 3e 00 00       	push   $0x3e8d
+     7d0:	ff 35 90 53 00 00    	push   0x5390
+     7d6:	e8 f5 30 00 00       	call   38d0 <printf>
+}
+     7db:	83 c4 10             	add    $0x10,%esp
+     7de:	c9                   	leave
+     7df:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     7e0:	83 ec 08             	sub    $0x8,%esp
+     7e3:	68 80 3b 00 00       	push   $0x3b80
+     7e8:	ff 35 90 53 00 00    	push   0x5390
+     7ee:	e8 dd 30 00 00       	call   38d0 <printf>
+    exit();
+     7f3:	e8 23 2f 00 00       	call   371b <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	68 55 3e 00 00       	push   $0x3e55
+     800:	ff 35 90 53 00 00    	push   0x5390
+     806:	e8 c5 30 00 00       	call   38d0 <printf>
+    exit();
+     80b:	e8 0b 2f 00 00       	call   371b <exit>
+    printf(stdout, "chdir .. failed\n");
+     810:	83 ec 08             	sub    $0x8,%esp
+     813:	68 68 3e 00 00       	push   $0x3e68
+     818:	ff 35 90 53 00 00    	push   0x5390
+     81e:	e8 ad 30 00 00       	call   38d0 <printf>
+    exit();
+     823:	e8 f3 2e 00 00       	call   371b <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     828:	83 ec 08             	sub    $0x8,%esp
+     82b:	68 79 3e 00 00       	push   $0x3e79
+     830:	ff 35 90 53 00 00    	push   0x5390
+     836:	e8 95 30 00 00       	call   38d0 <printf>
+    exit();
+     83b:	e8 db 2e 00 00       	call   371b <exit>
+
+00000840 <exectest>:
+
+void
+exectest(void)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     846:	68 9c 3e 00 00       	push   $0x3e9c
+     84b:	ff 35 90 53 00 00    	push   0x5390
+     851:	e8 7a 30 00 00       	call   38d0 <printf>
+  if(exec("echo", echoargv) < 0){
+     856:	83 c4 08             	add    $0x8,%esp
+     859:	68 94 53 00 00       	push   $0x5394
+     85e:	68 65 3c 00 00       	push   $0x3c65
+     863:	e8 eb 2e 00 00       	call   3753 <exec>
+     868:	83 c4 10             	add    $0x10,%esp
+     86b:	85 c0                	test   %eax,%eax
+     86d:	78 02                	js     871 <exectest+0x31>
+    printf(stdout, "exec echo failed\n");
+    exit();
+  }
+}
+     86f:	c9                   	leave
+     870:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     871:	83 ec 08             	sub    $0x8,%esp
+     874:	68 a7 3e 00 00       	push   $0x3ea7
+     879:	ff 35 90 53 00 00    	push   0x5390
+     87f:	e8 4c 30 00 00       	call   38d0 <printf>
+    exit();
+     884:	e8 92 2e 00 00       	call   371b <exit>
+
+00000889 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     889:	55                   	push   %ebp
+     88a:	89 e5                	mov    %esp,%ebp
+     88c:	57                   	push   %edi
+     88d:	56                   	push   %esi
+     88e:	53                   	push   %ebx
+     88f:	83 ec 38             	sub    $0x38,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     892:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     895:	50                   	push   %eax
+     896:	e8 90 2e 00 00       	call   372b <pipe>
+     89b:	83 c4 10             	add    $0x10,%esp
+     89e:	85 c0                	test   %eax,%eax
+     8a0:	75 74                	jne    916 <pipe1+0x8d>
+     8a2:	89 c6                	mov    %eax,%esi
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+     8a4:	e8 6a 2e 00 00       	call   3713 <fork>
+     8a9:	89 c7                	mov    %eax,%edi
+  seq = 0;
+  if(pid == 0){
+     8ab:	85 c0                	test   %eax,%eax
+     8ad:	74 7b                	je     92a <pipe1+0xa1>
+        printf(1, "pipe1 oops 1\n");
+        exit();
+      }
+    }
+    exit();
+  } else if(pid > 0){
+     8af:	0f 8e 60 01 00 00    	jle    a15 <pipe1+0x18c>
+    close(fds[1]);
+     8b5:	83 ec 0c             	sub    $0xc,%esp
+     8b8:	ff 75 e4             	push   -0x1c(%ebp)
+     8bb:	e8 83 2e 00 00       	call   3743 <close>
+    total = 0;
+    cc = 1;
+    while((n = read(fds[0], buf, cc)) > 0){
+     8c0:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     8c3:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  seq = 0;
+     8c6:	89 f3                	mov    %esi,%ebx
+    cc = 1;
+     8c8:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     8cf:	83 ec 04             	sub    $0x4,%esp
+     8d2:	ff 75 d4             	push   -0x2c(%ebp)
+     8d5:	68 e0 7a 00 00       	push   $0x7ae0
+     8da:	ff 75 e0             	push   -0x20(%ebp)
+     8dd:	e8 51 2e 00 00       	call   3733 <read>
+     8e2:	89 c7                	mov    %eax,%edi
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	85 c0                	test   %eax,%eax
+     8e9:	0f 8e e2 00 00 00    	jle    9d1 <pipe1+0x148>
+      for(i = 0; i < n; i++){
+     8ef:	89 f0                	mov    %esi,%eax
+     8f1:	89 d9                	mov    %ebx,%ecx
+     8f3:	39 f8                	cmp    %edi,%eax
+     8f5:	0f 8d b4 00 00 00    	jge    9af <pipe1+0x126>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     8fb:	0f be 98 e0 7a 00 00 	movsbl 0x7ae0(%eax),%ebx
+     902:	8d 51 01             	lea    0x1(%ecx),%edx
+     905:	31 cb                	xor    %ecx,%ebx
+     907:	84 db                	test   %bl,%bl
+     909:	0f 85 86 00 00 00    	jne    995 <pipe1+0x10c>
+      for(i = 0; i < n; i++){
+     90f:	83 c0 01             	add    $0x1,%eax
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     912:	89 d1                	mov    %edx,%ecx
+     914:	eb dd                	jmp    8f3 <pipe1+0x6a>
+    printf(1, "pipe() failed\n");
+     916:	83 ec 08             	sub    $0x8,%esp
+     919:	68 b9 3e 00 00       	push   $0x3eb9
+     91e:	6a 01                	push   $0x1
+     920:	e8 ab 2f 00 00       	call   38d0 <printf>
+    exit();
+     925:	e8 f1 2d 00 00       	call   371b <exit>
+    close(fds[0]);
+     92a:	83 ec 0c             	sub    $0xc,%esp
+     92d:	ff 75 e0             	push   -0x20(%ebp)
+     930:	e8 0e 2e 00 00       	call   3743 <close>
+    for(n = 0; n < 5; n++){
+     935:	83 c4 10             	add    $0x10,%esp
+     938:	89 fe                	mov    %edi,%esi
+  seq = 0;
+     93a:	89 fb                	mov    %edi,%ebx
+    for(n = 0; n < 5; n++){
+     93c:	eb 35                	jmp    973 <pipe1+0xea>
+        buf[i] = seq++;
+     93e:	88 98 e0 7a 00 00    	mov    %bl,0x7ae0(%eax)
+      for(i = 0; i < 1033; i++)
+     944:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     947:	8d 5b 01             	lea    0x1(%ebx),%ebx
+      for(i = 0; i < 1033; i++)
+     94a:	3d 08 04 00 00       	cmp    $0x408,%eax
+     94f:	7e ed                	jle    93e <pipe1+0xb5>
+      if(write(fds[1], buf, 1033) != 1033){
+     951:	83 ec 04             	sub    $0x4,%esp
+     954:	68 09 04 00 00       	push   $0x409
+     959:	68 e0 7a 00 00       	push   $0x7ae0
+     95e:	ff 75 e4             	push   -0x1c(%ebp)
+     961:	e8 d5 2d 00 00       	call   373b <write>
+     966:	83 c4 10             	add    $0x10,%esp
+     969:	3d 09 04 00 00       	cmp    $0x409,%eax
+     96e:	75 0c                	jne    97c <pipe1+0xf3>
+    for(n = 0; n < 5; n++){
+     970:	83 c6 01             	add    $0x1,%esi
+     973:	83 fe 04             	cmp    $0x4,%esi
+     976:	7f 18                	jg     990 <pipe1+0x107>
+      for(i = 0; i < 1033; i++)
+     978:	89 f8                	mov    %edi,%eax
+     97a:	eb ce                	jmp    94a <pipe1+0xc1>
+        printf(1, "pipe1 oops 1\n");
+     97c:	83 ec 08             	sub    $0x8,%esp
+     97f:	68 c8 3e 00 00       	push   $0x3ec8
+     984:	6a 01                	push   $0x1
+     986:	e8 45 2f 00 00       	call   38d0 <printf>
+        exit();
+     98b:	e8 8b 2d 00 00       	call   371b <exit>
+    exit();
+     990:	e8 86 2d 00 00       	call   371b <exit>
+          printf(1, "pipe1 oops 2\n");
+     995:	83 ec 08             	sub    $0x8,%esp
+     998:	68 d6 3e 00 00       	push   $0x3ed6
+     99d:	6a 01                	push   $0x1
+     99f:	e8 2c 2f 00 00       	call   38d0 <printf>
+          return;
+     9a4:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+}
+     9a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9aa:	5b                   	pop    %ebx
+     9ab:	5e                   	pop    %esi
+     9ac:	5f                   	pop    %edi
+     9ad:	5d                   	pop    %ebp
+     9ae:	c3                   	ret
+      total += n;
+     9af:	89 cb                	mov    %ecx,%ebx
+     9b1:	01 7d d0             	add    %edi,-0x30(%ebp)
+      cc = cc * 2;
+     9b4:	d1 65 d4             	shll   -0x2c(%ebp)
+     9b7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      if(cc > sizeof(buf))
+     9ba:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     9bf:	0f 86 0a ff ff ff    	jbe    8cf <pipe1+0x46>
+        cc = sizeof(buf);
+     9c5:	c7 45 d4 00 20 00 00 	movl   $0x2000,-0x2c(%ebp)
+     9cc:	e9 fe fe ff ff       	jmp    8cf <pipe1+0x46>
+    if(total != 5 * 1033){
+     9d1:	81 7d d0 2d 14 00 00 	cmpl   $0x142d,-0x30(%ebp)
+     9d8:	75 24                	jne    9fe <pipe1+0x175>
+    close(fds[0]);
+     9da:	83 ec 0c             	sub    $0xc,%esp
+     9dd:	ff 75 e0             	push   -0x20(%ebp)
+     9e0:	e8 5e 2d 00 00       	call   3743 <close>
+    wait();
+     9e5:	e8 39 2d 00 00       	call   3723 <wait>
+  printf(1, "pipe1 ok\n");
+     9ea:	83 c4 08             	add    $0x8,%esp
+     9ed:	68 fb 3e 00 00       	push   $0x3efb
+     9f2:	6a 01                	push   $0x1
+     9f4:	e8 d7 2e 00 00       	call   38d0 <printf>
+     9f9:	83 c4 10             	add    $0x10,%esp
+     9fc:	eb a9                	jmp    9a7 <pipe1+0x11e>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     9fe:	83 ec 04             	sub    $0x4,%esp
+     a01:	ff 75 d0             	push   -0x30(%ebp)
+     a04:	68 e4 3e 00 00       	push   $0x3ee4
+     a09:	6a 01                	push   $0x1
+     a0b:	e8 c0 2e 00 00       	call   38d0 <printf>
+      exit();
+     a10:	e8 06 2d 00 00       	call   371b <exit>
+    printf(1, "fork() failed\n");
+     a15:	83 ec 08             	sub    $0x8,%esp
+     a18:	68 05 3f 00 00       	push   $0x3f05
+     a1d:	6a 01                	push   $0x1
+     a1f:	e8 ac 2e 00 00       	call   38d0 <printf>
+    exit();
+     a24:	e8 f2 2c 00 00       	call   371b <exit>
+
+00000a29 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     a29:	55                   	push   %ebp
+     a2a:	89 e5                	mov    %esp,%ebp
+     a2c:	57                   	push   %edi
+     a2d:	56                   	push   %esi
+     a2e:	53                   	push   %ebx
+     a2f:	83 ec 24             	sub    $0x24,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     a32:	68 14 3f 00 00       	push   $0x3f14
+     a37:	6a 01                	push   $0x1
+     a39:	e8 92 2e 00 00       	call   38d0 <printf>
+  pid1 = fork();
+     a3e:	e8 d0 2c 00 00       	call   3713 <fork>
+  if(pid1 == 0)
+     a43:	83 c4 10             	add    $0x10,%esp
+     a46:	85 c0                	test   %eax,%eax
+     a48:	75 02                	jne    a4c <preempt+0x23>
+    for(;;)
+     a4a:	eb fe                	jmp    a4a <preempt+0x21>
+     a4c:	89 c3                	mov    %eax,%ebx
+      ;
+
+  pid2 = fork();
+     a4e:	e8 c0 2c 00 00       	call   3713 <fork>
+     a53:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     a55:	85 c0                	test   %eax,%eax
+     a57:	75 02                	jne    a5b <preempt+0x32>
+    for(;;)
+     a59:	eb fe                	jmp    a59 <preempt+0x30>
+      ;
+
+  pipe(pfds);
+     a5b:	83 ec 0c             	sub    $0xc,%esp
+     a5e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a61:	50                   	push   %eax
+     a62:	e8 c4 2c 00 00       	call   372b <pipe>
+  pid3 = fork();
+     a67:	e8 a7 2c 00 00       	call   3713 <fork>
+     a6c:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     a6e:	83 c4 10             	add    $0x10,%esp
+     a71:	85 c0                	test   %eax,%eax
+     a73:	75 49                	jne    abe <preempt+0x95>
+    close(pfds[0]);
+     a75:	83 ec 0c             	sub    $0xc,%esp
+     a78:	ff 75 e0             	push   -0x20(%ebp)
+     a7b:	e8 c3 2c 00 00       	call   3743 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     a80:	83 c4 0c             	add    $0xc,%esp
+     a83:	6a 01                	push   $0x1
+     a85:	68 d9 44 00 00       	push   $0x44d9
+     a8a:	ff 75 e4             	push   -0x1c(%ebp)
+     a8d:	e8 a9 2c 00 00       	call   373b <write>
+     a92:	83 c4 10             	add    $0x10,%esp
+     a95:	83 f8 01             	cmp    $0x1,%eax
+     a98:	75 10                	jne    aaa <preempt+0x81>
+      printf(1, "preempt write error");
+    close(pfds[1]);
+     a9a:	83 ec 0c             	sub    $0xc,%esp
+     a9d:	ff 75 e4             	push   -0x1c(%ebp)
+     aa0:	e8 9e 2c 00 00       	call   3743 <close>
+     aa5:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     aa8:	eb fe                	jmp    aa8 <preempt+0x7f>
+      printf(1, "preempt write error");
+     aaa:	83 ec 08             	sub    $0x8,%esp
+     aad:	68 1e 3f 00 00       	push   $0x3f1e
+     ab2:	6a 01                	push   $0x1
+     ab4:	e8 17 2e 00 00       	call   38d0 <printf>
+     ab9:	83 c4 10             	add    $0x10,%esp
+     abc:	eb dc                	jmp    a9a <preempt+0x71>
+      ;
+  }
+
+  close(pfds[1]);
+     abe:	83 ec 0c             	sub    $0xc,%esp
+     ac1:	ff 75 e4             	push   -0x1c(%ebp)
+     ac4:	e8 7a 2c 00 00       	call   3743 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     ac9:	83 c4 0c             	add    $0xc,%esp
+     acc:	68 00 20 00 00       	push   $0x2000
+     ad1:	68 e0 7a 00 00       	push   $0x7ae0
+     ad6:	ff 75 e0             	push   -0x20(%ebp)
+     ad9:	e8 55 2c 00 00       	call   3733 <read>
+     ade:	83 c4 10             	add    $0x10,%esp
+     ae1:	83 f8 01             	cmp    $0x1,%eax
+     ae4:	74 1a                	je     b00 <preempt+0xd7>
+    printf(1, "preempt read error");
+     ae6:	83 ec 08             	sub    $0x8,%esp
+     ae9:	68 32 3f 00 00       	push   $0x3f32
+     aee:	6a 01                	push   $0x1
+     af0:	e8 db 2d 00 00       	call   38d0 <printf>
+    return;
+     af5:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+  wait();
+  wait();
+  wait();
+  printf(1, "preempt ok\n");
+}
+     af8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     afb:	5b                   	pop    %ebx
+     afc:	5e                   	pop    %esi
+     afd:	5f                   	pop    %edi
+     afe:	5d                   	pop    %ebp
+     aff:	c3                   	ret
+  close(pfds[0]);
+     b00:	83 ec 0c             	sub    $0xc,%esp
+     b03:	ff 75 e0             	push   -0x20(%ebp)
+     b06:	e8 38 2c 00 00       	call   3743 <close>
+  printf(1, "kill... ");
+     b0b:	83 c4 08             	add    $0x8,%esp
+     b0e:	68 45 3f 00 00       	push   $0x3f45
+     b13:	6a 01                	push   $0x1
+     b15:	e8 b6 2d 00 00       	call   38d0 <printf>
+  kill(pid1);
+     b1a:	89 1c 24             	mov    %ebx,(%esp)
+     b1d:	e8 29 2c 00 00       	call   374b <kill>
+  kill(pid2);
+     b22:	89 34 24             	mov    %esi,(%esp)
+     b25:	e8 21 2c 00 00       	call   374b <kill>
+  kill(pid3);
+     b2a:	89 3c 24             	mov    %edi,(%esp)
+     b2d:	e8 19 2c 00 00       	call   374b <kill>
+  printf(1, "wait... ");
+     b32:	83 c4 08             	add    $0x8,%esp
+     b35:	68 4e 3f 00 00       	push   $0x3f4e
+     b3a:	6a 01                	push   $0x1
+     b3c:	e8 8f 2d 00 00       	call   38d0 <printf>
+  wait();
+     b41:	e8 dd 2b 00 00       	call   3723 <wait>
+  wait();
+     b46:	e8 d8 2b 00 00       	call   3723 <wait>
+  wait();
+     b4b:	e8 d3 2b 00 00       	call   3723 <wait>
+  printf(1, "preempt ok\n");
+     b50:	83 c4 08             	add    $0x8,%esp
+     b53:	68 57 3f 00 00       	push   $0x3f57
+     b58:	6a 01                	push   $0x1
+     b5a:	e8 71 2d 00 00       	call   38d0 <printf>
+     b5f:	83 c4 10             	add    $0x10,%esp
+     b62:	eb 94                	jmp    af8 <preempt+0xcf>
+
+00000b64 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     b64:	55                   	push   %ebp
+     b65:	89 e5                	mov    %esp,%ebp
+     b67:	56                   	push   %esi
+     b68:	53                   	push   %ebx
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+     b69:	be 00 00 00 00       	mov    $0x0,%esi
+     b6e:	83 fe 63             	cmp    $0x63,%esi
+     b71:	7f 4d                	jg     bc0 <exitwait+0x5c>
+    pid = fork();
+     b73:	e8 9b 2b 00 00       	call   3713 <fork>
+     b78:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     b7a:	85 c0                	test   %eax,%eax
+     b7c:	78 10                	js     b8e <exitwait+0x2a>
+      printf(1, "fork failed\n");
+      return;
+    }
+    if(pid){
+     b7e:	74 3b                	je     bbb <exitwait+0x57>
+      if(wait() != pid){
+     b80:	e8 9e 2b 00 00       	call   3723 <wait>
+     b85:	39 d8                	cmp    %ebx,%eax
+     b87:	75 1e                	jne    ba7 <exitwait+0x43>
+  for(i = 0; i < 100; i++){
+     b89:	83 c6 01             	add    $0x1,%esi
+     b8c:	eb e0                	jmp    b6e <exitwait+0xa>
+      printf(1, "fork failed\n");
+     b8e:	83 ec 08             	sub    $0x8,%esp
+     b91:	68 c1 4a 00 00       	push   $0x4ac1
+     b96:	6a 01                	push   $0x1
+     b98:	e8 33 2d 00 00       	call   38d0 <printf>
+      return;
+     b9d:	83 c4 10             	add    $0x10,%esp
+    } else {
+      exit();
+    }
+  }
+  printf(1, "exitwait ok\n");
+}
+     ba0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ba3:	5b                   	pop    %ebx
+     ba4:	5e                   	pop    %esi
+     ba5:	5d                   	pop    %ebp
+     ba6:	c3                   	ret
+        printf(1, "wait wrong pid\n");
+     ba7:	83 ec 08             	sub    $0x8,%esp
+     baa:	68 63 3f 00 00       	push   $0x3f63
+     baf:	6a 01                	push   $0x1
+     bb1:	e8 1a 2d 00 00       	call   38d0 <printf>
+        return;
+     bb6:	83 c4 10             	add    $0x10,%esp
+     bb9:	eb e5                	jmp    ba0 <exitwait+0x3c>
+      exit();
+     bbb:	e8 5b 2b 00 00       	call   371b <exit>
+  printf(1, "exitwait ok\n");
+     bc0:	83 ec 08             	sub    $0x8,%esp
+     bc3:	68 73 3f 00 00       	push   $0x3f73
+     bc8:	6a 01                	push   $0x1
+     bca:	e8 01 2d 00 00       	call   38d0 <printf>
+     bcf:	83 c4 10             	add    $0x10,%esp
+     bd2:	eb cc                	jmp    ba0 <exitwait+0x3c>
+
+00000bd4 <mem>:
+
+void
+mem(void)
+{
+     bd4:	55                   	push   %ebp
+     bd5:	89 e5                	mov    %esp,%ebp
+     bd7:	57                   	push   %edi
+     bd8:	56                   	push   %esi
+     bd9:	53                   	push   %ebx
+     bda:	83 ec 14             	sub    $0x14,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+     bdd:	68 80 3f 00 00       	push   $0x3f80
+     be2:	6a 01                	push   $0x1
+     be4:	e8 e7 2c 00 00       	call   38d0 <printf>
+  ppid = getpid();
+     be9:	e8 ad 2b 00 00       	call   379b <getpid>
+     bee:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+     bf0:	e8 1e 2b 00 00       	call   3713 <fork>
+     bf5:	83 c4 10             	add    $0x10,%esp
+     bf8:	85 c0                	test   %eax,%eax
+     bfa:	0f 85 82 00 00 00    	jne    c82 <mem+0xae>
+    m1 = 0;
+     c00:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c05:	eb 04                	jmp    c0b <mem+0x37>
+    while((m2 = malloc(10001)) != 0){
+      *(char**)m2 = m1;
+     c07:	89 18                	mov    %ebx,(%eax)
+      m1 = m2;
+     c09:	89 c3                	mov    %eax,%ebx
+    while((m2 = malloc(10001)) != 0){
+     c0b:	83 ec 0c             	sub    $0xc,%esp
+     c0e:	68 11 27 00 00       	push   $0x2711
+     c13:	e8 de 2e 00 00       	call   3af6 <malloc>
+     c18:	83 c4 10             	add    $0x10,%esp
+     c1b:	85 c0                	test   %eax,%eax
+     c1d:	75 e8                	jne    c07 <mem+0x33>
+     c1f:	eb 10                	jmp    c31 <mem+0x5d>
+    }
+    while(m1){
+      m2 = *(char**)m1;
+     c21:	8b 3b                	mov    (%ebx),%edi
+      free(m1);
+     c23:	83 ec 0c             	sub    $0xc,%esp
+     c26:	53                   	push   %ebx
+     c27:	e8 0a 2e 00 00       	call   3a36 <free>
+     c2c:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+     c2f:	89 fb                	mov    %edi,%ebx
+    while(m1){
+     c31:	85 db                	test   %ebx,%ebx
+     c33:	75 ec                	jne    c21 <mem+0x4d>
+    }
+    m1 = malloc(1024*20);
+     c35:	83 ec 0c             	sub    $0xc,%esp
+     c38:	68 00 50 00 00       	push   $0x5000
+     c3d:	e8 b4 2e 00 00       	call   3af6 <malloc>
+    if(m1 == 0){
+     c42:	83 c4 10             	add    $0x10,%esp
+     c45:	85 c0                	test   %eax,%eax
+     c47:	74 1d                	je     c66 <mem+0x92>
+      printf(1, "couldn't allocate mem?!!\n");
+      kill(ppid);
+      exit();
+    }
+    free(m1);
+     c49:	83 ec 0c             	sub    $0xc,%esp
+     c4c:	50                   	push   %eax
+     c4d:	e8 e4 2d 00 00       	call   3a36 <free>
+    printf(1, "mem ok\n");
+     c52:	83 c4 08             	add    $0x8,%esp
+     c55:	68 a4 3f 00 00       	push   $0x3fa4
+     c5a:	6a 01                	push   $0x1
+     c5c:	e8 6f 2c 00 00       	call   38d0 <printf>
+    exit();
+     c61:	e8 b5 2a 00 00       	call   371b <exit>
+      printf(1, "couldn't allocate mem?!!\n");
+     c66:	83 ec 08             	sub    $0x8,%esp
+     c69:	68 8a 3f 00 00       	push   $0x3f8a
+     c6e:	6a 01                	push   $0x1
+     c70:	e8 5b 2c 00 00       	call   38d0 <printf>
+      kill(ppid);
+     c75:	89 34 24             	mov    %esi,(%esp)
+     c78:	e8 ce 2a 00 00       	call   374b <kill>
+      exit();
+     c7d:	e8 99 2a 00 00       	call   371b <exit>
+  } else {
+    wait();
+     c82:	e8 9c 2a 00 00       	call   3723 <wait>
+  }
+}
+     c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c8a:	5b                   	pop    %ebx
+     c8b:	5e                   	pop    %esi
+     c8c:	5f                   	pop    %edi
+     c8d:	5d                   	pop    %ebp
+     c8e:	c3                   	ret
+
+00000c8f <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+     c8f:	55                   	push   %ebp
+     c90:	89 e5                	mov    %esp,%ebp
+     c92:	57                   	push   %edi
+     c93:	56                   	push   %esi
+     c94:	53                   	push   %ebx
+     c95:	83 ec 24             	sub    $0x24,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+     c98:	68 ac 3f 00 00       	push   $0x3fac
+     c9d:	6a 01                	push   $0x1
+     c9f:	e8 2c 2c 00 00       	call   38d0 <printf>
+
+  unlink("sharedfd");
+     ca4:	c7 04 24 bb 3f 00 00 	movl   $0x3fbb,(%esp)
+     cab:	e8 bb 2a 00 00       	call   376b <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     cb0:	83 c4 08             	add    $0x8,%esp
+     cb3:	68 02 02 00 00       	push   $0x202
+     cb8:	68 bb 3f 00 00       	push   $0x3fbb
+     cbd:	e8 99 2a 00 00       	call   375b <open>
+  if(fd < 0){
+     cc2:	83 c4 10             	add    $0x10,%esp
+     cc5:	85 c0                	test   %eax,%eax
+     cc7:	78 4d                	js     d16 <sharedfd+0x87>
+     cc9:	89 c6                	mov    %eax,%esi
+    printf(1, "fstests: cannot open sharedfd for writing");
+    return;
+  }
+  pid = fork();
+     ccb:	e8 43 2a 00 00       	call   3713 <fork>
+     cd0:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     cd2:	85 c0                	test   %eax,%eax
+     cd4:	75 57                	jne    d2d <sharedfd+0x9e>
+     cd6:	b8 63 00 00 00       	mov    $0x63,%eax
+     cdb:	83 ec 04             	sub    $0x4,%esp
+     cde:	6a 0a                	push   $0xa
+     ce0:	50                   	push   %eax
+     ce1:	8d 45 de             	lea    -0x22(%ebp),%eax
+     ce4:	50                   	push   %eax
+     ce5:	e8 f6 28 00 00       	call   35e0 <memset>
+  for(i = 0; i < 1000; i++){
+     cea:	83 c4 10             	add    $0x10,%esp
+     ced:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cf2:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+     cf8:	7f 4c                	jg     d46 <sharedfd+0xb7>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     cfa:	83 ec 04             	sub    $0x4,%esp
+     cfd:	6a 0a                	push   $0xa
+     cff:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d02:	50                   	push   %eax
+     d03:	56                   	push   %esi
+     d04:	e8 32 2a 00 00       	call   373b <write>
+     d09:	83 c4 10             	add    $0x10,%esp
+     d0c:	83 f8 0a             	cmp    $0xa,%eax
+     d0f:	75 23                	jne    d34 <sharedfd+0xa5>
+  for(i = 0; i < 1000; i++){
+     d11:	83 c3 01             	add    $0x1,%ebx
+     d14:	eb dc                	jmp    cf2 <sharedfd+0x63>
+    printf(1, "fstests: cannot open sharedfd for writing");
+     d16:	83 ec 08             	sub    $0x8,%esp
+     d19:	68 80 4c 00 00       	push   $0x4c80
+     d1e:	6a 01                	push   $0x1
+     d20:	e8 ab 2b 00 00       	call   38d0 <printf>
+    return;
+     d25:	83 c4 10             	add    $0x10,%esp
+     d28:	e9 e4 00 00 00       	jmp    e11 <sharedfd+0x182>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     d2d:	b8 70 00 00 00       	mov    $0x70,%eax
+     d32:	eb a7                	jmp    cdb <sharedfd+0x4c>
+      printf(1, "fstests: write sharedfd failed\n");
+     d34:	83 ec 08             	sub    $0x8,%esp
+     d37:	68 ac 4c 00 00       	push   $0x4cac
+     d3c:	6a 01                	push   $0x1
+     d3e:	e8 8d 2b 00 00       	call   38d0 <printf>
+      break;
+     d43:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  if(pid == 0)
+     d46:	85 ff                	test   %edi,%edi
+     d48:	74 4d                	je     d97 <sharedfd+0x108>
+    exit();
+  else
+    wait();
+     d4a:	e8 d4 29 00 00       	call   3723 <wait>
+  close(fd);
+     d4f:	83 ec 0c             	sub    $0xc,%esp
+     d52:	56                   	push   %esi
+     d53:	e8 eb 29 00 00       	call   3743 <close>
+  fd = open("sharedfd", 0);
+     d58:	83 c4 08             	add    $0x8,%esp
+     d5b:	6a 00                	push   $0x0
+     d5d:	68 bb 3f 00 00       	push   $0x3fbb
+     d62:	e8 f4 29 00 00       	call   375b <open>
+     d67:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+     d69:	83 c4 10             	add    $0x10,%esp
+     d6c:	85 c0                	test   %eax,%eax
+     d6e:	78 2c                	js     d9c <sharedfd+0x10d>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    return;
+  }
+  nc = np = 0;
+     d70:	be 00 00 00 00       	mov    $0x0,%esi
+     d75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     d7a:	83 ec 04             	sub    $0x4,%esp
+     d7d:	6a 0a                	push   $0xa
+     d7f:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d82:	50                   	push   %eax
+     d83:	57                   	push   %edi
+     d84:	e8 aa 29 00 00       	call   3733 <read>
+     d89:	83 c4 10             	add    $0x10,%esp
+     d8c:	85 c0                	test   %eax,%eax
+     d8e:	7e 41                	jle    dd1 <sharedfd+0x142>
+    for(i = 0; i < sizeof(buf); i++){
+     d90:	b8 00 00 00 00       	mov    $0x0,%eax
+     d95:	eb 21                	jmp    db8 <sharedfd+0x129>
+    exit();
+     d97:	e8 7f 29 00 00       	call   371b <exit>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     d9c:	83 ec 08             	sub    $0x8,%esp
+     d9f:	68 cc 4c 00 00       	push   $0x4ccc
+     da4:	6a 01                	push   $0x1
+     da6:	e8 25 2b 00 00       	call   38d0 <printf>
+    return;
+     dab:	83 c4 10             	add    $0x10,%esp
+     dae:	eb 61                	jmp    e11 <sharedfd+0x182>
+      if(buf[i] == 'c')
+        nc++;
+      if(buf[i] == 'p')
+     db0:	80 fa 70             	cmp    $0x70,%dl
+     db3:	74 17                	je     dcc <sharedfd+0x13d>
+    for(i = 0; i < sizeof(buf); i++){
+     db5:	83 c0 01             	add    $0x1,%eax
+     db8:	83 f8 09             	cmp    $0x9,%eax
+     dbb:	77 bd                	ja     d7a <sharedfd+0xeb>
+      if(buf[i] == 'c')
+     dbd:	0f b6 54 05 de       	movzbl -0x22(%ebp,%eax,1),%edx
+     dc2:	80 fa 63             	cmp    $0x63,%dl
+     dc5:	75 e9                	jne    db0 <sharedfd+0x121>
+        nc++;
+     dc7:	83 c3 01             	add    $0x1,%ebx
+     dca:	eb e4                	jmp    db0 <sharedfd+0x121>
+        np++;
+     dcc:	83 c6 01             	add    $0x1,%esi
+     dcf:	eb e4                	jmp    db5 <sharedfd+0x126>
+    }
+  }
+  close(fd);
+     dd1:	83 ec 0c             	sub    $0xc,%esp
+     dd4:	57                   	push   %edi
+     dd5:	e8 69 29 00 00       	call   3743 <close>
+  unlink("sharedfd");
+     dda:	c7 04 24 bb 3f 00 00 	movl   $0x3fbb,(%esp)
+     de1:	e8 85 29 00 00       	call   376b <unlink>
+  if(nc == 10000 && np == 10000){
+     de6:	83 c4 10             	add    $0x10,%esp
+     de9:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     def:	0f 94 c2             	sete   %dl
+     df2:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+     df8:	0f 94 c0             	sete   %al
+     dfb:	84 c2                	test   %al,%dl
+     dfd:	74 1a                	je     e19 <sharedfd+0x18a>
+    printf(1, "sharedfd ok\n");
+     dff:	83 ec 08             	sub    $0x8,%esp
+     e02:	68 c4 3f 00 00       	push   $0x3fc4
+     e07:	6a 01                	push   $0x1
+     e09:	e8 c2 2a 00 00       	call   38d0 <printf>
+     e0e:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    exit();
+  }
+}
+     e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e14:	5b                   	pop    %ebx
+     e15:	5e                   	pop    %esi
+     e16:	5f                   	pop    %edi
+     e17:	5d                   	pop    %ebp
+     e18:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+     e19:	56                   	push   %esi
+     e1a:	53                   	push   %ebx
+     e1b:	68 d1 3f 00 00       	push   $0x3fd1
+     e20:	6a 01                	push   $0x1
+     e22:	e8 a9 2a 00 00       	call   38d0 <printf>
+    exit();
+     e27:	e8 ef 28 00 00       	call   371b <exit>
+
+00000e2c <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+     e2c:	55                   	push   %ebp
+     e2d:	89 e5                	mov    %esp,%ebp
+     e2f:	57                   	push   %edi
+     e30:	56                   	push   %esi
+     e31:	53                   	push   %ebx
+     e32:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     e35:	c7 45 d8 e6 3f 00 00 	movl   $0x3fe6,-0x28(%ebp)
+     e3c:	c7 45 dc 2f 41 00 00 	movl   $0x412f,-0x24(%ebp)
+     e43:	c7 45 e0 33 41 00 00 	movl   $0x4133,-0x20(%ebp)
+     e4a:	c7 45 e4 e9 3f 00 00 	movl   $0x3fe9,-0x1c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+     e51:	68 ec 3f 00 00       	push   $0x3fec
+     e56:	6a 01                	push   $0x1
+     e58:	e8 73 2a 00 00       	call   38d0 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+     e5d:	83 c4 10             	add    $0x10,%esp
+     e60:	be 00 00 00 00       	mov    $0x0,%esi
+     e65:	eb 45                	jmp    eac <fourfiles+0x80>
+    fname = names[pi];
+    unlink(fname);
+
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+     e67:	83 ec 08             	sub    $0x8,%esp
+     e6a:	68 c1 4a 00 00       	push   $0x4ac1
+     e6f:	6a 01                	push   $0x1
+     e71:	e8 5a 2a 00 00       	call   38d0 <printf>
+      exit();
+     e76:	e8 a0 28 00 00       	call   371b <exit>
+    }
+
+    if(pid == 0){
+      fd = open(fname, O_CREATE | O_RDWR);
+      if(fd < 0){
+        printf(1, "create failed\n");
+     e7b:	83 ec 08             	sub    $0x8,%esp
+     e7e:	68 87 42 00 00       	push   $0x4287
+     e83:	6a 01                	push   $0x1
+     e85:	e8 46 2a 00 00       	call   38d0 <printf>
+        exit();
+     e8a:	e8 8c 28 00 00       	call   371b <exit>
+      }
+
+      memset(buf, '0'+pi, 512);
+      for(i = 0; i < 12; i++){
+        if((n = write(fd, buf, 500)) != 500){
+          printf(1, "write failed %d\n", n);
+     e8f:	83 ec 04             	sub    $0x4,%esp
+     e92:	50                   	push   %eax
+     e93:	68 fc 3f 00 00       	push   $0x3ffc
+     e98:	6a 01                	push   $0x1
+     e9a:	e8 31 2a 00 00       	call   38d0 <printf>
+          exit();
+     e9f:	e8 77 28 00 00       	call   371b <exit>
+        }
+      }
+      exit();
+     ea4:	e8 72 28 00 00       	call   371b <exit>
+  for(pi = 0; pi < 4; pi++){
+     ea9:	83 c6 01             	add    $0x1,%esi
+     eac:	83 fe 03             	cmp    $0x3,%esi
+     eaf:	7f 78                	jg     f29 <fourfiles+0xfd>
+    fname = names[pi];
+     eb1:	8b 7c b5 d8          	mov    -0x28(%ebp,%esi,4),%edi
+    unlink(fname);
+     eb5:	83 ec 0c             	sub    $0xc,%esp
+     eb8:	57                   	push   %edi
+     eb9:	e8 ad 28 00 00       	call   376b <unlink>
+    pid = fork();
+     ebe:	e8 50 28 00 00       	call   3713 <fork>
+    if(pid < 0){
+     ec3:	83 c4 10             	add    $0x10,%esp
+     ec6:	85 c0                	test   %eax,%eax
+     ec8:	78 9d                	js     e67 <fourfiles+0x3b>
+    if(pid == 0){
+     eca:	75 dd                	jne    ea9 <fourfiles+0x7d>
+      fd = open(fname, O_CREATE | O_RDWR);
+     ecc:	89 c3                	mov    %eax,%ebx
+     ece:	83 ec 08             	sub    $0x8,%esp
+     ed1:	68 02 02 00 00       	push   $0x202
+     ed6:	57                   	push   %edi
+     ed7:	e8 7f 28 00 00       	call   375b <open>
+     edc:	89 c7                	mov    %eax,%edi
+      if(fd < 0){
+     ede:	83 c4 10             	add    $0x10,%esp
+     ee1:	85 c0                	test   %eax,%eax
+     ee3:	78 96                	js     e7b <fourfiles+0x4f>
+      memset(buf, '0'+pi, 512);
+     ee5:	83 ec 04             	sub    $0x4,%esp
+     ee8:	68 00 02 00 00       	push   $0x200
+     eed:	83 c6 30             	add    $0x30,%esi
+     ef0:	56                   	push   %esi
+     ef1:	68 e0 7a 00 00       	push   $0x7ae0
+     ef6:	e8 e5 26 00 00       	call   35e0 <memset>
+      for(i = 0; i < 12; i++){
+     efb:	83 c4 10             	add    $0x10,%esp
+     efe:	83 fb 0b             	cmp    $0xb,%ebx
+     f01:	7f a1                	jg     ea4 <fourfiles+0x78>
+        if((n = write(fd, buf, 500)) != 500){
+     f03:	83 ec 04             	sub    $0x4,%esp
+     f06:	68 f4 01 00 00       	push   $0x1f4
+     f0b:	68 e0 7a 00 00       	push   $0x7ae0
+     f10:	57                   	push   %edi
+     f11:	e8 25 28 00 00       	call   373b <write>
+     f16:	83 c4 10             	add    $0x10,%esp
+     f19:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     f1e:	0f 85 6b ff ff ff    	jne    e8f <fourfiles+0x63>
+      for(i = 0; i < 12; i++){
+     f24:	83 c3 01             	add    $0x1,%ebx
+     f27:	eb d5                	jmp    efe <fourfiles+0xd2>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+     f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+     f2e:	eb 08                	jmp    f38 <fourfiles+0x10c>
+    wait();
+     f30:	e8 ee 27 00 00       	call   3723 <wait>
+  for(pi = 0; pi < 4; pi++){
+     f35:	83 c3 01             	add    $0x1,%ebx
+     f38:	83 fb 03             	cmp    $0x3,%ebx
+     f3b:	7e f3                	jle    f30 <fourfiles+0x104>
+  }
+
+  for(i = 0; i < 2; i++){
+     f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+     f42:	eb 78                	jmp    fbc <fourfiles+0x190>
+    fd = open(fname, 0);
+    total = 0;
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+      for(j = 0; j < n; j++){
+        if(buf[j] != '0'+i){
+          printf(1, "wrong char\n");
+     f44:	83 ec 08             	sub    $0x8,%esp
+     f47:	68 0d 40 00 00       	push   $0x400d
+     f4c:	6a 01                	push   $0x1
+     f4e:	e8 7d 29 00 00       	call   38d0 <printf>
+          exit();
+     f53:	e8 c3 27 00 00       	call   371b <exit>
+        }
+      }
+      total += n;
+     f58:	01 fe                	add    %edi,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     f5a:	83 ec 04             	sub    $0x4,%esp
+     f5d:	68 00 20 00 00       	push   $0x2000
+     f62:	68 e0 7a 00 00       	push   $0x7ae0
+     f67:	ff 75 d4             	push   -0x2c(%ebp)
+     f6a:	e8 c4 27 00 00       	call   3733 <read>
+     f6f:	89 c7                	mov    %eax,%edi
+     f71:	83 c4 10             	add    $0x10,%esp
+     f74:	85 c0                	test   %eax,%eax
+     f76:	7e 1c                	jle    f94 <fourfiles+0x168>
+      for(j = 0; j < n; j++){
+     f78:	b8 00 00 00 00       	mov    $0x0,%eax
+     f7d:	39 f8                	cmp    %edi,%eax
+     f7f:	7d d7                	jge    f58 <fourfiles+0x12c>
+        if(buf[j] != '0'+i){
+     f81:	0f be 88 e0 7a 00 00 	movsbl 0x7ae0(%eax),%ecx
+     f88:	8d 53 30             	lea    0x30(%ebx),%edx
+     f8b:	39 d1                	cmp    %edx,%ecx
+     f8d:	75 b5                	jne    f44 <fourfiles+0x118>
+      for(j = 0; j < n; j++){
+     f8f:	83 c0 01             	add    $0x1,%eax
+     f92:	eb e9                	jmp    f7d <fourfiles+0x151>
+    }
+    close(fd);
+     f94:	8b 7d d0             	mov    -0x30(%ebp),%edi
+     f97:	83 ec 0c             	sub    $0xc,%esp
+     f9a:	ff 75 d4             	push   -0x2c(%ebp)
+     f9d:	e8 a1 27 00 00       	call   3743 <close>
+    if(total != 12*500){
+     fa2:	83 c4 10             	add    $0x10,%esp
+     fa5:	81 fe 70 17 00 00    	cmp    $0x1770,%esi
+     fab:	75 36                	jne    fe3 <fourfiles+0x1b7>
+      printf(1, "wrong length %d\n", total);
+      exit();
+    }
+    unlink(fname);
+     fad:	83 ec 0c             	sub    $0xc,%esp
+     fb0:	57                   	push   %edi
+     fb1:	e8 b5 27 00 00       	call   376b <unlink>
+  for(i = 0; i < 2; i++){
+     fb6:	83 c3 01             	add    $0x1,%ebx
+     fb9:	83 c4 10             	add    $0x10,%esp
+     fbc:	83 fb 01             	cmp    $0x1,%ebx
+     fbf:	7f 37                	jg     ff8 <fourfiles+0x1cc>
+    fname = names[i];
+     fc1:	8b 7c 9d d8          	mov    -0x28(%ebp,%ebx,4),%edi
+    fd = open(fname, 0);
+     fc5:	83 ec 08             	sub    $0x8,%esp
+     fc8:	6a 00                	push   $0x0
+     fca:	57                   	push   %edi
+     fcb:	e8 8b 27 00 00       	call   375b <open>
+     fd0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fd3:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     fd6:	be 00 00 00 00       	mov    $0x0,%esi
+     fdb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fde:	e9 77 ff ff ff       	jmp    f5a <fourfiles+0x12e>
+      printf(1, "wrong length %d\n", total);
+     fe3:	83 ec 04             	sub    $0x4,%esp
+     fe6:	56                   	push   %esi
+     fe7:	68 19 40 00 00       	push   $0x4019
+     fec:	6a 01                	push   $0x1
+     fee:	e8 dd 28 00 00       	call   38d0 <printf>
+      exit();
+     ff3:	e8 23 27 00 00       	call   371b <exit>
+  }
+
+  printf(1, "fourfiles ok\n");
+     ff8:	83 ec 08             	sub    $0x8,%esp
+     ffb:	68 2a 40 00 00       	push   $0x402a
+    1000:	6a 01                	push   $0x1
+    1002:	e8 c9 28 00 00       	call   38d0 <printf>
+}
+    1007:	83 c4 10             	add    $0x10,%esp
+    100a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    100d:	5b                   	pop    %ebx
+    100e:	5e                   	pop    %esi
+    100f:	5f                   	pop    %edi
+    1010:	5d                   	pop    %ebp
+    1011:	c3                   	ret
+
+00001012 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1012:	55                   	push   %ebp
+    1013:	89 e5                	mov    %esp,%ebp
+    1015:	56                   	push   %esi
+    1016:	53                   	push   %ebx
+    1017:	83 ec 28             	sub    $0x28,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    101a:	68 38 40 00 00       	push   $0x4038
+    101f:	6a 01                	push   $0x1
+    1021:	e8 aa 28 00 00       	call   38d0 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+    1026:	83 c4 10             	add    $0x10,%esp
+    1029:	be 00 00 00 00       	mov    $0x0,%esi
+    102e:	83 fe 03             	cmp    $0x3,%esi
+    1031:	0f 8f bc 00 00 00    	jg     10f3 <createdelete+0xe1>
+    pid = fork();
+    1037:	e8 d7 26 00 00       	call   3713 <fork>
+    103c:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    103e:	85 c0                	test   %eax,%eax
+    1040:	78 07                	js     1049 <createdelete+0x37>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+    1042:	74 19                	je     105d <createdelete+0x4b>
+  for(pi = 0; pi < 4; pi++){
+    1044:	83 c6 01             	add    $0x1,%esi
+    1047:	eb e5                	jmp    102e <createdelete+0x1c>
+      printf(1, "fork failed\n");
+    1049:	83 ec 08             	sub    $0x8,%esp
+    104c:	68 c1 4a 00 00       	push   $0x4ac1
+    1051:	6a 01                	push   $0x1
+    1053:	e8 78 28 00 00       	call   38d0 <printf>
+      exit();
+    1058:	e8 be 26 00 00       	call   371b <exit>
+      name[0] = 'p' + pi;
+    105d:	8d 46 70             	lea    0x70(%esi),%eax
+    1060:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[2] = '\0';
+    1063:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+      for(i = 0; i < N; i++){
+    1067:	eb 17                	jmp    1080 <createdelete+0x6e>
+        name[1] = '0' + i;
+        fd = open(name, O_CREATE | O_RDWR);
+        if(fd < 0){
+          printf(1, "create failed\n");
+    1069:	83 ec 08             	sub    $0x8,%esp
+    106c:	68 87 42 00 00       	push   $0x4287
+    1071:	6a 01                	push   $0x1
+    1073:	e8 58 28 00 00       	call   38d0 <printf>
+          exit();
+    1078:	e8 9e 26 00 00       	call   371b <exit>
+      for(i = 0; i < N; i++){
+    107d:	83 c3 01             	add    $0x1,%ebx
+    1080:	83 fb 13             	cmp    $0x13,%ebx
+    1083:	7f 69                	jg     10ee <createdelete+0xdc>
+        name[1] = '0' + i;
+    1085:	8d 43 30             	lea    0x30(%ebx),%eax
+    1088:	88 45 d9             	mov    %al,-0x27(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    108b:	83 ec 08             	sub    $0x8,%esp
+    108e:	68 02 02 00 00       	push   $0x202
+    1093:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1096:	50                   	push   %eax
+    1097:	e8 bf 26 00 00       	call   375b <open>
+        if(fd < 0){
+    109c:	83 c4 10             	add    $0x10,%esp
+    109f:	85 c0                	test   %eax,%eax
+    10a1:	78 c6                	js     1069 <createdelete+0x57>
+        }
+        close(fd);
+    10a3:	83 ec 0c             	sub    $0xc,%esp
+    10a6:	50                   	push   %eax
+    10a7:	e8 97 26 00 00       	call   3743 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    10ac:	83 c4 10             	add    $0x10,%esp
+    10af:	85 db                	test   %ebx,%ebx
+    10b1:	7e ca                	jle    107d <createdelete+0x6b>
+    10b3:	f6 c3 01             	test   $0x1,%bl
+    10b6:	75 c5                	jne    107d <createdelete+0x6b>
+          name[1] = '0' + (i / 2);
+    10b8:	89 d8                	mov    %ebx,%eax
+    10ba:	c1 e8 1f             	shr    $0x1f,%eax
+    10bd:	01 d8                	add    %ebx,%eax
+    10bf:	d1 f8                	sar    %eax
+    10c1:	83 c0 30             	add    $0x30,%eax
+    10c4:	88 45 d9             	mov    %al,-0x27(%ebp)
+          if(unlink(name) < 0){
+    10c7:	83 ec 0c             	sub    $0xc,%esp
+    10ca:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    10cd:	50                   	push   %eax
+    10ce:	e8 98 26 00 00       	call   376b <unlink>
+    10d3:	83 c4 10             	add    $0x10,%esp
+    10d6:	85 c0                	test   %eax,%eax
+    10d8:	79 a3                	jns    107d <createdelete+0x6b>
+            printf(1, "unlink failed\n");
+    10da:	83 ec 08             	sub    $0x8,%esp
+    10dd:	68 39 3c 00 00       	push   $0x3c39
+    10e2:	6a 01                	push   $0x1
+    10e4:	e8 e7 27 00 00       	call   38d0 <printf>
+            exit();
+    10e9:	e8 2d 26 00 00       	call   371b <exit>
+          }
+        }
+      }
+      exit();
+    10ee:	e8 28 26 00 00       	call   371b <exit>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    10f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10f8:	eb 08                	jmp    1102 <createdelete+0xf0>
+    wait();
+    10fa:	e8 24 26 00 00       	call   3723 <wait>
+  for(pi = 0; pi < 4; pi++){
+    10ff:	83 c3 01             	add    $0x1,%ebx
+    1102:	83 fb 03             	cmp    $0x3,%ebx
+    1105:	7e f3                	jle    10fa <createdelete+0xe8>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    1107:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+    110b:	c6 45 d9 00          	movb   $0x0,-0x27(%ebp)
+    110f:	c6 45 d8 00          	movb   $0x0,-0x28(%ebp)
+  for(i = 0; i < N; i++){
+    1113:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1118:	e9 89 00 00 00       	jmp    11a6 <createdelete+0x194>
+      name[1] = '0' + i;
+      fd = open(name, 0);
+      if((i == 0 || i >= N/2) && fd < 0){
+        printf(1, "oops createdelete %s didn't exist\n", name);
+        exit();
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    111d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1120:	83 fa 08             	cmp    $0x8,%edx
+    1123:	76 54                	jbe    1179 <createdelete+0x167>
+        printf(1, "oops createdelete %s did exist\n", name);
+        exit();
+      }
+      if(fd >= 0)
+    1125:	85 c0                	test   %eax,%eax
+    1127:	79 6c                	jns    1195 <createdelete+0x183>
+    for(pi = 0; pi < 4; pi++){
+    1129:	83 c6 01             	add    $0x1,%esi
+    112c:	83 fe 03             	cmp    $0x3,%esi
+    112f:	7f 72                	jg     11a3 <createdelete+0x191>
+      name[0] = 'p' + pi;
+    1131:	8d 46 70             	lea    0x70(%esi),%eax
+    1134:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    1137:	8d 43 30             	lea    0x30(%ebx),%eax
+    113a:	88 45 d9             	mov    %al,-0x27(%ebp)
+      fd = open(name, 0);
+    113d:	83 ec 08             	sub    $0x8,%esp
+    1140:	6a 00                	push   $0x0
+    1142:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1145:	50                   	push   %eax
+    1146:	e8 10 26 00 00       	call   375b <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    114b:	83 c4 10             	add    $0x10,%esp
+    114e:	85 db                	test   %ebx,%ebx
+    1150:	0f 94 c2             	sete   %dl
+    1153:	83 fb 09             	cmp    $0x9,%ebx
+    1156:	0f 9f c1             	setg   %cl
+    1159:	08 ca                	or     %cl,%dl
+    115b:	74 c0                	je     111d <createdelete+0x10b>
+    115d:	85 c0                	test   %eax,%eax
+    115f:	79 bc                	jns    111d <createdelete+0x10b>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1161:	83 ec 04             	sub    $0x4,%esp
+    1164:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1167:	50                   	push   %eax
+    1168:	68 f8 4c 00 00       	push   $0x4cf8
+    116d:	6a 01                	push   $0x1
+    116f:	e8 5c 27 00 00       	call   38d0 <printf>
+        exit();
+    1174:	e8 a2 25 00 00       	call   371b <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1179:	85 c0                	test   %eax,%eax
+    117b:	78 ac                	js     1129 <createdelete+0x117>
+        printf(1, "oops createdelete %s did exist\n", name);
+    117d:	83 ec 04             	sub    $0x4,%esp
+    1180:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1183:	50                   	push   %eax
+    1184:	68 1c 4d 00 00       	push   $0x4d1c
+    1189:	6a 01                	push   $0x1
+    118b:	e8 40 27 00 00       	call   38d0 <printf>
+        exit();
+    1190:	e8 86 25 00 00       	call   371b <exit>
+        close(fd);
+    1195:	83 ec 0c             	sub    $0xc,%esp
+    1198:	50                   	push   %eax
+    1199:	e8 a5 25 00 00       	call   3743 <close>
+    119e:	83 c4 10             	add    $0x10,%esp
+    11a1:	eb 86                	jmp    1129 <createdelete+0x117>
+  for(i = 0; i < N; i++){
+    11a3:	83 c3 01             	add    $0x1,%ebx
+    11a6:	83 fb 13             	cmp    $0x13,%ebx
+    11a9:	7f 0a                	jg     11b5 <createdelete+0x1a3>
+    for(pi = 0; pi < 4; pi++){
+    11ab:	be 00 00 00 00       	mov    $0x0,%esi
+    11b0:	e9 77 ff ff ff       	jmp    112c <createdelete+0x11a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    11b5:	be 00 00 00 00       	mov    $0x0,%esi
+    11ba:	eb 26                	jmp    11e2 <createdelete+0x1d0>
+    for(pi = 0; pi < 4; pi++){
+      name[0] = 'p' + i;
+    11bc:	8d 46 70             	lea    0x70(%esi),%eax
+    11bf:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    11c2:	8d 46 30             	lea    0x30(%esi),%eax
+    11c5:	88 45 d9             	mov    %al,-0x27(%ebp)
+      unlink(name);
+    11c8:	83 ec 0c             	sub    $0xc,%esp
+    11cb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    11ce:	50                   	push   %eax
+    11cf:	e8 97 25 00 00       	call   376b <unlink>
+    for(pi = 0; pi < 4; pi++){
+    11d4:	83 c3 01             	add    $0x1,%ebx
+    11d7:	83 c4 10             	add    $0x10,%esp
+    11da:	83 fb 03             	cmp    $0x3,%ebx
+    11dd:	7e dd                	jle    11bc <createdelete+0x1aa>
+  for(i = 0; i < N; i++){
+    11df:	83 c6 01             	add    $0x1,%esi
+    11e2:	83 fe 13             	cmp    $0x13,%esi
+    11e5:	7f 07                	jg     11ee <createdelete+0x1dc>
+    for(pi = 0; pi < 4; pi++){
+    11e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    11ec:	eb ec                	jmp    11da <createdelete+0x1c8>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    11ee:	83 ec 08             	sub    $0x8,%esp
+    11f1:	68 4b 40 00 00       	push   $0x404b
+    11f6:	6a 01                	push   $0x1
+    11f8:	e8 d3 26 00 00       	call   38d0 <printf>
+}
+    11fd:	83 c4 10             	add    $0x10,%esp
+    1200:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1203:	5b                   	pop    %ebx
+    1204:	5e                   	pop    %esi
+    1205:	5d                   	pop    %ebp
+    1206:	c3                   	ret
+
+00001207 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    1207:	55                   	push   %ebp
+    1208:	89 e5                	mov    %esp,%ebp
+    120a:	56                   	push   %esi
+    120b:	53                   	push   %ebx
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    120c:	83 ec 08             	sub    $0x8,%esp
+    120f:	68 5c 40 00 00       	push   $0x405c
+    1214:	6a 01                	push   $0x1
+    1216:	e8 b5 26 00 00       	call   38d0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    121b:	83 c4 08             	add    $0x8,%esp
+    121e:	68 02 02 00 00       	push   $0x202
+    1223:	68 6d 40 00 00       	push   $0x406d
+    1228:	e8 2e 25 00 00       	call   375b <open>
+  if(fd < 0){
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	85 c0                	test   %eax,%eax
+    1232:	0f 88 f0 00 00 00    	js     1328 <unlinkread+0x121>
+    1238:	89 c3                	mov    %eax,%ebx
+    printf(1, "create unlinkread failed\n");
+    exit();
+  }
+  write(fd, "hello", 5);
+    123a:	83 ec 04             	sub    $0x4,%esp
+    123d:	6a 05                	push   $0x5
+    123f:	68 92 40 00 00       	push   $0x4092
+    1244:	50                   	push   %eax
+    1245:	e8 f1 24 00 00       	call   373b <write>
+  close(fd);
+    124a:	89 1c 24             	mov    %ebx,(%esp)
+    124d:	e8 f1 24 00 00       	call   3743 <close>
+
+  fd = open("unlinkread", O_RDWR);
+    1252:	83 c4 08             	add    $0x8,%esp
+    1255:	6a 02                	push   $0x2
+    1257:	68 6d 40 00 00       	push   $0x406d
+    125c:	e8 fa 24 00 00       	call   375b <open>
+    1261:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1263:	83 c4 10             	add    $0x10,%esp
+    1266:	85 c0                	test   %eax,%eax
+    1268:	0f 88 ce 00 00 00    	js     133c <unlinkread+0x135>
+    printf(1, "open unlinkread failed\n");
+    exit();
+  }
+  if(unlink("unlinkread") != 0){
+    126e:	83 ec 0c             	sub    $0xc,%esp
+    1271:	68 6d 40 00 00       	push   $0x406d
+    1276:	e8 f0 24 00 00       	call   376b <unlink>
+    127b:	83 c4 10             	add    $0x10,%esp
+    127e:	85 c0                	test   %eax,%eax
+    1280:	0f 85 ca 00 00 00    	jne    1350 <unlinkread+0x149>
+    printf(1, "unlink unlinkread failed\n");
+    exit();
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1286:	83 ec 08             	sub    $0x8,%esp
+    1289:	68 02 02 00 00       	push   $0x202
+    128e:	68 6d 40 00 00       	push   $0x406d
+    1293:	e8 c3 24 00 00       	call   375b <open>
+    1298:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    129a:	83 c4 0c             	add    $0xc,%esp
+    129d:	6a 03                	push   $0x3
+    129f:	68 ca 40 00 00       	push   $0x40ca
+    12a4:	50                   	push   %eax
+    12a5:	e8 91 24 00 00       	call   373b <write>
+  close(fd1);
+    12aa:	89 34 24             	mov    %esi,(%esp)
+    12ad:	e8 91 24 00 00       	call   3743 <close>
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    12b2:	83 c4 0c             	add    $0xc,%esp
+    12b5:	68 00 20 00 00       	push   $0x2000
+    12ba:	68 e0 7a 00 00       	push   $0x7ae0
+    12bf:	53                   	push   %ebx
+    12c0:	e8 6e 24 00 00       	call   3733 <read>
+    12c5:	83 c4 10             	add    $0x10,%esp
+    12c8:	83 f8 05             	cmp    $0x5,%eax
+    12cb:	0f 85 93 00 00 00    	jne    1364 <unlinkread+0x15d>
+    printf(1, "unlinkread read failed");
+    exit();
+  }
+  if(buf[0] != 'h'){
+    12d1:	80 3d e0 7a 00 00 68 	cmpb   $0x68,0x7ae0
+    12d8:	0f 85 9a 00 00 00    	jne    1378 <unlinkread+0x171>
+    printf(1, "unlinkread wrong data\n");
+    exit();
+  }
+  if(write(fd, buf, 10) != 10){
+    12de:	83 ec 04             	sub    $0x4,%esp
+    12e1:	6a 0a                	push   $0xa
+    12e3:	68 e0 7a 00 00       	push   $0x7ae0
+    12e8:	53                   	push   %ebx
+    12e9:	e8 4d 24 00 00       	call   373b <write>
+    12ee:	83 c4 10             	add    $0x10,%esp
+    12f1:	83 f8 0a             	cmp    $0xa,%eax
+    12f4:	0f 85 92 00 00 00    	jne    138c <unlinkread+0x185>
+    printf(1, "unlinkread write failed\n");
+    exit();
+  }
+  close(fd);
+    12fa:	83 ec 0c             	sub    $0xc,%esp
+    12fd:	53                   	push   %ebx
+    12fe:	e8 40 24 00 00       	call   3743 <close>
+  unlink("unlinkread");
+    1303:	c7 04 24 6d 40 00 00 	movl   $0x406d,(%esp)
+    130a:	e8 5c 24 00 00       	call   376b <unlink>
+  printf(1, "unlinkread ok\n");
+    130f:	83 c4 08             	add    $0x8,%esp
+    1312:	68 15 41 00 00       	push   $0x4115
+    1317:	6a 01                	push   $0x1
+    1319:	e8 b2 25 00 00       	call   38d0 <printf>
+}
+    131e:	83 c4 10             	add    $0x10,%esp
+    1321:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1324:	5b                   	pop    %ebx
+    1325:	5e                   	pop    %esi
+    1326:	5d                   	pop    %ebp
+    1327:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1328:	83 ec 08             	sub    $0x8,%esp
+    132b:	68 78 40 00 00       	push   $0x4078
+    1330:	6a 01                	push   $0x1
+    1332:	e8 99 25 00 00       	call   38d0 <printf>
+    exit();
+    1337:	e8 df 23 00 00       	call   371b <exit>
+    printf(1, "open unlinkread failed\n");
+    133c:	83 ec 08             	sub    $0x8,%esp
+    133f:	68 98 40 00 00       	push   $0x4098
+    1344:	6a 01                	push   $0x1
+    1346:	e8 85 25 00 00       	call   38d0 <printf>
+    exit();
+    134b:	e8 cb 23 00 00       	call   371b <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1350:	83 ec 08             	sub    $0x8,%esp
+    1353:	68 b0 40 00 00       	push   $0x40b0
+    1358:	6a 01                	push   $0x1
+    135a:	e8 71 25 00 00       	call   38d0 <printf>
+    exit();
+    135f:	e8 b7 23 00 00       	call   371b <exit>
+    printf(1, "unlinkread read failed");
+    1364:	83 ec 08             	sub    $0x8,%esp
+    1367:	68 ce 40 00 00       	push   $0x40ce
+    136c:	6a 01                	push   $0x1
+    136e:	e8 5d 25 00 00       	call   38d0 <printf>
+    exit();
+    1373:	e8 a3 23 00 00       	call   371b <exit>
+    printf(1, "unlinkread wrong data\n");
+    1378:	83 ec 08             	sub    $0x8,%esp
+    137b:	68 e5 40 00 00       	push   $0x40e5
+    1380:	6a 01                	push   $0x1
+    1382:	e8 49 25 00 00       	call   38d0 <printf>
+    exit();
+    1387:	e8 8f 23 00 00       	call   371b <exit>
+    printf(1, "unlinkread write failed\n");
+    138c:	83 ec 08             	sub    $0x8,%esp
+    138f:	68 fc 40 00 00       	push   $0x40fc
+    1394:	6a 01                	push   $0x1
+    1396:	e8 35 25 00 00       	call   38d0 <printf>
+    exit();
+    139b:	e8 7b 23 00 00       	call   371b <exit>
+
+000013a0 <linktest>:
+
+void
+linktest(void)
+{
+    13a0:	55                   	push   %ebp
+    13a1:	89 e5                	mov    %esp,%ebp
+    13a3:	53                   	push   %ebx
+    13a4:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    13a7:	68 24 41 00 00       	push   $0x4124
+    13ac:	6a 01                	push   $0x1
+    13ae:	e8 1d 25 00 00       	call   38d0 <printf>
+
+  unlink("lf1");
+    13b3:	c7 04 24 2e 41 00 00 	movl   $0x412e,(%esp)
+    13ba:	e8 ac 23 00 00       	call   376b <unlink>
+  unlink("lf2");
+    13bf:	c7 04 24 32 41 00 00 	movl   $0x4132,(%esp)
+    13c6:	e8 a0 23 00 00       	call   376b <unlink>
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    13cb:	83 c4 08             	add    $0x8,%esp
+    13ce:	68 02 02 00 00       	push   $0x202
+    13d3:	68 2e 41 00 00       	push   $0x412e
+    13d8:	e8 7e 23 00 00       	call   375b <open>
+  if(fd < 0){
+    13dd:	83 c4 10             	add    $0x10,%esp
+    13e0:	85 c0                	test   %eax,%eax
+    13e2:	0f 88 2a 01 00 00    	js     1512 <linktest+0x172>
+    13e8:	89 c3                	mov    %eax,%ebx
+    printf(1, "create lf1 failed\n");
+    exit();
+  }
+  if(write(fd, "hello", 5) != 5){
+    13ea:	83 ec 04             	sub    $0x4,%esp
+    13ed:	6a 05                	push   $0x5
+    13ef:	68 92 40 00 00       	push   $0x4092
+    13f4:	50                   	push   %eax
+    13f5:	e8 41 23 00 00       	call   373b <write>
+    13fa:	83 c4 10             	add    $0x10,%esp
+    13fd:	83 f8 05             	cmp    $0x5,%eax
+    1400:	0f 85 20 01 00 00    	jne    1526 <linktest+0x186>
+    printf(1, "write lf1 failed\n");
+    exit();
+  }
+  close(fd);
+    1406:	83 ec 0c             	sub    $0xc,%esp
+    1409:	53                   	push   %ebx
+    140a:	e8 34 23 00 00       	call   3743 <close>
+
+  if(link("lf1", "lf2") < 0){
+    140f:	83 c4 08             	add    $0x8,%esp
+    1412:	68 32 41 00 00       	push   $0x4132
+    1417:	68 2e 41 00 00       	push   $0x412e
+    141c:	e8 5a 23 00 00       	call   377b <link>
+    1421:	83 c4 10             	add    $0x10,%esp
+    1424:	85 c0                	test   %eax,%eax
+    1426:	0f 88 0e 01 00 00    	js     153a <linktest+0x19a>
+    printf(1, "link lf1 lf2 failed\n");
+    exit();
+  }
+  unlink("lf1");
+    142c:	83 ec 0c             	sub    $0xc,%esp
+    142f:	68 2e 41 00 00       	push   $0x412e
+    1434:	e8 32 23 00 00       	call   376b <unlink>
+
+  if(open("lf1", 0) >= 0){
+    1439:	83 c4 08             	add    $0x8,%esp
+    143c:	6a 00                	push   $0x0
+    143e:	68 2e 41 00 00       	push   $0x412e
+    1443:	e8 13 23 00 00       	call   375b <open>
+    1448:	83 c4 10             	add    $0x10,%esp
+    144b:	85 c0                	test   %eax,%eax
+    144d:	0f 89 fb 00 00 00    	jns    154e <linktest+0x1ae>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    exit();
+  }
+
+  fd = open("lf2", 0);
+    1453:	83 ec 08             	sub    $0x8,%esp
+    1456:	6a 00                	push   $0x0
+    1458:	68 32 41 00 00       	push   $0x4132
+    145d:	e8 f9 22 00 00       	call   375b <open>
+    1462:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1464:	83 c4 10             	add    $0x10,%esp
+    1467:	85 c0                	test   %eax,%eax
+    1469:	0f 88 f3 00 00 00    	js     1562 <linktest+0x1c2>
+    printf(1, "open lf2 failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    146f:	83 ec 04             	sub    $0x4,%esp
+    1472:	68 00 20 00 00       	push   $0x2000
+    1477:	68 e0 7a 00 00       	push   $0x7ae0
+    147c:	50                   	push   %eax
+    147d:	e8 b1 22 00 00       	call   3733 <read>
+    1482:	83 c4 10             	add    $0x10,%esp
+    1485:	83 f8 05             	cmp    $0x5,%eax
+    1488:	0f 85 e8 00 00 00    	jne    1576 <linktest+0x1d6>
+    printf(1, "read lf2 failed\n");
+    exit();
+  }
+  close(fd);
+    148e:	83 ec 0c             	sub    $0xc,%esp
+    1491:	53                   	push   %ebx
+    1492:	e8 ac 22 00 00       	call   3743 <close>
+
+  if(link("lf2", "lf2") >= 0){
+    1497:	83 c4 08             	add    $0x8,%esp
+    149a:	68 32 41 00 00       	push   $0x4132
+    149f:	68 32 41 00 00       	push   $0x4132
+    14a4:	e8 d2 22 00 00       	call   377b <link>
+    14a9:	83 c4 10             	add    $0x10,%esp
+    14ac:	85 c0                	test   %eax,%eax
+    14ae:	0f 89 d6 00 00 00    	jns    158a <linktest+0x1ea>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    exit();
+  }
+
+  unlink("lf2");
+    14b4:	83 ec 0c             	sub    $0xc,%esp
+    14b7:	68 32 41 00 00       	push   $0x4132
+    14bc:	e8 aa 22 00 00       	call   376b <unlink>
+  if(link("lf2", "lf1") >= 0){
+    14c1:	83 c4 08             	add    $0x8,%esp
+    14c4:	68 2e 41 00 00       	push   $0x412e
+    14c9:	68 32 41 00 00       	push   $0x4132
+    14ce:	e8 a8 22 00 00       	call   377b <link>
+    14d3:	83 c4 10             	add    $0x10,%esp
+    14d6:	85 c0                	test   %eax,%eax
+    14d8:	0f 89 c0 00 00 00    	jns    159e <linktest+0x1fe>
+    printf(1, "link non-existant succeeded! oops\n");
+    exit();
+  }
+
+  if(link(".", "lf1") >= 0){
+    14de:	83 ec 08             	sub    $0x8,%esp
+    14e1:	68 2e 41 00 00       	push   $0x412e
+    14e6:	68 f6 43 00 00       	push   $0x43f6
+    14eb:	e8 8b 22 00 00       	call   377b <link>
+    14f0:	83 c4 10             	add    $0x10,%esp
+    14f3:	85 c0                	test   %eax,%eax
+    14f5:	0f 89 b7 00 00 00    	jns    15b2 <linktest+0x212>
+    printf(1, "link . lf1 succeeded! oops\n");
+    exit();
+  }
+
+  printf(1, "linktest ok\n");
+    14fb:	83 ec 08             	sub    $0x8,%esp
+    14fe:	68 cc 41 00 00       	push   $0x41cc
+    1503:	6a 01                	push   $0x1
+    1505:	e8 c6 23 00 00       	call   38d0 <printf>
+}
+    150a:	83 c4 10             	add    $0x10,%esp
+    150d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1510:	c9                   	leave
+    1511:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1512:	83 ec 08             	sub    $0x8,%esp
+    1515:	68 36 41 00 00       	push   $0x4136
+    151a:	6a 01                	push   $0x1
+    151c:	e8 af 23 00 00       	call   38d0 <printf>
+    exit();
+    1521:	e8 f5 21 00 00       	call   371b <exit>
+    printf(1, "write lf1 failed\n");
+    1526:	83 ec 08             	sub    $0x8,%esp
+    1529:	68 49 41 00 00       	push   $0x4149
+    152e:	6a 01                	push   $0x1
+    1530:	e8 9b 23 00 00       	call   38d0 <printf>
+    exit();
+    1535:	e8 e1 21 00 00       	call   371b <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    153a:	83 ec 08             	sub    $0x8,%esp
+    153d:	68 5b 41 00 00       	push   $0x415b
+    1542:	6a 01                	push   $0x1
+    1544:	e8 87 23 00 00       	call   38d0 <printf>
+    exit();
+    1549:	e8 cd 21 00 00       	call   371b <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    154e:	83 ec 08             	sub    $0x8,%esp
+    1551:	68 3c 4d 00 00       	push   $0x4d3c
+    1556:	6a 01                	push   $0x1
+    1558:	e8 73 23 00 00       	call   38d0 <printf>
+    exit();
+    155d:	e8 b9 21 00 00       	call   371b <exit>
+    printf(1, "open lf2 failed\n");
+    1562:	83 ec 08             	sub    $0x8,%esp
+    1565:	68 70 41 00 00       	push   $0x4170
+    156a:	6a 01                	push   $0x1
+    156c:	e8 5f 23 00 00       	call   38d0 <printf>
+    exit();
+    1571:	e8 a5 21 00 00       	call   371b <exit>
+    printf(1, "read lf2 failed\n");
+    1576:	83 ec 08             	sub    $0x8,%esp
+    1579:	68 81 41 00 00       	push   $0x4181
+    157e:	6a 01                	push   $0x1
+    1580:	e8 4b 23 00 00       	call   38d0 <printf>
+    exit();
+    1585:	e8 91 21 00 00       	call   371b <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    158a:	83 ec 08             	sub    $0x8,%esp
+    158d:	68 92 41 00 00       	push   $0x4192
+    1592:	6a 01                	push   $0x1
+    1594:	e8 37 23 00 00       	call   38d0 <printf>
+    exit();
+    1599:	e8 7d 21 00 00       	call   371b <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    159e:	83 ec 08             	sub    $0x8,%esp
+    15a1:	68 64 4d 00 00       	push   $0x4d64
+    15a6:	6a 01                	push   $0x1
+    15a8:	e8 23 23 00 00       	call   38d0 <printf>
+    exit();
+    15ad:	e8 69 21 00 00       	call   371b <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    15b2:	83 ec 08             	sub    $0x8,%esp
+    15b5:	68 b0 41 00 00       	push   $0x41b0
+    15ba:	6a 01                	push   $0x1
+    15bc:	e8 0f 23 00 00       	call   38d0 <printf>
+    exit();
+    15c1:	e8 55 21 00 00       	call   371b <exit>
+
+000015c6 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    15c6:	55                   	push   %ebp
+    15c7:	89 e5                	mov    %esp,%ebp
+    15c9:	57                   	push   %edi
+    15ca:	56                   	push   %esi
+    15cb:	53                   	push   %ebx
+    15cc:	83 ec 54             	sub    $0x54,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    15cf:	68 d9 41 00 00       	push   $0x41d9
+    15d4:	6a 01                	push   $0x1
+    15d6:	e8 f5 22 00 00       	call   38d0 <printf>
+  file[0] = 'C';
+    15db:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    15df:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    15e3:	83 c4 10             	add    $0x10,%esp
+    15e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    15eb:	eb 5a                	jmp    1647 <concreate+0x81>
+    file[1] = '0' + i;
+    unlink(file);
+    pid = fork();
+    if(pid && (i % 3) == 1){
+      link("C0", file);
+    } else if(pid == 0 && (i % 5) == 1){
+    15ed:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    15f2:	89 d8                	mov    %ebx,%eax
+    15f4:	f7 ea                	imul   %edx
+    15f6:	d1 fa                	sar    %edx
+    15f8:	89 d8                	mov    %ebx,%eax
+    15fa:	c1 f8 1f             	sar    $0x1f,%eax
+    15fd:	29 c2                	sub    %eax,%edx
+    15ff:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1602:	89 da                	mov    %ebx,%edx
+    1604:	29 c2                	sub    %eax,%edx
+    1606:	83 fa 01             	cmp    $0x1,%edx
+    1609:	0f 84 9b 00 00 00    	je     16aa <concreate+0xe4>
+      link("C0", file);
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    160f:	83 ec 08             	sub    $0x8,%esp
+    1612:	68 02 02 00 00       	push   $0x202
+    1617:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    161a:	50                   	push   %eax
+    161b:	e8 3b 21 00 00       	call   375b <open>
+      if(fd < 0){
+    1620:	83 c4 10             	add    $0x10,%esp
+    1623:	85 c0                	test   %eax,%eax
+    1625:	0f 88 98 00 00 00    	js     16c3 <concreate+0xfd>
+        printf(1, "concreate create %s failed\n", file);
+        exit();
+      }
+      close(fd);
+    162b:	83 ec 0c             	sub    $0xc,%esp
+    162e:	50                   	push   %eax
+    162f:	e8 0f 21 00 00       	call   3743 <close>
+    1634:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1637:	85 f6                	test   %esi,%esi
+    1639:	0f 84 9c 00 00 00    	je     16db <concreate+0x115>
+      exit();
+    else
+      wait();
+    163f:	e8 df 20 00 00       	call   3723 <wait>
+  for(i = 0; i < 40; i++){
+    1644:	83 c3 01             	add    $0x1,%ebx
+    1647:	83 fb 27             	cmp    $0x27,%ebx
+    164a:	0f 8f 90 00 00 00    	jg     16e0 <concreate+0x11a>
+    file[1] = '0' + i;
+    1650:	8d 43 30             	lea    0x30(%ebx),%eax
+    1653:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1656:	83 ec 0c             	sub    $0xc,%esp
+    1659:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    165c:	50                   	push   %eax
+    165d:	e8 09 21 00 00       	call   376b <unlink>
+    pid = fork();
+    1662:	e8 ac 20 00 00       	call   3713 <fork>
+    1667:	89 c6                	mov    %eax,%esi
+    if(pid && (i % 3) == 1){
+    1669:	83 c4 10             	add    $0x10,%esp
+    166c:	85 c0                	test   %eax,%eax
+    166e:	0f 84 79 ff ff ff    	je     15ed <concreate+0x27>
+    1674:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1679:	89 d8                	mov    %ebx,%eax
+    167b:	f7 ea                	imul   %edx
+    167d:	89 d8                	mov    %ebx,%eax
+    167f:	c1 f8 1f             	sar    $0x1f,%eax
+    1682:	29 c2                	sub    %eax,%edx
+    1684:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1687:	89 da                	mov    %ebx,%edx
+    1689:	29 c2                	sub    %eax,%edx
+    168b:	83 fa 01             	cmp    $0x1,%edx
+    168e:	0f 85 7b ff ff ff    	jne    160f <concreate+0x49>
+      link("C0", file);
+    1694:	83 ec 08             	sub    $0x8,%esp
+    1697:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    169a:	50                   	push   %eax
+    169b:	68 e9 41 00 00       	push   $0x41e9
+    16a0:	e8 d6 20 00 00       	call   377b <link>
+    16a5:	83 c4 10             	add    $0x10,%esp
+    16a8:	eb 8d                	jmp    1637 <concreate+0x71>
+      link("C0", file);
+    16aa:	83 ec 08             	sub    $0x8,%esp
+    16ad:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    16b0:	50                   	push   %eax
+    16b1:	68 e9 41 00 00       	push   $0x41e9
+    16b6:	e8 c0 20 00 00       	call   377b <link>
+    16bb:	83 c4 10             	add    $0x10,%esp
+    16be:	e9 74 ff ff ff       	jmp    1637 <concreate+0x71>
+        printf(1, "concreate create %s failed\n", file);
+    16c3:	83 ec 04             	sub    $0x4,%esp
+    16c6:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    16c9:	50                   	push   %eax
+    16ca:	68 ec 41 00 00       	push   $0x41ec
+    16cf:	6a 01                	push   $0x1
+    16d1:	e8 fa 21 00 00       	call   38d0 <printf>
+        exit();
+    16d6:	e8 40 20 00 00       	call   371b <exit>
+      exit();
+    16db:	e8 3b 20 00 00       	call   371b <exit>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    16e0:	83 ec 04             	sub    $0x4,%esp
+    16e3:	6a 28                	push   $0x28
+    16e5:	6a 00                	push   $0x0
+    16e7:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    16ea:	50                   	push   %eax
+    16eb:	e8 f0 1e 00 00       	call   35e0 <memset>
+  fd = open(".", 0);
+    16f0:	83 c4 08             	add    $0x8,%esp
+    16f3:	6a 00                	push   $0x0
+    16f5:	68 f6 43 00 00       	push   $0x43f6
+    16fa:	e8 5c 20 00 00       	call   375b <open>
+    16ff:	89 c3                	mov    %eax,%ebx
+  n = 0;
+  while(read(fd, &de, sizeof(de)) > 0){
+    1701:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    1704:	be 00 00 00 00       	mov    $0x0,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1709:	83 ec 04             	sub    $0x4,%esp
+    170c:	6a 10                	push   $0x10
+    170e:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1711:	50                   	push   %eax
+    1712:	53                   	push   %ebx
+    1713:	e8 1b 20 00 00       	call   3733 <read>
+    1718:	83 c4 10             	add    $0x10,%esp
+    171b:	85 c0                	test   %eax,%eax
+    171d:	7e 60                	jle    177f <concreate+0x1b9>
+    if(de.inum == 0)
+    171f:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+    1724:	74 e3                	je     1709 <concreate+0x143>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1726:	80 7d ae 43          	cmpb   $0x43,-0x52(%ebp)
+    172a:	75 dd                	jne    1709 <concreate+0x143>
+    172c:	80 7d b0 00          	cmpb   $0x0,-0x50(%ebp)
+    1730:	75 d7                	jne    1709 <concreate+0x143>
+      i = de.name[1] - '0';
+    1732:	0f be 45 af          	movsbl -0x51(%ebp),%eax
+    1736:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1739:	83 f8 27             	cmp    $0x27,%eax
+    173c:	77 11                	ja     174f <concreate+0x189>
+        printf(1, "concreate weird file %s\n", de.name);
+        exit();
+      }
+      if(fa[i]){
+    173e:	80 7c 05 bd 00       	cmpb   $0x0,-0x43(%ebp,%eax,1)
+    1743:	75 22                	jne    1767 <concreate+0x1a1>
+        printf(1, "concreate duplicate file %s\n", de.name);
+        exit();
+      }
+      fa[i] = 1;
+    1745:	c6 44 05 bd 01       	movb   $0x1,-0x43(%ebp,%eax,1)
+      n++;
+    174a:	83 c6 01             	add    $0x1,%esi
+    174d:	eb ba                	jmp    1709 <concreate+0x143>
+        printf(1, "concreate weird file %s\n", de.name);
+    174f:	83 ec 04             	sub    $0x4,%esp
+    1752:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    1755:	50                   	push   %eax
+    1756:	68 08 42 00 00       	push   $0x4208
+    175b:	6a 01                	push   $0x1
+    175d:	e8 6e 21 00 00       	call   38d0 <printf>
+        exit();
+    1762:	e8 b4 1f 00 00       	call   371b <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1767:	83 ec 04             	sub    $0x4,%esp
+    176a:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    176d:	50                   	push   %eax
+    176e:	68 21 42 00 00       	push   $0x4221
+    1773:	6a 01                	push   $0x1
+    1775:	e8 56 21 00 00       	call   38d0 <printf>
+        exit();
+    177a:	e8 9c 1f 00 00       	call   371b <exit>
+    }
+  }
+  close(fd);
+    177f:	83 ec 0c             	sub    $0xc,%esp
+    1782:	53                   	push   %ebx
+    1783:	e8 bb 1f 00 00       	call   3743 <close>
+
+  if(n != 40){
+    1788:	83 c4 10             	add    $0x10,%esp
+    178b:	83 fe 28             	cmp    $0x28,%esi
+    178e:	75 0a                	jne    179a <concreate+0x1d4>
+    printf(1, "concreate not enough files in directory listing\n");
+    exit();
+  }
+
+  for(i = 0; i < 40; i++){
+    1790:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1795:	e9 86 00 00 00       	jmp    1820 <concreate+0x25a>
+    printf(1, "concreate not enough files in directory listing\n");
+    179a:	83 ec 08             	sub    $0x8,%esp
+    179d:	68 88 4d 00 00       	push   $0x4d88
+    17a2:	6a 01                	push   $0x1
+    17a4:	e8 27 21 00 00       	call   38d0 <printf>
+    exit();
+    17a9:	e8 6d 1f 00 00       	call   371b <exit>
+    file[1] = '0' + i;
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+    17ae:	83 ec 08             	sub    $0x8,%esp
+    17b1:	68 c1 4a 00 00       	push   $0x4ac1
+    17b6:	6a 01                	push   $0x1
+    17b8:	e8 13 21 00 00       	call   38d0 <printf>
+      exit();
+    17bd:	e8 59 1f 00 00       	call   371b <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+       ((i % 3) == 1 && pid != 0)){
+      close(open(file, 0));
+    17c2:	83 ec 08             	sub    $0x8,%esp
+    17c5:	6a 00                	push   $0x0
+    17c7:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    17ca:	57                   	push   %edi
+    17cb:	e8 8b 1f 00 00       	call   375b <open>
+    17d0:	89 04 24             	mov    %eax,(%esp)
+    17d3:	e8 6b 1f 00 00       	call   3743 <close>
+      close(open(file, 0));
+    17d8:	83 c4 08             	add    $0x8,%esp
+    17db:	6a 00                	push   $0x0
+    17dd:	57                   	push   %edi
+    17de:	e8 78 1f 00 00       	call   375b <open>
+    17e3:	89 04 24             	mov    %eax,(%esp)
+    17e6:	e8 58 1f 00 00       	call   3743 <close>
+      close(open(file, 0));
+    17eb:	83 c4 08             	add    $0x8,%esp
+    17ee:	6a 00                	push   $0x0
+    17f0:	57                   	push   %edi
+    17f1:	e8 65 1f 00 00       	call   375b <open>
+    17f6:	89 04 24             	mov    %eax,(%esp)
+    17f9:	e8 45 1f 00 00       	call   3743 <close>
+      close(open(file, 0));
+    17fe:	83 c4 08             	add    $0x8,%esp
+    1801:	6a 00                	push   $0x0
+    1803:	57                   	push   %edi
+    1804:	e8 52 1f 00 00       	call   375b <open>
+    1809:	89 04 24             	mov    %eax,(%esp)
+    180c:	e8 32 1f 00 00       	call   3743 <close>
+    1811:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+      unlink(file);
+      unlink(file);
+      unlink(file);
+    }
+    if(pid == 0)
+    1814:	85 f6                	test   %esi,%esi
+    1816:	74 79                	je     1891 <concreate+0x2cb>
+      exit();
+    else
+      wait();
+    1818:	e8 06 1f 00 00       	call   3723 <wait>
+  for(i = 0; i < 40; i++){
+    181d:	83 c3 01             	add    $0x1,%ebx
+    1820:	83 fb 27             	cmp    $0x27,%ebx
+    1823:	7f 71                	jg     1896 <concreate+0x2d0>
+    file[1] = '0' + i;
+    1825:	8d 43 30             	lea    0x30(%ebx),%eax
+    1828:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    182b:	e8 e3 1e 00 00       	call   3713 <fork>
+    1830:	89 c6                	mov    %eax,%esi
+    if(pid < 0){
+    1832:	85 c0                	test   %eax,%eax
+    1834:	0f 88 74 ff ff ff    	js     17ae <concreate+0x1e8>
+    if(((i % 3) == 0 && pid == 0) ||
+    183a:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    183f:	89 d8                	mov    %ebx,%eax
+    1841:	f7 ea                	imul   %edx
+    1843:	89 d8                	mov    %ebx,%eax
+    1845:	c1 f8 1f             	sar    $0x1f,%eax
+    1848:	29 c2                	sub    %eax,%edx
+    184a:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    184d:	89 da                	mov    %ebx,%edx
+    184f:	29 c2                	sub    %eax,%edx
+    1851:	89 d0                	mov    %edx,%eax
+    1853:	09 f0                	or     %esi,%eax
+    1855:	0f 84 67 ff ff ff    	je     17c2 <concreate+0x1fc>
+    185b:	83 fa 01             	cmp    $0x1,%edx
+    185e:	75 08                	jne    1868 <concreate+0x2a2>
+       ((i % 3) == 1 && pid != 0)){
+    1860:	85 f6                	test   %esi,%esi
+    1862:	0f 85 5a ff ff ff    	jne    17c2 <concreate+0x1fc>
+      unlink(file);
+    1868:	83 ec 0c             	sub    $0xc,%esp
+    186b:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    186e:	57                   	push   %edi
+    186f:	e8 f7 1e 00 00       	call   376b <unlink>
+      unlink(file);
+    1874:	89 3c 24             	mov    %edi,(%esp)
+    1877:	e8 ef 1e 00 00       	call   376b <unlink>
+      unlink(file);
+    187c:	89 3c 24             	mov    %edi,(%esp)
+    187f:	e8 e7 1e 00 00       	call   376b <unlink>
+      unlink(file);
+    1884:	89 3c 24             	mov    %edi,(%esp)
+    1887:	e8 df 1e 00 00       	call   376b <unlink>
+    188c:	83 c4 10             	add    $0x10,%esp
+    188f:	eb 83                	jmp    1814 <concreate+0x24e>
+      exit();
+    1891:	e8 85 1e 00 00       	call   371b <exit>
+  }
+
+  printf(1, "concreate ok\n");
+    1896:	83 ec 08             	sub    $0x8,%esp
+    1899:	68 3e 42 00 00       	push   $0x423e
+    189e:	6a 01                	push   $0x1
+    18a0:	e8 2b 20 00 00       	call   38d0 <printf>
+}
+    18a5:	83 c4 10             	add    $0x10,%esp
+    18a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18ab:	5b                   	pop    %ebx
+    18ac:	5e                   	pop    %esi
+    18ad:	5f                   	pop    %edi
+    18ae:	5d                   	pop    %ebp
+    18af:	c3                   	ret
+
+000018b0 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	57                   	push   %edi
+    18b4:	56                   	push   %esi
+    18b5:	53                   	push   %ebx
+    18b6:	83 ec 14             	sub    $0x14,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    18b9:	68 4c 42 00 00       	push   $0x424c
+    18be:	6a 01                	push   $0x1
+    18c0:	e8 0b 20 00 00       	call   38d0 <printf>
+
+  unlink("x");
+    18c5:	c7 04 24 d9 44 00 00 	movl   $0x44d9,(%esp)
+    18cc:	e8 9a 1e 00 00       	call   376b <unlink>
+  pid = fork();
+    18d1:	e8 3d 1e 00 00       	call   3713 <fork>
+  if(pid < 0){
+    18d6:	83 c4 10             	add    $0x10,%esp
+    18d9:	85 c0                	test   %eax,%eax
+    18db:	78 10                	js     18ed <linkunlink+0x3d>
+    18dd:	89 c7                	mov    %eax,%edi
+    printf(1, "fork failed\n");
+    exit();
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    18df:	74 20                	je     1901 <linkunlink+0x51>
+    18e1:	bb 01 00 00 00       	mov    $0x1,%ebx
+    18e6:	be 00 00 00 00       	mov    $0x0,%esi
+    18eb:	eb 3b                	jmp    1928 <linkunlink+0x78>
+    printf(1, "fork failed\n");
+    18ed:	83 ec 08             	sub    $0x8,%esp
+    18f0:	68 c1 4a 00 00       	push   $0x4ac1
+    18f5:	6a 01                	push   $0x1
+    18f7:	e8 d4 1f 00 00       	call   38d0 <printf>
+    exit();
+    18fc:	e8 1a 1e 00 00       	call   371b <exit>
+  unsigned int x = (pid ? 1 : 97);
+    1901:	bb 61 00 00 00       	mov    $0x61,%ebx
+    1906:	eb de                	jmp    18e6 <linkunlink+0x36>
+  for(i = 0; i < 100; i++){
+    x = x * 1103515245 + 12345;
+    if((x % 3) == 0){
+      close(open("x", O_RDWR | O_CREATE));
+    1908:	83 ec 08             	sub    $0x8,%esp
+    190b:	68 02 02 00 00       	push   $0x202
+    1910:	68 d9 44 00 00       	push   $0x44d9
+    1915:	e8 41 1e 00 00       	call   375b <open>
+    191a:	89 04 24             	mov    %eax,(%esp)
+    191d:	e8 21 1e 00 00       	call   3743 <close>
+    1922:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1925:	83 c6 01             	add    $0x1,%esi
+    1928:	83 fe 63             	cmp    $0x63,%esi
+    192b:	7f 52                	jg     197f <linkunlink+0xcf>
+    x = x * 1103515245 + 12345;
+    192d:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    1933:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    1939:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    193e:	89 d8                	mov    %ebx,%eax
+    1940:	f7 e2                	mul    %edx
+    1942:	89 d0                	mov    %edx,%eax
+    1944:	d1 e8                	shr    %eax
+    1946:	83 e2 fe             	and    $0xfffffffe,%edx
+    1949:	01 c2                	add    %eax,%edx
+    194b:	89 d8                	mov    %ebx,%eax
+    194d:	29 d0                	sub    %edx,%eax
+    194f:	74 b7                	je     1908 <linkunlink+0x58>
+    } else if((x % 3) == 1){
+    1951:	83 f8 01             	cmp    $0x1,%eax
+    1954:	74 12                	je     1968 <linkunlink+0xb8>
+      link("cat", "x");
+    } else {
+      unlink("x");
+    1956:	83 ec 0c             	sub    $0xc,%esp
+    1959:	68 d9 44 00 00       	push   $0x44d9
+    195e:	e8 08 1e 00 00       	call   376b <unlink>
+    1963:	83 c4 10             	add    $0x10,%esp
+    1966:	eb bd                	jmp    1925 <linkunlink+0x75>
+      link("cat", "x");
+    1968:	83 ec 08             	sub    $0x8,%esp
+    196b:	68 d9 44 00 00       	push   $0x44d9
+    1970:	68 5d 42 00 00       	push   $0x425d
+    1975:	e8 01 1e 00 00       	call   377b <link>
+    197a:	83 c4 10             	add    $0x10,%esp
+    197d:	eb a6                	jmp    1925 <linkunlink+0x75>
+    }
+  }
+
+  if(pid)
+    197f:	85 ff                	test   %edi,%edi
+    1981:	74 1c                	je     199f <linkunlink+0xef>
+    wait();
+    1983:	e8 9b 1d 00 00       	call   3723 <wait>
+  else
+    exit();
+
+  printf(1, "linkunlink ok\n");
+    1988:	83 ec 08             	sub    $0x8,%esp
+    198b:	68 61 42 00 00       	push   $0x4261
+    1990:	6a 01                	push   $0x1
+    1992:	e8 39 1f 00 00       	call   38d0 <printf>
+}
+    1997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    199a:	5b                   	pop    %ebx
+    199b:	5e                   	pop    %esi
+    199c:	5f                   	pop    %edi
+    199d:	5d                   	pop    %ebp
+    199e:	c3                   	ret
+    exit();
+    199f:	e8 77 1d 00 00       	call   371b <exit>
+
+000019a4 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    19a4:	55                   	push   %ebp
+    19a5:	89 e5                	mov    %esp,%ebp
+    19a7:	53                   	push   %ebx
+    19a8:	83 ec 1c             	sub    $0x1c,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    19ab:	68 70 42 00 00       	push   $0x4270
+    19b0:	6a 01                	push   $0x1
+    19b2:	e8 19 1f 00 00       	call   38d0 <printf>
+  unlink("bd");
+    19b7:	c7 04 24 7d 42 00 00 	movl   $0x427d,(%esp)
+    19be:	e8 a8 1d 00 00       	call   376b <unlink>
+
+  fd = open("bd", O_CREATE);
+    19c3:	83 c4 08             	add    $0x8,%esp
+    19c6:	68 00 02 00 00       	push   $0x200
+    19cb:	68 7d 42 00 00       	push   $0x427d
+    19d0:	e8 86 1d 00 00       	call   375b <open>
+  if(fd < 0){
+    19d5:	83 c4 10             	add    $0x10,%esp
+    19d8:	85 c0                	test   %eax,%eax
+    19da:	78 65                	js     1a41 <bigdir+0x9d>
+    printf(1, "bigdir create failed\n");
+    exit();
+  }
+  close(fd);
+    19dc:	83 ec 0c             	sub    $0xc,%esp
+    19df:	50                   	push   %eax
+    19e0:	e8 5e 1d 00 00       	call   3743 <close>
+
+  for(i = 0; i < 500; i++){
+    19e5:	83 c4 10             	add    $0x10,%esp
+    19e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    19ed:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    19f3:	7f 74                	jg     1a69 <bigdir+0xc5>
+    name[0] = 'x';
+    19f5:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    19f9:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    19fc:	85 db                	test   %ebx,%ebx
+    19fe:	0f 49 c3             	cmovns %ebx,%eax
+    1a01:	c1 f8 06             	sar    $0x6,%eax
+    1a04:	83 c0 30             	add    $0x30,%eax
+    1a07:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1a0a:	89 da                	mov    %ebx,%edx
+    1a0c:	c1 fa 1f             	sar    $0x1f,%edx
+    1a0f:	c1 ea 1a             	shr    $0x1a,%edx
+    1a12:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1a15:	83 e0 3f             	and    $0x3f,%eax
+    1a18:	29 d0                	sub    %edx,%eax
+    1a1a:	83 c0 30             	add    $0x30,%eax
+    1a1d:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1a20:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(link("bd", name) != 0){
+    1a24:	83 ec 08             	sub    $0x8,%esp
+    1a27:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1a2a:	50                   	push   %eax
+    1a2b:	68 7d 42 00 00       	push   $0x427d
+    1a30:	e8 46 1d 00 00       	call   377b <link>
+    1a35:	83 c4 10             	add    $0x10,%esp
+    1a38:	85 c0                	test   %eax,%eax
+    1a3a:	75 19                	jne    1a55 <bigdir+0xb1>
+  for(i = 0; i < 500; i++){
+    1a3c:	83 c3 01             	add    $0x1,%ebx
+    1a3f:	eb ac                	jmp    19ed <bigdir+0x49>
+    printf(1, "bigdir create failed\n");
+    1a41:	83 ec 08             	sub    $0x8,%esp
+    1a44:	68 80 42 00 00       	push   $0x4280
+    1a49:	6a 01                	push   $0x1
+    1a4b:	e8 80 1e 00 00       	call   38d0 <printf>
+    exit();
+    1a50:	e8 c6 1c 00 00       	call   371b <exit>
+      printf(1, "bigdir link failed\n");
+    1a55:	83 ec 08             	sub    $0x8,%esp
+    1a58:	68 96 42 00 00       	push   $0x4296
+    1a5d:	6a 01                	push   $0x1
+    1a5f:	e8 6c 1e 00 00       	call   38d0 <printf>
+      exit();
+    1a64:	e8 b2 1c 00 00       	call   371b <exit>
+    }
+  }
+
+  unlink("bd");
+    1a69:	83 ec 0c             	sub    $0xc,%esp
+    1a6c:	68 7d 42 00 00       	push   $0x427d
+    1a71:	e8 f5 1c 00 00       	call   376b <unlink>
+  for(i = 0; i < 500; i++){
+    1a76:	83 c4 10             	add    $0x10,%esp
+    1a79:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1a7e:	eb 03                	jmp    1a83 <bigdir+0xdf>
+    1a80:	83 c3 01             	add    $0x1,%ebx
+    1a83:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    1a89:	7f 56                	jg     1ae1 <bigdir+0x13d>
+    name[0] = 'x';
+    1a8b:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    1a8f:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    1a92:	85 db                	test   %ebx,%ebx
+    1a94:	0f 49 c3             	cmovns %ebx,%eax
+    1a97:	c1 f8 06             	sar    $0x6,%eax
+    1a9a:	83 c0 30             	add    $0x30,%eax
+    1a9d:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1aa0:	89 da                	mov    %ebx,%edx
+    1aa2:	c1 fa 1f             	sar    $0x1f,%edx
+    1aa5:	c1 ea 1a             	shr    $0x1a,%edx
+    1aa8:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1aab:	83 e0 3f             	and    $0x3f,%eax
+    1aae:	29 d0                	sub    %edx,%eax
+    1ab0:	83 c0 30             	add    $0x30,%eax
+    1ab3:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1ab6:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(unlink(name) != 0){
+    1aba:	83 ec 0c             	sub    $0xc,%esp
+    1abd:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1ac0:	50                   	push   %eax
+    1ac1:	e8 a5 1c 00 00       	call   376b <unlink>
+    1ac6:	83 c4 10             	add    $0x10,%esp
+    1ac9:	85 c0                	test   %eax,%eax
+    1acb:	74 b3                	je     1a80 <bigdir+0xdc>
+      printf(1, "bigdir unlink failed");
+    1acd:	83 ec 08             	sub    $0x8,%esp
+    1ad0:	68 aa 42 00 00       	push   $0x42aa
+    1ad5:	6a 01                	push   $0x1
+    1ad7:	e8 f4 1d 00 00       	call   38d0 <printf>
+      exit();
+    1adc:	e8 3a 1c 00 00       	call   371b <exit>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    1ae1:	83 ec 08             	sub    $0x8,%esp
+    1ae4:	68 bf 42 00 00       	push   $0x42bf
+    1ae9:	6a 01                	push   $0x1
+    1aeb:	e8 e0 1d 00 00       	call   38d0 <printf>
+}
+    1af0:	83 c4 10             	add    $0x10,%esp
+    1af3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1af6:	c9                   	leave
+    1af7:	c3                   	ret
+
+00001af8 <subdir>:
+
+void
+subdir(void)
+{
+    1af8:	55                   	push   %ebp
+    1af9:	89 e5                	mov    %esp,%ebp
+    1afb:	53                   	push   %ebx
+    1afc:	83 ec 0c             	sub    $0xc,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    1aff:	68 ca 42 00 00       	push   $0x42ca
+    1b04:	6a 01                	push   $0x1
+    1b06:	e8 c5 1d 00 00       	call   38d0 <printf>
+
+  unlink("ff");
+    1b0b:	c7 04 24 53 43 00 00 	movl   $0x4353,(%esp)
+    1b12:	e8 54 1c 00 00       	call   376b <unlink>
+  if(mkdir("dd") != 0){
+    1b17:	c7 04 24 f0 43 00 00 	movl   $0x43f0,(%esp)
+    1b1e:	e8 60 1c 00 00       	call   3783 <mkdir>
+    1b23:	83 c4 10             	add    $0x10,%esp
+    1b26:	85 c0                	test   %eax,%eax
+    1b28:	0f 85 14 04 00 00    	jne    1f42 <subdir+0x44a>
+    printf(1, "subdir mkdir dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1b2e:	83 ec 08             	sub    $0x8,%esp
+    1b31:	68 02 02 00 00       	push   $0x202
+    1b36:	68 29 43 00 00       	push   $0x4329
+    1b3b:	e8 1b 1c 00 00       	call   375b <open>
+    1b40:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1b42:	83 c4 10             	add    $0x10,%esp
+    1b45:	85 c0                	test   %eax,%eax
+    1b47:	0f 88 09 04 00 00    	js     1f56 <subdir+0x45e>
+    printf(1, "create dd/ff failed\n");
+    exit();
+  }
+  write(fd, "ff", 2);
+    1b4d:	83 ec 04             	sub    $0x4,%esp
+    1b50:	6a 02                	push   $0x2
+    1b52:	68 53 43 00 00       	push   $0x4353
+    1b57:	50                   	push   %eax
+    1b58:	e8 de 1b 00 00       	call   373b <write>
+  close(fd);
+    1b5d:	89 1c 24             	mov    %ebx,(%esp)
+    1b60:	e8 de 1b 00 00       	call   3743 <close>
+
+  if(unlink("dd") >= 0){
+    1b65:	c7 04 24 f0 43 00 00 	movl   $0x43f0,(%esp)
+    1b6c:	e8 fa 1b 00 00       	call   376b <unlink>
+    1b71:	83 c4 10             	add    $0x10,%esp
+    1b74:	85 c0                	test   %eax,%eax
+    1b76:	0f 89 ee 03 00 00    	jns    1f6a <subdir+0x472>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    exit();
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    1b7c:	83 ec 0c             	sub    $0xc,%esp
+    1b7f:	68 04 43 00 00       	push   $0x4304
+    1b84:	e8 fa 1b 00 00       	call   3783 <mkdir>
+    1b89:	83 c4 10             	add    $0x10,%esp
+    1b8c:	85 c0                	test   %eax,%eax
+    1b8e:	0f 85 ea 03 00 00    	jne    1f7e <subdir+0x486>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1b94:	83 ec 08             	sub    $0x8,%esp
+    1b97:	68 02 02 00 00       	push   $0x202
+    1b9c:	68 26 43 00 00       	push   $0x4326
+    1ba1:	e8 b5 1b 00 00       	call   375b <open>
+    1ba6:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ba8:	83 c4 10             	add    $0x10,%esp
+    1bab:	85 c0                	test   %eax,%eax
+    1bad:	0f 88 df 03 00 00    	js     1f92 <subdir+0x49a>
+    printf(1, "create dd/dd/ff failed\n");
+    exit();
+  }
+  write(fd, "FF", 2);
+    1bb3:	83 ec 04             	sub    $0x4,%esp
+    1bb6:	6a 02                	push   $0x2
+    1bb8:	68 47 43 00 00       	push   $0x4347
+    1bbd:	50                   	push   %eax
+    1bbe:	e8 78 1b 00 00       	call   373b <write>
+  close(fd);
+    1bc3:	89 1c 24             	mov    %ebx,(%esp)
+    1bc6:	e8 78 1b 00 00       	call   3743 <close>
+
+  fd = open("dd/dd/../ff", 0);
+    1bcb:	83 c4 08             	add    $0x8,%esp
+    1bce:	6a 00                	push   $0x0
+    1bd0:	68 4a 43 00 00       	push   $0x434a
+    1bd5:	e8 81 1b 00 00       	call   375b <open>
+    1bda:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1bdc:	83 c4 10             	add    $0x10,%esp
+    1bdf:	85 c0                	test   %eax,%eax
+    1be1:	0f 88 bf 03 00 00    	js     1fa6 <subdir+0x4ae>
+    printf(1, "open dd/dd/../ff failed\n");
+    exit();
+  }
+  cc = read(fd, buf, sizeof(buf));
+    1be7:	83 ec 04             	sub    $0x4,%esp
+    1bea:	68 00 20 00 00       	push   $0x2000
+    1bef:	68 e0 7a 00 00       	push   $0x7ae0
+    1bf4:	50                   	push   %eax
+    1bf5:	e8 39 1b 00 00       	call   3733 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1bfa:	83 c4 10             	add    $0x10,%esp
+    1bfd:	83 f8 02             	cmp    $0x2,%eax
+    1c00:	0f 85 b4 03 00 00    	jne    1fba <subdir+0x4c2>
+    1c06:	80 3d e0 7a 00 00 66 	cmpb   $0x66,0x7ae0
+    1c0d:	0f 85 a7 03 00 00    	jne    1fba <subdir+0x4c2>
+    printf(1, "dd/dd/../ff wrong content\n");
+    exit();
+  }
+  close(fd);
+    1c13:	83 ec 0c             	sub    $0xc,%esp
+    1c16:	53                   	push   %ebx
+    1c17:	e8 27 1b 00 00       	call   3743 <close>
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1c1c:	83 c4 08             	add    $0x8,%esp
+    1c1f:	68 8a 43 00 00       	push   $0x438a
+    1c24:	68 26 43 00 00       	push   $0x4326
+    1c29:	e8 4d 1b 00 00       	call   377b <link>
+    1c2e:	83 c4 10             	add    $0x10,%esp
+    1c31:	85 c0                	test   %eax,%eax
+    1c33:	0f 85 95 03 00 00    	jne    1fce <subdir+0x4d6>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    1c39:	83 ec 0c             	sub    $0xc,%esp
+    1c3c:	68 26 43 00 00       	push   $0x4326
+    1c41:	e8 25 1b 00 00       	call   376b <unlink>
+    1c46:	83 c4 10             	add    $0x10,%esp
+    1c49:	85 c0                	test   %eax,%eax
+    1c4b:	0f 85 91 03 00 00    	jne    1fe2 <subdir+0x4ea>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1c51:	83 ec 08             	sub    $0x8,%esp
+    1c54:	6a 00                	push   $0x0
+    1c56:	68 26 43 00 00       	push   $0x4326
+    1c5b:	e8 fb 1a 00 00       	call   375b <open>
+    1c60:	83 c4 10             	add    $0x10,%esp
+    1c63:	85 c0                	test   %eax,%eax
+    1c65:	0f 89 8b 03 00 00    	jns    1ff6 <subdir+0x4fe>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    exit();
+  }
+
+  if(chdir("dd") != 0){
+    1c6b:	83 ec 0c             	sub    $0xc,%esp
+    1c6e:	68 f0 43 00 00       	push   $0x43f0
+    1c73:	e8 13 1b 00 00       	call   378b <chdir>
+    1c78:	83 c4 10             	add    $0x10,%esp
+    1c7b:	85 c0                	test   %eax,%eax
+    1c7d:	0f 85 87 03 00 00    	jne    200a <subdir+0x512>
+    printf(1, "chdir dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../dd") != 0){
+    1c83:	83 ec 0c             	sub    $0xc,%esp
+    1c86:	68 be 43 00 00       	push   $0x43be
+    1c8b:	e8 fb 1a 00 00       	call   378b <chdir>
+    1c90:	83 c4 10             	add    $0x10,%esp
+    1c93:	85 c0                	test   %eax,%eax
+    1c95:	0f 85 83 03 00 00    	jne    201e <subdir+0x526>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../../dd") != 0){
+    1c9b:	83 ec 0c             	sub    $0xc,%esp
+    1c9e:	68 e4 43 00 00       	push   $0x43e4
+    1ca3:	e8 e3 1a 00 00       	call   378b <chdir>
+    1ca8:	83 c4 10             	add    $0x10,%esp
+    1cab:	85 c0                	test   %eax,%eax
+    1cad:	0f 85 7f 03 00 00    	jne    2032 <subdir+0x53a>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("./..") != 0){
+    1cb3:	83 ec 0c             	sub    $0xc,%esp
+    1cb6:	68 f3 43 00 00       	push   $0x43f3
+    1cbb:	e8 cb 1a 00 00       	call   378b <chdir>
+    1cc0:	83 c4 10             	add    $0x10,%esp
+    1cc3:	85 c0                	test   %eax,%eax
+    1cc5:	0f 85 7b 03 00 00    	jne    2046 <subdir+0x54e>
+    printf(1, "chdir ./.. failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    1ccb:	83 ec 08             	sub    $0x8,%esp
+    1cce:	6a 00                	push   $0x0
+    1cd0:	68 8a 43 00 00       	push   $0x438a
+    1cd5:	e8 81 1a 00 00       	call   375b <open>
+    1cda:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1cdc:	83 c4 10             	add    $0x10,%esp
+    1cdf:	85 c0                	test   %eax,%eax
+    1ce1:	0f 88 73 03 00 00    	js     205a <subdir+0x562>
+    printf(1, "open dd/dd/ffff failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1ce7:	83 ec 04             	sub    $0x4,%esp
+    1cea:	68 00 20 00 00       	push   $0x2000
+    1cef:	68 e0 7a 00 00       	push   $0x7ae0
+    1cf4:	50                   	push   %eax
+    1cf5:	e8 39 1a 00 00       	call   3733 <read>
+    1cfa:	83 c4 10             	add    $0x10,%esp
+    1cfd:	83 f8 02             	cmp    $0x2,%eax
+    1d00:	0f 85 68 03 00 00    	jne    206e <subdir+0x576>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    exit();
+  }
+  close(fd);
+    1d06:	83 ec 0c             	sub    $0xc,%esp
+    1d09:	53                   	push   %ebx
+    1d0a:	e8 34 1a 00 00       	call   3743 <close>
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1d0f:	83 c4 08             	add    $0x8,%esp
+    1d12:	6a 00                	push   $0x0
+    1d14:	68 26 43 00 00       	push   $0x4326
+    1d19:	e8 3d 1a 00 00       	call   375b <open>
+    1d1e:	83 c4 10             	add    $0x10,%esp
+    1d21:	85 c0                	test   %eax,%eax
+    1d23:	0f 89 59 03 00 00    	jns    2082 <subdir+0x58a>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    exit();
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1d29:	83 ec 08             	sub    $0x8,%esp
+    1d2c:	68 02 02 00 00       	push   $0x202
+    1d31:	68 3e 44 00 00       	push   $0x443e
+    1d36:	e8 20 1a 00 00       	call   375b <open>
+    1d3b:	83 c4 10             	add    $0x10,%esp
+    1d3e:	85 c0                	test   %eax,%eax
+    1d40:	0f 89 50 03 00 00    	jns    2096 <subdir+0x59e>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1d46:	83 ec 08             	sub    $0x8,%esp
+    1d49:	68 02 02 00 00       	push   $0x202
+    1d4e:	68 63 44 00 00       	push   $0x4463
+    1d53:	e8 03 1a 00 00       	call   375b <open>
+    1d58:	83 c4 10             	add    $0x10,%esp
+    1d5b:	85 c0                	test   %eax,%eax
+    1d5d:	0f 89 47 03 00 00    	jns    20aa <subdir+0x5b2>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_CREATE) >= 0){
+    1d63:	83 ec 08             	sub    $0x8,%esp
+    1d66:	68 00 02 00 00       	push   $0x200
+    1d6b:	68 f0 43 00 00       	push   $0x43f0
+    1d70:	e8 e6 19 00 00       	call   375b <open>
+    1d75:	83 c4 10             	add    $0x10,%esp
+    1d78:	85 c0                	test   %eax,%eax
+    1d7a:	0f 89 3e 03 00 00    	jns    20be <subdir+0x5c6>
+    printf(1, "create dd succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_RDWR) >= 0){
+    1d80:	83 ec 08             	sub    $0x8,%esp
+    1d83:	6a 02                	push   $0x2
+    1d85:	68 f0 43 00 00       	push   $0x43f0
+    1d8a:	e8 cc 19 00 00       	call   375b <open>
+    1d8f:	83 c4 10             	add    $0x10,%esp
+    1d92:	85 c0                	test   %eax,%eax
+    1d94:	0f 89 38 03 00 00    	jns    20d2 <subdir+0x5da>
+    printf(1, "open dd rdwr succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    1d9a:	83 ec 08             	sub    $0x8,%esp
+    1d9d:	6a 01                	push   $0x1
+    1d9f:	68 f0 43 00 00       	push   $0x43f0
+    1da4:	e8 b2 19 00 00       	call   375b <open>
+    1da9:	83 c4 10             	add    $0x10,%esp
+    1dac:	85 c0                	test   %eax,%eax
+    1dae:	0f 89 32 03 00 00    	jns    20e6 <subdir+0x5ee>
+    printf(1, "open dd wronly succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1db4:	83 ec 08             	sub    $0x8,%esp
+    1db7:	68 d2 44 00 00       	push   $0x44d2
+    1dbc:	68 3e 44 00 00       	push   $0x443e
+    1dc1:	e8 b5 19 00 00       	call   377b <link>
+    1dc6:	83 c4 10             	add    $0x10,%esp
+    1dc9:	85 c0                	test   %eax,%eax
+    1dcb:	0f 84 29 03 00 00    	je     20fa <subdir+0x602>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1dd1:	83 ec 08             	sub    $0x8,%esp
+    1dd4:	68 d2 44 00 00       	push   $0x44d2
+    1dd9:	68 63 44 00 00       	push   $0x4463
+    1dde:	e8 98 19 00 00       	call   377b <link>
+    1de3:	83 c4 10             	add    $0x10,%esp
+    1de6:	85 c0                	test   %eax,%eax
+    1de8:	0f 84 20 03 00 00    	je     210e <subdir+0x616>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1dee:	83 ec 08             	sub    $0x8,%esp
+    1df1:	68 8a 43 00 00       	push   $0x438a
+    1df6:	68 29 43 00 00       	push   $0x4329
+    1dfb:	e8 7b 19 00 00       	call   377b <link>
+    1e00:	83 c4 10             	add    $0x10,%esp
+    1e03:	85 c0                	test   %eax,%eax
+    1e05:	0f 84 17 03 00 00    	je     2122 <subdir+0x62a>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    1e0b:	83 ec 0c             	sub    $0xc,%esp
+    1e0e:	68 3e 44 00 00       	push   $0x443e
+    1e13:	e8 6b 19 00 00       	call   3783 <mkdir>
+    1e18:	83 c4 10             	add    $0x10,%esp
+    1e1b:	85 c0                	test   %eax,%eax
+    1e1d:	0f 84 13 03 00 00    	je     2136 <subdir+0x63e>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    1e23:	83 ec 0c             	sub    $0xc,%esp
+    1e26:	68 63 44 00 00       	push   $0x4463
+    1e2b:	e8 53 19 00 00       	call   3783 <mkdir>
+    1e30:	83 c4 10             	add    $0x10,%esp
+    1e33:	85 c0                	test   %eax,%eax
+    1e35:	0f 84 0f 03 00 00    	je     214a <subdir+0x652>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    1e3b:	83 ec 0c             	sub    $0xc,%esp
+    1e3e:	68 8a 43 00 00       	push   $0x438a
+    1e43:	e8 3b 19 00 00       	call   3783 <mkdir>
+    1e48:	83 c4 10             	add    $0x10,%esp
+    1e4b:	85 c0                	test   %eax,%eax
+    1e4d:	0f 84 0b 03 00 00    	je     215e <subdir+0x666>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/xx/ff") == 0){
+    1e53:	83 ec 0c             	sub    $0xc,%esp
+    1e56:	68 63 44 00 00       	push   $0x4463
+    1e5b:	e8 0b 19 00 00       	call   376b <unlink>
+    1e60:	83 c4 10             	add    $0x10,%esp
+    1e63:	85 c0                	test   %eax,%eax
+    1e65:	0f 84 07 03 00 00    	je     2172 <subdir+0x67a>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/ff/ff") == 0){
+    1e6b:	83 ec 0c             	sub    $0xc,%esp
+    1e6e:	68 3e 44 00 00       	push   $0x443e
+    1e73:	e8 f3 18 00 00       	call   376b <unlink>
+    1e78:	83 c4 10             	add    $0x10,%esp
+    1e7b:	85 c0                	test   %eax,%eax
+    1e7d:	0f 84 03 03 00 00    	je     2186 <subdir+0x68e>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/ff") == 0){
+    1e83:	83 ec 0c             	sub    $0xc,%esp
+    1e86:	68 29 43 00 00       	push   $0x4329
+    1e8b:	e8 fb 18 00 00       	call   378b <chdir>
+    1e90:	83 c4 10             	add    $0x10,%esp
+    1e93:	85 c0                	test   %eax,%eax
+    1e95:	0f 84 ff 02 00 00    	je     219a <subdir+0x6a2>
+    printf(1, "chdir dd/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/xx") == 0){
+    1e9b:	83 ec 0c             	sub    $0xc,%esp
+    1e9e:	68 d5 44 00 00       	push   $0x44d5
+    1ea3:	e8 e3 18 00 00       	call   378b <chdir>
+    1ea8:	83 c4 10             	add    $0x10,%esp
+    1eab:	85 c0                	test   %eax,%eax
+    1ead:	0f 84 fb 02 00 00    	je     21ae <subdir+0x6b6>
+    printf(1, "chdir dd/xx succeeded!\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    1eb3:	83 ec 0c             	sub    $0xc,%esp
+    1eb6:	68 8a 43 00 00       	push   $0x438a
+    1ebb:	e8 ab 18 00 00       	call   376b <unlink>
+    1ec0:	83 c4 10             	add    $0x10,%esp
+    1ec3:	85 c0                	test   %eax,%eax
+    1ec5:	0f 85 f7 02 00 00    	jne    21c2 <subdir+0x6ca>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd/ff") != 0){
+    1ecb:	83 ec 0c             	sub    $0xc,%esp
+    1ece:	68 29 43 00 00       	push   $0x4329
+    1ed3:	e8 93 18 00 00       	call   376b <unlink>
+    1ed8:	83 c4 10             	add    $0x10,%esp
+    1edb:	85 c0                	test   %eax,%eax
+    1edd:	0f 85 f3 02 00 00    	jne    21d6 <subdir+0x6de>
+    printf(1, "unlink dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd") == 0){
+    1ee3:	83 ec 0c             	sub    $0xc,%esp
+    1ee6:	68 f0 43 00 00       	push   $0x43f0
+    1eeb:	e8 7b 18 00 00       	call   376b <unlink>
+    1ef0:	83 c4 10             	add    $0x10,%esp
+    1ef3:	85 c0                	test   %eax,%eax
+    1ef5:	0f 84 ef 02 00 00    	je     21ea <subdir+0x6f2>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/dd") < 0){
+    1efb:	83 ec 0c             	sub    $0xc,%esp
+    1efe:	68 05 43 00 00       	push   $0x4305
+    1f03:	e8 63 18 00 00       	call   376b <unlink>
+    1f08:	83 c4 10             	add    $0x10,%esp
+    1f0b:	85 c0                	test   %eax,%eax
+    1f0d:	0f 88 eb 02 00 00    	js     21fe <subdir+0x706>
+    printf(1, "unlink dd/dd failed\n");
+    exit();
+  }
+  if(unlink("dd") < 0){
+    1f13:	83 ec 0c             	sub    $0xc,%esp
+    1f16:	68 f0 43 00 00       	push   $0x43f0
+    1f1b:	e8 4b 18 00 00       	call   376b <unlink>
+    1f20:	83 c4 10             	add    $0x10,%esp
+    1f23:	85 c0                	test   %eax,%eax
+    1f25:	0f 88 e7 02 00 00    	js     2212 <subdir+0x71a>
+    printf(1, "unlink dd failed\n");
+    exit();
+  }
+
+  printf(1, "subdir ok\n");
+    1f2b:	83 ec 08             	sub    $0x8,%esp
+    1f2e:	68 d2 45 00 00       	push   $0x45d2
+    1f33:	6a 01                	push   $0x1
+    1f35:	e8 96 19 00 00       	call   38d0 <printf>
+}
+    1f3a:	83 c4 10             	add    $0x10,%esp
+    1f3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f40:	c9                   	leave
+    1f41:	c3                   	ret
+    printf(1, "subdir mkdir dd failed\n");
+    1f42:	83 ec 08             	sub    $0x8,%esp
+    1f45:	68 d7 42 00 00       	push   $0x42d7
+    1f4a:	6a 01                	push   $0x1
+    1f4c:	e8 7f 19 00 00       	call   38d0 <printf>
+    exit();
+    1f51:	e8 c5 17 00 00       	call   371b <exit>
+    printf(1, "create dd/ff failed\n");
+    1f56:	83 ec 08             	sub    $0x8,%esp
+    1f59:	68 ef 42 00 00       	push   $0x42ef
+    1f5e:	6a 01                	push   $0x1
+    1f60:	e8 6b 19 00 00       	call   38d0 <printf>
+    exit();
+    1f65:	e8 b1 17 00 00       	call   371b <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    1f6a:	83 ec 08             	sub    $0x8,%esp
+    1f6d:	68 bc 4d 00 00       	push   $0x4dbc
+    1f72:	6a 01                	push   $0x1
+    1f74:	e8 57 19 00 00       	call   38d0 <printf>
+    exit();
+    1f79:	e8 9d 17 00 00       	call   371b <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    1f7e:	83 ec 08             	sub    $0x8,%esp
+    1f81:	68 0b 43 00 00       	push   $0x430b
+    1f86:	6a 01                	push   $0x1
+    1f88:	e8 43 19 00 00       	call   38d0 <printf>
+    exit();
+    1f8d:	e8 89 17 00 00       	call   371b <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    1f92:	83 ec 08             	sub    $0x8,%esp
+    1f95:	68 2f 43 00 00       	push   $0x432f
+    1f9a:	6a 01                	push   $0x1
+    1f9c:	e8 2f 19 00 00       	call   38d0 <printf>
+    exit();
+    1fa1:	e8 75 17 00 00       	call   371b <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    1fa6:	83 ec 08             	sub    $0x8,%esp
+    1fa9:	68 56 43 00 00       	push   $0x4356
+    1fae:	6a 01                	push   $0x1
+    1fb0:	e8 1b 19 00 00       	call   38d0 <printf>
+    exit();
+    1fb5:	e8 61 17 00 00       	call   371b <exit>
+    printf(1, "dd/dd/../ff wrong content\n");
+    1fba:	83 ec 08             	sub    $0x8,%esp
+    1fbd:	68 6f 43 00 00       	push   $0x436f
+    1fc2:	6a 01                	push   $0x1
+    1fc4:	e8 07 19 00 00       	call   38d0 <printf>
+    exit();
+    1fc9:	e8 4d 17 00 00       	call   371b <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    1fce:	83 ec 08             	sub    $0x8,%esp
+    1fd1:	68 e4 4d 00 00       	push   $0x4de4
+    1fd6:	6a 01                	push   $0x1
+    1fd8:	e8 f3 18 00 00       	call   38d0 <printf>
+    exit();
+    1fdd:	e8 39 17 00 00       	call   371b <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    1fe2:	83 ec 08             	sub    $0x8,%esp
+    1fe5:	68 95 43 00 00       	push   $0x4395
+    1fea:	6a 01                	push   $0x1
+    1fec:	e8 df 18 00 00       	call   38d0 <printf>
+    exit();
+    1ff1:	e8 25 17 00 00       	call   371b <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    1ff6:	83 ec 08             	sub    $0x8,%esp
+    1ff9:	68 08 4e 00 00       	push   $0x4e08
+    1ffe:	6a 01                	push   $0x1
+    2000:	e8 cb 18 00 00       	call   38d0 <printf>
+    exit();
+    2005:	e8 11 17 00 00       	call   371b <exit>
+    printf(1, "chdir dd failed\n");
+    200a:	83 ec 08             	sub    $0x8,%esp
+    200d:	68 ad 43 00 00       	push   $0x43ad
+    2012:	6a 01                	push   $0x1
+    2014:	e8 b7 18 00 00       	call   38d0 <printf>
+    exit();
+    2019:	e8 fd 16 00 00       	call   371b <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    201e:	83 ec 08             	sub    $0x8,%esp
+    2021:	68 ca 43 00 00       	push   $0x43ca
+    2026:	6a 01                	push   $0x1
+    2028:	e8 a3 18 00 00       	call   38d0 <printf>
+    exit();
+    202d:	e8 e9 16 00 00       	call   371b <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2032:	83 ec 08             	sub    $0x8,%esp
+    2035:	68 ca 43 00 00       	push   $0x43ca
+    203a:	6a 01                	push   $0x1
+    203c:	e8 8f 18 00 00       	call   38d0 <printf>
+    exit();
+    2041:	e8 d5 16 00 00       	call   371b <exit>
+    printf(1, "chdir ./.. failed\n");
+    2046:	83 ec 08             	sub    $0x8,%esp
+    2049:	68 f8 43 00 00       	push   $0x43f8
+    204e:	6a 01                	push   $0x1
+    2050:	e8 7b 18 00 00       	call   38d0 <printf>
+    exit();
+    2055:	e8 c1 16 00 00       	call   371b <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    205a:	83 ec 08             	sub    $0x8,%esp
+    205d:	68 0b 44 00 00       	push   $0x440b
+    2062:	6a 01                	push   $0x1
+    2064:	e8 67 18 00 00       	call   38d0 <printf>
+    exit();
+    2069:	e8 ad 16 00 00       	call   371b <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    206e:	83 ec 08             	sub    $0x8,%esp
+    2071:	68 23 44 00 00       	push   $0x4423
+    2076:	6a 01                	push   $0x1
+    2078:	e8 53 18 00 00       	call   38d0 <printf>
+    exit();
+    207d:	e8 99 16 00 00       	call   371b <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2082:	83 ec 08             	sub    $0x8,%esp
+    2085:	68 2c 4e 00 00       	push   $0x4e2c
+    208a:	6a 01                	push   $0x1
+    208c:	e8 3f 18 00 00       	call   38d0 <printf>
+    exit();
+    2091:	e8 85 16 00 00       	call   371b <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2096:	83 ec 08             	sub    $0x8,%esp
+    2099:	68 47 44 00 00       	push   $0x4447
+    209e:	6a 01                	push   $0x1
+    20a0:	e8 2b 18 00 00       	call   38d0 <printf>
+    exit();
+    20a5:	e8 71 16 00 00       	call   371b <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    20aa:	83 ec 08             	sub    $0x8,%esp
+    20ad:	68 6c 44 00 00       	push   $0x446c
+    20b2:	6a 01                	push   $0x1
+    20b4:	e8 17 18 00 00       	call   38d0 <printf>
+    exit();
+    20b9:	e8 5d 16 00 00       	call   371b <exit>
+    printf(1, "create dd succeeded!\n");
+    20be:	83 ec 08             	sub    $0x8,%esp
+    20c1:	68 88 44 00 00       	push   $0x4488
+    20c6:	6a 01                	push   $0x1
+    20c8:	e8 03 18 00 00       	call   38d0 <printf>
+    exit();
+    20cd:	e8 49 16 00 00       	call   371b <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    20d2:	83 ec 08             	sub    $0x8,%esp
+    20d5:	68 9e 44 00 00       	push   $0x449e
+    20da:	6a 01                	push   $0x1
+    20dc:	e8 ef 17 00 00       	call   38d0 <printf>
+    exit();
+    20e1:	e8 35 16 00 00       	call   371b <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    20e6:	83 ec 08             	sub    $0x8,%esp
+    20e9:	68 b7 44 00 00       	push   $0x44b7
+    20ee:	6a 01                	push   $0x1
+    20f0:	e8 db 17 00 00       	call   38d0 <printf>
+    exit();
+    20f5:	e8 21 16 00 00       	call   371b <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    20fa:	83 ec 08             	sub    $0x8,%esp
+    20fd:	68 54 4e 00 00       	push   $0x4e54
+    2102:	6a 01                	push   $0x1
+    2104:	e8 c7 17 00 00       	call   38d0 <printf>
+    exit();
+    2109:	e8 0d 16 00 00       	call   371b <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    210e:	83 ec 08             	sub    $0x8,%esp
+    2111:	68 78 4e 00 00       	push   $0x4e78
+    2116:	6a 01                	push   $0x1
+    2118:	e8 b3 17 00 00       	call   38d0 <printf>
+    exit();
+    211d:	e8 f9 15 00 00       	call   371b <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2122:	83 ec 08             	sub    $0x8,%esp
+    2125:	68 9c 4e 00 00       	push   $0x4e9c
+    212a:	6a 01                	push   $0x1
+    212c:	e8 9f 17 00 00       	call   38d0 <printf>
+    exit();
+    2131:	e8 e5 15 00 00       	call   371b <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2136:	83 ec 08             	sub    $0x8,%esp
+    2139:	68 db 44 00 00       	push   $0x44db
+    213e:	6a 01                	push   $0x1
+    2140:	e8 8b 17 00 00       	call   38d0 <printf>
+    exit();
+    2145:	e8 d1 15 00 00       	call   371b <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    214a:	83 ec 08             	sub    $0x8,%esp
+    214d:	68 f6 44 00 00       	push   $0x44f6
+    2152:	6a 01                	push   $0x1
+    2154:	e8 77 17 00 00       	call   38d0 <printf>
+    exit();
+    2159:	e8 bd 15 00 00       	call   371b <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    215e:	83 ec 08             	sub    $0x8,%esp
+    2161:	68 11 45 00 00       	push   $0x4511
+    2166:	6a 01                	push   $0x1
+    2168:	e8 63 17 00 00       	call   38d0 <printf>
+    exit();
+    216d:	e8 a9 15 00 00       	call   371b <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2172:	83 ec 08             	sub    $0x8,%esp
+    2175:	68 2e 45 00 00       	push   $0x452e
+    217a:	6a 01                	push   $0x1
+    217c:	e8 4f 17 00 00       	call   38d0 <printf>
+    exit();
+    2181:	e8 95 15 00 00       	call   371b <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2186:	83 ec 08             	sub    $0x8,%esp
+    2189:	68 4a 45 00 00       	push   $0x454a
+    218e:	6a 01                	push   $0x1
+    2190:	e8 3b 17 00 00       	call   38d0 <printf>
+    exit();
+    2195:	e8 81 15 00 00       	call   371b <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    219a:	83 ec 08             	sub    $0x8,%esp
+    219d:	68 66 45 00 00       	push   $0x4566
+    21a2:	6a 01                	push   $0x1
+    21a4:	e8 27 17 00 00       	call   38d0 <printf>
+    exit();
+    21a9:	e8 6d 15 00 00       	call   371b <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    21ae:	83 ec 08             	sub    $0x8,%esp
+    21b1:	68 7e 45 00 00       	push   $0x457e
+    21b6:	6a 01                	push   $0x1
+    21b8:	e8 13 17 00 00       	call   38d0 <printf>
+    exit();
+    21bd:	e8 59 15 00 00       	call   371b <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    21c2:	83 ec 08             	sub    $0x8,%esp
+    21c5:	68 95 43 00 00       	push   $0x4395
+    21ca:	6a 01                	push   $0x1
+    21cc:	e8 ff 16 00 00       	call   38d0 <printf>
+    exit();
+    21d1:	e8 45 15 00 00       	call   371b <exit>
+    printf(1, "unlink dd/ff failed\n");
+    21d6:	83 ec 08             	sub    $0x8,%esp
+    21d9:	68 96 45 00 00       	push   $0x4596
+    21de:	6a 01                	push   $0x1
+    21e0:	e8 eb 16 00 00       	call   38d0 <printf>
+    exit();
+    21e5:	e8 31 15 00 00       	call   371b <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    21ea:	83 ec 08             	sub    $0x8,%esp
+    21ed:	68 c0 4e 00 00       	push   $0x4ec0
+    21f2:	6a 01                	push   $0x1
+    21f4:	e8 d7 16 00 00       	call   38d0 <printf>
+    exit();
+    21f9:	e8 1d 15 00 00       	call   371b <exit>
+    printf(1, "unlink dd/dd failed\n");
+    21fe:	83 ec 08             	sub    $0x8,%esp
+    2201:	68 ab 45 00 00       	push   $0x45ab
+    2206:	6a 01                	push   $0x1
+    2208:	e8 c3 16 00 00       	call   38d0 <printf>
+    exit();
+    220d:	e8 09 15 00 00       	call   371b <exit>
+    printf(1, "unlink dd failed\n");
+    2212:	83 ec 08             	sub    $0x8,%esp
+    2215:	68 c0 45 00 00       	push   $0x45c0
+    221a:	6a 01                	push   $0x1
+    221c:	e8 af 16 00 00       	call   38d0 <printf>
+    exit();
+    2221:	e8 f5 14 00 00       	call   371b <exit>
+
+00002226 <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    2226:	55                   	push   %ebp
+    2227:	89 e5                	mov    %esp,%ebp
+    2229:	57                   	push   %edi
+    222a:	56                   	push   %esi
+    222b:	53                   	push   %ebx
+    222c:	83 ec 14             	sub    $0x14,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    222f:	68 dd 45 00 00       	push   $0x45dd
+    2234:	6a 01                	push   $0x1
+    2236:	e8 95 16 00 00       	call   38d0 <printf>
+
+  unlink("bigwrite");
+    223b:	c7 04 24 ec 45 00 00 	movl   $0x45ec,(%esp)
+    2242:	e8 24 15 00 00       	call   376b <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2247:	83 c4 10             	add    $0x10,%esp
+    224a:	be f3 01 00 00       	mov    $0x1f3,%esi
+    224f:	eb 45                	jmp    2296 <bigwrite+0x70>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    if(fd < 0){
+      printf(1, "cannot create bigwrite\n");
+    2251:	83 ec 08             	sub    $0x8,%esp
+    2254:	68 f5 45 00 00       	push   $0x45f5
+    2259:	6a 01                	push   $0x1
+    225b:	e8 70 16 00 00       	call   38d0 <printf>
+      exit();
+    2260:	e8 b6 14 00 00       	call   371b <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+      int cc = write(fd, buf, sz);
+      if(cc != sz){
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2265:	50                   	push   %eax
+    2266:	56                   	push   %esi
+    2267:	68 0d 46 00 00       	push   $0x460d
+    226c:	6a 01                	push   $0x1
+    226e:	e8 5d 16 00 00       	call   38d0 <printf>
+        exit();
+    2273:	e8 a3 14 00 00       	call   371b <exit>
+      }
+    }
+    close(fd);
+    2278:	83 ec 0c             	sub    $0xc,%esp
+    227b:	57                   	push   %edi
+    227c:	e8 c2 14 00 00       	call   3743 <close>
+    unlink("bigwrite");
+    2281:	c7 04 24 ec 45 00 00 	movl   $0x45ec,(%esp)
+    2288:	e8 de 14 00 00       	call   376b <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    228d:	81 c6 d7 01 00 00    	add    $0x1d7,%esi
+    2293:	83 c4 10             	add    $0x10,%esp
+    2296:	81 fe ff 17 00 00    	cmp    $0x17ff,%esi
+    229c:	7f 40                	jg     22de <bigwrite+0xb8>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    229e:	83 ec 08             	sub    $0x8,%esp
+    22a1:	68 02 02 00 00       	push   $0x202
+    22a6:	68 ec 45 00 00       	push   $0x45ec
+    22ab:	e8 ab 14 00 00       	call   375b <open>
+    22b0:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    22b2:	83 c4 10             	add    $0x10,%esp
+    22b5:	85 c0                	test   %eax,%eax
+    22b7:	78 98                	js     2251 <bigwrite+0x2b>
+    for(i = 0; i < 2; i++){
+    22b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    22be:	83 fb 01             	cmp    $0x1,%ebx
+    22c1:	7f b5                	jg     2278 <bigwrite+0x52>
+      int cc = write(fd, buf, sz);
+    22c3:	83 ec 04             	sub    $0x4,%esp
+    22c6:	56                   	push   %esi
+    22c7:	68 e0 7a 00 00       	push   $0x7ae0
+    22cc:	57                   	push   %edi
+    22cd:	e8 69 14 00 00       	call   373b <write>
+      if(cc != sz){
+    22d2:	83 c4 10             	add    $0x10,%esp
+    22d5:	39 c6                	cmp    %eax,%esi
+    22d7:	75 8c                	jne    2265 <bigwrite+0x3f>
+    for(i = 0; i < 2; i++){
+    22d9:	83 c3 01             	add    $0x1,%ebx
+    22dc:	eb e0                	jmp    22be <bigwrite+0x98>
+  }
+
+  printf(1, "bigwrite ok\n");
+    22de:	83 ec 08             	sub    $0x8,%esp
+    22e1:	68 1f 46 00 00       	push   $0x461f
+    22e6:	6a 01                	push   $0x1
+    22e8:	e8 e3 15 00 00       	call   38d0 <printf>
+}
+    22ed:	83 c4 10             	add    $0x10,%esp
+    22f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22f3:	5b                   	pop    %ebx
+    22f4:	5e                   	pop    %esi
+    22f5:	5f                   	pop    %edi
+    22f6:	5d                   	pop    %ebp
+    22f7:	c3                   	ret
+
+000022f8 <bigfile>:
+
+void
+bigfile(void)
+{
+    22f8:	55                   	push   %ebp
+    22f9:	89 e5                	mov    %esp,%ebp
+    22fb:	57                   	push   %edi
+    22fc:	56                   	push   %esi
+    22fd:	53                   	push   %ebx
+    22fe:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2301:	68 2c 46 00 00       	push   $0x462c
+    2306:	6a 01                	push   $0x1
+    2308:	e8 c3 15 00 00       	call   38d0 <printf>
+
+  unlink("bigfile");
+    230d:	c7 04 24 48 46 00 00 	movl   $0x4648,(%esp)
+    2314:	e8 52 14 00 00       	call   376b <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2319:	83 c4 08             	add    $0x8,%esp
+    231c:	68 02 02 00 00       	push   $0x202
+    2321:	68 48 46 00 00       	push   $0x4648
+    2326:	e8 30 14 00 00       	call   375b <open>
+  if(fd < 0){
+    232b:	83 c4 10             	add    $0x10,%esp
+    232e:	85 c0                	test   %eax,%eax
+    2330:	78 41                	js     2373 <bigfile+0x7b>
+    2332:	89 c6                	mov    %eax,%esi
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    2334:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2339:	83 fb 13             	cmp    $0x13,%ebx
+    233c:	7f 5d                	jg     239b <bigfile+0xa3>
+    memset(buf, i, 600);
+    233e:	83 ec 04             	sub    $0x4,%esp
+    2341:	68 58 02 00 00       	push   $0x258
+    2346:	53                   	push   %ebx
+    2347:	68 e0 7a 00 00       	push   $0x7ae0
+    234c:	e8 8f 12 00 00       	call   35e0 <memset>
+    if(write(fd, buf, 600) != 600){
+    2351:	83 c4 0c             	add    $0xc,%esp
+    2354:	68 58 02 00 00       	push   $0x258
+    2359:	68 e0 7a 00 00       	push   $0x7ae0
+    235e:	56                   	push   %esi
+    235f:	e8 d7 13 00 00       	call   373b <write>
+    2364:	83 c4 10             	add    $0x10,%esp
+    2367:	3d 58 02 00 00       	cmp    $0x258,%eax
+    236c:	75 19                	jne    2387 <bigfile+0x8f>
+  for(i = 0; i < 20; i++){
+    236e:	83 c3 01             	add    $0x1,%ebx
+    2371:	eb c6                	jmp    2339 <bigfile+0x41>
+    printf(1, "cannot create bigfile");
+    2373:	83 ec 08             	sub    $0x8,%esp
+    2376:	68 3a 46 00 00       	push   $0x463a
+    237b:	6a 01                	push   $0x1
+    237d:	e8 4e 15 00 00       	call   38d0 <printf>
+    exit();
+    2382:	e8 94 13 00 00       	call   371b <exit>
+      printf(1, "write bigfile failed\n");
+    2387:	83 ec 08             	sub    $0x8,%esp
+    238a:	68 50 46 00 00       	push   $0x4650
+    238f:	6a 01                	push   $0x1
+    2391:	e8 3a 15 00 00       	call   38d0 <printf>
+      exit();
+    2396:	e8 80 13 00 00       	call   371b <exit>
+    }
+  }
+  close(fd);
+    239b:	83 ec 0c             	sub    $0xc,%esp
+    239e:	56                   	push   %esi
+    239f:	e8 9f 13 00 00       	call   3743 <close>
+
+  fd = open("bigfile", 0);
+    23a4:	83 c4 08             	add    $0x8,%esp
+    23a7:	6a 00                	push   $0x0
+    23a9:	68 48 46 00 00       	push   $0x4648
+    23ae:	e8 a8 13 00 00       	call   375b <open>
+    23b3:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    23b5:	83 c4 10             	add    $0x10,%esp
+    23b8:	85 c0                	test   %eax,%eax
+    23ba:	78 53                	js     240f <bigfile+0x117>
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+    23bc:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; ; i++){
+    23c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(fd, buf, 300);
+    23c6:	83 ec 04             	sub    $0x4,%esp
+    23c9:	68 2c 01 00 00       	push   $0x12c
+    23ce:	68 e0 7a 00 00       	push   $0x7ae0
+    23d3:	57                   	push   %edi
+    23d4:	e8 5a 13 00 00       	call   3733 <read>
+    if(cc < 0){
+    23d9:	83 c4 10             	add    $0x10,%esp
+    23dc:	85 c0                	test   %eax,%eax
+    23de:	78 43                	js     2423 <bigfile+0x12b>
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+    23e0:	74 7d                	je     245f <bigfile+0x167>
+      break;
+    if(cc != 300){
+    23e2:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    23e7:	75 4e                	jne    2437 <bigfile+0x13f>
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    23e9:	0f be 0d e0 7a 00 00 	movsbl 0x7ae0,%ecx
+    23f0:	89 da                	mov    %ebx,%edx
+    23f2:	c1 ea 1f             	shr    $0x1f,%edx
+    23f5:	01 da                	add    %ebx,%edx
+    23f7:	d1 fa                	sar    %edx
+    23f9:	39 d1                	cmp    %edx,%ecx
+    23fb:	75 4e                	jne    244b <bigfile+0x153>
+    23fd:	0f be 0d 0b 7c 00 00 	movsbl 0x7c0b,%ecx
+    2404:	39 ca                	cmp    %ecx,%edx
+    2406:	75 43                	jne    244b <bigfile+0x153>
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+    2408:	01 c6                	add    %eax,%esi
+  for(i = 0; ; i++){
+    240a:	83 c3 01             	add    $0x1,%ebx
+    cc = read(fd, buf, 300);
+    240d:	eb b7                	jmp    23c6 <bigfile+0xce>
+    printf(1, "cannot open bigfile\n");
+    240f:	83 ec 08             	sub    $0x8,%esp
+    2412:	68 66 46 00 00       	push   $0x4666
+    2417:	6a 01                	push   $0x1
+    2419:	e8 b2 14 00 00       	call   38d0 <printf>
+    exit();
+    241e:	e8 f8 12 00 00       	call   371b <exit>
+      printf(1, "read bigfile failed\n");
+    2423:	83 ec 08             	sub    $0x8,%esp
+    2426:	68 7b 46 00 00       	push   $0x467b
+    242b:	6a 01                	push   $0x1
+    242d:	e8 9e 14 00 00       	call   38d0 <printf>
+      exit();
+    2432:	e8 e4 12 00 00       	call   371b <exit>
+      printf(1, "short read bigfile\n");
+    2437:	83 ec 08             	sub    $0x8,%esp
+    243a:	68 90 46 00 00       	push   $0x4690
+    243f:	6a 01                	push   $0x1
+    2441:	e8 8a 14 00 00       	call   38d0 <printf>
+      exit();
+    2446:	e8 d0 12 00 00       	call   371b <exit>
+      printf(1, "read bigfile wrong data\n");
+    244b:	83 ec 08             	sub    $0x8,%esp
+    244e:	68 a4 46 00 00       	push   $0x46a4
+    2453:	6a 01                	push   $0x1
+    2455:	e8 76 14 00 00       	call   38d0 <printf>
+      exit();
+    245a:	e8 bc 12 00 00       	call   371b <exit>
+  }
+  close(fd);
+    245f:	83 ec 0c             	sub    $0xc,%esp
+    2462:	57                   	push   %edi
+    2463:	e8 db 12 00 00       	call   3743 <close>
+  if(total != 20*600){
+    2468:	83 c4 10             	add    $0x10,%esp
+    246b:	81 fe e0 2e 00 00    	cmp    $0x2ee0,%esi
+    2471:	75 27                	jne    249a <bigfile+0x1a2>
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+    2473:	83 ec 0c             	sub    $0xc,%esp
+    2476:	68 48 46 00 00       	push   $0x4648
+    247b:	e8 eb 12 00 00       	call   376b <unlink>
+
+  printf(1, "bigfile test ok\n");
+    2480:	83 c4 08             	add    $0x8,%esp
+    2483:	68 d7 46 00 00       	push   $0x46d7
+    2488:	6a 01                	push   $0x1
+    248a:	e8 41 14 00 00       	call   38d0 <printf>
+}
+    248f:	83 c4 10             	add    $0x10,%esp
+    2492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2495:	5b                   	pop    %ebx
+    2496:	5e                   	pop    %esi
+    2497:	5f                   	pop    %edi
+    2498:	5d                   	pop    %ebp
+    2499:	c3                   	ret
+    printf(1, "read bigfile wrong total\n");
+    249a:	83 ec 08             	sub    $0x8,%esp
+    249d:	68 bd 46 00 00       	push   $0x46bd
+    24a2:	6a 01                	push   $0x1
+    24a4:	e8 27 14 00 00       	call   38d0 <printf>
+    exit();
+    24a9:	e8 6d 12 00 00       	call   371b <exit>
+
+000024ae <fourteen>:
+
+void
+fourteen(void)
+{
+    24ae:	55                   	push   %ebp
+    24af:	89 e5                	mov    %esp,%ebp
+    24b1:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    24b4:	68 e8 46 00 00       	push   $0x46e8
+    24b9:	6a 01                	push   $0x1
+    24bb:	e8 10 14 00 00       	call   38d0 <printf>
+
+  if(mkdir("12345678901234") != 0){
+    24c0:	c7 04 24 23 47 00 00 	movl   $0x4723,(%esp)
+    24c7:	e8 b7 12 00 00       	call   3783 <mkdir>
+    24cc:	83 c4 10             	add    $0x10,%esp
+    24cf:	85 c0                	test   %eax,%eax
+    24d1:	0f 85 9c 00 00 00    	jne    2573 <fourteen+0xc5>
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    24d7:	83 ec 0c             	sub    $0xc,%esp
+    24da:	68 e0 4e 00 00       	push   $0x4ee0
+    24df:	e8 9f 12 00 00       	call   3783 <mkdir>
+    24e4:	83 c4 10             	add    $0x10,%esp
+    24e7:	85 c0                	test   %eax,%eax
+    24e9:	0f 85 98 00 00 00    	jne    2587 <fourteen+0xd9>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    24ef:	83 ec 08             	sub    $0x8,%esp
+    24f2:	68 00 02 00 00       	push   $0x200
+    24f7:	68 30 4f 00 00       	push   $0x4f30
+    24fc:	e8 5a 12 00 00       	call   375b <open>
+  if(fd < 0){
+    2501:	83 c4 10             	add    $0x10,%esp
+    2504:	85 c0                	test   %eax,%eax
+    2506:	0f 88 8f 00 00 00    	js     259b <fourteen+0xed>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+    250c:	83 ec 0c             	sub    $0xc,%esp
+    250f:	50                   	push   %eax
+    2510:	e8 2e 12 00 00       	call   3743 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2515:	83 c4 08             	add    $0x8,%esp
+    2518:	6a 00                	push   $0x0
+    251a:	68 a0 4f 00 00       	push   $0x4fa0
+    251f:	e8 37 12 00 00       	call   375b <open>
+  if(fd < 0){
+    2524:	83 c4 10             	add    $0x10,%esp
+    2527:	85 c0                	test   %eax,%eax
+    2529:	0f 88 80 00 00 00    	js     25af <fourteen+0x101>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+    252f:	83 ec 0c             	sub    $0xc,%esp
+    2532:	50                   	push   %eax
+    2533:	e8 0b 12 00 00       	call   3743 <close>
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2538:	c7 04 24 14 47 00 00 	movl   $0x4714,(%esp)
+    253f:	e8 3f 12 00 00       	call   3783 <mkdir>
+    2544:	83 c4 10             	add    $0x10,%esp
+    2547:	85 c0                	test   %eax,%eax
+    2549:	74 78                	je     25c3 <fourteen+0x115>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    254b:	83 ec 0c             	sub    $0xc,%esp
+    254e:	68 3c 50 00 00       	push   $0x503c
+    2553:	e8 2b 12 00 00       	call   3783 <mkdir>
+    2558:	83 c4 10             	add    $0x10,%esp
+    255b:	85 c0                	test   %eax,%eax
+    255d:	74 78                	je     25d7 <fourteen+0x129>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+    255f:	83 ec 08             	sub    $0x8,%esp
+    2562:	68 32 47 00 00       	push   $0x4732
+    2567:	6a 01                	push   $0x1
+    2569:	e8 62 13 00 00       	call   38d0 <printf>
+}
+    256e:	83 c4 10             	add    $0x10,%esp
+    2571:	c9                   	leave
+    2572:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2573:	83 ec 08             	sub    $0x8,%esp
+    2576:	68 f7 46 00 00       	push   $0x46f7
+    257b:	6a 01                	push   $0x1
+    257d:	e8 4e 13 00 00       	call   38d0 <printf>
+    exit();
+    2582:	e8 94 11 00 00       	call   371b <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2587:	83 ec 08             	sub    $0x8,%esp
+    258a:	68 00 4f 00 00       	push   $0x4f00
+    258f:	6a 01                	push   $0x1
+    2591:	e8 3a 13 00 00       	call   38d0 <printf>
+    exit();
+    2596:	e8 80 11 00 00       	call   371b <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    259b:	83 ec 08             	sub    $0x8,%esp
+    259e:	68 60 4f 00 00       	push   $0x4f60
+    25a3:	6a 01                	push   $0x1
+    25a5:	e8 26 13 00 00       	call   38d0 <printf>
+    exit();
+    25aa:	e8 6c 11 00 00       	call   371b <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    25af:	83 ec 08             	sub    $0x8,%esp
+    25b2:	68 d0 4f 00 00       	push   $0x4fd0
+    25b7:	6a 01                	push   $0x1
+    25b9:	e8 12 13 00 00       	call   38d0 <printf>
+    exit();
+    25be:	e8 58 11 00 00       	call   371b <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    25c3:	83 ec 08             	sub    $0x8,%esp
+    25c6:	68 0c 50 00 00       	push   $0x500c
+    25cb:	6a 01                	push   $0x1
+    25cd:	e8 fe 12 00 00       	call   38d0 <printf>
+    exit();
+    25d2:	e8 44 11 00 00       	call   371b <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    25d7:	83 ec 08             	sub    $0x8,%esp
+    25da:	68 5c 50 00 00       	push   $0x505c
+    25df:	6a 01                	push   $0x1
+    25e1:	e8 ea 12 00 00       	call   38d0 <printf>
+    exit();
+    25e6:	e8 30 11 00 00       	call   371b <exit>
+
+000025eb <rmdot>:
+
+void
+rmdot(void)
+{
+    25eb:	55                   	push   %ebp
+    25ec:	89 e5                	mov    %esp,%ebp
+    25ee:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    25f1:	68 3f 47 00 00       	push   $0x473f
+    25f6:	6a 01                	push   $0x1
+    25f8:	e8 d3 12 00 00       	call   38d0 <printf>
+  if(mkdir("dots") != 0){
+    25fd:	c7 04 24 4b 47 00 00 	movl   $0x474b,(%esp)
+    2604:	e8 7a 11 00 00       	call   3783 <mkdir>
+    2609:	83 c4 10             	add    $0x10,%esp
+    260c:	85 c0                	test   %eax,%eax
+    260e:	0f 85 bc 00 00 00    	jne    26d0 <rmdot+0xe5>
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    2614:	83 ec 0c             	sub    $0xc,%esp
+    2617:	68 4b 47 00 00       	push   $0x474b
+    261c:	e8 6a 11 00 00       	call   378b <chdir>
+    2621:	83 c4 10             	add    $0x10,%esp
+    2624:	85 c0                	test   %eax,%eax
+    2626:	0f 85 b8 00 00 00    	jne    26e4 <rmdot+0xf9>
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    262c:	83 ec 0c             	sub    $0xc,%esp
+    262f:	68 f6 43 00 00       	push   $0x43f6
+    2634:	e8 32 11 00 00       	call   376b <unlink>
+    2639:	83 c4 10             	add    $0x10,%esp
+    263c:	85 c0                	test   %eax,%eax
+    263e:	0f 84 b4 00 00 00    	je     26f8 <rmdot+0x10d>
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    2644:	83 ec 0c             	sub    $0xc,%esp
+    2647:	68 f5 43 00 00       	push   $0x43f5
+    264c:	e8 1a 11 00 00       	call   376b <unlink>
+    2651:	83 c4 10             	add    $0x10,%esp
+    2654:	85 c0                	test   %eax,%eax
+    2656:	0f 84 b0 00 00 00    	je     270c <rmdot+0x121>
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    265c:	83 ec 0c             	sub    $0xc,%esp
+    265f:	68 c9 3b 00 00       	push   $0x3bc9
+    2664:	e8 22 11 00 00       	call   378b <chdir>
+    2669:	83 c4 10             	add    $0x10,%esp
+    266c:	85 c0                	test   %eax,%eax
+    266e:	0f 85 ac 00 00 00    	jne    2720 <rmdot+0x135>
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    2674:	83 ec 0c             	sub    $0xc,%esp
+    2677:	68 93 47 00 00       	push   $0x4793
+    267c:	e8 ea 10 00 00       	call   376b <unlink>
+    2681:	83 c4 10             	add    $0x10,%esp
+    2684:	85 c0                	test   %eax,%eax
+    2686:	0f 84 a8 00 00 00    	je     2734 <rmdot+0x149>
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    268c:	83 ec 0c             	sub    $0xc,%esp
+    268f:	68 b1 47 00 00       	push   $0x47b1
+    2694:	e8 d2 10 00 00       	call   376b <unlink>
+    2699:	83 c4 10             	add    $0x10,%esp
+    269c:	85 c0                	test   %eax,%eax
+    269e:	0f 84 a4 00 00 00    	je     2748 <rmdot+0x15d>
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    26a4:	83 ec 0c             	sub    $0xc,%esp
+    26a7:	68 4b 47 00 00       	push   $0x474b
+    26ac:	e8 ba 10 00 00       	call   376b <unlink>
+    26b1:	83 c4 10             	add    $0x10,%esp
+    26b4:	85 c0                	test   %eax,%eax
+    26b6:	0f 85 a0 00 00 00    	jne    275c <rmdot+0x171>
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+    26bc:	83 ec 08             	sub    $0x8,%esp
+    26bf:	68 e6 47 00 00       	push   $0x47e6
+    26c4:	6a 01                	push   $0x1
+    26c6:	e8 05 12 00 00       	call   38d0 <printf>
+}
+    26cb:	83 c4 10             	add    $0x10,%esp
+    26ce:	c9                   	leave
+    26cf:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    26d0:	83 ec 08             	sub    $0x8,%esp
+    26d3:	68 50 47 00 00       	push   $0x4750
+    26d8:	6a 01                	push   $0x1
+    26da:	e8 f1 11 00 00       	call   38d0 <printf>
+    exit();
+    26df:	e8 37 10 00 00       	call   371b <exit>
+    printf(1, "chdir dots failed\n");
+    26e4:	83 ec 08             	sub    $0x8,%esp
+    26e7:	68 63 47 00 00       	push   $0x4763
+    26ec:	6a 01                	push   $0x1
+    26ee:	e8 dd 11 00 00       	call   38d0 <printf>
+    exit();
+    26f3:	e8 23 10 00 00       	call   371b <exit>
+    printf(1, "rm . worked!\n");
+    26f8:	83 ec 08             	sub    $0x8,%esp
+    26fb:	68 76 47 00 00       	push   $0x4776
+    2700:	6a 01                	push   $0x1
+    2702:	e8 c9 11 00 00       	call   38d0 <printf>
+    exit();
+    2707:	e8 0f 10 00 00       	call   371b <exit>
+    printf(1, "rm .. worked!\n");
+    270c:	83 ec 08             	sub    $0x8,%esp
+    270f:	68 84 47 00 00       	push   $0x4784
+    2714:	6a 01                	push   $0x1
+    2716:	e8 b5 11 00 00       	call   38d0 <printf>
+    exit();
+    271b:	e8 fb 0f 00 00       	call   371b <exit>
+    printf(1, "chdir / failed\n");
+    2720:	83 ec 08             	sub    $0x8,%esp
+    2723:	68 cb 3b 00 00       	push   $0x3bcb
+    2728:	6a 01                	push   $0x1
+    272a:	e8 a1 11 00 00       	call   38d0 <printf>
+    exit();
+    272f:	e8 e7 0f 00 00       	call   371b <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2734:	83 ec 08             	sub    $0x8,%esp
+    2737:	68 9a 47 00 00       	push   $0x479a
+    273c:	6a 01                	push   $0x1
+    273e:	e8 8d 11 00 00       	call   38d0 <printf>
+    exit();
+    2743:	e8 d3 0f 00 00       	call   371b <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2748:	83 ec 08             	sub    $0x8,%esp
+    274b:	68 b9 47 00 00       	push   $0x47b9
+    2750:	6a 01                	push   $0x1
+    2752:	e8 79 11 00 00       	call   38d0 <printf>
+    exit();
+    2757:	e8 bf 0f 00 00       	call   371b <exit>
+    printf(1, "unlink dots failed!\n");
+    275c:	83 ec 08             	sub    $0x8,%esp
+    275f:	68 d1 47 00 00       	push   $0x47d1
+    2764:	6a 01                	push   $0x1
+    2766:	e8 65 11 00 00       	call   38d0 <printf>
+    exit();
+    276b:	e8 ab 0f 00 00       	call   371b <exit>
+
+00002770 <dirfile>:
+
+void
+dirfile(void)
+{
+    2770:	55                   	push   %ebp
+    2771:	89 e5                	mov    %esp,%ebp
+    2773:	53                   	push   %ebx
+    2774:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    2777:	68 f0 47 00 00       	push   $0x47f0
+    277c:	6a 01                	push   $0x1
+    277e:	e8 4d 11 00 00       	call   38d0 <printf>
+
+  fd = open("dirfile", O_CREATE);
+    2783:	83 c4 08             	add    $0x8,%esp
+    2786:	68 00 02 00 00       	push   $0x200
+    278b:	68 fd 47 00 00       	push   $0x47fd
+    2790:	e8 c6 0f 00 00       	call   375b <open>
+  if(fd < 0){
+    2795:	83 c4 10             	add    $0x10,%esp
+    2798:	85 c0                	test   %eax,%eax
+    279a:	0f 88 22 01 00 00    	js     28c2 <dirfile+0x152>
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+    27a0:	83 ec 0c             	sub    $0xc,%esp
+    27a3:	50                   	push   %eax
+    27a4:	e8 9a 0f 00 00       	call   3743 <close>
+  if(chdir("dirfile") == 0){
+    27a9:	c7 04 24 fd 47 00 00 	movl   $0x47fd,(%esp)
+    27b0:	e8 d6 0f 00 00       	call   378b <chdir>
+    27b5:	83 c4 10             	add    $0x10,%esp
+    27b8:	85 c0                	test   %eax,%eax
+    27ba:	0f 84 16 01 00 00    	je     28d6 <dirfile+0x166>
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+    27c0:	83 ec 08             	sub    $0x8,%esp
+    27c3:	6a 00                	push   $0x0
+    27c5:	68 36 48 00 00       	push   $0x4836
+    27ca:	e8 8c 0f 00 00       	call   375b <open>
+  if(fd >= 0){
+    27cf:	83 c4 10             	add    $0x10,%esp
+    27d2:	85 c0                	test   %eax,%eax
+    27d4:	0f 89 10 01 00 00    	jns    28ea <dirfile+0x17a>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    27da:	83 ec 08             	sub    $0x8,%esp
+    27dd:	68 00 02 00 00       	push   $0x200
+    27e2:	68 36 48 00 00       	push   $0x4836
+    27e7:	e8 6f 0f 00 00       	call   375b <open>
+  if(fd >= 0){
+    27ec:	83 c4 10             	add    $0x10,%esp
+    27ef:	85 c0                	test   %eax,%eax
+    27f1:	0f 89 07 01 00 00    	jns    28fe <dirfile+0x18e>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    27f7:	83 ec 0c             	sub    $0xc,%esp
+    27fa:	68 36 48 00 00       	push   $0x4836
+    27ff:	e8 7f 0f 00 00       	call   3783 <mkdir>
+    2804:	83 c4 10             	add    $0x10,%esp
+    2807:	85 c0                	test   %eax,%eax
+    2809:	0f 84 03 01 00 00    	je     2912 <dirfile+0x1a2>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    280f:	83 ec 0c             	sub    $0xc,%esp
+    2812:	68 36 48 00 00       	push   $0x4836
+    2817:	e8 4f 0f 00 00       	call   376b <unlink>
+    281c:	83 c4 10             	add    $0x10,%esp
+    281f:	85 c0                	test   %eax,%eax
+    2821:	0f 84 ff 00 00 00    	je     2926 <dirfile+0x1b6>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    2827:	83 ec 08             	sub    $0x8,%esp
+    282a:	68 36 48 00 00       	push   $0x4836
+    282f:	68 9a 48 00 00       	push   $0x489a
+    2834:	e8 42 0f 00 00       	call   377b <link>
+    2839:	83 c4 10             	add    $0x10,%esp
+    283c:	85 c0                	test   %eax,%eax
+    283e:	0f 84 f6 00 00 00    	je     293a <dirfile+0x1ca>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    2844:	83 ec 0c             	sub    $0xc,%esp
+    2847:	68 fd 47 00 00       	push   $0x47fd
+    284c:	e8 1a 0f 00 00       	call   376b <unlink>
+    2851:	83 c4 10             	add    $0x10,%esp
+    2854:	85 c0                	test   %eax,%eax
+    2856:	0f 85 f2 00 00 00    	jne    294e <dirfile+0x1de>
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+    285c:	83 ec 08             	sub    $0x8,%esp
+    285f:	6a 02                	push   $0x2
+    2861:	68 f6 43 00 00       	push   $0x43f6
+    2866:	e8 f0 0e 00 00       	call   375b <open>
+  if(fd >= 0){
+    286b:	83 c4 10             	add    $0x10,%esp
+    286e:	85 c0                	test   %eax,%eax
+    2870:	0f 89 ec 00 00 00    	jns    2962 <dirfile+0x1f2>
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+    2876:	83 ec 08             	sub    $0x8,%esp
+    2879:	6a 00                	push   $0x0
+    287b:	68 f6 43 00 00       	push   $0x43f6
+    2880:	e8 d6 0e 00 00       	call   375b <open>
+    2885:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2887:	83 c4 0c             	add    $0xc,%esp
+    288a:	6a 01                	push   $0x1
+    288c:	68 d9 44 00 00       	push   $0x44d9
+    2891:	50                   	push   %eax
+    2892:	e8 a4 0e 00 00       	call   373b <write>
+    2897:	83 c4 10             	add    $0x10,%esp
+    289a:	85 c0                	test   %eax,%eax
+    289c:	0f 8f d4 00 00 00    	jg     2976 <dirfile+0x206>
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+    28a2:	83 ec 0c             	sub    $0xc,%esp
+    28a5:	53                   	push   %ebx
+    28a6:	e8 98 0e 00 00       	call   3743 <close>
+
+  printf(1, "dir vs file OK\n");
+    28ab:	83 c4 08             	add    $0x8,%esp
+    28ae:	68 cd 48 00 00       	push   $0x48cd
+    28b3:	6a 01                	push   $0x1
+    28b5:	e8 16 10 00 00       	call   38d0 <printf>
+}
+    28ba:	83 c4 10             	add    $0x10,%esp
+    28bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    28c0:	c9                   	leave
+    28c1:	c3                   	ret
+    printf(1, "create dirfile failed\n");
+    28c2:	83 ec 08             	sub    $0x8,%esp
+    28c5:	68 05 48 00 00       	push   $0x4805
+    28ca:	6a 01                	push   $0x1
+    28cc:	e8 ff 0f 00 00       	call   38d0 <printf>
+    exit();
+    28d1:	e8 45 0e 00 00       	call   371b <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    28d6:	83 ec 08             	sub    $0x8,%esp
+    28d9:	68 1c 48 00 00       	push   $0x481c
+    28de:	6a 01                	push   $0x1
+    28e0:	e8 eb 0f 00 00       	call   38d0 <printf>
+    exit();
+    28e5:	e8 31 0e 00 00       	call   371b <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    28ea:	83 ec 08             	sub    $0x8,%esp
+    28ed:	68 41 48 00 00       	push   $0x4841
+    28f2:	6a 01                	push   $0x1
+    28f4:	e8 d7 0f 00 00       	call   38d0 <printf>
+    exit();
+    28f9:	e8 1d 0e 00 00       	call   371b <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    28fe:	83 ec 08             	sub    $0x8,%esp
+    2901:	68 41 48 00 00       	push   $0x4841
+    2906:	6a 01                	push   $0x1
+    2908:	e8 c3 0f 00 00       	call   38d0 <printf>
+    exit();
+    290d:	e8 09 0e 00 00       	call   371b <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2912:	83 ec 08             	sub    $0x8,%esp
+    2915:	68 5f 48 00 00       	push   $0x485f
+    291a:	6a 01                	push   $0x1
+    291c:	e8 af 0f 00 00       	call   38d0 <printf>
+    exit();
+    2921:	e8 f5 0d 00 00       	call   371b <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2926:	83 ec 08             	sub    $0x8,%esp
+    2929:	68 7c 48 00 00       	push   $0x487c
+    292e:	6a 01                	push   $0x1
+    2930:	e8 9b 0f 00 00       	call   38d0 <printf>
+    exit();
+    2935:	e8 e1 0d 00 00       	call   371b <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    293a:	83 ec 08             	sub    $0x8,%esp
+    293d:	68 90 50 00 00       	push   $0x5090
+    2942:	6a 01                	push   $0x1
+    2944:	e8 87 0f 00 00       	call   38d0 <printf>
+    exit();
+    2949:	e8 cd 0d 00 00       	call   371b <exit>
+    printf(1, "unlink dirfile failed!\n");
+    294e:	83 ec 08             	sub    $0x8,%esp
+    2951:	68 a1 48 00 00       	push   $0x48a1
+    2956:	6a 01                	push   $0x1
+    2958:	e8 73 0f 00 00       	call   38d0 <printf>
+    exit();
+    295d:	e8 b9 0d 00 00       	call   371b <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2962:	83 ec 08             	sub    $0x8,%esp
+    2965:	68 b0 50 00 00       	push   $0x50b0
+    296a:	6a 01                	push   $0x1
+    296c:	e8 5f 0f 00 00       	call   38d0 <printf>
+    exit();
+    2971:	e8 a5 0d 00 00       	call   371b <exit>
+    printf(1, "write . succeeded!\n");
+    2976:	83 ec 08             	sub    $0x8,%esp
+    2979:	68 b9 48 00 00       	push   $0x48b9
+    297e:	6a 01                	push   $0x1
+    2980:	e8 4b 0f 00 00       	call   38d0 <printf>
+    exit();
+    2985:	e8 91 0d 00 00       	call   371b <exit>
+
+0000298a <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    298a:	55                   	push   %ebp
+    298b:	89 e5                	mov    %esp,%ebp
+    298d:	53                   	push   %ebx
+    298e:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    2991:	68 dd 48 00 00       	push   $0x48dd
+    2996:	6a 01                	push   $0x1
+    2998:	e8 33 0f 00 00       	call   38d0 <printf>
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    299d:	83 c4 10             	add    $0x10,%esp
+    29a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    29a5:	eb 4c                	jmp    29f3 <iref+0x69>
+    if(mkdir("irefd") != 0){
+      printf(1, "mkdir irefd failed\n");
+    29a7:	83 ec 08             	sub    $0x8,%esp
+    29aa:	68 f4 48 00 00       	push   $0x48f4
+    29af:	6a 01                	push   $0x1
+    29b1:	e8 1a 0f 00 00       	call   38d0 <printf>
+      exit();
+    29b6:	e8 60 0d 00 00       	call   371b <exit>
+    }
+    if(chdir("irefd") != 0){
+      printf(1, "chdir irefd failed\n");
+    29bb:	83 ec 08             	sub    $0x8,%esp
+    29be:	68 08 49 00 00       	push   $0x4908
+    29c3:	6a 01                	push   $0x1
+    29c5:	e8 06 0f 00 00       	call   38d0 <printf>
+      exit();
+    29ca:	e8 4c 0d 00 00       	call   371b <exit>
+
+    mkdir("");
+    link("README", "");
+    fd = open("", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    29cf:	83 ec 0c             	sub    $0xc,%esp
+    29d2:	50                   	push   %eax
+    29d3:	e8 6b 0d 00 00       	call   3743 <close>
+    29d8:	83 c4 10             	add    $0x10,%esp
+    29db:	e9 80 00 00 00       	jmp    2a60 <iref+0xd6>
+    fd = open("xx", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    unlink("xx");
+    29e0:	83 ec 0c             	sub    $0xc,%esp
+    29e3:	68 d8 44 00 00       	push   $0x44d8
+    29e8:	e8 7e 0d 00 00       	call   376b <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    29ed:	83 c3 01             	add    $0x1,%ebx
+    29f0:	83 c4 10             	add    $0x10,%esp
+    29f3:	83 fb 32             	cmp    $0x32,%ebx
+    29f6:	0f 8f 92 00 00 00    	jg     2a8e <iref+0x104>
+    if(mkdir("irefd") != 0){
+    29fc:	83 ec 0c             	sub    $0xc,%esp
+    29ff:	68 ee 48 00 00       	push   $0x48ee
+    2a04:	e8 7a 0d 00 00       	call   3783 <mkdir>
+    2a09:	83 c4 10             	add    $0x10,%esp
+    2a0c:	85 c0                	test   %eax,%eax
+    2a0e:	75 97                	jne    29a7 <iref+0x1d>
+    if(chdir("irefd") != 0){
+    2a10:	83 ec 0c             	sub    $0xc,%esp
+    2a13:	68 ee 48 00 00       	push   $0x48ee
+    2a18:	e8 6e 0d 00 00       	call   378b <chdir>
+    2a1d:	83 c4 10             	add    $0x10,%esp
+    2a20:	85 c0                	test   %eax,%eax
+    2a22:	75 97                	jne    29bb <iref+0x31>
+    mkdir("");
+    2a24:	83 ec 0c             	sub    $0xc,%esp
+    2a27:	68 a3 3f 00 00       	push   $0x3fa3
+    2a2c:	e8 52 0d 00 00       	call   3783 <mkdir>
+    link("README", "");
+    2a31:	83 c4 08             	add    $0x8,%esp
+    2a34:	68 a3 3f 00 00       	push   $0x3fa3
+    2a39:	68 9a 48 00 00       	push   $0x489a
+    2a3e:	e8 38 0d 00 00       	call   377b <link>
+    fd = open("", O_CREATE);
+    2a43:	83 c4 08             	add    $0x8,%esp
+    2a46:	68 00 02 00 00       	push   $0x200
+    2a4b:	68 a3 3f 00 00       	push   $0x3fa3
+    2a50:	e8 06 0d 00 00       	call   375b <open>
+    if(fd >= 0)
+    2a55:	83 c4 10             	add    $0x10,%esp
+    2a58:	85 c0                	test   %eax,%eax
+    2a5a:	0f 89 6f ff ff ff    	jns    29cf <iref+0x45>
+    fd = open("xx", O_CREATE);
+    2a60:	83 ec 08             	sub    $0x8,%esp
+    2a63:	68 00 02 00 00       	push   $0x200
+    2a68:	68 d8 44 00 00       	push   $0x44d8
+    2a6d:	e8 e9 0c 00 00       	call   375b <open>
+    if(fd >= 0)
+    2a72:	83 c4 10             	add    $0x10,%esp
+    2a75:	85 c0                	test   %eax,%eax
+    2a77:	0f 88 63 ff ff ff    	js     29e0 <iref+0x56>
+      close(fd);
+    2a7d:	83 ec 0c             	sub    $0xc,%esp
+    2a80:	50                   	push   %eax
+    2a81:	e8 bd 0c 00 00       	call   3743 <close>
+    2a86:	83 c4 10             	add    $0x10,%esp
+    2a89:	e9 52 ff ff ff       	jmp    29e0 <iref+0x56>
+  }
+
+  chdir("/");
+    2a8e:	83 ec 0c             	sub    $0xc,%esp
+    2a91:	68 c9 3b 00 00       	push   $0x3bc9
+    2a96:	e8 f0 0c 00 00       	call   378b <chdir>
+  printf(1, "empty file name OK\n");
+    2a9b:	83 c4 08             	add    $0x8,%esp
+    2a9e:	68 1c 49 00 00       	push   $0x491c
+    2aa3:	6a 01                	push   $0x1
+    2aa5:	e8 26 0e 00 00       	call   38d0 <printf>
+}
+    2aaa:	83 c4 10             	add    $0x10,%esp
+    2aad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ab0:	c9                   	leave
+    2ab1:	c3                   	ret
+
+00002ab2 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    2ab2:	55                   	push   %ebp
+    2ab3:	89 e5                	mov    %esp,%ebp
+    2ab5:	53                   	push   %ebx
+    2ab6:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    2ab9:	68 30 49 00 00       	push   $0x4930
+    2abe:	6a 01                	push   $0x1
+    2ac0:	e8 0b 0e 00 00       	call   38d0 <printf>
+
+  for(n=0; n<1000; n++){
+    2ac5:	83 c4 10             	add    $0x10,%esp
+    2ac8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2acd:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    2ad3:	7f 15                	jg     2aea <forktest+0x38>
+    pid = fork();
+    2ad5:	e8 39 0c 00 00       	call   3713 <fork>
+    if(pid < 0)
+    2ada:	85 c0                	test   %eax,%eax
+    2adc:	78 0c                	js     2aea <forktest+0x38>
+      break;
+    if(pid == 0)
+    2ade:	74 05                	je     2ae5 <forktest+0x33>
+  for(n=0; n<1000; n++){
+    2ae0:	83 c3 01             	add    $0x1,%ebx
+    2ae3:	eb e8                	jmp    2acd <forktest+0x1b>
+      exit();
+    2ae5:	e8 31 0c 00 00       	call   371b <exit>
+  }
+
+  if(n == 1000){
+    2aea:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2af0:	74 12                	je     2b04 <forktest+0x52>
+    printf(1, "fork claimed to work 1000 times!\n");
+    exit();
+  }
+
+  for(; n > 0; n--){
+    2af2:	85 db                	test   %ebx,%ebx
+    2af4:	7e 36                	jle    2b2c <forktest+0x7a>
+    if(wait() < 0){
+    2af6:	e8 28 0c 00 00       	call   3723 <wait>
+    2afb:	85 c0                	test   %eax,%eax
+    2afd:	78 19                	js     2b18 <forktest+0x66>
+  for(; n > 0; n--){
+    2aff:	83 eb 01             	sub    $0x1,%ebx
+    2b02:	eb ee                	jmp    2af2 <forktest+0x40>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2b04:	83 ec 08             	sub    $0x8,%esp
+    2b07:	68 d0 50 00 00       	push   $0x50d0
+    2b0c:	6a 01                	push   $0x1
+    2b0e:	e8 bd 0d 00 00       	call   38d0 <printf>
+    exit();
+    2b13:	e8 03 0c 00 00       	call   371b <exit>
+      printf(1, "wait stopped early\n");
+    2b18:	83 ec 08             	sub    $0x8,%esp
+    2b1b:	68 3b 49 00 00       	push   $0x493b
+    2b20:	6a 01                	push   $0x1
+    2b22:	e8 a9 0d 00 00       	call   38d0 <printf>
+      exit();
+    2b27:	e8 ef 0b 00 00       	call   371b <exit>
+    }
+  }
+
+  if(wait() != -1){
+    2b2c:	e8 f2 0b 00 00       	call   3723 <wait>
+    2b31:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2b34:	75 17                	jne    2b4d <forktest+0x9b>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+    2b36:	83 ec 08             	sub    $0x8,%esp
+    2b39:	68 62 49 00 00       	push   $0x4962
+    2b3e:	6a 01                	push   $0x1
+    2b40:	e8 8b 0d 00 00       	call   38d0 <printf>
+}
+    2b45:	83 c4 10             	add    $0x10,%esp
+    2b48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b4b:	c9                   	leave
+    2b4c:	c3                   	ret
+    printf(1, "wait got too many\n");
+    2b4d:	83 ec 08             	sub    $0x8,%esp
+    2b50:	68 4f 49 00 00       	push   $0x494f
+    2b55:	6a 01                	push   $0x1
+    2b57:	e8 74 0d 00 00       	call   38d0 <printf>
+    exit();
+    2b5c:	e8 ba 0b 00 00       	call   371b <exit>
+
+00002b61 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    2b61:	55                   	push   %ebp
+    2b62:	89 e5                	mov    %esp,%ebp
+    2b64:	57                   	push   %edi
+    2b65:	56                   	push   %esi
+    2b66:	53                   	push   %ebx
+    2b67:	83 ec 54             	sub    $0x54,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    2b6a:	68 70 49 00 00       	push   $0x4970
+    2b6f:	ff 35 90 53 00 00    	push   0x5390
+    2b75:	e8 56 0d 00 00       	call   38d0 <printf>
+  oldbrk = sbrk(0);
+    2b7a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2b81:	e8 1d 0c 00 00       	call   37a3 <sbrk>
+    2b86:	89 c7                	mov    %eax,%edi
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    2b88:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2b8f:	e8 0f 0c 00 00       	call   37a3 <sbrk>
+    2b94:	89 c6                	mov    %eax,%esi
+  int i;
+  for(i = 0; i < 5000; i++){
+    2b96:	83 c4 10             	add    $0x10,%esp
+    2b99:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2b9e:	81 fb 87 13 00 00    	cmp    $0x1387,%ebx
+    2ba4:	7f 3a                	jg     2be0 <sbrktest+0x7f>
+    b = sbrk(1);
+    2ba6:	83 ec 0c             	sub    $0xc,%esp
+    2ba9:	6a 01                	push   $0x1
+    2bab:	e8 f3 0b 00 00       	call   37a3 <sbrk>
+    if(b != a){
+    2bb0:	83 c4 10             	add    $0x10,%esp
+    2bb3:	39 c6                	cmp    %eax,%esi
+    2bb5:	75 0b                	jne    2bc2 <sbrktest+0x61>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    2bb7:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    2bba:	8d 70 01             	lea    0x1(%eax),%esi
+  for(i = 0; i < 5000; i++){
+    2bbd:	83 c3 01             	add    $0x1,%ebx
+    2bc0:	eb dc                	jmp    2b9e <sbrktest+0x3d>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    2bc2:	83 ec 0c             	sub    $0xc,%esp
+    2bc5:	50                   	push   %eax
+    2bc6:	56                   	push   %esi
+    2bc7:	53                   	push   %ebx
+    2bc8:	68 7b 49 00 00       	push   $0x497b
+    2bcd:	ff 35 90 53 00 00    	push   0x5390
+    2bd3:	e8 f8 0c 00 00       	call   38d0 <printf>
+      exit();
+    2bd8:	83 c4 20             	add    $0x20,%esp
+    2bdb:	e8 3b 0b 00 00       	call   371b <exit>
+  }
+  pid = fork();
+    2be0:	e8 2e 0b 00 00       	call   3713 <fork>
+    2be5:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    2be7:	85 c0                	test   %eax,%eax
+    2be9:	0f 88 53 01 00 00    	js     2d42 <sbrktest+0x1e1>
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+    2bef:	83 ec 0c             	sub    $0xc,%esp
+    2bf2:	6a 01                	push   $0x1
+    2bf4:	e8 aa 0b 00 00       	call   37a3 <sbrk>
+  c = sbrk(1);
+    2bf9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2c00:	e8 9e 0b 00 00       	call   37a3 <sbrk>
+  if(c != a + 1){
+    2c05:	83 c6 01             	add    $0x1,%esi
+    2c08:	83 c4 10             	add    $0x10,%esp
+    2c0b:	39 c6                	cmp    %eax,%esi
+    2c0d:	0f 85 47 01 00 00    	jne    2d5a <sbrktest+0x1f9>
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    2c13:	85 db                	test   %ebx,%ebx
+    2c15:	0f 84 57 01 00 00    	je     2d72 <sbrktest+0x211>
+    exit();
+  wait();
+    2c1b:	e8 03 0b 00 00       	call   3723 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    2c20:	83 ec 0c             	sub    $0xc,%esp
+    2c23:	6a 00                	push   $0x0
+    2c25:	e8 79 0b 00 00       	call   37a3 <sbrk>
+    2c2a:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2c2c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2c31:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2c33:	89 04 24             	mov    %eax,(%esp)
+    2c36:	e8 68 0b 00 00       	call   37a3 <sbrk>
+  if (p != a) {
+    2c3b:	83 c4 10             	add    $0x10,%esp
+    2c3e:	39 c3                	cmp    %eax,%ebx
+    2c40:	0f 85 31 01 00 00    	jne    2d77 <sbrktest+0x216>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    exit();
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+    2c46:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+
+  // can one de-allocate?
+  a = sbrk(0);
+    2c4d:	83 ec 0c             	sub    $0xc,%esp
+    2c50:	6a 00                	push   $0x0
+    2c52:	e8 4c 0b 00 00       	call   37a3 <sbrk>
+    2c57:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2c59:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+    2c60:	e8 3e 0b 00 00       	call   37a3 <sbrk>
+  if(c == (char*)0xffffffff){
+    2c65:	83 c4 10             	add    $0x10,%esp
+    2c68:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2c6b:	0f 84 1e 01 00 00    	je     2d8f <sbrktest+0x22e>
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+    2c71:	83 ec 0c             	sub    $0xc,%esp
+    2c74:	6a 00                	push   $0x0
+    2c76:	e8 28 0b 00 00       	call   37a3 <sbrk>
+  if(c != a - 4096){
+    2c7b:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2c81:	83 c4 10             	add    $0x10,%esp
+    2c84:	39 c2                	cmp    %eax,%edx
+    2c86:	0f 85 1b 01 00 00    	jne    2da7 <sbrktest+0x246>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    2c8c:	83 ec 0c             	sub    $0xc,%esp
+    2c8f:	6a 00                	push   $0x0
+    2c91:	e8 0d 0b 00 00       	call   37a3 <sbrk>
+    2c96:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2c98:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    2c9f:	e8 ff 0a 00 00       	call   37a3 <sbrk>
+    2ca4:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2ca6:	83 c4 10             	add    $0x10,%esp
+    2ca9:	39 c3                	cmp    %eax,%ebx
+    2cab:	0f 85 0d 01 00 00    	jne    2dbe <sbrktest+0x25d>
+    2cb1:	83 ec 0c             	sub    $0xc,%esp
+    2cb4:	6a 00                	push   $0x0
+    2cb6:	e8 e8 0a 00 00       	call   37a3 <sbrk>
+    2cbb:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2cc1:	83 c4 10             	add    $0x10,%esp
+    2cc4:	39 c2                	cmp    %eax,%edx
+    2cc6:	0f 85 f2 00 00 00    	jne    2dbe <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    2ccc:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2cd3:	0f 84 fc 00 00 00    	je     2dd5 <sbrktest+0x274>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+    2cd9:	83 ec 0c             	sub    $0xc,%esp
+    2cdc:	6a 00                	push   $0x0
+    2cde:	e8 c0 0a 00 00       	call   37a3 <sbrk>
+    2ce3:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2ce5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2cec:	e8 b2 0a 00 00       	call   37a3 <sbrk>
+    2cf1:	89 c2                	mov    %eax,%edx
+    2cf3:	89 f8                	mov    %edi,%eax
+    2cf5:	29 d0                	sub    %edx,%eax
+    2cf7:	89 04 24             	mov    %eax,(%esp)
+    2cfa:	e8 a4 0a 00 00       	call   37a3 <sbrk>
+  if(c != a){
+    2cff:	83 c4 10             	add    $0x10,%esp
+    2d02:	39 c3                	cmp    %eax,%ebx
+    2d04:	0f 85 e3 00 00 00    	jne    2ded <sbrktest+0x28c>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2d0a:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    2d0f:	81 fb 7f 84 1e 80    	cmp    $0x801e847f,%ebx
+    2d15:	0f 87 23 01 00 00    	ja     2e3e <sbrktest+0x2dd>
+    ppid = getpid();
+    2d1b:	e8 7b 0a 00 00       	call   379b <getpid>
+    2d20:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2d22:	e8 ec 09 00 00       	call   3713 <fork>
+    if(pid < 0){
+    2d27:	85 c0                	test   %eax,%eax
+    2d29:	0f 88 d5 00 00 00    	js     2e04 <sbrktest+0x2a3>
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    2d2f:	0f 84 e7 00 00 00    	je     2e1c <sbrktest+0x2bb>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait();
+    2d35:	e8 e9 09 00 00       	call   3723 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2d3a:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    2d40:	eb cd                	jmp    2d0f <sbrktest+0x1ae>
+    printf(stdout, "sbrk test fork failed\n");
+    2d42:	83 ec 08             	sub    $0x8,%esp
+    2d45:	68 96 49 00 00       	push   $0x4996
+    2d4a:	ff 35 90 53 00 00    	push   0x5390
+    2d50:	e8 7b 0b 00 00       	call   38d0 <printf>
+    exit();
+    2d55:	e8 c1 09 00 00       	call   371b <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    2d5a:	83 ec 08             	sub    $0x8,%esp
+    2d5d:	68 ad 49 00 00       	push   $0x49ad
+    2d62:	ff 35 90 53 00 00    	push   0x5390
+    2d68:	e8 63 0b 00 00       	call   38d0 <printf>
+    exit();
+    2d6d:	e8 a9 09 00 00       	call   371b <exit>
+    exit();
+    2d72:	e8 a4 09 00 00       	call   371b <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    2d77:	83 ec 08             	sub    $0x8,%esp
+    2d7a:	68 f4 50 00 00       	push   $0x50f4
+    2d7f:	ff 35 90 53 00 00    	push   0x5390
+    2d85:	e8 46 0b 00 00       	call   38d0 <printf>
+    exit();
+    2d8a:	e8 8c 09 00 00       	call   371b <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    2d8f:	83 ec 08             	sub    $0x8,%esp
+    2d92:	68 c9 49 00 00       	push   $0x49c9
+    2d97:	ff 35 90 53 00 00    	push   0x5390
+    2d9d:	e8 2e 0b 00 00       	call   38d0 <printf>
+    exit();
+    2da2:	e8 74 09 00 00       	call   371b <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    2da7:	50                   	push   %eax
+    2da8:	53                   	push   %ebx
+    2da9:	68 34 51 00 00       	push   $0x5134
+    2dae:	ff 35 90 53 00 00    	push   0x5390
+    2db4:	e8 17 0b 00 00       	call   38d0 <printf>
+    exit();
+    2db9:	e8 5d 09 00 00       	call   371b <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    2dbe:	56                   	push   %esi
+    2dbf:	53                   	push   %ebx
+    2dc0:	68 6c 51 00 00       	push   $0x516c
+    2dc5:	ff 35 90 53 00 00    	push   0x5390
+    2dcb:	e8 00 0b 00 00       	call   38d0 <printf>
+    exit();
+    2dd0:	e8 46 09 00 00       	call   371b <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    2dd5:	83 ec 08             	sub    $0x8,%esp
+    2dd8:	68 94 51 00 00       	push   $0x5194
+    2ddd:	ff 35 90 53 00 00    	push   0x5390
+    2de3:	e8 e8 0a 00 00       	call   38d0 <printf>
+    exit();
+    2de8:	e8 2e 09 00 00       	call   371b <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    2ded:	50                   	push   %eax
+    2dee:	53                   	push   %ebx
+    2def:	68 c4 51 00 00       	push   $0x51c4
+    2df4:	ff 35 90 53 00 00    	push   0x5390
+    2dfa:	e8 d1 0a 00 00       	call   38d0 <printf>
+    exit();
+    2dff:	e8 17 09 00 00       	call   371b <exit>
+      printf(stdout, "fork failed\n");
+    2e04:	83 ec 08             	sub    $0x8,%esp
+    2e07:	68 c1 4a 00 00       	push   $0x4ac1
+    2e0c:	ff 35 90 53 00 00    	push   0x5390
+    2e12:	e8 b9 0a 00 00       	call   38d0 <printf>
+      exit();
+    2e17:	e8 ff 08 00 00       	call   371b <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    2e1c:	0f be 03             	movsbl (%ebx),%eax
+    2e1f:	50                   	push   %eax
+    2e20:	53                   	push   %ebx
+    2e21:	68 e4 49 00 00       	push   $0x49e4
+    2e26:	ff 35 90 53 00 00    	push   0x5390
+    2e2c:	e8 9f 0a 00 00       	call   38d0 <printf>
+      kill(ppid);
+    2e31:	89 34 24             	mov    %esi,(%esp)
+    2e34:	e8 12 09 00 00       	call   374b <kill>
+      exit();
+    2e39:	e8 dd 08 00 00       	call   371b <exit>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    2e3e:	83 ec 0c             	sub    $0xc,%esp
+    2e41:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2e44:	50                   	push   %eax
+    2e45:	e8 e1 08 00 00       	call   372b <pipe>
+    2e4a:	89 c3                	mov    %eax,%ebx
+    2e4c:	83 c4 10             	add    $0x10,%esp
+    2e4f:	85 c0                	test   %eax,%eax
+    2e51:	75 04                	jne    2e57 <sbrktest+0x2f6>
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2e53:	89 c6                	mov    %eax,%esi
+    2e55:	eb 59                	jmp    2eb0 <sbrktest+0x34f>
+    printf(1, "pipe() failed\n");
+    2e57:	83 ec 08             	sub    $0x8,%esp
+    2e5a:	68 b9 3e 00 00       	push   $0x3eb9
+    2e5f:	6a 01                	push   $0x1
+    2e61:	e8 6a 0a 00 00       	call   38d0 <printf>
+    exit();
+    2e66:	e8 b0 08 00 00       	call   371b <exit>
+    if((pids[i] = fork()) == 0){
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    2e6b:	83 ec 0c             	sub    $0xc,%esp
+    2e6e:	6a 00                	push   $0x0
+    2e70:	e8 2e 09 00 00       	call   37a3 <sbrk>
+    2e75:	89 c2                	mov    %eax,%edx
+    2e77:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2e7c:	29 d0                	sub    %edx,%eax
+    2e7e:	89 04 24             	mov    %eax,(%esp)
+    2e81:	e8 1d 09 00 00       	call   37a3 <sbrk>
+      write(fds[1], "x", 1);
+    2e86:	83 c4 0c             	add    $0xc,%esp
+    2e89:	6a 01                	push   $0x1
+    2e8b:	68 d9 44 00 00       	push   $0x44d9
+    2e90:	ff 75 e4             	push   -0x1c(%ebp)
+    2e93:	e8 a3 08 00 00       	call   373b <write>
+    2e98:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    2e9b:	83 ec 0c             	sub    $0xc,%esp
+    2e9e:	68 e8 03 00 00       	push   $0x3e8
+    2ea3:	e8 03 09 00 00       	call   37ab <sleep>
+    2ea8:	83 c4 10             	add    $0x10,%esp
+    2eab:	eb ee                	jmp    2e9b <sbrktest+0x33a>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2ead:	83 c6 01             	add    $0x1,%esi
+    2eb0:	83 fe 09             	cmp    $0x9,%esi
+    2eb3:	77 28                	ja     2edd <sbrktest+0x37c>
+    if((pids[i] = fork()) == 0){
+    2eb5:	e8 59 08 00 00       	call   3713 <fork>
+    2eba:	89 44 b5 b8          	mov    %eax,-0x48(%ebp,%esi,4)
+    2ebe:	85 c0                	test   %eax,%eax
+    2ec0:	74 a9                	je     2e6b <sbrktest+0x30a>
+    }
+    if(pids[i] != -1)
+    2ec2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2ec5:	74 e6                	je     2ead <sbrktest+0x34c>
+      read(fds[0], &scratch, 1);
+    2ec7:	83 ec 04             	sub    $0x4,%esp
+    2eca:	6a 01                	push   $0x1
+    2ecc:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    2ecf:	50                   	push   %eax
+    2ed0:	ff 75 e0             	push   -0x20(%ebp)
+    2ed3:	e8 5b 08 00 00       	call   3733 <read>
+    2ed8:	83 c4 10             	add    $0x10,%esp
+    2edb:	eb d0                	jmp    2ead <sbrktest+0x34c>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    2edd:	83 ec 0c             	sub    $0xc,%esp
+    2ee0:	68 00 10 00 00       	push   $0x1000
+    2ee5:	e8 b9 08 00 00       	call   37a3 <sbrk>
+    2eea:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2eec:	83 c4 10             	add    $0x10,%esp
+    2eef:	eb 03                	jmp    2ef4 <sbrktest+0x393>
+    2ef1:	83 c3 01             	add    $0x1,%ebx
+    2ef4:	83 fb 09             	cmp    $0x9,%ebx
+    2ef7:	77 1c                	ja     2f15 <sbrktest+0x3b4>
+    if(pids[i] == -1)
+    2ef9:	8b 44 9d b8          	mov    -0x48(%ebp,%ebx,4),%eax
+    2efd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f00:	74 ef                	je     2ef1 <sbrktest+0x390>
+      continue;
+    kill(pids[i]);
+    2f02:	83 ec 0c             	sub    $0xc,%esp
+    2f05:	50                   	push   %eax
+    2f06:	e8 40 08 00 00       	call   374b <kill>
+    wait();
+    2f0b:	e8 13 08 00 00       	call   3723 <wait>
+    2f10:	83 c4 10             	add    $0x10,%esp
+    2f13:	eb dc                	jmp    2ef1 <sbrktest+0x390>
+  }
+  if(c == (char*)0xffffffff){
+    2f15:	83 fe ff             	cmp    $0xffffffff,%esi
+    2f18:	74 2f                	je     2f49 <sbrktest+0x3e8>
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    2f1a:	83 ec 0c             	sub    $0xc,%esp
+    2f1d:	6a 00                	push   $0x0
+    2f1f:	e8 7f 08 00 00       	call   37a3 <sbrk>
+    2f24:	83 c4 10             	add    $0x10,%esp
+    2f27:	39 c7                	cmp    %eax,%edi
+    2f29:	72 36                	jb     2f61 <sbrktest+0x400>
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+    2f2b:	83 ec 08             	sub    $0x8,%esp
+    2f2e:	68 18 4a 00 00       	push   $0x4a18
+    2f33:	ff 35 90 53 00 00    	push   0x5390
+    2f39:	e8 92 09 00 00       	call   38d0 <printf>
+}
+    2f3e:	83 c4 10             	add    $0x10,%esp
+    2f41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2f44:	5b                   	pop    %ebx
+    2f45:	5e                   	pop    %esi
+    2f46:	5f                   	pop    %edi
+    2f47:	5d                   	pop    %ebp
+    2f48:	c3                   	ret
+    printf(stdout, "failed sbrk leaked memory\n");
+    2f49:	83 ec 08             	sub    $0x8,%esp
+    2f4c:	68 fd 49 00 00       	push   $0x49fd
+    2f51:	ff 35 90 53 00 00    	push   0x5390
+    2f57:	e8 74 09 00 00       	call   38d0 <printf>
+    exit();
+    2f5c:	e8 ba 07 00 00       	call   371b <exit>
+    sbrk(-(sbrk(0) - oldbrk));
+    2f61:	83 ec 0c             	sub    $0xc,%esp
+    2f64:	6a 00                	push   $0x0
+    2f66:	e8 38 08 00 00       	call   37a3 <sbrk>
+    2f6b:	29 c7                	sub    %eax,%edi
+    2f6d:	89 3c 24             	mov    %edi,(%esp)
+    2f70:	e8 2e 08 00 00       	call   37a3 <sbrk>
+    2f75:	83 c4 10             	add    $0x10,%esp
+    2f78:	eb b1                	jmp    2f2b <sbrktest+0x3ca>
+
+00002f7a <validateint>:
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    2f7a:	c3                   	ret
+
+00002f7b <validatetest>:
+
+void
+validatetest(void)
+{
+    2f7b:	55                   	push   %ebp
+    2f7c:	89 e5                	mov    %esp,%ebp
+    2f7e:	56                   	push   %esi
+    2f7f:	53                   	push   %ebx
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    2f80:	83 ec 08             	sub    $0x8,%esp
+    2f83:	68 26 4a 00 00       	push   $0x4a26
+    2f88:	ff 35 90 53 00 00    	push   0x5390
+    2f8e:	e8 3d 09 00 00       	call   38d0 <printf>
+  hi = 1100*1024;
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    2f93:	83 c4 10             	add    $0x10,%esp
+    2f96:	be 00 00 00 00       	mov    $0x0,%esi
+    2f9b:	81 fe 00 30 11 00    	cmp    $0x113000,%esi
+    2fa1:	77 69                	ja     300c <validatetest+0x91>
+    if((pid = fork()) == 0){
+    2fa3:	e8 6b 07 00 00       	call   3713 <fork>
+    2fa8:	89 c3                	mov    %eax,%ebx
+    2faa:	85 c0                	test   %eax,%eax
+    2fac:	74 41                	je     2fef <validatetest+0x74>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+      exit();
+    }
+    sleep(0);
+    2fae:	83 ec 0c             	sub    $0xc,%esp
+    2fb1:	6a 00                	push   $0x0
+    2fb3:	e8 f3 07 00 00       	call   37ab <sleep>
+    sleep(0);
+    2fb8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fbf:	e8 e7 07 00 00       	call   37ab <sleep>
+    kill(pid);
+    2fc4:	89 1c 24             	mov    %ebx,(%esp)
+    2fc7:	e8 7f 07 00 00       	call   374b <kill>
+    wait();
+    2fcc:	e8 52 07 00 00       	call   3723 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    2fd1:	83 c4 08             	add    $0x8,%esp
+    2fd4:	56                   	push   %esi
+    2fd5:	68 35 4a 00 00       	push   $0x4a35
+    2fda:	e8 9c 07 00 00       	call   377b <link>
+    2fdf:	83 c4 10             	add    $0x10,%esp
+    2fe2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2fe5:	75 0d                	jne    2ff4 <validatetest+0x79>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    2fe7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    2fed:	eb ac                	jmp    2f9b <validatetest+0x20>
+      exit();
+    2fef:	e8 27 07 00 00       	call   371b <exit>
+      printf(stdout, "link should not succeed\n");
+    2ff4:	83 ec 08             	sub    $0x8,%esp
+    2ff7:	68 40 4a 00 00       	push   $0x4a40
+    2ffc:	ff 35 90 53 00 00    	push   0x5390
+    3002:	e8 c9 08 00 00       	call   38d0 <printf>
+      exit();
+    3007:	e8 0f 07 00 00       	call   371b <exit>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    300c:	83 ec 08             	sub    $0x8,%esp
+    300f:	68 59 4a 00 00       	push   $0x4a59
+    3014:	ff 35 90 53 00 00    	push   0x5390
+    301a:	e8 b1 08 00 00       	call   38d0 <printf>
+}
+    301f:	83 c4 10             	add    $0x10,%esp
+    3022:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3025:	5b                   	pop    %ebx
+    3026:	5e                   	pop    %esi
+    3027:	5d                   	pop    %ebp
+    3028:	c3                   	ret
+
+00003029 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    3029:	55                   	push   %ebp
+    302a:	89 e5                	mov    %esp,%ebp
+    302c:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    302f:	68 66 4a 00 00       	push   $0x4a66
+    3034:	ff 35 90 53 00 00    	push   0x5390
+    303a:	e8 91 08 00 00       	call   38d0 <printf>
+  for(i = 0; i < sizeof(uninit); i++){
+    303f:	83 c4 10             	add    $0x10,%esp
+    3042:	b8 00 00 00 00       	mov    $0x0,%eax
+    3047:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    304c:	77 26                	ja     3074 <bsstest+0x4b>
+    if(uninit[i] != '\0'){
+    304e:	80 b8 c0 53 00 00 00 	cmpb   $0x0,0x53c0(%eax)
+    3055:	75 05                	jne    305c <bsstest+0x33>
+  for(i = 0; i < sizeof(uninit); i++){
+    3057:	83 c0 01             	add    $0x1,%eax
+    305a:	eb eb                	jmp    3047 <bsstest+0x1e>
+      printf(stdout, "bss test failed\n");
+    305c:	83 ec 08             	sub    $0x8,%esp
+    305f:	68 70 4a 00 00       	push   $0x4a70
+    3064:	ff 35 90 53 00 00    	push   0x5390
+    306a:	e8 61 08 00 00       	call   38d0 <printf>
+      exit();
+    306f:	e8 a7 06 00 00       	call   371b <exit>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    3074:	83 ec 08             	sub    $0x8,%esp
+    3077:	68 81 4a 00 00       	push   $0x4a81
+    307c:	ff 35 90 53 00 00    	push   0x5390
+    3082:	e8 49 08 00 00       	call   38d0 <printf>
+}
+    3087:	83 c4 10             	add    $0x10,%esp
+    308a:	c9                   	leave
+    308b:	c3                   	ret
+
+0000308c <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    308c:	55                   	push   %ebp
+    308d:	89 e5                	mov    %esp,%ebp
+    308f:	83 ec 14             	sub    $0x14,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    3092:	68 8e 4a 00 00       	push   $0x4a8e
+    3097:	e8 cf 06 00 00       	call   376b <unlink>
+  pid = fork();
+    309c:	e8 72 06 00 00       	call   3713 <fork>
+  if(pid == 0){
+    30a1:	83 c4 10             	add    $0x10,%esp
+    30a4:	85 c0                	test   %eax,%eax
+    30a6:	74 4d                	je     30f5 <bigargtest+0x69>
+    exec("echo", args);
+    printf(stdout, "bigarg test ok\n");
+    fd = open("bigarg-ok", O_CREATE);
+    close(fd);
+    exit();
+  } else if(pid < 0){
+    30a8:	0f 88 ad 00 00 00    	js     315b <bigargtest+0xcf>
+    printf(stdout, "bigargtest: fork failed\n");
+    exit();
+  }
+  wait();
+    30ae:	e8 70 06 00 00       	call   3723 <wait>
+  fd = open("bigarg-ok", 0);
+    30b3:	83 ec 08             	sub    $0x8,%esp
+    30b6:	6a 00                	push   $0x0
+    30b8:	68 8e 4a 00 00       	push   $0x4a8e
+    30bd:	e8 99 06 00 00       	call   375b <open>
+  if(fd < 0){
+    30c2:	83 c4 10             	add    $0x10,%esp
+    30c5:	85 c0                	test   %eax,%eax
+    30c7:	0f 88 a6 00 00 00    	js     3173 <bigargtest+0xe7>
+    printf(stdout, "bigarg test failed!\n");
+    exit();
+  }
+  close(fd);
+    30cd:	83 ec 0c             	sub    $0xc,%esp
+    30d0:	50                   	push   %eax
+    30d1:	e8 6d 06 00 00       	call   3743 <close>
+  unlink("bigarg-ok");
+    30d6:	c7 04 24 8e 4a 00 00 	movl   $0x4a8e,(%esp)
+    30dd:	e8 89 06 00 00       	call   376b <unlink>
+}
+    30e2:	83 c4 10             	add    $0x10,%esp
+    30e5:	c9                   	leave
+    30e6:	c3                   	ret
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    30e7:	c7 04 85 e0 9a 00 00 	movl   $0x51e8,0x9ae0(,%eax,4)
+    30ee:	e8 51 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    30f2:	83 c0 01             	add    $0x1,%eax
+    30f5:	83 f8 1e             	cmp    $0x1e,%eax
+    30f8:	7e ed                	jle    30e7 <bigargtest+0x5b>
+    args[MAXARG-1] = 0;
+    30fa:	c7 05 5c 9b 00 00 00 	movl   $0x0,0x9b5c
+    3101:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    3104:	83 ec 08             	sub    $0x8,%esp
+    3107:	68 98 4a 00 00       	push   $0x4a98
+    310c:	ff 35 90 53 00 00    	push   0x5390
+    3112:	e8 b9 07 00 00       	call   38d0 <printf>
+    exec("echo", args);
+    3117:	83 c4 08             	add    $0x8,%esp
+    311a:	68 e0 9a 00 00       	push   $0x9ae0
+    311f:	68 65 3c 00 00       	push   $0x3c65
+    3124:	e8 2a 06 00 00       	call   3753 <exec>
+    printf(stdout, "bigarg test ok\n");
+    3129:	83 c4 08             	add    $0x8,%esp
+    312c:	68 a5 4a 00 00       	push   $0x4aa5
+    3131:	ff 35 90 53 00 00    	push   0x5390
+    3137:	e8 94 07 00 00       	call   38d0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    313c:	83 c4 08             	add    $0x8,%esp
+    313f:	68 00 02 00 00       	push   $0x200
+    3144:	68 8e 4a 00 00       	push   $0x4a8e
+    3149:	e8 0d 06 00 00       	call   375b <open>
+    close(fd);
+    314e:	89 04 24             	mov    %eax,(%esp)
+    3151:	e8 ed 05 00 00       	call   3743 <close>
+    exit();
+    3156:	e8 c0 05 00 00       	call   371b <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    315b:	83 ec 08             	sub    $0x8,%esp
+    315e:	68 b5 4a 00 00       	push   $0x4ab5
+    3163:	ff 35 90 53 00 00    	push   0x5390
+    3169:	e8 62 07 00 00       	call   38d0 <printf>
+    exit();
+    316e:	e8 a8 05 00 00       	call   371b <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3173:	83 ec 08             	sub    $0x8,%esp
+    3176:	68 ce 4a 00 00       	push   $0x4ace
+    317b:	ff 35 90 53 00 00    	push   0x5390
+    3181:	e8 4a 07 00 00       	call   38d0 <printf>
+    exit();
+    3186:	e8 90 05 00 00       	call   371b <exit>
+
+0000318b <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    318b:	55                   	push   %ebp
+    318c:	89 e5                	mov    %esp,%ebp
+    318e:	57                   	push   %edi
+    318f:	56                   	push   %esi
+    3190:	53                   	push   %ebx
+    3191:	83 ec 54             	sub    $0x54,%esp
+  int nfiles;
+  int fsblocks = 0;
+
+  printf(1, "fsfull test\n");
+    3194:	68 e3 4a 00 00       	push   $0x4ae3
+    3199:	6a 01                	push   $0x1
+    319b:	e8 30 07 00 00       	call   38d0 <printf>
+    31a0:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    31a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    char name[64];
+    name[0] = 'f';
+    31a8:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    31ac:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    31b1:	89 d8                	mov    %ebx,%eax
+    31b3:	f7 ea                	imul   %edx
+    31b5:	c1 fa 06             	sar    $0x6,%edx
+    31b8:	89 de                	mov    %ebx,%esi
+    31ba:	c1 fe 1f             	sar    $0x1f,%esi
+    31bd:	29 f2                	sub    %esi,%edx
+    31bf:	8d 42 30             	lea    0x30(%edx),%eax
+    31c2:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    31c5:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    31cb:	89 d9                	mov    %ebx,%ecx
+    31cd:	29 d1                	sub    %edx,%ecx
+    31cf:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    31d4:	89 c8                	mov    %ecx,%eax
+    31d6:	f7 ef                	imul   %edi
+    31d8:	c1 fa 05             	sar    $0x5,%edx
+    31db:	c1 f9 1f             	sar    $0x1f,%ecx
+    31de:	29 ca                	sub    %ecx,%edx
+    31e0:	83 c2 30             	add    $0x30,%edx
+    31e3:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    31e6:	89 d8                	mov    %ebx,%eax
+    31e8:	f7 ef                	imul   %edi
+    31ea:	89 d7                	mov    %edx,%edi
+    31ec:	c1 ff 05             	sar    $0x5,%edi
+    31ef:	29 f7                	sub    %esi,%edi
+    31f1:	6b c7 64             	imul   $0x64,%edi,%eax
+    31f4:	89 df                	mov    %ebx,%edi
+    31f6:	29 c7                	sub    %eax,%edi
+    31f8:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    31fd:	89 f8                	mov    %edi,%eax
+    31ff:	f7 e9                	imul   %ecx
+    3201:	c1 fa 02             	sar    $0x2,%edx
+    3204:	c1 ff 1f             	sar    $0x1f,%edi
+    3207:	29 fa                	sub    %edi,%edx
+    3209:	83 c2 30             	add    $0x30,%edx
+    320c:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    320f:	89 d8                	mov    %ebx,%eax
+    3211:	f7 e9                	imul   %ecx
+    3213:	c1 fa 02             	sar    $0x2,%edx
+    3216:	29 f2                	sub    %esi,%edx
+    3218:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    321b:	01 c0                	add    %eax,%eax
+    321d:	89 da                	mov    %ebx,%edx
+    321f:	29 c2                	sub    %eax,%edx
+    3221:	83 c2 30             	add    $0x30,%edx
+    3224:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    3227:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    printf(1, "writing %s\n", name);
+    322b:	83 ec 04             	sub    $0x4,%esp
+    322e:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    3231:	56                   	push   %esi
+    3232:	68 f0 4a 00 00       	push   $0x4af0
+    3237:	6a 01                	push   $0x1
+    3239:	e8 92 06 00 00       	call   38d0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    323e:	83 c4 08             	add    $0x8,%esp
+    3241:	68 02 02 00 00       	push   $0x202
+    3246:	56                   	push   %esi
+    3247:	e8 0f 05 00 00       	call   375b <open>
+    324c:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    324e:	83 c4 10             	add    $0x10,%esp
+    3251:	85 c0                	test   %eax,%eax
+    3253:	79 1b                	jns    3270 <fsfull+0xe5>
+      printf(1, "open %s failed\n", name);
+    3255:	83 ec 04             	sub    $0x4,%esp
+    3258:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    325b:	50                   	push   %eax
+    325c:	68 fc 4a 00 00       	push   $0x4afc
+    3261:	6a 01                	push   $0x1
+    3263:	e8 68 06 00 00       	call   38d0 <printf>
+      break;
+    3268:	83 c4 10             	add    $0x10,%esp
+    326b:	e9 e6 00 00 00       	jmp    3356 <fsfull+0x1cb>
+    }
+    int total = 0;
+    3270:	bf 00 00 00 00       	mov    $0x0,%edi
+    while(1){
+      int cc = write(fd, buf, 512);
+    3275:	83 ec 04             	sub    $0x4,%esp
+    3278:	68 00 02 00 00       	push   $0x200
+    327d:	68 e0 7a 00 00       	push   $0x7ae0
+    3282:	56                   	push   %esi
+    3283:	e8 b3 04 00 00       	call   373b <write>
+      if(cc < 512)
+    3288:	83 c4 10             	add    $0x10,%esp
+    328b:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3290:	7e 04                	jle    3296 <fsfull+0x10b>
+        break;
+      total += cc;
+    3292:	01 c7                	add    %eax,%edi
+    while(1){
+    3294:	eb df                	jmp    3275 <fsfull+0xea>
+      fsblocks++;
+    }
+    printf(1, "wrote %d bytes\n", total);
+    3296:	83 ec 04             	sub    $0x4,%esp
+    3299:	57                   	push   %edi
+    329a:	68 0c 4b 00 00       	push   $0x4b0c
+    329f:	6a 01                	push   $0x1
+    32a1:	e8 2a 06 00 00       	call   38d0 <printf>
+    close(fd);
+    32a6:	89 34 24             	mov    %esi,(%esp)
+    32a9:	e8 95 04 00 00       	call   3743 <close>
+    if(total == 0)
+    32ae:	83 c4 10             	add    $0x10,%esp
+    32b1:	85 ff                	test   %edi,%edi
+    32b3:	0f 84 9d 00 00 00    	je     3356 <fsfull+0x1cb>
+  for(nfiles = 0; ; nfiles++){
+    32b9:	83 c3 01             	add    $0x1,%ebx
+    32bc:	e9 e7 fe ff ff       	jmp    31a8 <fsfull+0x1d>
+      break;
+  }
+
+  while(nfiles >= 0){
+    char name[64];
+    name[0] = 'f';
+    32c1:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    32c5:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    32ca:	89 d8                	mov    %ebx,%eax
+    32cc:	f7 ea                	imul   %edx
+    32ce:	c1 fa 06             	sar    $0x6,%edx
+    32d1:	89 de                	mov    %ebx,%esi
+    32d3:	c1 fe 1f             	sar    $0x1f,%esi
+    32d6:	29 f2                	sub    %esi,%edx
+    32d8:	8d 42 30             	lea    0x30(%edx),%eax
+    32db:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    32de:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    32e4:	89 d9                	mov    %ebx,%ecx
+    32e6:	29 d1                	sub    %edx,%ecx
+    32e8:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    32ed:	89 c8                	mov    %ecx,%eax
+    32ef:	f7 ef                	imul   %edi
+    32f1:	c1 fa 05             	sar    $0x5,%edx
+    32f4:	c1 f9 1f             	sar    $0x1f,%ecx
+    32f7:	29 ca                	sub    %ecx,%edx
+    32f9:	83 c2 30             	add    $0x30,%edx
+    32fc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    32ff:	89 d8                	mov    %ebx,%eax
+    3301:	f7 ef                	imul   %edi
+    3303:	89 d7                	mov    %edx,%edi
+    3305:	c1 ff 05             	sar    $0x5,%edi
+    3308:	29 f7                	sub    %esi,%edi
+    330a:	6b c7 64             	imul   $0x64,%edi,%eax
+    330d:	89 df                	mov    %ebx,%edi
+    330f:	29 c7                	sub    %eax,%edi
+    3311:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    3316:	89 f8                	mov    %edi,%eax
+    3318:	f7 e9                	imul   %ecx
+    331a:	c1 fa 02             	sar    $0x2,%edx
+    331d:	c1 ff 1f             	sar    $0x1f,%edi
+    3320:	29 fa                	sub    %edi,%edx
+    3322:	83 c2 30             	add    $0x30,%edx
+    3325:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3328:	89 d8                	mov    %ebx,%eax
+    332a:	f7 e9                	imul   %ecx
+    332c:	c1 fa 02             	sar    $0x2,%edx
+    332f:	29 f2                	sub    %esi,%edx
+    3331:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    3334:	01 c0                	add    %eax,%eax
+    3336:	89 da                	mov    %ebx,%edx
+    3338:	29 c2                	sub    %eax,%edx
+    333a:	83 c2 30             	add    $0x30,%edx
+    333d:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    3340:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    unlink(name);
+    3344:	83 ec 0c             	sub    $0xc,%esp
+    3347:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    334a:	50                   	push   %eax
+    334b:	e8 1b 04 00 00       	call   376b <unlink>
+    nfiles--;
+    3350:	83 eb 01             	sub    $0x1,%ebx
+    3353:	83 c4 10             	add    $0x10,%esp
+  while(nfiles >= 0){
+    3356:	85 db                	test   %ebx,%ebx
+    3358:	0f 89 63 ff ff ff    	jns    32c1 <fsfull+0x136>
+  }
+
+  printf(1, "fsfull test finished\n");
+    335e:	83 ec 08             	sub    $0x8,%esp
+    3361:	68 1c 4b 00 00       	push   $0x4b1c
+    3366:	6a 01                	push   $0x1
+    3368:	e8 63 05 00 00       	call   38d0 <printf>
+}
+    336d:	83 c4 10             	add    $0x10,%esp
+    3370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3373:	5b                   	pop    %ebx
+    3374:	5e                   	pop    %esi
+    3375:	5f                   	pop    %edi
+    3376:	5d                   	pop    %ebp
+    3377:	c3                   	ret
+
+00003378 <uio>:
+
+void
+uio()
+{
+    3378:	55                   	push   %ebp
+    3379:	89 e5                	mov    %esp,%ebp
+    337b:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+    337e:	68 32 4b 00 00       	push   $0x4b32
+    3383:	6a 01                	push   $0x1
+    3385:	e8 46 05 00 00       	call   38d0 <printf>
+  pid = fork();
+    338a:	e8 84 03 00 00       	call   3713 <fork>
+  if(pid == 0){
+    338f:	83 c4 10             	add    $0x10,%esp
+    3392:	85 c0                	test   %eax,%eax
+    3394:	74 1b                	je     33b1 <uio+0x39>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    3396:	78 3e                	js     33d6 <uio+0x5e>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+    3398:	e8 86 03 00 00       	call   3723 <wait>
+  printf(1, "uio test done\n");
+    339d:	83 ec 08             	sub    $0x8,%esp
+    33a0:	68 3c 4b 00 00       	push   $0x4b3c
+    33a5:	6a 01                	push   $0x1
+    33a7:	e8 24 05 00 00       	call   38d0 <printf>
+}
+    33ac:	83 c4 10             	add    $0x10,%esp
+    33af:	c9                   	leave
+    33b0:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    33b1:	b8 09 00 00 00       	mov    $0x9,%eax
+    33b6:	ba 70 00 00 00       	mov    $0x70,%edx
+    33bb:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    33bc:	ba 71 00 00 00       	mov    $0x71,%edx
+    33c1:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    33c2:	83 ec 08             	sub    $0x8,%esp
+    33c5:	68 c8 52 00 00       	push   $0x52c8
+    33ca:	6a 01                	push   $0x1
+    33cc:	e8 ff 04 00 00       	call   38d0 <printf>
+    exit();
+    33d1:	e8 45 03 00 00       	call   371b <exit>
+    printf (1, "fork failed\n");
+    33d6:	83 ec 08             	sub    $0x8,%esp
+    33d9:	68 c1 4a 00 00       	push   $0x4ac1
+    33de:	6a 01                	push   $0x1
+    33e0:	e8 eb 04 00 00       	call   38d0 <printf>
+    exit();
+    33e5:	e8 31 03 00 00       	call   371b <exit>
+
+000033ea <argptest>:
+
+void argptest()
+{
+    33ea:	55                   	push   %ebp
+    33eb:	89 e5                	mov    %esp,%ebp
+    33ed:	53                   	push   %ebx
+    33ee:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    33f1:	6a 00                	push   $0x0
+    33f3:	68 4b 4b 00 00       	push   $0x4b4b
+    33f8:	e8 5e 03 00 00       	call   375b <open>
+  if (fd < 0) {
+    33fd:	83 c4 10             	add    $0x10,%esp
+    3400:	85 c0                	test   %eax,%eax
+    3402:	78 3a                	js     343e <argptest+0x54>
+    3404:	89 c3                	mov    %eax,%ebx
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    3406:	83 ec 0c             	sub    $0xc,%esp
+    3409:	6a 00                	push   $0x0
+    340b:	e8 93 03 00 00       	call   37a3 <sbrk>
+    3410:	83 e8 01             	sub    $0x1,%eax
+    3413:	83 c4 0c             	add    $0xc,%esp
+    3416:	6a ff                	push   $0xffffffff
+    3418:	50                   	push   %eax
+    3419:	53                   	push   %ebx
+    341a:	e8 14 03 00 00       	call   3733 <read>
+  close(fd);
+    341f:	89 1c 24             	mov    %ebx,(%esp)
+    3422:	e8 1c 03 00 00       	call   3743 <close>
+  printf(1, "arg test passed\n");
+    3427:	83 c4 08             	add    $0x8,%esp
+    342a:	68 5d 4b 00 00       	push   $0x4b5d
+    342f:	6a 01                	push   $0x1
+    3431:	e8 9a 04 00 00       	call   38d0 <printf>
+}
+    3436:	83 c4 10             	add    $0x10,%esp
+    3439:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    343c:	c9                   	leave
+    343d:	c3                   	ret
+    printf(2, "open failed\n");
+    343e:	83 ec 08             	sub    $0x8,%esp
+    3441:	68 50 4b 00 00       	push   $0x4b50
+    3446:	6a 02                	push   $0x2
+    3448:	e8 83 04 00 00       	call   38d0 <printf>
+    exit();
+    344d:	e8 c9 02 00 00       	call   371b <exit>
+
+00003452 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    3452:	69 05 8c 53 00 00 0d 	imul   $0x19660d,0x538c,%eax
+    3459:	66 19 00 
+    345c:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    3461:	a3 8c 53 00 00       	mov    %eax,0x538c
+  return randstate;
+}
+    3466:	c3                   	ret
+
+00003467 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    3467:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    346b:	83 e4 f0             	and    $0xfffffff0,%esp
+    346e:	ff 71 fc             	push   -0x4(%ecx)
+    3471:	55                   	push   %ebp
+    3472:	89 e5                	mov    %esp,%ebp
+    3474:	51                   	push   %ecx
+    3475:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    3478:	68 6e 4b 00 00       	push   $0x4b6e
+    347d:	6a 01                	push   $0x1
+    347f:	e8 4c 04 00 00       	call   38d0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    3484:	83 c4 08             	add    $0x8,%esp
+    3487:	6a 00                	push   $0x0
+    3489:	68 82 4b 00 00       	push   $0x4b82
+    348e:	e8 c8 02 00 00       	call   375b <open>
+    3493:	83 c4 10             	add    $0x10,%esp
+    3496:	85 c0                	test   %eax,%eax
+    3498:	78 14                	js     34ae <main+0x47>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    349a:	83 ec 08             	sub    $0x8,%esp
+    349d:	68 ec 52 00 00       	push   $0x52ec
+    34a2:	6a 01                	push   $0x1
+    34a4:	e8 27 04 00 00       	call   38d0 <printf>
+    exit();
+    34a9:	e8 6d 02 00 00       	call   371b <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    34ae:	83 ec 08             	sub    $0x8,%esp
+    34b1:	68 00 02 00 00       	push   $0x200
+    34b6:	68 82 4b 00 00       	push   $0x4b82
+    34bb:	e8 9b 02 00 00       	call   375b <open>
+    34c0:	89 04 24             	mov    %eax,(%esp)
+    34c3:	e8 7b 02 00 00       	call   3743 <close>
+
+  argptest();
+    34c8:	e8 1d ff ff ff       	call   33ea <argptest>
+  createdelete();
+    34cd:	e8 40 db ff ff       	call   1012 <createdelete>
+  linkunlink();
+    34d2:	e8 d9 e3 ff ff       	call   18b0 <linkunlink>
+  concreate();
+    34d7:	e8 ea e0 ff ff       	call   15c6 <concreate>
+  fourfiles();
+    34dc:	e8 4b d9 ff ff       	call   e2c <fourfiles>
+  sharedfd();
+    34e1:	e8 a9 d7 ff ff       	call   c8f <sharedfd>
+
+  bigargtest();
+    34e6:	e8 a1 fb ff ff       	call   308c <bigargtest>
+  bigwrite();
+    34eb:	e8 36 ed ff ff       	call   2226 <bigwrite>
+  bigargtest();
+    34f0:	e8 97 fb ff ff       	call   308c <bigargtest>
+  bsstest();
+    34f5:	e8 2f fb ff ff       	call   3029 <bsstest>
+  sbrktest();
+    34fa:	e8 62 f6 ff ff       	call   2b61 <sbrktest>
+  validatetest();
+    34ff:	e8 77 fa ff ff       	call   2f7b <validatetest>
+
+  opentest();
+    3504:	e8 a3 cd ff ff       	call   2ac <opentest>
+  writetest();
+    3509:	e8 31 ce ff ff       	call   33f <writetest>
+  writetest1();
+    350e:	e8 f4 cf ff ff       	call   507 <writetest1>
+  createtest();
+    3513:	e8 9f d1 ff ff       	call   6b7 <createtest>
+
+  openiputtest();
+    3518:	e8 a6 cc ff ff       	call   1c3 <openiputtest>
+  exitiputtest();
+    351d:	e8 bb cb ff ff       	call   dd <exitiputtest>
+  iputtest();
+    3522:	e8 d9 ca ff ff       	call   0 <iputtest>
+
+  mem();
+    3527:	e8 a8 d6 ff ff       	call   bd4 <mem>
+  pipe1();
+    352c:	e8 58 d3 ff ff       	call   889 <pipe1>
+  preempt();
+    3531:	e8 f3 d4 ff ff       	call   a29 <preempt>
+  exitwait();
+    3536:	e8 29 d6 ff ff       	call   b64 <exitwait>
+
+  rmdot();
+    353b:	e8 ab f0 ff ff       	call   25eb <rmdot>
+  fourteen();
+    3540:	e8 69 ef ff ff       	call   24ae <fourteen>
+  bigfile();
+    3545:	e8 ae ed ff ff       	call   22f8 <bigfile>
+  subdir();
+    354a:	e8 a9 e5 ff ff       	call   1af8 <subdir>
+  linktest();
+    354f:	e8 4c de ff ff       	call   13a0 <linktest>
+  unlinkread();
+    3554:	e8 ae dc ff ff       	call   1207 <unlinkread>
+  dirfile();
+    3559:	e8 12 f2 ff ff       	call   2770 <dirfile>
+  iref();
+    355e:	e8 27 f4 ff ff       	call   298a <iref>
+  forktest();
+    3563:	e8 4a f5 ff ff       	call   2ab2 <forktest>
+  bigdir(); // slow
+    3568:	e8 37 e4 ff ff       	call   19a4 <bigdir>
+
+  uio();
+    356d:	e8 06 fe ff ff       	call   3378 <uio>
+
+  exectest();
+    3572:	e8 c9 d2 ff ff       	call   840 <exectest>
+
+  exit();
+    3577:	e8 9f 01 00 00       	call   371b <exit>
+
+0000357c <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    357c:	55                   	push   %ebp
+    357d:	89 e5                	mov    %esp,%ebp
+    357f:	56                   	push   %esi
+    3580:	53                   	push   %ebx
+    3581:	8b 75 08             	mov    0x8(%ebp),%esi
+    3584:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3587:	89 f0                	mov    %esi,%eax
+    3589:	89 d1                	mov    %edx,%ecx
+    358b:	83 c2 01             	add    $0x1,%edx
+    358e:	89 c3                	mov    %eax,%ebx
+    3590:	83 c0 01             	add    $0x1,%eax
+    3593:	0f b6 09             	movzbl (%ecx),%ecx
+    3596:	88 0b                	mov    %cl,(%ebx)
+    3598:	84 c9                	test   %cl,%cl
+    359a:	75 ed                	jne    3589 <strcpy+0xd>
+    ;
+  return os;
+}
+    359c:	89 f0                	mov    %esi,%eax
+    359e:	5b                   	pop    %ebx
+    359f:	5e                   	pop    %esi
+    35a0:	5d                   	pop    %ebp
+    35a1:	c3                   	ret
+
+000035a2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    35a2:	55                   	push   %ebp
+    35a3:	89 e5                	mov    %esp,%ebp
+    35a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    35a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    35ab:	eb 06                	jmp    35b3 <strcmp+0x11>
+    p++, q++;
+    35ad:	83 c1 01             	add    $0x1,%ecx
+    35b0:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    35b3:	0f b6 01             	movzbl (%ecx),%eax
+    35b6:	84 c0                	test   %al,%al
+    35b8:	74 04                	je     35be <strcmp+0x1c>
+    35ba:	3a 02                	cmp    (%edx),%al
+    35bc:	74 ef                	je     35ad <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+    35be:	0f b6 c0             	movzbl %al,%eax
+    35c1:	0f b6 12             	movzbl (%edx),%edx
+    35c4:	29 d0                	sub    %edx,%eax
+}
+    35c6:	5d                   	pop    %ebp
+    35c7:	c3                   	ret
+
+000035c8 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    35c8:	55                   	push   %ebp
+    35c9:	89 e5                	mov    %esp,%ebp
+    35cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    35ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    35d3:	eb 03                	jmp    35d8 <strlen+0x10>
+    35d5:	83 c0 01             	add    $0x1,%eax
+    35d8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    35dc:	75 f7                	jne    35d5 <strlen+0xd>
+    ;
+  return n;
+}
+    35de:	5d                   	pop    %ebp
+    35df:	c3                   	ret
+
+000035e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    35e0:	55                   	push   %ebp
+    35e1:	89 e5                	mov    %esp,%ebp
+    35e3:	57                   	push   %edi
+    35e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    35e7:	89 d7                	mov    %edx,%edi
+    35e9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    35ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+    35ef:	fc                   	cld
+    35f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    35f2:	89 d0                	mov    %edx,%eax
+    35f4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    35f7:	c9                   	leave
+    35f8:	c3                   	ret
+
+000035f9 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    35f9:	55                   	push   %ebp
+    35fa:	89 e5                	mov    %esp,%ebp
+    35fc:	8b 45 08             	mov    0x8(%ebp),%eax
+    35ff:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3603:	eb 03                	jmp    3608 <strchr+0xf>
+    3605:	83 c0 01             	add    $0x1,%eax
+    3608:	0f b6 10             	movzbl (%eax),%edx
+    360b:	84 d2                	test   %dl,%dl
+    360d:	74 06                	je     3615 <strchr+0x1c>
+    if(*s == c)
+    360f:	38 ca                	cmp    %cl,%dl
+    3611:	75 f2                	jne    3605 <strchr+0xc>
+    3613:	eb 05                	jmp    361a <strchr+0x21>
+      return (char*)s;
+  return 0;
+    3615:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    361a:	5d                   	pop    %ebp
+    361b:	c3                   	ret
+
+0000361c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    361c:	55                   	push   %ebp
+    361d:	89 e5                	mov    %esp,%ebp
+    361f:	57                   	push   %edi
+    3620:	56                   	push   %esi
+    3621:	53                   	push   %ebx
+    3622:	83 ec 1c             	sub    $0x1c,%esp
+    3625:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    3628:	bb 00 00 00 00       	mov    $0x0,%ebx
+    362d:	89 de                	mov    %ebx,%esi
+    362f:	83 c3 01             	add    $0x1,%ebx
+    3632:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3635:	7d 2e                	jge    3665 <gets+0x49>
+    cc = read(0, &c, 1);
+    3637:	83 ec 04             	sub    $0x4,%esp
+    363a:	6a 01                	push   $0x1
+    363c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    363f:	50                   	push   %eax
+    3640:	6a 00                	push   $0x0
+    3642:	e8 ec 00 00 00       	call   3733 <read>
+    if(cc < 1)
+    3647:	83 c4 10             	add    $0x10,%esp
+    364a:	85 c0                	test   %eax,%eax
+    364c:	7e 17                	jle    3665 <gets+0x49>
+      break;
+    buf[i++] = c;
+    364e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3652:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    3655:	3c 0a                	cmp    $0xa,%al
+    3657:	0f 94 c2             	sete   %dl
+    365a:	3c 0d                	cmp    $0xd,%al
+    365c:	0f 94 c0             	sete   %al
+    365f:	08 c2                	or     %al,%dl
+    3661:	74 ca                	je     362d <gets+0x11>
+    buf[i++] = c;
+    3663:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+    3665:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+    3669:	89 f8                	mov    %edi,%eax
+    366b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    366e:	5b                   	pop    %ebx
+    366f:	5e                   	pop    %esi
+    3670:	5f                   	pop    %edi
+    3671:	5d                   	pop    %ebp
+    3672:	c3                   	ret
+
+00003673 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    3673:	55                   	push   %ebp
+    3674:	89 e5                	mov    %esp,%ebp
+    3676:	56                   	push   %esi
+    3677:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3678:	83 ec 08             	sub    $0x8,%esp
+    367b:	6a 00                	push   $0x0
+    367d:	ff 75 08             	push   0x8(%ebp)
+    3680:	e8 d6 00 00 00       	call   375b <open>
+  if(fd < 0)
+    3685:	83 c4 10             	add    $0x10,%esp
+    3688:	85 c0                	test   %eax,%eax
+    368a:	78 24                	js     36b0 <stat+0x3d>
+    368c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    368e:	83 ec 08             	sub    $0x8,%esp
+    3691:	ff 75 0c             	push   0xc(%ebp)
+    3694:	50                   	push   %eax
+    3695:	e8 d9 00 00 00       	call   3773 <fstat>
+    369a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    369c:	89 1c 24             	mov    %ebx,(%esp)
+    369f:	e8 9f 00 00 00       	call   3743 <close>
+  return r;
+    36a4:	83 c4 10             	add    $0x10,%esp
+}
+    36a7:	89 f0                	mov    %esi,%eax
+    36a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    36ac:	5b                   	pop    %ebx
+    36ad:	5e                   	pop    %esi
+    36ae:	5d                   	pop    %ebp
+    36af:	c3                   	ret
+    return -1;
+    36b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    36b5:	eb f0                	jmp    36a7 <stat+0x34>
+
+000036b7 <atoi>:
+
+int
+atoi(const char *s)
+{
+    36b7:	55                   	push   %ebp
+    36b8:	89 e5                	mov    %esp,%ebp
+    36ba:	53                   	push   %ebx
+    36bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+    36be:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+    36c3:	eb 10                	jmp    36d5 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+    36c5:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+    36c8:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+    36cb:	83 c1 01             	add    $0x1,%ecx
+    36ce:	0f be c0             	movsbl %al,%eax
+    36d1:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+    36d5:	0f b6 01             	movzbl (%ecx),%eax
+    36d8:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    36db:	80 fb 09             	cmp    $0x9,%bl
+    36de:	76 e5                	jbe    36c5 <atoi+0xe>
+  return n;
+}
+    36e0:	89 d0                	mov    %edx,%eax
+    36e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    36e5:	c9                   	leave
+    36e6:	c3                   	ret
+
+000036e7 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    36e7:	55                   	push   %ebp
+    36e8:	89 e5                	mov    %esp,%ebp
+    36ea:	56                   	push   %esi
+    36eb:	53                   	push   %ebx
+    36ec:	8b 75 08             	mov    0x8(%ebp),%esi
+    36ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    36f2:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+    36f5:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+    36f7:	eb 0d                	jmp    3706 <memmove+0x1f>
+    *dst++ = *src++;
+    36f9:	0f b6 01             	movzbl (%ecx),%eax
+    36fc:	88 02                	mov    %al,(%edx)
+    36fe:	8d 49 01             	lea    0x1(%ecx),%ecx
+    3701:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+    3704:	89 d8                	mov    %ebx,%eax
+    3706:	8d 58 ff             	lea    -0x1(%eax),%ebx
+    3709:	85 c0                	test   %eax,%eax
+    370b:	7f ec                	jg     36f9 <memmove+0x12>
+  return vdst;
+}
+    370d:	89 f0                	mov    %esi,%eax
+    370f:	5b                   	pop    %ebx
+    3710:	5e                   	pop    %esi
+    3711:	5d                   	pop    %ebp
+    3712:	c3                   	ret
+
+00003713 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3713:	b8 01 00 00 00       	mov    $0x1,%eax
+    3718:	cd 40                	int    $0x40
+    371a:	c3                   	ret
+
+0000371b <exit>:
+SYSCALL(exit)
+    371b:	b8 02 00 00 00       	mov    $0x2,%eax
+    3720:	cd 40                	int    $0x40
+    3722:	c3                   	ret
+
+00003723 <wait>:
+SYSCALL(wait)
+    3723:	b8 03 00 00 00       	mov    $0x3,%eax
+    3728:	cd 40                	int    $0x40
+    372a:	c3                   	ret
+
+0000372b <pipe>:
+SYSCALL(pipe)
+    372b:	b8 04 00 00 00       	mov    $0x4,%eax
+    3730:	cd 40                	int    $0x40
+    3732:	c3                   	ret
+
+00003733 <read>:
+SYSCALL(read)
+    3733:	b8 05 00 00 00       	mov    $0x5,%eax
+    3738:	cd 40                	int    $0x40
+    373a:	c3                   	ret
+
+0000373b <write>:
+SYSCALL(write)
+    373b:	b8 10 00 00 00       	mov    $0x10,%eax
+    3740:	cd 40                	int    $0x40
+    3742:	c3                   	ret
+
+00003743 <close>:
+SYSCALL(close)
+    3743:	b8 15 00 00 00       	mov    $0x15,%eax
+    3748:	cd 40                	int    $0x40
+    374a:	c3                   	ret
+
+0000374b <kill>:
+SYSCALL(kill)
+    374b:	b8 06 00 00 00       	mov    $0x6,%eax
+    3750:	cd 40                	int    $0x40
+    3752:	c3                   	ret
+
+00003753 <exec>:
+SYSCALL(exec)
+    3753:	b8 07 00 00 00       	mov    $0x7,%eax
+    3758:	cd 40                	int    $0x40
+    375a:	c3                   	ret
+
+0000375b <open>:
+SYSCALL(open)
+    375b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3760:	cd 40                	int    $0x40
+    3762:	c3                   	ret
+
+00003763 <mknod>:
+SYSCALL(mknod)
+    3763:	b8 11 00 00 00       	mov    $0x11,%eax
+    3768:	cd 40                	int    $0x40
+    376a:	c3                   	ret
+
+0000376b <unlink>:
+SYSCALL(unlink)
+    376b:	b8 12 00 00 00       	mov    $0x12,%eax
+    3770:	cd 40                	int    $0x40
+    3772:	c3                   	ret
+
+00003773 <fstat>:
+SYSCALL(fstat)
+    3773:	b8 08 00 00 00       	mov    $0x8,%eax
+    3778:	cd 40                	int    $0x40
+    377a:	c3                   	ret
+
+0000377b <link>:
+SYSCALL(link)
+    377b:	b8 13 00 00 00       	mov    $0x13,%eax
+    3780:	cd 40                	int    $0x40
+    3782:	c3                   	ret
+
+00003783 <mkdir>:
+SYSCALL(mkdir)
+    3783:	b8 14 00 00 00       	mov    $0x14,%eax
+    3788:	cd 40                	int    $0x40
+    378a:	c3                   	ret
+
+0000378b <chdir>:
+SYSCALL(chdir)
+    378b:	b8 09 00 00 00       	mov    $0x9,%eax
+    3790:	cd 40                	int    $0x40
+    3792:	c3                   	ret
+
+00003793 <dup>:
+SYSCALL(dup)
+    3793:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3798:	cd 40                	int    $0x40
+    379a:	c3                   	ret
+
+0000379b <getpid>:
+SYSCALL(getpid)
+    379b:	b8 0b 00 00 00       	mov    $0xb,%eax
+    37a0:	cd 40                	int    $0x40
+    37a2:	c3                   	ret
+
+000037a3 <sbrk>:
+SYSCALL(sbrk)
+    37a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+    37a8:	cd 40                	int    $0x40
+    37aa:	c3                   	ret
+
+000037ab <sleep>:
+SYSCALL(sleep)
+    37ab:	b8 0d 00 00 00       	mov    $0xd,%eax
+    37b0:	cd 40                	int    $0x40
+    37b2:	c3                   	ret
+
+000037b3 <uptime>:
+SYSCALL(uptime)
+    37b3:	b8 0e 00 00 00       	mov    $0xe,%eax
+    37b8:	cd 40                	int    $0x40
+    37ba:	c3                   	ret
+
+000037bb <yield>:
+SYSCALL(yield)
+    37bb:	b8 16 00 00 00       	mov    $0x16,%eax
+    37c0:	cd 40                	int    $0x40
+    37c2:	c3                   	ret
+
+000037c3 <shutdown>:
+SYSCALL(shutdown)
+    37c3:	b8 17 00 00 00       	mov    $0x17,%eax
+    37c8:	cd 40                	int    $0x40
+    37ca:	c3                   	ret
+
+000037cb <nicefork>:
+SYSCALL(nicefork)
+    37cb:	b8 18 00 00 00       	mov    $0x18,%eax
+    37d0:	cd 40                	int    $0x40
+    37d2:	c3                   	ret
+
+000037d3 <schedlog>:
+SYSCALL(schedlog)
+    37d3:	b8 19 00 00 00       	mov    $0x19,%eax
+    37d8:	cd 40                	int    $0x40
+    37da:	c3                   	ret
+
+000037db <schedlogread>:
+SYSCALL(schedlogread)
+    37db:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    37e0:	cd 40                	int    $0x40
+    37e2:	c3                   	ret
+
+000037e3 <tracectl>:
+SYSCALL(tracectl)
+    37e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    37e8:	cd 40                	int    $0x40
+    37ea:	c3                   	ret
+
+000037eb <getcpustat>:
+SYSCALL(getcpustat)
+    37eb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    37f0:	cd 40                	int    $0x40
+    37f2:	c3                   	ret
+
+000037f3 <setpolicy>:
+SYSCALL(setpolicy)
+    37f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    37f8:	cd 40                	int    $0x40
+    37fa:	c3                   	ret
+
+000037fb <affinity>:
+SYSCALL(affinity)
+    37fb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3800:	cd 40                	int    $0x40
+    3802:	c3                   	ret
+
+00003803 <setnice>:
+SYSCALL(setnice)
+    3803:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3808:	cd 40                	int    $0x40
+    380a:	c3                   	ret
+
+0000380b <getnice>:
+SYSCALL(getnice)
+    380b:	b8 20 00 00 00       	mov    $0x20,%eax
+    3810:	cd 40                	int    $0x40
+    3812:	c3                   	ret
+
+00003813 <setclass>:
+SYSCALL(setclass)
+    3813:	b8 21 00 00 00       	mov    $0x21,%eax
+    3818:	cd 40                	int    $0x40
+    381a:	c3                   	ret
+
+0000381b <isocpu>:
+SYSCALL(isocpu)
+    381b:	b8 22 00 00 00       	mov    $0x22,%eax
+    3820:	cd 40                	int    $0x40
+    3822:	c3                   	ret
+
+00003823 <getschedstats>:
+SYSCALL(getschedstats)
+    3823:	b8 23 00 00 00       	mov    $0x23,%eax
+    3828:	cd 40                	int    $0x40
+    382a:	c3                   	ret
+
+0000382b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    382b:	55                   	push   %ebp
+    382c:	89 e5                	mov    %esp,%ebp
+    382e:	83 ec 1c             	sub    $0x1c,%esp
+    3831:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+    3834:	6a 01                	push   $0x1
+    3836:	8d 55 f4             	lea    -0xc(%ebp),%edx
+    3839:	52                   	push   %edx
+    383a:	50                   	push   %eax
+    383b:	e8 fb fe ff ff       	call   373b <write>
+}
+    3840:	83 c4 10             	add    $0x10,%esp
+    3843:	c9                   	leave
+    3844:	c3                   	ret
+
+00003845 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3845:	55                   	push   %ebp
+    3846:	89 e5                	mov    %esp,%ebp
+    3848:	57                   	push   %edi
+    3849:	56                   	push   %esi
+    384a:	53                   	push   %ebx
+    384b:	83 ec 2c             	sub    $0x2c,%esp
+    384e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    3851:	89 d0                	mov    %edx,%eax
+    3853:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    3855:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    3859:	0f 95 c1             	setne  %cl
+    385c:	c1 ea 1f             	shr    $0x1f,%edx
+    385f:	84 d1                	test   %dl,%cl
+    3861:	74 44                	je     38a7 <printint+0x62>
+    neg = 1;
+    x = -xx;
+    3863:	f7 d8                	neg    %eax
+    3865:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    3867:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    386e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    3873:	89 c8                	mov    %ecx,%eax
+    3875:	ba 00 00 00 00       	mov    $0x0,%edx
+    387a:	f7 f6                	div    %esi
+    387c:	89 df                	mov    %ebx,%edi
+    387e:	83 c3 01             	add    $0x1,%ebx
+    3881:	0f b6 92 78 53 00 00 	movzbl 0x5378(%edx),%edx
+    3888:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    388c:	89 ca                	mov    %ecx,%edx
+    388e:	89 c1                	mov    %eax,%ecx
+    3890:	39 f2                	cmp    %esi,%edx
+    3892:	73 df                	jae    3873 <printint+0x2e>
+  if(neg)
+    3894:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    3898:	74 31                	je     38cb <printint+0x86>
+    buf[i++] = '-';
+    389a:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    389f:	8d 5f 02             	lea    0x2(%edi),%ebx
+    38a2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    38a5:	eb 17                	jmp    38be <printint+0x79>
+    x = xx;
+    38a7:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    38a9:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    38b0:	eb bc                	jmp    386e <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    38b2:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    38b7:	89 f0                	mov    %esi,%eax
+    38b9:	e8 6d ff ff ff       	call   382b <putc>
+  while(--i >= 0)
+    38be:	83 eb 01             	sub    $0x1,%ebx
+    38c1:	79 ef                	jns    38b2 <printint+0x6d>
+}
+    38c3:	83 c4 2c             	add    $0x2c,%esp
+    38c6:	5b                   	pop    %ebx
+    38c7:	5e                   	pop    %esi
+    38c8:	5f                   	pop    %edi
+    38c9:	5d                   	pop    %ebp
+    38ca:	c3                   	ret
+    38cb:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    38ce:	eb ee                	jmp    38be <printint+0x79>
+
+000038d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    38d0:	55                   	push   %ebp
+    38d1:	89 e5                	mov    %esp,%ebp
+    38d3:	57                   	push   %edi
+    38d4:	56                   	push   %esi
+    38d5:	53                   	push   %ebx
+    38d6:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    38d9:	8d 45 10             	lea    0x10(%ebp),%eax
+    38dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+    38df:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    38e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    38e9:	eb 14                	jmp    38ff <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    38eb:	89 fa                	mov    %edi,%edx
+    38ed:	8b 45 08             	mov    0x8(%ebp),%eax
+    38f0:	e8 36 ff ff ff       	call   382b <putc>
+    38f5:	eb 05                	jmp    38fc <printf+0x2c>
+      }
+    } else if(state == '%'){
+    38f7:	83 fe 25             	cmp    $0x25,%esi
+    38fa:	74 25                	je     3921 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+    38fc:	83 c3 01             	add    $0x1,%ebx
+    38ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3902:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    3906:	84 c0                	test   %al,%al
+    3908:	0f 84 20 01 00 00    	je     3a2e <printf+0x15e>
+    c = fmt[i] & 0xff;
+    390e:	0f be f8             	movsbl %al,%edi
+    3911:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    3914:	85 f6                	test   %esi,%esi
+    3916:	75 df                	jne    38f7 <printf+0x27>
+      if(c == '%'){
+    3918:	83 f8 25             	cmp    $0x25,%eax
+    391b:	75 ce                	jne    38eb <printf+0x1b>
+        state = '%';
+    391d:	89 c6                	mov    %eax,%esi
+    391f:	eb db                	jmp    38fc <printf+0x2c>
+      if(c == 'd'){
+    3921:	83 f8 25             	cmp    $0x25,%eax
+    3924:	0f 84 cf 00 00 00    	je     39f9 <printf+0x129>
+    392a:	0f 8c dd 00 00 00    	jl     3a0d <printf+0x13d>
+    3930:	83 f8 78             	cmp    $0x78,%eax
+    3933:	0f 8f d4 00 00 00    	jg     3a0d <printf+0x13d>
+    3939:	83 f8 63             	cmp    $0x63,%eax
+    393c:	0f 8c cb 00 00 00    	jl     3a0d <printf+0x13d>
+    3942:	83 e8 63             	sub    $0x63,%eax
+    3945:	83 f8 15             	cmp    $0x15,%eax
+    3948:	0f 87 bf 00 00 00    	ja     3a0d <printf+0x13d>
+    394e:	ff 24 85 20 53 00 00 	jmp    *0x5320(,%eax,4)
+        printint(fd, *ap, 10, 1);
+    3955:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    3958:	8b 17                	mov    (%edi),%edx
+    395a:	83 ec 0c             	sub    $0xc,%esp
+    395d:	6a 01                	push   $0x1
+    395f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3964:	8b 45 08             	mov    0x8(%ebp),%eax
+    3967:	e8 d9 fe ff ff       	call   3845 <printint>
+        ap++;
+    396c:	83 c7 04             	add    $0x4,%edi
+    396f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    3972:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    3975:	be 00 00 00 00       	mov    $0x0,%esi
+    397a:	eb 80                	jmp    38fc <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+    397c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    397f:	8b 17                	mov    (%edi),%edx
+    3981:	83 ec 0c             	sub    $0xc,%esp
+    3984:	6a 00                	push   $0x0
+    3986:	b9 10 00 00 00       	mov    $0x10,%ecx
+    398b:	8b 45 08             	mov    0x8(%ebp),%eax
+    398e:	e8 b2 fe ff ff       	call   3845 <printint>
+        ap++;
+    3993:	83 c7 04             	add    $0x4,%edi
+    3996:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    3999:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    399c:	be 00 00 00 00       	mov    $0x0,%esi
+    39a1:	e9 56 ff ff ff       	jmp    38fc <printf+0x2c>
+        s = (char*)*ap;
+    39a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    39a9:	8b 30                	mov    (%eax),%esi
+        ap++;
+    39ab:	83 c0 04             	add    $0x4,%eax
+    39ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    39b1:	85 f6                	test   %esi,%esi
+    39b3:	75 15                	jne    39ca <printf+0xfa>
+          s = "(null)";
+    39b5:	be 16 53 00 00       	mov    $0x5316,%esi
+    39ba:	eb 0e                	jmp    39ca <printf+0xfa>
+          putc(fd, *s);
+    39bc:	0f be d2             	movsbl %dl,%edx
+    39bf:	8b 45 08             	mov    0x8(%ebp),%eax
+    39c2:	e8 64 fe ff ff       	call   382b <putc>
+          s++;
+    39c7:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    39ca:	0f b6 16             	movzbl (%esi),%edx
+    39cd:	84 d2                	test   %dl,%dl
+    39cf:	75 eb                	jne    39bc <printf+0xec>
+      state = 0;
+    39d1:	be 00 00 00 00       	mov    $0x0,%esi
+    39d6:	e9 21 ff ff ff       	jmp    38fc <printf+0x2c>
+        putc(fd, *ap);
+    39db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    39de:	0f be 17             	movsbl (%edi),%edx
+    39e1:	8b 45 08             	mov    0x8(%ebp),%eax
+    39e4:	e8 42 fe ff ff       	call   382b <putc>
+        ap++;
+    39e9:	83 c7 04             	add    $0x4,%edi
+    39ec:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+    39ef:	be 00 00 00 00       	mov    $0x0,%esi
+    39f4:	e9 03 ff ff ff       	jmp    38fc <printf+0x2c>
+        putc(fd, c);
+    39f9:	89 fa                	mov    %edi,%edx
+    39fb:	8b 45 08             	mov    0x8(%ebp),%eax
+    39fe:	e8 28 fe ff ff       	call   382b <putc>
+      state = 0;
+    3a03:	be 00 00 00 00       	mov    $0x0,%esi
+    3a08:	e9 ef fe ff ff       	jmp    38fc <printf+0x2c>
+        putc(fd, '%');
+    3a0d:	ba 25 00 00 00       	mov    $0x25,%edx
+    3a12:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a15:	e8 11 fe ff ff       	call   382b <putc>
+        putc(fd, c);
+    3a1a:	89 fa                	mov    %edi,%edx
+    3a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a1f:	e8 07 fe ff ff       	call   382b <putc>
+      state = 0;
+    3a24:	be 00 00 00 00       	mov    $0x0,%esi
+    3a29:	e9 ce fe ff ff       	jmp    38fc <printf+0x2c>
+    }
+  }
+}
+    3a2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a31:	5b                   	pop    %ebx
+    3a32:	5e                   	pop    %esi
+    3a33:	5f                   	pop    %edi
+    3a34:	5d                   	pop    %ebp
+    3a35:	c3                   	ret
+
+00003a36 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    3a36:	55                   	push   %ebp
+    3a37:	89 e5                	mov    %esp,%ebp
+    3a39:	57                   	push   %edi
+    3a3a:	56                   	push   %esi
+    3a3b:	53                   	push   %ebx
+    3a3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    3a3f:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3a42:	a1 60 9b 00 00       	mov    0x9b60,%eax
+    3a47:	eb 02                	jmp    3a4b <free+0x15>
+    3a49:	89 d0                	mov    %edx,%eax
+    3a4b:	39 c8                	cmp    %ecx,%eax
+    3a4d:	73 04                	jae    3a53 <free+0x1d>
+    3a4f:	3b 08                	cmp    (%eax),%ecx
+    3a51:	72 12                	jb     3a65 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3a53:	8b 10                	mov    (%eax),%edx
+    3a55:	39 d0                	cmp    %edx,%eax
+    3a57:	72 f0                	jb     3a49 <free+0x13>
+    3a59:	39 c8                	cmp    %ecx,%eax
+    3a5b:	72 08                	jb     3a65 <free+0x2f>
+    3a5d:	39 d1                	cmp    %edx,%ecx
+    3a5f:	72 04                	jb     3a65 <free+0x2f>
+    3a61:	89 d0                	mov    %edx,%eax
+    3a63:	eb e6                	jmp    3a4b <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    3a65:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    3a68:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    3a6b:	8b 10                	mov    (%eax),%edx
+    3a6d:	39 d7                	cmp    %edx,%edi
+    3a6f:	74 19                	je     3a8a <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+    3a71:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    3a74:	8b 50 04             	mov    0x4(%eax),%edx
+    3a77:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    3a7a:	39 ce                	cmp    %ecx,%esi
+    3a7c:	74 1b                	je     3a99 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+    3a7e:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+    3a80:	a3 60 9b 00 00       	mov    %eax,0x9b60
+}
+    3a85:	5b                   	pop    %ebx
+    3a86:	5e                   	pop    %esi
+    3a87:	5f                   	pop    %edi
+    3a88:	5d                   	pop    %ebp
+    3a89:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    3a8a:	03 72 04             	add    0x4(%edx),%esi
+    3a8d:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3a90:	8b 10                	mov    (%eax),%edx
+    3a92:	8b 12                	mov    (%edx),%edx
+    3a94:	89 53 f8             	mov    %edx,-0x8(%ebx)
+    3a97:	eb db                	jmp    3a74 <free+0x3e>
+    p->s.size += bp->s.size;
+    3a99:	03 53 fc             	add    -0x4(%ebx),%edx
+    3a9c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    3a9f:	8b 53 f8             	mov    -0x8(%ebx),%edx
+    3aa2:	89 10                	mov    %edx,(%eax)
+    3aa4:	eb da                	jmp    3a80 <free+0x4a>
+
+00003aa6 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    3aa6:	55                   	push   %ebp
+    3aa7:	89 e5                	mov    %esp,%ebp
+    3aa9:	53                   	push   %ebx
+    3aaa:	83 ec 04             	sub    $0x4,%esp
+    3aad:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    3aaf:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    3ab4:	77 05                	ja     3abb <morecore+0x15>
+    nu = 4096;
+    3ab6:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+    3abb:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    3ac2:	83 ec 0c             	sub    $0xc,%esp
+    3ac5:	50                   	push   %eax
+    3ac6:	e8 d8 fc ff ff       	call   37a3 <sbrk>
+  if(p == (char*)-1)
+    3acb:	83 c4 10             	add    $0x10,%esp
+    3ace:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ad1:	74 1c                	je     3aef <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+    3ad3:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    3ad6:	83 c0 08             	add    $0x8,%eax
+    3ad9:	83 ec 0c             	sub    $0xc,%esp
+    3adc:	50                   	push   %eax
+    3add:	e8 54 ff ff ff       	call   3a36 <free>
+  return freep;
+    3ae2:	a1 60 9b 00 00       	mov    0x9b60,%eax
+    3ae7:	83 c4 10             	add    $0x10,%esp
+}
+    3aea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3aed:	c9                   	leave
+    3aee:	c3                   	ret
+    return 0;
+    3aef:	b8 00 00 00 00       	mov    $0x0,%eax
+    3af4:	eb f4                	jmp    3aea <morecore+0x44>
+
+00003af6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    3af6:	55                   	push   %ebp
+    3af7:	89 e5                	mov    %esp,%ebp
+    3af9:	53                   	push   %ebx
+    3afa:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3afd:	8b 45 08             	mov    0x8(%ebp),%eax
+    3b00:	8d 58 07             	lea    0x7(%eax),%ebx
+    3b03:	c1 eb 03             	shr    $0x3,%ebx
+    3b06:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    3b09:	8b 0d 60 9b 00 00    	mov    0x9b60,%ecx
+    3b0f:	85 c9                	test   %ecx,%ecx
+    3b11:	74 04                	je     3b17 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3b13:	8b 01                	mov    (%ecx),%eax
+    3b15:	eb 4a                	jmp    3b61 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+    3b17:	c7 05 60 9b 00 00 64 	movl   $0x9b64,0x9b60
+    3b1e:	9b 00 00 
+    3b21:	c7 05 64 9b 00 00 64 	movl   $0x9b64,0x9b64
+    3b28:	9b 00 00 
+    base.s.size = 0;
+    3b2b:	c7 05 68 9b 00 00 00 	movl   $0x0,0x9b68
+    3b32:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+    3b35:	b9 64 9b 00 00       	mov    $0x9b64,%ecx
+    3b3a:	eb d7                	jmp    3b13 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+    3b3c:	74 19                	je     3b57 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    3b3e:	29 da                	sub    %ebx,%edx
+    3b40:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    3b43:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+    3b46:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    3b49:	89 0d 60 9b 00 00    	mov    %ecx,0x9b60
+      return (void*)(p + 1);
+    3b4f:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    3b52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b55:	c9                   	leave
+    3b56:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    3b57:	8b 10                	mov    (%eax),%edx
+    3b59:	89 11                	mov    %edx,(%ecx)
+    3b5b:	eb ec                	jmp    3b49 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3b5d:	89 c1                	mov    %eax,%ecx
+    3b5f:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+    3b61:	8b 50 04             	mov    0x4(%eax),%edx
+    3b64:	39 da                	cmp    %ebx,%edx
+    3b66:	73 d4                	jae    3b3c <malloc+0x46>
+    if(p == freep)
+    3b68:	39 05 60 9b 00 00    	cmp    %eax,0x9b60
+    3b6e:	75 ed                	jne    3b5d <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+    3b70:	89 d8                	mov    %ebx,%eax
+    3b72:	e8 2f ff ff ff       	call   3aa6 <morecore>
+    3b77:	85 c0                	test   %eax,%eax
+    3b79:	75 e2                	jne    3b5d <malloc+0x67>
+    3b7b:	eb d5                	jmp    3b52 <malloc+0x5c>
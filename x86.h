@@ -117,6 +117,25 @@ sti(void)
   asm volatile("sti");
 }
 
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+
+  asm volatile("rdtsc" : "=A" (tsc));
+  return tsc;
+}
+
+// Enable interrupts and halt until one arrives.  sti takes
+// effect only after the next instruction, so an interrupt that
+// is already pending wakes the hlt instead of being missed.
+static inline void
+stihlt(void)
+{
+  asm volatile("sti; hlt");
+}
+
 static inline uint
 xchg(volatile uint *addr, uint newval)
 {